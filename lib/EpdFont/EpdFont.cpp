@@ -72,6 +72,12 @@ void EpdFont::getTextDimensions(const char* string, int* w, int* h) const {
 }
 
 const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
+  // Nearly all Western text stays below U+0100, where the generated direct index avoids the search entirely
+  if (cp < 256 && data->latin1Index) {
+    const uint16_t index = data->latin1Index[cp];
+    return index != EPD_NO_GLYPH ? &data->glyph[index] : nullptr;
+  }
+
   const EpdUnicodeInterval* intervals = data->intervals;
   const int count = data->intervalCount;
 
@@ -31,6 +31,17 @@ typedef struct {
   uint32_t offset;  ///< Index of the first code point into the glyph array
 } EpdUnicodeInterval;
 
+/// Entry of EpdFontData::latin1Index for code points the font has no glyph for
+constexpr uint16_t EPD_NO_GLYPH = 0xFFFF;
+
+/// Source of compressed group data for fonts whose bitmap is not memory-mapped (font packs on the SD card)
+class EpdFontGroupSource {
+ public:
+  virtual ~EpdFontGroupSource() = default;
+  /// Reads `size` bytes at `offset` into the compressed data
+  virtual bool readCompressed(uint32_t offset, uint8_t* buffer, uint32_t size) const = 0;
+};
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
   const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
@@ -43,4 +54,15 @@ typedef struct {
   bool is2Bit;
   const EpdFontGroup* groups;  ///< NULL for uncompressed fonts
   uint16_t groupCount;         ///< 0 for uncompressed fonts
+  const uint16_t* latin1Index;  ///< Glyph index for each of U+0000..U+00FF, or NULL to always search intervals
+  /// Group index of every glyph for fonts grouped by corpus frequency, whose groups are not contiguous glyph ranges.
+  /// NULL when each group covers glyphs firstGlyphIndex..firstGlyphIndex+glyphCount-1.
+  const uint8_t* glyphGroups = nullptr;
+  /// Thresholded 1-bit copy of every group of a 2-bit font (bit set wherever the glyph has ink), indexed like groups.
+  /// A glyph's 1-bit bitmap starts at dataOffset / 2 within its decompressed group. NULL when the font has none.
+  const EpdFontGroup* bwGroups = nullptr;
+  /// Bit per glyph, set when its 2-bit bitmap has gray (1 or 2) pixels: glyph i is bit 0x80 >> (i % 8) of byte i / 8.
+  /// Present with bwGroups, whose thresholded bitmaps no longer tell anti-aliased glyphs from plain black ones.
+  const uint8_t* grayGlyphs = nullptr;
+  const EpdFontGroupSource* groupSource = nullptr;  ///< Set instead of bitmap when groups are read on demand
 } EpdFontData;
@@ -0,0 +1,248 @@
+#include "EpdFontPack.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <new>
+
+// The tables are read straight into these structs, so their layout is part of the file format
+static_assert(sizeof(EpdFontPackHeader) == 28, "EpdFontPackHeader layout changed");
+static_assert(sizeof(EpdUnicodeInterval) == 12, "EpdUnicodeInterval layout changed");
+static_assert(sizeof(EpdGlyph) == 16, "EpdGlyph layout changed");
+static_assert(sizeof(EpdFontGroup) == 16, "EpdFontGroup layout changed");
+
+namespace {
+template <typename T>
+bool readTable(FsFile& file, std::unique_ptr<T[]>& table, const uint32_t count) {
+  table.reset(new (std::nothrow) T[count]);
+  if (!table) {
+    LOG_ERR("EFP", "Failed to allocate %u table entries", count);
+    return false;
+  }
+  const int bytes = static_cast<int>(sizeof(T) * count);
+  return file.read(reinterpret_cast<uint8_t*>(table.get()), bytes) == bytes;
+}
+}  // namespace
+
+bool EpdFontPack::validate(const EpdFontPackHeader& header, const uint32_t fileSize) const {
+  if (memcmp(header.magic, "EPDF", 4) != 0) {
+    LOG_ERR("EFP", "Not an .epdfont pack");
+    return false;
+  }
+  if (header.version != VERSION) {
+    LOG_ERR("EFP", "Unsupported pack version %u (expected %u)", header.version, VERSION);
+    return false;
+  }
+  if (header.intervalCount == 0 || header.glyphCount == 0 || header.groupCount == 0) {
+    LOG_ERR("EFP", "Pack has no glyphs or is not compressed");
+    return false;
+  }
+  // 1-bit packs carry a second group table and a gray bit per glyph
+  const uint64_t bwTablesSize =
+      (header.flags & FLAG_BW_GROUPS) ? sizeof(EpdFontGroup) * header.groupCount + (header.glyphCount + 7) / 8 : 0;
+  const uint64_t expectedSize = sizeof(EpdFontPackHeader) + sizeof(EpdUnicodeInterval) * header.intervalCount +
+                                sizeof(EpdGlyph) * static_cast<uint64_t>(header.glyphCount) +
+                                sizeof(EpdFontGroup) * header.groupCount + header.compressedSize + bwTablesSize +
+                                ((header.flags & FLAG_GLYPH_GROUPS) ? header.glyphCount : 0);
+  if (expectedSize != fileSize) {
+    LOG_ERR("EFP", "Pack size mismatch: %u bytes, header describes %u", fileSize,
+            static_cast<uint32_t>(expectedSize));
+    return false;
+  }
+  return true;
+}
+
+// FontDecompressor walks tiered groups from firstGlyphIndex until it has seen glyphCount members, so the table must
+// agree with the group entries exactly
+bool EpdFontPack::validateGlyphGroups(const uint32_t glyphCount, const uint16_t groupCount) const {
+  std::unique_ptr<uint16_t[]> members(new (std::nothrow) uint16_t[groupCount]());
+  if (!members) {
+    return false;
+  }
+  for (uint32_t i = 0; i < glyphCount; i++) {
+    const uint8_t group = glyphGroups[i];
+    if (group >= groupCount || (members[group] == 0 && groups[group].firstGlyphIndex != i)) {
+      return false;
+    }
+    members[group]++;
+  }
+  for (uint16_t i = 0; i < groupCount; i++) {
+    if (members[i] != groups[i].glyphCount) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// A 1-bit group holds the glyphs of its 2-bit group at half their offsets, so only its compressed location may differ
+bool EpdFontPack::validateBwGroups(const uint16_t groupCount) const {
+  for (uint16_t i = 0; i < groupCount; i++) {
+    const EpdFontGroup& bw = bwGroups[i];
+    const EpdFontGroup& group = groups[i];
+    if (bw.glyphCount != group.glyphCount || bw.firstGlyphIndex != group.firstGlyphIndex ||
+        bw.uncompressedSize != (group.uncompressedSize + 1) / 2 ||
+        static_cast<uint64_t>(bw.compressedOffset) + bw.compressedSize > compressedSize) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// EpdFont::getGlyph binary-searches the intervals and indexes the glyph table with their offsets, unchecked
+bool EpdFontPack::validateIntervals(const uint32_t intervalCount, const uint32_t glyphCount) const {
+  for (uint32_t i = 0; i < intervalCount; i++) {
+    const EpdUnicodeInterval& interval = intervals[i];
+    if (interval.first > interval.last || (i > 0 && interval.first <= intervals[i - 1].last) ||
+        static_cast<uint64_t>(interval.offset) + (interval.last - interval.first) >= glyphCount) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// FontDecompressor returns glyph bitmaps as offsets into their decompressed group, and transposes whole groups
+bool EpdFontPack::validateGlyphs(const uint32_t glyphCount, const uint16_t groupCount) const {
+  const auto fitsGroup = [this](const EpdGlyph& glyph, const uint16_t group) {
+    // The 1-bit bitmap of a glyph is its packed pixels at half the 2-bit offset
+    return static_cast<uint64_t>(glyph.dataOffset) + glyph.dataLength <= groups[group].uncompressedSize &&
+           (!bwGroups || glyph.dataOffset / 2 + (static_cast<uint32_t>(glyph.width) * glyph.height + 7) / 8 <=
+                             bwGroups[group].uncompressedSize);
+  };
+
+  if (glyphGroups) {
+    for (uint32_t i = 0; i < glyphCount; i++) {
+      if (!fitsGroup(glyphs[i], glyphGroups[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+  // Every glyph in a group's range is checked against it, as the ranges of a malformed pack may overlap
+  for (uint16_t i = 0; i < groupCount; i++) {
+    for (uint16_t j = 0; j < groups[i].glyphCount; j++) {
+      if (!fitsGroup(glyphs[groups[i].firstGlyphIndex + j], i)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void EpdFontPack::unload() {
+  loaded = false;
+  file.close();
+  intervals.reset();
+  glyphs.reset();
+  groups.reset();
+  bwGroups.reset();
+  grayGlyphs.reset();
+  glyphGroups.reset();
+  data = {};
+}
+
+bool EpdFontPack::load(const char* path) {
+  unload();
+  if (!Storage.openFileForRead("EFP", path, file)) {
+    return false;
+  }
+
+  EpdFontPackHeader header;
+  if (file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header) ||
+      !validate(header, file.size())) {
+    LOG_ERR("EFP", "Invalid font pack %s", path);
+    file.close();
+    return false;
+  }
+
+  if (!readTable(file, intervals, header.intervalCount) || !readTable(file, glyphs, header.glyphCount) ||
+      !readTable(file, groups, header.groupCount) ||
+      ((header.flags & FLAG_BW_GROUPS) && (!readTable(file, bwGroups, header.groupCount) ||
+                                           !readTable(file, grayGlyphs, (header.glyphCount + 7) / 8))) ||
+      ((header.flags & FLAG_GLYPH_GROUPS) && !readTable(file, glyphGroups, header.glyphCount))) {
+    LOG_ERR("EFP", "Failed to read tables of %s", path);
+    file.close();
+    return false;
+  }
+
+  compressedDataOffset = file.position();
+  compressedSize = header.compressedSize;
+  for (uint16_t i = 0; i < header.groupCount; i++) {
+    const EpdFontGroup& group = groups[i];
+    if (static_cast<uint64_t>(group.compressedOffset) + group.compressedSize > compressedSize ||
+        (!glyphGroups && group.firstGlyphIndex + group.glyphCount > header.glyphCount)) {
+      LOG_ERR("EFP", "Group %u of %s is out of bounds", i, path);
+      file.close();
+      return false;
+    }
+  }
+
+  if (glyphGroups && !validateGlyphGroups(header.glyphCount, header.groupCount)) {
+    LOG_ERR("EFP", "Glyph group table of %s does not match its groups", path);
+    file.close();
+    return false;
+  }
+
+  if (bwGroups && (!(header.flags & FLAG_2BIT) || !validateBwGroups(header.groupCount))) {
+    LOG_ERR("EFP", "1-bit group table of %s does not match its groups", path);
+    file.close();
+    return false;
+  }
+
+  if (!validateIntervals(header.intervalCount, header.glyphCount)) {
+    LOG_ERR("EFP", "Interval table of %s is unsorted or points past its glyphs", path);
+    file.close();
+    return false;
+  }
+
+  if (!validateGlyphs(header.glyphCount, header.groupCount)) {
+    LOG_ERR("EFP", "Glyph table of %s has bitmaps outside their groups", path);
+    file.close();
+    return false;
+  }
+
+  // Packs carry no direct index; derive it from the intervals like fontconvert.py does for built-in fonts
+  std::fill(std::begin(latin1Index), std::end(latin1Index), EPD_NO_GLYPH);
+  for (uint32_t i = 0; i < header.intervalCount && intervals[i].first < 256; i++) {
+    const EpdUnicodeInterval& interval = intervals[i];
+    for (uint32_t cp = interval.first; cp <= interval.last && cp < 256; cp++) {
+      // EpdFont::getGlyph uses the entry without a bounds check
+      const uint64_t index = static_cast<uint64_t>(interval.offset) + cp - interval.first;
+      if (index < header.glyphCount && index < EPD_NO_GLYPH) {
+        latin1Index[cp] = static_cast<uint16_t>(index);
+      }
+    }
+  }
+
+  data = {};
+  data.bitmap = nullptr;
+  data.glyph = glyphs.get();
+  data.intervals = intervals.get();
+  data.intervalCount = header.intervalCount;
+  data.advanceY = header.advanceY;
+  data.ascender = header.ascender;
+  data.descender = header.descender;
+  data.is2Bit = (header.flags & FLAG_2BIT) != 0;
+  data.groups = groups.get();
+  data.groupCount = header.groupCount;
+  data.latin1Index = latin1Index;
+  data.glyphGroups = glyphGroups.get();
+  data.bwGroups = bwGroups.get();
+  data.grayGlyphs = grayGlyphs.get();
+  data.groupSource = this;
+
+  loaded = true;
+  LOG_DBG("EFP", "Loaded %s: %u glyphs in %u groups", path, header.glyphCount, header.groupCount);
+  return true;
+}
+
+bool EpdFontPack::readCompressed(const uint32_t offset, uint8_t* buffer, const uint32_t size) const {
+  if (!loaded || offset + size > compressedSize) {
+    return false;
+  }
+  if (!file.seek(compressedDataOffset + offset)) {
+    return false;
+  }
+  return file.read(buffer, size) == static_cast<int>(size);
+}
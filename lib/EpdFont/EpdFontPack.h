@@ -0,0 +1,69 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <memory>
+
+#include "EpdFontData.h"
+
+/// Header of an .epdfont pack, as written by fontconvert.py --epdfont. All values are little-endian. The header is
+/// followed by the interval table, the glyph table and the group table in the in-memory layout of EpdUnicodeInterval,
+/// EpdGlyph and EpdFontGroup, the 1-bit group table and the gray glyph bits when FLAG_BW_GROUPS is set, the per-glyph
+/// group indices when FLAG_GLYPH_GROUPS is set, and then by the concatenated DEFLATE groups.
+struct EpdFontPackHeader {
+  char magic[4];           ///< "EPDF"
+  uint16_t version;        ///< EpdFontPack::VERSION
+  uint8_t flags;           ///< EpdFontPack::FLAG_*
+  uint8_t advanceY;        ///< Newline distance (y axis)
+  int16_t ascender;        ///< Maximal height of a glyph above the base line
+  int16_t descender;       ///< Maximal height of a glyph below the base line
+  uint32_t intervalCount;  ///< Entries in the interval table
+  uint32_t glyphCount;     ///< Entries in the glyph table
+  uint16_t groupCount;     ///< Entries in the group table
+  uint16_t reserved;
+  uint32_t compressedSize;  ///< Size of the compressed group data
+};
+
+/// A compressed font loaded from an .epdfont pack on the SD card. Only the interval, glyph and group tables are kept
+/// in RAM; glyph groups stay on the card and are paged in through FontDecompressor when a glyph is drawn.
+class EpdFontPack final : public EpdFontGroupSource {
+ public:
+  static constexpr uint16_t VERSION = 1;
+  static constexpr uint8_t FLAG_2BIT = 0x01;
+  static constexpr uint8_t FLAG_GLYPH_GROUPS = 0x02;  // Groups are corpus tiers, see EpdFontData::glyphGroups
+  static constexpr uint8_t FLAG_BW_GROUPS = 0x04;     // Thresholded 1-bit groups, see EpdFontData::bwGroups
+
+  EpdFontPack() = default;
+  EpdFontPack(const EpdFontPack&) = delete;
+  EpdFontPack& operator=(const EpdFontPack&) = delete;
+  ~EpdFontPack() override = default;
+
+  bool load(const char* path);
+  // Frees the tables and closes the pack file. Fonts built on getData() must no longer be drawn.
+  void unload();
+  bool isLoaded() const { return loaded; }
+  // Font data for EpdFont, valid while the pack is alive
+  const EpdFontData* getData() const { return &data; }
+
+  bool readCompressed(uint32_t offset, uint8_t* buffer, uint32_t size) const override;
+
+ private:
+  mutable FsFile file;
+  uint32_t compressedDataOffset = 0;
+  uint32_t compressedSize = 0;
+  std::unique_ptr<EpdUnicodeInterval[]> intervals;
+  std::unique_ptr<EpdGlyph[]> glyphs;
+  std::unique_ptr<EpdFontGroup[]> groups;
+  std::unique_ptr<EpdFontGroup[]> bwGroups;
+  std::unique_ptr<uint8_t[]> grayGlyphs;
+  std::unique_ptr<uint8_t[]> glyphGroups;
+  uint16_t latin1Index[256] = {};
+  EpdFontData data = {};
+  bool loaded = false;
+
+  bool validate(const EpdFontPackHeader& header, uint32_t fileSize) const;
+  bool validateGlyphGroups(uint32_t glyphCount, uint16_t groupCount) const;
+  bool validateBwGroups(uint16_t groupCount) const;
+  bool validateIntervals(uint32_t intervalCount, uint32_t glyphCount) const;
+  bool validateGlyphs(uint32_t glyphCount, uint16_t groupCount) const;
+};
@@ -3,9 +3,45 @@
 #include <Logging.h>
 #include <uzlib.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
+namespace {
+// Calls fn for every glyph of a group. Groups are glyph ranges unless the font maps glyphs to groups individually.
+template <typename Fn>
+void forEachGroupGlyph(const EpdFontData* fontData, const uint16_t groupIndex, Fn&& fn) {
+  const EpdFontGroup& group = fontData->groups[groupIndex];
+  if (!fontData->glyphGroups) {
+    for (uint16_t i = 0; i < group.glyphCount; i++) {
+      fn(fontData->glyph[group.firstGlyphIndex + i]);
+    }
+    return;
+  }
+  // firstGlyphIndex is the lowest member, so the scan stops as soon as all members were seen
+  uint16_t seen = 0;
+  for (uint32_t i = group.firstGlyphIndex; seen < group.glyphCount; i++) {
+    if (fontData->glyphGroups[i] == groupIndex) {
+      fn(fontData->glyph[i]);
+      seen++;
+    }
+  }
+}
+
+// Location of a glyph within its decompressed group. The 1-bit copy of a 2-bit glyph sits at half its 2-bit offset.
+struct GlyphSpan {
+  uint32_t offset;
+  uint32_t length;
+};
+
+GlyphSpan glyphSpan(const EpdGlyph& glyph, const bool bw) {
+  if (bw) {
+    return {glyph.dataOffset / 2, (static_cast<uint32_t>(glyph.width) * glyph.height + 7) / 8};
+  }
+  return {glyph.dataOffset, glyph.dataLength};
+}
+}  // namespace
+
 bool FontDecompressor::init() {
   clearCache();
   memset(&decomp, 0, sizeof(decomp));
@@ -30,6 +66,9 @@ void FontDecompressor::clearCache() {
 }
 
 uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex) {
+  if (fontData->glyphGroups) {
+    return fontData->glyphGroups[glyphIndex];
+  }
   for (uint16_t i = 0; i < fontData->groupCount; i++) {
     uint16_t first = fontData->groups[i].firstGlyphIndex;
     if (glyphIndex >= first && glyphIndex < first + fontData->groups[i].glyphCount) {
@@ -39,9 +78,10 @@ uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint16_t g
   return fontData->groupCount;  // sentinel = not found
 }
 
-FontDecompressor::CacheEntry* FontDecompressor::findInCache(const EpdFontData* fontData, uint16_t groupIndex) {
+FontDecompressor::CacheEntry* FontDecompressor::findInCache(const EpdFontData* fontData, uint16_t groupIndex,
+                                                             uint8_t variant) {
   for (auto& entry : cache) {
-    if (entry.valid && entry.font == fontData && entry.groupIndex == groupIndex) {
+    if (entry.valid && entry.font == fontData && entry.groupIndex == groupIndex && entry.variant == variant) {
       return &entry;
     }
   }
@@ -65,8 +105,8 @@ FontDecompressor::CacheEntry* FontDecompressor::findEvictionCandidate() {
   return lru;
 }
 
-bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, CacheEntry* entry) {
-  const EpdFontGroup& group = fontData->groups[groupIndex];
+bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, bool bw, CacheEntry* entry) {
+  const EpdFontGroup& group = (bw ? fontData->bwGroups : fontData->groups)[groupIndex];
 
   // Free old buffer if reusing a slot
   if (entry->data) {
@@ -82,9 +122,28 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
     return false;
   }
 
-  // Decompress using uzlib
-  const uint8_t* inputBuf = &fontData->bitmap[group.compressedOffset];
+  // Font packs keep the compressed groups on the SD card, so the group is read into a temporary buffer first
+  uint8_t* packedBuf = nullptr;
+  const uint8_t* inputBuf;
+  if (fontData->groupSource) {
+    packedBuf = static_cast<uint8_t*>(malloc(group.compressedSize));
+    if (!packedBuf) {
+      LOG_ERR("FDC", "Failed to allocate %u bytes to read group %u", group.compressedSize, groupIndex);
+      free(outBuf);
+      return false;
+    }
+    if (!fontData->groupSource->readCompressed(group.compressedOffset, packedBuf, group.compressedSize)) {
+      LOG_ERR("FDC", "Failed to read group %u", groupIndex);
+      free(packedBuf);
+      free(outBuf);
+      return false;
+    }
+    inputBuf = packedBuf;
+  } else {
+    inputBuf = &fontData->bitmap[group.compressedOffset];
+  }
 
+  // Decompress using uzlib
   uzlib_uncompress_init(&decomp, NULL, 0);
   decomp.source = inputBuf;
   decomp.source_limit = inputBuf + group.compressedSize;
@@ -93,6 +152,7 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   decomp.dest_limit = outBuf + group.uncompressedSize;
 
   int res = uzlib_uncompress(&decomp);
+  free(packedBuf);
 
   if (res < 0 || decomp.dest != decomp.dest_limit) {
     LOG_ERR("FDC", "Decompression failed for group %u (status %d)", groupIndex, res);
@@ -104,15 +164,78 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   entry->groupIndex = groupIndex;
   entry->data = outBuf;
   entry->dataSize = group.uncompressedSize;
+  entry->variant = bw ? VARIANT_BW : 0;
   entry->valid = true;
   return true;
 }
 
+bool FontDecompressor::transposeGroup(const EpdFontData* fontData, uint16_t groupIndex, bool bw, uint8_t* data) {
+  const EpdFontGroup& group = (bw ? fontData->bwGroups : fontData->groups)[groupIndex];
+  const int bitsPerPixel = (fontData->is2Bit && !bw) ? 2 : 1;
+  const int pixelsPerByte = 8 / bitsPerPixel;
+  const uint8_t pixelMask = (1 << bitsPerPixel) - 1;
+
+  // Glyphs are transposed one at a time through a scratch copy sized for the largest glyph of the group
+  uint32_t maxLength = 0;
+  forEachGroupGlyph(fontData, groupIndex,
+                    [&](const EpdGlyph& glyph) { maxLength = std::max(maxLength, glyphSpan(glyph, bw).length); });
+  auto* scratch = static_cast<uint8_t*>(malloc(maxLength > 0 ? maxLength : 1));
+  if (!scratch) {
+    LOG_ERR("FDC", "Failed to allocate %u bytes to transpose group %u", maxLength, groupIndex);
+    return false;
+  }
+
+  forEachGroupGlyph(fontData, groupIndex, [&](const EpdGlyph& glyph) {
+    const GlyphSpan span = glyphSpan(glyph, bw);
+    if (span.offset + span.length > group.uncompressedSize) {
+      return;  // Reported by getBitmap when the glyph is requested
+    }
+    uint8_t* bitmap = &data[span.offset];
+    memcpy(scratch, bitmap, span.length);
+    memset(bitmap, 0, span.length);
+
+    for (int y = 0; y < glyph.height; y++) {
+      for (int x = 0; x < glyph.width; x++) {
+        const int src = y * glyph.width + x;
+        const int dst = x * glyph.height + y;
+        const int srcShift = (pixelsPerByte - 1 - src % pixelsPerByte) * bitsPerPixel;
+        const int dstShift = (pixelsPerByte - 1 - dst % pixelsPerByte) * bitsPerPixel;
+        bitmap[dst / pixelsPerByte] |= ((scratch[src / pixelsPerByte] >> srcShift) & pixelMask) << dstShift;
+      }
+    }
+  });
+
+  free(scratch);
+  return true;
+}
+
 const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint16_t glyphIndex) {
   if (!fontData->groups || fontData->groupCount == 0) {
     return &fontData->bitmap[glyph->dataOffset];
   }
+  return getGroupBitmap(fontData, glyph, glyphIndex, 0);
+}
 
+const uint8_t* FontDecompressor::getBitmapTransposed(const EpdFontData* fontData, const EpdGlyph* glyph,
+                                                     uint16_t glyphIndex) {
+  if (!fontData->groups || fontData->groupCount == 0) {
+    return nullptr;
+  }
+  return getGroupBitmap(fontData, glyph, glyphIndex, VARIANT_TRANSPOSED);
+}
+
+const uint8_t* FontDecompressor::getBwBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint16_t glyphIndex,
+                                             bool transposed) {
+  if (!fontData->bwGroups || fontData->groupCount == 0) {
+    return nullptr;
+  }
+  return getGroupBitmap(fontData, glyph, glyphIndex, VARIANT_BW | (transposed ? VARIANT_TRANSPOSED : 0));
+}
+
+const uint8_t* FontDecompressor::getGroupBitmap(const EpdFontData* fontData, const EpdGlyph* glyph,
+                                                uint16_t glyphIndex, uint8_t variant) {
+  const bool bw = (variant & VARIANT_BW) != 0;
+  const GlyphSpan span = glyphSpan(*glyph, bw);
   uint16_t groupIndex = getGroupIndex(fontData, glyphIndex);
   if (groupIndex >= fontData->groupCount) {
     LOG_ERR("FDC", "Glyph %u not found in any group", glyphIndex);
@@ -120,28 +243,37 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
   }
 
   // Check cache
-  CacheEntry* entry = findInCache(fontData, groupIndex);
+  CacheEntry* entry = findInCache(fontData, groupIndex, variant);
   if (entry) {
     entry->lastUsed = ++accessCounter;
-    if (glyph->dataOffset + glyph->dataLength > entry->dataSize) {
-      LOG_ERR("FDC", "dataOffset %u + dataLength %u out of bounds for group %u (size %u)", glyph->dataOffset,
-              glyph->dataLength, groupIndex, entry->dataSize);
+    if (span.offset + span.length > entry->dataSize) {
+      LOG_ERR("FDC", "dataOffset %u + dataLength %u out of bounds for group %u (size %u)", span.offset, span.length,
+              groupIndex, entry->dataSize);
       return nullptr;
     }
-    return &entry->data[glyph->dataOffset];
+    return &entry->data[span.offset];
   }
 
   // Cache miss - decompress
   entry = findEvictionCandidate();
-  if (!decompressGroup(fontData, groupIndex, entry)) {
+  if (!decompressGroup(fontData, groupIndex, bw, entry)) {
     return nullptr;
   }
+  if (variant & VARIANT_TRANSPOSED) {
+    if (!transposeGroup(fontData, groupIndex, bw, entry->data)) {
+      free(entry->data);
+      entry->data = nullptr;
+      entry->valid = false;
+      return nullptr;
+    }
+    entry->variant = variant;
+  }
 
   entry->lastUsed = ++accessCounter;
-  if (glyph->dataOffset + glyph->dataLength > entry->dataSize) {
-    LOG_ERR("FDC", "dataOffset %u + dataLength %u out of bounds for group %u (size %u)", glyph->dataOffset,
-            glyph->dataLength, groupIndex, entry->dataSize);
+  if (span.offset + span.length > entry->dataSize) {
+    LOG_ERR("FDC", "dataOffset %u + dataLength %u out of bounds for group %u (size %u)", span.offset, span.length,
+            groupIndex, entry->dataSize);
     return nullptr;
   }
-  return &entry->data[glyph->dataOffset];
+  return &entry->data[span.offset];
 }
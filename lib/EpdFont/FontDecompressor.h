@@ -15,18 +15,32 @@ class FontDecompressor {
   // Valid until LRU eviction (safe for the duration of one glyph render).
   const uint8_t* getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint16_t glyphIndex);
 
+  // Same as getBitmap, but every glyph of the group is transposed to column-major order (pixel (x, y) at index
+  // x * height + y) when the group is decompressed. Portrait text walks glyph columns along panel rows, so this lets
+  // it write whole framebuffer bytes. Transposed groups occupy their own cache slots.
+  const uint8_t* getBitmapTransposed(const EpdFontData* fontData, const EpdGlyph* glyph, uint16_t glyphIndex);
+
+  // Thresholded 1-bit bitmap of a 2-bit glyph from the font's bwGroups, row-major or (transposed) column-major like
+  // the two getters above. Returns nullptr if the font carries no 1-bit groups.
+  const uint8_t* getBwBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint16_t glyphIndex, bool transposed);
+
   // Evict all cached decompressed groups (call between pages for within-page-only caching).
   void clearCache();
 
  private:
   static constexpr uint8_t CACHE_SLOTS = 4;
 
+  // Decoded form of a cached group; every combination occupies its own cache slot
+  static constexpr uint8_t VARIANT_TRANSPOSED = 0x01;
+  static constexpr uint8_t VARIANT_BW = 0x02;
+
   struct CacheEntry {
     const EpdFontData* font = nullptr;
     uint16_t groupIndex = 0;
     uint8_t* data = nullptr;
     uint32_t dataSize = 0;
     uint32_t lastUsed = 0;
+    uint8_t variant = 0;
     bool valid = false;
   };
 
@@ -36,7 +50,10 @@ class FontDecompressor {
 
   void freeAllEntries();
   uint16_t getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex);
-  CacheEntry* findInCache(const EpdFontData* fontData, uint16_t groupIndex);
+  CacheEntry* findInCache(const EpdFontData* fontData, uint16_t groupIndex, uint8_t variant);
   CacheEntry* findEvictionCandidate();
-  bool decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, CacheEntry* entry);
+  bool decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, bool bw, CacheEntry* entry);
+  bool transposeGroup(const EpdFontData* fontData, uint16_t groupIndex, bool bw, uint8_t* data);
+  const uint8_t* getGroupBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint16_t glyphIndex,
+                                uint8_t variant);
 };
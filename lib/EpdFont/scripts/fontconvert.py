@@ -4,7 +4,9 @@ import zlib
 import sys
 import re
 import math
+import struct
 import argparse
+import json
 from collections import namedtuple
 
 # Originally from https://github.com/vroland/epdiy
@@ -16,7 +18,12 @@ parser.add_argument("fontstack", action="store", nargs='+', help="list of font f
 parser.add_argument("--2bit", dest="is2Bit", action="store_true", help="generate 2-bit greyscale bitmap instead of 1-bit black and white.")
 parser.add_argument("--additional-intervals", dest="additional_intervals", action="append", help="Additional code point intervals to export as min,max. This argument can be repeated.")
 parser.add_argument("--compress", dest="compress", action="store_true", help="Compress glyph bitmaps using DEFLATE with group-based compression.")
+parser.add_argument("--epdfont", dest="epdfont", action="store", help="Write a binary .epdfont pack to this path instead of printing a header. Implies --compress.")
+parser.add_argument("--group-layout", dest="group_layout", action="store", help="Group glyphs by a JSON layout from glyph_grouping.py instead of by Unicode block. Implies --compress.")
+parser.add_argument("--bw-bitmaps", dest="bw_bitmaps", action="store_true", help="Also store a thresholded 1-bit copy of every group for the black-and-white render pass. Requires --2bit, implies --compress.")
 args = parser.parse_args()
+if args.bw_bitmaps and not args.is2Bit:
+    parser.error("--bw-bitmaps requires --2bit")
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "data_length", "data_offset", "code_point"])
 
@@ -121,6 +128,19 @@ def chunks(l, n):
     for i in range(0, len(l), n):
         yield l[i:i + n]
 
+# 1-bit copy of a packed 2-bit glyph with a pixel set wherever the glyph has any ink. The renderer's BW pass draws
+# exactly these pixels, so it can read this bitmap instead of unpacking the 2-bit one.
+def threshold_2bit(packed, pixel_count):
+    bw = bytearray((pixel_count + 7) // 8)
+    for i in range(pixel_count):
+        if (packed[i // 4] >> ((3 - i % 4) * 2)) & 0x3:
+            bw[i // 8] |= 0x80 >> (i % 8)
+    return bytes(bw)
+
+# Whether a packed 2-bit glyph has pixels between white and black, which only the grayscale render passes draw
+def has_gray_2bit(packed, pixel_count):
+    return any(((packed[i // 4] >> ((3 - i % 4) * 2)) & 0x3) in (1, 2) for i in range(pixel_count))
+
 def load_glyph(code_point):
     face_index = 0
     while face_index < len(font_stack):
@@ -271,7 +291,7 @@ for index, glyph in enumerate(all_glyphs):
     glyph_data.extend([b for b in packed])
     glyph_props.append(props)
 
-compress = args.compress
+compress = args.compress or args.epdfont is not None or args.group_layout is not None or args.bw_bitmaps
 
 # Build groups for compression
 if compress:
@@ -299,38 +319,65 @@ if compress:
                 return i
         return -1
 
-    groups = []  # list of (first_glyph_index, glyph_count)
-    current_group_id = None
-    group_start = 0
-    group_count = 0
+    groups = []  # list of glyph index lists
+    assigned = set()
+
+    # Corpus-driven layout: each listed group holds the glyphs of its code points, in the listed order. Glyphs the
+    # layout does not mention fall through to the block grouping below.
+    if args.group_layout:
+        with open(args.group_layout) as f:
+            layout = json.load(f)
+        glyph_index_by_code_point = {props.code_point: i for i, (props, packed) in enumerate(all_glyphs)}
+        for code_points in layout["groups"]:
+            members = [glyph_index_by_code_point[cp] for cp in code_points
+                       if cp in glyph_index_by_code_point and glyph_index_by_code_point[cp] not in assigned]
+            if members:
+                groups.append(members)
+                assigned.update(members)
 
+    current_group_id = None
+    members = []
     for i, (props, packed) in enumerate(all_glyphs):
+        if i in assigned:
+            continue
         sg = get_script_group(props.code_point)
         if sg != current_group_id:
-            if group_count > 0:
-                groups.append((group_start, group_count))
+            if members:
+                groups.append(members)
             current_group_id = sg
-            group_start = i
-            group_count = 1
+            members = [i]
         else:
-            group_count += 1
+            members.append(i)
 
-    if group_count > 0:
-        groups.append((group_start, group_count))
+    if members:
+        groups.append(members)
+
+    # Block groups are contiguous glyph ranges; layout groups are not and need a per-glyph group table
+    tiered = args.group_layout is not None
+    if tiered and len(groups) > 255:
+        raise ValueError(f"{len(groups)} groups do not fit the 8-bit glyph group table")
+    glyph_groups = [0] * len(all_glyphs)
+    for group_index, members in enumerate(groups):
+        for gi in members:
+            glyph_groups[gi] = group_index
 
     # Compress each group
     compressed_groups = []  # list of (compressed_bytes, uncompressed_size, glyph_count, first_glyph_index)
+    bw_groups = []  # same, for the 1-bit copies
     compressed_bitmap_data = []
     compressed_offset = 0
 
     # Also build modified glyph props with within-group offsets
     modified_glyph_props = list(glyph_props)
 
-    for first_idx, count in groups:
+    for members in groups:
         # Concatenate bitmap data for this group
         group_data = b''
-        for gi in range(first_idx, first_idx + count):
+        for gi in members:
             props, packed = all_glyphs[gi]
+            # The 1-bit copy of a glyph is stored at half its 2-bit offset, which must be even so copies don't overlap
+            if args.bw_bitmaps and len(group_data) % 2:
+                group_data += b'\x00'
             # Update glyph's dataOffset to be within-group offset
             within_group_offset = len(group_data)
             old_props = modified_glyph_props[gi]
@@ -350,14 +397,74 @@ if compress:
         compressor = zlib.compressobj(level=9, wbits=-15)
         compressed = compressor.compress(group_data) + compressor.flush()
 
-        compressed_groups.append((compressed, len(group_data), count, first_idx))
+        compressed_groups.append((compressed, len(group_data), len(members), min(members)))
         compressed_bitmap_data.extend(compressed)
         compressed_offset += len(compressed)
 
+        if args.bw_bitmaps:
+            bw_data = bytearray((len(group_data) + 1) // 2)
+            for gi in members:
+                props = modified_glyph_props[gi]
+                bw = threshold_2bit(all_glyphs[gi][1], props.width * props.height)
+                bw_data[props.data_offset // 2:props.data_offset // 2 + len(bw)] = bw
+            compressor = zlib.compressobj(level=9, wbits=-15)
+            bw_groups.append((compressor.compress(bytes(bw_data)) + compressor.flush(), len(bw_data), len(members), min(members)))
+
+    # 1-bit groups follow all 2-bit groups in the compressed data
+    bw_group_offsets = []
+    for compressed, uncompressed_size, count, first_idx in bw_groups:
+        bw_group_offsets.append(len(compressed_bitmap_data))
+        compressed_bitmap_data.extend(compressed)
+
+    # The 1-bit groups drop the gray levels, so the glyphs that have any are recorded for EpdFontData::grayGlyphs
+    gray_glyphs = bytearray((len(all_glyphs) + 7) // 8)
+    if args.bw_bitmaps:
+        for i, (props, packed) in enumerate(all_glyphs):
+            if has_gray_2bit(packed, props.width * props.height):
+                gray_glyphs[i // 8] |= 0x80 >> (i % 8)
+
     glyph_props = modified_glyph_props
     total_compressed = len(compressed_bitmap_data)
     total_uncompressed = len(glyph_data)
     print(f"// Compression: {total_uncompressed} -> {total_compressed} bytes ({100*total_compressed/total_uncompressed:.1f}%), {len(groups)} groups", file=sys.stderr)
+    if bw_groups:
+        print(f"// 1-bit groups: {sum(len(c) for c, _, _, _ in bw_groups)} bytes compressed", file=sys.stderr)
+
+if args.epdfont:
+    # Binary font pack loaded from the SD card by EpdFontPack (see docs/file-formats.md). Tables use the in-memory
+    # layout of EpdUnicodeInterval, EpdGlyph and EpdFontGroup on the little-endian 32-bit target.
+    with open(args.epdfont, "wb") as pack:
+        pack.write(struct.pack("<4sHBBhhIIHHI",
+                               b"EPDF",
+                               1,  # EpdFontPack::VERSION
+                               (0x01 if is2Bit else 0x00) | (0x02 if tiered else 0x00) | (0x04 if bw_groups else 0x00),
+                               norm_ceil(face.size.height),
+                               norm_ceil(face.size.ascender),
+                               norm_floor(face.size.descender),
+                               len(intervals),
+                               len(glyph_props),
+                               len(compressed_groups),
+                               0,
+                               len(compressed_bitmap_data)))
+        offset = 0
+        for i_start, i_end in intervals:
+            pack.write(struct.pack("<III", i_start, i_end, offset))
+            offset += i_end - i_start + 1
+        for g in glyph_props:
+            pack.write(struct.pack("<BBBxhhHxxI", g.width, g.height, g.advance_x, g.left, g.top, g.data_length, g.data_offset))
+        compressed_offset = 0
+        for compressed, uncompressed_size, count, first_idx in compressed_groups:
+            pack.write(struct.pack("<IIIHH", compressed_offset, len(compressed), uncompressed_size, count, first_idx))
+            compressed_offset += len(compressed)
+        for (compressed, uncompressed_size, count, first_idx), offset in zip(bw_groups, bw_group_offsets):
+            pack.write(struct.pack("<IIIHH", offset, len(compressed), uncompressed_size, count, first_idx))
+        if bw_groups:
+            pack.write(bytes(gray_glyphs))
+        if tiered:
+            pack.write(bytes(glyph_groups))
+        pack.write(bytes(compressed_bitmap_data))
+    print(f"// Wrote {args.epdfont}", file=sys.stderr)
+    sys.exit(0)
 
 print(f"""/**
  * generated by fontconvert.py
@@ -401,6 +508,36 @@ if compress:
         compressed_offset += len(compressed)
     print("};\n")
 
+    if bw_groups:
+        print(f"static const EpdFontGroup {font_name}BwGroups[] = {{")
+        for (compressed, uncompressed_size, count, first_idx), offset in zip(bw_groups, bw_group_offsets):
+            print(f"    {{ {offset}, {len(compressed)}, {uncompressed_size}, {count}, {first_idx} }},")
+        print("};\n")
+
+        print(f"static const uint8_t {font_name}GrayGlyphs[{len(gray_glyphs)}] = {{")
+        for c in chunks(gray_glyphs, 16):
+            print("    " + " ".join(f"0x{b:02X}," for b in c))
+        print("};\n")
+
+    if tiered:
+        print(f"static const uint8_t {font_name}GlyphGroups[{len(glyph_groups)}] = {{")
+        for c in chunks(glyph_groups, 16):
+            print("    " + " ".join(f"{g}," for g in c))
+        print("};\n")
+
+# Direct glyph index for U+0000..U+00FF so EpdFont::getGlyph skips the interval search for Western text.
+# Missing code points map to 0xFFFF (EPD_NO_GLYPH).
+latin1_index = [0xFFFF] * 256
+offset = 0
+for i_start, i_end in intervals:
+    for code_point in range(i_start, min(i_end, 0xFF) + 1):
+        latin1_index[code_point] = offset + code_point - i_start
+    offset += i_end - i_start + 1
+print(f"static const uint16_t {font_name}Latin1Index[256] = {{")
+for c in chunks(latin1_index, 16):
+    print("    " + " ".join(f"0x{i:04X}," for i in c))
+print("};\n")
+
 print(f"static const EpdFontData {font_name} = {{")
 print(f"    {font_name}Bitmaps,")
 print(f"    {font_name}Glyphs,")
@@ -416,4 +553,12 @@ if compress:
 else:
     print(f"    nullptr,")
     print(f"    0,")
+print(f"    {font_name}Latin1Index,")
+if compress and tiered:
+    print(f"    {font_name}GlyphGroups,")
+elif compress and bw_groups:
+    print(f"    nullptr,")
+if compress and bw_groups:
+    print(f"    {font_name}BwGroups,")
+    print(f"    {font_name}GrayGlyphs,")
 print("};")
@@ -0,0 +1,328 @@
+#!/usr/bin/env python3
+"""
+Corpus-driven glyph grouping for compressed fonts.
+
+FontDecompressor keeps CACHE_SLOTS decompressed groups per page. With the default block grouping of fontconvert.py a
+single curly quote or accented letter inflates a whole Unicode block. This tool reads a text corpus (EPUB or plain
+text files), splits it into pages sized for the reader viewport, and measures how often each glyph of a generated
+font header is used and which glyphs share pages. From that it builds frequency-tiered groups of a target
+uncompressed size: the hottest glyphs first, then clusters of glyphs that co-occur.
+
+Every candidate target size is simulated against the page stream with the firmware's LRU policy (cache cleared
+between pages, every page rendered once per pass) next to the layout the header currently ships, and the layout with
+the fewest inflated bytes per page can be written as JSON for `fontconvert.py --group-layout`.
+
+Usage:
+  glyph_grouping.py --font ../builtinFonts/bookerly_14_regular.h --corpus books/*.epub --emit-layout layout.json
+"""
+import argparse
+import html.parser
+import json
+import os
+import re
+import sys
+import zipfile
+import zlib
+from collections import Counter, OrderedDict
+
+from verify_compression import parse_glyphs, parse_groups, parse_hex_array
+
+REPLACEMENT_GLYPH = 0xFFFD
+# Portrait viewport with the default reader margins
+DEFAULT_VIEWPORT = (470, 767)
+
+
+def load_font(path):
+    with open(path, 'r') as f:
+        content = f.read()
+
+    name_match = re.search(r'static const EpdFontGroup (\w+)Groups\[\]', content)
+    if not name_match:
+        raise ValueError(f"{path} is not a compressed font header")
+    name = name_match.group(1)
+
+    def array(type_name, suffix):
+        match = re.search(r'static const ' + type_name + r' ' + re.escape(name) + suffix + r'\[\d*\]\s*=\s*\{(.+?)\};',
+                          content, re.DOTALL)
+        return match.group(1) if match else None
+
+    compressed = parse_hex_array(array('uint8_t', 'Bitmaps'))
+    groups = parse_groups(array('EpdFontGroup', 'Groups'))
+    glyphs = parse_glyphs(array('EpdGlyph', 'Glyphs'))
+    intervals = [tuple(int(v, 16) for v in m)
+                 for m in re.findall(r'\{\s*0x([0-9A-F]+),\s*0x([0-9A-F]+),\s*0x([0-9A-F]+)\s*\}',
+                                     array('EpdUnicodeInterval', 'Intervals'))]
+    glyph_groups_text = array('uint8_t', 'GlyphGroups')
+    glyph_groups = [int(v) for v in re.findall(r'\d+', glyph_groups_text)] if glyph_groups_text else None
+    font_data = re.search(r'static const EpdFontData ' + re.escape(name) + r'\s*=\s*\{([^}]+)\}', content).group(1)
+    advance_y = int(font_data.split(',')[4])
+
+    # Per-glyph bitmaps, so candidate layouts can be recompressed
+    bitmaps = [b''] * len(glyphs)
+    for gi, group in enumerate(groups):
+        chunk = compressed[group['compressedOffset']:group['compressedOffset'] + group['compressedSize']]
+        data = zlib.decompress(chunk, -15)
+        members = [i for i in range(len(glyphs)) if glyph_groups[i] == gi] if glyph_groups else \
+            range(group['firstGlyphIndex'], group['firstGlyphIndex'] + group['glyphCount'])
+        for i in members:
+            glyph = glyphs[i]
+            bitmaps[i] = data[glyph['dataOffset']:glyph['dataOffset'] + glyph['dataLength']]
+
+    glyph_by_code_point = {}
+    for first, last, offset in intervals:
+        for cp in range(first, last + 1):
+            glyph_by_code_point[cp] = offset + cp - first
+    code_points = {i: cp for cp, i in glyph_by_code_point.items()}
+
+    if glyph_groups:
+        current = [[i for i in range(len(glyphs)) if glyph_groups[i] == gi] for gi in range(len(groups))]
+    else:
+        current = [list(range(g['firstGlyphIndex'], g['firstGlyphIndex'] + g['glyphCount'])) for g in groups]
+
+    return {
+        'name': name,
+        'glyphs': glyphs,
+        'bitmaps': bitmaps,
+        'glyph_by_code_point': glyph_by_code_point,
+        'code_points': code_points,
+        'advance_y': advance_y,
+        'current_layout': current,
+    }
+
+
+class TextExtractor(html.parser.HTMLParser):
+    SKIPPED = {'script', 'style', 'head'}
+
+    def __init__(self):
+        super().__init__()
+        self.parts = []
+        self.skip_depth = 0
+
+    def handle_starttag(self, tag, attrs):
+        if tag in self.SKIPPED:
+            self.skip_depth += 1
+
+    def handle_endtag(self, tag):
+        if tag in self.SKIPPED and self.skip_depth > 0:
+            self.skip_depth -= 1
+
+    def handle_data(self, data):
+        if self.skip_depth == 0:
+            self.parts.append(data)
+
+
+def read_corpus(paths):
+    """Yields the text of every document in the corpus."""
+    for path in paths:
+        if path.lower().endswith('.epub'):
+            with zipfile.ZipFile(path) as epub:
+                for entry in sorted(epub.namelist()):
+                    if entry.lower().endswith(('.xhtml', '.html', '.htm')):
+                        extractor = TextExtractor()
+                        extractor.feed(epub.read(entry).decode('utf-8', errors='replace'))
+                        yield ' '.join(extractor.parts)
+        else:
+            with open(path, 'r', encoding='utf-8', errors='replace') as f:
+                yield f.read()
+
+
+def paginate(font, documents, viewport):
+    """Splits the corpus into pages of glyph indices, in reading order."""
+    sequences = []
+    for text in documents:
+        text = ' '.join(text.split())
+        sequence = []
+        for ch in text:
+            glyph = font['glyph_by_code_point'].get(ord(ch), font['glyph_by_code_point'].get(REPLACEMENT_GLYPH))
+            if glyph is not None:
+                sequence.append(glyph)
+        if sequence:
+            sequences.append(sequence)
+
+    advances = Counter()
+    for sequence in sequences:
+        advances.update(sequence)
+    total = sum(advances.values())
+    if total == 0:
+        return [], 0
+    mean_advance = sum(font['glyphs'][g]['advanceX'] * n for g, n in advances.items()) / total
+    page_chars = max(1, int(viewport[0] / mean_advance) * (viewport[1] // font['advance_y']))
+
+    pages = []
+    for sequence in sequences:
+        pages.extend(sequence[i:i + page_chars] for i in range(0, len(sequence), page_chars))
+    return pages, page_chars
+
+
+def build_tiered_layout(font, pages, target_size):
+    """Frequency tier first, then co-occurrence clusters, each up to target_size uncompressed bytes.
+
+    Returns the layout and how many of its groups come from the corpus. Glyphs the corpus never used keep their
+    current block groups, which is what fontconvert.py does for code points a layout does not list."""
+    frequency = Counter()
+    page_sets = []
+    for page in pages:
+        frequency.update(page)
+        page_sets.append(set(page))
+
+    size = lambda g: len(font['bitmaps'][g])
+    remaining = sorted(frequency, key=lambda g: (-frequency[g], g))
+
+    # Tier 0: the glyphs nearly every page needs
+    hot = []
+    hot_size = 0
+    for g in remaining:
+        if hot and hot_size + size(g) > target_size:
+            break
+        hot.append(g)
+        hot_size += size(g)
+    layout = [hot]
+    remaining = [g for g in remaining if g not in set(hot)]
+
+    pages_of = {g: set() for g in remaining}
+    for page_index, page_set in enumerate(page_sets):
+        for g in page_set:
+            if g in pages_of:
+                pages_of[g].add(page_index)
+
+    # Later tiers: seed with the most frequent glyph left and add the glyphs that most often share its pages
+    while remaining:
+        seed = remaining[0]
+        group = [seed]
+        group_size = size(seed)
+        group_pages = set(pages_of[seed])
+        candidates = remaining[1:]
+        while candidates:
+            best = max(candidates, key=lambda g: (len(pages_of[g] & group_pages) / len(pages_of[g]), frequency[g]))
+            if group_size + size(best) > target_size:
+                break
+            group.append(best)
+            group_size += size(best)
+            group_pages |= pages_of[best]
+            candidates.remove(best)
+        layout.append(group)
+        members = set(group)
+        remaining = [g for g in remaining if g not in members]
+
+    listed = len(layout)
+    for members in font['current_layout']:
+        unused = [g for g in members if g not in frequency]
+        if unused:
+            layout.append(unused)
+    return layout, listed
+
+
+def compressed_sizes(font, layout):
+    sizes = []
+    for members in layout:
+        data = b''.join(font['bitmaps'][g] for g in members)
+        compressor = zlib.compressobj(level=9, wbits=-15)
+        sizes.append((len(data), len(compressor.compress(data) + compressor.flush())))
+    return sizes
+
+
+def simulate(font, layout, pages, cache_slots, passes):
+    """Replays every page through an LRU of cache_slots groups, cleared between pages like the reader does."""
+    group_of = {}
+    for group_index, members in enumerate(layout):
+        for g in members:
+            group_of[g] = group_index
+    sizes = compressed_sizes(font, layout)
+
+    lookups = misses = inflated = read = 0
+    for page in pages:
+        cache = OrderedDict()
+        for _ in range(passes):
+            for g in page:
+                group = group_of.get(g)
+                if group is None:
+                    continue
+                lookups += 1
+                if group in cache:
+                    cache.move_to_end(group)
+                    continue
+                misses += 1
+                inflated += sizes[group][0]
+                read += sizes[group][1]
+                cache[group] = True
+                if len(cache) > cache_slots:
+                    cache.popitem(last=False)
+
+    page_count = max(1, len(pages))
+    return {
+        'groups': len(layout),
+        'hit_rate': 1.0 - misses / lookups if lookups else 1.0,
+        'misses': misses / page_count,
+        'inflated': inflated / page_count,
+        'read': read / page_count,
+        'flash': sum(c for _, c in sizes),
+    }
+
+
+def firmware_cache_slots():
+    header = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'FontDecompressor.h')
+    try:
+        with open(header) as f:
+            match = re.search(r'CACHE_SLOTS\s*=\s*(\d+)', f.read())
+            if match:
+                return int(match.group(1))
+    except OSError:
+        pass
+    return 4
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build corpus-driven glyph groups for fontconvert.py --group-layout.")
+    parser.add_argument('--font', required=True, help="compressed font header generated by fontconvert.py")
+    parser.add_argument('--corpus', required=True, nargs='+', help="EPUB or UTF-8 text files")
+    parser.add_argument('--target-sizes', default='1024,2048,3072,4096,6144,8192',
+                        help="comma separated uncompressed group sizes to try (default: %(default)s)")
+    parser.add_argument('--cache-slots', type=int, default=firmware_cache_slots(),
+                        help="decompressed groups kept by FontDecompressor (default: CACHE_SLOTS, %(default)s)")
+    parser.add_argument('--passes', type=int, default=3,
+                        help="renders per page, 3 with text anti-aliasing (default: %(default)s)")
+    parser.add_argument('--viewport', default=f'{DEFAULT_VIEWPORT[0]}x{DEFAULT_VIEWPORT[1]}',
+                        help="text area used to size pages (default: %(default)s)")
+    parser.add_argument('--emit-layout', help="write the best layout as JSON to this path")
+    args = parser.parse_args()
+
+    font = load_font(args.font)
+    viewport = tuple(int(v) for v in args.viewport.split('x'))
+    pages, page_chars = paginate(font, read_corpus(args.corpus), viewport)
+    if not pages:
+        print("Corpus contains no text the font can render", file=sys.stderr)
+        sys.exit(1)
+    print(f"{font['name']}: {len(pages)} pages of ~{page_chars} glyphs, {args.cache_slots} cache slots, "
+          f"{args.passes} passes per page")
+
+    current = font['current_layout']
+    results = [('current', None, current, len(current),
+                simulate(font, current, pages, args.cache_slots, args.passes))]
+    for target in (int(v) for v in args.target_sizes.split(',')):
+        layout, listed = build_tiered_layout(font, pages, target)
+        results.append((f'tiered {target}', target, layout, listed,
+                        simulate(font, layout, pages, args.cache_slots, args.passes)))
+
+    print(f"{'layout':<16}{'groups':>8}{'hit rate':>10}{'inflates/pg':>13}{'inflate B/pg':>14}{'read B/pg':>11}"
+          f"{'flash B':>9}")
+    for label, _, _, _, stats in results:
+        print(f"{label:<16}{stats['groups']:>8}{stats['hit_rate'] * 100:>9.2f}%{stats['misses']:>13.2f}"
+              f"{stats['inflated']:>14.0f}{stats['read']:>11.0f}{stats['flash']:>9}")
+
+    label, target, layout, listed, stats = min(results[1:], key=lambda r: (r[4]['inflated'], r[4]['flash']))
+    print(f"Best: {label}, {stats['inflated']:.0f} inflated bytes per page "
+          f"({results[0][4]['inflated']:.0f} with the current layout)")
+
+    if args.emit_layout:
+        with open(args.emit_layout, 'w') as f:
+            json.dump({
+                'font': font['name'],
+                'targetSize': target,
+                'cacheSlots': args.cache_slots,
+                'groups': [[font['code_points'][g] for g in members] for members in layout[:listed]],
+            }, f, indent=1)
+        print(f"Wrote {args.emit_layout}")
+
+
+if __name__ == '__main__':
+    main()
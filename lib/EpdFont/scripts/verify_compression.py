@@ -48,6 +48,40 @@ def parse_glyphs(text):
     return glyphs
 
 
+def verify_bw_group(compressed_data, bw_group, group, decompressed, members):
+    """Check that a 1-bit group holds the thresholded 2-bit glyphs at half their offsets. Returns an error or None."""
+    if bw_group['glyphCount'] != group['glyphCount'] or bw_group['firstGlyphIndex'] != group['firstGlyphIndex']:
+        return "1-bit group covers different glyphs"
+    chunk = compressed_data[bw_group['compressedOffset']:bw_group['compressedOffset'] + bw_group['compressedSize']]
+    try:
+        bw_data = zlib.decompress(chunk, -15)
+    except zlib.error as e:
+        return f"1-bit decompression failed: {e}"
+    if len(bw_data) != bw_group['uncompressedSize'] or len(bw_data) != (len(decompressed) + 1) // 2:
+        return f"1-bit size mismatch (got {len(bw_data)} for {len(decompressed)} 2-bit bytes)"
+
+    for glyph in members:
+        if glyph['dataOffset'] % 2:
+            return f"odd 2-bit offset {glyph['dataOffset']}"
+        base = glyph['dataOffset'] // 2
+        for i in range(glyph['width'] * glyph['height']):
+            ink = (decompressed[glyph['dataOffset'] + i // 4] >> ((3 - i % 4) * 2)) & 0x3 != 0
+            if ((bw_data[base + i // 8] >> (7 - i % 8)) & 1) != ink:
+                return f"1-bit pixel {i} of glyph at offset {glyph['dataOffset']} does not match its 2-bit value"
+    return None
+
+
+def verify_gray_glyphs(gray_glyphs, decompressed, glyphs, members):
+    """Check the gray bit of every glyph of a group against its 2-bit pixels. Returns an error or None."""
+    for glyph_idx in members:
+        glyph = glyphs[glyph_idx]
+        gray = any(((decompressed[glyph['dataOffset'] + i // 4] >> ((3 - i % 4) * 2)) & 0x3) in (1, 2)
+                   for i in range(glyph['width'] * glyph['height']))
+        if bool(gray_glyphs[glyph_idx // 8] & (0x80 >> (glyph_idx % 8))) != gray:
+            return f"gray bit of glyph {glyph_idx} does not match its 2-bit pixels"
+    return None
+
+
 def verify_font_file(filepath):
     """Verify a single font header file. Returns (font_name, success, message)."""
     with open(filepath, 'r') as f:
@@ -92,6 +126,31 @@ def verify_font_file(filepath):
 
     glyphs = parse_glyphs(glyphs_match.group(1))
 
+    # Fonts grouped with --group-layout map every glyph to its group instead of using glyph ranges
+    glyph_groups_match = re.search(
+        r'static const uint8_t ' + re.escape(font_name) + r'GlyphGroups\[\d+\]\s*=\s*\{([^}]+)\}',
+        content, re.DOTALL
+    )
+    glyph_groups = [int(v) for v in re.findall(r'\d+', glyph_groups_match.group(1))] if glyph_groups_match else None
+    if glyph_groups is not None and len(glyph_groups) != len(glyphs):
+        return (font_name, False, f"GlyphGroups has {len(glyph_groups)} entries for {len(glyphs)} glyphs")
+
+    # Fonts converted with --bw-bitmaps carry a thresholded 1-bit copy of every group
+    bw_groups_match = re.search(
+        r'static const EpdFontGroup ' + re.escape(font_name) + r'BwGroups\[\]\s*=\s*\{(.+?)\};',
+        content, re.DOTALL
+    )
+    bw_groups = parse_groups(bw_groups_match.group(1)) if bw_groups_match else None
+    if bw_groups is not None and len(bw_groups) != len(groups):
+        return (font_name, False, f"BwGroups has {len(bw_groups)} entries for {len(groups)} groups")
+    gray_glyphs_match = re.search(
+        r'static const uint8_t ' + re.escape(font_name) + r'GrayGlyphs\[\d+\]\s*=\s*\{([^}]+)\}',
+        content, re.DOTALL
+    )
+    gray_glyphs = parse_hex_array(gray_glyphs_match.group(1)) if gray_glyphs_match else None
+    if bw_groups is not None and (gray_glyphs is None or len(gray_glyphs) != (len(glyphs) + 7) // 8):
+        return (font_name, False, "GrayGlyphs is missing or does not cover every glyph")
+
     # Verify each group
     for gi, group in enumerate(groups):
         # Extract compressed chunk
@@ -110,8 +169,13 @@ def verify_font_file(filepath):
 
         # Verify each glyph's data within the group
         first = group['firstGlyphIndex']
-        for j in range(group['glyphCount']):
-            glyph_idx = first + j
+        if glyph_groups is not None:
+            members = [i for i, g in enumerate(glyph_groups) if g == gi]
+            if not members or len(members) != group['glyphCount'] or members[0] != first:
+                return (font_name, False, f"group {gi}: GlyphGroups disagrees with glyphCount/firstGlyphIndex")
+        else:
+            members = range(first, first + group['glyphCount'])
+        for glyph_idx in members:
             if glyph_idx >= len(glyphs):
                 return (font_name, False, f"group {gi}: glyph index {glyph_idx} out of range")
 
@@ -123,6 +187,12 @@ def verify_font_file(filepath):
                 return (font_name, False, f"group {gi}, glyph {glyph_idx}: data extends beyond decompressed buffer "
                         f"(offset={offset}, length={length}, decompressed_size={len(decompressed)})")
 
+        if bw_groups is not None:
+            error = (verify_bw_group(compressed_data, bw_groups[gi], group, decompressed, [glyphs[i] for i in members])
+                     or verify_gray_glyphs(gray_glyphs, decompressed, glyphs, members))
+            if error:
+                return (font_name, False, f"group {gi}: {error}")
+
     return (font_name, True, f"{len(groups)} groups, {len(glyphs)} glyphs OK")
 
 
@@ -1,10 +1,11 @@
 #include "Page.h"
 
+#include <GfxRenderer.h>
 #include <Logging.h>
 #include <Serialization.h>
 
-void PageLine::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  block->render(renderer, fontId, xPos + xOffset, yPos + yOffset);
+void PageLine::render(GfxRenderer& renderer, const FontHandle font, const int xOffset, const int yOffset) {
+  block->render(renderer, font, xPos + xOffset, yPos + yOffset);
 }
 
 bool PageLine::serialize(FsFile& file) {
@@ -25,8 +26,8 @@ std::unique_ptr<PageLine> PageLine::deserialize(FsFile& file) {
   return std::unique_ptr<PageLine>(new PageLine(std::move(tb), xPos, yPos));
 }
 
-void PageImage::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) {
-  // Images don't use fontId or text rendering
+void PageImage::render(GfxRenderer& renderer, const FontHandle font, const int xOffset, const int yOffset) {
+  // Images don't use the font or text rendering
   imageBlock->render(renderer, xPos + xOffset, yPos + yOffset);
 }
 
@@ -49,8 +50,32 @@ std::unique_ptr<PageImage> PageImage::deserialize(FsFile& file) {
 }
 
 void Page::render(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+  // Resolve the font once per page rather than once per word
+  const FontHandle font = renderer.getFont(fontId);
   for (auto& element : elements) {
-    element->render(renderer, fontId, xOffset, yOffset);
+    element->render(renderer, font, xOffset, yOffset);
+  }
+}
+
+void Page::renderText(GfxRenderer& renderer, const int fontId, const int xOffset, const int yOffset) const {
+  const FontHandle font = renderer.getFont(fontId);
+  for (auto& element : elements) {
+    if (element->getTag() != TAG_PageImage) {
+      element->render(renderer, font, xOffset, yOffset);
+      continue;
+    }
+    const auto& image = static_cast<const PageImage&>(*element).getImageBlock();
+    renderer.drawRect(element->xPos + xOffset, element->yPos + yOffset, image.getWidth(), image.getHeight());
+  }
+}
+
+void Page::renderImages(GfxRenderer& renderer, const int xOffset, const int yOffset) const {
+  for (auto& element : elements) {
+    if (element->getTag() == TAG_PageImage) {
+      const auto& image = static_cast<const PageImage&>(*element).getImageBlock();
+      renderer.fillRect(element->xPos + xOffset, element->yPos + yOffset, image.getWidth(), image.getHeight(), false);
+      element->render(renderer, FontHandle(), xOffset, yOffset);
+    }
   }
 }
 
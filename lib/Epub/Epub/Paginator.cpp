@@ -0,0 +1,138 @@
+#include "Paginator.h"
+
+#include <Logging.h>
+#include <Serialization.h>
+
+namespace {
+enum LineStreamTag : uint8_t {
+  TAG_Spacing = 1,
+  TAG_Line = 2,
+  TAG_Image = 3,
+  TAG_End = 4,
+};
+}  // namespace
+
+void Paginator::ensurePage() {
+  if (!currentPage) {
+    currentPage.reset(new Page());
+    currentPageNextY = 0;
+  }
+}
+
+void Paginator::startNewPage() {
+  completePageFn(std::move(currentPage));
+  currentPage.reset(new Page());
+  currentPageNextY = 0;
+}
+
+void Paginator::recordTag(const uint8_t tag) {
+  if (lineStream) {
+    serialization::writePod(*lineStream, tag);
+  }
+}
+
+void Paginator::addSpacing(const int16_t height) {
+  ensurePage();
+  currentPageNextY += height;
+
+  if (lineStream) {
+    recordTag(TAG_Spacing);
+    serialization::writePod(*lineStream, height);
+  }
+}
+
+void Paginator::addLine(std::shared_ptr<TextBlock> line, const int16_t xOffset, const int16_t height) {
+  ensurePage();
+  if (currentPageNextY + height > viewportHeight) {
+    startNewPage();
+  }
+
+  if (lineStream) {
+    recordTag(TAG_Line);
+    serialization::writePod(*lineStream, xOffset);
+    serialization::writePod(*lineStream, height);
+    recordError = recordError || !line->serialize(*lineStream);
+  }
+
+  currentPage->elements.push_back(std::make_shared<PageLine>(std::move(line), xOffset, currentPageNextY));
+  currentPageNextY += height;
+}
+
+void Paginator::addImage(std::shared_ptr<ImageBlock> image, const int16_t xOffset, const uint16_t minViewportHeight) {
+  ensurePage();
+  // Only break if the image won't fit the remaining space
+  const int16_t height = image->getHeight();
+  if (!currentPage->elements.empty() && currentPageNextY + height > viewportHeight) {
+    startNewPage();
+  }
+
+  if (minViewportHeight > imagesMinViewportHeight) {
+    imagesMinViewportHeight = minViewportHeight;
+  }
+  if (lineStream) {
+    recordTag(TAG_Image);
+    serialization::writePod(*lineStream, xOffset);
+    serialization::writePod(*lineStream, minViewportHeight);
+    recordError = recordError || !image->serialize(*lineStream);
+  }
+
+  currentPage->elements.push_back(std::make_shared<PageImage>(std::move(image), xOffset, currentPageNextY));
+  currentPageNextY += height;
+}
+
+void Paginator::finish() {
+  ensurePage();
+  completePageFn(std::move(currentPage));
+  currentPage.reset();
+
+  recordTag(TAG_End);
+  lineStream = nullptr;
+}
+
+bool Paginator::replay(FsFile& file) {
+  while (true) {
+    uint8_t tag = 0;
+    if (file.read(&tag, sizeof(tag)) != sizeof(tag)) {
+      LOG_ERR("PGN", "Line stream ends without an end marker");
+      return false;
+    }
+
+    int16_t xOffset = 0;
+    int16_t height = 0;
+    switch (tag) {
+      case TAG_Spacing:
+        serialization::readPod(file, height);
+        addSpacing(height);
+        break;
+      case TAG_Line: {
+        serialization::readPod(file, xOffset);
+        serialization::readPod(file, height);
+        std::shared_ptr<TextBlock> line = TextBlock::deserialize(file);
+        if (!line) {
+          LOG_ERR("PGN", "Failed to read line from line stream");
+          return false;
+        }
+        addLine(std::move(line), xOffset, height);
+        break;
+      }
+      case TAG_Image: {
+        uint16_t minViewportHeight = UINT16_MAX;
+        serialization::readPod(file, xOffset);
+        serialization::readPod(file, minViewportHeight);
+        std::shared_ptr<ImageBlock> image = ImageBlock::deserialize(file);
+        if (!image) {
+          LOG_ERR("PGN", "Failed to read image from line stream");
+          return false;
+        }
+        addImage(std::move(image), xOffset, minViewportHeight);
+        break;
+      }
+      case TAG_End:
+        finish();
+        return true;
+      default:
+        LOG_ERR("PGN", "Unknown line stream tag %u", tag);
+        return false;
+    }
+  }
+}
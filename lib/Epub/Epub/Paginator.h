@@ -0,0 +1,54 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <functional>
+#include <memory>
+
+#include "Page.h"
+
+// Packs the laid-out lines and images of a chapter into pages of one viewport height.
+//
+// While the chapter is parsed, every item can also be recorded to a line stream. Line layout depends on the width and
+// font but not on the height, so replaying the stream packs the chapter for another viewport height without parsing
+// the XHTML or breaking lines again. Images sized against the viewport height restrict the heights the stream is good
+// for, see getMinViewportHeight() and getMaxViewportHeight().
+class Paginator {
+ public:
+  using CompletePageFn = std::function<void(std::unique_ptr<Page>)>;
+
+  Paginator(const uint16_t viewportHeight, CompletePageFn completePageFn)
+      : viewportHeight(viewportHeight), completePageFn(std::move(completePageFn)) {}
+
+  // Records every item added from now on to lineStream
+  void record(FsFile* lineStream) { this->lineStream = lineStream; }
+
+  void addSpacing(int16_t height);
+  void addLine(std::shared_ptr<TextBlock> line, int16_t xOffset, int16_t height);
+  // minViewportHeight: smallest viewport height the image keeps its size in, UINT16_MAX if it was sized for this one
+  void addImage(std::shared_ptr<ImageBlock> image, int16_t xOffset, uint16_t minViewportHeight);
+  // Completes the last page and ends the recording
+  void finish();
+
+  // Packs the items of a recorded line stream, reading up to its end marker
+  bool replay(FsFile& file);
+
+  bool recordingFailed() const { return recordError; }
+  // Viewport heights the recorded items paginate to the same layout for
+  uint16_t getMinViewportHeight() const { return heightDependent() ? viewportHeight : imagesMinViewportHeight; }
+  uint16_t getMaxViewportHeight() const { return heightDependent() ? viewportHeight : UINT16_MAX; }
+
+ private:
+  uint16_t viewportHeight;
+  CompletePageFn completePageFn;
+  std::unique_ptr<Page> currentPage;
+  int16_t currentPageNextY = 0;
+
+  FsFile* lineStream = nullptr;
+  bool recordError = false;
+  uint16_t imagesMinViewportHeight = 0;
+
+  bool heightDependent() const { return imagesMinViewportHeight > viewportHeight; }
+  void ensurePage();
+  void startNewPage();
+  void recordTag(uint8_t tag);
+};
@@ -4,14 +4,18 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
-#include <iterator>
 #include <limits>
 #include <vector>
 
 #include "hyphenation/Hyphenator.h"
 
 constexpr int MAX_COST = std::numeric_limits<int>::max();
+// Cost of ending a line with a hyphen, as the squared slack of this many spaces; doubled right after another hyphen
+constexpr int HYPHEN_PENALTY_SPACES = 6;
+// Most breaks the total-fit breaker keeps open at once
+constexpr size_t MAX_ACTIVE_BREAKS = 64;
 
 namespace {
 
@@ -19,59 +23,75 @@ namespace {
 constexpr char SOFT_HYPHEN_UTF8[] = "\xC2\xAD";
 constexpr size_t SOFT_HYPHEN_BYTES = 2;
 
-bool containsSoftHyphen(const std::string& word) { return word.find(SOFT_HYPHEN_UTF8) != std::string::npos; }
-
-// Removes every soft hyphen in-place so rendered glyphs match measured widths.
-void stripSoftHyphensInPlace(std::string& word) {
-  size_t pos = 0;
-  while ((pos = word.find(SOFT_HYPHEN_UTF8, pos)) != std::string::npos) {
-    word.erase(pos, SOFT_HYPHEN_BYTES);
-  }
+bool isSoftHyphenAt(const char* word, const size_t length, const size_t pos) {
+  return pos + SOFT_HYPHEN_BYTES <= length && word[pos] == SOFT_HYPHEN_UTF8[0] && word[pos + 1] == SOFT_HYPHEN_UTF8[1];
 }
 
-// Returns the advance width for a word while ignoring soft hyphen glyphs and optionally appending a visible hyphen.
-// Uses advance width (sum of glyph advances) rather than bounding box width so that italic glyph overhangs
-// don't inflate inter-word spacing.
-uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const std::string& word,
-                          const EpdFontFamily::Style style, const bool appendHyphen = false) {
-  if (word.size() == 1 && word[0] == ' ' && !appendHyphen) {
-    return renderer.getSpaceWidth(fontId, style);
-  }
-  const bool hasSoftHyphen = containsSoftHyphen(word);
-  if (!hasSoftHyphen && !appendHyphen) {
-    return renderer.getTextAdvanceX(fontId, word.c_str(), style);
+bool containsSoftHyphen(const char* word, const size_t length) {
+  for (size_t pos = 0; pos + 1 < length; pos++) {
+    if (isSoftHyphenAt(word, length, pos)) return true;
   }
+  return false;
+}
 
-  std::string sanitized = word;
-  if (hasSoftHyphen) {
-    stripSoftHyphensInPlace(sanitized);
+// Copies a word into out without its soft hyphens so rendered glyphs match measured widths, optionally appending a
+// visible hyphen.
+void appendSanitizedWord(std::string& out, const char* word, const size_t length, const bool appendHyphen) {
+  for (size_t pos = 0; pos < length; pos++) {
+    if (isSoftHyphenAt(word, length, pos)) {
+      pos += SOFT_HYPHEN_BYTES - 1;
+      continue;
+    }
+    out.push_back(word[pos]);
   }
   if (appendHyphen) {
-    sanitized.push_back('-');
+    out.push_back('-');
   }
-  return renderer.getTextAdvanceX(fontId, sanitized.c_str(), style);
 }
 
 }  // namespace
 
-void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle, const bool underline,
+void ParsedText::addWord(const char* word, const EpdFontFamily::Style fontStyle, const bool underline,
                          const bool attachToPrevious) {
-  if (word.empty()) return;
+  const size_t length = strlen(word);
+  if (length == 0) return;
 
-  words.push_back(std::move(word));
   EpdFontFamily::Style combinedStyle = fontStyle;
   if (underline) {
     combinedStyle = static_cast<EpdFontFamily::Style>(combinedStyle | EpdFontFamily::UNDERLINE);
   }
-  wordStyles.push_back(combinedStyle);
-  wordContinues.push_back(attachToPrevious);
+  wordOffsets.push_back(static_cast<uint32_t>(text.size()));
+  wordLengths.push_back(static_cast<uint16_t>(length));
+  wordFlags.push_back(
+      static_cast<uint8_t>((combinedStyle & WORD_STYLE_MASK) | (attachToPrevious ? WORD_CONTINUES : 0)));
+  text.append(word, length);
+  text.push_back('\0');
+}
+
+// Returns the advance width for a word while ignoring soft hyphen glyphs and optionally appending a visible hyphen.
+// Uses advance width (sum of glyph advances) rather than bounding box width so that italic glyph overhangs
+// don't inflate inter-word spacing.
+uint16_t ParsedText::measureWord(const GfxRenderer& renderer, const FontHandle font, const size_t offset,
+                                 const size_t length, const EpdFontFamily::Style style, const bool appendHyphen) {
+  const char* word = text.data() + offset;
+  if (length == 1 && word[0] == ' ' && !appendHyphen) {
+    return renderer.getSpaceWidth(font, style);
+  }
+  // Words still followed by their NUL are measured in place
+  if (!appendHyphen && word[length] == '\0' && !containsSoftHyphen(word, length)) {
+    return renderer.getTextAdvanceX(font, word, style);
+  }
+
+  wordScratch.clear();
+  appendSanitizedWord(wordScratch, word, length, appendHyphen);
+  return renderer.getTextAdvanceX(font, wordScratch.c_str(), style);
 }
 
 // Consumes data to minimize memory usage
-void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
+void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const FontHandle font, const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
                                        const bool includeLastLine) {
-  if (words.empty()) {
+  if (isEmpty()) {
     return;
   }
 
@@ -79,49 +99,67 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
   applyParagraphIndent();
 
   const int pageWidth = viewportWidth;
-  const int spaceWidth = renderer.getSpaceWidth(fontId);
-  auto wordWidths = calculateWordWidths(renderer, fontId);
-
-  // Build indexed continues vector from the parallel list for O(1) access during layout
-  std::vector<bool> continuesVec(wordContinues.begin(), wordContinues.end());
+  const int spaceWidth = renderer.getSpaceWidth(font);
+  auto wordWidths = calculateWordWidths(renderer, font);
 
   std::vector<size_t> lineBreakIndices;
-  if (hyphenationEnabled) {
+  if (hyphenationEnabled && hyphenatedBreaking == HyphenatedBreaking::Greedy) {
     // Use greedy layout that can split words mid-loop when a hyphenated prefix fits.
-    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+    lineBreakIndices = computeHyphenatedLineBreaks(renderer, font, pageWidth, spaceWidth, wordWidths);
+  } else if (hyphenationEnabled) {
+    lineBreakIndices = computeTotalFitLineBreaks(renderer, font, pageWidth, spaceWidth, wordWidths);
   } else {
-    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+    lineBreakIndices = computeLineBreaks(renderer, font, pageWidth, spaceWidth, wordWidths);
   }
   const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
 
   for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, spaceWidth, wordWidths, continuesVec, lineBreakIndices, processLine);
+    extractLine(i, pageWidth, spaceWidth, wordWidths, lineBreakIndices, processLine);
   }
+  consumeWords(lineCount > 0 ? lineBreakIndices[lineCount - 1] : 0);
 }
 
-std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
-  const size_t totalWordCount = words.size();
+// Drops the first count words, which extractLine has handed out, keeping the rest at the front of the arena
+void ParsedText::consumeWords(const size_t count) {
+  if (count >= wordOffsets.size()) {
+    text.clear();
+    wordOffsets.clear();
+    wordLengths.clear();
+    wordFlags.clear();
+    return;
+  }
+  if (count == 0) {
+    return;
+  }
 
-  std::vector<uint16_t> wordWidths;
-  wordWidths.reserve(totalWordCount);
+  const uint32_t consumedBytes = wordOffsets[count];
+  text.erase(0, consumedBytes);
+  wordOffsets.erase(wordOffsets.begin(), wordOffsets.begin() + count);
+  wordLengths.erase(wordLengths.begin(), wordLengths.begin() + count);
+  wordFlags.erase(wordFlags.begin(), wordFlags.begin() + count);
+  for (auto& offset : wordOffsets) {
+    offset -= consumedBytes;
+  }
+}
 
-  auto wordsIt = words.begin();
-  auto wordStylesIt = wordStyles.begin();
+std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const FontHandle font) {
+  const size_t totalWordCount = size();
 
-  while (wordsIt != words.end()) {
-    wordWidths.push_back(measureWordWidth(renderer, fontId, *wordsIt, *wordStylesIt));
+  std::vector<uint16_t> wordWidths;
+  wordWidths.reserve(totalWordCount);
 
-    std::advance(wordsIt, 1);
-    std::advance(wordStylesIt, 1);
+  for (size_t i = 0; i < totalWordCount; i++) {
+    wordWidths.push_back(measureWord(renderer, font, wordOffsets[i], wordLengths[i], wordStyle(i),
+                                     (wordFlags[i] & WORD_HYPHENATED) != 0));
   }
 
   return wordWidths;
 }
 
-std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const int fontId, const int pageWidth,
-                                                  const int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec) {
-  if (words.empty()) {
+std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const FontHandle font,
+                                                  const int pageWidth, const int spaceWidth,
+                                                  std::vector<uint16_t>& wordWidths) {
+  if (isEmpty()) {
     return {};
   }
 
@@ -137,14 +175,13 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
     // First word needs to fit in reduced width if there's an indent
     const int effectiveWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
     while (wordWidths[i] > effectiveWidth) {
-      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, fontId, wordWidths, /*allowFallbackBreaks=*/true,
-                                &continuesVec)) {
+      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, font, wordWidths, /*allowFallbackBreaks=*/true)) {
         break;
       }
     }
   }
 
-  const size_t totalWordCount = words.size();
+  const size_t totalWordCount = size();
 
   // DP table to store the minimum badness (cost) of lines starting at index i
   std::vector<int> dp(totalWordCount);
@@ -164,7 +201,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
 
     for (size_t j = i; j < totalWordCount; ++j) {
       // Add space before word j, unless it's the first word on the line or a continuation
-      const int gap = j > static_cast<size_t>(i) && !continuesVec[j] ? spaceWidth : 0;
+      const int gap = j > static_cast<size_t>(i) && !wordContinues(j) ? spaceWidth : 0;
       currlen += wordWidths[j] + gap;
 
       if (currlen > effectivePageWidth) {
@@ -172,7 +209,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
       }
 
       // Cannot break after word j if the next word attaches to it (continuation group)
-      if (j + 1 < totalWordCount && continuesVec[j + 1]) {
+      if (j + 1 < totalWordCount && wordContinues(j + 1)) {
         continue;
       }
 
@@ -231,7 +268,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
 }
 
 void ParsedText::applyParagraphIndent() {
-  if (extraParagraphSpacing || words.empty()) {
+  if (extraParagraphSpacing || isEmpty()) {
     return;
   }
 
@@ -240,15 +277,21 @@ void ParsedText::applyParagraphIndent() {
     // The actual indent positioning is handled in extractLine()
   } else if (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left) {
     // No CSS text-indent defined - use EmSpace fallback for visual indent
-    words.front().insert(0, "\xe2\x80\x83");
+    // The first word sits at the front of the arena, so only the words after it move
+    constexpr char EM_SPACE[] = "\xe2\x80\x83";
+    constexpr size_t EM_SPACE_BYTES = sizeof(EM_SPACE) - 1;
+    text.insert(wordOffsets[0], EM_SPACE, EM_SPACE_BYTES);
+    wordLengths[0] += EM_SPACE_BYTES;
+    for (size_t i = 1; i < wordOffsets.size(); i++) {
+      wordOffsets[i] += EM_SPACE_BYTES;
+    }
   }
 }
 
 // Builds break indices while opportunistically splitting the word that would overflow the current line.
-std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const int fontId,
+std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const FontHandle font,
                                                             const int pageWidth, const int spaceWidth,
-                                                            std::vector<uint16_t>& wordWidths,
-                                                            std::vector<bool>& continuesVec) {
+                                                            std::vector<uint16_t>& wordWidths) {
   // Calculate first line indent (only for left/justified text without extra paragraph spacing)
   const int firstLineIndent =
       blockStyle.textIndent > 0 && !extraParagraphSpacing &&
@@ -270,7 +313,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
     // Consume as many words as possible for current line, splitting when prefixes fit
     while (currentIndex < wordWidths.size()) {
       const bool isFirstWord = currentIndex == lineStart;
-      const int spacing = isFirstWord || continuesVec[currentIndex] ? 0 : spaceWidth;
+      const int spacing = isFirstWord || wordContinues(currentIndex) ? 0 : spaceWidth;
       const int candidateWidth = spacing + wordWidths[currentIndex];
 
       // Word fits on current line
@@ -284,8 +327,8 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
       const int availableWidth = effectivePageWidth - lineWidth - spacing;
       const bool allowFallbackBreaks = isFirstWord;  // Only for first word on line
 
-      if (availableWidth > 0 && hyphenateWordAtIndex(currentIndex, availableWidth, renderer, fontId, wordWidths,
-                                                     allowFallbackBreaks, &continuesVec)) {
+      if (availableWidth > 0 &&
+          hyphenateWordAtIndex(currentIndex, availableWidth, renderer, font, wordWidths, allowFallbackBreaks)) {
         // Prefix now fits; append it to this line and move to next line
         lineWidth += spacing + wordWidths[currentIndex];
         ++currentIndex;
@@ -302,7 +345,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
 
     // Don't break before a continuation word (e.g., orphaned "?" after "question").
     // Backtrack to the start of the continuation group so the whole group moves to the next line.
-    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && continuesVec[currentIndex]) {
+    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && wordContinues(currentIndex)) {
       --currentIndex;
     }
 
@@ -313,28 +356,235 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
   return lineBreakIndices;
 }
 
-// Splits words[wordIndex] into prefix (adding a hyphen only when needed) and remainder when a legal breakpoint fits the
-// available width.
+// Total-fit (Knuth–Plass) line breaking with hyphenation points as penalized breakpoints. Every feasible break keeps
+// the cheapest way to reach it, where a line costs its squared slack plus the hyphen penalties, so a paragraph is
+// broken for the lowest total cost rather than line by line.
+//
+// Breakpoints are visited in order. A break stays active until the line starting at it overflows, so only about a
+// line's worth of breaks is ever scanned per candidate (capped at MAX_ACTIVE_BREAKS) and the run is O(n·w). A word is
+// only hyphenated where it overflows a line from some active break, the places a split can help.
+std::vector<size_t> ParsedText::computeTotalFitLineBreaks(const GfxRenderer& renderer, const FontHandle font,
+                                                          const int pageWidth, const int spaceWidth,
+                                                          std::vector<uint16_t>& wordWidths) {
+  if (isEmpty()) {
+    return {};
+  }
+
+  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
+  const int firstLineIndent =
+      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
+              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
+          ? blockStyle.textIndent
+          : 0;
+
+  // Ensure any word that would overflow even as the first entry on a line is split using fallback hyphenation.
+  for (size_t i = 0; i < wordWidths.size(); ++i) {
+    const int effectiveWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
+    while (wordWidths[i] > effectiveWidth) {
+      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, font, wordWidths, /*allowFallbackBreaks=*/true)) {
+        break;
+      }
+    }
+  }
+
+  const size_t totalWordCount = size();
+  const int64_t hyphenPenalty = static_cast<int64_t>(HYPHEN_PENALTY_SPACES * spaceWidth) * HYPHEN_PENALTY_SPACES *
+                                spaceWidth;
+
+  // Gap before each word, and line positions as prefix sums so any run of words is measured in O(1)
+  auto gapBefore = [&](const size_t i) { return i == 0 || wordContinues(i) ? 0 : spaceWidth; };
+  std::vector<int32_t> positions(totalWordCount + 1, 0);
+  for (size_t i = 0; i < totalWordCount; i++) {
+    positions[i + 1] = positions[i] + gapBefore(i) + wordWidths[i];
+  }
+
+  struct Break {
+    int64_t cost;          // Cheapest total cost of the lines before this break
+    uint32_t previous;     // Break that starts the last of those lines
+    uint32_t word;         // First word of the line after this break
+    uint16_t offset;       // Byte offset into that word where the line resumes, 0 at a word boundary
+    uint16_t prefixWidth;  // Width of the split word's prefix, hyphen included, when offset > 0
+    uint16_t resumeWidth;  // Width of the rest of that word
+    bool hyphenated;       // The line before this break ends in a hyphen
+    bool insertedHyphen;   // That hyphen is drawn by the split rather than part of the text
+  };
+  std::vector<Break> breaks;
+  breaks.reserve(totalWordCount + 1);
+  breaks.push_back({0, 0, 0, 0, 0, 0, false, false});
+  std::vector<uint32_t> active = {0};
+
+  // Only the paragraph's own start is a break at word 0 without an offset
+  auto availableWidth = [&](const Break& b) {
+    return b.word == 0 && b.offset == 0 ? pageWidth - firstLineIndent : pageWidth;
+  };
+  // Room left on the line from break b once the words before word j and the gap before it are placed. A line through
+  // word j, or through a prefix of it, has this room minus that word's or prefix's width as its slack.
+  auto roomBefore = [&](const Break& b, const size_t j) {
+    int width = positions[j] - positions[b.word] - gapBefore(b.word) + gapBefore(j);
+    if (b.offset > 0) {
+      width += b.resumeWidth - wordWidths[b.word];
+    }
+    return availableWidth(b) - width;
+  };
+  // Room of every active break before the current word j, kept in step with active
+  std::vector<int32_t> rooms;
+  // Records the cheapest feasible line from an active break through the first `width` pixels of word j, forcing an
+  // overfull line from the newest active break when none fits
+  auto addBreak = [&](Break candidate, const size_t j, const int width, const bool isLast,
+                      const bool allowOverfull) {
+    int64_t bestCost = std::numeric_limits<int64_t>::max();
+    uint32_t bestPrevious = 0;
+    for (size_t k = 0; k < active.size(); k++) {
+      const int slack = rooms[k] - width;
+      if (slack < 0) {
+        continue;
+      }
+      const Break& from = breaks[active[k]];
+      if (candidate.offset > 0 && from.word == candidate.word) {
+        continue;  // A line cannot be a fragment of a single word
+      }
+      int64_t cost = from.cost + (isLast ? 0 : static_cast<int64_t>(slack) * slack);
+      if (candidate.hyphenated) {
+        cost += hyphenPenalty * (from.hyphenated ? 2 : 1);  // Stacked hyphens cost twice
+      }
+      if (cost < bestCost) {
+        bestCost = cost;
+        bestPrevious = active[k];
+      }
+    }
+    if (bestCost == std::numeric_limits<int64_t>::max()) {
+      if (!allowOverfull) {
+        return;
+      }
+      bestPrevious = active.back();
+      bestCost = breaks[bestPrevious].cost + MAX_COST;
+    }
+    candidate.cost = bestCost;
+    candidate.previous = bestPrevious;
+    breaks.push_back(candidate);
+    active.push_back(static_cast<uint32_t>(breaks.size() - 1));
+    rooms.push_back(roomBefore(candidate, j));
+  };
+
+  for (size_t j = 0; j < totalWordCount; j++) {
+    rooms.resize(active.size());
+    for (size_t k = 0; k < active.size(); k++) {
+      rooms[k] = roomBefore(breaks[active[k]], j);
+    }
+
+    // Breaks inside word j, tried only when it overflows a line that still has room before it
+    bool overflows = false;
+    int maxRoom = 0;  // Widest prefix any active line could end with
+    for (size_t k = 0; k < active.size(); k++) {
+      if (breaks[active[k]].word < j) {
+        maxRoom = std::max(maxRoom, rooms[k]);
+        overflows = overflows || (rooms[k] > 0 && rooms[k] < wordWidths[j]);
+      }
+    }
+    if (overflows) {
+      const uint32_t wordOffset = wordOffsets[j];
+      const uint16_t wordLength = wordLengths[j];
+      const auto style = wordStyle(j);
+      Hyphenator::BreakInfo breakInfos[Hyphenator::MAX_BREAKS];
+      const size_t breakCount =
+          Hyphenator::breakOffsets(wordData(j), wordLength, false, breakInfos, Hyphenator::MAX_BREAKS);
+      // Advances add up per code point, so each prefix is measured from the previous break instead of the word start,
+      // and the rest of the word is what its width leaves after the prefix
+      const int hyphenWidth = measureWord(renderer, font, wordOffset, 0, style, true);
+      size_t measured = 0;
+      int measuredWidth = 0;
+      for (size_t k = 0; k < breakCount; k++) {
+        const Hyphenator::BreakInfo& info = breakInfos[k];
+        const size_t offset = info.byteOffset;
+        if (offset == 0 || offset >= wordLength) {
+          continue;
+        }
+        if (offset > measured) {
+          measuredWidth += measureWord(renderer, font, wordOffset + measured, offset - measured, style, false);
+          measured = offset;
+        }
+        const int prefixWidth = measuredWidth + (info.requiresInsertedHyphen ? hyphenWidth : 0);
+        if (prefixWidth > maxRoom) {
+          break;  // Breaks come in order, so later prefixes are wider still
+        }
+        Break candidate{};
+        candidate.word = static_cast<uint32_t>(j);
+        candidate.offset = static_cast<uint16_t>(offset);
+        candidate.prefixWidth = static_cast<uint16_t>(prefixWidth);
+        candidate.hyphenated = true;
+        candidate.insertedHyphen = info.requiresInsertedHyphen;
+        candidate.resumeWidth = static_cast<uint16_t>(wordWidths[j] - measuredWidth);
+        addBreak(candidate, j, prefixWidth, /*isLast=*/false, /*allowOverfull=*/false);
+      }
+    }
+
+    // Break after word j, unless the next word attaches to it
+    if (j + 1 == totalWordCount || !wordContinues(j + 1)) {
+      Break candidate{};
+      candidate.word = static_cast<uint32_t>(j + 1);
+      addBreak(candidate, j, wordWidths[j], j + 1 == totalWordCount, /*allowOverfull=*/true);
+    }
+
+    // Retire breaks whose line already overflows; later lines from them only get longer. The newest one stays if
+    // nothing else is left, so an unbreakable group still gets an (overfull) line.
+    size_t kept = 0;
+    for (size_t k = 0; k < active.size(); k++) {
+      const uint32_t a = active[k];
+      const bool isNewest = k + 1 == active.size();
+      if (breaks[a].word > j || rooms[k] >= wordWidths[j] || (isNewest && kept == 0)) {
+        active[kept++] = a;
+      }
+    }
+    active.resize(kept);
+    if (active.size() > MAX_ACTIVE_BREAKS) {
+      active.erase(active.begin(), active.end() - MAX_ACTIVE_BREAKS);
+    }
+  }
+
+  // Walk back from the final break, then apply the chosen splits from the end so earlier word indices stay valid
+  std::vector<uint32_t> path;
+  for (uint32_t b = static_cast<uint32_t>(breaks.size() - 1); b != 0; b = breaks[b].previous) {
+    path.push_back(b);
+  }
+  for (const uint32_t b : path) {
+    const Break& split = breaks[b];
+    if (split.offset > 0) {
+      splitWord(split.word, split.offset, split.insertedHyphen, split.prefixWidth, split.resumeWidth, wordWidths);
+    }
+  }
+
+  std::vector<size_t> lineBreakIndices;
+  lineBreakIndices.reserve(path.size());
+  size_t inserted = 0;
+  for (auto it = path.rbegin(); it != path.rend(); ++it) {
+    const Break& lineEnd = breaks[*it];
+    if (lineEnd.offset > 0) {
+      inserted++;  // The remainder of the split word starts the next line
+    }
+    lineBreakIndices.push_back(lineEnd.word + inserted);
+  }
+  return lineBreakIndices;
+}
+
+// Splits the word at wordIndex into prefix (adding a hyphen only when needed) and remainder when a legal breakpoint
+// fits the available width. The split happens in place: both halves keep their bytes in the arena.
 bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availableWidth, const GfxRenderer& renderer,
-                                      const int fontId, std::vector<uint16_t>& wordWidths,
-                                      const bool allowFallbackBreaks, std::vector<bool>* continuesVec) {
+                                      const FontHandle font, std::vector<uint16_t>& wordWidths,
+                                      const bool allowFallbackBreaks) {
   // Guard against invalid indices or zero available width before attempting to split.
-  if (availableWidth <= 0 || wordIndex >= words.size()) {
+  if (availableWidth <= 0 || wordIndex >= size()) {
     return false;
   }
 
-  // Get iterators to target word and style.
-  auto wordIt = words.begin();
-  auto styleIt = wordStyles.begin();
-  std::advance(wordIt, wordIndex);
-  std::advance(styleIt, wordIndex);
-
-  const std::string& word = *wordIt;
-  const auto style = *styleIt;
+  const uint32_t wordOffset = wordOffsets[wordIndex];
+  const uint16_t wordLength = wordLengths[wordIndex];
+  const auto style = wordStyle(wordIndex);
 
   // Collect candidate breakpoints (byte offsets and hyphen requirements).
-  auto breakInfos = Hyphenator::breakOffsets(word, allowFallbackBreaks);
-  if (breakInfos.empty()) {
+  Hyphenator::BreakInfo breakInfos[Hyphenator::MAX_BREAKS];
+  const size_t breakCount = Hyphenator::breakOffsets(wordData(wordIndex), wordLength, allowFallbackBreaks, breakInfos,
+                                                     Hyphenator::MAX_BREAKS);
+  if (breakCount == 0) {
     return false;
   }
 
@@ -343,14 +593,15 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   bool chosenNeedsHyphen = true;
 
   // Iterate over each legal breakpoint and retain the widest prefix that still fits.
-  for (const auto& info : breakInfos) {
+  for (size_t k = 0; k < breakCount; k++) {
+    const Hyphenator::BreakInfo& info = breakInfos[k];
     const size_t offset = info.byteOffset;
-    if (offset == 0 || offset >= word.size()) {
+    if (offset == 0 || offset >= wordLength) {
       continue;
     }
 
     const bool needsHyphen = info.requiresInsertedHyphen;
-    const int prefixWidth = measureWordWidth(renderer, fontId, word.substr(0, offset), style, needsHyphen);
+    const int prefixWidth = measureWord(renderer, font, wordOffset, offset, style, needsHyphen);
     if (prefixWidth > availableWidth || prefixWidth <= chosenWidth) {
       continue;  // Skip if too wide or not an improvement
     }
@@ -365,18 +616,25 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
     return false;
   }
 
-  // Split the word at the selected breakpoint and append a hyphen if required.
-  std::string remainder = word.substr(chosenOffset);
-  wordIt->resize(chosenOffset);
-  if (chosenNeedsHyphen) {
-    wordIt->push_back('-');
-  }
+  const uint16_t remainderWidth = measureWord(renderer, font, wordOffset + chosenOffset, wordLength - chosenOffset,
+                                              style, (wordFlags[wordIndex] & WORD_HYPHENATED) != 0);
+  splitWord(wordIndex, chosenOffset, chosenNeedsHyphen, static_cast<uint16_t>(chosenWidth), remainderWidth,
+            wordWidths);
+  return true;
+}
 
-  // Insert the remainder word (with matching style and continuation flag) directly after the prefix.
-  auto insertWordIt = std::next(wordIt);
-  auto insertStyleIt = std::next(styleIt);
-  words.insert(insertWordIt, remainder);
-  wordStyles.insert(insertStyleIt, style);
+// Splits the word at wordIndex at a byte offset into a prefix and a remainder inserted directly after it. Both keep
+// their bytes in the arena: the inserted hyphen is a flag on the prefix, and a hyphen owed to the end of the word
+// moves to the remainder.
+void ParsedText::splitWord(const size_t wordIndex, const size_t offset, const bool needsHyphen,
+                           const uint16_t prefixWidth, const uint16_t remainderWidth,
+                           std::vector<uint16_t>& wordWidths) {
+  const uint8_t flags = wordFlags[wordIndex];
+  const uint16_t wordLength = wordLengths[wordIndex];
+  wordLengths[wordIndex] = static_cast<uint16_t>(offset);
+  wordFlags[wordIndex] = static_cast<uint8_t>((flags & ~WORD_HYPHENATED) | (needsHyphen ? WORD_HYPHENATED : 0));
+  wordOffsets.insert(wordOffsets.begin() + wordIndex + 1, static_cast<uint32_t>(wordOffsets[wordIndex] + offset));
+  wordLengths.insert(wordLengths.begin() + wordIndex + 1, static_cast<uint16_t>(wordLength - offset));
 
   // Continuation flag handling after splitting a word into prefix + remainder.
   //
@@ -397,28 +655,15 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   //
   // This lets the backtracking loop keep the entire prefix group ("200 Quadrat-") on one
   // line, while "kilometer" moves to the next line.
-  auto continuesIt = wordContinues.begin();
-  std::advance(continuesIt, wordIndex);
-  // *continuesIt is intentionally left unchanged — the prefix keeps its original attachment.
-  const auto insertContinuesIt = std::next(continuesIt);
-  wordContinues.insert(insertContinuesIt, false);
-
-  // Keep the indexed vector in sync if provided.
-  if (continuesVec) {
-    // (*continuesVec)[wordIndex] stays unchanged — prefix keeps its attachment.
-    continuesVec->insert(continuesVec->begin() + wordIndex + 1, false);
-  }
+  wordFlags.insert(wordFlags.begin() + wordIndex + 1, static_cast<uint8_t>(flags & ~WORD_CONTINUES));
 
   // Update cached widths to reflect the new prefix/remainder pairing.
-  wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
-  const uint16_t remainderWidth = measureWordWidth(renderer, fontId, remainder, style);
+  wordWidths[wordIndex] = prefixWidth;
   wordWidths.insert(wordWidths.begin() + wordIndex + 1, remainderWidth);
-  return true;
 }
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
-                             const std::vector<uint16_t>& wordWidths, const std::vector<bool>& continuesVec,
-                             const std::vector<size_t>& lineBreakIndices,
+                             const std::vector<uint16_t>& wordWidths, const std::vector<size_t>& lineBreakIndices,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
@@ -440,7 +685,7 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     lineWordWidthSum += wordWidths[lastBreakAt + wordIdx];
     // Count gaps: each word after the first creates a gap, unless it's a continuation
-    if (wordIdx > 0 && !continuesVec[lastBreakAt + wordIdx]) {
+    if (wordIdx > 0 && !wordContinues(lastBreakAt + wordIdx)) {
       actualGapCount++;
     }
   }
@@ -465,45 +710,28 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
     xpos = (spareSpace - static_cast<int>(actualGapCount) * spaceWidth) / 2;
   }
 
-  // Pre-calculate X positions for words
-  // Continuation words attach to the previous word with no space before them
-  std::list<uint16_t> lineXPos;
+  // Copy the line's words out of the arena with their x positions; layoutAndExtractLines drops them once every line
+  // is extracted. Sanitizing only ever removes bytes, apart from the break hyphen.
+  size_t lineTextBytes = 0;
+  for (size_t wordIdx = lastBreakAt; wordIdx < lineBreak; wordIdx++) {
+    lineTextBytes += wordLengths[wordIdx] + ((wordFlags[wordIdx] & WORD_HYPHENATED) != 0 ? 1 : 0);
+  }
+  auto line = std::make_shared<TextBlock>(static_cast<uint16_t>(lineWordCount), lineTextBytes, blockStyle);
 
+  // Continuation words attach to the previous word with no space before them
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
-    const uint16_t currentWordWidth = wordWidths[lastBreakAt + wordIdx];
+    const size_t index = lastBreakAt + wordIdx;
+    const uint16_t currentWordWidth = wordWidths[index];
 
-    lineXPos.push_back(xpos);
+    wordScratch.clear();
+    appendSanitizedWord(wordScratch, wordData(index), wordLengths[index], (wordFlags[index] & WORD_HYPHENATED) != 0);
+    line->addWord(wordScratch.data(), wordScratch.size(), xpos, wordStyle(index));
 
     // Add spacing after this word, unless the next word is a continuation
-    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && continuesVec[lastBreakAt + wordIdx + 1];
+    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && wordContinues(index + 1);
 
     xpos += currentWordWidth + (nextIsContinuation ? 0 : spacing);
   }
 
-  // Iterators always start at the beginning as we are moving content with splice below
-  auto wordEndIt = words.begin();
-  auto wordStyleEndIt = wordStyles.begin();
-  auto wordContinuesEndIt = wordContinues.begin();
-  std::advance(wordEndIt, lineWordCount);
-  std::advance(wordStyleEndIt, lineWordCount);
-  std::advance(wordContinuesEndIt, lineWordCount);
-
-  // *** CRITICAL STEP: CONSUME DATA USING SPLICE ***
-  std::list<std::string> lineWords;
-  lineWords.splice(lineWords.begin(), words, words.begin(), wordEndIt);
-  std::list<EpdFontFamily::Style> lineWordStyles;
-  lineWordStyles.splice(lineWordStyles.begin(), wordStyles, wordStyles.begin(), wordStyleEndIt);
-
-  // Consume continues flags (not passed to TextBlock, but must be consumed to stay in sync)
-  std::list<bool> lineContinues;
-  lineContinues.splice(lineContinues.begin(), wordContinues, wordContinues.begin(), wordContinuesEndIt);
-
-  for (auto& word : lineWords) {
-    if (containsSoftHyphen(word)) {
-      stripSoftHyphensInPlace(word);
-    }
-  }
-
-  processLine(
-      std::make_shared<TextBlock>(std::move(lineWords), std::move(lineXPos), std::move(lineWordStyles), blockStyle));
+  processLine(std::move(line));
 }
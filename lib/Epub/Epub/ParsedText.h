@@ -2,8 +2,8 @@
 
 #include <EpdFontFamily.h>
 
+#include <cstdint>
 #include <functional>
-#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -11,29 +11,58 @@
 #include "blocks/BlockStyle.h"
 #include "blocks/TextBlock.h"
 
+class FontHandle;
 class GfxRenderer;
 
 class ParsedText {
-  std::list<std::string> words;
-  std::list<EpdFontFamily::Style> wordStyles;
-  std::list<bool> wordContinues;  // true = word attaches to previous (no space before it)
+ public:
+  // How lines are broken when hyphenation is enabled. Greedy fills each line in turn and is kept as the reference for
+  // the line break benchmark; TotalFit balances the whole paragraph.
+  enum class HyphenatedBreaking : uint8_t { TotalFit, Greedy };
+
+ private:
+  // Words are kept as a structure of arrays over one arena of text, so buffering a long paragraph costs a few
+  // amortized allocations rather than several heap nodes per word. Each word's bytes are followed by a NUL unless a
+  // hyphenation split left its remainder there. Words appear in the arena in order, so consumed lines are dropped from
+  // the front.
+  std::string text;
+  std::vector<uint32_t> wordOffsets;
+  std::vector<uint16_t> wordLengths;
+  std::vector<uint8_t> wordFlags;  // EpdFontFamily::Style in the low bits plus WORD_* flags
+  std::string wordScratch;         // Reused for words rewritten to measure or copy them
   BlockStyle blockStyle;
   bool extraParagraphSpacing;
   bool hyphenationEnabled;
+  HyphenatedBreaking hyphenatedBreaking = HyphenatedBreaking::TotalFit;
+
+  static constexpr uint8_t WORD_STYLE_MASK = 0x07;
+  static constexpr uint8_t WORD_CONTINUES = 0x08;   // Word attaches to previous (no space before it)
+  static constexpr uint8_t WORD_HYPHENATED = 0x10;  // Split prefix that is drawn with an appended hyphen
+
+  const char* wordData(const size_t index) const { return text.data() + wordOffsets[index]; }
+  EpdFontFamily::Style wordStyle(const size_t index) const {
+    return static_cast<EpdFontFamily::Style>(wordFlags[index] & WORD_STYLE_MASK);
+  }
+  bool wordContinues(const size_t index) const { return (wordFlags[index] & WORD_CONTINUES) != 0; }
 
   void applyParagraphIndent();
-  std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth, int spaceWidth,
-                                        std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec);
-  std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth,
-                                                  int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec);
-  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, int fontId,
-                            std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks,
-                            std::vector<bool>* continuesVec = nullptr);
+  uint16_t measureWord(const GfxRenderer& renderer, FontHandle font, size_t offset, size_t length,
+                       EpdFontFamily::Style style, bool appendHyphen);
+  std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, FontHandle font, int pageWidth, int spaceWidth,
+                                        std::vector<uint16_t>& wordWidths);
+  std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, FontHandle font, int pageWidth,
+                                                  int spaceWidth, std::vector<uint16_t>& wordWidths);
+  std::vector<size_t> computeTotalFitLineBreaks(const GfxRenderer& renderer, FontHandle font, int pageWidth,
+                                                int spaceWidth, std::vector<uint16_t>& wordWidths);
+  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, FontHandle font,
+                            std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks);
+  void splitWord(size_t wordIndex, size_t offset, bool needsHyphen, uint16_t prefixWidth, uint16_t remainderWidth,
+                 std::vector<uint16_t>& wordWidths);
   void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
-                   const std::vector<bool>& continuesVec, const std::vector<size_t>& lineBreakIndices,
+                   const std::vector<size_t>& lineBreakIndices,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
-  std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
+  void consumeWords(size_t count);
+  std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, FontHandle font);
 
  public:
   explicit ParsedText(const bool extraParagraphSpacing, const bool hyphenationEnabled = false,
@@ -41,12 +70,13 @@ class ParsedText {
       : blockStyle(blockStyle), extraParagraphSpacing(extraParagraphSpacing), hyphenationEnabled(hyphenationEnabled) {}
   ~ParsedText() = default;
 
-  void addWord(std::string word, EpdFontFamily::Style fontStyle, bool underline = false, bool attachToPrevious = false);
+  void addWord(const char* word, EpdFontFamily::Style fontStyle, bool underline = false, bool attachToPrevious = false);
   void setBlockStyle(const BlockStyle& blockStyle) { this->blockStyle = blockStyle; }
+  void setHyphenatedBreaking(const HyphenatedBreaking breaking) { hyphenatedBreaking = breaking; }
   BlockStyle& getBlockStyle() { return blockStyle; }
-  size_t size() const { return words.size(); }
-  bool isEmpty() const { return words.empty(); }
-  void layoutAndExtractLines(const GfxRenderer& renderer, int fontId, uint16_t viewportWidth,
+  size_t size() const { return wordOffsets.size(); }
+  bool isEmpty() const { return wordOffsets.empty(); }
+  void layoutAndExtractLines(const GfxRenderer& renderer, FontHandle font, uint16_t viewportWidth,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
                              bool includeLastLine = true);
 };
\ No newline at end of file
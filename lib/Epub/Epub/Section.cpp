@@ -6,14 +6,20 @@
 
 #include "Epub/css/CssParser.h"
 #include "Page.h"
+#include "Paginator.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 13;
+constexpr uint8_t SECTION_FILE_VERSION = 14;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint32_t);
+// The line stream keys on everything but the viewport height and ends its header with the range of heights it can be
+// paginated for. The range is empty until the stream is complete.
+constexpr uint32_t LINE_STREAM_HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) +
+                                             sizeof(uint8_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
+                                             sizeof(uint16_t) + sizeof(uint16_t);
 }  // namespace
 
 uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
@@ -59,6 +65,42 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
   serialization::writePod(file, static_cast<uint32_t>(0));  // Placeholder for LUT offset
 }
 
+void Section::writeLineStreamHeader(FsFile& lineStream, const int fontId, const float lineCompression,
+                                    const bool extraParagraphSpacing, const uint8_t paragraphAlignment,
+                                    const uint16_t viewportWidth, const bool hyphenationEnabled,
+                                    const bool embeddedStyle) const {
+  serialization::writePod(lineStream, SECTION_FILE_VERSION);
+  serialization::writePod(lineStream, fontId);
+  serialization::writePod(lineStream, lineCompression);
+  serialization::writePod(lineStream, extraParagraphSpacing);
+  serialization::writePod(lineStream, paragraphAlignment);
+  serialization::writePod(lineStream, viewportWidth);
+  serialization::writePod(lineStream, hyphenationEnabled);
+  serialization::writePod(lineStream, embeddedStyle);
+  serialization::writePod(lineStream, static_cast<uint16_t>(UINT16_MAX));  // Placeholder for min viewport height
+  serialization::writePod(lineStream, static_cast<uint16_t>(0));           // Placeholder for max viewport height
+}
+
+bool Section::writeLut(const std::vector<uint32_t>& lut) {
+  const uint32_t lutOffset = file.position();
+  for (const uint32_t& pos : lut) {
+    if (pos == 0) {
+      LOG_ERR("SCT", "Failed to write LUT due to invalid page positions");
+      file.close();
+      Storage.remove(filePath.c_str());
+      return false;
+    }
+    serialization::writePod(file, pos);
+  }
+
+  // Go back and write LUT offset
+  file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
+  serialization::writePod(file, pageCount);
+  serialization::writePod(file, lutOffset);
+  file.close();
+  return true;
+}
+
 bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                               const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
@@ -98,8 +140,9 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
         viewportWidth != fileViewportWidth || viewportHeight != fileViewportHeight ||
         hyphenationEnabled != fileHyphenationEnabled || embeddedStyle != fileEmbeddedStyle) {
       file.close();
-      LOG_ERR("SCT", "Deserialization failed: Parameters do not match");
-      clearCache();
+      LOG_DBG("SCT", "Deserialization failed: Parameters do not match");
+      // The line stream may still match, so only the pages are dropped
+      Storage.remove(filePath.c_str());
       return false;
     }
   }
@@ -112,12 +155,13 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
 
 // Your updated class method (assuming you are using the 'SD' object, which is a wrapper for a specific filesystem)
 bool Section::clearCache() const {
-  if (!Storage.exists(filePath.c_str())) {
+  if (!Storage.exists(filePath.c_str()) && !Storage.exists(lineStreamPath.c_str())) {
     LOG_DBG("SCT", "Cache does not exist, no action needed");
     return true;
   }
 
-  if (!Storage.remove(filePath.c_str())) {
+  if ((Storage.exists(filePath.c_str()) && !Storage.remove(filePath.c_str())) ||
+      (Storage.exists(lineStreamPath.c_str()) && !Storage.remove(lineStreamPath.c_str()))) {
     LOG_ERR("SCT", "Failed to clear cache");
     return false;
   }
@@ -126,6 +170,85 @@ bool Section::clearCache() const {
   return true;
 }
 
+bool Section::repaginateFromLineStream(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                                       const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                                       const uint16_t viewportHeight, const bool hyphenationEnabled,
+                                       const bool embeddedStyle) {
+  if (!Storage.exists(lineStreamPath.c_str())) {
+    return false;
+  }
+  FsFile lineStream;
+  if (!Storage.openFileForRead("SCT", lineStreamPath, lineStream)) {
+    return false;
+  }
+
+  // Match parameters
+  {
+    uint8_t version;
+    int fileFontId;
+    float fileLineCompression;
+    bool fileExtraParagraphSpacing;
+    uint8_t fileParagraphAlignment;
+    uint16_t fileViewportWidth;
+    bool fileHyphenationEnabled;
+    bool fileEmbeddedStyle;
+    uint16_t minViewportHeight, maxViewportHeight;
+    serialization::readPod(lineStream, version);
+    serialization::readPod(lineStream, fileFontId);
+    serialization::readPod(lineStream, fileLineCompression);
+    serialization::readPod(lineStream, fileExtraParagraphSpacing);
+    serialization::readPod(lineStream, fileParagraphAlignment);
+    serialization::readPod(lineStream, fileViewportWidth);
+    serialization::readPod(lineStream, fileHyphenationEnabled);
+    serialization::readPod(lineStream, fileEmbeddedStyle);
+    serialization::readPod(lineStream, minViewportHeight);
+    serialization::readPod(lineStream, maxViewportHeight);
+
+    if (lineStream.size() < LINE_STREAM_HEADER_SIZE || version != SECTION_FILE_VERSION || fontId != fileFontId ||
+        lineCompression != fileLineCompression || extraParagraphSpacing != fileExtraParagraphSpacing ||
+        paragraphAlignment != fileParagraphAlignment || viewportWidth != fileViewportWidth ||
+        hyphenationEnabled != fileHyphenationEnabled || embeddedStyle != fileEmbeddedStyle) {
+      lineStream.close();
+      LOG_DBG("SCT", "Line stream does not match, removing it");
+      Storage.remove(lineStreamPath.c_str());
+      return false;
+    }
+    if (viewportHeight < minViewportHeight || viewportHeight > maxViewportHeight) {
+      lineStream.close();
+      LOG_DBG("SCT", "Line stream cannot be paginated for height %u", viewportHeight);
+      return false;
+    }
+  }
+
+  const uint32_t start = millis();
+  if (!Storage.openFileForWrite("SCT", filePath, file)) {
+    lineStream.close();
+    return false;
+  }
+  pageCount = 0;
+  writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                         viewportHeight, hyphenationEnabled, embeddedStyle);
+  std::vector<uint32_t> lut = {};
+
+  Paginator paginator(viewportHeight, [this, &lut](std::unique_ptr<Page> page) {
+    lut.emplace_back(this->onPageComplete(std::move(page)));
+  });
+  const bool replayed = paginator.replay(lineStream);
+  lineStream.close();
+  if (!replayed) {
+    LOG_ERR("SCT", "Failed to repaginate from line stream");
+    file.close();
+    clearCache();
+    return false;
+  }
+
+  if (!writeLut(lut)) {
+    return false;
+  }
+  LOG_DBG("SCT", "Repaginated %d pages from line stream in %lu ms", pageCount, millis() - start);
+  return true;
+}
+
 bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
@@ -139,6 +262,13 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     Storage.mkdir(sectionsDir.c_str());
   }
 
+  // Settings that only change the viewport height keep the line layout, which is much cheaper to paginate again
+  if (repaginateFromLineStream(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                               viewportHeight, hyphenationEnabled, embeddedStyle)) {
+    return true;
+  }
+  pageCount = 0;
+
   // Retry logic for SD card timing issues
   bool success = false;
   uint32_t fileSize = 0;
@@ -182,6 +312,18 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
                          viewportHeight, hyphenationEnabled, embeddedStyle);
   std::vector<uint32_t> lut = {};
 
+  Paginator paginator(viewportHeight, [this, &lut](std::unique_ptr<Page> page) {
+    lut.emplace_back(this->onPageComplete(std::move(page)));
+  });
+  // The line stream is an optimization: the section is still built if it cannot be written
+  FsFile lineStream;
+  const bool recording = Storage.openFileForWrite("SCT", lineStreamPath, lineStream);
+  if (recording) {
+    writeLineStreamHeader(lineStream, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment,
+                          viewportWidth, hyphenationEnabled, embeddedStyle);
+    paginator.record(&lineStream);
+  }
+
   // Derive the content base directory and image cache path prefix for the parser
   size_t lastSlash = localPath.find_last_of('/');
   std::string contentBase = (lastSlash != std::string::npos) ? localPath.substr(0, lastSlash + 1) : "";
@@ -199,9 +341,7 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
 
   ChapterHtmlSlimParser visitor(
       epub, tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
-      viewportHeight, hyphenationEnabled,
-      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      embeddedStyle, contentBase, imageBasePath, popupFn, cssParser);
+      viewportHeight, hyphenationEnabled, paginator, embeddedStyle, contentBase, imageBasePath, popupFn, cssParser);
   Hyphenator::setPreferredLanguage(epub->getLanguage());
   success = visitor.parseAndBuildPages();
 
@@ -209,40 +349,34 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   if (!success) {
     LOG_ERR("SCT", "Failed to parse XML and build pages");
     file.close();
-    Storage.remove(filePath.c_str());
+    if (recording) {
+      lineStream.close();
+    }
+    clearCache();
     if (cssParser) {
       cssParser->clear();
     }
     return false;
   }
 
-  const uint32_t lutOffset = file.position();
-  bool hasFailedLutRecords = false;
-  // Write LUT
-  for (const uint32_t& pos : lut) {
-    if (pos == 0) {
-      hasFailedLutRecords = true;
-      break;
+  if (recording) {
+    // Open the stream up for the heights it can be paginated for
+    if (paginator.recordingFailed()) {
+      LOG_ERR("SCT", "Failed to record line stream");
+      lineStream.close();
+      Storage.remove(lineStreamPath.c_str());
+    } else {
+      lineStream.seek(LINE_STREAM_HEADER_SIZE - 2 * sizeof(uint16_t));
+      serialization::writePod(lineStream, paginator.getMinViewportHeight());
+      serialization::writePod(lineStream, paginator.getMaxViewportHeight());
+      lineStream.close();
     }
-    serialization::writePod(file, pos);
   }
 
-  if (hasFailedLutRecords) {
-    LOG_ERR("SCT", "Failed to write LUT due to invalid page positions");
-    file.close();
-    Storage.remove(filePath.c_str());
-    return false;
-  }
-
-  // Go back and write LUT offset
-  file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
-  serialization::writePod(file, pageCount);
-  serialization::writePod(file, lutOffset);
-  file.close();
   if (cssParser) {
     cssParser->clear();
   }
-  return true;
+  return writeLut(lut);
 }
 
 std::unique_ptr<Page> Section::loadPageFromSectionFile() {
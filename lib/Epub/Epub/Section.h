@@ -1,6 +1,7 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "Epub.h"
 
@@ -12,12 +13,21 @@ class Section {
   const int spineIndex;
   GfxRenderer& renderer;
   std::string filePath;
+  // Line layout of the chapter, which outlives height-only setting changes, see Paginator
+  std::string lineStreamPath;
   FsFile file;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                               bool embeddedStyle);
   uint32_t onPageComplete(std::unique_ptr<Page> page);
+  bool writeLut(const std::vector<uint32_t>& lut);
+  void writeLineStreamHeader(FsFile& lineStream, int fontId, float lineCompression, bool extraParagraphSpacing,
+                             uint8_t paragraphAlignment, uint16_t viewportWidth, bool hyphenationEnabled,
+                             bool embeddedStyle) const;
+  bool repaginateFromLineStream(int fontId, float lineCompression, bool extraParagraphSpacing,
+                                uint8_t paragraphAlignment, uint16_t viewportWidth, uint16_t viewportHeight,
+                                bool hyphenationEnabled, bool embeddedStyle);
 
  public:
   uint16_t pageCount = 0;
@@ -27,7 +37,8 @@ class Section {
       : epub(epub),
         spineIndex(spineIndex),
         renderer(renderer),
-        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
+        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin"),
+        lineStreamPath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".lines") {}
   ~Section() = default;
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
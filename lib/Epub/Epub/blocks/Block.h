@@ -1,5 +1,6 @@
 #pragma once
 
+class FontHandle;
 class GfxRenderer;
 
 typedef enum { TEXT_BLOCK, IMAGE_BLOCK } BlockType;
@@ -5,7 +5,6 @@
 #include <SDCardManager.h>
 #include <Serialization.h>
 
-#include "../converters/DitherUtils.h"
 #include "../converters/ImageDecoderFactory.h"
 
 // Cache file format:
@@ -75,14 +74,7 @@ bool renderFromCache(GfxRenderer& renderer, const std::string& cachePath, int x,
       return false;
     }
 
-    int destY = y + row;
-    for (int col = 0; col < cachedWidth; col++) {
-      int byteIdx = col / 4;
-      int bitShift = 6 - (col % 4) * 2;  // MSB first within byte
-      uint8_t pixelValue = (rowBuffer[byteIdx] >> bitShift) & 0x03;
-
-      drawPixelWithRenderMode(renderer, x + col, destY, pixelValue);
-    }
+    renderer.drawPixelRow(rowBuffer, x, y + row, cachedWidth);
   }
 
   free(rowBuffer);
@@ -4,62 +4,99 @@
 #include <Logging.h>
 #include <Serialization.h>
 
-void TextBlock::render(const GfxRenderer& renderer, const int fontId, const int x, const int y) const {
-  // Validate iterator bounds before rendering
-  if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
-    LOG_ERR("TXB", "Render skipped: size mismatch (words=%u, xpos=%u, styles=%u)\n", (uint32_t)words.size(),
-            (uint32_t)wordXpos.size(), (uint32_t)wordStyles.size());
+#include <cstring>
+#include <new>
+
+TextBlock::TextBlock(const uint16_t wordCount, const size_t textBytes, const BlockStyle& blockStyle)
+    : blockStyle(blockStyle) {
+  const size_t capacity = textBytes + wordCount;
+  if (capacity > UINT16_MAX || !allocate(wordCount, static_cast<uint16_t>(capacity))) {
+    LOG_ERR("TXB", "Failed to allocate line of %u words, %u bytes", wordCount, static_cast<uint32_t>(capacity));
+  }
+}
+
+bool TextBlock::allocate(const uint16_t words, const uint16_t textBytes) {
+  // xpos and text offsets are uint16_t; styles and text are packed bytes after them
+  const size_t units = 2 * static_cast<size_t>(words) + (static_cast<size_t>(words) + textBytes + 1) / 2;
+  data.reset(new (std::nothrow) uint16_t[units]);
+  if (!data) {
+    wordCount = 0;
+    textCapacity = 0;
+    return false;
+  }
+  wordCount = words;
+  textCapacity = textBytes;
+  return true;
+}
+
+void TextBlock::addWord(const char* word, const size_t length, const uint16_t xpos, const EpdFontFamily::Style style) {
+  if (wordsAdded >= wordCount || textSize + length + 1 > textCapacity) {
+    LOG_ERR("TXB", "Word does not fit line (words=%u/%u, text=%u/%u)", wordsAdded, wordCount,
+            static_cast<uint32_t>(textSize + length + 1), textCapacity);
+    return;
+  }
+
+  wordXpos()[wordsAdded] = xpos;
+  textOffsets()[wordsAdded] = textSize;
+  wordStyles()[wordsAdded] = style;
+  memcpy(text() + textSize, word, length);
+  text()[textSize + length] = '\0';
+  textSize += static_cast<uint16_t>(length + 1);
+  wordsAdded++;
+}
+
+void TextBlock::render(const GfxRenderer& renderer, const FontHandle font, const int x, const int y) const {
+  // Validate that the line was filled completely before rendering
+  if (wordsAdded != wordCount) {
+    LOG_ERR("TXB", "Render skipped: incomplete line (words=%u/%u)\n", wordsAdded, wordCount);
     return;
   }
 
-  auto wordIt = words.begin();
-  auto wordStylesIt = wordStyles.begin();
-  auto wordXposIt = wordXpos.begin();
-  for (size_t i = 0; i < words.size(); i++) {
-    const int wordX = *wordXposIt + x;
-    const EpdFontFamily::Style currentStyle = *wordStylesIt;
-    renderer.drawText(fontId, wordX, y, wordIt->c_str(), true, currentStyle);
+  const uint16_t* xposArray = wordXpos();
+  const uint16_t* offsets = textOffsets();
+  const uint8_t* styles = wordStyles();
+  const char* words = text();
+  for (size_t i = 0; i < wordCount; i++) {
+    const int wordX = xposArray[i] + x;
+    const auto currentStyle = static_cast<EpdFontFamily::Style>(styles[i]);
+    const char* w = words + offsets[i];
+    renderer.drawText(font, wordX, y, w, true, currentStyle);
 
     if ((currentStyle & EpdFontFamily::UNDERLINE) != 0) {
-      const std::string& w = *wordIt;
-      const int fullWordWidth = renderer.getTextWidth(fontId, w.c_str(), currentStyle);
+      const int fullWordWidth = renderer.getTextWidth(font, w, currentStyle);
       // y is the top of the text line; add ascender to reach baseline, then offset 2px below
-      const int underlineY = y + renderer.getFontAscenderSize(fontId) + 2;
+      const int underlineY = y + renderer.getFontAscenderSize(font) + 2;
 
       int startX = wordX;
       int underlineWidth = fullWordWidth;
 
       // if word starts with em-space ("\xe2\x80\x83"), account for the additional indent before drawing the line
-      if (w.size() >= 3 && static_cast<uint8_t>(w[0]) == 0xE2 && static_cast<uint8_t>(w[1]) == 0x80 &&
+      if (static_cast<uint8_t>(w[0]) == 0xE2 && static_cast<uint8_t>(w[1]) == 0x80 &&
           static_cast<uint8_t>(w[2]) == 0x83) {
-        const char* visiblePtr = w.c_str() + 3;
-        const int prefixWidth = renderer.getTextAdvanceX(fontId, "\xe2\x80\x83", currentStyle);
-        const int visibleWidth = renderer.getTextWidth(fontId, visiblePtr, currentStyle);
+        const char* visiblePtr = w + 3;
+        const int prefixWidth = renderer.getTextAdvanceX(font, "\xe2\x80\x83", currentStyle);
+        const int visibleWidth = renderer.getTextWidth(font, visiblePtr, currentStyle);
         startX = wordX + prefixWidth;
         underlineWidth = visibleWidth;
       }
 
       renderer.drawLine(startX, underlineY, startX + underlineWidth, underlineY, true);
     }
-
-    std::advance(wordIt, 1);
-    std::advance(wordStylesIt, 1);
-    std::advance(wordXposIt, 1);
   }
 }
 
 bool TextBlock::serialize(FsFile& file) const {
-  if (words.size() != wordXpos.size() || words.size() != wordStyles.size()) {
-    LOG_ERR("TXB", "Serialization failed: size mismatch (words=%u, xpos=%u, styles=%u)\n", words.size(),
-            wordXpos.size(), wordStyles.size());
+  if (wordsAdded != wordCount) {
+    LOG_ERR("TXB", "Serialization failed: incomplete line (words=%u/%u)\n", wordsAdded, wordCount);
     return false;
   }
 
   // Word data
-  serialization::writePod(file, static_cast<uint16_t>(words.size()));
-  for (const auto& w : words) serialization::writeString(file, w);
-  for (auto x : wordXpos) serialization::writePod(file, x);
-  for (auto s : wordStyles) serialization::writePod(file, s);
+  serialization::writePod(file, wordCount);
+  serialization::writePod(file, textSize);
+  if (wordCount > 0) {
+    file.write(reinterpret_cast<const uint8_t*>(data.get()), usedBytes());
+  }
 
   // Style (alignment + margins/padding/indent)
   serialization::writePod(file, blockStyle.alignment);
@@ -80,27 +117,46 @@ bool TextBlock::serialize(FsFile& file) const {
 
 std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   uint16_t wc;
-  std::list<std::string> words;
-  std::list<uint16_t> wordXpos;
-  std::list<EpdFontFamily::Style> wordStyles;
-  BlockStyle blockStyle;
+  uint16_t textBytes;
+  std::unique_ptr<TextBlock> textBlock(new TextBlock());
+  BlockStyle& blockStyle = textBlock->blockStyle;
 
-  // Word count
+  // Word count and text size
   serialization::readPod(file, wc);
+  serialization::readPod(file, textBytes);
 
-  // Sanity check: prevent allocation of unreasonably large lists (max 10000 words per block)
+  // Sanity check: prevent allocation of unreasonably large lines (max 10000 words per block)
   if (wc > 10000) {
     LOG_ERR("TXB", "Deserialization failed: word count %u exceeds maximum", wc);
     return nullptr;
   }
 
   // Word data
-  words.resize(wc);
-  wordXpos.resize(wc);
-  wordStyles.resize(wc);
-  for (auto& w : words) serialization::readString(file, w);
-  for (auto& x : wordXpos) serialization::readPod(file, x);
-  for (auto& s : wordStyles) serialization::readPod(file, s);
+  if (!textBlock->allocate(wc, textBytes)) {
+    LOG_ERR("TXB", "Deserialization failed: cannot allocate %u words, %u bytes", wc, textBytes);
+    return nullptr;
+  }
+  textBlock->textSize = textBytes;
+  textBlock->wordsAdded = wc;
+  if (wc > 0) {
+    const size_t bytes = textBlock->usedBytes();
+    if (file.read(reinterpret_cast<uint8_t*>(textBlock->data.get()), bytes) != static_cast<int>(bytes)) {
+      LOG_ERR("TXB", "Deserialization failed: short read of %u bytes", static_cast<uint32_t>(bytes));
+      return nullptr;
+    }
+    // Every word must start inside the text, which must end with a terminator
+    if (textBytes == 0 || textBlock->text()[textBytes - 1] != '\0') {
+      LOG_ERR("TXB", "Deserialization failed: unterminated text");
+      return nullptr;
+    }
+    const uint16_t* offsets = textBlock->textOffsets();
+    for (uint16_t i = 0; i < wc; i++) {
+      if (offsets[i] >= textBytes) {
+        LOG_ERR("TXB", "Deserialization failed: word offset %u out of range", offsets[i]);
+        return nullptr;
+      }
+    }
+  }
 
   // Style (alignment + margins/padding/indent)
   serialization::readPod(file, blockStyle.alignment);
@@ -116,6 +172,5 @@ std::unique_ptr<TextBlock> TextBlock::deserialize(FsFile& file) {
   serialization::readPod(file, blockStyle.textIndent);
   serialization::readPod(file, blockStyle.textIndentDefined);
 
-  return std::unique_ptr<TextBlock>(
-      new TextBlock(std::move(words), std::move(wordXpos), std::move(wordStyles), blockStyle));
+  return textBlock;
 }
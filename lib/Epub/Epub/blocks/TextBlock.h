@@ -2,34 +2,53 @@
 #include <EpdFontFamily.h>
 #include <HalStorage.h>
 
-#include <list>
+#include <cstdint>
 #include <memory>
-#include <string>
 
 #include "Block.h"
 #include "BlockStyle.h"
 
 // Represents a line of text on a page
+//
+// The line is held in a single allocation so building, loading and drawing it do not touch the heap per word:
+//   uint16_t xpos[wordCount] | uint16_t textOffset[wordCount] | uint8_t style[wordCount] | NUL-terminated word text
+// serialize and deserialize move that block in one write or read.
 class TextBlock final : public Block {
  private:
-  std::list<std::string> words;
-  std::list<uint16_t> wordXpos;
-  std::list<EpdFontFamily::Style> wordStyles;
+  std::unique_ptr<uint16_t[]> data;
+  uint16_t wordCount = 0;
+  uint16_t wordsAdded = 0;
+  uint16_t textSize = 0;  // Bytes of word text in use, terminators included
+  uint16_t textCapacity = 0;
   BlockStyle blockStyle;
 
+  TextBlock() = default;
+  bool allocate(uint16_t words, uint16_t textBytes);
+  // Bytes of the block from xpos up to the end of the text in use
+  size_t usedBytes() const { return static_cast<size_t>(wordCount) * 5 + textSize; }
+  uint16_t* wordXpos() const { return data.get(); }
+  uint16_t* textOffsets() const { return data.get() + wordCount; }
+  uint8_t* wordStyles() const { return reinterpret_cast<uint8_t*>(data.get() + 2 * wordCount); }
+  char* text() const { return reinterpret_cast<char*>(wordStyles() + wordCount); }
+
  public:
-  explicit TextBlock(std::list<std::string> words, std::list<uint16_t> word_xpos,
-                     std::list<EpdFontFamily::Style> word_styles, const BlockStyle& blockStyle = BlockStyle())
-      : words(std::move(words)),
-        wordXpos(std::move(word_xpos)),
-        wordStyles(std::move(word_styles)),
-        blockStyle(blockStyle) {}
+  // Allocates a line of wordCount words holding up to textBytes of word text, terminators excluded. Fill it in order
+  // with addWord.
+  TextBlock(uint16_t wordCount, size_t textBytes, const BlockStyle& blockStyle = BlockStyle());
   ~TextBlock() override = default;
+  // Copies the next word of the line
+  void addWord(const char* word, size_t length, uint16_t xpos, EpdFontFamily::Style style);
   void setBlockStyle(const BlockStyle& blockStyle) { this->blockStyle = blockStyle; }
   const BlockStyle& getBlockStyle() const { return blockStyle; }
-  bool isEmpty() override { return words.empty(); }
+  uint16_t getWordCount() const { return wordsAdded; }
+  const char* getWord(const uint16_t index) const { return text() + textOffsets()[index]; }
+  uint16_t getWordXpos(const uint16_t index) const { return wordXpos()[index]; }
+  EpdFontFamily::Style getWordStyle(const uint16_t index) const {
+    return static_cast<EpdFontFamily::Style>(wordStyles()[index]);
+  }
+  bool isEmpty() override { return wordsAdded == 0; }
   // given a renderer works out where to break the words into lines
-  void render(const GfxRenderer& renderer, int fontId, int x, int y) const;
+  void render(const GfxRenderer& renderer, FontHandle font, int x, int y) const;
   BlockType getType() override { return TEXT_BLOCK; }
   bool serialize(FsFile& file) const;
   static std::unique_ptr<TextBlock> deserialize(FsFile& file);
@@ -32,6 +32,9 @@ inline void drawPixelWithRenderMode(GfxRenderer& renderer, int x, int y, uint8_t
   GfxRenderer::RenderMode renderMode = renderer.getRenderMode();
   if (renderMode == GfxRenderer::BW && pixelValue < 3) {
     renderer.drawPixel(x, y, true);
+    if (pixelValue != 0) {
+      renderer.markGrayContent();
+    }
   } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (pixelValue == 1 || pixelValue == 2)) {
     renderer.drawPixel(x, y, false);
   } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && pixelValue == 1) {
@@ -96,6 +96,22 @@ bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePat
   LOG_DBG("JPG", "JPEG %dx%d -> %dx%d (scale %.2f), scan type: %d, MCU: %dx%d", imageInfo.m_width, imageInfo.m_height,
           destWidth, destHeight, scale, imageInfo.m_scanType, imageInfo.m_MCUWidth, imageInfo.m_MCUHeight);
 
+  // At 1/8 scale or below every destination pixel covers at least a whole 8x8 block, so picojpeg's reduce mode, which
+  // decodes only the DC coefficient (the block average) and skips dequantizing the AC terms and the IDCT, loses nothing
+  const bool reduced = scale <= 0.125f;
+  if (reduced) {
+    file.seek(0);
+    context.bufferPos = 0;
+    context.bufferFilled = 0;
+    status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 1);
+    if (status != 0) {
+      LOG_ERR("JPG", "picojpeg reduced init failed: %d", status);
+      file.close();
+      return false;
+    }
+    LOG_DBG("JPG", "Decoding DC coefficients only (1/8 scale)");
+  }
+
   if (!imageInfo.m_pMCUBufR || !imageInfo.m_pMCUBufG || !imageInfo.m_pMCUBufB) {
     LOG_ERR("JPG", "Null buffer pointers in imageInfo");
     file.close();
@@ -132,6 +148,35 @@ bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePat
     // Source position in image coordinates
     int srcStartX = mcuX * imageInfo.m_MCUWidth;
     int srcStartY = mcuY * imageInfo.m_MCUHeight;
+    mcuX++;
+    if (mcuX >= imageInfo.m_MCUSPerRow) {
+      mcuX = 0;
+      mcuY++;
+    }
+
+    if (reduced) {
+      // One pixel per block; blocks sit 64 bytes apart horizontally and 128 bytes apart vertically for every scan type
+      for (int blockY = 0; blockY < imageInfo.m_MCUHeight / 8; blockY++) {
+        int destY = config.y + (int)((srcStartY + blockY * 8) * scale);
+        if (destY >= screenHeight || destY >= config.y + destHeight) continue;
+        for (int blockX = 0; blockX < imageInfo.m_MCUWidth / 8; blockX++) {
+          int destX = config.x + (int)((srcStartX + blockX * 8) * scale);
+          if (destX >= screenWidth || destX >= config.x + destWidth) continue;
+          int offset = blockY * 128 + blockX * 64;
+          uint8_t gray = imageInfo.m_pMCUBufR[offset];
+          if (imageInfo.m_scanType != PJPG_GRAYSCALE) {
+            gray = (uint8_t)((imageInfo.m_pMCUBufR[offset] * 77 + imageInfo.m_pMCUBufG[offset] * 150 +
+                              imageInfo.m_pMCUBufB[offset] * 29) >>
+                             8);
+          }
+          uint8_t dithered = config.useDithering ? applyBayerDither4Level(gray, destX, destY) : gray / 85;
+          if (dithered > 3) dithered = 3;
+          drawPixelWithRenderMode(renderer, destX, destY, dithered);
+          if (caching) cache.setPixel(destX, destY, dithered);
+        }
+      }
+      continue;
+    }
 
     switch (imageInfo.m_scanType) {
       case PJPG_GRAYSCALE:
@@ -245,12 +290,6 @@ bool JpegToFramebufferConverter::decodeToFramebuffer(const std::string& imagePat
         }
         break;
     }
-
-    mcuX++;
-    if (mcuX >= imageInfo.m_MCUSPerRow) {
-      mcuX = 0;
-      mcuY++;
-    }
   }
 
   LOG_DBG("JPG", "Decoding complete");
@@ -80,3 +80,100 @@ struct PixelCache {
     }
   }
 };
+
+// Streams the same cache file format row by row for decoders that produce output rows top to bottom, so only a single
+// row is held in memory regardless of the image size. The header is written with a height of 0 and patched once every
+// row is on the card, so an interrupted decode leaves a file that renderFromCache rejects. A failed write (e.g. a full
+// card) makes finish() remove the file instead.
+struct PixelCacheWriter {
+  FsFile file;
+  uint8_t* row;
+  int width;
+  int height;
+  int bytesPerRow;
+  int originX;
+  int originY;
+  int rowY;     // Local row held in `row`
+  bool failed;  // A write came up short, so the file on the card is incomplete
+  std::string path;
+
+  PixelCacheWriter()
+      : row(nullptr), width(0), height(0), bytesPerRow(0), originX(0), originY(0), rowY(0), failed(false) {}
+  PixelCacheWriter(const PixelCacheWriter&) = delete;
+  PixelCacheWriter& operator=(const PixelCacheWriter&) = delete;
+
+  bool open(const std::string& cachePath, int w, int h, int ox, int oy) {
+    width = w;
+    height = h;
+    originX = ox;
+    originY = oy;
+    rowY = 0;
+    failed = false;
+    bytesPerRow = (w + 3) / 4;
+    row = (uint8_t*)malloc(bytesPerRow);
+    if (!row) {
+      LOG_ERR("IMG", "Failed to allocate cache row (%d bytes)", bytesPerRow);
+      return false;
+    }
+    memset(row, 0, bytesPerRow);
+    if (!Storage.openFileForWrite("IMG", cachePath, file)) {
+      LOG_ERR("IMG", "Failed to open cache file for writing: %s", cachePath.c_str());
+      free(row);
+      row = nullptr;
+      return false;
+    }
+    path = cachePath;
+    const uint16_t header[2] = {(uint16_t)w, 0};
+    failed = file.write(header, sizeof(header)) != sizeof(header);
+    return true;
+  }
+
+  // Pixels must arrive in row order; moving to a later row writes out the rows before it
+  void setPixel(int screenX, int screenY, uint8_t value) {
+    if (!row) return;
+    int localX = screenX - originX;
+    int localY = screenY - originY;
+    if (localX < 0 || localX >= width || localY < rowY || localY >= height) return;
+    while (rowY < localY) flushRow();
+
+    int bitShift = 6 - (localX % 4) * 2;  // MSB first: pixel 0 at bits 6-7
+    row[localX / 4] = (row[localX / 4] & ~(0x03 << bitShift)) | ((value & 0x03) << bitShift);
+  }
+
+  bool finish() {
+    if (!row) return false;
+    while (rowY < height) flushRow();
+    const uint16_t h = height;
+    const bool ok = !failed && file.seek(2) && file.write(&h, 2) == 2;
+    file.close();
+    free(row);
+    row = nullptr;
+    if (!ok) {
+      LOG_ERR("IMG", "Failed to write cache file: %s", path.c_str());
+      Storage.remove(path.c_str());
+      return false;
+    }
+    LOG_DBG("IMG", "Cache written: %s (%dx%d, %d bytes)", path.c_str(), width, height, 4 + bytesPerRow * height);
+    return true;
+  }
+
+  void abort() {
+    if (!row) return;
+    file.close();
+    Storage.remove(path.c_str());
+    free(row);
+    row = nullptr;
+  }
+
+  ~PixelCacheWriter() { abort(); }
+
+ private:
+  void flushRow() {
+    // Once a write has failed the file is discarded, so the remaining rows are not written
+    if (!failed && file.write(row, bytesPerRow) != static_cast<size_t>(bytesPerRow)) {
+      failed = true;
+    }
+    memset(row, 0, bytesPerRow);
+    rowY++;
+  }
+};
@@ -7,6 +7,7 @@
 #include <SdFat.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <new>
 
 #include "DitherUtils.h"
@@ -29,9 +30,13 @@ struct PngContext {
   int srcHeight;
   int dstWidth;
   int dstHeight;
-  int lastDstY;  // Track last rendered destination Y to avoid duplicates
+  int nextDstY;  // Destination row currently being accumulated
 
-  PixelCache cache;
+  // Box filter for the destination row: gray sums and sample counts of the source pixels covering each column
+  uint32_t* rowSum;
+  uint16_t* rowCount;
+
+  PixelCacheWriter cache;
   bool caching;
 
   uint8_t* grayLineBuffer;
@@ -46,7 +51,9 @@ struct PngContext {
         srcHeight(0),
         dstWidth(0),
         dstHeight(0),
-        lastDstY(-1),
+        nextDstY(0),
+        rowSum(nullptr),
+        rowCount(nullptr),
         caching(false),
         grayLineBuffer(nullptr) {}
 };
@@ -176,44 +183,36 @@ void convertLineToGray(uint8_t* pPixels, uint8_t* grayLine, int width, int pixel
   }
 }
 
-int pngDrawCallback(PNGDRAW* pDraw) {
-  PngContext* ctx = reinterpret_cast<PngContext*>(pDraw->pUser);
-  if (!ctx || !ctx->config || !ctx->renderer || !ctx->grayLineBuffer) return 0;
-
-  int srcY = pDraw->y;
-  int srcWidth = ctx->srcWidth;
-
-  // Calculate destination Y with scaling
-  int dstY = (int)(srcY * ctx->scale);
-
-  // Skip if we already rendered this destination row (multiple source rows map to same dest)
-  if (dstY == ctx->lastDstY) return 1;
-  ctx->lastDstY = dstY;
+// Source pixels [first, end) covered by destination pixel `dst` along an axis; at least one so upscaling repeats pixels
+inline int spanStart(int dst, int srcSize, int dstSize) { return (int)((int64_t)dst * srcSize / dstSize); }
+inline int spanEnd(int dst, int srcSize, int dstSize) {
+  int start = spanStart(dst, srcSize, dstSize);
+  int end = spanStart(dst + 1, srcSize, dstSize);
+  return end > start ? end : start + 1;
+}
 
-  // Check bounds
-  if (dstY >= ctx->dstHeight) return 1;
+void accumulateRow(PngContext* ctx) {
+  const uint8_t* gray = ctx->grayLineBuffer;
+  for (int dstX = 0; dstX < ctx->dstWidth; dstX++) {
+    int srcX = spanStart(dstX, ctx->srcWidth, ctx->dstWidth);
+    int srcEnd = spanEnd(dstX, ctx->srcWidth, ctx->dstWidth);
+    if (srcEnd > ctx->srcWidth) srcEnd = ctx->srcWidth;
+    uint32_t sum = 0;
+    for (int x = srcX; x < srcEnd; x++) sum += gray[x];
+    ctx->rowSum[dstX] += sum;
+    ctx->rowCount[dstX] += srcEnd - srcX;
+  }
+}
 
+void emitRow(PngContext* ctx, int dstY) {
   int outY = ctx->config->y + dstY;
-  if (outY >= ctx->screenHeight) return 1;
-
-  // Convert entire source line to grayscale (improves cache locality)
-  convertLineToGray(pDraw->pPixels, ctx->grayLineBuffer, srcWidth, pDraw->iPixelType, pDraw->pPalette,
-                    pDraw->iHasAlpha);
-
-  // Render scaled row using Bresenham-style integer stepping (no floating-point division)
-  int dstWidth = ctx->dstWidth;
-  int outXBase = ctx->config->x;
-  int screenWidth = ctx->screenWidth;
-  bool useDithering = ctx->config->useDithering;
-  bool caching = ctx->caching;
-
-  int srcX = 0;
-  int error = 0;
-
-  for (int dstX = 0; dstX < dstWidth; dstX++) {
-    int outX = outXBase + dstX;
-    if (outX < screenWidth) {
-      uint8_t gray = ctx->grayLineBuffer[srcX];
+  if (outY < ctx->screenHeight) {
+    int outXBase = ctx->config->x;
+    bool useDithering = ctx->config->useDithering;
+    for (int dstX = 0; dstX < ctx->dstWidth; dstX++) {
+      int outX = outXBase + dstX;
+      if (outX >= ctx->screenWidth) break;
+      uint8_t gray = ctx->rowCount[dstX] ? (uint8_t)(ctx->rowSum[dstX] / ctx->rowCount[dstX]) : 255;
 
       uint8_t ditheredGray;
       if (useDithering) {
@@ -223,15 +222,32 @@ int pngDrawCallback(PNGDRAW* pDraw) {
         if (ditheredGray > 3) ditheredGray = 3;
       }
       drawPixelWithRenderMode(*ctx->renderer, outX, outY, ditheredGray);
-      if (caching) ctx->cache.setPixel(outX, outY, ditheredGray);
+      if (ctx->caching) ctx->cache.setPixel(outX, outY, ditheredGray);
     }
+  }
+  memset(ctx->rowSum, 0, ctx->dstWidth * sizeof(uint32_t));
+  memset(ctx->rowCount, 0, ctx->dstWidth * sizeof(uint16_t));
+}
 
-    // Bresenham-style stepping: advance srcX based on ratio srcWidth/dstWidth
-    error += srcWidth;
-    while (error >= dstWidth) {
-      error -= dstWidth;
-      srcX++;
-    }
+// Scanlines arrive top to bottom. Each one is area-averaged into the destination row it belongs to, and a destination
+// row is dithered and drawn as soon as its last source row is in, so memory stays proportional to the row widths.
+int pngDrawCallback(PNGDRAW* pDraw) {
+  PngContext* ctx = reinterpret_cast<PngContext*>(pDraw->pUser);
+  if (!ctx || !ctx->config || !ctx->renderer || !ctx->grayLineBuffer || !ctx->rowSum) return 0;
+
+  int srcY = pDraw->y;
+  if (ctx->nextDstY >= ctx->dstHeight || srcY < spanStart(ctx->nextDstY, ctx->srcHeight, ctx->dstHeight)) return 1;
+
+  // Convert entire source line to grayscale (improves cache locality)
+  convertLineToGray(pDraw->pPixels, ctx->grayLineBuffer, ctx->srcWidth, pDraw->iPixelType, pDraw->pPalette,
+                    pDraw->iHasAlpha);
+
+  // When upscaling one source row completes several destination rows
+  while (ctx->nextDstY < ctx->dstHeight && srcY >= spanStart(ctx->nextDstY, ctx->srcHeight, ctx->dstHeight)) {
+    accumulateRow(ctx);
+    if (srcY + 1 < spanEnd(ctx->nextDstY, ctx->srcHeight, ctx->dstHeight)) break;
+    emitRow(ctx, ctx->nextDstY);
+    ctx->nextDstY++;
   }
 
   return 1;
@@ -300,12 +316,7 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
     return false;
   }
 
-  if (!validateImageDimensions(png->getWidth(), png->getHeight(), "PNG")) {
-    png->close();
-    delete png;
-    return false;
-  }
-
+  // No validateImageDimensions here: rows are streamed, so only the width is bounded (by PNGdec's line buffer below)
   // Calculate output dimensions
   ctx.srcWidth = png->getWidth();
   ctx.srcHeight = png->getHeight();
@@ -325,7 +336,9 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
     ctx.dstWidth = (int)(ctx.srcWidth * ctx.scale);
     ctx.dstHeight = (int)(ctx.srcHeight * ctx.scale);
   }
-  ctx.lastDstY = -1;  // Reset row tracking
+  if (ctx.dstWidth < 1) ctx.dstWidth = 1;
+  if (ctx.dstHeight < 1) ctx.dstHeight = 1;
+  ctx.nextDstY = 0;
 
   LOG_DBG("PNG", "PNG %dx%d -> %dx%d (scale %.2f), bpp: %d", ctx.srcWidth, ctx.srcHeight, ctx.dstWidth, ctx.dstHeight,
           ctx.scale, png->getBpp());
@@ -346,21 +359,26 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
     warnUnsupportedFeature("bit depth (" + std::to_string(png->getBpp()) + "bpp)", imagePath);
   }
 
-  // Allocate grayscale line buffer on demand (~3.2 KB) - freed after decode
+  // Allocate the grayscale line buffer (~8 KB) and the destination row accumulators (6 bytes per pixel) on demand
   const size_t grayBufSize = PNG_MAX_BUFFERED_PIXELS / 2;
   ctx.grayLineBuffer = static_cast<uint8_t*>(malloc(grayBufSize));
-  if (!ctx.grayLineBuffer) {
-    LOG_ERR("PNG", "Failed to allocate gray line buffer");
+  ctx.rowSum = static_cast<uint32_t*>(calloc(ctx.dstWidth, sizeof(uint32_t)));
+  ctx.rowCount = static_cast<uint16_t*>(calloc(ctx.dstWidth, sizeof(uint16_t)));
+  if (!ctx.grayLineBuffer || !ctx.rowSum || !ctx.rowCount) {
+    LOG_ERR("PNG", "Failed to allocate line buffers");
+    free(ctx.grayLineBuffer);
+    free(ctx.rowSum);
+    free(ctx.rowCount);
     png->close();
     delete png;
     return false;
   }
 
-  // Allocate cache buffer using SCALED dimensions
+  // The cache file is written one SCALED row at a time as the rows are drawn
   ctx.caching = !config.cachePath.empty();
   if (ctx.caching) {
-    if (!ctx.cache.allocate(ctx.dstWidth, ctx.dstHeight, config.x, config.y)) {
-      LOG_ERR("PNG", "Failed to allocate cache buffer, continuing without caching");
+    if (!ctx.cache.open(config.cachePath, ctx.dstWidth, ctx.dstHeight, config.x, config.y)) {
+      LOG_ERR("PNG", "Failed to open cache file, continuing without caching");
       ctx.caching = false;
     }
   }
@@ -370,22 +388,25 @@ bool PngToFramebufferConverter::decodeToFramebuffer(const std::string& imagePath
   unsigned long decodeTime = millis() - decodeStart;
 
   free(ctx.grayLineBuffer);
+  free(ctx.rowSum);
+  free(ctx.rowCount);
   ctx.grayLineBuffer = nullptr;
+  ctx.rowSum = nullptr;
+  ctx.rowCount = nullptr;
 
   if (rc != PNG_SUCCESS) {
     LOG_ERR("PNG", "Decode failed: %d", rc);
     png->close();
     delete png;
-    return false;
+    return false;  // ~PixelCacheWriter removes the partial cache file
   }
 
   png->close();
   delete png;
   LOG_DBG("PNG", "PNG decoding complete - render time: %lu ms", decodeTime);
 
-  // Write cache file if caching was enabled and buffer was allocated
   if (ctx.caching) {
-    ctx.cache.writeToFile(config.cachePath);
+    ctx.cache.finish();
   }
 
   return true;
@@ -135,43 +135,47 @@ bool isExplicitHyphen(const uint32_t cp) {
 
 bool isSoftHyphen(const uint32_t cp) { return cp == 0x00AD; }
 
-void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
+void trimSurroundingPunctuationAndFootnote(WordCodepoints& cps) {
   if (cps.empty()) {
     return;
   }
 
   // Remove trailing footnote references like [12], even if punctuation trails after the closing bracket.
   if (cps.size() >= 3) {
-    int end = static_cast<int>(cps.size()) - 1;
-    while (end >= 0 && isPunctuation(cps[end].value)) {
+    int end = static_cast<int>(cps.end) - 1;
+    while (end >= cps.begin && isPunctuation(cps.values[end])) {
       --end;
     }
     int pos = end;
-    if (pos >= 0 && isAsciiDigit(cps[pos].value)) {
-      while (pos >= 0 && isAsciiDigit(cps[pos].value)) {
+    if (pos >= cps.begin && isAsciiDigit(cps.values[pos])) {
+      while (pos >= cps.begin && isAsciiDigit(cps.values[pos])) {
         --pos;
       }
-      if (pos >= 0 && cps[pos].value == '[' && end - pos > 1) {
-        cps.erase(cps.begin() + pos, cps.end());
+      if (pos >= cps.begin && cps.values[pos] == '[' && end - pos > 1) {
+        cps.end = static_cast<uint8_t>(pos);
       }
     }
   }
 
-  while (!cps.empty() && isPunctuation(cps.front().value)) {
-    cps.erase(cps.begin());
+  while (!cps.empty() && isPunctuation(cps.values[cps.begin])) {
+    cps.begin++;
   }
-  while (!cps.empty() && isPunctuation(cps.back().value)) {
-    cps.pop_back();
+  while (!cps.empty() && isPunctuation(cps.values[cps.end - 1])) {
+    cps.end--;
   }
 }
 
-std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
-  std::vector<CodepointInfo> cps;
-  cps.reserve(word.size());
+bool collectCodepoints(const char* word, const size_t length, WordCodepoints& cps) {
+  cps.begin = 0;
+  cps.end = 0;
+  if (length > kMaxHyphenationWordBytes) {
+    return false;
+  }
 
-  const unsigned char* base = reinterpret_cast<const unsigned char*>(word.c_str());
+  const unsigned char* base = reinterpret_cast<const unsigned char*>(word);
   const unsigned char* ptr = base;
-  while (*ptr != 0) {
+  const unsigned char* const wordEnd = base + length;
+  while (ptr < wordEnd && *ptr != 0) {
     const unsigned char* current = ptr;
     const uint32_t cp = utf8NextCodepoint(&ptr);
     // If this is a combining diacritic (e.g., U+0301 = acute) and there's
@@ -182,7 +186,7 @@ std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
     // diaeresis, cedilla) without pulling in a full Unicode normalization
     // library.
     if (!cps.empty()) {
-      uint32_t prev = cps.back().value;
+      uint32_t prev = cps.values[cps.end - 1];
       uint32_t composed = 0;
       switch (cp) {
         case 0x0300:  // grave
@@ -376,13 +380,15 @@ std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
       }
 
       if (composed != 0) {
-        cps.back().value = composed;
+        cps.values[cps.end - 1] = static_cast<uint16_t>(composed);
         continue;  // skip pushing the combining mark itself
       }
     }
 
-    cps.push_back({cp, static_cast<size_t>(current - base)});
+    cps.values[cps.end] = static_cast<uint16_t>(cp <= 0xFFFFu ? cp : 0xFFFDu);
+    cps.byteOffsets[cps.end] = static_cast<uint8_t>(current - base);
+    cps.end++;
   }
 
-  return cps;
+  return true;
 }
@@ -2,12 +2,26 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <string>
-#include <vector>
 
-struct CodepointInfo {
-  uint32_t value;
-  size_t byteOffset;
+// Longest word the hyphenator evaluates, in UTF-8 bytes; longer words get no breaks. The parser cuts words at
+// MAX_WORD_SIZE (200) bytes and the paragraph indent adds one codepoint. Byte offsets and codepoint indexes of a word,
+// plus the two sentinels Liang adds, fit in a uint8_t.
+constexpr size_t kMaxHyphenationWordBytes = 240;
+
+// The codepoints of one word in fixed-capacity buffers, so evaluating a word does not touch the heap. Codepoints
+// outside the BMP are stored as U+FFFD: no hyphenation rule treats them as letters, hyphens or punctuation.
+// Trimming moves begin and end instead of erasing.
+struct WordCodepoints {
+  uint16_t values[kMaxHyphenationWordBytes];
+  uint8_t byteOffsets[kMaxHyphenationWordBytes];
+  uint8_t begin = 0;
+  uint8_t end = 0;
+
+  size_t size() const { return end - begin; }
+  bool empty() const { return end == begin; }
+  const uint16_t* data() const { return values + begin; }
+  uint32_t value(const size_t i) const { return values[begin + i]; }
+  size_t byteOffset(const size_t i) const { return byteOffsets[begin + i]; }
 };
 
 uint32_t toLowerLatin(uint32_t cp);
@@ -21,5 +35,6 @@ bool isPunctuation(uint32_t cp);
 bool isAsciiDigit(uint32_t cp);
 bool isExplicitHyphen(uint32_t cp);
 bool isSoftHyphen(uint32_t cp);
-void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps);
-std::vector<CodepointInfo> collectCodepoints(const std::string& word);
+void trimSurroundingPunctuationAndFootnote(WordCodepoints& cps);
+// Returns false, leaving cps empty, when the word is longer than kMaxHyphenationWordBytes
+bool collectCodepoints(const char* word, size_t length, WordCodepoints& cps);
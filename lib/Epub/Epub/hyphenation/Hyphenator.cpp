@@ -1,7 +1,8 @@
 #include "Hyphenator.h"
 
 #include <algorithm>
-#include <vector>
+#include <memory>
+#include <new>
 
 #include "HyphenationCommon.h"
 #include "LanguageHyphenator.h"
@@ -29,11 +30,12 @@ const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
 }
 
 // Maps a codepoint index back to its byte offset inside the source word.
-size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t index) {
-  return (index < cps.size()) ? cps[index].byteOffset : (cps.empty() ? 0 : cps.back().byteOffset);
+uint8_t byteOffsetForIndex(const WordCodepoints& cps, const size_t index) {
+  return static_cast<uint8_t>((index < cps.size()) ? cps.byteOffset(index)
+                                                   : (cps.empty() ? 0 : cps.byteOffset(cps.size() - 1)));
 }
 
-// Builds a vector of break information from explicit hyphen markers in the given codepoints.
+// Writes break information for explicit hyphen markers in the given codepoints and returns how many it wrote.
 // Only hyphens that appear between two alphabetic characters are considered valid breaks.
 //
 // Example: "US-Satellitensystems" (cps: U, S, -, S, a, t, ...)
@@ -44,36 +46,124 @@ size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t in
 // Example: "Satel\u00ADliten" (soft-hyphen between 'l' and 'l')
 //   -> returns one BreakInfo with requiresInsertedHyphen=true (soft-hyphen
 //      is invisible and needs a visible '-' when the break is used).
-std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<CodepointInfo>& cps) {
-  std::vector<Hyphenator::BreakInfo> breaks;
+size_t buildExplicitBreakInfos(const WordCodepoints& cps, Hyphenator::BreakInfo* breaks, const size_t capacity) {
+  size_t count = 0;
 
-  for (size_t i = 1; i + 1 < cps.size(); ++i) {
-    const uint32_t cp = cps[i].value;
-    if (!isExplicitHyphen(cp) || !isAlphabetic(cps[i - 1].value) || !isAlphabetic(cps[i + 1].value)) {
+  for (size_t i = 1; i + 1 < cps.size() && count < capacity; ++i) {
+    const uint32_t cp = cps.value(i);
+    if (!isExplicitHyphen(cp) || !isAlphabetic(cps.value(i - 1)) || !isAlphabetic(cps.value(i + 1))) {
       continue;
     }
     // Offset points to the next codepoint so rendering starts after the hyphen marker.
-    breaks.push_back({cps[i + 1].byteOffset, isSoftHyphen(cp)});
+    breaks[count++] = {static_cast<uint8_t>(cps.byteOffset(i + 1)), isSoftHyphen(cp)};
   }
 
-  return breaks;
+  return count;
 }
 
-}  // namespace
+// Break offsets of recently hyphenated words. The line breakers ask again for every word that overflows a line, and
+// long words recur throughout a chapter. Entries are keyed by a 64-bit hash of the word and the fallback flag, which
+// also picks the set of WAYS entries a word can live in; a new word replaces the least recently used entry of its set.
+// The entries are allocated with the first hyphenated word and released when the language changes.
+class BreakOffsetCache {
+ public:
+  // Returns the number of breaks written, or -1 when the word is not cached
+  int find(const uint64_t key, Hyphenator::BreakInfo* breaks, const size_t capacity) {
+    if (!entries) {
+      return -1;
+    }
+    Entry* set = &entries[(key & (SETS - 1)) * WAYS];
+    for (size_t way = 0; way < WAYS; way++) {
+      Entry& entry = set[way];
+      if (entry.lastUse != 0 && entry.key == key) {
+        entry.lastUse = ++useCounter;
+        const size_t count = std::min<size_t>(entry.count, capacity);
+        for (size_t i = 0; i < count; i++) {
+          breaks[i] = {entry.offsets[i], (entry.insertedHyphens >> i & 1) != 0};
+        }
+        return static_cast<int>(count);
+      }
+    }
+    return -1;
+  }
+
+  void insert(const uint64_t key, const Hyphenator::BreakInfo* breaks, const size_t count) {
+    if (count > MAX_BREAKS) {
+      return;
+    }
+    if (!entries) {
+      entries.reset(new (std::nothrow) Entry[SETS * WAYS]());
+      if (!entries) {
+        return;
+      }
+    }
+    Entry* set = &entries[(key & (SETS - 1)) * WAYS];
+    Entry* victim = &set[0];
+    for (size_t way = 1; way < WAYS; way++) {
+      if (set[way].lastUse < victim->lastUse) {
+        victim = &set[way];
+      }
+    }
+    uint16_t insertedHyphens = 0;
+    for (size_t i = 0; i < count; i++) {
+      victim->offsets[i] = breaks[i].byteOffset;
+      insertedHyphens |= static_cast<uint16_t>(breaks[i].requiresInsertedHyphen) << i;
+    }
+    victim->key = key;
+    victim->lastUse = ++useCounter;
+    victim->insertedHyphens = insertedHyphens;
+    victim->count = static_cast<uint8_t>(count);
+  }
+
+  void clear() {
+    entries.reset();
+    useCounter = 0;
+  }
 
-std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
-  if (word.empty()) {
-    return {};
+ private:
+  static constexpr size_t SETS = 32;
+  static constexpr size_t WAYS = 4;
+  static constexpr size_t MAX_BREAKS = 16;  // Words with more breaks are not cached
+  static_assert((SETS & (SETS - 1)) == 0, "SETS must be a power of two");
+
+  struct Entry {
+    uint64_t key;
+    uint32_t lastUse;          // 0 for an empty entry
+    uint16_t insertedHyphens;  // Bit i set when offsets[i] requires an inserted hyphen
+    uint8_t count;
+    uint8_t offsets[MAX_BREAKS];
+  };
+
+  std::unique_ptr<Entry[]> entries;
+  uint32_t useCounter = 0;
+};
+
+BreakOffsetCache breakOffsetCache;
+
+// FNV-1a, with the fallback flag folded in so both kinds of request can be cached for the same word
+uint64_t breakOffsetKey(const char* word, const size_t length, const bool includeFallback) {
+  uint64_t hash = 14695981039346656037ull ^ static_cast<uint64_t>(includeFallback);
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ static_cast<uint8_t>(word[i])) * 1099511628211ull;
   }
+  return hash;
+}
 
+size_t computeBreakOffsets(const char* word, const size_t length, const bool includeFallback,
+                           const LanguageHyphenator* hyphenator, Hyphenator::BreakInfo* breaks, const size_t capacity) {
   // Convert to codepoints and normalize word boundaries.
-  auto cps = collectCodepoints(word);
+  WordCodepoints cps;
+  if (!collectCodepoints(word, length, cps)) {
+    return 0;
+  }
   trimSurroundingPunctuationAndFootnote(cps);
-  const auto* hyphenator = cachedHyphenator_;
+
+  // Codepoint indexes of Liang breaks, for the whole word or one of its segments
+  uint8_t indexes[kMaxHyphenationWordBytes];
 
   // Explicit hyphen markers (soft or hard) take precedence over language breaks.
-  auto explicitBreakInfos = buildExplicitBreakInfos(cps);
-  if (!explicitBreakInfos.empty()) {
+  size_t count = buildExplicitBreakInfos(cps, breaks, capacity);
+  if (count > 0) {
     // When a word contains explicit hyphens we also run Liang patterns on each alphabetic
     // segment between them. Without this, "US-Satellitensystems" would only offer one split
     // point (after "US-"), making it impossible to break mid-"Satellitensystems" even when
@@ -92,15 +182,14 @@ std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& w
       size_t segStart = 0;
       for (size_t i = 0; i <= cps.size(); ++i) {
         const bool atEnd = (i == cps.size());
-        const bool atHyphen = !atEnd && isExplicitHyphen(cps[i].value);
+        const bool atHyphen = !atEnd && isExplicitHyphen(cps.value(i));
         if (atEnd || atHyphen) {
           if (i > segStart) {
-            std::vector<CodepointInfo> segment(cps.begin() + segStart, cps.begin() + i);
-            auto segIndexes = hyphenator->breakIndexes(segment);
-            for (const size_t idx : segIndexes) {
-              const size_t cpIdx = segStart + idx;
+            const size_t segCount = hyphenator->breakIndexes(cps.data() + segStart, i - segStart, indexes);
+            for (size_t k = 0; k < segCount && count < capacity; ++k) {
+              const size_t cpIdx = segStart + indexes[k];
               if (cpIdx < cps.size()) {
-                explicitBreakInfos.push_back({cps[cpIdx].byteOffset, true});
+                breaks[count++] = {static_cast<uint8_t>(cps.byteOffset(cpIdx)), true};
               }
             }
           }
@@ -108,38 +197,59 @@ std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& w
         }
       }
       // Merge explicit and pattern breaks into ascending byte-offset order.
-      std::sort(explicitBreakInfos.begin(), explicitBreakInfos.end(),
-                [](const BreakInfo& a, const BreakInfo& b) { return a.byteOffset < b.byteOffset; });
+      std::sort(breaks, breaks + count, [](const Hyphenator::BreakInfo& a, const Hyphenator::BreakInfo& b) {
+        return a.byteOffset < b.byteOffset;
+      });
     }
-    return explicitBreakInfos;
+    return count;
   }
 
   // Ask language hyphenator for legal break points.
-  std::vector<size_t> indexes;
+  size_t indexCount = 0;
   if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
+    indexCount = hyphenator->breakIndexes(cps.data(), cps.size(), indexes);
   }
 
   // Only add fallback breaks if needed
-  if (includeFallback && indexes.empty()) {
+  if (includeFallback && indexCount == 0) {
     const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
     const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
     for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+      indexes[indexCount++] = static_cast<uint8_t>(idx);
     }
   }
 
-  if (indexes.empty()) {
-    return {};
+  for (size_t k = 0; k < indexCount && count < capacity; ++k) {
+    breaks[count++] = {byteOffsetForIndex(cps, indexes[k]), true};
   }
+  return count;
+}
 
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
+}  // namespace
+
+size_t Hyphenator::breakOffsets(const char* word, const size_t length, const bool includeFallback, BreakInfo* breaks,
+                                const size_t capacity) {
+  if (length == 0) {
+    return 0;
   }
 
-  return breaks;
+  const uint64_t key = breakOffsetKey(word, length, includeFallback);
+  const int cached = breakOffsetCache.find(key, breaks, capacity);
+  if (cached >= 0) {
+    return static_cast<size_t>(cached);
+  }
+  const size_t count = computeBreakOffsets(word, length, includeFallback, cachedHyphenator_, breaks, capacity);
+  // A full buffer may have cut the list short, which a caller with more room must not get from the cache
+  if (count < capacity) {
+    breakOffsetCache.insert(key, breaks, count);
+  }
+  return count;
 }
 
-void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
+void Hyphenator::setPreferredLanguage(const std::string& lang) {
+  const LanguageHyphenator* hyphenator = hyphenatorForLanguage(lang);
+  if (hyphenator != cachedHyphenator_) {
+    breakOffsetCache.clear();
+  }
+  cachedHyphenator_ = hyphenator;
+}
@@ -1,20 +1,28 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
-#include <vector>
+
+#include "HyphenationCommon.h"
 
 class LanguageHyphenator;
 
 class Hyphenator {
  public:
   struct BreakInfo {
-    size_t byteOffset;            // Byte position inside the UTF-8 word where a break may occur.
+    uint8_t byteOffset;           // Byte position inside the UTF-8 word where a break may occur.
     bool requiresInsertedHyphen;  // true = a visible '-' must be rendered at the break (pattern/fallback breaks).
                                   // false = the word already contains a hyphen at this position (explicit '-').
   };
+  static_assert(kMaxHyphenationWordBytes <= UINT8_MAX, "Break offsets must fit in BreakInfo::byteOffset");
+
+  // Enough room for the breaks of any word
+  static constexpr size_t MAX_BREAKS = kMaxHyphenationWordBytes;
 
-  // Returns byte offsets where the word may be hyphenated.
+  // Writes the byte offsets where the word may be hyphenated to breaks, in ascending order, and returns how many it
+  // wrote. Nothing is allocated: the word is evaluated in stack buffers, and words longer than
+  // kMaxHyphenationWordBytes get no breaks.
   //
   // Break sources (in priority order):
   //   1. Explicit hyphens already present in the word (e.g. '-' or soft-hyphen U+00AD).
@@ -27,7 +35,8 @@ class Hyphenator {
   //   3. Fallback every-N-chars splitting (only when includeFallback is true AND no
   //      pattern breaks were found). Used as a last resort to prevent a single oversized
   //      word from overflowing the page width.
-  static std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
+  static size_t breakOffsets(const char* word, size_t length, bool includeFallback, BreakInfo* breaks,
+                             size_t capacity);
 
   // Provide a publication-level language hint (e.g. "en", "en-US", "ru") used to select hyphenation rules.
   static void setPreferredLanguage(const std::string& lang);
@@ -10,8 +10,9 @@ class LanguageHyphenator {
                      size_t minSuffix = LiangWordConfig::kDefaultMinSuffix)
       : patterns_(patterns), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
 
-  std::vector<size_t> breakIndexes(const std::vector<CodepointInfo>& cps) const {
-    return liangBreakIndexes(cps, patterns_, config_);
+  // See liangBreakIndexes
+  size_t breakIndexes(const uint16_t* cps, const size_t count, uint8_t* indexes) const {
+    return liangBreakIndexes(cps, count, patterns_, config_, indexes);
   }
 
   size_t minPrefix() const { return config_.minPrefix; }
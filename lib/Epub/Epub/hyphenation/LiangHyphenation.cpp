@@ -1,14 +1,13 @@
 #include "LiangHyphenation.h"
 
 #include <algorithm>
-#include <vector>
 
 /*
  * Liang hyphenation pipeline overview (Typst-style binary trie variant)
  * --------------------------------------------------------------------
  * 1.  Input normalization (buildAugmentedWord)
- *     - Accepts a vector of CodepointInfo structs emitted by the EPUB text
- *       parser. Each codepoint is validated with LiangWordConfig::isLetter so
+ *     - Accepts the codepoints collected from the EPUB text by
+ *       collectCodepoints. Each codepoint is validated with LiangWordConfig::isLetter so
  *       we abort early on digits, punctuation, etc. If the word is valid we
  *       build an "augmented" byte sequence: leading '.', lowercase UTF-8 bytes
  *       for every letter, then a trailing '.'. While doing this we capture the
@@ -24,8 +23,9 @@
  *       nodes, and an optional pointer into a shared "levels" list. We parse
  *       that layout lazily via decodeState/transition, keeping everything in
  *       flash memory; no heap allocations besides the stack-local AutomatonState
- *       structs. getAutomaton caches parseAutomaton results per blob pointer so
- *       multiple words hitting the same language only pay the cost once.
+ *       structs. When the generator emitted acceleration tables, the first two
+ *       bytes of every match are looked up directly and wide nodes are binary
+ *       searched (acceleratedTransition/findTransition).
  *
  * 3.  Pattern application
  *     - We walk the augmented bytes left-to-right. For each starting byte we
@@ -38,7 +38,7 @@
  *       "max digit wins" rule.
  *
  * 4.  Output filtering
- *     - collectBreakIndexes converts odd-valued score entries back to codepoint
+ *     - collectBreakIndexes writes odd-valued score entries out as codepoint
  *       break positions while enforcing `minPrefix`/`minSuffix` constraints from
  *       LiangWordConfig. The caller (language-specific hyphenators) can then
  *       translate these indexes into renderer glyph offsets, page layout data,
@@ -47,82 +47,78 @@
  * Keeping the entire algorithm small and deterministic is critical on the
  * ESP32-C3: we avoid recursion, dynamic allocations per node, or copying the
  * trie. All lookups stay within the generated blob, which lives in flash, and
- * the working buffers (augmented bytes/scores) scale with the word length rather
- * than the pattern corpus.
+ * the working buffers (augmented bytes/scores) are fixed-size stack arrays
+ * bounded by kMaxHyphenationWordBytes, so a word never touches the heap.
  */
 
 namespace {
 
 using EmbeddedAutomaton = SerializedHyphenationPatterns;
 
+// Lowering never lengthens a letter's UTF-8 encoding, so the augmented word of a word within kMaxHyphenationWordBytes
+// fits in that many bytes plus the two dots, and has at most as many characters.
 struct AugmentedWord {
-  std::vector<uint8_t> bytes;
-  std::vector<size_t> charByteOffsets;
-  std::vector<int32_t> byteToCharIndex;
+  static constexpr size_t CAPACITY = kMaxHyphenationWordBytes + 2;
+  static constexpr uint8_t NO_CHAR = 0xFF;
+  static_assert(CAPACITY < NO_CHAR, "Character indexes must fit in a byte");
 
-  bool empty() const { return bytes.empty(); }
-  size_t charCount() const { return charByteOffsets.size(); }
+  uint8_t bytes[CAPACITY];
+  uint8_t charByteOffsets[CAPACITY];
+  uint8_t byteToCharIndex[CAPACITY];  // NO_CHAR for bytes inside a codepoint
+  size_t byteCount = 0;
+  size_t charCount = 0;
+
+  bool empty() const { return byteCount == 0; }
 };
 
-// Encode a single Unicode codepoint into UTF-8 and append to the provided buffer.
-size_t encodeUtf8(uint32_t cp, std::vector<uint8_t>& out) {
+// Encode a single Unicode codepoint into UTF-8 and append it to the augmented bytes.
+void encodeUtf8(const uint32_t cp, AugmentedWord& word) {
+  uint8_t* out = word.bytes + word.byteCount;
   if (cp <= 0x7Fu) {
-    out.push_back(static_cast<uint8_t>(cp));
-    return 1;
-  }
-  if (cp <= 0x7FFu) {
-    out.push_back(static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
-    return 2;
-  }
-  if (cp <= 0xFFFFu) {
-    out.push_back(static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
-    return 3;
+    out[0] = static_cast<uint8_t>(cp);
+    word.byteCount += 1;
+  } else if (cp <= 0x7FFu) {
+    out[0] = static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu));
+    out[1] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
+    word.byteCount += 2;
+  } else {
+    out[0] = static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu));
+    out[1] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+    out[2] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
+    word.byteCount += 3;
   }
-  out.push_back(static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
-  return 4;
 }
 
-// Build the dotted, lowercase UTF-8 representation plus lookup tables.
-AugmentedWord buildAugmentedWord(const std::vector<CodepointInfo>& cps, const LiangWordConfig& config) {
-  AugmentedWord word;
-  if (cps.empty()) {
-    return word;
+// Build the dotted, lowercase UTF-8 representation plus lookup tables. Leaves the word empty when a codepoint is not a
+// letter.
+void buildAugmentedWord(const uint16_t* cps, const size_t count, const LiangWordConfig& config, AugmentedWord& word) {
+  word.byteCount = 0;
+  word.charCount = 0;
+  if (count == 0 || count > kMaxHyphenationWordBytes) {
+    return;
   }
 
-  word.bytes.reserve(cps.size() * 2 + 2);
-  word.charByteOffsets.reserve(cps.size() + 2);
+  word.charByteOffsets[word.charCount++] = 0;
+  word.bytes[word.byteCount++] = '.';
 
-  word.charByteOffsets.push_back(0);
-  word.bytes.push_back('.');
-
-  for (const auto& info : cps) {
-    if (!config.isLetter(info.value)) {
-      word.bytes.clear();
-      word.charByteOffsets.clear();
-      word.byteToCharIndex.clear();
-      return word;
+  for (size_t i = 0; i < count; ++i) {
+    // Codepoints are BMP, so the lowercase form takes at most 3 bytes; keep room for the trailing dot
+    if (!config.isLetter(cps[i]) || word.byteCount + 4 > AugmentedWord::CAPACITY) {
+      word.byteCount = 0;
+      word.charCount = 0;
+      return;
     }
-    word.charByteOffsets.push_back(word.bytes.size());
-    encodeUtf8(config.toLower(info.value), word.bytes);
+    word.charByteOffsets[word.charCount++] = static_cast<uint8_t>(word.byteCount);
+    encodeUtf8(config.toLower(cps[i]), word);
   }
 
-  word.charByteOffsets.push_back(word.bytes.size());
-  word.bytes.push_back('.');
+  word.charByteOffsets[word.charCount++] = static_cast<uint8_t>(word.byteCount);
+  word.bytes[word.byteCount++] = '.';
 
-  word.byteToCharIndex.assign(word.bytes.size(), -1);
-  for (size_t i = 0; i < word.charByteOffsets.size(); ++i) {
-    const size_t offset = word.charByteOffsets[i];
-    if (offset < word.byteToCharIndex.size()) {
-      word.byteToCharIndex[offset] = static_cast<int32_t>(i);
-    }
+  std::fill(word.byteToCharIndex, word.byteToCharIndex + word.byteCount, AugmentedWord::NO_CHAR);
+  for (size_t i = 0; i < word.charCount; ++i) {
+    word.byteToCharIndex[word.charByteOffsets[i]] = static_cast<uint8_t>(i);
   }
-  return word;
 }
 
 // Decoded view of a single trie node pulled straight out of the serialized blob.
@@ -227,41 +223,77 @@ int32_t decodeDelta(const uint8_t* buf, uint8_t stride) {
   return unsignedVal - (1 << 23);
 }
 
+// Index of `letter` among the transitions of `state`, or childCount when it has none.
+size_t findTransition(const EmbeddedAutomaton& automaton, const AutomatonState& state, const uint8_t letter) {
+  const uint8_t* const labels = state.transitions;
+  // hypher writes labels in insertion order; the generator sorts them only in wide nodes of accelerated tries. Most
+  // nodes are narrow enough that a linear scan is as fast as a binary search.
+  if (automaton.acceleration && state.childCount >= automaton.acceleration->sortedMinChildren) {
+    const uint8_t* const found = std::lower_bound(labels, labels + state.childCount, letter);
+    return (found != labels + state.childCount && *found == letter) ? static_cast<size_t>(found - labels)
+                                                                    : state.childCount;
+  }
+  for (size_t idx = 0; idx < state.childCount; ++idx) {
+    if (labels[idx] == letter) {
+      return idx;
+    }
+  }
+  return state.childCount;
+}
+
 // Follow a single byte transition from `state`, decoding the child node on success.
 bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state, uint8_t letter, AutomatonState& out) {
   if (!state.valid()) {
     return false;
   }
 
-  // Children remain sorted by letter in the serialized blob, but the lists are
-  // short enough that a linear scan keeps code size down compared to binary search.
-  for (size_t idx = 0; idx < state.childCount; ++idx) {
-    if (state.transitions[idx] != letter) {
-      continue;
+  const size_t idx = findTransition(automaton, state, letter);
+  if (idx == state.childCount) {
+    return false;
+  }
+  const uint8_t* deltaPtr = state.targets + idx * state.stride;
+  const int32_t delta = decodeDelta(deltaPtr, state.stride);
+  // Deltas are relative to the current node's address, allowing us to keep all
+  // targets within 24 bits while still referencing further nodes in the blob.
+  const int64_t nextAddr = static_cast<int64_t>(state.addr) + delta;
+  if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= automaton.size) {
+    return false;
+  }
+  out = decodeState(automaton, static_cast<size_t>(nextAddr));
+  return out.valid();
+}
+
+// Follow the first two bytes of a match through the acceleration tables. `slot` carries the root transition taken by
+// the first byte over to the second.
+bool acceleratedTransition(const EmbeddedAutomaton& automaton, const size_t depth, const uint8_t letter, uint8_t& slot,
+                           AutomatonState& out) {
+  const SerializedTrieAcceleration& tables = *automaton.acceleration;
+  uint32_t addr = SerializedTrieAcceleration::kNoTarget;
+  if (depth == 0) {
+    slot = tables.rootSlots[letter];
+    if (slot != SerializedTrieAcceleration::kNoSlot) {
+      addr = tables.depth1Targets[slot];
     }
-    const uint8_t* deltaPtr = state.targets + idx * state.stride;
-    const int32_t delta = decodeDelta(deltaPtr, state.stride);
-    // Deltas are relative to the current node's address, allowing us to keep all
-    // targets within 24 bits while still referencing further nodes in the blob.
-    const int64_t nextAddr = static_cast<int64_t>(state.addr) + delta;
-    if (nextAddr < 0 || static_cast<size_t>(nextAddr) >= automaton.size) {
-      return false;
+  } else {
+    const uint8_t column = tables.byteClasses[letter];
+    if (column != SerializedTrieAcceleration::kNoSlot) {
+      addr = tables.depth2Targets[slot * tables.classCount + column];
     }
-    out = decodeState(automaton, static_cast<size_t>(nextAddr));
-    return out.valid();
   }
-  return false;
+  if (addr == SerializedTrieAcceleration::kNoTarget) {
+    return false;
+  }
+  out = decodeState(automaton, addr);
+  return out.valid();
 }
 
 // Converts odd score positions back into codepoint indexes, honoring min prefix/suffix constraints.
 // Each break corresponds to scores[breakIndex + 1] because of the leading '.' sentinel.
-// Convert odd score entries into hyphen positions while honoring prefix/suffix limits.
-std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, const std::vector<uint8_t>& scores,
-                                        const size_t minPrefix, const size_t minSuffix) {
-  std::vector<size_t> indexes;
-  const size_t cpCount = cps.size();
+size_t collectBreakIndexes(const size_t cpCount, const uint8_t* scores, const size_t scoreCount, const size_t minPrefix,
+                           const size_t minSuffix, uint8_t* indexes) {
+  size_t found = 0;
   if (cpCount < 2) {
-    return indexes;
+    return found;
   }
 
   for (size_t breakIndex = 1; breakIndex < cpCount; ++breakIndex) {
@@ -275,46 +307,53 @@ std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, c
     }
 
     const size_t scoreIdx = breakIndex + 1;
-    if (scoreIdx >= scores.size()) {
+    if (scoreIdx >= scoreCount) {
       break;
     }
     if ((scores[scoreIdx] & 1u) == 0) {
       continue;
     }
-    indexes.push_back(breakIndex);
+    indexes[found++] = static_cast<uint8_t>(breakIndex);
   }
 
-  return indexes;
+  return found;
 }
 
 }  // namespace
 
 // Entry point that runs the full Liang pipeline for a single word.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
-  const auto augmented = buildAugmentedWord(cps, config);
+size_t liangBreakIndexes(const uint16_t* cps, const size_t count, const SerializedHyphenationPatterns& patterns,
+                         const LiangWordConfig& config, uint8_t* indexes) {
+  AugmentedWord augmented;
+  buildAugmentedWord(cps, count, config, augmented);
   if (augmented.empty()) {
-    return {};
+    return 0;
   }
 
   const EmbeddedAutomaton& automaton = patterns;
 
   const AutomatonState root = decodeState(automaton, automaton.rootOffset);
   if (!root.valid()) {
-    return {};
+    return 0;
   }
 
   // Liang scores: one entry per augmented char (leading/trailing dots included).
-  std::vector<uint8_t> scores(augmented.charCount(), 0);
+  uint8_t scores[AugmentedWord::CAPACITY] = {};
 
   // Walk every starting character position and stream bytes through the trie.
-  for (size_t charStart = 0; charStart < augmented.charByteOffsets.size(); ++charStart) {
+  for (size_t charStart = 0; charStart < augmented.charCount; ++charStart) {
     const size_t byteStart = augmented.charByteOffsets[charStart];
     AutomatonState state = root;
+    uint8_t rootSlot = SerializedTrieAcceleration::kNoSlot;
 
-    for (size_t cursor = byteStart; cursor < augmented.bytes.size(); ++cursor) {
+    for (size_t cursor = byteStart; cursor < augmented.byteCount; ++cursor) {
       AutomatonState next;
-      if (!transition(automaton, state, augmented.bytes[cursor], next)) {
+      const uint8_t letter = augmented.bytes[cursor];
+      const size_t depth = cursor - byteStart;
+      const bool matched = (automaton.acceleration && depth < 2)
+                               ? acceleratedTransition(automaton, depth, letter, rootSlot, next)
+                               : transition(automaton, state, letter, next);
+      if (!matched) {
         break;  // No more matches for this prefix.
       }
       state = next;
@@ -329,27 +368,23 @@ std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
 
           offset += dist;
           const size_t splitByte = byteStart + offset;
-          if (splitByte >= augmented.byteToCharIndex.size()) {
+          if (splitByte >= augmented.byteCount) {
             continue;
           }
 
-          const int32_t boundary = augmented.byteToCharIndex[splitByte];
-          if (boundary < 0) {
+          const uint8_t boundary = augmented.byteToCharIndex[splitByte];
+          if (boundary == AugmentedWord::NO_CHAR) {
             continue;  // Mid-codepoint byte, wait for the next one.
           }
-          if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount())) {
+          if (boundary < 2 || boundary + 2u > augmented.charCount) {
             continue;  // Skip splits that land in the leading/trailing sentinels.
           }
 
-          const size_t idx = static_cast<size_t>(boundary);
-          if (idx >= scores.size()) {
-            continue;
-          }
-          scores[idx] = std::max(scores[idx], level);
+          scores[boundary] = std::max(scores[boundary], level);
         }
       }
     }
   }
 
-  return collectBreakIndexes(cps, scores, config.minPrefix, config.minSuffix);
+  return collectBreakIndexes(count, scores, augmented.charCount, config.minPrefix, config.minSuffix, indexes);
 }
@@ -2,7 +2,6 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <vector>
 
 #include "HyphenationCommon.h"
 #include "SerializedHyphenationTrie.h"
@@ -33,6 +32,8 @@ struct LiangWordConfig {
       : isLetter(letterFn), toLower(lowerFn), minPrefix(prefix), minSuffix(suffix) {}
 };
 
-// Shared Liang pattern evaluator used by every language-specific hyphenator.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config);
+// Shared Liang pattern evaluator used by every language-specific hyphenator. Writes the codepoint indexes a word of
+// `count` codepoints may break before to `indexes`, which must hold count entries, and returns how many it wrote.
+// Everything runs in stack buffers bounded by kMaxHyphenationWordBytes.
+size_t liangBreakIndexes(const uint16_t* cps, size_t count, const SerializedHyphenationPatterns& patterns,
+                         const LiangWordConfig& config, uint8_t* indexes);
@@ -3,9 +3,25 @@
 #include <cstddef>
 #include <cstdint>
 
+// Optional lookup tables generate_hyphenation_trie.py emits next to a trie. Every starting position of a word walks
+// the root and one of its children, the widest nodes of the trie, so these two levels are indexed directly instead of
+// scanned. Nodes with at least sortedMinChildren transitions have their labels sorted for binary search.
+struct SerializedTrieAcceleration {
+  static constexpr std::uint8_t kNoSlot = 0xFF;
+  static constexpr std::uint32_t kNoTarget = 0xFFFFFFFFu;
+
+  const std::uint8_t* rootSlots;         // 256 entries: slot of the root's transition for a byte, or kNoSlot
+  const std::uint8_t* byteClasses;       // 256 entries: column of a byte used by a depth-1 node, or kNoSlot
+  const std::uint32_t* depth1Targets;    // Node address per root slot
+  const std::uint32_t* depth2Targets;    // Node address per root slot and byte class, or kNoTarget
+  std::uint8_t classCount;
+  std::uint8_t sortedMinChildren;
+};
+
 // Lightweight descriptor that points at a serialized Liang hyphenation trie stored in flash.
 struct SerializedHyphenationPatterns {
   size_t rootOffset;
   const std::uint8_t* data;
   size_t size;
+  const SerializedTrieAcceleration* acceleration = nullptr;
 };
@@ -467,12 +467,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xE7, 0x47, 0x42, 0x75, 0xC3, 0xF6, 0x01, 0xFF, 0xFC, 0x44, 0x63, 0x65, 0x67, 0x72, 0xF0, 0x7E,
     0xFF, 0xD2, 0xFF, 0xE8, 0xFF, 0xF9, 0x41, 0x67, 0xEB, 0x68, 0xA1, 0x00, 0x51, 0x69, 0xFC, 0x21,
     0x65, 0xFB, 0x45, 0x65, 0x69, 0x6F, 0x75, 0x77, 0xFF, 0x7C, 0xFF, 0xA4, 0xFF, 0xAF, 0xFF, 0xE7,
-    0xFF, 0xFD, 0x5A, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xE9, 0xED, 0xEA,
-    0x3B, 0xEB, 0xA9, 0xEB, 0xEB, 0xED, 0x5D, 0xF0, 0x72, 0xF1, 0x6F, 0xF2, 0x6F, 0xF3, 0x6B, 0xF3,
-    0xCE, 0xF3, 0xF2, 0xF4, 0x49, 0xF5, 0x70, 0xF6, 0xA6, 0xF7, 0x80, 0xF8, 0x34, 0xF8, 0xD4, 0xFA,
-    0x13, 0xFB, 0xAC, 0xFD, 0x86, 0xFE, 0x37, 0xFE, 0x67, 0xFF, 0x2B, 0xFF, 0x3B, 0xFF, 0x46, 0xFF,
-    0xF0, 0xA0, 0x02, 0xF1, 0xA0, 0x06, 0xC1, 0xA2, 0x06, 0xB1, 0x61, 0x65, 0xFA, 0xFD, 0xA0, 0x02,
+    0xFF, 0xFD, 0x5A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0xE9, 0xED, 0xEB,
+    0xA9, 0xEB, 0xEB, 0xED, 0x5D, 0xF0, 0x72, 0xF1, 0x6F, 0xF2, 0x6F, 0xF3, 0x6B, 0xF3, 0xCE, 0xF3,
+    0xF2, 0xF4, 0x49, 0xF5, 0x70, 0xF6, 0xA6, 0xF7, 0x80, 0xF8, 0x34, 0xF8, 0xD4, 0xFA, 0x13, 0xFB,
+    0xAC, 0xFD, 0x86, 0xFE, 0x37, 0xFE, 0x67, 0xFF, 0x2B, 0xFF, 0x3B, 0xFF, 0x46, 0xFF, 0xF0, 0xEA,
+    0x3B, 0xA0, 0x02, 0xF1, 0xA0, 0x06, 0xC1, 0xA2, 0x06, 0xB1, 0x61, 0x65, 0xFA, 0xFD, 0xA0, 0x02,
     0x61, 0x21, 0x73, 0xFD, 0x22, 0x65, 0x68, 0xFA, 0xFD, 0xA0, 0x06, 0xB2, 0x42, 0x72, 0x73, 0xFF,
     0xE8, 0xE6, 0x70, 0x21, 0x74, 0xEB, 0x42, 0x63, 0x6E, 0xE6, 0x63, 0xE6, 0x63, 0xA0, 0x00, 0x81,
     0x43, 0x63, 0x69, 0x73, 0xE6, 0x59, 0xFF, 0xFD, 0xE6, 0xC3, 0xA0, 0x06, 0xD2, 0xC1, 0x00, 0x91,
@@ -522,11 +522,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x34, 0xFE, 0x34, 0xFE, 0x31, 0xFF, 0xE0, 0xFF, 0xE6, 0xFF, 0xF3, 0x42, 0x69, 0x73, 0xFD, 0xAF,
     0xE4, 0x47, 0x21, 0x65, 0xF9, 0x41, 0x62, 0xFE, 0x98, 0x41, 0x74, 0xFE, 0x94, 0x41, 0x75, 0xFE,
     0x04, 0xC5, 0x06, 0xF1, 0x65, 0x67, 0x6D, 0x6E, 0x73, 0xFF, 0xF4, 0xFD, 0x1C, 0xFC, 0xF0, 0xFF,
-    0xF8, 0xFF, 0xFC, 0x41, 0x6E, 0xFE, 0x97, 0xA1, 0x07, 0xB1, 0x75, 0xFC, 0x54, 0x61, 0xC3, 0x62,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79,
-    0x7A, 0xFD, 0xF6, 0xFE, 0x25, 0xFE, 0x3D, 0xFE, 0x44, 0xFE, 0xA3, 0xFE, 0xBC, 0xFE, 0xBC, 0xFE,
-    0xBC, 0xFE, 0xD0, 0xFE, 0xBC, 0xFF, 0x27, 0xFE, 0xBC, 0xFF, 0x48, 0xFF, 0x73, 0xFF, 0xB1, 0xFF,
-    0xD6, 0xFF, 0xE5, 0xFE, 0xBC, 0xFD, 0xE2, 0xFF, 0xFB, 0xA0, 0x08, 0xA2, 0x43, 0x65, 0x6D, 0x6E,
+    0xF8, 0xFF, 0xFC, 0x41, 0x6E, 0xFE, 0x97, 0xA1, 0x07, 0xB1, 0x75, 0xFC, 0x54, 0x61, 0x62, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A,
+    0xC3, 0xFD, 0xF6, 0xFE, 0x3D, 0xFE, 0x44, 0xFE, 0xA3, 0xFE, 0xBC, 0xFE, 0xBC, 0xFE, 0xBC, 0xFE,
+    0xD0, 0xFE, 0xBC, 0xFF, 0x27, 0xFE, 0xBC, 0xFF, 0x48, 0xFF, 0x73, 0xFF, 0xB1, 0xFF, 0xD6, 0xFF,
+    0xE5, 0xFE, 0xBC, 0xFD, 0xE2, 0xFF, 0xFB, 0xFE, 0x25, 0xA0, 0x08, 0xA2, 0x43, 0x65, 0x6D, 0x6E,
     0xFC, 0xA2, 0xFC, 0xA2, 0xFC, 0xA2, 0x41, 0x6C, 0xE3, 0x19, 0xA0, 0x01, 0x01, 0x42, 0x69, 0x74,
     0xFF, 0xFD, 0xE3, 0x12, 0x48, 0x62, 0x65, 0x6B, 0x6C, 0x6E, 0x72, 0x73, 0x75, 0xE3, 0x05, 0xE8,
     0xAA, 0xE3, 0x05, 0xFF, 0xF2, 0xE3, 0x05, 0xFF, 0xF9, 0xE3, 0x05, 0xE3, 0x05, 0x41, 0x66, 0xE2,
@@ -550,11 +550,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0xC3, 0x69, 0xFF, 0xFA, 0xFF, 0xFD, 0xE9, 0x96, 0x41, 0x75, 0xE3, 0x80, 0x42, 0x63, 0x74,
     0xFC, 0x9F, 0xFF, 0xFC, 0x41, 0x6D, 0xE2, 0x9B, 0x48, 0x61, 0x65, 0x67, 0x69, 0x6B, 0x72, 0x73,
     0x75, 0xFF, 0xC3, 0xFF, 0xCE, 0xFC, 0x94, 0xEA, 0x16, 0xFC, 0x94, 0xFF, 0xE7, 0xFF, 0xF5, 0xFF,
-    0xFC, 0x43, 0x66, 0x68, 0x73, 0xE3, 0x70, 0xE1, 0xA8, 0xFB, 0x2D, 0x55, 0x2E, 0x61, 0xC3, 0x62,
-    0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76,
-    0x77, 0xFC, 0x23, 0xFE, 0x99, 0xFE, 0xB6, 0xFC, 0x23, 0xFF, 0x21, 0xFC, 0x23, 0xFF, 0x3C, 0xFC,
-    0x23, 0xFF, 0x40, 0xFC, 0x23, 0xFF, 0x55, 0xFF, 0x5B, 0xE1, 0x9E, 0xFF, 0x6B, 0xFC, 0x23, 0xFF,
-    0x7A, 0xFF, 0x87, 0xFF, 0xDD, 0xFF, 0xF6, 0xFC, 0x23, 0xFF, 0x7A, 0xC1, 0x06, 0xB1, 0x6E, 0xE1,
+    0xFC, 0x43, 0x66, 0x68, 0x73, 0xE3, 0x70, 0xE1, 0xA8, 0xFB, 0x2D, 0x55, 0x2E, 0x61, 0x62, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0xC3, 0xFC, 0x23, 0xFE, 0x99, 0xFC, 0x23, 0xFF, 0x21, 0xFC, 0x23, 0xFF, 0x3C, 0xFC, 0x23, 0xFF,
+    0x40, 0xFC, 0x23, 0xFF, 0x55, 0xFF, 0x5B, 0xE1, 0x9E, 0xFF, 0x6B, 0xFC, 0x23, 0xFF, 0x7A, 0xFF,
+    0x87, 0xFF, 0xDD, 0xFF, 0xF6, 0xFC, 0x23, 0xFF, 0x7A, 0xFE, 0xB6, 0xC1, 0x06, 0xB1, 0x6E, 0xE1,
     0xC8, 0x41, 0x64, 0xFC, 0x6C, 0x44, 0x67, 0x6E, 0x72, 0x73, 0xFC, 0x68, 0xFC, 0xEE, 0xFF, 0xFC,
     0xFC, 0x27, 0x41, 0x6E, 0xFE, 0x76, 0x41, 0x73, 0xE2, 0x22, 0x21, 0x75, 0xFC, 0xC1, 0x00, 0x61,
     0x67, 0xE2, 0x1B, 0x42, 0x61, 0x69, 0xFF, 0xFA, 0xE1, 0x3C, 0xA2, 0x07, 0x91, 0x61, 0x74, 0xF0,
@@ -583,10 +583,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x57, 0x41, 0xBC, 0xFA, 0x50, 0x25, 0x61, 0x65, 0x6F, 0x75, 0xC3, 0xE2, 0xE6, 0xEF, 0xF5, 0xFC,
     0x41, 0x72, 0xF9, 0xDA, 0x41, 0x75, 0xFA, 0xE6, 0xA2, 0x09, 0xB2, 0x6F, 0x74, 0xF8, 0xFC, 0xC1,
     0x00, 0x51, 0x6C, 0xF9, 0x4E, 0x41, 0x65, 0xDF, 0xA4, 0xC3, 0x09, 0xD3, 0x65, 0x6F, 0x72, 0xFF,
-    0xF6, 0xDF, 0xA3, 0xFF, 0xFC, 0x52, 0x2E, 0x61, 0xC3, 0x63, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
-    0x6D, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0xFA, 0x19, 0xFE, 0xCF, 0xFE, 0xF7, 0xFE, 0xFE,
-    0xFF, 0x56, 0xFA, 0x19, 0xFF, 0x7C, 0xFA, 0x19, 0xFF, 0x8D, 0xFA, 0xF3, 0xFF, 0x94, 0xFF, 0x9F,
-    0xFA, 0x19, 0xFA, 0x19, 0xFF, 0xD0, 0xFF, 0xE3, 0xFF, 0xF4, 0xFA, 0xF3, 0xC1, 0x00, 0xB1, 0x70,
+    0xF6, 0xDF, 0xA3, 0xFF, 0xFC, 0x52, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6D,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0xC3, 0xFA, 0x19, 0xFE, 0xCF, 0xFE, 0xFE, 0xFF, 0x56,
+    0xFA, 0x19, 0xFF, 0x7C, 0xFA, 0x19, 0xFF, 0x8D, 0xFA, 0xF3, 0xFF, 0x94, 0xFF, 0x9F, 0xFA, 0x19,
+    0xFA, 0x19, 0xFF, 0xD0, 0xFF, 0xE3, 0xFF, 0xF4, 0xFA, 0xF3, 0xFE, 0xF7, 0xC1, 0x00, 0xB1, 0x70,
     0xDF, 0x60, 0x41, 0x65, 0xF9, 0x78, 0x42, 0x6C, 0x74, 0xF8, 0xCE, 0xFF, 0xFC, 0x42, 0x73, 0x75,
     0xEC, 0x8D, 0xF9, 0xD4, 0x41, 0x70, 0xE2, 0xBC, 0xA1, 0x06, 0xF1, 0x73, 0xFC, 0x22, 0x68, 0x6B,
     0xF0, 0xFB, 0x41, 0x73, 0xF8, 0xDB, 0x42, 0x72, 0x73, 0xFF, 0xFC, 0xDF, 0xD8, 0x42, 0x61, 0x65,
@@ -643,10 +643,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x43, 0x2E, 0x63, 0x70, 0xF6, 0xDC, 0xFF, 0xFD, 0xDC, 0x76, 0xC7, 0x06, 0xC1, 0x65, 0x66, 0x67,
     0x6C, 0x6D, 0x72, 0x73, 0xFF, 0xD4, 0xF6, 0x84, 0xFF, 0xDC, 0xF6, 0xD2, 0xF6, 0x84, 0xFF, 0xE3,
     0xFF, 0xF6, 0x41, 0x69, 0xF5, 0x62, 0x58, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0xC3, 0x74, 0x75, 0x76, 0x78, 0xF6,
+    0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0xC3, 0xF6,
     0x68, 0xFC, 0x86, 0xFC, 0x90, 0xFC, 0xA7, 0xFC, 0xBE, 0xFC, 0xCB, 0xFC, 0xD1, 0xFC, 0xF5, 0xFD,
     0x2B, 0xFD, 0x61, 0xFD, 0x70, 0xFD, 0xBD, 0xFD, 0xD9, 0xFE, 0x02, 0xFE, 0x24, 0xFE, 0x31, 0xFE,
-    0x36, 0xFE, 0xE2, 0xFF, 0x47, 0xFF, 0x64, 0xFF, 0xA2, 0xFF, 0xE4, 0xFF, 0xFC, 0xF5, 0xC8, 0x41,
+    0x36, 0xFE, 0xE2, 0xFF, 0x47, 0xFF, 0xA2, 0xFF, 0xE4, 0xFF, 0xFC, 0xF5, 0xC8, 0xFF, 0x64, 0x41,
     0x6E, 0xF7, 0x9A, 0xA0, 0x09, 0x32, 0xC4, 0x06, 0xF1, 0x65, 0x6E, 0x70, 0x75, 0xFF, 0xF9, 0xFA,
     0xB7, 0xF5, 0x0B, 0xFF, 0xFD, 0xA1, 0x06, 0xF1, 0x6E, 0xEE, 0x42, 0xA4, 0xBC, 0xFF, 0xFB, 0xF6,
     0x04, 0xA0, 0x0B, 0x32, 0x22, 0x68, 0x72, 0xFD, 0xFD, 0x21, 0x6E, 0xFB, 0x41, 0x6C, 0xF6, 0x81,
@@ -703,10 +703,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x8E, 0x41, 0xA4, 0xF4, 0x52, 0x41, 0x6C, 0xF3, 0x75, 0x41, 0x73, 0xF3, 0x71, 0x21, 0x61, 0xFC,
     0x45, 0x61, 0xC3, 0x65, 0x6F, 0x72, 0xFF, 0xED, 0xFF, 0xF1, 0xFF, 0xF5, 0xE4, 0x5A, 0xFF, 0xFD,
     0x45, 0x61, 0x65, 0x69, 0x70, 0x74, 0xFF, 0xBC, 0xFF, 0xC2, 0xF9, 0x59, 0xFF, 0xD6, 0xFF, 0xF0,
-    0x41, 0x74, 0xD9, 0x6D, 0x42, 0x65, 0x6E, 0xFF, 0xFC, 0xF6, 0xBD, 0x4D, 0x61, 0xC3, 0x64, 0x65,
-    0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0xFE, 0x27, 0xFE, 0x37, 0xFE, 0x53, 0xFF,
-    0x17, 0xF8, 0x55, 0xFF, 0x42, 0xFF, 0x5D, 0xFF, 0x6C, 0xFF, 0x76, 0xFF, 0x94, 0xFF, 0xE5, 0xF2,
-    0x93, 0xFF, 0xF9, 0xC1, 0x0B, 0xF3, 0x6E, 0xF7, 0x0D, 0x42, 0xA4, 0xB6, 0xF1, 0xB3, 0xF1, 0xB3,
+    0x41, 0x74, 0xD9, 0x6D, 0x42, 0x65, 0x6E, 0xFF, 0xFC, 0xF6, 0xBD, 0x4D, 0x61, 0x64, 0x65, 0x67,
+    0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0xC3, 0xFE, 0x27, 0xFE, 0x53, 0xFF, 0x17, 0xF8,
+    0x55, 0xFF, 0x42, 0xFF, 0x5D, 0xFF, 0x6C, 0xFF, 0x76, 0xFF, 0x94, 0xFF, 0xE5, 0xF2, 0x93, 0xFF,
+    0xF9, 0xFE, 0x37, 0xC1, 0x0B, 0xF3, 0x6E, 0xF7, 0x0D, 0x42, 0xA4, 0xB6, 0xF1, 0xB3, 0xF1, 0xB3,
     0x41, 0x69, 0xD8, 0x43, 0x41, 0x65, 0xD9, 0x85, 0xA1, 0x01, 0x31, 0x73, 0xFC, 0x21, 0x6E, 0xFB,
     0xA0, 0x0C, 0x23, 0x43, 0x68, 0x6B, 0x77, 0xFF, 0xFD, 0xE6, 0xCC, 0xFF, 0xFD, 0xC3, 0x06, 0xB1,
     0x69, 0x72, 0x73, 0xFF, 0xF0, 0xFF, 0xF6, 0xD7, 0xBC, 0x41, 0x64, 0xDB, 0x27, 0xA1, 0x06, 0xB1,
@@ -733,10 +733,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x69, 0x74, 0xFF, 0xBB, 0xFF, 0xDC, 0xF0, 0xF4, 0xFF, 0xF0, 0xC1, 0x00, 0x91, 0x65, 0xF0, 0x4A,
     0x44, 0x6C, 0x72, 0x73, 0x78, 0xF8, 0xD4, 0xF2, 0x34, 0xFF, 0xFA, 0xF0, 0x41, 0x42, 0x65, 0x69,
     0xD6, 0x4C, 0xF0, 0x34, 0x41, 0x6D, 0xF0, 0x2D, 0x46, 0x61, 0x65, 0x69, 0x72, 0x73, 0x75, 0xEF,
-    0xBC, 0xFF, 0xE8, 0xF7, 0x0A, 0xFF, 0xF5, 0xDF, 0xC3, 0xFF, 0xFC, 0x4E, 0x61, 0xC3, 0x64, 0x65,
-    0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x74, 0x75, 0x77, 0x79, 0xFE, 0x48, 0xFE, 0x4E, 0xFE, 0x55,
-    0xFE, 0x72, 0xFE, 0x82, 0xFE, 0xCE, 0xFF, 0x06, 0xFF, 0x53, 0xFF, 0x6D, 0xFF, 0xC2, 0xFF, 0xED,
-    0xF0, 0x01, 0xF0, 0xB6, 0xF0, 0x01, 0xC2, 0x0D, 0x02, 0x2E, 0x6E, 0xEF, 0x88, 0xD6, 0x6D, 0x43,
+    0xBC, 0xFF, 0xE8, 0xF7, 0x0A, 0xFF, 0xF5, 0xDF, 0xC3, 0xFF, 0xFC, 0x4E, 0x61, 0x64, 0x65, 0x69,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x74, 0x75, 0x77, 0x79, 0xC3, 0xFE, 0x48, 0xFE, 0x55, 0xFE, 0x72,
+    0xFE, 0x82, 0xFE, 0xCE, 0xFF, 0x06, 0xFF, 0x53, 0xFF, 0x6D, 0xFF, 0xC2, 0xFF, 0xED, 0xF0, 0x01,
+    0xF0, 0xB6, 0xF0, 0x01, 0xFE, 0x4E, 0xC2, 0x0D, 0x02, 0x2E, 0x6E, 0xEF, 0x88, 0xD6, 0x6D, 0x43,
     0x69, 0x72, 0x73, 0xD5, 0xFD, 0xF0, 0x82, 0xD6, 0x6A, 0xC1, 0x00, 0xD1, 0x64, 0xD6, 0x3E, 0xC2,
     0x0D, 0x02, 0x6E, 0x72, 0xFF, 0xFA, 0xF9, 0x14, 0xC1, 0x00, 0xB1, 0x72, 0xF0, 0x69, 0xC1, 0x00,
     0xB1, 0x65, 0xFD, 0x97, 0x41, 0x72, 0xEF, 0xBD, 0x42, 0x2E, 0x65, 0xEF, 0x56, 0xFF, 0xFC, 0x41,
@@ -771,14 +771,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x21, 0x68, 0xFD, 0x21, 0x63, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x6E, 0xFD, 0x43, 0x6B, 0x6F, 0x73,
     0xEE, 0xD0, 0xFF, 0xFD, 0xEE, 0xD0, 0x42, 0x62, 0x65, 0xED, 0xDB, 0xED, 0x97, 0x43, 0x65, 0x6F,
     0x75, 0xED, 0xD4, 0xED, 0xD4, 0xED, 0x90, 0x43, 0x69, 0x70, 0x74, 0xEE, 0xB5, 0xEE, 0xB5, 0xEE,
-    0xB5, 0x41, 0x6E, 0xEE, 0xAB, 0x4D, 0x61, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6D, 0x6F, 0xC3, 0x72,
-    0x73, 0x75, 0x77, 0xFF, 0xB8, 0xEE, 0x59, 0xFE, 0x81, 0xEE, 0x59, 0xED, 0x4F, 0xFF, 0xD7, 0xEE,
-    0x59, 0xFF, 0xE1, 0xF9, 0x80, 0xFF, 0xE8, 0xFF, 0xF2, 0xFF, 0xFC, 0xEE, 0x59, 0x44, 0x6C, 0x6E,
-    0x72, 0x73, 0xEE, 0x31, 0xEE, 0x31, 0xEE, 0x31, 0xDA, 0x2C, 0x56, 0x2E, 0x61, 0xC3, 0x62, 0x63,
-    0x64, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77,
-    0x7A, 0xEE, 0x24, 0xFE, 0xE8, 0xFF, 0x07, 0xEE, 0x24, 0xEE, 0x24, 0xEE, 0xFE, 0xFF, 0x12, 0xEE,
-    0x24, 0xEE, 0x24, 0xFF, 0x24, 0xFF, 0x31, 0xFF, 0x3A, 0xEE, 0x24, 0xFF, 0x46, 0xFF, 0x4D, 0xEE,
-    0x24, 0xFF, 0x60, 0xFF, 0x7A, 0xFF, 0xCB, 0xFF, 0xF3, 0xEE, 0x24, 0xEE, 0xFE, 0x43, 0x62, 0x6F,
+    0xB5, 0x41, 0x6E, 0xEE, 0xAB, 0x4D, 0x61, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6D, 0x6F, 0x72, 0x73,
+    0x75, 0x77, 0xC3, 0xFF, 0xB8, 0xEE, 0x59, 0xFE, 0x81, 0xEE, 0x59, 0xED, 0x4F, 0xFF, 0xD7, 0xEE,
+    0x59, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xF2, 0xFF, 0xFC, 0xEE, 0x59, 0xF9, 0x80, 0x44, 0x6C, 0x6E,
+    0x72, 0x73, 0xEE, 0x31, 0xEE, 0x31, 0xEE, 0x31, 0xDA, 0x2C, 0x56, 0x2E, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A,
+    0xC3, 0xEE, 0x24, 0xFE, 0xE8, 0xEE, 0x24, 0xEE, 0x24, 0xEE, 0xFE, 0xFF, 0x12, 0xEE, 0x24, 0xEE,
+    0x24, 0xFF, 0x24, 0xFF, 0x31, 0xFF, 0x3A, 0xEE, 0x24, 0xFF, 0x46, 0xFF, 0x4D, 0xEE, 0x24, 0xFF,
+    0x60, 0xFF, 0x7A, 0xFF, 0xCB, 0xFF, 0xF3, 0xEE, 0x24, 0xEE, 0xFE, 0xFF, 0x07, 0x43, 0x62, 0x6F,
     0x74, 0xED, 0xE4, 0xEE, 0x2F, 0xEF, 0x5C, 0x43, 0x2E, 0x64, 0x6D, 0xEC, 0xD7, 0xED, 0xDA, 0xED,
     0xDA, 0x42, 0x6C, 0x72, 0xD3, 0x48, 0xED, 0xD0, 0x42, 0x65, 0x69, 0xED, 0xC9, 0xD3, 0xFA, 0xC1,
     0x08, 0x12, 0x65, 0xF7, 0xC2, 0x43, 0x65, 0x72, 0x73, 0xFA, 0xF0, 0xEE, 0x65, 0xD4, 0xD9, 0x4A,
@@ -816,9 +816,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x65, 0xD7, 0x8A, 0x21, 0x6E, 0xFC, 0xA1, 0x00, 0x81, 0x65, 0xFD, 0xA0, 0x0D, 0xC3, 0x21, 0xB6,
     0xFD, 0x42, 0x65, 0xC3, 0xF5, 0xB0, 0xFF, 0xFD, 0x41, 0xA4, 0xF5, 0xA9, 0x21, 0xC3, 0xFC, 0x21,
     0x69, 0xEC, 0x41, 0xB6, 0xED, 0x17, 0x21, 0x72, 0xE5, 0xA0, 0x0D, 0xF3, 0x21, 0xA4, 0xFD, 0x42,
-    0x61, 0xC3, 0xEC, 0xA7, 0xFF, 0xFD, 0x4D, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6F, 0xC3, 0x72,
-    0x73, 0x74, 0x77, 0x7A, 0xFF, 0xC5, 0xFF, 0xD0, 0xFF, 0xDB, 0xDE, 0xE0, 0xFF, 0xE6, 0xFF, 0xE9,
-    0xD5, 0xAC, 0xFF, 0xEC, 0xEB, 0x24, 0xFF, 0x62, 0xFF, 0xF0, 0xFF, 0xF9, 0xFF, 0x62, 0xA0, 0x0E,
+    0x61, 0xC3, 0xEC, 0xA7, 0xFF, 0xFD, 0x4D, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6F, 0x72, 0x73,
+    0x74, 0x77, 0x7A, 0xC3, 0xFF, 0xC5, 0xFF, 0xD0, 0xFF, 0xDB, 0xDE, 0xE0, 0xFF, 0xE6, 0xFF, 0xE9,
+    0xD5, 0xAC, 0xEB, 0x24, 0xFF, 0x62, 0xFF, 0xF0, 0xFF, 0xF9, 0xFF, 0x62, 0xFF, 0xEC, 0xA0, 0x0E,
     0x24, 0x42, 0x6B, 0x73, 0xFF, 0xFD, 0xEB, 0xEC, 0xA0, 0x0D, 0xA3, 0x21, 0x68, 0xFD, 0x41, 0x72,
     0xEC, 0xCB, 0x42, 0x69, 0x74, 0xEB, 0x4F, 0xEB, 0x4F, 0xCC, 0x06, 0xF1, 0x62, 0x66, 0x69, 0x6C,
     0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78, 0xFF, 0x18, 0xF5, 0x2A, 0xFF, 0x23, 0xFF, 0x30,
@@ -867,10 +867,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xD4, 0xFF, 0xDE, 0xF3, 0xC0, 0xFF, 0xF3, 0xC2, 0x02, 0xF1, 0x62, 0x69, 0xE8, 0x89, 0xE8,
     0x22, 0x41, 0x65, 0xE9, 0xF8, 0xC4, 0x06, 0xB1, 0x6D, 0x72, 0x73, 0x74, 0xFF, 0xF3, 0xE7, 0x6C,
     0xFF, 0xFC, 0xD3, 0x19, 0x42, 0x70, 0x72, 0xE7, 0xCD, 0xE7, 0xCD, 0x42, 0x61, 0x65, 0xFF, 0xF9,
-    0xE9, 0xE8, 0x53, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xFB, 0x13, 0xFB, 0x5D, 0xFB, 0xB3, 0xED, 0x41, 0xFC, 0x12,
-    0xFD, 0x17, 0xFD, 0x45, 0xFD, 0x7F, 0xFD, 0xCC, 0xFE, 0x81, 0xFE, 0xA2, 0xF3, 0xED, 0xFE, 0xE0,
-    0xFF, 0x13, 0xFF, 0x3E, 0xFF, 0xC3, 0xFF, 0xE3, 0xE8, 0x5C, 0xFF, 0xF9, 0x41, 0x61, 0xEF, 0xF3,
+    0xE9, 0xE8, 0x53, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+    0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0xFB, 0x13, 0xFB, 0xB3, 0xED, 0x41, 0xFC, 0x12, 0xFD, 0x17,
+    0xFD, 0x45, 0xFD, 0x7F, 0xFD, 0xCC, 0xFE, 0x81, 0xFE, 0xA2, 0xF3, 0xED, 0xFE, 0xE0, 0xFF, 0x13,
+    0xFF, 0x3E, 0xFF, 0xC3, 0xFF, 0xE3, 0xE8, 0x5C, 0xFF, 0xF9, 0xFB, 0x5D, 0x41, 0x61, 0xEF, 0xF3,
     0xC2, 0x07, 0x91, 0x70, 0x72, 0xE8, 0x21, 0xD9, 0xA4, 0x41, 0x67, 0xE9, 0x27, 0x41, 0x65, 0xCD,
     0xE2, 0x42, 0x68, 0x72, 0xFF, 0xFC, 0xCD, 0xC1, 0xC2, 0x00, 0x81, 0x67, 0x74, 0xE8, 0xB2, 0xFF,
     0xF9, 0x41, 0x7A, 0xD0, 0xEF, 0x4A, 0x61, 0x62, 0x64, 0x65, 0x67, 0x6C, 0x6E, 0x70, 0x73, 0x7A,
@@ -907,11 +907,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x42, 0x2E, 0x64, 0xE5, 0xAA, 0xE5, 0xAA, 0xC1, 0x06, 0xC1, 0x72, 0xCB, 0x82, 0x4A, 0x61, 0xC3,
     0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x75, 0x76, 0xFF, 0x77, 0xFF, 0x7D, 0xFF, 0xB2, 0xE4, 0xF7,
     0xFF, 0xC2, 0xFF, 0xCF, 0xFF, 0xE6, 0xFF, 0xF3, 0xFF, 0xFA, 0xE6, 0x01, 0xC2, 0x06, 0xF1, 0x66,
-    0x6C, 0xEF, 0xC7, 0xF4, 0x95, 0x54, 0x2E, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69,
-    0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x76, 0x77, 0xE5, 0xD9, 0xFD, 0xE0, 0xFD, 0xFF,
-    0xFE, 0x0A, 0xE5, 0xD9, 0xE5, 0xD9, 0xFE, 0x56, 0xE5, 0xD9, 0xE5, 0xD9, 0xFE, 0x87, 0xE5, 0xD9,
-    0xE5, 0xD9, 0xFE, 0xD9, 0xFE, 0xFC, 0xFF, 0x1C, 0xFF, 0x37, 0xFF, 0xD8, 0xFF, 0xF7, 0xE5, 0xD9,
-    0xE5, 0xD9, 0xC1, 0x07, 0x91, 0x68, 0xD6, 0xE1, 0x41, 0x2E, 0xCC, 0xB6, 0x21, 0x72, 0xFC, 0x21,
+    0x6C, 0xEF, 0xC7, 0xF4, 0x95, 0x54, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B,
+    0x6C, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x76, 0x77, 0xC3, 0xE5, 0xD9, 0xFD, 0xE0, 0xFE, 0x0A,
+    0xE5, 0xD9, 0xE5, 0xD9, 0xFE, 0x56, 0xE5, 0xD9, 0xE5, 0xD9, 0xFE, 0x87, 0xE5, 0xD9, 0xE5, 0xD9,
+    0xFE, 0xD9, 0xFE, 0xFC, 0xFF, 0x1C, 0xFF, 0x37, 0xFF, 0xD8, 0xFF, 0xF7, 0xE5, 0xD9, 0xE5, 0xD9,
+    0xFD, 0xFF, 0xC1, 0x07, 0x91, 0x68, 0xD6, 0xE1, 0x41, 0x2E, 0xCC, 0xB6, 0x21, 0x72, 0xFC, 0x21,
     0x65, 0xFD, 0x21, 0x69, 0xFD, 0x42, 0x73, 0x75, 0xE5, 0x8C, 0xE5, 0x8C, 0xA0, 0x0F, 0x02, 0x21,
     0x68, 0xFD, 0x44, 0x69, 0x70, 0x73, 0x79, 0xD3, 0x4C, 0xFF, 0xFD, 0xD1, 0xA1, 0xE5, 0x18, 0x43,
     0x64, 0x6F, 0x74, 0xE4, 0x8E, 0xED, 0x40, 0xE5, 0x72, 0xC3, 0x06, 0xF1, 0x62, 0x65, 0x72, 0xE5,
@@ -936,9 +936,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xCA, 0x28, 0x42, 0x68, 0x69, 0xCA, 0x24, 0xD2, 0x05, 0x43, 0x72, 0x73, 0x74, 0xCE, 0x47, 0xCE,
     0x47, 0xCE, 0x47, 0x42, 0x61, 0x68, 0xFF, 0xF6, 0xCA, 0x13, 0xA3, 0x06, 0xF1, 0x61, 0x65, 0x70,
     0xE4, 0xE8, 0xF9, 0x41, 0x62, 0xE3, 0x3A, 0x21, 0xBC, 0xFC, 0x4D, 0x2E, 0x61, 0x64, 0x65, 0x66,
-    0x67, 0x69, 0x6F, 0x72, 0x73, 0xC3, 0x77, 0x79, 0xE4, 0x14, 0xFF, 0x53, 0xE4, 0x14, 0xFF, 0xA4,
-    0xE4, 0x14, 0xE4, 0x14, 0xC9, 0xDD, 0xFF, 0xBA, 0xFF, 0xCF, 0xFF, 0xF0, 0xFF, 0xFD, 0xE4, 0x14,
-    0xE1, 0x57, 0x43, 0x2E, 0x67, 0x70, 0xF6, 0x92, 0xE3, 0x88, 0xE2, 0xEC, 0xC1, 0x00, 0xB1, 0x66,
+    0x67, 0x69, 0x6F, 0x72, 0x73, 0x77, 0x79, 0xC3, 0xE4, 0x14, 0xFF, 0x53, 0xE4, 0x14, 0xFF, 0xA4,
+    0xE4, 0x14, 0xE4, 0x14, 0xC9, 0xDD, 0xFF, 0xBA, 0xFF, 0xCF, 0xFF, 0xF0, 0xE4, 0x14, 0xE1, 0x57,
+    0xFF, 0xFD, 0x43, 0x2E, 0x67, 0x70, 0xF6, 0x92, 0xE3, 0x88, 0xE2, 0xEC, 0xC1, 0x00, 0xB1, 0x66,
     0xE3, 0xE5, 0x42, 0x69, 0x6F, 0xEB, 0xAD, 0xE4, 0xEE, 0x42, 0x65, 0x79, 0xC9, 0x89, 0xC9, 0x89,
     0xC2, 0x00, 0xB1, 0x65, 0x7A, 0xC9, 0xB3, 0xFF, 0xF9, 0x41, 0xA4, 0xC9, 0x79, 0x21, 0xC3, 0xFC,
     0x41, 0x2E, 0xED, 0xC1, 0x43, 0x6E, 0x75, 0x7A, 0xFF, 0xF9, 0xE5, 0x35, 0xFF, 0xFC, 0x41, 0x68,
@@ -956,9 +956,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xDC, 0xE2, 0xA9, 0xFF, 0xE7, 0xE2, 0xA9, 0x41, 0x6B, 0xC8, 0xDF, 0x21, 0x6F, 0xFC, 0x43, 0x64,
     0x73, 0x75, 0xC8, 0x71, 0xC8, 0x71, 0xE2, 0x0F, 0x41, 0x66, 0xE3, 0xFE, 0x22, 0x61, 0x69, 0xF2,
     0xFC, 0x42, 0x2E, 0x69, 0xCC, 0xEF, 0xC8, 0x5E, 0x43, 0x2E, 0x61, 0x74, 0xE3, 0x24, 0xD2, 0x93,
-    0xFF, 0xF9, 0x4C, 0x2E, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0xE3,
-    0x1A, 0xFF, 0x73, 0xFF, 0x89, 0xFF, 0xBF, 0xE3, 0x1D, 0xFF, 0xD9, 0xEF, 0xAB, 0xC8, 0x47, 0xE9,
-    0x85, 0xFF, 0xEA, 0xFF, 0xF6, 0xD1, 0xC9, 0x41, 0x75, 0xE2, 0xF5, 0x42, 0x72, 0x78, 0xE2, 0xF1,
+    0xFF, 0xF9, 0x4C, 0x2E, 0x61, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0xC3, 0xE3,
+    0x1A, 0xFF, 0x73, 0xFF, 0xBF, 0xE3, 0x1D, 0xFF, 0xD9, 0xEF, 0xAB, 0xC8, 0x47, 0xE9, 0x85, 0xFF,
+    0xEA, 0xFF, 0xF6, 0xD1, 0xC9, 0xFF, 0x89, 0x41, 0x75, 0xE2, 0xF5, 0x42, 0x72, 0x78, 0xE2, 0xF1,
     0xE2, 0xF1, 0xC4, 0x07, 0xB1, 0x61, 0x65, 0x75, 0xC3, 0xFF, 0xF5, 0xFF, 0xF9, 0xE2, 0x9C, 0xFD,
     0xA5, 0x42, 0x6C, 0x73, 0xC9, 0x5C, 0xC8, 0x0E, 0xC3, 0x07, 0x91, 0x6C, 0x72, 0x73, 0xFF, 0xF9,
     0xF8, 0xF6, 0xC8, 0x6B, 0x43, 0x61, 0x69, 0x72, 0xC8, 0x62, 0xC8, 0x62, 0xC8, 0x62, 0x41, 0x6E,
@@ -1003,14 +1003,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x69, 0x6C, 0x6E, 0x73, 0x74, 0xE8, 0x06, 0xFF, 0xF6, 0xF7, 0x0F, 0xC5, 0xC4, 0xE0, 0x5E, 0xFF,
     0xFA, 0xC3, 0x00, 0x91, 0x66, 0x73, 0x74, 0xDF, 0x63, 0xDF, 0x63, 0xC5, 0x7E, 0x42, 0x64, 0x6E,
     0xE7, 0xE7, 0xFF, 0xF4, 0x41, 0x6C, 0xDF, 0x09, 0x41, 0x6E, 0xE0, 0xFE, 0x21, 0x65, 0xFC, 0x42,
-    0xC3, 0x69, 0xF3, 0x86, 0xDE, 0xFE, 0x4F, 0x61, 0xC3, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6D,
-    0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0xFF, 0xA4, 0xFF, 0xB9, 0xDF, 0xD8, 0xFF, 0xC8, 0xDF, 0xD8,
-    0xDF, 0xD8, 0xFF, 0xE7, 0xDF, 0xD8, 0xDF, 0xD8, 0xFF, 0xEE, 0xDF, 0xD8, 0xDF, 0xD8, 0xDF, 0xD8,
-    0xFF, 0xF6, 0xFF, 0xF9, 0x57, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0xFA, 0x64, 0xFA, 0x9E,
-    0xFA, 0xB7, 0xFA, 0xD0, 0xFB, 0x96, 0xFB, 0xFE, 0xFC, 0x39, 0xFC, 0xDE, 0xFD, 0x0E, 0xFD, 0x45,
-    0xFD, 0xB0, 0xFD, 0xD6, 0xFD, 0xE1, 0xFE, 0x06, 0xFE, 0x46, 0xFE, 0x6F, 0xFE, 0x7C, 0xFE, 0xD4,
-    0xFF, 0x3F, 0xFF, 0x5C, 0xFF, 0x68, 0xFF, 0x6E, 0xFF, 0xD2, 0xC1, 0x06, 0xB1, 0x65, 0xDE, 0x5A,
+    0xC3, 0x69, 0xF3, 0x86, 0xDE, 0xFE, 0x4F, 0x61, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0x6F,
+    0x72, 0x73, 0x74, 0x75, 0x77, 0xC3, 0xFF, 0xA4, 0xDF, 0xD8, 0xFF, 0xC8, 0xDF, 0xD8, 0xDF, 0xD8,
+    0xFF, 0xE7, 0xDF, 0xD8, 0xDF, 0xD8, 0xFF, 0xEE, 0xDF, 0xD8, 0xDF, 0xD8, 0xDF, 0xD8, 0xFF, 0xF6,
+    0xFF, 0xF9, 0xFF, 0xB9, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0xC3, 0xFA, 0x64, 0xFA, 0xB7,
+    0xFA, 0xD0, 0xFB, 0x96, 0xFB, 0xFE, 0xFC, 0x39, 0xFC, 0xDE, 0xFD, 0x0E, 0xFD, 0x45, 0xFD, 0xB0,
+    0xFD, 0xD6, 0xFD, 0xE1, 0xFE, 0x06, 0xFE, 0x46, 0xFE, 0x6F, 0xFE, 0x7C, 0xFE, 0xD4, 0xFF, 0x3F,
+    0xFF, 0x5C, 0xFF, 0x68, 0xFF, 0x6E, 0xFF, 0xD2, 0xFA, 0x9E, 0xC1, 0x06, 0xB1, 0x65, 0xDE, 0x5A,
     0xC2, 0x06, 0xB1, 0x6D, 0x74, 0xDE, 0x5E, 0xD0, 0xA3, 0xC3, 0x06, 0xB1, 0x6B, 0x70, 0x74, 0xDE,
     0x4B, 0xC5, 0x40, 0xC4, 0xD0, 0x42, 0x2E, 0x73, 0xDE, 0x49, 0xEA, 0xDA, 0xC9, 0x06, 0xF1, 0x65,
     0x66, 0x69, 0x6B, 0x6D, 0x70, 0x72, 0x73, 0x74, 0xDE, 0x4D, 0xFF, 0xDE, 0xE4, 0x27, 0xDE, 0x57,
@@ -1117,11 +1117,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x51, 0x6C, 0x6E, 0x72, 0xEF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFA, 0x42, 0x61, 0x69, 0xC1, 0xD6, 0xBE,
     0xCC, 0xC3, 0x07, 0x71, 0x68, 0x69, 0x72, 0xBE, 0xC5, 0xBE, 0xC5, 0xFF, 0xF9, 0x47, 0x61, 0xC3,
     0x65, 0x69, 0x6E, 0x74, 0x77, 0xFF, 0xC4, 0xFF, 0xD4, 0xFF, 0xE1, 0xD8, 0xD1, 0xD8, 0x6D, 0xFF,
-    0xF4, 0xD7, 0xC7, 0x56, 0x2E, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0xD8, 0xBB, 0xFA, 0xD0, 0xFB, 0x15,
-    0xFB, 0x48, 0xFB, 0x65, 0xFB, 0x83, 0xFC, 0x34, 0xFC, 0x6F, 0xFC, 0x7D, 0xFC, 0xCD, 0xFD, 0x6C,
-    0xFD, 0xAA, 0xFD, 0xF6, 0xFE, 0x13, 0xFE, 0x4F, 0xFE, 0xA3, 0xFF, 0x17, 0xFF, 0x85, 0xFF, 0xA2,
-    0xC8, 0xC0, 0xD8, 0xBB, 0xFF, 0xEA, 0x41, 0x68, 0xF2, 0x55, 0x42, 0x68, 0x74, 0xD8, 0x77, 0xD8,
+    0xF4, 0xD7, 0xC7, 0x56, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0xC3, 0xD8, 0xBB, 0xFA, 0xD0, 0xFB, 0x48,
+    0xFB, 0x65, 0xFB, 0x83, 0xFC, 0x34, 0xFC, 0x6F, 0xFC, 0x7D, 0xFC, 0xCD, 0xFD, 0x6C, 0xFD, 0xAA,
+    0xFD, 0xF6, 0xFE, 0x13, 0xFE, 0x4F, 0xFE, 0xA3, 0xFF, 0x17, 0xFF, 0x85, 0xFF, 0xA2, 0xC8, 0xC0,
+    0xD8, 0xBB, 0xFF, 0xEA, 0xFB, 0x15, 0x41, 0x68, 0xF2, 0x55, 0x42, 0x68, 0x74, 0xD8, 0x77, 0xD8,
     0x77, 0xC1, 0x00, 0xB1, 0x63, 0xD8, 0x70, 0x43, 0x2E, 0x66, 0x67, 0xDA, 0xD3, 0xBE, 0x1B, 0xD8,
     0x6A, 0x4B, 0x63, 0x65, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75, 0xFF, 0xE5, 0xFF,
     0xE9, 0xD8, 0xAB, 0xD7, 0x7C, 0xCF, 0x98, 0xEA, 0xCD, 0xC9, 0xA2, 0xD7, 0x50, 0xC0, 0x6C, 0xFF,
@@ -1164,10 +1164,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x75, 0xFF, 0xE6, 0xFF, 0xED, 0xFF, 0xF7, 0xF5, 0xB1, 0xFF, 0xFA, 0xC1, 0x06, 0xF1, 0x64, 0xD5,
     0x12, 0x49, 0x2E, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xD6, 0x7C, 0xFF, 0x70, 0xFF,
     0xA4, 0xFF, 0xB4, 0xFF, 0xBA, 0xFF, 0xC1, 0xFF, 0xEA, 0xFF, 0xFA, 0xD4, 0xE3, 0x41, 0x6D, 0xD6,
-    0xE3, 0xC3, 0x06, 0xC1, 0x2E, 0x6C, 0x6D, 0xD5, 0xCD, 0xD4, 0xC0, 0xFF, 0xFC, 0x50, 0x61, 0xC3,
-    0x63, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0x79, 0xFD, 0x64,
-    0xFD, 0x86, 0xFD, 0xB9, 0xFE, 0x11, 0xD5, 0xC1, 0xFE, 0x37, 0xFE, 0x51, 0xFE, 0x65, 0xFE, 0x72,
-    0xFE, 0x8A, 0xFE, 0xB7, 0xFF, 0x1A, 0xFF, 0xD4, 0xC1, 0xBF, 0xC5, 0xC6, 0xFF, 0xF4, 0x41, 0x6E,
+    0xE3, 0xC3, 0x06, 0xC1, 0x2E, 0x6C, 0x6D, 0xD5, 0xCD, 0xD4, 0xC0, 0xFF, 0xFC, 0x50, 0x61, 0x63,
+    0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0x79, 0xC3, 0xFD, 0x64,
+    0xFD, 0xB9, 0xFE, 0x11, 0xD5, 0xC1, 0xFE, 0x37, 0xFE, 0x51, 0xFE, 0x65, 0xFE, 0x72, 0xFE, 0x8A,
+    0xFE, 0xB7, 0xFF, 0x1A, 0xFF, 0xD4, 0xC1, 0xBF, 0xC5, 0xC6, 0xFF, 0xF4, 0xFD, 0x86, 0x41, 0x6E,
     0xF4, 0x74, 0x43, 0x65, 0x6C, 0x72, 0xFF, 0xFC, 0xD7, 0x07, 0xD5, 0x8F, 0x43, 0x61, 0x62, 0x74,
     0xBA, 0xFD, 0xD5, 0x85, 0xD5, 0x85, 0x42, 0x6C, 0x74, 0xD5, 0x7B, 0xD5, 0x7B, 0x43, 0x66, 0x6E,
     0x73, 0xD6, 0xEC, 0xBA, 0xEC, 0xD6, 0xEC, 0xC9, 0x06, 0xF1, 0x61, 0x62, 0x65, 0x6C, 0x70, 0x72,
@@ -1217,10 +1217,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x63, 0x64, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x74, 0xDA, 0xA5, 0xDA, 0xA5, 0xD2, 0x12, 0xB9,
     0x98, 0xFF, 0xCD, 0xD2, 0x12, 0xBF, 0x07, 0xFF, 0xDE, 0xDA, 0xA5, 0xC1, 0x06, 0xC1, 0x70, 0xB8,
     0x0E, 0xC6, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x77, 0xD1, 0x83, 0xE6, 0x03, 0xFF, 0xDE,
-    0xD9, 0x38, 0xFF, 0xFA, 0xD1, 0x83, 0x50, 0x2E, 0x61, 0xC3, 0x62, 0x65, 0x68, 0x69, 0x6C, 0x6D,
-    0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xD2, 0x78, 0xFD, 0x11, 0xFD, 0x33, 0xD2, 0x78, 0xFD,
-    0x8E, 0xFD, 0xCF, 0xFE, 0x15, 0xD2, 0xC9, 0xFE, 0x2A, 0xFE, 0x63, 0xFE, 0xCE, 0xFF, 0x03, 0xFF,
-    0x5C, 0xFF, 0x80, 0xFF, 0x93, 0xFF, 0xEB, 0xC1, 0x01, 0x61, 0x72, 0xC6, 0xB3, 0x21, 0x65, 0xFA,
+    0xD9, 0x38, 0xFF, 0xFA, 0xD1, 0x83, 0x50, 0x2E, 0x61, 0x62, 0x65, 0x68, 0x69, 0x6C, 0x6D, 0x6F,
+    0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3, 0xD2, 0x78, 0xFD, 0x11, 0xD2, 0x78, 0xFD, 0x8E, 0xFD,
+    0xCF, 0xFE, 0x15, 0xD2, 0xC9, 0xFE, 0x2A, 0xFE, 0x63, 0xFE, 0xCE, 0xFF, 0x03, 0xFF, 0x5C, 0xFF,
+    0x80, 0xFF, 0x93, 0xFF, 0xEB, 0xFD, 0x33, 0xC1, 0x01, 0x61, 0x72, 0xC6, 0xB3, 0x21, 0x65, 0xFA,
     0x42, 0xA4, 0x9F, 0xD7, 0x23, 0xFF, 0xFD, 0xC1, 0x00, 0x91, 0x73, 0xDF, 0xDD, 0x41, 0x6E, 0xBF,
     0x3F, 0x21, 0x69, 0xFC, 0x45, 0x65, 0x6C, 0x6E, 0x72, 0x75, 0xB7, 0xDE, 0xC3, 0x6F, 0xFF, 0xF3,
     0xFF, 0xFD, 0xF8, 0xDF, 0x41, 0x6E, 0xD1, 0x83, 0x42, 0x65, 0x73, 0xD1, 0x7C, 0xB7, 0x97, 0x42,
@@ -1280,12 +1280,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xA1, 0x07, 0x71, 0x72, 0xF6, 0x44, 0x61, 0x69, 0x75, 0xC3, 0xEB, 0x3B, 0xB9, 0xD9, 0xBF, 0xFE,
     0xEC, 0xA5, 0xC1, 0x00, 0x51, 0x6B, 0xB4, 0x27, 0x49, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6F, 0x72,
     0x73, 0x7A, 0xFF, 0xA4, 0xFF, 0xAC, 0xFF, 0xB6, 0xFF, 0xC6, 0xCE, 0xA6, 0xFF, 0xE8, 0xFF, 0xED,
-    0xFF, 0xFA, 0xB4, 0x21, 0xD9, 0x02, 0xF1, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x7A,
-    0xF4, 0x8B, 0xFC, 0x4C, 0xFC, 0x8C, 0xFC, 0xC6, 0xCE, 0x8A, 0xFC, 0xE2, 0xFD, 0x52, 0xFD, 0x8B,
-    0xFD, 0x9B, 0xFD, 0xA4, 0xCE, 0x8A, 0xFD, 0xAA, 0xFD, 0xBC, 0xFE, 0x17, 0xFE, 0x4E, 0xD3, 0x6F,
-    0xFE, 0x6D, 0xFE, 0x7C, 0xFF, 0x5D, 0xFF, 0xE4, 0xCE, 0x8A, 0xB4, 0x53, 0xCE, 0x8A, 0xCE, 0x8A,
-    0xCE, 0x8A, 0xA0, 0x11, 0xE3, 0x43, 0x6E, 0x72, 0x74, 0xCD, 0x2F, 0xDF, 0x5E, 0xFF, 0xFD, 0x41,
+    0xFF, 0xFA, 0xB4, 0x21, 0xD9, 0x02, 0xF1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x7A, 0xC3,
+    0xF4, 0x8B, 0xFC, 0x8C, 0xFC, 0xC6, 0xCE, 0x8A, 0xFC, 0xE2, 0xFD, 0x52, 0xFD, 0x8B, 0xFD, 0x9B,
+    0xFD, 0xA4, 0xCE, 0x8A, 0xFD, 0xAA, 0xFD, 0xBC, 0xFE, 0x17, 0xFE, 0x4E, 0xD3, 0x6F, 0xFE, 0x6D,
+    0xFE, 0x7C, 0xFF, 0x5D, 0xFF, 0xE4, 0xCE, 0x8A, 0xB4, 0x53, 0xCE, 0x8A, 0xCE, 0x8A, 0xCE, 0x8A,
+    0xFC, 0x4C, 0xA0, 0x11, 0xE3, 0x43, 0x6E, 0x72, 0x74, 0xCD, 0x2F, 0xDF, 0x5E, 0xFF, 0xFD, 0x41,
     0x78, 0xD8, 0x14, 0x41, 0x72, 0xBF, 0x2D, 0xA1, 0x06, 0xF1, 0x65, 0xFC, 0x47, 0x61, 0x65, 0x69,
     0x6C, 0x6F, 0x72, 0x79, 0xFF, 0xE9, 0xFF, 0xF3, 0xFF, 0xFB, 0xCD, 0x15, 0xCE, 0x22, 0xCD, 0x15,
     0xCE, 0x22, 0xC2, 0x06, 0xF1, 0x69, 0x72, 0xD3, 0xE3, 0xCC, 0xFF, 0x42, 0x6D, 0x74, 0xCC, 0xF9,
@@ -1297,12 +1297,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x64, 0x6C, 0x73, 0xCC, 0xB1, 0xDC, 0x64, 0xBC, 0xAE, 0xC1, 0x07, 0xF2, 0x72, 0xCC, 0xC4, 0xA0,
     0x07, 0x33, 0x21, 0x6E, 0xFD, 0x44, 0x61, 0x65, 0x69, 0x77, 0xBC, 0x96, 0xFF, 0xFD, 0xD4, 0x44,
     0xCC, 0xC5, 0x45, 0x61, 0x6F, 0x75, 0x77, 0x7A, 0xFF, 0xDB, 0xCC, 0x82, 0xFF, 0xE7, 0xCD, 0xC8,
-    0xFF, 0xF3, 0x5B, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xCD, 0x3B,
-    0xCD, 0x6F, 0xCF, 0x9A, 0xD1, 0xEF, 0xD3, 0x63, 0xD7, 0x14, 0xD8, 0xEB, 0xDA, 0xE9, 0xDC, 0xC9,
-    0xDD, 0xE8, 0xDE, 0x17, 0xDF, 0x58, 0xE5, 0x20, 0xE7, 0xA3, 0xED, 0xD2, 0xEE, 0x3A, 0xEF, 0x05,
-    0xEF, 0x34, 0xF4, 0xC1, 0xF7, 0xBB, 0xFB, 0x04, 0xFE, 0xF2, 0xFF, 0x5A, 0xFF, 0x70, 0xFF, 0x8F,
-    0xFF, 0xB5, 0xFF, 0xF0, 0xC1, 0x0D, 0x02, 0x70, 0xB2, 0xA8, 0x41, 0x69, 0xB5, 0xFA, 0x44, 0x6C,
+    0xFF, 0xF3, 0x5B, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0xCD, 0x3B,
+    0xCF, 0x9A, 0xD1, 0xEF, 0xD3, 0x63, 0xD7, 0x14, 0xD8, 0xEB, 0xDA, 0xE9, 0xDC, 0xC9, 0xDD, 0xE8,
+    0xDE, 0x17, 0xDF, 0x58, 0xE5, 0x20, 0xE7, 0xA3, 0xED, 0xD2, 0xEE, 0x3A, 0xEF, 0x05, 0xEF, 0x34,
+    0xF4, 0xC1, 0xF7, 0xBB, 0xFB, 0x04, 0xFE, 0xF2, 0xFF, 0x5A, 0xFF, 0x70, 0xFF, 0x8F, 0xFF, 0xB5,
+    0xFF, 0xF0, 0xCD, 0x6F, 0xC1, 0x0D, 0x02, 0x70, 0xB2, 0xA8, 0x41, 0x69, 0xB5, 0xFA, 0x44, 0x6C,
     0x6E, 0x73, 0x74, 0xCC, 0x16, 0xFF, 0xFC, 0xB3, 0x0B, 0xBE, 0xC0, 0xA0, 0x12, 0x12, 0xA0, 0x12,
     0x32, 0xC2, 0x05, 0x11, 0x65, 0x6E, 0xB3, 0x41, 0xFF, 0xFD, 0x44, 0x61, 0x6F, 0x70, 0x74, 0xB3,
     0xE0, 0xB3, 0xE0, 0xB2, 0xB8, 0xB2, 0xB8, 0x45, 0x65, 0x69, 0x72, 0x73, 0x75, 0xFF, 0xEA, 0xCC,
@@ -1364,10 +1364,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xB8, 0x80, 0xAE, 0xFE, 0xB8, 0x80, 0xAE, 0xFE, 0x43, 0x62, 0x68, 0x72, 0xAF, 0x5E, 0xAF, 0xF9,
     0xAF, 0x5B, 0x42, 0x65, 0x7A, 0xFF, 0xF6, 0xAF, 0x57, 0x41, 0x73, 0xFD, 0x04, 0x41, 0x75, 0xAF,
     0x46, 0x41, 0x74, 0xAF, 0x14, 0x42, 0x6E, 0x72, 0xFF, 0xFC, 0xBD, 0xC5, 0x43, 0x61, 0x65, 0x74,
-    0xFF, 0xF1, 0xFF, 0xF9, 0xB3, 0x91, 0x4F, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6D,
-    0x6F, 0x70, 0x73, 0x74, 0x75, 0x7A, 0xFF, 0x21, 0xFF, 0x30, 0xFF, 0x3B, 0xC7, 0x24, 0xFF, 0x45,
-    0xFF, 0x66, 0xC7, 0x2E, 0xFF, 0x88, 0xFF, 0xBC, 0xFF, 0xC5, 0xAE, 0xC6, 0xFF, 0xDC, 0xFF, 0xE3,
-    0xCE, 0x2D, 0xFF, 0xF6, 0xA0, 0x13, 0x22, 0x42, 0x69, 0x73, 0xB0, 0x22, 0xFF, 0xFD, 0x21, 0x65,
+    0xFF, 0xF1, 0xFF, 0xF9, 0xB3, 0x91, 0x4F, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6D, 0x6F,
+    0x70, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0xFF, 0x21, 0xFF, 0x3B, 0xC7, 0x24, 0xFF, 0x45, 0xFF, 0x66,
+    0xC7, 0x2E, 0xFF, 0x88, 0xFF, 0xBC, 0xFF, 0xC5, 0xAE, 0xC6, 0xFF, 0xDC, 0xFF, 0xE3, 0xCE, 0x2D,
+    0xFF, 0xF6, 0xFF, 0x30, 0xA0, 0x13, 0x22, 0x42, 0x69, 0x73, 0xB0, 0x22, 0xFF, 0xFD, 0x21, 0x65,
     0xF9, 0x21, 0x68, 0xFD, 0xC1, 0x13, 0x43, 0x6E, 0xAE, 0xC1, 0x41, 0x61, 0xAE, 0xE9, 0xC1, 0x00,
     0xD1, 0x6E, 0xAE, 0xB4, 0x42, 0x65, 0x69, 0xFF, 0xFA, 0xB1, 0x40, 0xC7, 0x10, 0x72, 0x65, 0x67,
     0x69, 0x6C, 0x6E, 0x72, 0x75, 0xAE, 0xD8, 0xAE, 0xD8, 0xFF, 0xE9, 0xFF, 0xEF, 0xB1, 0xB2, 0xFF,
@@ -1400,13 +1400,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xD3, 0x42, 0x66, 0x69, 0xEF, 0x3F, 0xFF, 0xFD, 0x42, 0x63, 0x74, 0xAE, 0x12, 0xC7, 0x39, 0x48,
     0x2E, 0x63, 0x64, 0x65, 0x67, 0x6B, 0x6E, 0x73, 0xC7, 0x2F, 0xFF, 0xEC, 0xC7, 0x32, 0xFF, 0xF2,
     0xC7, 0x32, 0xC7, 0x32, 0xC7, 0x32, 0xFF, 0xF9, 0x41, 0x9F, 0xC7, 0xF0, 0x41, 0x72, 0xAC, 0xFD,
-    0x4D, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0xC3, 0x74, 0xFF, 0x48,
+    0x4D, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xC3, 0xFF, 0x48,
     0xC4, 0xEA, 0xFF, 0x55, 0xFF, 0x58, 0xC7, 0x4A, 0xFF, 0x61, 0xC7, 0x0E, 0xFF, 0x6D, 0xFF, 0x79,
-    0xFF, 0x8F, 0xFF, 0xDF, 0xFF, 0xF8, 0xFF, 0xFC, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
-    0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0xC3, 0x74, 0x75, 0x76, 0x78,
+    0xFF, 0x8F, 0xFF, 0xDF, 0xFF, 0xFC, 0xFF, 0xF8, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0xC3,
     0xF9, 0xBC, 0xF9, 0xC6, 0xFA, 0x0F, 0xFA, 0x49, 0xFA, 0x5C, 0xFA, 0x8F, 0xFA, 0xF2, 0xFB, 0x69,
     0xFB, 0xAE, 0xFB, 0xBE, 0xFB, 0xDE, 0xFC, 0x10, 0xFC, 0x69, 0xFC, 0x94, 0xFC, 0xAD, 0xCE, 0xB4,
-    0xFD, 0x9E, 0xFE, 0x41, 0xFE, 0x68, 0xFF, 0x01, 0xFF, 0xD8, 0xD0, 0x7A, 0xC7, 0xC0, 0x41, 0x74,
+    0xFD, 0x9E, 0xFE, 0x41, 0xFF, 0x01, 0xFF, 0xD8, 0xD0, 0x7A, 0xC7, 0xC0, 0xFE, 0x68, 0x41, 0x74,
     0xCB, 0x0F, 0x41, 0x73, 0xC5, 0x92, 0x41, 0x75, 0xAC, 0x16, 0xC6, 0x07, 0xA1, 0x65, 0x67, 0x6C,
     0x6D, 0x72, 0x75, 0xFF, 0xF8, 0xC0, 0x36, 0xFF, 0xFC, 0xAC, 0x7F, 0xAC, 0x7F, 0xAC, 0x7F, 0xA0,
     0x16, 0x71, 0x21, 0x65, 0xFD, 0xA1, 0x07, 0xA1, 0x6E, 0xFD, 0x41, 0x74, 0xC6, 0x74, 0xC1, 0x07,
@@ -1460,9 +1460,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xC7, 0x06, 0xF1, 0x61, 0x65, 0x68, 0x6F, 0x72, 0x73, 0x74, 0xF6, 0xC7, 0xFF, 0xED, 0xB6, 0x88,
     0xFF, 0xF7, 0xF6, 0xC7, 0xFF, 0xFA, 0xFC, 0x6C, 0xC1, 0x00, 0xD1, 0x73, 0xAA, 0x35, 0x21, 0x65,
     0xFA, 0x54, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0xC3, 0x74, 0x77, 0x7A, 0xFD, 0x14, 0xFD, 0x41, 0xFD, 0x46, 0xC8, 0x42, 0xFD, 0x50,
+    0x72, 0x73, 0x74, 0x77, 0x7A, 0xC3, 0xFD, 0x14, 0xFD, 0x41, 0xFD, 0x46, 0xC8, 0x42, 0xFD, 0x50,
     0xFD, 0x5E, 0xFD, 0x7D, 0xFD, 0x94, 0xFD, 0xA3, 0xFE, 0x19, 0xFE, 0x50, 0xFE, 0x6B, 0xFE, 0x82,
-    0xFE, 0x89, 0xFF, 0x14, 0xFF, 0xAC, 0xFF, 0xC9, 0xFF, 0xDF, 0xC7, 0xCC, 0xFF, 0xFD, 0xC1, 0x1D,
+    0xFE, 0x89, 0xFF, 0x14, 0xFF, 0xAC, 0xFF, 0xDF, 0xC7, 0xCC, 0xFF, 0xFD, 0xFF, 0xC9, 0xC1, 0x1D,
     0x73, 0x63, 0xC3, 0x23, 0xA0, 0x0A, 0x02, 0xA0, 0x34, 0xE3, 0x23, 0xA4, 0xB6, 0xBC, 0xFA, 0xFD,
     0xFA, 0x41, 0x6C, 0xCF, 0xEC, 0x41, 0x63, 0xA9, 0xD8, 0x22, 0x6C, 0x75, 0xF8, 0xFC, 0x41, 0x75,
     0xA8, 0xB7, 0x21, 0x61, 0xFC, 0xA2, 0x09, 0xB2, 0x61, 0x72, 0xF4, 0xFD, 0xA0, 0x09, 0xB2, 0xA0,
@@ -1491,12 +1491,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x86, 0x21, 0x72, 0xF9, 0x21, 0x65, 0xFD, 0xA3, 0x06, 0xF1, 0x69, 0xC3, 0x75, 0xEB, 0xEF, 0xFD,
     0xC1, 0x0A, 0x02, 0x73, 0xAA, 0x54, 0x43, 0x66, 0x74, 0x76, 0xFE, 0x9F, 0xC1, 0x78, 0xC1, 0x78,
     0x43, 0x65, 0x6D, 0x6E, 0xFE, 0x54, 0xFF, 0xF0, 0xFF, 0xF6, 0xC1, 0x06, 0xF1, 0x69, 0xFB, 0x75,
-    0xC1, 0x09, 0xB2, 0x73, 0xC1, 0x61, 0xD9, 0x07, 0xB1, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
-    0x77, 0x7A, 0xFE, 0x38, 0xFE, 0x44, 0xFE, 0x5F, 0xFE, 0x3E, 0xFE, 0x66, 0xFF, 0x22, 0xFE, 0xD1,
-    0xFF, 0x4A, 0xFE, 0x3E, 0xFF, 0x57, 0xC1, 0x58, 0xFF, 0x6A, 0xFF, 0x74, 0xFF, 0x85, 0xFE, 0x3E,
-    0xFF, 0x8C, 0xFE, 0xD1, 0xC1, 0x58, 0xFF, 0xA0, 0xFF, 0xB0, 0xFF, 0xD1, 0xFF, 0xEA, 0xFF, 0xF4,
-    0xC1, 0x58, 0xFF, 0xFA, 0x41, 0xA4, 0xBE, 0xE6, 0x41, 0x75, 0xA9, 0x4C, 0x21, 0x61, 0xFC, 0xC6,
+    0xC1, 0x09, 0xB2, 0x73, 0xC1, 0x61, 0xD9, 0x07, 0xB1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x7A, 0xC3, 0xFE, 0x38, 0xFE, 0x5F, 0xFE, 0x3E, 0xFE, 0x66, 0xFF, 0x22, 0xFE, 0xD1, 0xFF, 0x4A,
+    0xFE, 0x3E, 0xFF, 0x57, 0xC1, 0x58, 0xFF, 0x6A, 0xFF, 0x74, 0xFF, 0x85, 0xFE, 0x3E, 0xFF, 0x8C,
+    0xFE, 0xD1, 0xC1, 0x58, 0xFF, 0xA0, 0xFF, 0xB0, 0xFF, 0xD1, 0xFF, 0xEA, 0xFF, 0xF4, 0xC1, 0x58,
+    0xFF, 0xFA, 0xFE, 0x44, 0x41, 0xA4, 0xBE, 0xE6, 0x41, 0x75, 0xA9, 0x4C, 0x21, 0x61, 0xFC, 0xC6,
     0x00, 0x51, 0x66, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0xFE, 0x26, 0xAB, 0x3E, 0xC1, 0x02, 0xFF, 0xFD,
     0xA7, 0x33, 0xC1, 0x02, 0x42, 0x6E, 0x73, 0xA6, 0x6B, 0xA6, 0x6B, 0xA1, 0x00, 0x41, 0x65, 0xF9,
     0x41, 0x74, 0xF6, 0xCD, 0xC9, 0x0A, 0x82, 0x61, 0xC3, 0x63, 0x64, 0x65, 0x69, 0x6C, 0x72, 0x73,
@@ -1582,13 +1582,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x11, 0x6E, 0x72, 0xDE, 0xF6, 0x43, 0x61, 0x65, 0x74, 0xA1, 0xC4, 0xA1, 0xC4, 0xA1, 0xC4, 0x42,
     0x65, 0x72, 0xF8, 0x06, 0xA1, 0xBA, 0xC7, 0x06, 0xF1, 0x61, 0x65, 0x68, 0x72, 0x73, 0x74, 0x7A,
     0xFF, 0xBF, 0xFF, 0xE8, 0xEF, 0x11, 0xEF, 0x11, 0xFF, 0xEF, 0xFF, 0xF9, 0xF3, 0xDC, 0x52, 0x61,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0xC3,
-    0x74, 0xC0, 0x95, 0xFA, 0xD6, 0xFB, 0x3C, 0xFB, 0x7A, 0xFB, 0x99, 0xFB, 0xDB, 0xFC, 0x2D, 0xFC,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
+    0xC3, 0xC0, 0x95, 0xFA, 0xD6, 0xFB, 0x3C, 0xFB, 0x7A, 0xFB, 0x99, 0xFB, 0xDB, 0xFC, 0x2D, 0xFC,
     0xF6, 0xC0, 0x95, 0xFD, 0x88, 0xFD, 0xBC, 0xFE, 0x65, 0xC0, 0x95, 0xFE, 0x9E, 0xFF, 0x0F, 0xFF,
-    0x96, 0xFF, 0xA3, 0xFF, 0xE8, 0x4F, 0xA4, 0xA2, 0xA1, 0xA7, 0xA9, 0xA8, 0xAB, 0xAA, 0xAD, 0xAF,
-    0xB1, 0xB3, 0xB6, 0x9F, 0xBC, 0xF4, 0x93, 0xF4, 0xD9, 0xC0, 0x5E, 0xBC, 0x53, 0xF4, 0xE5, 0xF5,
-    0x00, 0xF5, 0x05, 0xF5, 0x09, 0xC0, 0x5E, 0xC0, 0x5E, 0xF5, 0x0F, 0xF5, 0x19, 0xF8, 0x1C, 0xFA,
-    0x21, 0xFF, 0xC9, 0x41, 0x72, 0xED, 0xAC, 0xA0, 0x14, 0x03, 0x45, 0x61, 0x65, 0x67, 0x72, 0x73,
+    0x96, 0xFF, 0xE8, 0xFF, 0xA3, 0x4F, 0x9F, 0xA1, 0xA2, 0xA4, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAD,
+    0xAF, 0xB1, 0xB3, 0xB6, 0xBC, 0xFA, 0x21, 0xC0, 0x5E, 0xF4, 0xD9, 0xF4, 0x93, 0xBC, 0x53, 0xF5,
+    0x00, 0xF4, 0xE5, 0xF5, 0x09, 0xF5, 0x05, 0xC0, 0x5E, 0xC0, 0x5E, 0xF5, 0x0F, 0xF5, 0x19, 0xF8,
+    0x1C, 0xFF, 0xC9, 0x41, 0x72, 0xED, 0xAC, 0xA0, 0x14, 0x03, 0x45, 0x61, 0x65, 0x67, 0x72, 0x73,
     0xBA, 0x70, 0xFF, 0xF9, 0xBB, 0x44, 0xFF, 0xFD, 0xBB, 0x44, 0xC1, 0x00, 0xD1, 0x65, 0xBD, 0xA0,
     0xA0, 0x14, 0x31, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x45, 0x2E, 0x65, 0x68, 0x73, 0x74, 0xBC,
     0x3D, 0xA5, 0xCD, 0xBC, 0x3D, 0xFF, 0xF1, 0xFF, 0xFD, 0xA0, 0x14, 0x43, 0x21, 0x72, 0xFD, 0x42,
@@ -1687,10 +1687,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6D, 0x72, 0xCC, 0x4F, 0xB4, 0xB3, 0xB4, 0xB3, 0x42, 0x66, 0x73, 0xB4, 0xA9, 0xA6, 0x8B, 0x21,
     0xB6, 0xF9, 0xA0, 0x15, 0x32, 0x41, 0x72, 0xA0, 0x59, 0x21, 0x65, 0xFC, 0x64, 0x6B, 0x70, 0x74,
     0x7A, 0x7F, 0x9A, 0xAD, 0x7F, 0x9A, 0xE6, 0x7F, 0xFF, 0xFD, 0x7F, 0x9A, 0xAD, 0xED, 0x02, 0xF1,
-    0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6F, 0xC3, 0x70, 0x73, 0x74, 0x7F, 0xFF, 0x84,
+    0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6F, 0x70, 0x73, 0x74, 0xC3, 0x7F, 0xFF, 0x84,
     0x7F, 0xFF, 0x8C, 0x7F, 0x9C, 0x64, 0x7F, 0xFF, 0xB2, 0x7F, 0x9A, 0x9C, 0x7F, 0xBA, 0xE3, 0x7F,
-    0xFF, 0xCA, 0x7F, 0xA5, 0xA5, 0x7F, 0xFF, 0xD1, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF,
-    0xEF, 0x7F, 0xC2, 0x00, 0x41, 0x6C, 0xB5, 0xFF, 0x42, 0x70, 0x75, 0xB5, 0xA4, 0xFF, 0xFC, 0xE3,
+    0xFF, 0xCA, 0x7F, 0xA5, 0xA5, 0x7F, 0xFF, 0xD1, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xEF, 0x7F, 0xC2,
+    0x00, 0x7F, 0xFF, 0xE2, 0x41, 0x6C, 0xB5, 0xFF, 0x42, 0x70, 0x75, 0xB5, 0xA4, 0xFF, 0xFC, 0xE3,
     0x07, 0x71, 0x62, 0x74, 0x75, 0x7F, 0xB5, 0x8E, 0x7F, 0xB3, 0xFE, 0x7F, 0x9A, 0x5A, 0xC1, 0x00,
     0xA1, 0x73, 0x9E, 0xE2, 0x61, 0x73, 0x7F, 0x9A, 0xC2, 0x22, 0x6E, 0x73, 0xF5, 0xFB, 0x44, 0x65,
     0x6C, 0x6D, 0x70, 0xFF, 0xFB, 0xB5, 0x0E, 0xB5, 0x0E, 0xB5, 0x0E, 0xC2, 0x05, 0x11, 0x64, 0x74,
@@ -1705,11 +1705,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xA4, 0x7F, 0x9D, 0x21, 0x22, 0x61, 0xC3, 0xF2, 0xFB, 0x21, 0x72, 0xFB, 0x45, 0x61, 0x65, 0x70,
     0x74, 0x7A, 0xF9, 0xBA, 0xFF, 0xD4, 0xFF, 0xE5, 0xFF, 0xFD, 0xB5, 0x3A, 0x46, 0x62, 0x64, 0x65,
     0x66, 0x73, 0x77, 0xB5, 0x27, 0xB5, 0x27, 0xD1, 0x6B, 0xB5, 0x27, 0xB5, 0x27, 0xB4, 0x60, 0xF0,
-    0x02, 0xF1, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75,
-    0x76, 0x7A, 0x7F, 0xFF, 0x20, 0x7F, 0xC7, 0x75, 0x7F, 0xB3, 0x9B, 0x7F, 0xFF, 0x3F, 0x7F, 0xFF,
-    0x77, 0x7F, 0x99, 0x7A, 0x7F, 0x99, 0x7D, 0x7F, 0xFF, 0x90, 0x7F, 0xFE, 0xC3, 0x7F, 0x99, 0x7A,
-    0x7F, 0xFF, 0xA5, 0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xED, 0x7F, 0xA2, 0x4A, 0x7F, 0xB3, 0x9B, 0x7F,
-    0xB3, 0x9B, 0x41, 0x63, 0xB4, 0xD1, 0xC2, 0x0D, 0x02, 0x69, 0x6F, 0xB5, 0x3D, 0xFF, 0xFC, 0x62,
+    0x02, 0xF1, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x76,
+    0x7A, 0xC3, 0x7F, 0xFF, 0x20, 0x7F, 0xB3, 0x9B, 0x7F, 0xFF, 0x3F, 0x7F, 0xFF, 0x77, 0x7F, 0x99,
+    0x7A, 0x7F, 0x99, 0x7D, 0x7F, 0xFF, 0x90, 0x7F, 0xFE, 0xC3, 0x7F, 0x99, 0x7A, 0x7F, 0xFF, 0xA5,
+    0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xED, 0x7F, 0xA2, 0x4A, 0x7F, 0xB3, 0x9B, 0x7F, 0xB3, 0x9B, 0x7F,
+    0xC7, 0x75, 0x41, 0x63, 0xB4, 0xD1, 0xC2, 0x0D, 0x02, 0x69, 0x6F, 0xB5, 0x3D, 0xFF, 0xFC, 0x62,
     0x65, 0x6C, 0x7F, 0x99, 0x30, 0x7F, 0x99, 0x30, 0xE2, 0x00, 0x91, 0x63, 0x73, 0x7F, 0x99, 0x27,
     0x7F, 0x99, 0x27, 0x6E, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x6B, 0x6C, 0x6D, 0x6E, 0x72,
     0x73, 0x74, 0x7F, 0xB3, 0x9E, 0x7F, 0x99, 0x16, 0x7F, 0xFF, 0xEC, 0x7F, 0x9A, 0xDE, 0x7F, 0xA0,
@@ -1732,9 +1732,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x06, 0x7F, 0xB1, 0x8B, 0x65, 0x62, 0x65, 0x66, 0x68, 0x73, 0x7F, 0x99, 0xBD, 0x7F, 0x97, 0xF5,
     0x7F, 0x97, 0xF5, 0x7F, 0xB1, 0xDD, 0x7F, 0xA2, 0x37, 0x62, 0x6B, 0x74, 0x7F, 0x98, 0x19, 0x7F,
     0xCE, 0xEB, 0xEE, 0x02, 0xF1, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6E, 0x6F,
-    0xC3, 0x72, 0x73, 0x7F, 0xFE, 0xC1, 0x7F, 0xFF, 0x0F, 0x7F, 0x98, 0x10, 0x7F, 0xFF, 0x4B, 0x7F,
+    0x72, 0x73, 0xC3, 0x7F, 0xFE, 0xC1, 0x7F, 0xFF, 0x0F, 0x7F, 0x98, 0x10, 0x7F, 0xFF, 0x4B, 0x7F,
     0x98, 0x10, 0x7F, 0xFF, 0x8B, 0x7F, 0xFF, 0xA0, 0x7F, 0xFF, 0xB9, 0x7F, 0xFF, 0xCA, 0x7F, 0xFF,
-    0xD1, 0x7F, 0xFF, 0xE2, 0x7F, 0xA0, 0xAB, 0x7F, 0x97, 0xDA, 0x7F, 0xFF, 0xF7, 0x43, 0x70, 0x72,
+    0xD1, 0x7F, 0xFF, 0xE2, 0x7F, 0x97, 0xDA, 0x7F, 0xFF, 0xF7, 0x7F, 0xA0, 0xAB, 0x43, 0x70, 0x72,
     0x73, 0xB1, 0x84, 0xB1, 0x84, 0xA2, 0xDC, 0x62, 0x65, 0x6F, 0x7F, 0x97, 0xFF, 0x7F, 0x97, 0xFF,
     0xC1, 0x00, 0x91, 0x2E, 0xB4, 0x7A, 0x63, 0x61, 0x74, 0x7A, 0x7F, 0x97, 0x83, 0x7F, 0xFF, 0xFA,
     0x7F, 0x97, 0x83, 0x41, 0x67, 0xC0, 0x61, 0x21, 0x6E, 0xFC, 0xE3, 0x00, 0x82, 0x68, 0x6B, 0x6E,
@@ -1908,10 +1908,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0x1C, 0x7F, 0xFF, 0x8E, 0x7F, 0x8D, 0x06, 0x7F, 0xFF, 0xAF, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF,
     0xE7, 0x7F, 0xA8, 0xC5, 0x7F, 0xFF, 0xFC, 0x7F, 0xA6, 0x7E, 0x42, 0x62, 0x73, 0xA7, 0x67, 0xA7,
     0x67, 0x43, 0x6D, 0x6E, 0x72, 0xFF, 0xF9, 0xB1, 0x42, 0xB3, 0xFA, 0x41, 0x70, 0xB9, 0xF9, 0xA1,
-    0x02, 0xF1, 0x65, 0xFC, 0xCE, 0x06, 0xF2, 0x61, 0xC3, 0x63, 0x64, 0x65, 0x69, 0x6B, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x7A, 0xFD, 0xCF, 0xFD, 0xEF, 0xFE, 0x06, 0xFE, 0x10, 0xFE, 0x52, 0xFE,
-    0x75, 0xA6, 0x3D, 0xFE, 0x92, 0xFE, 0xAD, 0xFE, 0xBA, 0xB2, 0xDB, 0xFF, 0xBF, 0xFF, 0xED, 0xFF,
-    0xFB, 0x61, 0x74, 0x7F, 0x90, 0x76, 0x21, 0x73, 0xFB, 0x62, 0x65, 0x6C, 0x7F, 0x92, 0x35, 0x7F,
+    0x02, 0xF1, 0x65, 0xFC, 0xCE, 0x06, 0xF2, 0x61, 0x63, 0x64, 0x65, 0x69, 0x6B, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x7A, 0xC3, 0xFD, 0xCF, 0xFE, 0x06, 0xFE, 0x10, 0xFE, 0x52, 0xFE, 0x75, 0xA6,
+    0x3D, 0xFE, 0x92, 0xFE, 0xAD, 0xFE, 0xBA, 0xB2, 0xDB, 0xFF, 0xBF, 0xFF, 0xED, 0xFF, 0xFB, 0xFD,
+    0xEF, 0x61, 0x74, 0x7F, 0x90, 0x76, 0x21, 0x73, 0xFB, 0x62, 0x65, 0x6C, 0x7F, 0x92, 0x35, 0x7F,
     0x8E, 0x20, 0x21, 0x68, 0xF7, 0xA1, 0x00, 0xB1, 0x63, 0xFD, 0x21, 0x73, 0xFB, 0x61, 0x6E, 0x7F,
     0x92, 0xFC, 0x41, 0x61, 0xCF, 0xA5, 0x61, 0x65, 0x7F, 0x95, 0x43, 0x41, 0xBC, 0xE0, 0x74, 0xE9,
     0x06, 0xF1, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x75, 0xC3, 0x7F, 0xFF, 0xD7, 0x7F, 0xA5,
@@ -1940,20 +1940,20 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x69, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x7F, 0xA4, 0xB0, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF8, 0x7F,
     0xB1, 0x39, 0x7F, 0xA4, 0x7A, 0x7F, 0xA4, 0xB0, 0x7F, 0xFF, 0xFB, 0x7F, 0x90, 0x24, 0x7F, 0xAB,
     0xF7, 0x41, 0x65, 0xB0, 0xAE, 0x21, 0x9F, 0xFC, 0x62, 0x61, 0x72, 0x7F, 0x8B, 0x41, 0x7F, 0xA4,
-    0x82, 0x6C, 0x62, 0x63, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0xC3, 0x74, 0x7F, 0x8B,
+    0x82, 0x6C, 0x62, 0x63, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xC3, 0x7F, 0x8B,
     0x38, 0x7F, 0xFE, 0xC4, 0x7F, 0xFE, 0xCC, 0x7F, 0xFE, 0xD5, 0x7F, 0xFE, 0xE0, 0x7F, 0xFE, 0xE7,
-    0x7F, 0xFE, 0xEB, 0x7F, 0xFF, 0x34, 0x7F, 0xFF, 0x6B, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xF4, 0x7F,
-    0xFF, 0xF7, 0x61, 0x73, 0x7F, 0x99, 0x91, 0xA1, 0x02, 0x61, 0x73, 0xFB, 0xC4, 0x06, 0xF1, 0x61,
+    0x7F, 0xFE, 0xEB, 0x7F, 0xFF, 0x34, 0x7F, 0xFF, 0x6B, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xF7, 0x7F,
+    0xFF, 0xF4, 0x61, 0x73, 0x7F, 0x99, 0x91, 0xA1, 0x02, 0x61, 0x73, 0xFB, 0xC4, 0x06, 0xF1, 0x61,
     0xC3, 0x65, 0x69, 0xFF, 0xFB, 0xAD, 0x73, 0xA4, 0x12, 0xA4, 0x12, 0x61, 0x6F, 0x7F, 0x8A, 0xBA,
     0x21, 0x74, 0xFB, 0x21, 0x75, 0xFD, 0xE1, 0x05, 0x11, 0x69, 0x7F, 0x8A, 0xE0, 0x41, 0x65, 0xF8,
     0xA8, 0xE5, 0x06, 0xA2, 0x61, 0x6F, 0x70, 0x73, 0x74, 0x7F, 0xFF, 0xF2, 0x7F, 0x8A, 0xD8, 0x7F,
     0xFF, 0xF5, 0x7F, 0x8A, 0xD8, 0x7F, 0xFF, 0xFC, 0xE2, 0x02, 0x61, 0x67, 0x6E, 0x7F, 0x8A, 0x54,
     0x7F, 0xA4, 0x39, 0xC2, 0x08, 0x62, 0x65, 0x75, 0xA3, 0xCB, 0xFF, 0xF5, 0xDA, 0x07, 0xB1, 0x61,
-    0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xEC, 0x8D, 0xED, 0x1E, 0xED, 0x69, 0xED,
-    0x81, 0xED, 0x9A, 0xF3, 0x69, 0xF3, 0xCE, 0xF3, 0xFE, 0xF4, 0x0A, 0xF5, 0x36, 0xF5, 0x72, 0xF5,
-    0x77, 0xF7, 0x53, 0xF7, 0x72, 0xF7, 0x7E, 0xF8, 0xB6, 0xF8, 0xF2, 0xA4, 0xC2, 0xFB, 0x0F, 0xFD,
-    0x78, 0xFD, 0xD3, 0xFF, 0x75, 0xA4, 0xC2, 0xFF, 0xB0, 0xFF, 0xD5, 0xFF, 0xF7, 0xC1, 0x00, 0xB1,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3, 0xEC, 0x8D, 0xED, 0x69, 0xED, 0x81, 0xED,
+    0x9A, 0xF3, 0x69, 0xF3, 0xCE, 0xF3, 0xFE, 0xF4, 0x0A, 0xF5, 0x36, 0xF5, 0x72, 0xF5, 0x77, 0xF7,
+    0x53, 0xF7, 0x72, 0xF7, 0x7E, 0xF8, 0xB6, 0xF8, 0xF2, 0xA4, 0xC2, 0xFB, 0x0F, 0xFD, 0x78, 0xFD,
+    0xD3, 0xFF, 0x75, 0xA4, 0xC2, 0xFF, 0xB0, 0xFF, 0xD5, 0xFF, 0xF7, 0xED, 0x1E, 0xC1, 0x00, 0xB1,
     0x6C, 0xA4, 0x74, 0xC1, 0x07, 0x71, 0x68, 0xA3, 0x8A, 0xE1, 0x00, 0x41, 0x73, 0x7F, 0x89, 0xE3,
     0xE1, 0x0B, 0x52, 0x6F, 0x7F, 0x8A, 0x43, 0x42, 0x62, 0x6D, 0xA4, 0x5A, 0xA4, 0x5A, 0x21, 0x61,
     0xF9, 0x61, 0x70, 0x7F, 0x9B, 0xA5, 0x64, 0x61, 0x6E, 0x72, 0x73, 0x7F, 0x8A, 0x33, 0x7F, 0x93,
@@ -1972,10 +1972,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x91, 0xE6, 0xC1, 0x0D, 0x02, 0x70, 0xA3, 0x7C, 0xC1, 0x05, 0x11, 0x73, 0xA2, 0x95, 0xC3, 0x07,
     0xB1, 0x65, 0x69, 0x6F, 0xDA, 0x0F, 0xFF, 0xFA, 0xA3, 0x73, 0x43, 0x68, 0x70, 0x74, 0xAE, 0xF5,
     0xA3, 0x64, 0xCC, 0xA3, 0xC3, 0x06, 0xF1, 0x2E, 0x61, 0x74, 0xA2, 0xF6, 0xC8, 0x05, 0xA2, 0xF6,
-    0x54, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6E, 0x6F,
-    0x72, 0x73, 0x74, 0x75, 0x7A, 0xFF, 0x85, 0xB4, 0x31, 0xA3, 0x4E, 0xA3, 0x4E, 0xFF, 0x8C, 0xA3,
-    0x4E, 0xA3, 0x4E, 0xFF, 0x92, 0xA4, 0x28, 0xA8, 0x33, 0xA3, 0x4E, 0xFF, 0x96, 0xFF, 0x9A, 0xFF,
-    0xB3, 0xFF, 0xD2, 0xFF, 0xDE, 0xFF, 0xEA, 0xFF, 0xF4, 0xA8, 0x33, 0xA3, 0x4E, 0xA0, 0x17, 0x44,
+    0x54, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6E, 0x6F, 0x72,
+    0x73, 0x74, 0x75, 0x7A, 0xC3, 0xFF, 0x85, 0xA3, 0x4E, 0xA3, 0x4E, 0xFF, 0x8C, 0xA3, 0x4E, 0xA3,
+    0x4E, 0xFF, 0x92, 0xA4, 0x28, 0xA8, 0x33, 0xA3, 0x4E, 0xFF, 0x96, 0xFF, 0x9A, 0xFF, 0xB3, 0xFF,
+    0xD2, 0xFF, 0xDE, 0xFF, 0xEA, 0xFF, 0xF4, 0xA8, 0x33, 0xA3, 0x4E, 0xB4, 0x31, 0xA0, 0x17, 0x44,
     0xA1, 0x07, 0x91, 0x69, 0xFD, 0xC1, 0x09, 0xB2, 0x6B, 0xA3, 0x0C, 0x43, 0x70, 0x72, 0x73, 0xA3,
     0x06, 0xCA, 0xCC, 0xA3, 0x06, 0xC1, 0x06, 0xF1, 0x65, 0xC8, 0x0C, 0x41, 0x6D, 0xA4, 0x0B, 0x41,
     0x65, 0xB7, 0xEC, 0x63, 0x61, 0x62, 0x6C, 0x7F, 0xFF, 0xF8, 0x7F, 0x8B, 0xDD, 0x7F, 0xFF, 0xFC,
@@ -2044,12 +2044,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0x65, 0x72, 0x7F, 0xFF, 0xF6, 0x7F, 0x8D, 0x7E, 0x7F, 0xFF, 0xFD, 0xC4, 0x00, 0xB1, 0x66,
     0x69, 0x74, 0x76, 0xDC, 0x39, 0x9E, 0xF5, 0x9F, 0x40, 0x9F, 0x40, 0x42, 0x73, 0x74, 0x9E, 0xE6,
     0x9E, 0xE6, 0xE1, 0x07, 0x91, 0x74, 0x7F, 0x85, 0xB8, 0x46, 0x65, 0x66, 0x68, 0x6E, 0x72, 0x74,
-    0x9F, 0x23, 0x9F, 0x23, 0x9F, 0x23, 0xFF, 0xE3, 0xFF, 0xF2, 0xFF, 0xF9, 0x59, 0x2E, 0x61, 0xC3,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0x77, 0x7A, 0x9E, 0xC2, 0xFC, 0x6D, 0xFC, 0xAF, 0x9E, 0xC2, 0x9E, 0xC2,
-    0x9E, 0xC2, 0xFD, 0xEE, 0x9E, 0xC2, 0xFE, 0x16, 0x9E, 0xC2, 0xFE, 0x49, 0x9E, 0xC2, 0x9E, 0xC2,
-    0xFE, 0x95, 0xFE, 0xAC, 0xFE, 0xC3, 0xFF, 0x0B, 0x9E, 0xC2, 0xFF, 0x78, 0xFF, 0xA2, 0xFF, 0xC1,
-    0xFF, 0xED, 0x9E, 0xC2, 0x9E, 0xC2, 0x9E, 0xC2, 0x63, 0x64, 0x73, 0x74, 0x7F, 0x9D, 0x76, 0x7F,
+    0x9F, 0x23, 0x9F, 0x23, 0x9F, 0x23, 0xFF, 0xE3, 0xFF, 0xF2, 0xFF, 0xF9, 0x59, 0x2E, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x7A, 0xC3, 0x9E, 0xC2, 0xFC, 0x6D, 0x9E, 0xC2, 0x9E, 0xC2, 0x9E, 0xC2,
+    0xFD, 0xEE, 0x9E, 0xC2, 0xFE, 0x16, 0x9E, 0xC2, 0xFE, 0x49, 0x9E, 0xC2, 0x9E, 0xC2, 0xFE, 0x95,
+    0xFE, 0xAC, 0xFE, 0xC3, 0xFF, 0x0B, 0x9E, 0xC2, 0xFF, 0x78, 0xFF, 0xA2, 0xFF, 0xC1, 0xFF, 0xED,
+    0x9E, 0xC2, 0x9E, 0xC2, 0x9E, 0xC2, 0xFC, 0xAF, 0x63, 0x64, 0x73, 0x74, 0x7F, 0x9D, 0x76, 0x7F,
     0x83, 0xF4, 0x7F, 0x9D, 0x76, 0x67, 0x61, 0x63, 0x65, 0x6C, 0x6E, 0x73, 0x74, 0x7F, 0x9D, 0x5F,
     0x7F, 0xA3, 0x4E, 0x7F, 0xAF, 0x50, 0x7F, 0x8A, 0x9D, 0x7F, 0xFF, 0xF3, 0x7F, 0xD1, 0xB2, 0x7F,
     0x9F, 0x43, 0xC1, 0x00, 0xB1, 0x64, 0x9D, 0xE8, 0x42, 0x2E, 0x65, 0x9D, 0xE2, 0x9D, 0xE2, 0xE9,
@@ -2081,12 +2081,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xDC, 0xA3, 0x2E, 0xFF, 0xF3, 0xC1, 0x06, 0xF1, 0x61, 0xA7, 0xFA, 0x43, 0x62, 0x73, 0x77, 0x9C,
     0xA6, 0xD9, 0xEA, 0x9C, 0xF1, 0x44, 0x61, 0x66, 0x69, 0x74, 0xD9, 0xE0, 0x9C, 0x9C, 0x9C, 0xE7,
     0x9C, 0xE7, 0xA0, 0x18, 0xA3, 0xC6, 0x18, 0x82, 0x65, 0x68, 0x6D, 0x6E, 0x70, 0x72, 0x9C, 0x89,
-    0xD9, 0xB0, 0xFF, 0xE6, 0xFF, 0xF0, 0xFF, 0xFD, 0xD9, 0xB0, 0xD9, 0x02, 0xF1, 0x2E, 0x61, 0xC3,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
-    0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0x9C, 0x74, 0xFE, 0x35, 0xFE, 0x5F, 0x9C, 0x74, 0x9C, 0x74,
-    0x9C, 0x74, 0xFF, 0x51, 0x9C, 0x74, 0x9C, 0x74, 0x9C, 0x74, 0xFF, 0x88, 0x9C, 0x74, 0x9C, 0x74,
-    0xD9, 0x9B, 0x9C, 0x74, 0xD9, 0x9B, 0xFF, 0x94, 0x9C, 0x74, 0xD9, 0x9B, 0xFF, 0xBF, 0xFF, 0xCB,
-    0xFF, 0xEB, 0x9C, 0x74, 0x9D, 0x4E, 0x9C, 0x74, 0x61, 0x65, 0x7F, 0x82, 0x6D, 0x62, 0x74, 0x76,
+    0xD9, 0xB0, 0xFF, 0xE6, 0xFF, 0xF0, 0xFF, 0xFD, 0xD9, 0xB0, 0xD9, 0x02, 0xF1, 0x2E, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x77, 0x79, 0x7A, 0xC3, 0x9C, 0x74, 0xFE, 0x35, 0x9C, 0x74, 0x9C, 0x74, 0x9C, 0x74,
+    0xFF, 0x51, 0x9C, 0x74, 0x9C, 0x74, 0x9C, 0x74, 0xFF, 0x88, 0x9C, 0x74, 0x9C, 0x74, 0xD9, 0x9B,
+    0x9C, 0x74, 0xD9, 0x9B, 0xFF, 0x94, 0x9C, 0x74, 0xD9, 0x9B, 0xFF, 0xBF, 0xFF, 0xCB, 0xFF, 0xEB,
+    0x9C, 0x74, 0x9D, 0x4E, 0x9C, 0x74, 0xFE, 0x5F, 0x61, 0x65, 0x7F, 0x82, 0x6D, 0x62, 0x74, 0x76,
     0x7F, 0x81, 0x9F, 0x7F, 0xFF, 0xFB, 0x63, 0x65, 0x6E, 0x70, 0x7F, 0xC4, 0xC1, 0x7F, 0xE4, 0x93,
     0x7F, 0x92, 0x03, 0xE2, 0x07, 0xB1, 0x63, 0x66, 0x7F, 0x8F, 0x95, 0x7F, 0x8D, 0x50, 0xE1, 0x18,
     0x82, 0x62, 0x7F, 0x81, 0xE5, 0xA4, 0x17, 0x22, 0x65, 0x69, 0x6F, 0x75, 0xD8, 0xE1, 0xEE, 0xF9,
@@ -2115,12 +2115,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0x80, 0x12, 0x7F, 0x99, 0xC3, 0x41, 0x69, 0xE4, 0x50, 0x62, 0x73, 0x74, 0x7F, 0xFF, 0xFC,
     0x7F, 0x7F, 0xFF, 0xE4, 0x09, 0x92, 0x61, 0x6C, 0x70, 0x73, 0x7F, 0x9A, 0x7B, 0x7F, 0x80, 0xBB,
     0x7F, 0xFF, 0xE4, 0x7F, 0xFF, 0xF7, 0x41, 0x6E, 0xBF, 0xC9, 0xC2, 0x07, 0xB1, 0x61, 0x62, 0xFF,
-    0xFC, 0x9E, 0xD3, 0x76, 0x61, 0xC3, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D,
-    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0x79, 0x7F, 0xF6, 0x3B, 0x7F, 0xF6, 0x72,
-    0x7F, 0xF6, 0x83, 0x7F, 0xF6, 0x8C, 0x7F, 0xF7, 0x0D, 0x7F, 0x99, 0xA9, 0x7F, 0x99, 0x51, 0x7F,
-    0xFB, 0x99, 0x7F, 0xFB, 0xF2, 0x7F, 0xFD, 0xE7, 0x7F, 0xFE, 0x62, 0x7F, 0xFE, 0x6D, 0x7F, 0xFF,
-    0x13, 0x7F, 0x9E, 0xBE, 0x7F, 0x9A, 0x5B, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x96, 0x7F, 0xFF, 0xB8,
-    0x7F, 0xFF, 0xE0, 0x7F, 0xEC, 0x71, 0x7F, 0x9A, 0x5B, 0x7F, 0xFF, 0xF7, 0xC1, 0x07, 0xA1, 0x6C,
+    0xFC, 0x9E, 0xD3, 0x76, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0x79, 0xC3, 0x7F, 0xF6, 0x3B, 0x7F, 0xF6, 0x83,
+    0x7F, 0xF6, 0x8C, 0x7F, 0xF7, 0x0D, 0x7F, 0x99, 0xA9, 0x7F, 0x99, 0x51, 0x7F, 0xFB, 0x99, 0x7F,
+    0xFB, 0xF2, 0x7F, 0xFD, 0xE7, 0x7F, 0xFE, 0x62, 0x7F, 0xFE, 0x6D, 0x7F, 0xFF, 0x13, 0x7F, 0x9E,
+    0xBE, 0x7F, 0x9A, 0x5B, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x96, 0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xE0,
+    0x7F, 0xEC, 0x71, 0x7F, 0x9A, 0x5B, 0x7F, 0xFF, 0xF7, 0x7F, 0xF6, 0x72, 0xC1, 0x07, 0xA1, 0x6C,
     0xDE, 0xBB, 0x62, 0x62, 0x6B, 0x7F, 0x9A, 0x8B, 0x7F, 0x9B, 0x0B, 0xC1, 0x02, 0xF1, 0x6E, 0xE3,
     0x28, 0xA0, 0x18, 0xD3, 0xA1, 0x00, 0x51, 0x74, 0xFD, 0x41, 0xBC, 0xB8, 0x6F, 0x64, 0x61, 0x65,
     0x75, 0xC3, 0x7F, 0x7F, 0xC9, 0x7F, 0x9A, 0xF0, 0x7F, 0xB8, 0x6B, 0x7F, 0xFF, 0xFC, 0xF0, 0x06,
@@ -2302,11 +2302,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFD, 0xE4, 0x69, 0x41, 0x65, 0xED, 0xA1, 0x21, 0x67, 0xFC, 0x21, 0x61, 0xFD, 0x22, 0x65, 0x72,
     0xEF, 0xFD, 0x62, 0x68, 0x6D, 0x7F, 0x8D, 0xEB, 0x7F, 0x80, 0x68, 0x61, 0x6B, 0x7F, 0x78, 0xD5,
     0x21, 0x63, 0xFB, 0x21, 0x65, 0xFD, 0x62, 0x2E, 0x76, 0x7F, 0x8F, 0xCD, 0x7F, 0x8F, 0xCD, 0x71,
-    0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77,
-    0x7A, 0x7F, 0xFE, 0xA4, 0x7F, 0xFE, 0xD5, 0x7F, 0xFE, 0xDE, 0x7F, 0xA9, 0xB4, 0x7F, 0xFF, 0x38,
-    0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x68, 0x7F, 0xFF, 0x8C, 0x7F, 0x74, 0x2D, 0x7F, 0xFF, 0x9D, 0x7F,
-    0xFF, 0xB1, 0x7F, 0x74, 0x2D, 0x7F, 0xDC, 0x4A, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF,
-    0xF4, 0x7F, 0xFF, 0xF7, 0x63, 0x67, 0x74, 0x7A, 0x7F, 0x73, 0xEB, 0x7F, 0x73, 0xEB, 0x7F, 0x73,
+    0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A,
+    0xC3, 0x7F, 0xFE, 0xA4, 0x7F, 0xFE, 0xDE, 0x7F, 0xA9, 0xB4, 0x7F, 0xFF, 0x38, 0x7F, 0xFF, 0x61,
+    0x7F, 0xFF, 0x68, 0x7F, 0xFF, 0x8C, 0x7F, 0x74, 0x2D, 0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xB1, 0x7F,
+    0x74, 0x2D, 0x7F, 0xDC, 0x4A, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF,
+    0xF7, 0x7F, 0xFE, 0xD5, 0x63, 0x67, 0x74, 0x7A, 0x7F, 0x73, 0xEB, 0x7F, 0x73, 0xEB, 0x7F, 0x73,
     0xEB, 0x67, 0x67, 0x68, 0x6B, 0x6D, 0x6E, 0x70, 0x75, 0x7F, 0x96, 0x53, 0x7F, 0x8D, 0xC0, 0x7F,
     0x8D, 0x7C, 0x7F, 0x7E, 0x1A, 0x7F, 0xFF, 0xF3, 0x7F, 0x8D, 0x7C, 0x7F, 0x8D, 0xC0, 0xA0, 0x06,
     0x22, 0x21, 0x66, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x68, 0xFD, 0x62, 0x6C, 0x6E, 0x7F, 0x8D, 0x9A,
@@ -2515,9 +2515,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x9A, 0x7F, 0xFF, 0xA5, 0x7F, 0xFF, 0xBB, 0x7F, 0x82, 0x2B, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xE1,
     0x7F, 0xFF, 0xF7, 0x7F, 0x80, 0x92, 0x7F, 0x80, 0x8F, 0x63, 0x6C, 0x73, 0x7A, 0x7F, 0x82, 0x04,
     0x7F, 0x82, 0xF0, 0x7F, 0x82, 0x04, 0x63, 0x6D, 0x6E, 0x72, 0x7F, 0xFF, 0xF3, 0x7F, 0x8B, 0x4D,
-    0x7F, 0xD7, 0xCD, 0xCD, 0x06, 0xF2, 0x61, 0xC3, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70,
-    0x73, 0x74, 0x75, 0xFD, 0x7D, 0xFD, 0xA7, 0xFD, 0xC4, 0xFE, 0x55, 0xFE, 0x8C, 0xFE, 0xA2, 0xFE,
-    0xC3, 0xFE, 0xD9, 0xFE, 0xED, 0xFF, 0x37, 0xCA, 0xA5, 0xFF, 0xBF, 0xFF, 0xF3, 0xE1, 0x09, 0x42,
+    0x7F, 0xD7, 0xCD, 0xCD, 0x06, 0xF2, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x73,
+    0x74, 0x75, 0xC3, 0xFD, 0x7D, 0xFD, 0xC4, 0xFE, 0x55, 0xFE, 0x8C, 0xFE, 0xA2, 0xFE, 0xC3, 0xFE,
+    0xD9, 0xFE, 0xED, 0xFF, 0x37, 0xCA, 0xA5, 0xFF, 0xBF, 0xFF, 0xF3, 0xFD, 0xA7, 0xE1, 0x09, 0x42,
     0x74, 0x7F, 0x67, 0x16, 0x64, 0x64, 0x6E, 0x73, 0x78, 0x7F, 0x67, 0x15, 0x7F, 0x7D, 0x03, 0x7F,
     0xFF, 0xF9, 0x7F, 0x88, 0xF0, 0x42, 0xA4, 0xB6, 0xC3, 0x21, 0xA9, 0xC6, 0x61, 0x72, 0x7F, 0x67,
     0x46, 0xE1, 0x02, 0x61, 0x74, 0x7F, 0x67, 0xE2, 0x68, 0x61, 0x63, 0x65, 0x6D, 0x6E, 0x70, 0x72,
@@ -2561,14 +2561,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0x6E, 0x7F, 0x73, 0x23, 0x21, 0x65, 0xFB, 0x63, 0x61, 0xC3, 0x65, 0x7F, 0x7E, 0xA9, 0x7F,
     0x89, 0x30, 0x7F, 0x7D, 0x9C, 0x62, 0x61, 0x6C, 0x7F, 0x7D, 0x8F, 0x7F, 0x7D, 0xFC, 0x66, 0x61,
     0x64, 0x67, 0x6C, 0x6F, 0x73, 0x7F, 0xFF, 0xD9, 0x7F, 0x78, 0x32, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF,
-    0xEA, 0x7F, 0xC2, 0x3E, 0x7F, 0xFF, 0xF7, 0xFA, 0x07, 0xB1, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65,
-    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
-    0x76, 0x77, 0x79, 0x7A, 0x7F, 0xE8, 0xC7, 0x7F, 0xE9, 0x9A, 0x7F, 0xE9, 0xA1, 0x7F, 0xE9, 0xB8,
-    0x7F, 0xE9, 0xFC, 0x7F, 0xF1, 0xE3, 0x7F, 0xF2, 0x30, 0x7F, 0xF2, 0x6B, 0x7F, 0xF2, 0x8B, 0x7F,
-    0xF4, 0xEF, 0x7F, 0x7E, 0x77, 0x7F, 0xF5, 0x31, 0x7F, 0xF5, 0x70, 0x7F, 0x82, 0xDA, 0x7F, 0xF5,
-    0x9A, 0x7F, 0xF7, 0x1E, 0x7F, 0xC3, 0xB1, 0x7F, 0x7E, 0x77, 0x7F, 0xFA, 0x44, 0x7F, 0xFD, 0x1C,
-    0x7F, 0xFD, 0xBA, 0x7F, 0xFF, 0x4D, 0x7F, 0xFF, 0x8A, 0x7F, 0xFF, 0xB9, 0x7F, 0xFF, 0xE7, 0x7F,
-    0x7E, 0xB3, 0x64, 0x65, 0x69, 0x6C, 0x72, 0x7F, 0x7D, 0x02, 0x7F, 0x7C, 0xFF, 0x7F, 0x7D, 0x02,
+    0xEA, 0x7F, 0xC2, 0x3E, 0x7F, 0xFF, 0xF7, 0xFA, 0x07, 0xB1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x79, 0x7A, 0xC3, 0x7F, 0xE8, 0xC7, 0x7F, 0xE9, 0xA1, 0x7F, 0xE9, 0xB8, 0x7F, 0xE9, 0xFC,
+    0x7F, 0xF1, 0xE3, 0x7F, 0xF2, 0x30, 0x7F, 0xF2, 0x6B, 0x7F, 0xF2, 0x8B, 0x7F, 0xF4, 0xEF, 0x7F,
+    0x7E, 0x77, 0x7F, 0xF5, 0x31, 0x7F, 0xF5, 0x70, 0x7F, 0x82, 0xDA, 0x7F, 0xF5, 0x9A, 0x7F, 0xF7,
+    0x1E, 0x7F, 0xC3, 0xB1, 0x7F, 0x7E, 0x77, 0x7F, 0xFA, 0x44, 0x7F, 0xFD, 0x1C, 0x7F, 0xFD, 0xBA,
+    0x7F, 0xFF, 0x4D, 0x7F, 0xFF, 0x8A, 0x7F, 0xFF, 0xB9, 0x7F, 0xFF, 0xE7, 0x7F, 0x7E, 0xB3, 0x7F,
+    0xE9, 0x9A, 0x64, 0x65, 0x69, 0x6C, 0x72, 0x7F, 0x7D, 0x02, 0x7F, 0x7C, 0xFF, 0x7F, 0x7D, 0x02,
     0x7F, 0x7D, 0x02, 0xC1, 0x06, 0xC1, 0x68, 0xA7, 0x3A, 0x62, 0x6C, 0x72, 0x7F, 0x8A, 0xD4, 0x7F,
     0x7C, 0xEB, 0x64, 0x61, 0x65, 0x69, 0x6C, 0x7F, 0x63, 0x6A, 0x7F, 0x7C, 0xE2, 0x7F, 0x7C, 0xE2,
     0x7F, 0x89, 0x7D, 0x65, 0x61, 0x64, 0x65, 0x67, 0x72, 0x7F, 0x7C, 0xD1, 0x7F, 0x7C, 0xCE, 0x7F,
@@ -2629,10 +2629,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0xF7, 0x7F, 0xAB, 0x7F, 0x66, 0x61, 0x65, 0x69, 0x70, 0x74, 0x75, 0x7F, 0xFF, 0x83,
     0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xAE, 0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xE7, 0x7F, 0x79, 0x5E, 0x63,
     0x65, 0x6E, 0x74, 0x7F, 0x7C, 0x46, 0x7F, 0x7C, 0x4A, 0x7F, 0x66, 0x4A, 0x6D, 0x2E, 0x61, 0x63,
-    0x65, 0x69, 0x6C, 0x6E, 0x6F, 0xC3, 0x72, 0x73, 0x75, 0x79, 0x7F, 0x7A, 0x42, 0x7F, 0xFE, 0x66,
+    0x65, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xC3, 0x7F, 0x7A, 0x42, 0x7F, 0xFE, 0x66,
     0x7F, 0x7A, 0x42, 0x7F, 0xFE, 0xDB, 0x7F, 0xFF, 0x01, 0x7F, 0xFF, 0x27, 0x7F, 0x73, 0xE4, 0x7F,
-    0xFF, 0x3C, 0x7F, 0xFF, 0x45, 0x7F, 0xFF, 0x4E, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF3, 0x7F, 0x64,
-    0x8B, 0x64, 0x62, 0x65, 0x6E, 0x75, 0x7F, 0x5F, 0x88, 0x7F, 0x5F, 0x88, 0x7F, 0x60, 0xF6, 0x7F,
+    0xFF, 0x3C, 0x7F, 0xFF, 0x4E, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF3, 0x7F, 0x64, 0x8B, 0x7F, 0xFF,
+    0x45, 0x64, 0x62, 0x65, 0x6E, 0x75, 0x7F, 0x5F, 0x88, 0x7F, 0x5F, 0x88, 0x7F, 0x60, 0xF6, 0x7F,
     0x6B, 0x93, 0x61, 0x66, 0x7F, 0x65, 0x6F, 0x62, 0xA4, 0xB6, 0x7F, 0x5F, 0x72, 0x7F, 0xFF, 0xFB,
     0x61, 0x69, 0x7F, 0x92, 0x33, 0x61, 0x68, 0x7F, 0x61, 0x14, 0x21, 0x61, 0xFB, 0x61, 0x69, 0x7F,
     0x87, 0x87, 0x64, 0x65, 0x66, 0x6F, 0x7A, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF8, 0x7F, 0x60, 0xFC,
@@ -2647,11 +2647,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x41, 0x61, 0xB8, 0xA0, 0x62, 0x68, 0x73, 0x7F, 0xFF, 0xFC, 0x7F,
     0x6A, 0x04, 0x21, 0x72, 0xF7, 0x62, 0x63, 0x67, 0x7F, 0x69, 0x73, 0x7F, 0x69, 0x73, 0x61, 0x64,
     0x7F, 0x69, 0x6A, 0x62, 0x69, 0x6E, 0x7F, 0xFF, 0xFB, 0x7F, 0x5E, 0xFC, 0x61, 0x69, 0x7F, 0x91,
-    0x11, 0x23, 0x61, 0x65, 0x74, 0xE4, 0xF2, 0xFB, 0x22, 0x65, 0x73, 0xDA, 0xF9, 0x6D, 0x61, 0xC3,
-    0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7F, 0xFF, 0x04, 0x7F, 0xFF,
-    0x1A, 0x7F, 0xFF, 0x46, 0x7F, 0xFF, 0x59, 0x7F, 0xFF, 0x60, 0x7F, 0x5E, 0x8C, 0x7F, 0x7B, 0xBB,
-    0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x8A, 0x7F, 0xFF, 0xB3, 0x7F, 0xFF, 0xFB, 0x7F, 0x6C, 0x9B, 0x7F,
-    0x5E, 0x8C, 0x61, 0x65, 0x7F, 0x61, 0x4E, 0x65, 0x66, 0x6B, 0x6D, 0x77, 0x7A, 0x7F, 0x7A, 0x2D,
+    0x11, 0x23, 0x61, 0x65, 0x74, 0xE4, 0xF2, 0xFB, 0x22, 0x65, 0x73, 0xDA, 0xF9, 0x6D, 0x61, 0x65,
+    0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0xC3, 0x7F, 0xFF, 0x04, 0x7F, 0xFF,
+    0x46, 0x7F, 0xFF, 0x59, 0x7F, 0xFF, 0x60, 0x7F, 0x5E, 0x8C, 0x7F, 0x7B, 0xBB, 0x7F, 0xFF, 0x72,
+    0x7F, 0xFF, 0x8A, 0x7F, 0xFF, 0xB3, 0x7F, 0xFF, 0xFB, 0x7F, 0x6C, 0x9B, 0x7F, 0x5E, 0x8C, 0x7F,
+    0xFF, 0x1A, 0x61, 0x65, 0x7F, 0x61, 0x4E, 0x65, 0x66, 0x6B, 0x6D, 0x77, 0x7A, 0x7F, 0x7A, 0x2D,
     0x7F, 0xFF, 0xFB, 0x7F, 0x92, 0xB4, 0x7F, 0x7B, 0xA6, 0x7F, 0x6A, 0x1C, 0x64, 0x66, 0x6E, 0x70,
     0x72, 0x7F, 0x79, 0x51, 0x7F, 0x5E, 0x76, 0x7F, 0x79, 0x51, 0x7F, 0xFF, 0xEB, 0xE1, 0x01, 0x31,
     0x70, 0x7F, 0x7A, 0x07, 0x65, 0x2E, 0x61, 0x65, 0x73, 0x7A, 0x7F, 0x79, 0x39, 0x7F, 0x8B, 0xA7,
@@ -2679,10 +2679,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x11, 0x65, 0x69, 0x7F, 0x5D, 0x35, 0x7F, 0xFF, 0xFC, 0x62, 0x65, 0x68, 0x7F, 0xFF, 0xF5, 0x7F,
     0x5D, 0x30, 0x64, 0x65, 0x66, 0x67, 0x6D, 0x7F, 0x63, 0x24, 0x7F, 0x5D, 0x27, 0x7F, 0x81, 0x21,
     0x7F, 0x76, 0x2F, 0xE1, 0x06, 0xC1, 0x62, 0x7F, 0x5D, 0x10, 0x21, 0xBC, 0xF9, 0x6D, 0x2E, 0x61,
-    0x64, 0x65, 0x69, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0xC3, 0x79, 0x7F, 0x77, 0x21, 0x7F, 0xFE,
+    0x64, 0x65, 0x69, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xC3, 0x7F, 0x77, 0x21, 0x7F, 0xFE,
     0xBE, 0x7F, 0x7E, 0x29, 0x7F, 0xFF, 0x38, 0x7F, 0xFF, 0x5E, 0x7F, 0xFF, 0x70, 0x7F, 0xFF, 0x7F,
-    0x7F, 0xFF, 0x90, 0x7F, 0xFF, 0xAC, 0x7F, 0xFF, 0xDC, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xFD, 0x7F,
-    0xD3, 0x2E, 0x63, 0x65, 0x6C, 0x73, 0x7F, 0x9F, 0x5A, 0x7F, 0x5C, 0xD7, 0x7F, 0x76, 0xEF, 0xE2,
+    0x7F, 0xFF, 0x90, 0x7F, 0xFF, 0xAC, 0x7F, 0xFF, 0xDC, 0x7F, 0xFF, 0xE5, 0x7F, 0xD3, 0x2E, 0x7F,
+    0xFF, 0xFD, 0x63, 0x65, 0x6C, 0x73, 0x7F, 0x9F, 0x5A, 0x7F, 0x5C, 0xD7, 0x7F, 0x76, 0xEF, 0xE2,
     0x07, 0xA1, 0x65, 0x6B, 0x7F, 0x75, 0xD5, 0x7F, 0x7E, 0xA5, 0x64, 0x65, 0x69, 0x72, 0x73, 0x7F,
     0x74, 0x17, 0x7F, 0x5C, 0x9D, 0x7F, 0x75, 0xCA, 0x7F, 0x65, 0xD1, 0xE1, 0x0D, 0x02, 0x73, 0x7F,
     0x5C, 0xA8, 0x64, 0x66, 0x6C, 0x6F, 0x73, 0x7F, 0x75, 0xBC, 0x7F, 0x5C, 0xA7, 0x7F, 0x76, 0xBF,
@@ -2704,10 +2704,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xB2, 0x61, 0xC3, 0x7F, 0x7E, 0x1E, 0x63, 0x62, 0x65, 0x68, 0x7F, 0x5B, 0x81, 0x7F, 0x85, 0x69,
     0x7F, 0x75, 0x1B, 0x62, 0x66, 0x73, 0x7F, 0x74, 0xAB, 0x7F, 0x75, 0xAE, 0x21, 0xB6, 0xF7, 0xE2,
     0x00, 0x51, 0x66, 0x6E, 0x7F, 0x75, 0x02, 0x7F, 0xB7, 0x60, 0x61, 0x75, 0x7F, 0x78, 0x00, 0xA1,
-    0x00, 0x51, 0x65, 0xFB, 0x6D, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6D, 0x6F, 0xC3, 0x73,
-    0x75, 0x7A, 0x7F, 0xFF, 0x7B, 0x7F, 0xFF, 0x91, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xB6, 0x7F, 0xFF,
-    0xBB, 0x7F, 0x74, 0x7D, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xCD, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xE8,
-    0x7F, 0x69, 0x14, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFB, 0xE6, 0x0D, 0x02, 0x65, 0x68, 0x6B, 0x6C,
+    0x00, 0x51, 0x65, 0xFB, 0x6D, 0x61, 0x62, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6D, 0x6F, 0x73, 0x75,
+    0x7A, 0xC3, 0x7F, 0xFF, 0x7B, 0x7F, 0xFF, 0x91, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xB6, 0x7F, 0xFF,
+    0xBB, 0x7F, 0x74, 0x7D, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xCD, 0x7F, 0xFF, 0xD2, 0x7F, 0x69, 0x14,
+    0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFB, 0x7F, 0xFF, 0xE8, 0xE6, 0x0D, 0x02, 0x65, 0x68, 0x6B, 0x6C,
     0x70, 0x73, 0x7F, 0x91, 0x3A, 0x7F, 0x75, 0x58, 0x7F, 0x5F, 0xF5, 0x7F, 0x75, 0x58, 0x7F, 0x75,
     0x58, 0x7F, 0xCF, 0x25, 0x61, 0x74, 0x7F, 0x87, 0xE0, 0xE1, 0x05, 0x11, 0x6F, 0x7F, 0x74, 0x98,
     0x65, 0x61, 0x65, 0x68, 0x69, 0x72, 0x7F, 0xFF, 0xF4, 0x7F, 0x99, 0xA8, 0x7F, 0x74, 0x24, 0x7F,
@@ -2742,10 +2742,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0xF7, 0x61, 0x6E, 0x7F, 0x6B, 0x36, 0x61, 0x6B, 0x7F, 0x5E, 0x86, 0x21, 0x72, 0xFB,
     0x62, 0x69, 0x6F, 0x7F, 0x72, 0xB1, 0x7F, 0x72, 0xB1, 0x65, 0x61, 0x65, 0x6F, 0x72, 0x73, 0x7F,
     0xFF, 0xEA, 0x7F, 0xFF, 0xF4, 0x7F, 0x93, 0x1E, 0x7F, 0xFF, 0xF7, 0x7F, 0x59, 0x30, 0x61, 0x6D,
-    0x7F, 0x84, 0x17, 0xEC, 0x06, 0xB1, 0x61, 0xC3, 0x65, 0x66, 0x69, 0x6A, 0x6C, 0x6F, 0x72, 0x73,
-    0x74, 0x75, 0x7F, 0xFE, 0x8F, 0x7F, 0xFE, 0xBF, 0x7F, 0xFF, 0x18, 0x7F, 0xFF, 0x52, 0x7F, 0xFF,
-    0x62, 0x7F, 0x72, 0x1E, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x81, 0x7F, 0xFF, 0xA7, 0x7F, 0xFF, 0xC3,
-    0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xFB, 0x62, 0x61, 0x69, 0x7F, 0x58, 0xE0, 0x7F, 0x60, 0xC8, 0x64,
+    0x7F, 0x84, 0x17, 0xEC, 0x06, 0xB1, 0x61, 0x65, 0x66, 0x69, 0x6A, 0x6C, 0x6F, 0x72, 0x73, 0x74,
+    0x75, 0xC3, 0x7F, 0xFE, 0x8F, 0x7F, 0xFF, 0x18, 0x7F, 0xFF, 0x52, 0x7F, 0xFF, 0x62, 0x7F, 0x72,
+    0x1E, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x81, 0x7F, 0xFF, 0xA7, 0x7F, 0xFF, 0xC3, 0x7F, 0xFF, 0xE6,
+    0x7F, 0xFF, 0xFB, 0x7F, 0xFE, 0xBF, 0x62, 0x61, 0x69, 0x7F, 0x58, 0xE0, 0x7F, 0x60, 0xC8, 0x64,
     0x62, 0x6C, 0x6D, 0x73, 0x7F, 0x5F, 0x09, 0x7F, 0xFF, 0xF7, 0x7F, 0x58, 0xDA, 0x7F, 0x59, 0xC8,
     0x61, 0x68, 0x7F, 0x71, 0xD4, 0x21, 0xA4, 0xFB, 0x62, 0x73, 0x74, 0x7F, 0x58, 0x5A, 0x7F, 0x58,
     0x5A, 0x21, 0x6E, 0xF7, 0x62, 0x63, 0x75, 0x7F, 0x59, 0x1B, 0x7F, 0x59, 0x1B, 0x61, 0x72, 0x7F,
@@ -2765,10 +2765,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x71, 0x11, 0x7F, 0x79, 0xCA, 0x61, 0x61, 0x7F, 0x68, 0xF8, 0x21, 0x72, 0xFB, 0x21, 0x65, 0xFD,
     0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x61, 0xC3, 0x7F, 0x85, 0x7F, 0x66, 0x61, 0x63, 0x65, 0x67,
     0x70, 0x74, 0x7F, 0xFF, 0xE1, 0x7F, 0x57, 0xBE, 0x7F, 0x5D, 0xED, 0x7F, 0xFF, 0xF8, 0x7F, 0x73,
-    0x54, 0x7F, 0xFF, 0xFB, 0xED, 0x06, 0xF1, 0x61, 0xC3, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6E, 0x6F,
-    0x72, 0x73, 0x75, 0x79, 0x7F, 0xFE, 0xCB, 0x7F, 0xFE, 0xE1, 0x7F, 0x57, 0xA5, 0x7F, 0xFF, 0x90,
-    0x7F, 0x6F, 0xA0, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xAE, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xBB, 0x7F,
-    0xFF, 0xC5, 0x7F, 0xFF, 0xE7, 0x7F, 0x6E, 0xB1, 0x7F, 0x70, 0xAD, 0x62, 0x61, 0x6C, 0x7F, 0x71,
+    0x54, 0x7F, 0xFF, 0xFB, 0xED, 0x06, 0xF1, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x72,
+    0x73, 0x75, 0x79, 0xC3, 0x7F, 0xFE, 0xCB, 0x7F, 0x57, 0xA5, 0x7F, 0xFF, 0x90, 0x7F, 0x6F, 0xA0,
+    0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xAE, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xBB, 0x7F, 0xFF, 0xC5, 0x7F,
+    0xFF, 0xE7, 0x7F, 0x6E, 0xB1, 0x7F, 0x70, 0xAD, 0x7F, 0xFE, 0xE1, 0x62, 0x61, 0x6C, 0x7F, 0x71,
     0x86, 0x7F, 0x56, 0xFE, 0x61, 0x74, 0x7F, 0x5A, 0x39, 0x63, 0x73, 0x74, 0x7A, 0x7F, 0x72, 0xF0,
     0x7F, 0x72, 0xF0, 0x7F, 0x71, 0x78, 0x61, 0x70, 0x7F, 0x72, 0xE3, 0x62, 0x77, 0x7A, 0x7F, 0x72,
     0x0F, 0x7F, 0x72, 0x0F, 0x62, 0x67, 0x73, 0x7F, 0x71, 0x5D, 0x7F, 0xFF, 0xF7, 0xE6, 0x06, 0xB1,
@@ -2818,10 +2818,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x74, 0x7F, 0x6E, 0xA6, 0x7F, 0x6E, 0xA6, 0x7F, 0xFF, 0xED, 0x61, 0x65, 0x7F, 0x81, 0x29, 0xE2,
     0x06, 0xF1, 0x61, 0x68, 0x7F, 0x7A, 0x20, 0x7F, 0xFF, 0xFB, 0x62, 0x66, 0x69, 0x7F, 0x6E, 0x87,
     0x7F, 0x6F, 0x13, 0xE2, 0x06, 0xB1, 0x6E, 0x73, 0x7F, 0xFF, 0xF7, 0x7F, 0x55, 0xC1, 0x6E, 0x61,
-    0xC3, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7F, 0xFD, 0x1F,
-    0x7F, 0xFD, 0x4A, 0x7F, 0xFD, 0xC1, 0x7F, 0xFD, 0xF6, 0x7F, 0xFE, 0x67, 0x7F, 0xFE, 0xA2, 0x7F,
-    0xFE, 0xC7, 0x7F, 0xFE, 0xDF, 0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xCD, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF,
-    0xF5, 0x7F, 0x6E, 0x73, 0x7F, 0x6D, 0xBE, 0x62, 0x65, 0x6B, 0x7F, 0x9E, 0xF6, 0x7F, 0x6D, 0x9A,
+    0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0xC3, 0x7F, 0xFD, 0x1F,
+    0x7F, 0xFD, 0xC1, 0x7F, 0xFD, 0xF6, 0x7F, 0xFE, 0x67, 0x7F, 0xFE, 0xA2, 0x7F, 0xFE, 0xC7, 0x7F,
+    0xFE, 0xDF, 0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xCD, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xF5, 0x7F, 0x6E,
+    0x73, 0x7F, 0x6D, 0xBE, 0x7F, 0xFD, 0x4A, 0x62, 0x65, 0x6B, 0x7F, 0x9E, 0xF6, 0x7F, 0x6D, 0x9A,
     0x61, 0x6C, 0x7F, 0x8B, 0x04, 0x63, 0x65, 0x6C, 0x72, 0x7F, 0x54, 0x0E, 0x7F, 0x81, 0xBB, 0x7F,
     0xFF, 0xFB, 0x62, 0x61, 0x69, 0x7F, 0x6D, 0x85, 0x7F, 0x6D, 0x3B, 0x61, 0x75, 0x7F, 0x6D, 0x79,
     0x63, 0x61, 0x65, 0x6F, 0x7F, 0xFF, 0xFB, 0x7F, 0x75, 0x1A, 0x7F, 0x78, 0xF5, 0x61, 0x74, 0x7F,
@@ -2886,10 +2886,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0x54, 0x73, 0x7F, 0x6B, 0x79, 0x62, 0x61, 0x69, 0x7F, 0x8A, 0x3E, 0x7F, 0xFF, 0xF7, 0xE1,
     0x00, 0x91, 0x63, 0x7F, 0x4F, 0xD0, 0x23, 0x65, 0x72, 0x73, 0xDE, 0xF0, 0xF9, 0x62, 0x72, 0x73,
     0x7F, 0x6A, 0xD0, 0x7F, 0x50, 0x29, 0x21, 0x65, 0xF7, 0x61, 0x73, 0x7F, 0x51, 0x78, 0x70, 0x61,
-    0xC3, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x7F,
-    0xFE, 0x93, 0x7F, 0x78, 0x65, 0x7F, 0xFE, 0xC5, 0x7F, 0xFF, 0x0E, 0x7F, 0xFF, 0x3B, 0x7F, 0xFF,
-    0x50, 0x7F, 0xFF, 0x5B, 0x7F, 0xFF, 0x60, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x8A,
-    0x7F, 0xFF, 0xA8, 0x7F, 0xFF, 0xE8, 0x7F, 0x6A, 0x30, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFB, 0xE3,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xC3, 0x7F,
+    0xFE, 0x93, 0x7F, 0xFE, 0xC5, 0x7F, 0xFF, 0x0E, 0x7F, 0xFF, 0x3B, 0x7F, 0xFF, 0x50, 0x7F, 0xFF,
+    0x5B, 0x7F, 0xFF, 0x60, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x8A, 0x7F, 0xFF, 0xA8,
+    0x7F, 0xFF, 0xE8, 0x7F, 0x6A, 0x30, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFB, 0x7F, 0x78, 0x65, 0xE3,
     0x07, 0xA1, 0x62, 0x70, 0x73, 0x7F, 0x4F, 0xDA, 0x7F, 0x4F, 0xDA, 0x7F, 0x4F, 0xDA, 0xE1, 0x0A,
     0x02, 0x66, 0x7F, 0x4F, 0xCB, 0xE3, 0x06, 0xF1, 0x63, 0x72, 0x75, 0x7F, 0x4F, 0xC4, 0x7F, 0x68,
     0xD9, 0x7F, 0x69, 0xDC, 0x63, 0x65, 0x74, 0x7A, 0x7F, 0x4F, 0x4B, 0x7F, 0x69, 0x30, 0x7F, 0x4F,
@@ -2922,12 +2922,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xBC, 0x7F, 0x67, 0x60, 0x7F, 0xFF, 0xD9, 0x7F, 0x54, 0x4E, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF2,
     0x7F, 0x97, 0x2C, 0x7F, 0xFF, 0xF7, 0x7F, 0x57, 0x31, 0x61, 0x69, 0x7F, 0x70, 0x25, 0x63, 0x66,
     0x73, 0x74, 0x7F, 0x67, 0x66, 0x7F, 0x67, 0x66, 0x7F, 0x67, 0x66, 0x21, 0x6E, 0xF3, 0x63, 0x61,
-    0x65, 0x69, 0x7F, 0x73, 0x41, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFD, 0x73, 0x61, 0xC3, 0x62, 0x63,
-    0x64, 0x65, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x7A, 0x7F,
-    0xA5, 0x5C, 0x7F, 0x78, 0xC6, 0x7F, 0xF9, 0xE7, 0x7F, 0xFA, 0x0D, 0x7F, 0xFA, 0x59, 0x7F, 0xFA,
-    0x8D, 0x7F, 0xFA, 0xB9, 0x7F, 0xFB, 0x0D, 0x7F, 0xFB, 0x4E, 0x7F, 0xFB, 0xB3, 0x7F, 0xFC, 0x29,
-    0x7F, 0xFD, 0xB3, 0x7F, 0xFD, 0xF4, 0x7F, 0xFE, 0x03, 0x7F, 0xFE, 0x0A, 0x7F, 0xFE, 0xFC, 0x7F,
-    0xFF, 0xAF, 0x7F, 0x67, 0xE3, 0x7F, 0xFF, 0xF3, 0x61, 0x6B, 0x7F, 0x66, 0x89, 0x62, 0x61, 0x75,
+    0x65, 0x69, 0x7F, 0x73, 0x41, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFD, 0x73, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x7A, 0xC3, 0x7F,
+    0xA5, 0x5C, 0x7F, 0xF9, 0xE7, 0x7F, 0xFA, 0x0D, 0x7F, 0xFA, 0x59, 0x7F, 0xFA, 0x8D, 0x7F, 0xFA,
+    0xB9, 0x7F, 0xFB, 0x0D, 0x7F, 0xFB, 0x4E, 0x7F, 0xFB, 0xB3, 0x7F, 0xFC, 0x29, 0x7F, 0xFD, 0xB3,
+    0x7F, 0xFD, 0xF4, 0x7F, 0xFE, 0x03, 0x7F, 0xFE, 0x0A, 0x7F, 0xFE, 0xFC, 0x7F, 0xFF, 0xAF, 0x7F,
+    0x67, 0xE3, 0x7F, 0xFF, 0xF3, 0x7F, 0x78, 0xC6, 0x61, 0x6B, 0x7F, 0x66, 0x89, 0x62, 0x61, 0x75,
     0x7F, 0xFF, 0xFB, 0x7F, 0x68, 0x4F, 0x61, 0x7A, 0x7F, 0x4D, 0xF4, 0x21, 0x6E, 0xFB, 0x21, 0x65,
     0xFD, 0x61, 0x6F, 0x7F, 0x73, 0xE5, 0xE3, 0x06, 0xF1, 0x64, 0x6C, 0x72, 0x7F, 0xFF, 0xF8, 0x7F,
     0xFF, 0xFB, 0x7F, 0x66, 0x97, 0x62, 0xA4, 0xBC, 0x7F, 0x66, 0x5F, 0x7F, 0xF0, 0x3E, 0xE1, 0x06,
@@ -2941,11 +2941,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0xDE, 0x7F, 0x66, 0x1D, 0x7F, 0xFF, 0xE3, 0x62, 0x73, 0x74, 0x7F, 0x66, 0x4B, 0x7F,
     0x4C, 0x66, 0x21, 0x6E, 0xF7, 0xE7, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x7F,
     0xFF, 0xA4, 0x7F, 0x75, 0x0E, 0x7F, 0xFF, 0xDB, 0x7F, 0x65, 0xCF, 0x7F, 0xFF, 0xFD, 0x7F, 0x8D,
-    0x8A, 0x7F, 0x74, 0x08, 0xE1, 0x08, 0x62, 0x65, 0x7F, 0x52, 0xA2, 0x6E, 0x61, 0xC3, 0x64, 0x65,
-    0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0x7F, 0xFF, 0x3B, 0x7F, 0xFF, 0x4A,
-    0x7F, 0x67, 0x8D, 0x7F, 0xFF, 0x53, 0x7F, 0x66, 0x01, 0x7F, 0x66, 0x13, 0x7F, 0x65, 0xA9, 0x7F,
-    0xFF, 0x61, 0x7F, 0x66, 0xEF, 0x7F, 0xFF, 0x6A, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF9, 0x7F, 0x6E,
-    0x79, 0x7F, 0x67, 0x8D, 0x67, 0x62, 0x65, 0x69, 0x6B, 0x6C, 0x72, 0x75, 0x7F, 0x66, 0x7D, 0x7F,
+    0x8A, 0x7F, 0x74, 0x08, 0xE1, 0x08, 0x62, 0x65, 0x7F, 0x52, 0xA2, 0x6E, 0x61, 0x64, 0x65, 0x69,
+    0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3, 0x7F, 0xFF, 0x3B, 0x7F, 0x67, 0x8D,
+    0x7F, 0xFF, 0x53, 0x7F, 0x66, 0x01, 0x7F, 0x66, 0x13, 0x7F, 0x65, 0xA9, 0x7F, 0xFF, 0x61, 0x7F,
+    0x66, 0xEF, 0x7F, 0xFF, 0x6A, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF9, 0x7F, 0x6E, 0x79, 0x7F, 0x67,
+    0x8D, 0x7F, 0xFF, 0x4A, 0x67, 0x62, 0x65, 0x69, 0x6B, 0x6C, 0x72, 0x75, 0x7F, 0x66, 0x7D, 0x7F,
     0x4C, 0xAB, 0x7F, 0x65, 0x7A, 0x7F, 0x67, 0x09, 0x7F, 0x66, 0x7D, 0x7F, 0x4C, 0x62, 0x7F, 0x66,
     0x7D, 0x62, 0x61, 0x64, 0x7F, 0x66, 0xEC, 0x7F, 0x66, 0x60, 0x61, 0x6F, 0x7F, 0x66, 0xE3, 0xE1,
     0x09, 0x32, 0x65, 0x7F, 0x65, 0x4F, 0x64, 0x61, 0x62, 0x65, 0x6D, 0x7F, 0x67, 0xC3, 0x7F, 0x66,
@@ -2994,10 +2994,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x49, 0xFC, 0x7F, 0x49, 0xFC, 0x21, 0x6E, 0xF7, 0x61, 0xA4, 0x7F, 0x77, 0xE3, 0x21, 0xC3, 0xFB,
     0x61, 0x69, 0x7F, 0x66, 0x60, 0xA1, 0x05, 0x11, 0x65, 0xFB, 0x62, 0x61, 0xC3, 0x7F, 0x66, 0x59,
     0x7F, 0xE1, 0x4A, 0xEF, 0x07, 0x91, 0x2E, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F,
-    0xC3, 0x72, 0x73, 0x77, 0x7A, 0x7F, 0x65, 0xE7, 0x7F, 0x49, 0x2F, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF,
+    0x72, 0x73, 0x77, 0x7A, 0xC3, 0x7F, 0x65, 0xE7, 0x7F, 0x49, 0x2F, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF,
     0xCC, 0x7F, 0x4C, 0x6D, 0x7F, 0xFF, 0xE2, 0x7F, 0x74, 0x1D, 0x7F, 0xFF, 0xEA, 0x7F, 0x77, 0xD9,
-    0x7F, 0x77, 0x55, 0x7F, 0x77, 0xDF, 0x7F, 0x64, 0x2A, 0x7F, 0x8C, 0x1B, 0x7F, 0xFF, 0xF2, 0x7F,
-    0xFF, 0xF7, 0x63, 0x70, 0x73, 0x74, 0x7F, 0x48, 0xF0, 0x7F, 0x63, 0x3F, 0x7F, 0x54, 0x81, 0x61,
+    0x7F, 0x77, 0x55, 0x7F, 0x64, 0x2A, 0x7F, 0x8C, 0x1B, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xF7, 0x7F,
+    0x77, 0xDF, 0x63, 0x70, 0x73, 0x74, 0x7F, 0x48, 0xF0, 0x7F, 0x63, 0x3F, 0x7F, 0x54, 0x81, 0x61,
     0x67, 0x7F, 0x82, 0x13, 0x63, 0x61, 0x69, 0x74, 0x7F, 0xFF, 0xFB, 0x7F, 0x80, 0x33, 0x7F, 0x55,
     0xE6, 0x62, 0x72, 0x74, 0x7F, 0x63, 0x20, 0x7F, 0x65, 0x89, 0xE4, 0x00, 0xB1, 0x2E, 0x65, 0x6B,
     0x74, 0x7F, 0x62, 0x14, 0x7F, 0x6B, 0xB9, 0x7F, 0x63, 0x17, 0x7F, 0x63, 0x17, 0x72, 0x2E, 0x61,
@@ -3047,11 +3047,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0x64, 0xF7, 0x7F, 0x61, 0xD9, 0x7F, 0xFF, 0xF1, 0x61, 0x61, 0x7F, 0x5F, 0x38, 0x62, 0x65,
     0x72, 0x7F, 0x80, 0x08, 0x7F, 0x5F, 0xA3, 0x61, 0xA4, 0x7F, 0x80, 0x10, 0x62, 0x69, 0x6E, 0x7F,
     0x47, 0x1B, 0x7F, 0x73, 0xC4, 0x64, 0x61, 0xC3, 0x65, 0x6F, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF2,
-    0x7F, 0xFF, 0xF7, 0x7F, 0x68, 0x35, 0x72, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69,
-    0x6B, 0x6C, 0x6D, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x7F, 0xFA, 0x5F, 0x7F, 0xFA, 0xB0, 0x7F,
-    0xFA, 0xE4, 0x7F, 0x64, 0xFD, 0x7F, 0xFB, 0x45, 0x7F, 0xFD, 0x17, 0x7F, 0xFD, 0x60, 0x7F, 0xFD,
-    0x71, 0x7F, 0xFD, 0xBC, 0x7F, 0xFD, 0xE4, 0x7F, 0xFE, 0x96, 0x7F, 0xFE, 0xB4, 0x7F, 0xFE, 0xDA,
-    0x7F, 0xFF, 0x0A, 0x7F, 0xFF, 0x9B, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xEF, 0x61,
+    0x7F, 0xFF, 0xF7, 0x7F, 0x68, 0x35, 0x72, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B,
+    0x6C, 0x6D, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F, 0xFA, 0x5F, 0x7F, 0xFA, 0xE4, 0x7F,
+    0x64, 0xFD, 0x7F, 0xFB, 0x45, 0x7F, 0xFD, 0x17, 0x7F, 0xFD, 0x60, 0x7F, 0xFD, 0x71, 0x7F, 0xFD,
+    0xBC, 0x7F, 0xFD, 0xE4, 0x7F, 0xFE, 0x96, 0x7F, 0xFE, 0xB4, 0x7F, 0xFE, 0xDA, 0x7F, 0xFF, 0x0A,
+    0x7F, 0xFF, 0x9B, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xEF, 0x7F, 0xFA, 0xB0, 0x61,
     0x72, 0x7F, 0x69, 0xD2, 0x62, 0x61, 0x6B, 0x7F, 0xFF, 0xFB, 0x7F, 0x61, 0x45, 0x69, 0x62, 0x66,
     0x6D, 0x6F, 0x70, 0x72, 0x73, 0x77, 0x7A, 0x7F, 0x60, 0x50, 0x7F, 0x60, 0x50, 0x7F, 0x61, 0x3C,
     0x7F, 0x6A, 0x56, 0x7F, 0x60, 0x50, 0x7F, 0x60, 0x50, 0x7F, 0x61, 0x3C, 0x7F, 0x60, 0x50, 0x7F,
@@ -3121,10 +3121,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0x41, 0x35, 0x62, 0x62, 0x65, 0x7F, 0x44, 0x9D, 0x7F, 0xFF, 0xF7, 0x61, 0xB6, 0x7F, 0x4D,
     0x28, 0x63, 0x2E, 0x61, 0x70, 0x7F, 0x5B, 0xEB, 0x7F, 0x65, 0xA0, 0x7F, 0x65, 0xA0, 0xE1, 0x05,
     0x11, 0x69, 0x7F, 0x5C, 0x1F, 0x70, 0x2E, 0x61, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E,
-    0x6F, 0xC3, 0x72, 0x73, 0x77, 0x7A, 0x7F, 0x67, 0x7C, 0x7F, 0x41, 0x04, 0x7F, 0x5D, 0x04, 0x7F,
+    0x6F, 0x72, 0x73, 0x77, 0x7A, 0xC3, 0x7F, 0x67, 0x7C, 0x7F, 0x41, 0x04, 0x7F, 0x5D, 0x04, 0x7F,
     0xFF, 0x93, 0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xAB, 0x7F, 0x5D, 0x04, 0x7F, 0xFF, 0xBA, 0x7F, 0xFF,
-    0xBF, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xE7, 0x7F, 0x5D, 0x04, 0x7F, 0xFF, 0xEC,
-    0x7F, 0xFF, 0xF9, 0x7F, 0x5D, 0x04, 0x62, 0x2E, 0x73, 0x7F, 0x5B, 0x96, 0x7F, 0x5B, 0x4B, 0x61,
+    0xBF, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xDE, 0x7F, 0x5D, 0x04, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF9,
+    0x7F, 0x5D, 0x04, 0x7F, 0xFF, 0xE7, 0x62, 0x2E, 0x73, 0x7F, 0x5B, 0x96, 0x7F, 0x5B, 0x4B, 0x61,
     0x68, 0x7F, 0x5C, 0xBA, 0x62, 0x6C, 0x74, 0x7F, 0x5B, 0x3D, 0x7F, 0x5B, 0x88, 0x61, 0x61, 0x7F,
     0x6F, 0xDB, 0xA0, 0x1E, 0x92, 0x70, 0x2E, 0x63, 0x66, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x71,
     0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0x7F, 0x5B, 0x29, 0x7F, 0xFE, 0xCE, 0x7F, 0xFE, 0xD7, 0x7F,
@@ -3203,12 +3203,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6E, 0x72, 0x7F, 0x3C, 0x58, 0x7F, 0xFF, 0xDB, 0x63, 0x6C, 0x6D, 0x73, 0x7F, 0x56, 0xD4, 0x7F,
     0x56, 0x22, 0x7F, 0x56, 0xD4, 0x67, 0xC3, 0x65, 0x66, 0x69, 0x6F, 0x75, 0x79, 0x7F, 0x8E, 0x4F,
     0x7F, 0xFF, 0xEA, 0x7F, 0x55, 0x98, 0x7F, 0xEA, 0xA8, 0x7F, 0x42, 0xAD, 0x7F, 0xB8, 0x6B, 0x7F,
-    0xFF, 0xF3, 0x74, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E,
-    0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x7F, 0xF8, 0xE8, 0x7F, 0xF9, 0x4F, 0x7F, 0xF9, 0x61,
-    0x7F, 0xF9, 0x64, 0x7F, 0xF9, 0xEE, 0x7F, 0xFB, 0x33, 0x7F, 0xFB, 0x7D, 0x7F, 0xFB, 0xDE, 0x7F,
-    0xFC, 0x00, 0x7F, 0xFC, 0x3A, 0x7F, 0xFC, 0xA2, 0x7F, 0xFC, 0xB7, 0x7F, 0xFC, 0xCB, 0x7F, 0xFD,
-    0x30, 0x7F, 0xFD, 0x6A, 0x7F, 0xFE, 0x45, 0x7F, 0xFF, 0x45, 0x7F, 0xFF, 0x8A, 0x7F, 0x55, 0xAA,
-    0x7F, 0xFF, 0xE3, 0xE3, 0x1E, 0xB2, 0x65, 0x6F, 0x72, 0x7F, 0x61, 0x5C, 0x7F, 0x54, 0xFE, 0x7F,
+    0xFF, 0xF3, 0x74, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F,
+    0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F, 0xF8, 0xE8, 0x7F, 0xF9, 0x61, 0x7F, 0xF9, 0x64,
+    0x7F, 0xF9, 0xEE, 0x7F, 0xFB, 0x33, 0x7F, 0xFB, 0x7D, 0x7F, 0xFB, 0xDE, 0x7F, 0xFC, 0x00, 0x7F,
+    0xFC, 0x3A, 0x7F, 0xFC, 0xA2, 0x7F, 0xFC, 0xB7, 0x7F, 0xFC, 0xCB, 0x7F, 0xFD, 0x30, 0x7F, 0xFD,
+    0x6A, 0x7F, 0xFE, 0x45, 0x7F, 0xFF, 0x45, 0x7F, 0xFF, 0x8A, 0x7F, 0x55, 0xAA, 0x7F, 0xFF, 0xE3,
+    0x7F, 0xF9, 0x4F, 0xE3, 0x1E, 0xB2, 0x65, 0x6F, 0x72, 0x7F, 0x61, 0x5C, 0x7F, 0x54, 0xFE, 0x7F,
     0x7E, 0xC1, 0xE1, 0x07, 0xA1, 0x68, 0x7F, 0x54, 0xFF, 0xE4, 0x06, 0xB2, 0x64, 0x6D, 0x6E, 0x72,
     0x7F, 0x7F, 0x34, 0x7F, 0x55, 0xF8, 0x7F, 0x55, 0xF8, 0x7F, 0x66, 0xDC, 0x61, 0x66, 0x7F, 0x54,
     0xE2, 0x61, 0x6B, 0x7F, 0x54, 0xDD, 0x62, 0x61, 0x79, 0x7F, 0x55, 0xDB, 0x7F, 0x5D, 0x9E, 0x61,
@@ -3268,11 +3268,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x38, 0x7F, 0x53, 0x13, 0x7F, 0x53, 0x13, 0xE6, 0x05, 0x11, 0x62, 0x63, 0x66, 0x6D, 0x70, 0x73,
     0x7F, 0x51, 0x77, 0x7F, 0x51, 0x77, 0x7F, 0xFF, 0xEC, 0x7F, 0x51, 0x77, 0x7F, 0x51, 0x77, 0x7F,
     0xFF, 0xF3, 0x76, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x72, 0x73, 0xC3, 0x74, 0x75, 0x76, 0x77, 0x78, 0x7F, 0xFE, 0x49, 0x7F, 0x6E, 0xAC, 0x7F,
+    0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0xC3, 0x7F, 0xFE, 0x49, 0x7F, 0x6E, 0xAC, 0x7F,
     0xFE, 0x62, 0x7F, 0xFE, 0x86, 0x7F, 0xFE, 0xA7, 0x7F, 0xFE, 0xAC, 0x7F, 0xFE, 0xB9, 0x7F, 0xFE,
     0xC2, 0x7F, 0xFE, 0xC7, 0x7F, 0xFE, 0xFA, 0x7F, 0xFF, 0x0F, 0x7F, 0xFF, 0x52, 0x7F, 0x51, 0x5C,
-    0x7F, 0xFF, 0x87, 0x7F, 0xFF, 0x92, 0x7F, 0xFF, 0xAC, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xC2, 0x7F,
-    0xFF, 0xE5, 0x7F, 0x6A, 0x3A, 0x7F, 0x51, 0x5C, 0x7F, 0x53, 0xD7, 0x62, 0x65, 0x7A, 0x7F, 0x46,
+    0x7F, 0xFF, 0x87, 0x7F, 0xFF, 0x92, 0x7F, 0xFF, 0xAC, 0x7F, 0xFF, 0xC2, 0x7F, 0xFF, 0xE5, 0x7F,
+    0x6A, 0x3A, 0x7F, 0x51, 0x5C, 0x7F, 0x53, 0xD7, 0x7F, 0xFF, 0xBD, 0x62, 0x65, 0x7A, 0x7F, 0x46,
     0x6F, 0x7F, 0x52, 0x06, 0xE8, 0x06, 0xB1, 0x62, 0x64, 0x66, 0x68, 0x6D, 0x70, 0x73, 0x74, 0x7F,
     0x51, 0xFD, 0x7F, 0x50, 0xFA, 0x7F, 0x51, 0xFD, 0x7F, 0x51, 0xFD, 0x7F, 0x64, 0xEB, 0x7F, 0x51,
     0xFD, 0x7F, 0x5B, 0xDF, 0x7F, 0xFF, 0xF7, 0x62, 0x2E, 0x63, 0x7F, 0x50, 0xD7, 0x7F, 0x38, 0xB3,
@@ -3399,12 +3399,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xC7, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x7F, 0x30, 0x54, 0x7F, 0x98, 0xB4, 0x7F, 0x92,
     0x30, 0x7F, 0x4A, 0x6C, 0x61, 0x65, 0x7F, 0x53, 0x07, 0x21, 0x6E, 0xFB, 0x21, 0x65, 0xFD, 0x61,
     0x62, 0x7F, 0x79, 0x16, 0x21, 0x72, 0xFB, 0x21, 0x65, 0xFD, 0x41, 0x72, 0x96, 0xDA, 0x63, 0x65,
-    0x74, 0x77, 0x7F, 0xFF, 0xFC, 0x7F, 0x4F, 0xF7, 0x7F, 0x31, 0xE1, 0x58, 0x61, 0xC3, 0x62, 0x63,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75,
-    0x76, 0x77, 0x79, 0x7A, 0xF7, 0xB7, 0xF8, 0x56, 0xF8, 0x86, 0xF8, 0xA7, 0xF8, 0xDF, 0xFA, 0xCA,
-    0xFB, 0x2B, 0xFB, 0x92, 0xFB, 0xA2, 0xFC, 0x76, 0xFC, 0xD1, 0xFC, 0xFB, 0xFD, 0x18, 0xFD, 0x69,
-    0xFE, 0x2F, 0xFE, 0x87, 0xFE, 0xAD, 0xFF, 0x0A, 0xFF, 0x63, 0xFF, 0xAA, 0xFF, 0xE1, 0xFF, 0xEC,
-    0xE9, 0xCE, 0xFF, 0xF3, 0x61, 0x7A, 0x7F, 0x53, 0xCD, 0x62, 0x6D, 0x72, 0x7F, 0x4B, 0x40, 0x7F,
+    0x74, 0x77, 0x7F, 0xFF, 0xFC, 0x7F, 0x4F, 0xF7, 0x7F, 0x31, 0xE1, 0x58, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x79, 0x7A, 0xC3, 0xF7, 0xB7, 0xF8, 0x86, 0xF8, 0xA7, 0xF8, 0xDF, 0xFA, 0xCA, 0xFB, 0x2B,
+    0xFB, 0x92, 0xFB, 0xA2, 0xFC, 0x76, 0xFC, 0xD1, 0xFC, 0xFB, 0xFD, 0x18, 0xFD, 0x69, 0xFE, 0x2F,
+    0xFE, 0x87, 0xFE, 0xAD, 0xFF, 0x0A, 0xFF, 0x63, 0xFF, 0xAA, 0xFF, 0xE1, 0xFF, 0xEC, 0xE9, 0xCE,
+    0xFF, 0xF3, 0xF8, 0x56, 0x61, 0x7A, 0x7F, 0x53, 0xCD, 0x62, 0x6D, 0x72, 0x7F, 0x4B, 0x40, 0x7F,
     0xFF, 0xFB, 0x62, 0x6C, 0x74, 0x7F, 0x4B, 0x37, 0x7F, 0x4B, 0x37, 0x62, 0x69, 0x74, 0x7F, 0x4B,
     0x2E, 0x7F, 0x33, 0x0C, 0x61, 0x64, 0x7F, 0x5C, 0x3F, 0x6B, 0x62, 0x64, 0x65, 0x6C, 0x6D, 0x6E,
     0x70, 0x72, 0x74, 0x76, 0x78, 0x7F, 0x56, 0x42, 0x7F, 0x4E, 0x44, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF,
@@ -3478,11 +3478,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6B, 0x7F, 0x45, 0x6B, 0x7F, 0x45, 0x6B, 0x67, 0x62, 0x68, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x7F,
     0x44, 0x57, 0x7F, 0x44, 0x57, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xE6, 0x7F, 0x44, 0x57, 0x7F, 0xFF,
     0xEF, 0x7F, 0x2B, 0x42, 0xE1, 0x02, 0xF1, 0x65, 0x7F, 0x45, 0x3D, 0x75, 0x61, 0x62, 0x63, 0x64,
-    0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0xC3, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79,
-    0x7A, 0x7F, 0xFB, 0x8E, 0x7F, 0xFB, 0xBF, 0x7F, 0xFB, 0xF5, 0x7F, 0x6D, 0x79, 0x7F, 0xFC, 0x50,
+    0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A,
+    0xC3, 0x7F, 0xFB, 0x8E, 0x7F, 0xFB, 0xBF, 0x7F, 0xFB, 0xF5, 0x7F, 0x6D, 0x79, 0x7F, 0xFC, 0x50,
     0x7F, 0x45, 0x36, 0x7F, 0xFC, 0x91, 0x7F, 0xFC, 0xBD, 0x7F, 0xFC, 0xD0, 0x7F, 0x8C, 0xFA, 0x7F,
-    0x45, 0x36, 0x7F, 0xFC, 0xEF, 0x7F, 0xFD, 0x08, 0x7F, 0xFD, 0x22, 0x7F, 0x9C, 0xA3, 0x7F, 0xFD,
-    0xB0, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0xDC, 0x7F, 0x45, 0x36, 0x7F, 0x44, 0x33, 0x7F, 0xFF, 0xF9,
+    0x45, 0x36, 0x7F, 0xFC, 0xEF, 0x7F, 0xFD, 0x22, 0x7F, 0x9C, 0xA3, 0x7F, 0xFD, 0xB0, 0x7F, 0xFF,
+    0x8C, 0x7F, 0xFF, 0xDC, 0x7F, 0x45, 0x36, 0x7F, 0x44, 0x33, 0x7F, 0xFF, 0xF9, 0x7F, 0xFD, 0x08,
     0x62, 0x62, 0x68, 0x7F, 0x2C, 0x21, 0x7F, 0x44, 0xE1, 0x61, 0x6C, 0x7F, 0x34, 0x75, 0x65, 0x61,
     0x68, 0x6A, 0x6F, 0x70, 0x7F, 0x2A, 0x4B, 0x7F, 0x45, 0x5F, 0x7F, 0x47, 0x3C, 0x7F, 0x44, 0xD3,
     0x7F, 0x45, 0x5F, 0x62, 0x62, 0x74, 0x7F, 0x46, 0x36, 0x7F, 0x44, 0xBE, 0x62, 0x66, 0x6B, 0x7F,
@@ -3528,10 +3528,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x3E, 0x7F, 0x50, 0xF6, 0x61, 0x77, 0x7F, 0x41, 0xA0, 0x67, 0x62, 0x64, 0x69, 0x6E, 0x72, 0x73,
     0x74, 0x7F, 0x41, 0x98, 0x7F, 0x41, 0x54, 0x7F, 0x4A, 0x55, 0x7F, 0x55, 0xC7, 0x7F, 0xFF, 0xFB,
     0x7F, 0x28, 0x69, 0x7F, 0x4A, 0x2E, 0xE5, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x6F, 0x77, 0x7F, 0x41,
-    0x0E, 0x7F, 0x55, 0x8E, 0x7F, 0xFF, 0xE3, 0x7F, 0x4A, 0x24, 0x7F, 0x41, 0x0E, 0x4C, 0x61, 0xC3,
-    0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xFD, 0x58, 0xFD, 0x81, 0xFE, 0x09,
-    0xFE, 0x3A, 0xFE, 0x7A, 0xFE, 0xB2, 0xFE, 0xD1, 0xFF, 0x0C, 0xFF, 0x92, 0xFF, 0xAB, 0xFF, 0xBE,
-    0xFF, 0xE9, 0x62, 0x65, 0x69, 0x7F, 0x41, 0x3F, 0x7F, 0x41, 0x3F, 0x21, 0x6C, 0xF7, 0x61, 0x72,
+    0x0E, 0x7F, 0x55, 0x8E, 0x7F, 0xFF, 0xE3, 0x7F, 0x4A, 0x24, 0x7F, 0x41, 0x0E, 0x4C, 0x61, 0x65,
+    0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0xFD, 0x58, 0xFE, 0x09, 0xFE, 0x3A,
+    0xFE, 0x7A, 0xFE, 0xB2, 0xFE, 0xD1, 0xFF, 0x0C, 0xFF, 0x92, 0xFF, 0xAB, 0xFF, 0xBE, 0xFF, 0xE9,
+    0xFD, 0x81, 0x62, 0x65, 0x69, 0x7F, 0x41, 0x3F, 0x7F, 0x41, 0x3F, 0x21, 0x6C, 0xF7, 0x61, 0x72,
     0x7F, 0x2E, 0xDE, 0x64, 0x61, 0x65, 0x6F, 0x72, 0x7F, 0x27, 0x7F, 0x7F, 0xFF, 0xFB, 0x7F, 0x27,
     0x7F, 0x7F, 0x2B, 0x0B, 0x21, 0x74, 0xEF, 0x21, 0x68, 0xFD, 0x61, 0x72, 0x7F, 0x28, 0x86, 0x62,
     0x65, 0x69, 0x7F, 0xFF, 0xFB, 0x7F, 0x27, 0x78, 0xE3, 0x00, 0xE1, 0x66, 0x67, 0x73, 0x7F, 0x2A,
@@ -3600,12 +3600,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x65, 0x6B, 0x7F, 0x23, 0x39, 0x7F, 0x3D, 0xC1, 0x63, 0x6E, 0x72, 0x73, 0x7F, 0x47, 0x96,
     0x7F, 0xFF, 0xF7, 0x7F, 0x24, 0xFB, 0xE1, 0x06, 0xC1, 0x68, 0x7F, 0x3C, 0xA8, 0xE5, 0x06, 0xF1,
     0x61, 0x65, 0x6F, 0x75, 0x77, 0x7F, 0x3C, 0xA1, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF9, 0x7F, 0x30,
-    0x75, 0x7F, 0x3C, 0x97, 0x5B, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A,
-    0xC1, 0x38, 0xC1, 0x93, 0xC3, 0x48, 0xC4, 0xFC, 0xC6, 0x69, 0xC8, 0x84, 0xCA, 0x5F, 0xCB, 0xD0,
-    0xCF, 0x1A, 0xD5, 0xA7, 0xD5, 0xF9, 0xD6, 0xD7, 0xDD, 0x72, 0xDF, 0x82, 0xE7, 0x2E, 0xE8, 0x30,
-    0xE9, 0x31, 0xE9, 0x74, 0xF3, 0x77, 0xF8, 0x57, 0xFB, 0x89, 0xFE, 0x39, 0xFE, 0xA8, 0xFF, 0x0C,
-    0xFF, 0x77, 0xFF, 0xB1, 0xFF, 0xE9, 0x61, 0x65, 0x7F, 0x4F, 0xDE, 0xEB, 0x00, 0xB1, 0x62, 0x65,
+    0x75, 0x7F, 0x3C, 0x97, 0x5B, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3,
+    0xC1, 0x38, 0xC3, 0x48, 0xC4, 0xFC, 0xC6, 0x69, 0xC8, 0x84, 0xCA, 0x5F, 0xCB, 0xD0, 0xCF, 0x1A,
+    0xD5, 0xA7, 0xD5, 0xF9, 0xD6, 0xD7, 0xDD, 0x72, 0xDF, 0x82, 0xE7, 0x2E, 0xE8, 0x30, 0xE9, 0x31,
+    0xE9, 0x74, 0xF3, 0x77, 0xF8, 0x57, 0xFB, 0x89, 0xFE, 0x39, 0xFE, 0xA8, 0xFF, 0x0C, 0xFF, 0x77,
+    0xFF, 0xB1, 0xFF, 0xE9, 0xC1, 0x93, 0x61, 0x65, 0x7F, 0x4F, 0xDE, 0xEB, 0x00, 0xB1, 0x62, 0x65,
     0x66, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x74, 0x77, 0x7A, 0x7F, 0x3D, 0xF1, 0x7F, 0x48, 0xE8, 0x7F,
     0x3D, 0x33, 0x7F, 0x3D, 0x33, 0x7F, 0xBD, 0x36, 0x7F, 0x3D, 0x33, 0x7F, 0xFF, 0xFB, 0x7F, 0x3D,
     0x33, 0x7F, 0x3D, 0xF1, 0x7F, 0x3D, 0x33, 0x7F, 0x3D, 0x33, 0x63, 0x67, 0x74, 0x7A, 0x7F, 0x4B,
@@ -3647,11 +3647,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0x9F, 0x7F, 0x39, 0xC4, 0xE2, 0x06, 0xB1, 0x6F, 0x74, 0x7F, 0x39, 0xBF, 0x7F, 0x3A, 0xC9,
     0x62, 0x62, 0x6C, 0x7F, 0x39, 0xBE, 0x7F, 0x39, 0xBE, 0x65, 0x65, 0x66, 0x67, 0x6C, 0x73, 0x7F,
     0x3A, 0xB5, 0x7F, 0x3A, 0xB5, 0x7F, 0x39, 0xB5, 0x7F, 0x3B, 0x44, 0x7F, 0xFF, 0xF7, 0xF1, 0x07,
-    0xB1, 0x62, 0x63, 0x64, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xC3, 0x74,
-    0x75, 0x76, 0x7F, 0xFD, 0x6D, 0x7F, 0xFD, 0xE9, 0x7F, 0xFE, 0x02, 0x7F, 0xFE, 0x46, 0x7F, 0xFE,
+    0xB1, 0x62, 0x63, 0x64, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0xC3, 0x7F, 0xFD, 0x6D, 0x7F, 0xFD, 0xE9, 0x7F, 0xFE, 0x02, 0x7F, 0xFE, 0x46, 0x7F, 0xFE,
     0x7A, 0x7F, 0xB1, 0x55, 0x7F, 0xFE, 0x7D, 0x7F, 0xFE, 0xD7, 0x7F, 0xFE, 0xF0, 0x7F, 0xFF, 0x33,
-    0x7F, 0xA4, 0xE9, 0x7F, 0xFF, 0xA0, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xD7, 0x7F,
-    0xFF, 0xEB, 0x7F, 0x3A, 0x3C, 0x61, 0x75, 0x7F, 0x21, 0x35, 0x21, 0x72, 0xFB, 0x62, 0x6D, 0x7A,
+    0x7F, 0xA4, 0xE9, 0x7F, 0xFF, 0xA0, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xEB, 0x7F,
+    0x3A, 0x3C, 0x7F, 0xFF, 0xD2, 0x61, 0x75, 0x7F, 0x21, 0x35, 0x21, 0x72, 0xFB, 0x62, 0x6D, 0x7A,
     0x7F, 0x3B, 0x0F, 0x7F, 0x3B, 0x0F, 0xE3, 0x12, 0x71, 0x6B, 0x73, 0x77, 0x7F, 0x20, 0x19, 0x7F,
     0x2A, 0x82, 0x7F, 0x20, 0x19, 0x21, 0x72, 0xF1, 0x21, 0x65, 0xFD, 0x21, 0x73, 0xFD, 0x61, 0x7A,
     0x7F, 0x3A, 0xEE, 0x61, 0x67, 0x7F, 0x3A, 0x2B, 0xEB, 0x07, 0xB1, 0x63, 0x66, 0x68, 0x6D, 0x71,
@@ -3701,10 +3701,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xFD, 0x7F, 0x1C, 0xF4, 0x7F, 0x39, 0xE1, 0x7F, 0x90, 0xF3, 0x7F, 0x38, 0x91, 0x62, 0x2E,
     0x6E, 0x7F, 0x43, 0x53, 0x7F, 0xA6, 0x2A, 0x66, 0x65, 0x66, 0x6C, 0x73, 0x77, 0x7A, 0x7F, 0xFF,
     0xF7, 0x7F, 0x38, 0x6C, 0x7F, 0xA6, 0x80, 0x7F, 0x38, 0x6C, 0x7F, 0x37, 0xA5, 0x7F, 0x37, 0xA5,
-    0x6E, 0x2E, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x7F,
-    0x37, 0xCD, 0x7F, 0xFF, 0x7D, 0x7F, 0x4A, 0xB4, 0x7F, 0xFF, 0x82, 0x7F, 0xFF, 0x9E, 0x7F, 0x26,
-    0x3B, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xB0, 0x7F, 0x1C, 0xBC, 0x7F, 0x1C, 0xBC, 0x7F, 0x3E, 0xF7,
-    0x7F, 0xFF, 0xC5, 0x7F, 0xFF, 0xE7, 0x7F, 0x36, 0x6A, 0x62, 0x74, 0x7A, 0x7F, 0x37, 0xB1, 0x7F,
+    0x6E, 0x2E, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0xC3, 0x7F,
+    0x37, 0xCD, 0x7F, 0xFF, 0x7D, 0x7F, 0xFF, 0x82, 0x7F, 0xFF, 0x9E, 0x7F, 0x26, 0x3B, 0x7F, 0xFF,
+    0xAB, 0x7F, 0xFF, 0xB0, 0x7F, 0x1C, 0xBC, 0x7F, 0x1C, 0xBC, 0x7F, 0x3E, 0xF7, 0x7F, 0xFF, 0xC5,
+    0x7F, 0xFF, 0xE7, 0x7F, 0x36, 0x6A, 0x7F, 0x4A, 0xB4, 0x62, 0x74, 0x7A, 0x7F, 0x37, 0xB1, 0x7F,
     0x1C, 0x86, 0x66, 0x62, 0x64, 0x65, 0x6C, 0x6E, 0x73, 0x7F, 0x1C, 0x77, 0x7F, 0x1E, 0x3F, 0x7F,
     0x1C, 0x77, 0x7F, 0x1C, 0x77, 0x7F, 0xFF, 0xF7, 0x7F, 0x1C, 0x77, 0x62, 0xA4, 0xB6, 0x7F, 0x36,
     0x0F, 0x7F, 0x1C, 0x5E, 0xE3, 0x01, 0x81, 0x2E, 0x6E, 0x73, 0x7F, 0x37, 0x28, 0x7F, 0x37, 0x28,
@@ -3720,10 +3720,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0x3A, 0x79, 0x7F, 0x1D, 0xE5, 0x61, 0x72, 0x7F, 0x24, 0x3E, 0x22, 0x61, 0x65, 0xF2, 0xFB,
     0x62, 0x65, 0x66, 0x7F, 0x1B, 0xA9, 0x7F, 0x1B, 0xA9, 0x61, 0x67, 0x7F, 0x23, 0x5C, 0xA1, 0x00,
     0x51, 0x65, 0xFB, 0x62, 0x6D, 0x70, 0x7F, 0x1D, 0x5E, 0x7F, 0x1B, 0xCF, 0x61, 0x70, 0x7F, 0x7F,
-    0x47, 0x6E, 0x2E, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x75,
-    0x7F, 0x36, 0x9C, 0x7F, 0xFF, 0x11, 0x7F, 0xFF, 0x2A, 0x7F, 0xFF, 0x42, 0x7F, 0xFF, 0x6B, 0x7F,
-    0xFF, 0x9F, 0x7F, 0x94, 0xDA, 0x7F, 0xFF, 0xAF, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF,
-    0xDF, 0x7F, 0xFF, 0xED, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x65, 0x62, 0x6B, 0x6C, 0x6E, 0x72,
+    0x47, 0x6E, 0x2E, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0xC3,
+    0x7F, 0x36, 0x9C, 0x7F, 0xFF, 0x11, 0x7F, 0xFF, 0x42, 0x7F, 0xFF, 0x6B, 0x7F, 0xFF, 0x9F, 0x7F,
+    0x94, 0xDA, 0x7F, 0xFF, 0xAF, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF,
+    0xED, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7F, 0xFF, 0x2A, 0x65, 0x62, 0x6B, 0x6C, 0x6E, 0x72,
     0x7F, 0x1E, 0x1A, 0x7F, 0x1E, 0xC6, 0x7F, 0x1E, 0xC6, 0x7F, 0x1E, 0xC6, 0x7F, 0x1E, 0xC6, 0x63,
     0x69, 0x6E, 0x72, 0x7F, 0x1E, 0xB1, 0x7F, 0x34, 0x0F, 0x7F, 0xC3, 0x33, 0xA0, 0x20, 0x44, 0x66,
     0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xF0, 0x7F, 0x1B, 0x97, 0x7F,
@@ -3849,10 +3849,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6E, 0x7F, 0x2D, 0x32, 0x7F, 0x2D, 0x32, 0xE1, 0x00, 0x41, 0x61, 0x7F, 0x17, 0x19, 0x62, 0x65,
     0x74, 0x7F, 0x2D, 0x20, 0x7F, 0xFF, 0xF9, 0x62, 0x2E, 0x73, 0x7F, 0x2D, 0x17, 0x7F, 0x2D, 0x17,
     0x63, 0x2E, 0x6D, 0x73, 0x7F, 0x2D, 0xAA, 0x7F, 0x2D, 0x0E, 0x7F, 0xC0, 0x64, 0x6F, 0x2E, 0x63,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0xC3, 0x74, 0x75, 0x7F, 0x2D, 0x01,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x75, 0xC3, 0x7F, 0x2D, 0x01,
     0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xB3, 0x7F, 0xFF, 0xBA, 0x7F, 0x2D, 0x01, 0x7F, 0xFF, 0xC3, 0x7F,
     0x2E, 0xBF, 0x7F, 0x2E, 0xBF, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xCF, 0x7F, 0x2E, 0xBF, 0x7F, 0xFF,
-    0xE1, 0x7F, 0xFD, 0xCD, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF3, 0x63, 0x64, 0x6E, 0x74, 0x7F, 0x2E,
+    0xE1, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF3, 0x7F, 0xFD, 0xCD, 0x63, 0x64, 0x6E, 0x74, 0x7F, 0x2E,
     0x82, 0x7F, 0x2C, 0xB7, 0x7F, 0x2E, 0x82, 0x62, 0x72, 0x74, 0x7F, 0x2C, 0xB7, 0x7F, 0x13, 0xEB,
     0x62, 0x68, 0x73, 0x7F, 0xFF, 0xF7, 0x7F, 0x2C, 0xAE, 0x22, 0xA4, 0xBC, 0xE1, 0xF7, 0x41, 0x68,
     0x94, 0x82, 0x62, 0x65, 0x69, 0x7F, 0x2C, 0x9C, 0x7F, 0x2C, 0x9C, 0x67, 0x2E, 0x62, 0x63, 0x65,
@@ -3906,10 +3906,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0x3D, 0x50, 0x7F, 0xD4, 0xDB, 0x7F, 0xA1, 0x96, 0x41, 0x63, 0x93, 0xBD, 0x21, 0x65, 0xFC,
     0x27, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x72, 0x75, 0x8A, 0xAE, 0xB9, 0xD2, 0xDD, 0xE4, 0xFD, 0x64,
     0x6D, 0x6E, 0x72, 0x74, 0x7F, 0x3B, 0x66, 0x7F, 0x34, 0x64, 0x7F, 0x34, 0x64, 0x7F, 0x34, 0x64,
-    0x61, 0x6E, 0x7F, 0x55, 0x54, 0x21, 0x65, 0xFB, 0xEC, 0x06, 0xF1, 0x61, 0xC3, 0x63, 0x65, 0x69,
-    0x6B, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFE, 0x19, 0x7F, 0xFE, 0x4F, 0x7F, 0xFE, 0x7A,
-    0x7F, 0xFE, 0xB8, 0x7F, 0xFE, 0xF5, 0x7F, 0xFF, 0x02, 0x7F, 0xFF, 0x0F, 0x7F, 0xFF, 0x42, 0x7F,
-    0x35, 0xF7, 0x7F, 0xFF, 0xD8, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xFD, 0x63, 0x61, 0x67, 0x6C, 0x7F,
+    0x61, 0x6E, 0x7F, 0x55, 0x54, 0x21, 0x65, 0xFB, 0xEC, 0x06, 0xF1, 0x61, 0x63, 0x65, 0x69, 0x6B,
+    0x6F, 0x70, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFE, 0x19, 0x7F, 0xFE, 0x7A, 0x7F, 0xFE, 0xB8,
+    0x7F, 0xFE, 0xF5, 0x7F, 0xFF, 0x02, 0x7F, 0xFF, 0x0F, 0x7F, 0xFF, 0x42, 0x7F, 0x35, 0xF7, 0x7F,
+    0xFF, 0xD8, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xFD, 0x7F, 0xFE, 0x4F, 0x63, 0x61, 0x67, 0x6C, 0x7F,
     0x2A, 0x36, 0x7F, 0x2C, 0x9F, 0x7F, 0x2A, 0x36, 0xE5, 0x00, 0xB1, 0x61, 0x64, 0x67, 0x6F, 0x73,
     0x7F, 0x2B, 0xA1, 0x7F, 0x2A, 0x29, 0x7F, 0x2A, 0x29, 0x7F, 0x2B, 0xA1, 0x7F, 0x2B, 0xA1, 0x68,
     0x2E, 0x65, 0x6C, 0x6E, 0x70, 0x72, 0x74, 0x75, 0x7F, 0x29, 0x02, 0x7F, 0xB5, 0x5C, 0x7F, 0xFF,
@@ -3941,10 +3941,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7C, 0x7F, 0x27, 0x7C, 0x7F, 0xFF, 0xEB, 0x63, 0x62, 0x64, 0x66, 0x7F, 0x28, 0x6A, 0x7F, 0x28,
     0x6A, 0x7F, 0x28, 0xF6, 0x63, 0x6B, 0x6C, 0x74, 0x7F, 0x28, 0x5D, 0x7F, 0x28, 0x5D, 0x7F, 0x28,
     0x5D, 0x64, 0x65, 0x6D, 0x6E, 0x72, 0x7F, 0x16, 0x98, 0x7F, 0x39, 0x34, 0x7F, 0xFF, 0xE6, 0x7F,
-    0xFF, 0xF3, 0xED, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75,
-    0x77, 0x7A, 0x7F, 0xFE, 0x2D, 0x7F, 0xFE, 0x53, 0x7F, 0xFE, 0x9B, 0x7F, 0xFE, 0xC5, 0x7F, 0xFE,
-    0xCD, 0x7F, 0xFE, 0xED, 0x7F, 0x29, 0xBD, 0x7F, 0xFF, 0x0B, 0x7F, 0xFF, 0x3E, 0x7F, 0xFF, 0xB6,
-    0x7F, 0xFF, 0xEF, 0x7F, 0xB3, 0x2E, 0x7F, 0x0E, 0x27, 0x62, 0x61, 0x74, 0x7F, 0x11, 0x45, 0x7F,
+    0xFF, 0xF3, 0xED, 0x06, 0xF1, 0x61, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x77,
+    0x7A, 0xC3, 0x7F, 0xFE, 0x2D, 0x7F, 0xFE, 0x9B, 0x7F, 0xFE, 0xC5, 0x7F, 0xFE, 0xCD, 0x7F, 0xFE,
+    0xED, 0x7F, 0x29, 0xBD, 0x7F, 0xFF, 0x0B, 0x7F, 0xFF, 0x3E, 0x7F, 0xFF, 0xB6, 0x7F, 0xFF, 0xEF,
+    0x7F, 0xB3, 0x2E, 0x7F, 0x0E, 0x27, 0x7F, 0xFE, 0x53, 0x62, 0x61, 0x74, 0x7F, 0x11, 0x45, 0x7F,
     0x0F, 0x25, 0x21, 0x73, 0xF7, 0x21, 0x68, 0xFD, 0x62, 0x61, 0x65, 0x7F, 0x11, 0x36, 0x7F, 0x7C,
     0xF8, 0x21, 0x66, 0xF7, 0xE3, 0x02, 0xF1, 0x62, 0x6E, 0x72, 0x7F, 0x28, 0xA8, 0x7F, 0xFF, 0xFD,
     0x7F, 0x0D, 0xD2, 0xE2, 0x06, 0xF1, 0x64, 0x74, 0x7F, 0x0D, 0x8F, 0x7F, 0x26, 0xDB, 0x62, 0x69,
@@ -3965,13 +3965,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0x44, 0x7F, 0xFF, 0x91, 0x7F, 0xFF, 0xBA, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xFD, 0x7F,
     0x26, 0xA7, 0x61, 0x74, 0x7F, 0x17, 0x21, 0x21, 0x69, 0xFB, 0x62, 0x69, 0x6C, 0x7F, 0x0D, 0x05,
     0x7F, 0x0C, 0x9D, 0x21, 0x67, 0xF7, 0xE3, 0x08, 0x62, 0x65, 0x74, 0x75, 0x7F, 0xFF, 0xF1, 0x7F,
-    0x26, 0xCB, 0x7F, 0xFF, 0xFD, 0x7A, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A,
-    0x7F, 0xEC, 0x19, 0x7F, 0xED, 0x09, 0x7F, 0xED, 0x2D, 0x7F, 0x6F, 0x78, 0x7F, 0xED, 0x38, 0x7F,
-    0xF1, 0x83, 0x7F, 0xF2, 0xE3, 0x7F, 0xF3, 0x33, 0x7F, 0xF3, 0x46, 0x7F, 0xF5, 0x2E, 0x7F, 0xF5,
-    0x76, 0x7F, 0xF5, 0x85, 0x7F, 0xF6, 0xF9, 0x7F, 0xF7, 0x37, 0x7F, 0xF7, 0x42, 0x7F, 0xF8, 0x35,
-    0x7F, 0x6B, 0xF3, 0x7F, 0x26, 0xB9, 0x7F, 0xFA, 0x26, 0x7F, 0xFC, 0x53, 0x7F, 0xFE, 0x7D, 0x7F,
-    0xFF, 0xAE, 0x7F, 0x26, 0xB9, 0x7F, 0x26, 0xB9, 0x7F, 0x26, 0x07, 0x7F, 0xFF, 0xF1, 0x61, 0x6C,
+    0x26, 0xCB, 0x7F, 0xFF, 0xFD, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3,
+    0x7F, 0xEC, 0x19, 0x7F, 0xED, 0x2D, 0x7F, 0x6F, 0x78, 0x7F, 0xED, 0x38, 0x7F, 0xF1, 0x83, 0x7F,
+    0xF2, 0xE3, 0x7F, 0xF3, 0x33, 0x7F, 0xF3, 0x46, 0x7F, 0xF5, 0x2E, 0x7F, 0xF5, 0x76, 0x7F, 0xF5,
+    0x85, 0x7F, 0xF6, 0xF9, 0x7F, 0xF7, 0x37, 0x7F, 0xF7, 0x42, 0x7F, 0xF8, 0x35, 0x7F, 0x6B, 0xF3,
+    0x7F, 0x26, 0xB9, 0x7F, 0xFA, 0x26, 0x7F, 0xFC, 0x53, 0x7F, 0xFE, 0x7D, 0x7F, 0xFF, 0xAE, 0x7F,
+    0x26, 0xB9, 0x7F, 0x26, 0xB9, 0x7F, 0x26, 0x07, 0x7F, 0xFF, 0xF1, 0x7F, 0xED, 0x09, 0x61, 0x6C,
     0x7F, 0x27, 0x0E, 0x64, 0x65, 0x69, 0x6C, 0x72, 0x7F, 0x0C, 0x30, 0x7F, 0x0C, 0x30, 0x7F, 0x25,
     0xE7, 0x7F, 0x0C, 0x30, 0x61, 0x74, 0x7F, 0x4A, 0xB8, 0xE1, 0x14, 0x03, 0x65, 0x7F, 0x0B, 0xB6,
     0x63, 0x69, 0x75, 0xC3, 0x7F, 0x0C, 0x16, 0x7F, 0x0C, 0x16, 0x7F, 0x13, 0x6C, 0x63, 0x2E, 0x75,
@@ -4113,11 +4113,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x05, 0x0C, 0x41, 0x67, 0xE7, 0x27, 0x21, 0x65, 0xFC, 0x41, 0x68, 0x8C, 0x6F, 0x62, 0x65, 0x70,
     0x7F, 0xFF, 0xFC, 0x7F, 0x03, 0x55, 0x62, 0x63, 0x72, 0x7F, 0x8C, 0x62, 0x7F, 0x0A, 0xCF, 0x61,
     0x62, 0x7F, 0x72, 0x61, 0x62, 0x69, 0x72, 0x7F, 0x0A, 0xC1, 0x7F, 0xFF, 0xFB, 0x22, 0x61, 0x65,
-    0xE9, 0xF7, 0x70, 0x2E, 0x61, 0x64, 0x65, 0x68, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0xC3, 0x72, 0x73,
-    0x77, 0x79, 0x7A, 0x7F, 0x1E, 0x0B, 0x7F, 0xFF, 0x09, 0x7F, 0x98, 0xB9, 0x7F, 0xFF, 0x67, 0x7F,
+    0xE9, 0xF7, 0x70, 0x2E, 0x61, 0x64, 0x65, 0x68, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x77,
+    0x79, 0x7A, 0xC3, 0x7F, 0x1E, 0x0B, 0x7F, 0xFF, 0x09, 0x7F, 0x98, 0xB9, 0x7F, 0xFF, 0x67, 0x7F,
     0xFF, 0x81, 0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xA3, 0x7F, 0x2A, 0x5B, 0x7F, 0xFF, 0xA6, 0x7F, 0xFF,
-    0xB3, 0x7F, 0xD4, 0x70, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xFB, 0x7F, 0x1C, 0x72,
-    0x7F, 0x02, 0xFA, 0x62, 0x6E, 0x75, 0x7F, 0x15, 0x16, 0x7F, 0x34, 0x3A, 0xE1, 0x05, 0x11, 0x6E,
+    0xB3, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xFB, 0x7F, 0x1C, 0x72, 0x7F, 0x02, 0xFA,
+    0x7F, 0xD4, 0x70, 0x62, 0x6E, 0x75, 0x7F, 0x15, 0x16, 0x7F, 0x34, 0x3A, 0xE1, 0x05, 0x11, 0x6E,
     0x7F, 0x1C, 0x98, 0x62, 0x2E, 0x74, 0x7F, 0x66, 0x49, 0x7F, 0x1C, 0x91, 0x63, 0x65, 0x66, 0x7A,
     0x7F, 0x4B, 0xA0, 0x7F, 0x1C, 0x88, 0x7F, 0x1C, 0x88, 0x67, 0x62, 0x63, 0x69, 0x6C, 0x6E, 0x72,
     0x78, 0x7F, 0x1C, 0x78, 0x7F, 0x1C, 0x78, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xEA, 0x7F, 0x1D, 0x18,
@@ -4213,9 +4213,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0x17, 0x9C, 0x7F, 0x16, 0x8F, 0x7F, 0x17, 0x9C, 0xE1, 0x02, 0xF1, 0x68, 0x7F, 0x16, 0x65,
     0x62, 0x63, 0x66, 0x7F, 0x17, 0xED, 0x7F, 0x17, 0xAC, 0x65, 0x63, 0x65, 0x66, 0x6E, 0x73, 0x7F,
     0xFF, 0xF0, 0x7F, 0xFF, 0xF7, 0x7F, 0x17, 0x55, 0x7F, 0x17, 0x55, 0x7F, 0x18, 0x13, 0x6C, 0x2E,
-    0x61, 0xC3, 0x62, 0x65, 0x68, 0x69, 0x6F, 0x73, 0x75, 0x77, 0x79, 0x7F, 0x17, 0x40, 0x7F, 0xFD,
-    0xEB, 0x7F, 0xFE, 0x59, 0x7F, 0x17, 0x40, 0x7F, 0xFE, 0xD9, 0x7F, 0x17, 0x40, 0x7F, 0xFF, 0x57,
-    0x7F, 0xFF, 0xA4, 0x7F, 0x17, 0x40, 0x7F, 0xFF, 0xEB, 0x7F, 0x17, 0x40, 0x7F, 0x25, 0xF3, 0xA0,
+    0x61, 0x62, 0x65, 0x68, 0x69, 0x6F, 0x73, 0x75, 0x77, 0x79, 0xC3, 0x7F, 0x17, 0x40, 0x7F, 0xFD,
+    0xEB, 0x7F, 0x17, 0x40, 0x7F, 0xFE, 0xD9, 0x7F, 0x17, 0x40, 0x7F, 0xFF, 0x57, 0x7F, 0xFF, 0xA4,
+    0x7F, 0x17, 0x40, 0x7F, 0xFF, 0xEB, 0x7F, 0x17, 0x40, 0x7F, 0x25, 0xF3, 0x7F, 0xFE, 0x59, 0xA0,
     0x21, 0x93, 0x21, 0x62, 0xFD, 0x62, 0x72, 0x75, 0x7E, 0xFC, 0xBD, 0x7E, 0xFC, 0xBD, 0xA1, 0x00,
     0x81, 0x74, 0xF7, 0xA1, 0x02, 0x61, 0x6E, 0xFB, 0xE4, 0x06, 0xF2, 0x61, 0x65, 0x69, 0x75, 0x7F,
     0xFF, 0xEA, 0x7F, 0xFF, 0xFB, 0x7F, 0x14, 0xD2, 0x7F, 0x22, 0xAB, 0x62, 0x65, 0x69, 0x7F, 0xFB,
@@ -4232,13 +4232,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x76, 0x7F, 0x16, 0x45, 0x7F, 0x16, 0x45, 0x7F, 0xFF, 0xF9, 0x7F, 0x17, 0x03, 0x7F, 0x15, 0x45,
     0x64, 0x2E, 0x66, 0x67, 0x73, 0x7F, 0x15, 0xCA, 0x7F, 0x15, 0x4D, 0x7F, 0x16, 0x7C, 0x7F, 0x53,
     0x75, 0x64, 0x2E, 0x6D, 0x6E, 0x74, 0x7F, 0x15, 0xB9, 0x7F, 0xFF, 0xEF, 0x7F, 0x16, 0xDB, 0x7F,
-    0x16, 0x1D, 0x79, 0x2E, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C,
-    0x6D, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0x7F, 0x16, 0x0C, 0x7F,
-    0xFF, 0x32, 0x7F, 0xFF, 0x5F, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0xFF,
-    0x7A, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0xFF, 0xAF, 0x7F, 0x53, 0x1A,
-    0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0xFF, 0xC7, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F,
-    0x16, 0x0C, 0x7F, 0x53, 0x1A, 0x7F, 0x16, 0x0C, 0x7F, 0xFF, 0xEF, 0x7F, 0x16, 0x0C, 0x7F, 0x16,
-    0x0C, 0x7F, 0x14, 0xFF, 0x7F, 0x16, 0x0C, 0x61, 0x6C, 0x7F, 0x1C, 0x24, 0xA0, 0x07, 0x22, 0xE3,
+    0x16, 0x1D, 0x79, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D,
+    0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3, 0x7F, 0x16, 0x0C, 0x7F,
+    0xFF, 0x32, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0xFF, 0x7A, 0x7F, 0x16,
+    0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0xFF, 0xAF, 0x7F, 0x53, 0x1A, 0x7F, 0x16, 0x0C,
+    0x7F, 0x16, 0x0C, 0x7F, 0xFF, 0xC7, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F,
+    0x53, 0x1A, 0x7F, 0x16, 0x0C, 0x7F, 0xFF, 0xEF, 0x7F, 0x16, 0x0C, 0x7F, 0x16, 0x0C, 0x7F, 0x14,
+    0xFF, 0x7F, 0x16, 0x0C, 0x7F, 0xFF, 0x5F, 0x61, 0x6C, 0x7F, 0x1C, 0x24, 0xA0, 0x07, 0x22, 0xE3,
     0x06, 0xB1, 0x6A, 0x6C, 0x73, 0x7F, 0x16, 0x5D, 0x7F, 0xFF, 0xFD, 0x7E, 0xFB, 0x8A, 0xA0, 0x21,
     0xE4, 0x64, 0x66, 0x68, 0x6C, 0x6E, 0x7F, 0xFF, 0xFD, 0x7F, 0x16, 0x4B, 0x7F, 0x26, 0x96, 0x7F,
     0x99, 0xAC, 0x61, 0x72, 0x7F, 0x16, 0x3A, 0x41, 0x6E, 0xF6, 0x92, 0x64, 0x61, 0x65, 0x6F, 0x72,
@@ -4343,11 +4343,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x69, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF, 0xFC, 0x47, 0x61, 0xC3, 0x65, 0x68, 0x69,
     0x6F, 0x72, 0xFF, 0x33, 0xFF, 0x67, 0xFF, 0x8D, 0xFF, 0xA2, 0xFF, 0xAB, 0xFF, 0xB8, 0xFF, 0xEB,
     0xE3, 0x11, 0x02, 0x62, 0x6E, 0x74, 0x7F, 0x0E, 0x2E, 0x7F, 0x0F, 0x31, 0x7F, 0x0F, 0x31, 0xF0,
-    0x0A, 0x02, 0x61, 0xC3, 0x62, 0x63, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0x7A, 0x7F, 0xFD, 0x50, 0x7F, 0xFD, 0x9A, 0x7F, 0xFD, 0x9D, 0x7F, 0xFD, 0xDF, 0x7F, 0xFE,
-    0x20, 0x7F, 0xFE, 0x6D, 0x7F, 0xFE, 0x70, 0x7F, 0xFE, 0x8E, 0x7F, 0x38, 0x5E, 0x7F, 0xFE, 0x91,
-    0x7F, 0xFE, 0xB5, 0x7F, 0xFE, 0xCF, 0x7F, 0xFE, 0xDD, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xF1, 0x7F,
-    0xE4, 0xB6, 0x61, 0x75, 0x7F, 0x0E, 0xED, 0xE2, 0x02, 0x61, 0x6D, 0x6E, 0x7E, 0xF4, 0xC2, 0x7F,
+    0x0A, 0x02, 0x61, 0x62, 0x63, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75,
+    0x7A, 0xC3, 0x7F, 0xFD, 0x50, 0x7F, 0xFD, 0x9D, 0x7F, 0xFD, 0xDF, 0x7F, 0xFE, 0x20, 0x7F, 0xFE,
+    0x6D, 0x7F, 0xFE, 0x70, 0x7F, 0xFE, 0x8E, 0x7F, 0x38, 0x5E, 0x7F, 0xFE, 0x91, 0x7F, 0xFE, 0xB5,
+    0x7F, 0xFE, 0xCF, 0x7F, 0xFE, 0xDD, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xF1, 0x7F, 0xE4, 0xB6, 0x7F,
+    0xFD, 0x9A, 0x61, 0x75, 0x7F, 0x0E, 0xED, 0xE2, 0x02, 0x61, 0x6D, 0x6E, 0x7E, 0xF4, 0xC2, 0x7F,
     0x2B, 0x27, 0xE1, 0x06, 0xC1, 0x75, 0x7F, 0x0E, 0xCF, 0x21, 0x74, 0xF9, 0x62, 0x6E, 0x72, 0x7E,
     0xF4, 0x3D, 0x7F, 0x00, 0x48, 0x21, 0x65, 0xF7, 0xE6, 0x06, 0xF1, 0x61, 0x65, 0x69, 0x6F, 0x73,
     0x75, 0x7F, 0xFF, 0xDA, 0x7F, 0x0D, 0xB6, 0x7F, 0xFF, 0xDF, 0x7F, 0x0D, 0xB6, 0x7F, 0xFF, 0xF1,
@@ -4378,14 +4378,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFE, 0xE5, 0x7F, 0xFE, 0xEA, 0x7F, 0xFF, 0x23, 0x7F, 0xFF, 0x59, 0x7F, 0xFF, 0xAA, 0x7F, 0xFF,
     0xDF, 0xE1, 0x06, 0xF1, 0x65, 0x7F, 0x0C, 0x0D, 0xE1, 0x06, 0xF1, 0x72, 0x7F, 0x0C, 0x06, 0xE1,
     0x00, 0x91, 0x6E, 0x7E, 0xF5, 0x4D, 0x21, 0x69, 0xF9, 0x21, 0x67, 0xFD, 0x21, 0x75, 0xFD, 0xE2,
-    0x08, 0x62, 0x65, 0x68, 0x7F, 0xFF, 0xFD, 0x7F, 0x0B, 0xEF, 0xFA, 0x07, 0xB1, 0x61, 0xC3, 0x62,
-    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0x7F, 0xE9, 0x98, 0x7F, 0xEA, 0x21, 0x7F, 0xEA, 0x34,
-    0x7F, 0x11, 0x47, 0x7F, 0xEA, 0xB6, 0x7F, 0xF0, 0xAA, 0x7F, 0xF1, 0x06, 0x7F, 0xF1, 0x2B, 0x7F,
-    0xF1, 0x74, 0x7F, 0xF2, 0xD3, 0x7F, 0x0C, 0xE4, 0x7F, 0xF3, 0x21, 0x7F, 0xF5, 0xA4, 0x7F, 0xF5,
-    0xEE, 0x7F, 0xF6, 0xD8, 0x7F, 0xF8, 0x24, 0x7F, 0xF8, 0x65, 0x7F, 0xF8, 0x70, 0x7F, 0xFA, 0xC9,
-    0x7F, 0xFD, 0xC5, 0x7F, 0xFE, 0x2E, 0x7F, 0xFF, 0xA6, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xDE, 0x7F,
-    0x20, 0x37, 0x7F, 0xFF, 0xF5, 0xE1, 0x06, 0xC1, 0x6B, 0x7F, 0x0C, 0x7C, 0x63, 0x61, 0xC3, 0x75,
+    0x08, 0x62, 0x65, 0x68, 0x7F, 0xFF, 0xFD, 0x7F, 0x0B, 0xEF, 0xFA, 0x07, 0xB1, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3, 0x7F, 0xE9, 0x98, 0x7F, 0xEA, 0x34, 0x7F, 0x11, 0x47,
+    0x7F, 0xEA, 0xB6, 0x7F, 0xF0, 0xAA, 0x7F, 0xF1, 0x06, 0x7F, 0xF1, 0x2B, 0x7F, 0xF1, 0x74, 0x7F,
+    0xF2, 0xD3, 0x7F, 0x0C, 0xE4, 0x7F, 0xF3, 0x21, 0x7F, 0xF5, 0xA4, 0x7F, 0xF5, 0xEE, 0x7F, 0xF6,
+    0xD8, 0x7F, 0xF8, 0x24, 0x7F, 0xF8, 0x65, 0x7F, 0xF8, 0x70, 0x7F, 0xFA, 0xC9, 0x7F, 0xFD, 0xC5,
+    0x7F, 0xFE, 0x2E, 0x7F, 0xFF, 0xA6, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xDE, 0x7F, 0x20, 0x37, 0x7F,
+    0xFF, 0xF5, 0x7F, 0xEA, 0x21, 0xE1, 0x06, 0xC1, 0x6B, 0x7F, 0x0C, 0x7C, 0x63, 0x61, 0xC3, 0x75,
     0x7F, 0x0B, 0x72, 0x7F, 0x20, 0x19, 0x7F, 0x1F, 0x18, 0xA0, 0x1C, 0x23, 0x66, 0x65, 0x6C, 0x6E,
     0x6F, 0x72, 0x77, 0x7F, 0x5C, 0xA3, 0x7F, 0xFF, 0xF0, 0x7F, 0x0C, 0x62, 0x7F, 0xFF, 0xFD, 0x7F,
     0x14, 0x28, 0x7F, 0x0C, 0x62, 0x62, 0x2E, 0x6E, 0x7E, 0xF2, 0xA3, 0x7E, 0xF2, 0xA3, 0x21, 0x65,
@@ -4472,11 +4472,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6D, 0x73, 0x74, 0x7E, 0xEC, 0xC2, 0x7F, 0xFF, 0x40, 0x7F, 0xFF, 0x57, 0x7F, 0xFF, 0x7C, 0x7F,
     0x06, 0x59, 0x7F, 0xB9, 0xF7, 0x7F, 0xFF, 0xB1, 0x7F, 0xFF, 0xEB, 0x62, 0x65, 0x69, 0x7F, 0x50,
     0xC8, 0x7F, 0x26, 0x21, 0x74, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C,
-    0x6D, 0x6E, 0x70, 0x72, 0x73, 0xC3, 0x74, 0x75, 0x76, 0x7F, 0xFA, 0xA1, 0x7F, 0xFA, 0xB8, 0x7F,
+    0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0xC3, 0x7F, 0xFA, 0xA1, 0x7F, 0xFA, 0xB8, 0x7F,
     0xFB, 0x09, 0x7F, 0xFB, 0x25, 0x7F, 0xFB, 0x73, 0x7F, 0xFB, 0xCC, 0x7F, 0xFB, 0xD9, 0x7F, 0xFB,
     0xE2, 0x7F, 0x76, 0xBD, 0x7F, 0xFB, 0xF2, 0x7F, 0xFC, 0xFC, 0x7F, 0xFD, 0x2E, 0x7F, 0xFD, 0xBE,
-    0x7F, 0xFD, 0xFF, 0x7F, 0xFE, 0x6A, 0x7F, 0xFE, 0xC6, 0x7F, 0xFE, 0xDF, 0x7F, 0xFE, 0xF5, 0x7F,
-    0xFF, 0xD6, 0x7F, 0xFF, 0xF7, 0x64, 0x67, 0x6D, 0x6F, 0x7A, 0x7F, 0x05, 0xC9, 0x7E, 0xEF, 0x88,
+    0x7F, 0xFD, 0xFF, 0x7F, 0xFE, 0x6A, 0x7F, 0xFE, 0xC6, 0x7F, 0xFE, 0xF5, 0x7F, 0xFF, 0xD6, 0x7F,
+    0xFF, 0xF7, 0x7F, 0xFE, 0xDF, 0x64, 0x67, 0x6D, 0x6F, 0x7A, 0x7F, 0x05, 0xC9, 0x7E, 0xEF, 0x88,
     0x7E, 0xEC, 0x44, 0x7F, 0x07, 0x87, 0x62, 0x63, 0x74, 0x7F, 0x9D, 0xA0, 0x7F, 0x07, 0x76, 0x65,
     0x2E, 0x63, 0x67, 0x6B, 0x70, 0x7F, 0x9A, 0x47, 0x7E, 0xED, 0x8B, 0x7F, 0x06, 0xFD, 0x7F, 0x06,
     0xFD, 0x7F, 0x9A, 0x47, 0x62, 0x67, 0x73, 0x7F, 0x06, 0x9A, 0x7F, 0xFF, 0xEB, 0x6A, 0x63, 0x64,
@@ -4546,11 +4546,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0x6E, 0x7F, 0x06, 0xD6, 0x62, 0x65, 0x69, 0x7F, 0xFF, 0xFB, 0x7E, 0xEB, 0x58, 0x61, 0x6D,
     0x7E, 0xF0, 0xF1, 0x63, 0x63, 0x65, 0x6C, 0x7E, 0xE9, 0xDD, 0x7F, 0xFF, 0xFB, 0x7E, 0xE9, 0x60,
     0x67, 0x63, 0x65, 0x66, 0x67, 0x6B, 0x73, 0x77, 0x7F, 0x01, 0x7E, 0x7F, 0x95, 0x60, 0x7F, 0x01,
-    0x7E, 0x7F, 0x03, 0x93, 0x7F, 0x01, 0x7E, 0x7F, 0x01, 0x7E, 0x7F, 0x02, 0xCC, 0x6E, 0x61, 0xC3,
-    0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFF, 0x13, 0x7F,
-    0x15, 0xD7, 0x7E, 0xEE, 0x7B, 0x7F, 0xFF, 0x59, 0x7E, 0xF1, 0x5E, 0x7F, 0xFF, 0x82, 0x7F, 0xFF,
-    0x97, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xC8, 0x7F, 0x08, 0x38, 0x7F, 0xFF, 0xD6, 0x7F, 0xFF, 0xE3,
-    0x7F, 0x01, 0xC4, 0x7E, 0xF1, 0x5E, 0xE2, 0x06, 0xC1, 0x6E, 0x72, 0x7F, 0x02, 0x2B, 0x7F, 0x13,
+    0x7E, 0x7F, 0x03, 0x93, 0x7F, 0x01, 0x7E, 0x7F, 0x01, 0x7E, 0x7F, 0x02, 0xCC, 0x6E, 0x61, 0x64,
+    0x65, 0x66, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFF, 0x13, 0x7E,
+    0xEE, 0x7B, 0x7F, 0xFF, 0x59, 0x7E, 0xF1, 0x5E, 0x7F, 0xFF, 0x82, 0x7F, 0xFF, 0x97, 0x7F, 0xFF,
+    0xBC, 0x7F, 0xFF, 0xC8, 0x7F, 0x08, 0x38, 0x7F, 0xFF, 0xD6, 0x7F, 0xFF, 0xE3, 0x7F, 0x01, 0xC4,
+    0x7E, 0xF1, 0x5E, 0x7F, 0x15, 0xD7, 0xE2, 0x06, 0xC1, 0x6E, 0x72, 0x7F, 0x02, 0x2B, 0x7F, 0x13,
     0x4D, 0x62, 0x66, 0x69, 0x7F, 0x02, 0x20, 0x7F, 0x02, 0x1D, 0xE1, 0x00, 0x41, 0x65, 0x7F, 0x02,
     0xC0, 0x64, 0x2E, 0x62, 0x6E, 0x70, 0x7F, 0x02, 0x10, 0x7E, 0xE9, 0x50, 0x7F, 0xFF, 0xF9, 0x7F,
     0x02, 0x5B, 0x61, 0xA4, 0x7F, 0x08, 0xA7, 0x62, 0x69, 0x73, 0x7E, 0xE9, 0x5D, 0x7E, 0xEF, 0x5D,
@@ -4574,12 +4574,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x60, 0x7E, 0xE6, 0x60, 0xE1, 0x07, 0x91, 0x70, 0x7E, 0xEA, 0xEC, 0x62, 0x65, 0x70, 0x7F, 0xFF,
     0xF9, 0x7E, 0xE6, 0xBB, 0xE1, 0x07, 0xC2, 0x70, 0x7E, 0xE6, 0xB2, 0x21, 0xA4, 0xF9, 0xC1, 0x07,
     0x91, 0x67, 0x8B, 0x2C, 0x63, 0x6E, 0x73, 0x75, 0x7F, 0xE1, 0xD5, 0x7E, 0xE6, 0x71, 0x7F, 0xFF,
-    0xFA, 0x23, 0x61, 0xC3, 0x65, 0xDA, 0xEA, 0xF3, 0x73, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFE, 0x99, 0x7F,
-    0xFE, 0xAA, 0x7F, 0xFE, 0xAF, 0x7E, 0xE6, 0x21, 0x7F, 0x60, 0x26, 0x7F, 0xFE, 0xFA, 0x7F, 0xFF,
-    0x22, 0x7F, 0x71, 0x5F, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0x52, 0x7F, 0xFF, 0x67, 0x7F, 0xFF, 0x82,
-    0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0x99, 0x7F, 0xFF, 0xB9, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xC1, 0x7F,
-    0x92, 0xA5, 0x7F, 0xFF, 0xF9, 0x64, 0x61, 0x65, 0x72, 0x75, 0x7F, 0x00, 0x5C, 0x7F, 0x17, 0x31,
+    0xFA, 0x23, 0x61, 0xC3, 0x65, 0xDA, 0xEA, 0xF3, 0x73, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFE, 0x99, 0x7F,
+    0xFE, 0xAF, 0x7E, 0xE6, 0x21, 0x7F, 0x60, 0x26, 0x7F, 0xFE, 0xFA, 0x7F, 0xFF, 0x22, 0x7F, 0x71,
+    0x5F, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0x52, 0x7F, 0xFF, 0x67, 0x7F, 0xFF, 0x82, 0x7F, 0xFF, 0x8C,
+    0x7F, 0xFF, 0x99, 0x7F, 0xFF, 0xB9, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xC1, 0x7F, 0x92, 0xA5, 0x7F,
+    0xFF, 0xF9, 0x7F, 0xFE, 0xAA, 0x64, 0x61, 0x65, 0x72, 0x75, 0x7F, 0x00, 0x5C, 0x7F, 0x17, 0x31,
     0x7F, 0x9B, 0xC5, 0x7F, 0x00, 0x5C, 0x66, 0x65, 0x68, 0x69, 0x6B, 0x73, 0x74, 0x7F, 0x83, 0x0F,
     0x7F, 0x0B, 0xD9, 0x7E, 0xE6, 0x11, 0x7F, 0x0B, 0xD9, 0x7E, 0xF2, 0x42, 0x7F, 0xFF, 0xEF, 0x61,
     0x7A, 0x7E, 0xE6, 0xFE, 0x21, 0x72, 0xFB, 0x65, 0x61, 0x65, 0x73, 0x74, 0x7A, 0x7F, 0x58, 0xD4,
@@ -4678,11 +4678,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x05, 0x8C, 0x7F, 0x1E, 0xB3, 0x7F, 0xFF, 0xF7, 0x7F, 0x06, 0x25, 0x61, 0x70, 0x7F, 0x25, 0x39,
     0x62, 0x63, 0x6E, 0x7E, 0xF9, 0x4E, 0x7E, 0xFA, 0x51, 0x62, 0x65, 0x74, 0x7E, 0xF5, 0x94, 0x7E,
     0xE1, 0x65, 0x21, 0x73, 0xF7, 0x64, 0x6B, 0x6D, 0x72, 0x73, 0x7E, 0xF9, 0x39, 0x7F, 0xFF, 0xE6,
-    0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFD, 0xEE, 0x06, 0xF1, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x69, 0x6B, 0x6F, 0x73, 0x75, 0x7A, 0x7F, 0xFD, 0xC1, 0x7F, 0xFE, 0x07, 0x7F, 0xFE, 0x0E,
-    0x7E, 0xFF, 0x0D, 0x7F, 0xFE, 0x15, 0x7F, 0xFE, 0xCF, 0x7E, 0xE0, 0x13, 0x7F, 0xFE, 0x0E, 0x7F,
-    0xFF, 0x38, 0x7E, 0xE0, 0x13, 0x7F, 0xFF, 0x68, 0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xEF, 0x7E, 0xE0,
-    0x13, 0x63, 0x63, 0x68, 0x6C, 0x7E, 0xFA, 0x7C, 0x7E, 0xFA, 0x7C, 0x7E, 0xFA, 0x7C, 0x62, 0x77,
+    0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFD, 0xEE, 0x06, 0xF1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x69, 0x6B, 0x6F, 0x73, 0x75, 0x7A, 0xC3, 0x7F, 0xFD, 0xC1, 0x7F, 0xFE, 0x0E, 0x7E, 0xFF, 0x0D,
+    0x7F, 0xFE, 0x15, 0x7F, 0xFE, 0xCF, 0x7E, 0xE0, 0x13, 0x7F, 0xFE, 0x0E, 0x7F, 0xFF, 0x38, 0x7E,
+    0xE0, 0x13, 0x7F, 0xFF, 0x68, 0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xEF, 0x7E, 0xE0, 0x13, 0x7F, 0xFE,
+    0x07, 0x63, 0x63, 0x68, 0x6C, 0x7E, 0xFA, 0x7C, 0x7E, 0xFA, 0x7C, 0x7E, 0xFA, 0x7C, 0x62, 0x77,
     0x7A, 0x7E, 0xFA, 0x6F, 0x7E, 0xFA, 0x6F, 0x62, 0x64, 0x69, 0x7F, 0x1B, 0x88, 0x7E, 0xE0, 0xA9,
     0x62, 0x63, 0x6F, 0x7E, 0xFA, 0x5D, 0x7E, 0xFA, 0x5D, 0x61, 0x73, 0x7F, 0x0A, 0x67, 0x66, 0x62,
     0x65, 0x6C, 0x6E, 0x72, 0x75, 0x7F, 0x06, 0x5D, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF,
@@ -4725,10 +4725,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x74, 0x75, 0x7E, 0xDD, 0x5B, 0x7E, 0xDD, 0x24, 0x7E, 0xEE, 0xDD, 0x61, 0x75, 0x7F, 0x07, 0x14,
     0x62, 0x61, 0x68, 0x7F, 0xFF, 0xFB, 0x7F, 0x1A, 0x22, 0xE6, 0x06, 0xB1, 0x63, 0x65, 0x6C, 0x6D,
     0x6E, 0x74, 0x7E, 0xF6, 0x48, 0x7E, 0xF6, 0x48, 0x7E, 0xF6, 0x48, 0x7F, 0x08, 0x3C, 0x7F, 0x9B,
-    0x03, 0x7F, 0x07, 0xF7, 0xED, 0x06, 0xF1, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6F,
-    0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFE, 0xB8, 0x7F, 0xFE, 0xE6, 0x7F, 0x02, 0xCB, 0x7F, 0xFF, 0x37,
-    0x7F, 0xFF, 0x63, 0x7E, 0xDD, 0x25, 0x7F, 0xFF, 0x90, 0x7E, 0xDD, 0x25, 0x7F, 0xFF, 0xB5, 0x7F,
-    0xFF, 0xCA, 0x7F, 0xFF, 0xDC, 0x7F, 0xFF, 0xE5, 0x7E, 0xDD, 0x25, 0x62, 0x6C, 0x72, 0x7E, 0xE3,
+    0x03, 0x7F, 0x07, 0xF7, 0xED, 0x06, 0xF1, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6F, 0x73,
+    0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFE, 0xB8, 0x7F, 0x02, 0xCB, 0x7F, 0xFF, 0x37, 0x7F, 0xFF, 0x63,
+    0x7E, 0xDD, 0x25, 0x7F, 0xFF, 0x90, 0x7E, 0xDD, 0x25, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xCA, 0x7F,
+    0xFF, 0xDC, 0x7F, 0xFF, 0xE5, 0x7E, 0xDD, 0x25, 0x7F, 0xFE, 0xE6, 0x62, 0x6C, 0x72, 0x7E, 0xE3,
     0x5B, 0x7F, 0xB6, 0xFF, 0x62, 0x65, 0x6C, 0x7F, 0xFF, 0xF7, 0x7E, 0xF6, 0x26, 0xE3, 0x00, 0xD1,
     0x61, 0x65, 0x73, 0x7E, 0xF6, 0x10, 0x7F, 0x7B, 0x4A, 0x7E, 0xDD, 0xC0, 0x62, 0x65, 0x6C, 0x7F,
     0x25, 0x02, 0x7F, 0x05, 0x48, 0x21, 0x72, 0xF7, 0x21, 0x65, 0xFD, 0x22, 0x68, 0x6B, 0xE2, 0xFD,
@@ -4763,12 +4763,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x66, 0xA1, 0x05, 0x81, 0x6E, 0xFB, 0x21, 0x65, 0xFB, 0x21, 0x9F, 0xFD, 0xE1, 0x07, 0x71, 0x69,
     0x7E, 0xDB, 0xD1, 0xA0, 0x09, 0x13, 0x64, 0x2E, 0x6C, 0x6F, 0x73, 0x7E, 0xF4, 0xF8, 0x7F, 0xFF,
     0xF6, 0x7E, 0xFB, 0x2E, 0x7F, 0xFF, 0xFD, 0xE1, 0x04, 0x51, 0x73, 0x7E, 0xDA, 0xD2, 0x75, 0x61,
-    0x62, 0x63, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0xC3,
-    0x74, 0x75, 0x77, 0x78, 0x7E, 0xFB, 0xE8, 0x7F, 0xFD, 0xE6, 0x7F, 0xFE, 0x0D, 0x7F, 0xFE, 0x28,
+    0x62, 0x63, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
+    0x75, 0x77, 0x78, 0xC3, 0x7E, 0xFB, 0xE8, 0x7F, 0xFD, 0xE6, 0x7F, 0xFE, 0x0D, 0x7F, 0xFE, 0x28,
     0x7F, 0xFE, 0x68, 0x7F, 0xFE, 0x89, 0x7F, 0xFE, 0x8E, 0x7E, 0xF4, 0xE0, 0x7F, 0xFE, 0x9F, 0x7F,
     0xFE, 0xDF, 0x7F, 0xFF, 0x17, 0x7F, 0xFF, 0x1A, 0x7F, 0xFF, 0x3B, 0x7F, 0xFF, 0x44, 0x7F, 0xFF,
-    0x95, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF9, 0x7E, 0xF4, 0xE0,
-    0x7E, 0xF4, 0x2E, 0xE1, 0x0B, 0xF3, 0x75, 0x7E, 0xF3, 0x8B, 0x62, 0x2E, 0x72, 0x7E, 0xF3, 0x84,
+    0x95, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF9, 0x7E, 0xF4, 0xE0, 0x7E, 0xF4, 0x2E,
+    0x7F, 0xFF, 0xDB, 0xE1, 0x0B, 0xF3, 0x75, 0x7E, 0xF3, 0x8B, 0x62, 0x2E, 0x72, 0x7E, 0xF3, 0x84,
     0x7E, 0xF4, 0x87, 0x41, 0x75, 0x9E, 0xAC, 0x64, 0x65, 0x6B, 0x6F, 0x73, 0x7F, 0x07, 0x1D, 0x7E,
     0xE0, 0xAB, 0x7E, 0xDA, 0x5F, 0x7E, 0xF4, 0x7A, 0x62, 0x61, 0x65, 0x7E, 0xDA, 0x1A, 0x7E, 0xDA,
     0x1D, 0x64, 0x62, 0x63, 0x66, 0x6D, 0x7F, 0xFF, 0xF7, 0x7E, 0xF3, 0x5D, 0x7E, 0xF4, 0x60, 0x7E,
@@ -4826,10 +4826,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xF0, 0x1B, 0x7E, 0xF3, 0x1F, 0x7E, 0xF0, 0x28, 0x7E, 0xF0, 0x1B, 0x7F, 0xFF, 0xF7, 0x7E, 0xF1,
     0x39, 0xE1, 0x01, 0x61, 0x6C, 0x7E, 0xD8, 0x18, 0x21, 0x68, 0xF9, 0x61, 0x65, 0x7F, 0x38, 0x35,
     0x21, 0x67, 0xFB, 0x21, 0x75, 0xFD, 0xA2, 0x00, 0xB1, 0x61, 0x65, 0xF2, 0xFD, 0xEF, 0x06, 0xF1,
-    0x61, 0xC3, 0x62, 0x63, 0x65, 0x67, 0x69, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x7F,
-    0xFC, 0xA5, 0x7F, 0xFC, 0xE1, 0x7E, 0xD6, 0xDC, 0x7E, 0xF5, 0xD6, 0x7F, 0xFD, 0xC7, 0x7F, 0xFE,
-    0x14, 0x7F, 0xFE, 0x5A, 0x7F, 0xFE, 0xA7, 0x7E, 0xD6, 0xDC, 0x7E, 0xD6, 0xDC, 0x7F, 0xFF, 0x18,
-    0x7F, 0xFF, 0xA4, 0x7F, 0xFF, 0xC9, 0x7E, 0xEF, 0xE4, 0x7F, 0xFF, 0xF9, 0x62, 0x73, 0x74, 0x7E,
+    0x61, 0x62, 0x63, 0x65, 0x67, 0x69, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F,
+    0xFC, 0xA5, 0x7E, 0xD6, 0xDC, 0x7E, 0xF5, 0xD6, 0x7F, 0xFD, 0xC7, 0x7F, 0xFE, 0x14, 0x7F, 0xFE,
+    0x5A, 0x7F, 0xFE, 0xA7, 0x7E, 0xD6, 0xDC, 0x7E, 0xD6, 0xDC, 0x7F, 0xFF, 0x18, 0x7F, 0xFF, 0xA4,
+    0x7F, 0xFF, 0xC9, 0x7E, 0xEF, 0xE4, 0x7F, 0xFF, 0xF9, 0x7F, 0xFC, 0xE1, 0x62, 0x73, 0x74, 0x7E,
     0xFA, 0xB5, 0x7E, 0xFA, 0xB5, 0x21, 0x68, 0xF7, 0x63, 0x62, 0x68, 0x6D, 0x7E, 0xF2, 0x21, 0x7E,
     0xF2, 0x21, 0x7E, 0xF2, 0x21, 0x64, 0x61, 0x6B, 0x6C, 0x74, 0x7F, 0x90, 0xCA, 0x7E, 0xF2, 0x14,
     0x7E, 0xF2, 0x14, 0x7F, 0x04, 0x73, 0xE1, 0x05, 0x11, 0x65, 0x7E, 0xF1, 0x17, 0x69, 0x62, 0x66,
@@ -4853,10 +4853,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xCA, 0x61, 0x6D, 0x7E, 0xF2, 0x3F, 0x21, 0x65, 0xFB, 0x61, 0x72, 0x7F, 0x6D, 0x5A, 0x21, 0x61,
     0xFB, 0x24, 0x64, 0x65, 0x73, 0x74, 0xE0, 0xE5, 0xF5, 0xFD, 0x62, 0x61, 0xC3, 0x7E, 0xF9, 0x57,
     0x7F, 0x03, 0xAE, 0x62, 0x65, 0x69, 0x7E, 0xF9, 0x4E, 0x7E, 0xF9, 0x4E, 0x6E, 0x62, 0x66, 0x68,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0xC3, 0x70, 0x73, 0x75, 0x77, 0x7A, 0x7E, 0xF0, 0xBD, 0x7E, 0xF0,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x75, 0x77, 0x7A, 0xC3, 0x7E, 0xF0, 0xBD, 0x7E, 0xF0,
     0xBD, 0x7E, 0xF0, 0xBD, 0x7F, 0x03, 0x58, 0x7E, 0xF0, 0xBD, 0x7E, 0xF0, 0xBD, 0x7F, 0xFF, 0xEE,
-    0x7F, 0x6B, 0xFA, 0x7F, 0x03, 0xA6, 0x7F, 0x8F, 0x73, 0x7E, 0xF0, 0xBD, 0x7E, 0xD6, 0x85, 0x7F,
-    0xFF, 0xF7, 0x7E, 0xF0, 0xBD, 0xE1, 0x00, 0xB1, 0x68, 0x7E, 0xF0, 0x84, 0xE2, 0x00, 0x51, 0x65,
+    0x7F, 0x6B, 0xFA, 0x7F, 0x8F, 0x73, 0x7E, 0xF0, 0xBD, 0x7E, 0xD6, 0x85, 0x7F, 0xFF, 0xF7, 0x7E,
+    0xF0, 0xBD, 0x7F, 0x03, 0xA6, 0xE1, 0x00, 0xB1, 0x68, 0x7E, 0xF0, 0x84, 0xE2, 0x00, 0x51, 0x65,
     0x74, 0x7E, 0xEF, 0x91, 0x7E, 0xEE, 0x21, 0x6C, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6C, 0x6D, 0x6E,
     0x70, 0x72, 0x74, 0x78, 0x7E, 0xF3, 0x96, 0x7E, 0xF3, 0x96, 0x7E, 0xF9, 0x4F, 0x7F, 0x03, 0xA7,
     0x7F, 0xFF, 0x33, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x77, 0x7F, 0xFF, 0x9A, 0x7F, 0x7A, 0x92, 0x7F,
@@ -4891,10 +4891,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0x1F, 0x7F, 0xFF, 0x4C, 0x7F, 0xFF, 0x78, 0x7E, 0xDE, 0xBB, 0x7F, 0xFF, 0x9B, 0x7F,
     0xFF, 0xB0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF3, 0xE5, 0x1B, 0x03, 0x62, 0x6C, 0x6E, 0x70, 0x74,
     0x7E, 0xEB, 0xF6, 0x7E, 0xEB, 0xF6, 0x7F, 0x13, 0x71, 0x7E, 0xEB, 0xF6, 0x7E, 0xEC, 0xF9, 0x41,
-    0x69, 0xC3, 0x6B, 0xEE, 0x06, 0xF1, 0x61, 0xC3, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6E, 0x6F, 0x70,
-    0x73, 0x74, 0x75, 0x77, 0x7F, 0xFC, 0x9E, 0x7F, 0xFC, 0xDC, 0x7F, 0xFC, 0xEC, 0x7F, 0xFD, 0xE4,
-    0x7F, 0xFE, 0x1A, 0x7F, 0xFE, 0x2C, 0x7F, 0xFE, 0x45, 0x7F, 0xFE, 0x48, 0x7F, 0xFE, 0x66, 0x7F,
-    0xFE, 0x9A, 0x7E, 0xF8, 0x6C, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xFC, 0x61, 0x74,
+    0x69, 0xC3, 0x6B, 0xEE, 0x06, 0xF1, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6E, 0x6F, 0x70, 0x73,
+    0x74, 0x75, 0x77, 0xC3, 0x7F, 0xFC, 0x9E, 0x7F, 0xFC, 0xEC, 0x7F, 0xFD, 0xE4, 0x7F, 0xFE, 0x1A,
+    0x7F, 0xFE, 0x2C, 0x7F, 0xFE, 0x45, 0x7F, 0xFE, 0x48, 0x7F, 0xFE, 0x66, 0x7F, 0xFE, 0x9A, 0x7E,
+    0xF8, 0x6C, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xFC, 0x7F, 0xFC, 0xDC, 0x61, 0x74,
     0x7E, 0xF9, 0xBA, 0x21, 0x6E, 0xFB, 0x21, 0x65, 0xFD, 0x62, 0x2E, 0x65, 0x7E, 0xEB, 0xB4, 0x7E,
     0xEB, 0xB4, 0x62, 0x61, 0x74, 0x7E, 0xED, 0x1B, 0x7F, 0xFF, 0xF7, 0x64, 0x6C, 0x6F, 0x70, 0x74,
     0x7E, 0xED, 0x12, 0x7F, 0x0B, 0x0D, 0x7E, 0xED, 0x12, 0x7E, 0xED, 0x12, 0xE7, 0x00, 0xB1, 0x2E,
@@ -4974,10 +4974,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x64, 0x64, 0x65, 0x66, 0x67, 0x7E, 0xE7, 0xE1, 0x7F, 0xB3, 0x2E, 0x7E, 0xE8, 0x6D, 0x7E, 0xFB,
     0xF4, 0x62, 0x6B, 0x73, 0x7E, 0xE9, 0x48, 0x7E, 0xE9, 0x48, 0x65, 0x65, 0x68, 0x6D, 0x6E, 0x72,
     0x7E, 0xD6, 0x0F, 0x7E, 0xE7, 0xC7, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x61,
-    0x61, 0x7E, 0xE0, 0xD7, 0xED, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72,
-    0x73, 0x75, 0x77, 0x7A, 0x7F, 0xFB, 0x82, 0x7F, 0xFB, 0xC5, 0x7F, 0xFD, 0xA0, 0x7F, 0xFD, 0xE5,
-    0x7F, 0xFE, 0x22, 0x7E, 0xE7, 0xAD, 0x7E, 0xE1, 0x4C, 0x7F, 0xFE, 0x6B, 0x7F, 0xFF, 0x0F, 0x7F,
-    0xFF, 0xA6, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xFB, 0x7E, 0xCD, 0x95, 0x61, 0x7A, 0x7E, 0xF5, 0x55,
+    0x61, 0x7E, 0xE0, 0xD7, 0xED, 0x06, 0xF1, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73,
+    0x75, 0x77, 0x7A, 0xC3, 0x7F, 0xFB, 0x82, 0x7F, 0xFD, 0xA0, 0x7F, 0xFD, 0xE5, 0x7F, 0xFE, 0x22,
+    0x7E, 0xE7, 0xAD, 0x7E, 0xE1, 0x4C, 0x7F, 0xFE, 0x6B, 0x7F, 0xFF, 0x0F, 0x7F, 0xFF, 0xA6, 0x7F,
+    0xFF, 0xE6, 0x7F, 0xFF, 0xFB, 0x7E, 0xCD, 0x95, 0x7F, 0xFB, 0xC5, 0x61, 0x7A, 0x7E, 0xF5, 0x55,
     0x64, 0x69, 0x6C, 0x6E, 0x72, 0x7E, 0xE6, 0xD1, 0x7E, 0xE6, 0xD1, 0x7F, 0x19, 0xCF, 0x7F, 0xFF,
     0xFB, 0x67, 0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75, 0x7E, 0xE6, 0x89, 0x7F, 0xFF, 0xEF, 0x7E,
     0xE6, 0x53, 0x7E, 0xE6, 0x89, 0x7E, 0xE6, 0x89, 0x7E, 0xE6, 0x89, 0x7E, 0xE6, 0x53, 0x61, 0x74,
@@ -5025,13 +5025,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xCA, 0x21, 0x72, 0xFB, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x68, 0x64, 0x67, 0x6C, 0x6D, 0x6F,
     0x70, 0x73, 0x74, 0x7F, 0xFF, 0xD0, 0x7E, 0xE5, 0x7E, 0x7F, 0xFF, 0xDF, 0x7F, 0x04, 0x81, 0x7F,
     0xFF, 0xE4, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFD, 0x7E, 0xE4, 0xE0, 0x61, 0x67, 0x7E, 0xCA, 0x01,
-    0xE2, 0x06, 0xF1, 0x75, 0x77, 0x7F, 0xFF, 0xFB, 0x7E, 0xE3, 0x74, 0x78, 0x61, 0xC3, 0x62, 0x63,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75,
-    0x76, 0x77, 0x79, 0x7A, 0x7F, 0xDD, 0x59, 0x7F, 0xDE, 0x77, 0x7F, 0xDE, 0x96, 0x7F, 0xDE, 0xA4,
-    0x7F, 0xDE, 0xAF, 0x7F, 0xE4, 0x8C, 0x7F, 0xE4, 0xE4, 0x7F, 0xE4, 0xFE, 0x7F, 0xE5, 0x30, 0x7F,
-    0xE7, 0x4E, 0x7F, 0xE7, 0x9F, 0x7F, 0xEA, 0x4B, 0x7F, 0xEB, 0xBB, 0x7F, 0xED, 0x39, 0x7F, 0xEF,
-    0x93, 0x7F, 0xEF, 0xE8, 0x7F, 0xF3, 0x82, 0x7F, 0xF7, 0x98, 0x7F, 0xFC, 0xC9, 0x7F, 0xFF, 0x16,
-    0x7E, 0xE4, 0x73, 0x7F, 0xFF, 0x96, 0x7F, 0xFF, 0xCF, 0x7F, 0xFF, 0xF5, 0x62, 0x65, 0x6C, 0x7E,
+    0xE2, 0x06, 0xF1, 0x75, 0x77, 0x7F, 0xFF, 0xFB, 0x7E, 0xE3, 0x74, 0x78, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x79, 0x7A, 0xC3, 0x7F, 0xDD, 0x59, 0x7F, 0xDE, 0x96, 0x7F, 0xDE, 0xA4, 0x7F, 0xDE, 0xAF,
+    0x7F, 0xE4, 0x8C, 0x7F, 0xE4, 0xE4, 0x7F, 0xE4, 0xFE, 0x7F, 0xE5, 0x30, 0x7F, 0xE7, 0x4E, 0x7F,
+    0xE7, 0x9F, 0x7F, 0xEA, 0x4B, 0x7F, 0xEB, 0xBB, 0x7F, 0xED, 0x39, 0x7F, 0xEF, 0x93, 0x7F, 0xEF,
+    0xE8, 0x7F, 0xF3, 0x82, 0x7F, 0xF7, 0x98, 0x7F, 0xFC, 0xC9, 0x7F, 0xFF, 0x16, 0x7E, 0xE4, 0x73,
+    0x7F, 0xFF, 0x96, 0x7F, 0xFF, 0xCF, 0x7F, 0xFF, 0xF5, 0x7F, 0xDE, 0x77, 0x62, 0x65, 0x6C, 0x7E,
     0xEF, 0xC7, 0x7E, 0xC9, 0xFD, 0x64, 0x2E, 0x61, 0x6E, 0x6F, 0x7E, 0xE3, 0x09, 0x7E, 0xC9, 0xF4,
     0x7E, 0xE3, 0x09, 0x7E, 0xE4, 0x0C, 0x66, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x7A, 0x7E, 0xE2, 0xF8,
     0x7E, 0xE3, 0xFB, 0x7E, 0xE2, 0xF8, 0x7E, 0xE3, 0xFB, 0x7E, 0xE2, 0xF8, 0x7E, 0xE2, 0xF8, 0xA0,
@@ -5046,26 +5046,26 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0xEB, 0x88, 0x7E, 0xE2, 0x7C, 0x7E, 0xE2, 0x7C, 0x7E, 0xE2, 0x7C, 0x7E, 0xE2, 0x7C, 0xE1,
     0x02, 0xE2, 0x72, 0x7E, 0xE2, 0x6E, 0x61, 0x70, 0x7E, 0xE5, 0xB4, 0x64, 0x67, 0x73, 0x74, 0x7A,
     0x7F, 0xFF, 0xFB, 0x7F, 0x65, 0x91, 0x7F, 0x65, 0x86, 0x7F, 0x65, 0x89, 0xA0, 0x24, 0x24, 0x6D,
-    0x62, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0xC3, 0x70, 0x73, 0x77, 0x7A, 0x7F, 0x65, 0x7D,
+    0x62, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x73, 0x77, 0x7A, 0xC3, 0x7F, 0x65, 0x7D,
     0x7F, 0x65, 0x72, 0x7F, 0x65, 0x72, 0x7F, 0xFF, 0xFD, 0x7F, 0x65, 0x72, 0x7F, 0x65, 0x72, 0x7F,
-    0x65, 0x72, 0x7F, 0x65, 0x72, 0x7F, 0xEA, 0xFA, 0x7F, 0x65, 0x72, 0x7F, 0x65, 0x72, 0x7E, 0xCA,
-    0x04, 0x7F, 0x65, 0x72, 0xA0, 0x24, 0x64, 0x6A, 0x62, 0x66, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72,
+    0x65, 0x72, 0x7F, 0x65, 0x72, 0x7F, 0x65, 0x72, 0x7F, 0x65, 0x72, 0x7E, 0xCA, 0x04, 0x7F, 0x65,
+    0x72, 0x7F, 0xEA, 0xFA, 0xA0, 0x24, 0x64, 0x6A, 0x62, 0x66, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72,
     0x74, 0x78, 0x7E, 0xF5, 0x9D, 0x7E, 0xE1, 0xF7, 0x7E, 0xE3, 0xA3, 0x7E, 0xF5, 0x9D, 0x7F, 0xFF,
     0xAF, 0x7F, 0xFF, 0xB4, 0x7E, 0xF5, 0x9D, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xFD, 0x7E, 0xE1, 0xF7,
     0xE3, 0x02, 0xF1, 0x61, 0x64, 0x6E, 0x7E, 0xF5, 0x74, 0x7F, 0x65, 0x3D, 0x7F, 0x65, 0x3D, 0xE1,
     0x02, 0x61, 0x65, 0x7E, 0xC9, 0x45, 0x64, 0x62, 0x6E, 0x70, 0x72, 0x7E, 0xE1, 0xD7, 0x7E, 0xE2,
-    0x1B, 0x7E, 0xE1, 0xD7, 0x7E, 0xEA, 0xAE, 0xED, 0x06, 0xB1, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x69,
-    0x6B, 0x6C, 0x6F, 0x70, 0x73, 0x75, 0x7A, 0x7F, 0xFF, 0x58, 0x7E, 0xF6, 0x1D, 0x7F, 0x2C, 0x64,
-    0x7E, 0xC8, 0x22, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xD9, 0x7E, 0xC8, 0x25, 0x7F, 0xFF, 0xE8, 0x7F,
-    0xFF, 0xEF, 0x7E, 0xC8, 0x25, 0x7E, 0xDA, 0x14, 0x7E, 0xEA, 0x60, 0x7E, 0xC8, 0x25, 0xE1, 0x02,
+    0x1B, 0x7E, 0xE1, 0xD7, 0x7E, 0xEA, 0xAE, 0xED, 0x06, 0xB1, 0x61, 0x62, 0x64, 0x65, 0x69, 0x6B,
+    0x6C, 0x6F, 0x70, 0x73, 0x75, 0x7A, 0xC3, 0x7F, 0xFF, 0x58, 0x7F, 0x2C, 0x64, 0x7E, 0xC8, 0x22,
+    0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xD9, 0x7E, 0xC8, 0x25, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xEF, 0x7E,
+    0xC8, 0x25, 0x7E, 0xDA, 0x14, 0x7E, 0xEA, 0x60, 0x7E, 0xC8, 0x25, 0x7E, 0xF6, 0x1D, 0xE1, 0x02,
     0x61, 0x65, 0x7E, 0xC9, 0x3F, 0x62, 0x70, 0x75, 0x7F, 0xFF, 0xF9, 0x7E, 0xE2, 0x6C, 0xE1, 0x05,
     0x62, 0x74, 0x7E, 0xC7, 0xE1, 0x65, 0x62, 0x65, 0x6C, 0x72, 0x75, 0x7E, 0xE1, 0x59, 0x7E, 0xE1,
     0xBC, 0x7F, 0xFF, 0xF9, 0x7E, 0xE1, 0x78, 0x7E, 0xF4, 0xFF, 0xA0, 0x20, 0x22, 0xE3, 0x02, 0xF1,
     0x62, 0x69, 0x78, 0x7F, 0xFF, 0x47, 0x7E, 0xE1, 0x41, 0x7E, 0xE1, 0x41, 0xE2, 0x02, 0x61, 0x70,
     0x74, 0x7E, 0xC8, 0xB5, 0x7E, 0xC8, 0x1A, 0xE1, 0x02, 0x61, 0x61, 0x7E, 0xD8, 0xB9, 0x6C, 0x2E,
-    0x61, 0xC3, 0x63, 0x64, 0x65, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x7A, 0x7E, 0xE1, 0x20, 0x7F, 0xFF,
-    0xC7, 0x7F, 0x8C, 0x63, 0x7E, 0xFC, 0xC7, 0x7F, 0xFF, 0xDC, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xDC,
-    0x7E, 0xE1, 0x20, 0x7F, 0x49, 0x7C, 0x7F, 0xFF, 0xEE, 0x7E, 0xE1, 0x20, 0x7F, 0xFF, 0xF9, 0xE1,
+    0x61, 0x63, 0x64, 0x65, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x7A, 0xC3, 0x7E, 0xE1, 0x20, 0x7F, 0xFF,
+    0xC7, 0x7E, 0xFC, 0xC7, 0x7F, 0xFF, 0xDC, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xDC, 0x7E, 0xE1, 0x20,
+    0x7F, 0x49, 0x7C, 0x7F, 0xFF, 0xEE, 0x7E, 0xE1, 0x20, 0x7F, 0xFF, 0xF9, 0x7F, 0x8C, 0x63, 0xE1,
     0x07, 0xA1, 0x70, 0x7E, 0xE0, 0xE5, 0xE5, 0x06, 0xB1, 0x2E, 0x61, 0x65, 0x69, 0x72, 0x7E, 0xE0,
     0xE8, 0x7E, 0xFD, 0xCD, 0x7F, 0x06, 0x62, 0x7E, 0xE0, 0xDB, 0x7E, 0xC7, 0x66, 0xE1, 0x00, 0xB1,
     0x72, 0x7E, 0xC7, 0x4C, 0x62, 0x61, 0x72, 0x7E, 0xE1, 0xCD, 0x7E, 0xE9, 0x9B, 0x68, 0x2E, 0x62,
@@ -5122,11 +5122,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xC4, 0x8F, 0x7E, 0xC4, 0x8F, 0x7E, 0xC4, 0x8F, 0x61, 0x2E, 0x7E, 0xCF, 0x55, 0x63, 0x62, 0x69,
     0x6E, 0x7E, 0xC4, 0x79, 0x7F, 0xBF, 0xAC, 0x7F, 0xFF, 0xFB, 0x65, 0x61, 0x65, 0x69, 0x6F, 0x72,
     0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xF3, 0x7E, 0xCC, 0x54, 0x7E, 0xCB, 0x43, 0x7E, 0xC5, 0x07, 0xE2,
-    0x20, 0x22, 0x66, 0x72, 0x7E, 0xC3, 0xEA, 0x7E, 0xDE, 0xFE, 0x6E, 0x2E, 0x61, 0xC3, 0x65, 0x69,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7E, 0xDE, 0xF3, 0x7F, 0xFF, 0x04, 0x7F,
-    0xFF, 0x1F, 0x7F, 0xFF, 0x48, 0x7F, 0xFF, 0x5F, 0x7F, 0xFF, 0x6E, 0x7F, 0xFF, 0x7F, 0x7E, 0xE1,
-    0x0E, 0x7F, 0xFF, 0x86, 0x7F, 0xFF, 0x93, 0x7F, 0xFF, 0xA8, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF5,
-    0x7E, 0xC3, 0xDF, 0x61, 0x66, 0x7E, 0xE0, 0xFA, 0x21, 0x72, 0xFB, 0xA0, 0x0A, 0xA3, 0xA1, 0x02,
+    0x20, 0x22, 0x66, 0x72, 0x7E, 0xC3, 0xEA, 0x7E, 0xDE, 0xFE, 0x6E, 0x2E, 0x61, 0x65, 0x69, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0xC3, 0x7E, 0xDE, 0xF3, 0x7F, 0xFF, 0x04, 0x7F,
+    0xFF, 0x48, 0x7F, 0xFF, 0x5F, 0x7F, 0xFF, 0x6E, 0x7F, 0xFF, 0x7F, 0x7E, 0xE1, 0x0E, 0x7F, 0xFF,
+    0x86, 0x7F, 0xFF, 0x93, 0x7F, 0xFF, 0xA8, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF5, 0x7E, 0xC3, 0xDF,
+    0x7F, 0xFF, 0x1F, 0x61, 0x66, 0x7E, 0xE0, 0xFA, 0x21, 0x72, 0xFB, 0xA0, 0x0A, 0xA3, 0xA1, 0x02,
     0xF1, 0x73, 0xFD, 0x62, 0x61, 0x69, 0x7E, 0xC3, 0x9C, 0x7E, 0xC3, 0x9C, 0x64, 0x61, 0x6B, 0x70,
     0x74, 0x7E, 0xC3, 0x8D, 0x7E, 0xC3, 0x8D, 0x7E, 0xC5, 0x55, 0x7F, 0xFF, 0xF7, 0x64, 0x65, 0x6F,
     0x73, 0x74, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xEF, 0x7E, 0xC7, 0x9E, 0xE7, 0x06,
@@ -5148,10 +5148,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6F, 0x7E, 0xE2, 0xD7, 0x7F, 0xFF, 0xF5, 0xE1, 0x02, 0xF1, 0x2E, 0x7E, 0xDC, 0x93, 0x63, 0x6C,
     0x72, 0x73, 0x7F, 0xFF, 0xF9, 0x7E, 0xDB, 0xF0, 0x7E, 0xDC, 0x53, 0xE1, 0x06, 0xA2, 0x6F, 0x7E,
     0xDC, 0x02, 0x64, 0x61, 0x65, 0x70, 0x74, 0x7E, 0xE8, 0x91, 0x7E, 0xDE, 0x61, 0x7E, 0xD5, 0xA6,
-    0x7F, 0x89, 0x27, 0xE1, 0x00, 0x91, 0x6E, 0x7E, 0xC2, 0x46, 0x21, 0x65, 0xF9, 0x6C, 0x61, 0xC3,
-    0x65, 0x66, 0x67, 0x69, 0x6F, 0x72, 0x73, 0x75, 0x77, 0x79, 0x7F, 0xFF, 0x07, 0x7F, 0xFF, 0x27,
-    0x7F, 0xFF, 0x94, 0x7E, 0xDC, 0xC1, 0x7F, 0xFF, 0xB1, 0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xD1, 0x7F,
-    0xFF, 0xDE, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xFD, 0x7F, 0x09, 0xDC, 0x7E, 0xDD, 0x9B, 0x62, 0x62,
+    0x7F, 0x89, 0x27, 0xE1, 0x00, 0x91, 0x6E, 0x7E, 0xC2, 0x46, 0x21, 0x65, 0xF9, 0x6C, 0x61, 0x65,
+    0x66, 0x67, 0x69, 0x6F, 0x72, 0x73, 0x75, 0x77, 0x79, 0xC3, 0x7F, 0xFF, 0x07, 0x7F, 0xFF, 0x94,
+    0x7E, 0xDC, 0xC1, 0x7F, 0xFF, 0xB1, 0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xD1, 0x7F, 0xFF, 0xDE, 0x7F,
+    0xFF, 0xE5, 0x7F, 0xFF, 0xFD, 0x7F, 0x09, 0xDC, 0x7E, 0xDD, 0x9B, 0x7F, 0xFF, 0x27, 0x62, 0x62,
     0x63, 0x7E, 0xDB, 0xAF, 0x7F, 0x02, 0x57, 0x63, 0x65, 0x69, 0x72, 0x7E, 0xC2, 0x6F, 0x7E, 0xC2,
     0x6F, 0x7F, 0x28, 0x34, 0x64, 0x65, 0x69, 0x6F, 0x74, 0x7E, 0xC2, 0xAB, 0x7E, 0xC2, 0xFD, 0x7E,
     0xC2, 0x62, 0x7F, 0xFF, 0xF3, 0x64, 0x61, 0x6C, 0x73, 0x75, 0x7F, 0xFF, 0xD9, 0x7F, 0x2C, 0xB7,
@@ -5211,10 +5211,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x65, 0x66, 0x68, 0x6E, 0x7E, 0xBE, 0x8C, 0x7E, 0xBE, 0x8C, 0x7E, 0xBE, 0x8C, 0x7E, 0xD9,
     0x14, 0x7E, 0xBE, 0xF6, 0x61, 0x68, 0x7E, 0xBF, 0x4B, 0x64, 0x61, 0x65, 0x6B, 0x74, 0x7F, 0x15,
     0xF5, 0x7F, 0xFF, 0xFB, 0x7E, 0xC1, 0x04, 0x7E, 0xBF, 0xCA, 0xE2, 0x00, 0x51, 0x6E, 0x74, 0x7F,
-    0x40, 0x40, 0x7E, 0xD8, 0x47, 0x6D, 0x61, 0x65, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0xC3, 0x72,
-    0x73, 0x74, 0x75, 0x7F, 0xFF, 0x5D, 0x7F, 0xFF, 0x87, 0x7F, 0xFF, 0xA3, 0x7E, 0xBE, 0x8D, 0x7E,
-    0xBE, 0x54, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xC8, 0x7E, 0xC7, 0x28, 0x7E, 0xCC,
-    0x96, 0x7F, 0xFF, 0xE4, 0x7E, 0xC1, 0x98, 0x7F, 0xFF, 0xF5, 0x62, 0x64, 0x73, 0x7E, 0xBE, 0x5B,
+    0x40, 0x40, 0x7E, 0xD8, 0x47, 0x6D, 0x61, 0x65, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73,
+    0x74, 0x75, 0xC3, 0x7F, 0xFF, 0x5D, 0x7F, 0xFF, 0x87, 0x7F, 0xFF, 0xA3, 0x7E, 0xBE, 0x8D, 0x7E,
+    0xBE, 0x54, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xC8, 0x7E, 0xCC, 0x96, 0x7F, 0xFF,
+    0xE4, 0x7E, 0xC1, 0x98, 0x7F, 0xFF, 0xF5, 0x7E, 0xC7, 0x28, 0x62, 0x64, 0x73, 0x7E, 0xBE, 0x5B,
     0x7E, 0xC2, 0x45, 0x62, 0x69, 0x6E, 0x7E, 0xC3, 0xBB, 0x7F, 0xFF, 0xF7, 0xE1, 0x00, 0x51, 0x65,
     0x7E, 0xD7, 0xF5, 0x62, 0xB6, 0xBC, 0x7E, 0xD7, 0x81, 0x7E, 0xD7, 0x8B, 0x61, 0x6C, 0x7E, 0xBE,
     0x7A, 0x63, 0x6C, 0x6E, 0x72, 0x7E, 0xBE, 0x65, 0x7E, 0xEE, 0x89, 0x7F, 0xFF, 0xFB, 0x62, 0x65,
@@ -5236,11 +5236,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xE6, 0x7E, 0xD6, 0x97, 0x7F, 0xFF, 0xF7, 0x66, 0x65, 0x68, 0x6D, 0x6E, 0x72, 0x73, 0x7E,
     0xBD, 0x61, 0x7E, 0xD7, 0x79, 0x7E, 0xD8, 0xF1, 0x7E, 0xD7, 0x79, 0x7F, 0x00, 0x02, 0x7E, 0xBC,
     0xF1, 0x76, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0xC3, 0x74, 0x75, 0x77, 0x78, 0x7A, 0x7E, 0xE2, 0xEE, 0x7F, 0xFA, 0xF4, 0x7F, 0xFB,
+    0x72, 0x73, 0x74, 0x75, 0x77, 0x78, 0x7A, 0xC3, 0x7E, 0xE2, 0xEE, 0x7F, 0xFA, 0xF4, 0x7F, 0xFB,
     0x15, 0x7F, 0xFB, 0x31, 0x7F, 0xFB, 0x46, 0x7F, 0xFB, 0x74, 0x7F, 0xFB, 0xA4, 0x7F, 0xFB, 0xB5,
     0x7F, 0xFB, 0xD0, 0x7F, 0xFC, 0xCD, 0x7F, 0xFC, 0xF6, 0x7F, 0xFD, 0xA0, 0x7F, 0x1B, 0x0B, 0x7F,
-    0xFD, 0xCF, 0x7F, 0xFE, 0x84, 0x7F, 0xFF, 0x07, 0x7F, 0xFF, 0x3D, 0x7F, 0xFF, 0xC6, 0x7F, 0xFF,
-    0xE7, 0x7F, 0xC8, 0xE0, 0x7F, 0x62, 0x54, 0x7F, 0xA7, 0x77, 0x61, 0x67, 0x7E, 0xD7, 0xB3, 0x62,
+    0xFD, 0xCF, 0x7F, 0xFE, 0x84, 0x7F, 0xFF, 0x07, 0x7F, 0xFF, 0xC6, 0x7F, 0xFF, 0xE7, 0x7F, 0xC8,
+    0xE0, 0x7F, 0x62, 0x54, 0x7F, 0xA7, 0x77, 0x7F, 0xFF, 0x3D, 0x61, 0x67, 0x7E, 0xD7, 0xB3, 0x62,
     0x69, 0x6D, 0x7E, 0xD5, 0xFF, 0x7E, 0xD8, 0x7A, 0x65, 0x65, 0x66, 0x6E, 0x72, 0x75, 0x7E, 0xE1,
     0xCE, 0x7E, 0xE0, 0xDB, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xF7, 0x7E, 0xE0, 0xDB, 0x41, 0x6E, 0xF6,
     0x65, 0x62, 0x65, 0x73, 0x7F, 0xA2, 0x2D, 0x7E, 0xC6, 0x7D, 0xE2, 0x00, 0xB1, 0x65, 0x74, 0x7E,
@@ -5347,10 +5347,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x65, 0x7E, 0xCF, 0xF8, 0x63, 0x65, 0x6F, 0x72, 0x7F, 0xFF, 0xEE, 0x7F, 0x6F, 0xF6, 0x7F, 0xFF,
     0xFB, 0x62, 0x66, 0x73, 0x7E, 0xD0, 0x80, 0x7E, 0xD2, 0xE9, 0x67, 0x65, 0x6D, 0x6E, 0x70, 0x72,
     0x73, 0x74, 0x7E, 0xD2, 0x6B, 0x7F, 0xA4, 0x71, 0x7F, 0xFF, 0xF7, 0x7E, 0xCF, 0x67, 0x7E, 0xEC,
-    0xC4, 0x7E, 0xCF, 0x74, 0x7E, 0xF9, 0x2D, 0xED, 0x06, 0xB1, 0x61, 0xC3, 0x62, 0x65, 0x69, 0x6C,
-    0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7F, 0xFE, 0x41, 0x7F, 0xFE, 0x84, 0x7F, 0x09, 0xBF,
-    0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x3A, 0x7F, 0xFF, 0x65, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x77, 0x7F,
-    0xFF, 0x8E, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xCD, 0x7F, 0xFF, 0xE3, 0x7E, 0xCF, 0x4A, 0x64, 0x62,
+    0xC4, 0x7E, 0xCF, 0x74, 0x7E, 0xF9, 0x2D, 0xED, 0x06, 0xB1, 0x61, 0x62, 0x65, 0x69, 0x6C, 0x6E,
+    0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0xC3, 0x7F, 0xFE, 0x41, 0x7F, 0x09, 0xBF, 0x7F, 0xFF, 0x00,
+    0x7F, 0xFF, 0x3A, 0x7F, 0xFF, 0x65, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x77, 0x7F, 0xFF, 0x8E, 0x7F,
+    0xFF, 0xA3, 0x7F, 0xFF, 0xCD, 0x7F, 0xFF, 0xE3, 0x7E, 0xCF, 0x4A, 0x7F, 0xFE, 0x84, 0x64, 0x62,
     0x6C, 0x72, 0x74, 0x7E, 0xD0, 0x23, 0x7E, 0xD0, 0x23, 0x7E, 0xD7, 0xF1, 0x7E, 0xD1, 0x9B, 0x69,
     0x61, 0x62, 0x65, 0x66, 0x68, 0x6D, 0x6F, 0x73, 0x7A, 0x7E, 0xD0, 0x12, 0x7E, 0xD0, 0x9E, 0x7E,
     0xBA, 0x8E, 0x7E, 0xD0, 0x9E, 0x7E, 0xD0, 0x9E, 0x7E, 0xD1, 0x8A, 0x7E, 0xD1, 0x8A, 0x7E, 0xD0,
@@ -5406,10 +5406,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xDC, 0x7E, 0xD6, 0xCE, 0x63, 0x6E, 0x72, 0x75, 0x7E, 0xCC, 0x3D, 0x7E, 0xCC, 0x3D, 0x7E, 0xCB,
     0xF9, 0xE1, 0x01, 0x61, 0x73, 0x7E, 0xCC, 0x33, 0x62, 0x72, 0x73, 0x7E, 0xBD, 0x81, 0x7F, 0xFF,
     0xF9, 0x63, 0x61, 0x65, 0x77, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xF7, 0x7E, 0xD3, 0xC9, 0x70, 0x61,
-    0xC3, 0x63, 0x64, 0x65, 0x66, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x75, 0x76, 0x7A, 0x7F,
-    0xFC, 0xE4, 0x7F, 0xFD, 0x16, 0x7F, 0xFD, 0x2A, 0x7F, 0xFD, 0x7D, 0x7F, 0xFE, 0x68, 0x7F, 0xFE,
-    0xA8, 0x7F, 0xFE, 0xD3, 0x7E, 0xB2, 0x9B, 0x7F, 0xFF, 0x02, 0x7F, 0xFF, 0x6D, 0x7E, 0xB2, 0x9B,
-    0x7F, 0xFF, 0x8B, 0x7F, 0xFF, 0xB6, 0x7F, 0xFF, 0xC7, 0x7E, 0xB2, 0x9B, 0x7F, 0xFF, 0xF3, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x75, 0x76, 0x7A, 0xC3, 0x7F,
+    0xFC, 0xE4, 0x7F, 0xFD, 0x2A, 0x7F, 0xFD, 0x7D, 0x7F, 0xFE, 0x68, 0x7F, 0xFE, 0xA8, 0x7F, 0xFE,
+    0xD3, 0x7E, 0xB2, 0x9B, 0x7F, 0xFF, 0x02, 0x7F, 0xFF, 0x6D, 0x7E, 0xB2, 0x9B, 0x7F, 0xFF, 0x8B,
+    0x7F, 0xFF, 0xB6, 0x7F, 0xFF, 0xC7, 0x7E, 0xB2, 0x9B, 0x7F, 0xFF, 0xF3, 0x7F, 0xFD, 0x16, 0x62,
     0x6C, 0x72, 0x7E, 0xCC, 0x72, 0x7E, 0xCC, 0x72, 0x61, 0x65, 0x7F, 0x14, 0xC9, 0x63, 0x64, 0x68,
     0x77, 0x7E, 0xB2, 0x46, 0x7E, 0xCC, 0xF0, 0x7E, 0xCC, 0xF0, 0x64, 0x63, 0x65, 0x6D, 0x74, 0x7E,
     0xCC, 0xE3, 0x7E, 0xF6, 0xC4, 0x7E, 0xCD, 0xCF, 0x7E, 0xCD, 0xCF, 0x61, 0x7A, 0x7E, 0xB1, 0xBE,
@@ -5434,10 +5434,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0xCA, 0x8A, 0x21, 0x65, 0xF7, 0x65, 0x61, 0x66, 0x6C, 0x73, 0x75, 0x7F, 0xFF, 0xD3, 0x7F,
     0xFF, 0xE3, 0x7F, 0xFF, 0xFD, 0x7E, 0xF3, 0xD1, 0x7E, 0xCA, 0xB4, 0x61, 0x70, 0x7E, 0xB0, 0xEE,
     0x62, 0x68, 0x73, 0x7E, 0xC9, 0xF4, 0x7E, 0xB9, 0xFB, 0xE3, 0x06, 0xF1, 0x6C, 0x6D, 0x72, 0x7E,
-    0xD8, 0x57, 0x7E, 0xC9, 0xEB, 0x7F, 0x6D, 0x51, 0x6C, 0x61, 0xC3, 0x62, 0x65, 0x68, 0x69, 0x6D,
-    0x6F, 0x70, 0x73, 0x74, 0x75, 0x7F, 0xFE, 0xB7, 0x7F, 0xFE, 0xED, 0x7E, 0xCA, 0xE9, 0x7F, 0xFF,
-    0x17, 0x7F, 0xFF, 0x44, 0x7F, 0xFF, 0x51, 0x7F, 0xFF, 0x83, 0x7F, 0xFF, 0x98, 0x7F, 0xFF, 0xCE,
-    0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF1, 0x63, 0x6F, 0x72, 0x75, 0x7E, 0xC9, 0xB5,
+    0xD8, 0x57, 0x7E, 0xC9, 0xEB, 0x7F, 0x6D, 0x51, 0x6C, 0x61, 0x62, 0x65, 0x68, 0x69, 0x6D, 0x6F,
+    0x70, 0x73, 0x74, 0x75, 0xC3, 0x7F, 0xFE, 0xB7, 0x7E, 0xCA, 0xE9, 0x7F, 0xFF, 0x17, 0x7F, 0xFF,
+    0x44, 0x7F, 0xFF, 0x51, 0x7F, 0xFF, 0x83, 0x7F, 0xFF, 0x98, 0x7F, 0xFF, 0xCE, 0x7F, 0xFF, 0xE3,
+    0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF1, 0x7F, 0xFE, 0xED, 0x63, 0x6F, 0x72, 0x75, 0x7E, 0xC9, 0xB5,
     0x7E, 0xB0, 0x9D, 0x7E, 0xCA, 0xB8, 0xE2, 0x00, 0xB1, 0x68, 0x6B, 0x7F, 0x29, 0x2D, 0x7E, 0xCA,
     0xAB, 0x63, 0x68, 0x73, 0x75, 0x7E, 0xCA, 0xA0, 0x7E, 0xE0, 0xF7, 0x7E, 0xCA, 0xA0, 0xE1, 0x00,
     0xA1, 0x65, 0x7E, 0xB4, 0xA2, 0xE2, 0x02, 0x61, 0x6E, 0x72, 0x7E, 0xB0, 0x40, 0x7F, 0xFF, 0xF9,
@@ -5526,11 +5526,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xB4, 0xE4, 0x00, 0xE1, 0x61, 0x65, 0x69, 0x6C, 0x7E, 0xAE, 0xFE, 0x7E, 0xAC, 0x7D, 0x7E, 0xAB,
     0x11, 0x7F, 0xD4, 0x5A, 0x21, 0x6C, 0xED, 0xE1, 0x0B, 0x52, 0x70, 0x7E, 0xAC, 0x16, 0x64, 0x65,
     0x69, 0x75, 0x77, 0x7F, 0xFF, 0xF6, 0x7E, 0xD0, 0x5C, 0x7F, 0xFF, 0xF9, 0x7E, 0xAB, 0x2B, 0x73,
-    0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75,
-    0x76, 0x79, 0x7A, 0x7F, 0xFB, 0x1B, 0x7F, 0xFB, 0x6A, 0x7F, 0xFB, 0x77, 0x7F, 0xFC, 0x00, 0x7F,
-    0xFC, 0xD4, 0x7F, 0xFD, 0x1A, 0x7F, 0xFD, 0x65, 0x7F, 0xFD, 0x94, 0x7F, 0xFD, 0xB4, 0x7F, 0xFD,
-    0xCD, 0x7F, 0xFE, 0x02, 0x7F, 0xFE, 0x46, 0x7F, 0xFE, 0x6F, 0x7F, 0xFF, 0x25, 0x7F, 0xFF, 0x7F,
-    0x7F, 0xFF, 0xA5, 0x7F, 0xFF, 0xC9, 0x7E, 0xC4, 0x3A, 0x7F, 0xFF, 0xEF, 0xE4, 0x06, 0xB1, 0x61,
+    0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x76,
+    0x79, 0x7A, 0xC3, 0x7F, 0xFB, 0x1B, 0x7F, 0xFB, 0x77, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0xD4, 0x7F,
+    0xFD, 0x1A, 0x7F, 0xFD, 0x65, 0x7F, 0xFD, 0x94, 0x7F, 0xFD, 0xB4, 0x7F, 0xFD, 0xCD, 0x7F, 0xFE,
+    0x02, 0x7F, 0xFE, 0x46, 0x7F, 0xFE, 0x6F, 0x7F, 0xFF, 0x25, 0x7F, 0xFF, 0x7F, 0x7F, 0xFF, 0xA5,
+    0x7F, 0xFF, 0xC9, 0x7E, 0xC4, 0x3A, 0x7F, 0xFF, 0xEF, 0x7F, 0xFB, 0x6A, 0xE4, 0x06, 0xB1, 0x61,
     0x65, 0x69, 0x75, 0x7E, 0xC3, 0xD5, 0x7E, 0xC3, 0xD8, 0x7E, 0xAA, 0xAB, 0x7E, 0xC3, 0xD5, 0x68,
     0x64, 0x66, 0x6B, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x7E, 0xD0, 0x60, 0x7E, 0xAA, 0xBA, 0x7F, 0x0D,
     0x8B, 0x7E, 0xD0, 0x60, 0x7E, 0xB0, 0xCA, 0x7E, 0xC4, 0xD2, 0x7F, 0xE3, 0xBC, 0x7E, 0xAA, 0xBA,
@@ -5588,10 +5588,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x75, 0x7F, 0xFF, 0xFD, 0x7E, 0xCD, 0x13, 0x7F, 0x9A, 0x6E, 0x7E, 0xC1, 0x85, 0x62, 0x65, 0x74,
     0x7E, 0xA7, 0xF4, 0x7E, 0xA7, 0x59, 0x63, 0x65, 0x72, 0x73, 0x7F, 0x06, 0x1D, 0x7E, 0xB1, 0xDF,
     0x7F, 0xFF, 0xF7, 0xE2, 0x00, 0xB1, 0x65, 0x74, 0x7E, 0xA7, 0x7B, 0x7E, 0xA8, 0x30, 0xE3, 0x06,
-    0xB1, 0x65, 0x6D, 0x73, 0x7F, 0x4A, 0x25, 0x7E, 0xA7, 0x3B, 0x7F, 0xFF, 0xF5, 0x50, 0x61, 0xC3,
-    0x62, 0x63, 0x65, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0xFE, 0x5F,
-    0xFE, 0x97, 0xFE, 0xAA, 0xFE, 0xBD, 0xFE, 0xC2, 0xFE, 0xD2, 0xFE, 0xE0, 0xFE, 0xEC, 0xFF, 0x26,
-    0xFF, 0x5E, 0xFF, 0x6B, 0xFF, 0x72, 0xFF, 0x89, 0xFF, 0xBF, 0xFF, 0xD9, 0xFF, 0xF1, 0x61, 0x67,
+    0xB1, 0x65, 0x6D, 0x73, 0x7F, 0x4A, 0x25, 0x7E, 0xA7, 0x3B, 0x7F, 0xFF, 0xF5, 0x50, 0x61, 0x62,
+    0x63, 0x65, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0xC3, 0xFE, 0x5F,
+    0xFE, 0xAA, 0xFE, 0xBD, 0xFE, 0xC2, 0xFE, 0xD2, 0xFE, 0xE0, 0xFE, 0xEC, 0xFF, 0x26, 0xFF, 0x5E,
+    0xFF, 0x6B, 0xFF, 0x72, 0xFF, 0x89, 0xFF, 0xBF, 0xFF, 0xD9, 0xFF, 0xF1, 0xFE, 0x97, 0x61, 0x67,
     0x7E, 0xC2, 0x8B, 0xE2, 0x02, 0x61, 0x70, 0x74, 0x7E, 0xC2, 0x86, 0x7E, 0xC2, 0x86, 0x67, 0x62,
     0x66, 0x67, 0x68, 0x6E, 0x70, 0x72, 0x7E, 0xC1, 0x8F, 0x7E, 0xC1, 0x8F, 0x7E, 0xC2, 0x7B, 0x7E,
     0xC1, 0x8F, 0x7E, 0xC2, 0x7B, 0x7E, 0xC1, 0x8F, 0x7E, 0xC1, 0x8F, 0xE3, 0x00, 0xB1, 0x65, 0x67,
@@ -5666,10 +5666,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFB, 0x21, 0x68, 0xFB, 0xE1, 0x00, 0xB1, 0x70, 0x7E, 0xA2, 0x7F, 0x63, 0x6B, 0x6C, 0x74, 0x7E,
     0xBE, 0x0E, 0x7E, 0xBC, 0x96, 0x7E, 0xBE, 0x0E, 0x64, 0x63, 0x6D, 0x70, 0x72, 0x7F, 0xFF, 0xE9,
     0x7F, 0xFF, 0xEC, 0x7E, 0xCF, 0x2C, 0x7F, 0xFF, 0xF3, 0x61, 0x69, 0x7E, 0xDB, 0x73, 0x70, 0x61,
-    0xC3, 0x63, 0x65, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x76, 0x79, 0x7A, 0x7F,
-    0xFB, 0xA3, 0x7F, 0xFB, 0xD4, 0x7F, 0xFC, 0xAE, 0x7F, 0xFD, 0x56, 0x7F, 0xFD, 0xAC, 0x7F, 0xFD,
-    0xBD, 0x7F, 0xFD, 0xC2, 0x7F, 0xFD, 0xCB, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x51, 0x7F, 0xFE, 0xDE,
-    0x7F, 0xFF, 0xA4, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xFB, 0x7F, 0x5C, 0x2B, 0x7E, 0xAB, 0x43, 0x63,
+    0x63, 0x65, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x76, 0x79, 0x7A, 0xC3, 0x7F,
+    0xFB, 0xA3, 0x7F, 0xFC, 0xAE, 0x7F, 0xFD, 0x56, 0x7F, 0xFD, 0xAC, 0x7F, 0xFD, 0xBD, 0x7F, 0xFD,
+    0xC2, 0x7F, 0xFD, 0xCB, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x51, 0x7F, 0xFE, 0xDE, 0x7F, 0xFF, 0xA4,
+    0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xFB, 0x7F, 0x5C, 0x2B, 0x7E, 0xAB, 0x43, 0x7F, 0xFB, 0xD4, 0x63,
     0x66, 0x73, 0x74, 0x7E, 0xBC, 0x32, 0x7E, 0xBD, 0xAA, 0x7E, 0xB6, 0xA1, 0x62, 0x2E, 0x6E, 0x7F,
     0x3A, 0x17, 0x7F, 0x3A, 0x17, 0x62, 0x65, 0x73, 0x7F, 0xFF, 0xF7, 0x7E, 0xBC, 0xA8, 0x63, 0x61,
     0x6C, 0x74, 0x7E, 0xBD, 0x8B, 0x7E, 0xA1, 0x8B, 0x7F, 0xFF, 0xF7, 0xE3, 0x00, 0xA1, 0x68, 0x73,
@@ -5740,10 +5740,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x9D, 0xC5, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x7E, 0xDE, 0x8B, 0x7E, 0xE4, 0xAF, 0x7F, 0x70, 0x22,
     0x7E, 0xD4, 0xD2, 0x63, 0x63, 0x6E, 0x72, 0x7E, 0xBF, 0xE1, 0x7E, 0xA4, 0x43, 0x7F, 0xFF, 0xEF,
     0x65, 0x61, 0x65, 0x6F, 0xC3, 0x77, 0x7E, 0xB6, 0xD4, 0x7F, 0xFF, 0xF3, 0x7E, 0xC2, 0xFE, 0x7E,
-    0xC3, 0x05, 0x7E, 0xB6, 0xD4, 0x6C, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75,
-    0x79, 0x7A, 0x7F, 0xFC, 0x2A, 0x7F, 0xFC, 0x77, 0x7F, 0xFD, 0x6E, 0x7F, 0xFD, 0xA1, 0x7F, 0xFD,
-    0xFB, 0x7F, 0xFE, 0x2D, 0x7F, 0xFE, 0xC7, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x79, 0x7F, 0xFF, 0xB8,
-    0x7E, 0xB5, 0xA5, 0x7F, 0xFF, 0xEB, 0x61, 0x65, 0x7E, 0xA5, 0x68, 0xE2, 0x04, 0x51, 0x61, 0x73,
+    0xC3, 0x05, 0x7E, 0xB6, 0xD4, 0x6C, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79,
+    0x7A, 0xC3, 0x7F, 0xFC, 0x2A, 0x7F, 0xFD, 0x6E, 0x7F, 0xFD, 0xA1, 0x7F, 0xFD, 0xFB, 0x7F, 0xFE,
+    0x2D, 0x7F, 0xFE, 0xC7, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x79, 0x7F, 0xFF, 0xB8, 0x7E, 0xB5, 0xA5,
+    0x7F, 0xFF, 0xEB, 0x7F, 0xFC, 0x77, 0x61, 0x65, 0x7E, 0xA5, 0x68, 0xE2, 0x04, 0x51, 0x61, 0x73,
     0x7E, 0x9D, 0x11, 0x7F, 0xFF, 0xFB, 0xE4, 0x0B, 0xF3, 0x6C, 0x6D, 0x6E, 0x74, 0x7E, 0xC1, 0x6D,
     0x7F, 0xFF, 0xF5, 0x7E, 0x9D, 0x73, 0x7E, 0xB6, 0x88, 0xE3, 0x00, 0xA1, 0x66, 0x6D, 0x77, 0x7E,
     0x9D, 0xC9, 0x7E, 0xA1, 0x87, 0x7E, 0x9D, 0xC9, 0x62, 0x6E, 0x72, 0x7E, 0xA4, 0x9D, 0x7F, 0xFF,
@@ -5756,10 +5756,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x64, 0x68, 0x6C, 0x6F, 0xC3, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF2, 0x7E, 0x9C, 0xC7, 0x7F, 0xFF,
     0xFB, 0xE4, 0x00, 0x41, 0x63, 0x65, 0x68, 0x74, 0x7E, 0xB7, 0x7C, 0x7E, 0xB7, 0x7C, 0x7E, 0xB7,
     0x7C, 0x7E, 0xB7, 0x7C, 0x61, 0xBC, 0x7E, 0xB5, 0xCD, 0xA0, 0x25, 0xF4, 0x6E, 0x62, 0x63, 0x66,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0xC3, 0x78, 0x7E, 0xB5, 0xC5, 0x7E, 0xB5,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78, 0xC3, 0x7E, 0xB5, 0xC5, 0x7E, 0xB5,
     0xC5, 0x7E, 0xC0, 0xB7, 0x7E, 0xB5, 0xC5, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xB4, 0x7E, 0x9E, 0xE1,
     0x7E, 0xB5, 0xC5, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xE5, 0x7F, 0x0E, 0x27, 0x7E, 0xB5, 0xC5, 0x7F,
-    0xFF, 0xF8, 0x7F, 0xFF, 0xFD, 0x63, 0x64, 0x73, 0x74, 0x7E, 0xB8, 0x14, 0x7E, 0xB6, 0x9C, 0x7E,
+    0xFF, 0xFD, 0x7F, 0xFF, 0xF8, 0x63, 0x64, 0x73, 0x74, 0x7E, 0xB8, 0x14, 0x7E, 0xB6, 0x9C, 0x7E,
     0xB8, 0x14, 0x62, 0x6D, 0x6E, 0x7E, 0xC0, 0x71, 0x7F, 0xFF, 0xF3, 0x63, 0x6C, 0x70, 0x72, 0x7E,
     0xB5, 0x83, 0x7E, 0xC0, 0x68, 0x7E, 0xBC, 0x5A, 0x63, 0x65, 0x6E, 0x72, 0x7E, 0xB5, 0x69, 0x7E,
     0xB5, 0x69, 0x7E, 0xC0, 0x5B, 0xE8, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x75,
@@ -5779,13 +5779,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xC3, 0x7F, 0xBA, 0x32, 0x7F, 0x61, 0xF8, 0x7E, 0xB4, 0x85, 0x7E, 0xC2, 0x58, 0xE8, 0x06, 0xF1,
     0x61, 0xC3, 0x65, 0x69, 0x6F, 0x75, 0x77, 0x7A, 0x7F, 0xFF, 0x6E, 0x7F, 0xFF, 0x93, 0x7F, 0xFF,
     0xC9, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xEF, 0x7E, 0xDD, 0xC7,
-    0x7A, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7F, 0xD3, 0xDC, 0x7F, 0xD4,
-    0x8A, 0x7F, 0xD5, 0xD8, 0x7F, 0xD7, 0x6E, 0x7F, 0xD8, 0x9D, 0x7F, 0xDE, 0x01, 0x7F, 0xDF, 0xB7,
-    0x7F, 0xE1, 0xF6, 0x7F, 0xE2, 0x8D, 0x7F, 0xE2, 0xC1, 0x7F, 0xE2, 0xED, 0x7F, 0xE5, 0x07, 0x7F,
-    0xE8, 0xAE, 0x7F, 0xEA, 0x78, 0x7F, 0xF0, 0x2F, 0x7F, 0xF1, 0x70, 0x7F, 0xF2, 0x32, 0x7F, 0xF4,
-    0x1D, 0x7F, 0xF8, 0xEE, 0x7F, 0xFD, 0x95, 0x7F, 0xFD, 0xD6, 0x7F, 0xFE, 0xF5, 0x7F, 0xFF, 0x18,
-    0x7F, 0xFF, 0x2D, 0x7E, 0xB4, 0xAC, 0x7F, 0xFF, 0xDD, 0xE1, 0x07, 0xA1, 0x6C, 0x7E, 0x9A, 0x73,
+    0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x7F, 0xD3, 0xDC, 0x7F, 0xD5,
+    0xD8, 0x7F, 0xD7, 0x6E, 0x7F, 0xD8, 0x9D, 0x7F, 0xDE, 0x01, 0x7F, 0xDF, 0xB7, 0x7F, 0xE1, 0xF6,
+    0x7F, 0xE2, 0x8D, 0x7F, 0xE2, 0xC1, 0x7F, 0xE2, 0xED, 0x7F, 0xE5, 0x07, 0x7F, 0xE8, 0xAE, 0x7F,
+    0xEA, 0x78, 0x7F, 0xF0, 0x2F, 0x7F, 0xF1, 0x70, 0x7F, 0xF2, 0x32, 0x7F, 0xF4, 0x1D, 0x7F, 0xF8,
+    0xEE, 0x7F, 0xFD, 0x95, 0x7F, 0xFD, 0xD6, 0x7F, 0xFE, 0xF5, 0x7F, 0xFF, 0x18, 0x7F, 0xFF, 0x2D,
+    0x7E, 0xB4, 0xAC, 0x7F, 0xFF, 0xDD, 0x7F, 0xD4, 0x8A, 0xE1, 0x07, 0xA1, 0x6C, 0x7E, 0x9A, 0x73,
     0xE1, 0x07, 0xA1, 0x68, 0x7E, 0xBA, 0x87, 0x62, 0x69, 0x72, 0x7E, 0xB4, 0xEA, 0x7E, 0xB4, 0xEA,
     0xE1, 0x07, 0xA1, 0x6C, 0x7E, 0x9A, 0xC9, 0x61, 0x64, 0x7E, 0x9C, 0x20, 0x62, 0x65, 0x73, 0x7E,
     0xB2, 0x0E, 0x7E, 0x9B, 0xAE, 0x21, 0x72, 0xF7, 0x62, 0x61, 0x65, 0x7E, 0xC0, 0x57, 0x7E, 0xB4,
@@ -5868,10 +5868,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xE2, 0x02, 0x61, 0x67, 0x6B, 0x7E, 0xB0, 0x4C, 0x7E, 0xB0, 0x4C, 0x64, 0x61, 0x69, 0x6F, 0x73,
     0x7E, 0xB0, 0x82, 0x7F, 0xFF, 0xF5, 0x7E, 0xB0, 0x82, 0x7E, 0x96, 0x13, 0xE2, 0x02, 0xF1, 0x66,
     0x6D, 0x7E, 0x97, 0x25, 0x7E, 0xAF, 0xE5, 0xE1, 0x07, 0x71, 0x74, 0x7E, 0xB0, 0x25, 0x70, 0x62,
-    0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0xC3, 0x70, 0x73, 0x74, 0x75, 0x77, 0x7A, 0x7F,
+    0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0x70, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3, 0x7F,
     0xFF, 0x93, 0x7E, 0xAF, 0xD0, 0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xA3, 0x7E, 0xAE, 0xC3, 0x7E, 0xAE,
-    0xC3, 0x7F, 0xFF, 0xAC, 0x7E, 0xAE, 0xC3, 0x7F, 0xFF, 0xB3, 0x7F, 0xFF, 0xC2, 0x7F, 0xFF, 0xCB,
-    0x7F, 0xB4, 0x70, 0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xEE, 0x7E, 0xAE, 0xC3, 0x7F, 0xFF, 0xF9, 0xA0,
+    0xC3, 0x7F, 0xFF, 0xAC, 0x7E, 0xAE, 0xC3, 0x7F, 0xFF, 0xB3, 0x7F, 0xFF, 0xCB, 0x7F, 0xB4, 0x70,
+    0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xEE, 0x7E, 0xAE, 0xC3, 0x7F, 0xFF, 0xF9, 0x7F, 0xFF, 0xC2, 0xA0,
     0x26, 0x33, 0x21, 0x69, 0xFD, 0x64, 0x61, 0x65, 0x69, 0x6F, 0x7E, 0x96, 0xCC, 0x7E, 0x9C, 0x44,
     0x7F, 0x3B, 0xF7, 0x7E, 0x95, 0xBD, 0xE1, 0x00, 0x41, 0x72, 0x7E, 0xBB, 0x6B, 0x65, 0x2E, 0x61,
     0x65, 0x69, 0x72, 0x7E, 0xB0, 0x86, 0x7E, 0x94, 0xEC, 0x7F, 0xFF, 0xF9, 0x7E, 0xB1, 0xD9, 0x7F,
@@ -5943,10 +5943,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x95, 0x65, 0x7E, 0x95, 0x65, 0x7E, 0x95, 0x65, 0x62, 0x2E, 0x6E, 0x7F, 0x1A, 0x10, 0x7F, 0xFF,
     0xF3, 0x68, 0x65, 0x66, 0x67, 0x68, 0x6C, 0x73, 0x77, 0x7A, 0x7F, 0xFF, 0xF7, 0x7E, 0xAC, 0x52,
     0x7E, 0xAC, 0x52, 0x7E, 0x92, 0x80, 0x7E, 0xAC, 0x52, 0x7E, 0xAC, 0x52, 0x7E, 0xAB, 0x8B, 0x7E,
-    0xAB, 0x8B, 0x6D, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74,
-    0x7F, 0xFF, 0x04, 0x7E, 0xBE, 0x92, 0x7F, 0xFF, 0x1E, 0x7F, 0xFF, 0x59, 0x7E, 0x9A, 0x19, 0x7F,
-    0xFF, 0x86, 0x7F, 0xFF, 0x8D, 0x7E, 0x90, 0x9A, 0x7F, 0xFF, 0x9B, 0x7E, 0xB0, 0xF3, 0x7F, 0xFF,
-    0xA4, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xDF, 0x63, 0x66, 0x6C, 0x6F, 0x7E, 0xAA, 0xEA, 0x7E, 0xA9,
+    0xAB, 0x8B, 0x6D, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0xC3,
+    0x7F, 0xFF, 0x04, 0x7F, 0xFF, 0x1E, 0x7F, 0xFF, 0x59, 0x7E, 0x9A, 0x19, 0x7F, 0xFF, 0x86, 0x7F,
+    0xFF, 0x8D, 0x7E, 0x90, 0x9A, 0x7F, 0xFF, 0x9B, 0x7E, 0xB0, 0xF3, 0x7F, 0xFF, 0xA4, 0x7F, 0xFF,
+    0xBC, 0x7F, 0xFF, 0xDF, 0x7E, 0xBE, 0x92, 0x63, 0x66, 0x6C, 0x6F, 0x7E, 0xAA, 0xEA, 0x7E, 0xA9,
     0xDD, 0x7E, 0xB2, 0xAD, 0x62, 0x6C, 0x74, 0x7E, 0x90, 0x5B, 0x7E, 0x90, 0x5B, 0x65, 0x65, 0x6B,
     0x6C, 0x70, 0x73, 0x7E, 0x90, 0x4C, 0x7E, 0x90, 0x4C, 0x7F, 0xFF, 0xF7, 0x7E, 0xA9, 0xF0, 0x7E,
     0x90, 0x4C, 0x62, 0xA4, 0xB6, 0x7E, 0xA9, 0xE8, 0x7E, 0xAB, 0x7A, 0x61, 0x69, 0x7F, 0x11, 0x95,
@@ -5970,11 +5970,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xB0, 0xBF, 0xE2, 0x00, 0x51, 0x75, 0xC3, 0x7E, 0x96, 0x5B, 0x7F, 0xFF, 0xFB, 0x61, 0x67, 0x7F,
     0x33, 0xFD, 0x62, 0x73, 0x75, 0x7E, 0xB5, 0x7F, 0x7F, 0xFF, 0xFB, 0xE1, 0x07, 0x91, 0x68, 0x7E,
     0x93, 0x95, 0x21, 0x65, 0xF9, 0x63, 0x2E, 0x65, 0x69, 0x7E, 0xAA, 0x8E, 0x7F, 0xFF, 0xED, 0x7F,
-    0xFF, 0xFD, 0x71, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F,
-    0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFE, 0x9B, 0x7F, 0xFE, 0xB0, 0x7F, 0xFE, 0xB9, 0x7E, 0xA9, 0xBD,
-    0x7F, 0xFE, 0xDD, 0x7F, 0xFF, 0x14, 0x7F, 0xFF, 0x2A, 0x7F, 0xFF, 0x42, 0x7F, 0xFF, 0x54, 0x7E,
-    0x8E, 0xEA, 0x7F, 0xFF, 0x6A, 0x7F, 0xFF, 0x96, 0x7F, 0xFF, 0xA6, 0x7F, 0xFF, 0xC2, 0x7F, 0xFF,
-    0xD0, 0x7E, 0xCD, 0xAF, 0x7F, 0xFF, 0xF3, 0xE1, 0x06, 0xF1, 0x61, 0x7E, 0xA9, 0x2A, 0x62, 0x61,
+    0xFF, 0xFD, 0x71, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x73,
+    0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFE, 0x9B, 0x7F, 0xFE, 0xB9, 0x7E, 0xA9, 0xBD, 0x7F, 0xFE, 0xDD,
+    0x7F, 0xFF, 0x14, 0x7F, 0xFF, 0x2A, 0x7F, 0xFF, 0x42, 0x7F, 0xFF, 0x54, 0x7E, 0x8E, 0xEA, 0x7F,
+    0xFF, 0x6A, 0x7F, 0xFF, 0x96, 0x7F, 0xFF, 0xA6, 0x7F, 0xFF, 0xC2, 0x7F, 0xFF, 0xD0, 0x7E, 0xCD,
+    0xAF, 0x7F, 0xFF, 0xF3, 0x7F, 0xFE, 0xB0, 0xE1, 0x06, 0xF1, 0x61, 0x7E, 0xA9, 0x2A, 0x62, 0x61,
     0x65, 0x7E, 0xA8, 0x3F, 0x7E, 0x8F, 0x08, 0x62, 0x61, 0x70, 0x7E, 0xF3, 0x7F, 0x7E, 0x8E, 0xCB,
     0x67, 0x61, 0x65, 0x68, 0x70, 0x73, 0x74, 0x75, 0x7E, 0xB4, 0xC3, 0x7E, 0xC9, 0x24, 0x7F, 0xFF,
     0xE7, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7E, 0xD1, 0x54, 0x7E, 0xA8, 0x3A, 0x63, 0x62, 0x6E,
@@ -6089,11 +6089,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xA1, 0x3B, 0xE1, 0x00, 0xB1, 0x6E, 0x7E, 0xA2, 0x2F, 0x62, 0x6C, 0x6E, 0x7E, 0xA1, 0x44, 0x7E,
     0xA1, 0x88, 0x62, 0x6B, 0x72, 0x7E, 0x8B, 0x0E, 0x7E, 0x88, 0x70, 0x62, 0x6E, 0x72, 0x7E, 0x88,
     0x64, 0x7F, 0xFF, 0xF7, 0xE3, 0x00, 0x81, 0x61, 0x65, 0x6C, 0x7E, 0x88, 0x2A, 0x7F, 0xFF, 0xF7,
-    0x7E, 0x87, 0xEF, 0x61, 0x65, 0x7F, 0x79, 0x1A, 0x70, 0x2E, 0x61, 0xC3, 0x66, 0x67, 0x68, 0x69,
-    0x6B, 0x6C, 0x6D, 0x70, 0x72, 0x73, 0x74, 0x76, 0x7A, 0x7E, 0xA1, 0xF6, 0x7F, 0xFF, 0xD1, 0x7E,
-    0xB2, 0xD9, 0x7F, 0xFF, 0xEC, 0x7E, 0xA1, 0xF6, 0x7E, 0xA1, 0x73, 0x7E, 0x87, 0xBF, 0x7E, 0xA1,
-    0xF6, 0x7E, 0xC3, 0x53, 0x7E, 0xA1, 0xF6, 0x7E, 0xA1, 0x92, 0x7E, 0xA1, 0x73, 0x7F, 0xAC, 0xFB,
-    0x7F, 0xFF, 0xFB, 0x7E, 0xA1, 0xF6, 0x7E, 0xA1, 0xF6, 0xE1, 0x0B, 0x52, 0x6E, 0x7E, 0x87, 0x9D,
+    0x7E, 0x87, 0xEF, 0x61, 0x65, 0x7F, 0x79, 0x1A, 0x70, 0x2E, 0x61, 0x66, 0x67, 0x68, 0x69, 0x6B,
+    0x6C, 0x6D, 0x70, 0x72, 0x73, 0x74, 0x76, 0x7A, 0xC3, 0x7E, 0xA1, 0xF6, 0x7F, 0xFF, 0xD1, 0x7F,
+    0xFF, 0xEC, 0x7E, 0xA1, 0xF6, 0x7E, 0xA1, 0x73, 0x7E, 0x87, 0xBF, 0x7E, 0xA1, 0xF6, 0x7E, 0xC3,
+    0x53, 0x7E, 0xA1, 0xF6, 0x7E, 0xA1, 0x92, 0x7E, 0xA1, 0x73, 0x7F, 0xAC, 0xFB, 0x7F, 0xFF, 0xFB,
+    0x7E, 0xA1, 0xF6, 0x7E, 0xA1, 0xF6, 0x7E, 0xB2, 0xD9, 0xE1, 0x0B, 0x52, 0x6E, 0x7E, 0x87, 0x9D,
     0x64, 0x61, 0x65, 0x6C, 0x72, 0x7E, 0x88, 0x34, 0x7E, 0xB2, 0x61, 0x7E, 0x88, 0xF7, 0x7E, 0x88,
     0x31, 0x63, 0x66, 0x67, 0x77, 0x7F, 0x2F, 0x68, 0x7E, 0xEB, 0x6F, 0x7E, 0x87, 0xF1, 0x21, 0x72,
     0xF3, 0x63, 0x61, 0x65, 0x72, 0x7E, 0x88, 0x13, 0x7F, 0xFF, 0xFD, 0x7E, 0x87, 0x75, 0x63, 0x61,
@@ -6256,23 +6256,23 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0x16, 0x7F, 0xFF, 0x37, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0xCF, 0x7F, 0xFF, 0xEF, 0x62, 0x61,
     0x6C, 0x7E, 0x96, 0xFE, 0x7E, 0xBF, 0xF6, 0x61, 0x67, 0x7E, 0x81, 0x64, 0x63, 0x6C, 0x6E, 0x75,
     0x7E, 0x88, 0xE7, 0x7E, 0x96, 0xC1, 0x7F, 0xFF, 0xFB, 0xE1, 0x02, 0x61, 0x65, 0x7E, 0x90, 0x30,
-    0xA2, 0x08, 0x62, 0x65, 0x75, 0xEC, 0xF9, 0x7A, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
-    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
-    0x79, 0x7A, 0x7F, 0xE9, 0x10, 0x7F, 0xE9, 0xBC, 0x7F, 0xE9, 0xC8, 0x7F, 0xE9, 0xDB, 0x7F, 0xE9,
-    0xEE, 0x7F, 0xEE, 0xF6, 0x7F, 0xEF, 0x4E, 0x7F, 0xEF, 0x70, 0x7F, 0xEF, 0x8B, 0x7F, 0xF0, 0xFE,
-    0x7F, 0xF1, 0x3F, 0x7F, 0xF1, 0x6A, 0x7F, 0xF3, 0x86, 0x7F, 0xF3, 0xB5, 0x7F, 0xF4, 0x51, 0x7F,
-    0xF6, 0xB0, 0x7F, 0xF7, 0x00, 0x7F, 0x8E, 0x98, 0x7F, 0xF8, 0xB8, 0x7F, 0xFB, 0x72, 0x7F, 0xFD,
-    0xB7, 0x7F, 0xFF, 0x9C, 0x7F, 0x8A, 0x7A, 0x7E, 0x97, 0x87, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xF9,
+    0xA2, 0x08, 0x62, 0x65, 0x75, 0xEC, 0xF9, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79,
+    0x7A, 0xC3, 0x7F, 0xE9, 0x10, 0x7F, 0xE9, 0xC8, 0x7F, 0xE9, 0xDB, 0x7F, 0xE9, 0xEE, 0x7F, 0xEE,
+    0xF6, 0x7F, 0xEF, 0x4E, 0x7F, 0xEF, 0x70, 0x7F, 0xEF, 0x8B, 0x7F, 0xF0, 0xFE, 0x7F, 0xF1, 0x3F,
+    0x7F, 0xF1, 0x6A, 0x7F, 0xF3, 0x86, 0x7F, 0xF3, 0xB5, 0x7F, 0xF4, 0x51, 0x7F, 0xF6, 0xB0, 0x7F,
+    0xF7, 0x00, 0x7F, 0x8E, 0x98, 0x7F, 0xF8, 0xB8, 0x7F, 0xFB, 0x72, 0x7F, 0xFD, 0xB7, 0x7F, 0xFF,
+    0x9C, 0x7F, 0x8A, 0x7A, 0x7E, 0x97, 0x87, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xF9, 0x7F, 0xE9, 0xBC,
     0xE2, 0x07, 0xB1, 0x72, 0x74, 0x7E, 0x97, 0x21, 0x7E, 0x97, 0x21, 0xE1, 0x05, 0x11, 0x64, 0x7E,
     0x96, 0x32, 0xE1, 0x06, 0xF1, 0x72, 0x7E, 0x7E, 0xCD, 0x61, 0x7A, 0x7E, 0xD2, 0x50, 0x62, 0x6E,
     0x72, 0x7E, 0x98, 0x15, 0x7F, 0xFF, 0xFB, 0x41, 0x74, 0xB3, 0xFD, 0x63, 0x2E, 0x6E, 0x72, 0x7E,
     0xA9, 0x99, 0x7E, 0x95, 0xF3, 0x7E, 0x97, 0x82, 0x63, 0x61, 0x65, 0x75, 0x7E, 0x9E, 0xB7, 0x7E,
     0x8A, 0x37, 0x7E, 0xF8, 0xD8, 0xE1, 0x06, 0xF1, 0x2E, 0x7E, 0x96, 0x75, 0x61, 0x65, 0x7F, 0x7A,
-    0x61, 0x73, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x72,
-    0x73, 0x74, 0x75, 0x77, 0x7A, 0x7F, 0xFF, 0xBA, 0x7E, 0xAC, 0x9B, 0x7F, 0xFF, 0xC1, 0x7E, 0x96,
-    0xCD, 0x7F, 0xFF, 0xCD, 0x7E, 0x96, 0xCD, 0x7E, 0x96, 0xCD, 0x7E, 0x96, 0xCD, 0x7F, 0xFF, 0xD6,
-    0x7E, 0x97, 0x09, 0x7E, 0x96, 0xCD, 0x7F, 0xFF, 0xDA, 0x7E, 0x97, 0x8B, 0x7F, 0xFF, 0xE7, 0x7F,
-    0xFF, 0xF4, 0x7F, 0xFF, 0xFB, 0x7E, 0x9D, 0x11, 0x7E, 0x96, 0xCD, 0x7E, 0x96, 0xCD, 0x62, 0x62,
+    0x61, 0x73, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x77, 0x7A, 0xC3, 0x7F, 0xFF, 0xBA, 0x7F, 0xFF, 0xC1, 0x7E, 0x96, 0xCD, 0x7F, 0xFF,
+    0xCD, 0x7E, 0x96, 0xCD, 0x7E, 0x96, 0xCD, 0x7E, 0x96, 0xCD, 0x7F, 0xFF, 0xD6, 0x7E, 0x97, 0x09,
+    0x7E, 0x96, 0xCD, 0x7F, 0xFF, 0xDA, 0x7E, 0x97, 0x8B, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xF4, 0x7F,
+    0xFF, 0xFB, 0x7E, 0x9D, 0x11, 0x7E, 0x96, 0xCD, 0x7E, 0x96, 0xCD, 0x7E, 0xAC, 0x9B, 0x62, 0x62,
     0x6C, 0x7E, 0x96, 0x83, 0x7E, 0x96, 0x83, 0xE1, 0x00, 0xA1, 0x66, 0x7E, 0xC4, 0x97, 0x21, 0x72,
     0xF9, 0x61, 0x74, 0x7E, 0x80, 0x85, 0x62, 0x66, 0x70, 0x7E, 0x7E, 0xB6, 0x7E, 0x7C, 0x39, 0x21,
     0x72, 0xF7, 0x62, 0x65, 0x6F, 0x7F, 0xFF, 0xFD, 0x7E, 0x7F, 0x9C, 0x64, 0x65, 0x73, 0x74, 0x75,
@@ -6328,12 +6328,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0x79, 0x77, 0x7F, 0x4D, 0x28, 0x7E, 0x93, 0x94, 0xE2, 0x06, 0xF1, 0x61, 0x65, 0x7E, 0x9D,
     0xCA, 0x7E, 0x9D, 0xCA, 0x63, 0x66, 0x67, 0x68, 0x7E, 0x79, 0x7E, 0x7E, 0x7D, 0x3C, 0x7E, 0x79,
     0x7E, 0x62, 0x6C, 0x72, 0x7E, 0x79, 0x05, 0x7F, 0xFF, 0xF3, 0x63, 0x65, 0x69, 0x77, 0x7F, 0xFF,
-    0xF7, 0x7E, 0x79, 0x45, 0x7E, 0x78, 0xFC, 0x73, 0x61, 0xC3, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6B,
-    0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x78, 0x7A, 0x7F, 0xFE, 0x9A, 0x7F, 0xFE,
-    0xAB, 0x7F, 0xFE, 0xF8, 0x7F, 0xFF, 0x1C, 0x7F, 0xFF, 0x82, 0x7F, 0xFF, 0x9B, 0x7F, 0x36, 0x07,
-    0x7F, 0xFF, 0xA0, 0x7E, 0x93, 0x07, 0x7E, 0x93, 0x07, 0x7F, 0xFF, 0xA9, 0x7E, 0x94, 0x0B, 0x7F,
-    0x2C, 0xB3, 0x7F, 0xFF, 0xB6, 0x7F, 0xFF, 0xC1, 0x7E, 0x82, 0x16, 0x7F, 0xFF, 0xD2, 0x7E, 0x92,
-    0xA3, 0x7F, 0xFF, 0xF3, 0x62, 0x61, 0x6C, 0x7E, 0x93, 0x08, 0x7E, 0x78, 0xA2, 0x64, 0x66, 0x68,
+    0xF7, 0x7E, 0x79, 0x45, 0x7E, 0x78, 0xFC, 0x73, 0x61, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C,
+    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x78, 0x7A, 0xC3, 0x7F, 0xFE, 0x9A, 0x7F, 0xFE,
+    0xF8, 0x7F, 0xFF, 0x1C, 0x7F, 0xFF, 0x82, 0x7F, 0xFF, 0x9B, 0x7F, 0x36, 0x07, 0x7F, 0xFF, 0xA0,
+    0x7E, 0x93, 0x07, 0x7E, 0x93, 0x07, 0x7F, 0xFF, 0xA9, 0x7E, 0x94, 0x0B, 0x7F, 0x2C, 0xB3, 0x7F,
+    0xFF, 0xB6, 0x7F, 0xFF, 0xC1, 0x7E, 0x82, 0x16, 0x7F, 0xFF, 0xD2, 0x7E, 0x92, 0xA3, 0x7F, 0xFF,
+    0xF3, 0x7F, 0xFE, 0xAB, 0x62, 0x61, 0x6C, 0x7E, 0x93, 0x08, 0x7E, 0x78, 0xA2, 0x64, 0x66, 0x68,
     0x6F, 0x70, 0x7E, 0x93, 0x6F, 0x7E, 0x91, 0xA7, 0x7E, 0xD7, 0x6A, 0x7F, 0xFF, 0xF7, 0x65, 0x62,
     0x63, 0x67, 0x6E, 0x75, 0x7E, 0x92, 0x03, 0x7E, 0x92, 0x03, 0x7E, 0x9A, 0x96, 0x7E, 0x92, 0x03,
     0x7E, 0x91, 0xBF, 0x64, 0x61, 0x62, 0x69, 0x6C, 0x7E, 0x93, 0xA0, 0x7E, 0x79, 0xCE, 0x7E, 0x91,
@@ -6367,10 +6367,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x6E, 0x78, 0x7E, 0x76, 0xB7, 0x7E, 0x8F, 0x1F, 0x7E, 0x76, 0xB7, 0xE1, 0x07, 0x91, 0x6F,
     0x7E, 0x77, 0x13, 0x64, 0x61, 0x65, 0x69, 0x72, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xEC, 0x7E, 0x7E,
     0x8B, 0x7F, 0xFF, 0xF9, 0xA0, 0x28, 0x22, 0x62, 0x69, 0x72, 0x7E, 0x76, 0x8F, 0x7F, 0xFF, 0xFD,
-    0x21, 0x65, 0xF7, 0x6D, 0x2E, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6C, 0x6D, 0x6F, 0x72, 0x73, 0x74,
-    0x7A, 0x7E, 0x91, 0x2A, 0x7F, 0xFF, 0x5C, 0x7F, 0xFF, 0x67, 0x7F, 0xFF, 0x7B, 0x7F, 0xFF, 0x8E,
-    0x7E, 0x98, 0x6C, 0x7F, 0xFF, 0x95, 0x7E, 0xA0, 0x8A, 0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xA9, 0x7F,
-    0xFF, 0xBE, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xFD, 0x61, 0x6E, 0x7E, 0x89, 0xDA, 0xE1, 0x07, 0x71,
+    0x21, 0x65, 0xF7, 0x6D, 0x2E, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6D, 0x6F, 0x72, 0x73, 0x74, 0x7A,
+    0xC3, 0x7E, 0x91, 0x2A, 0x7F, 0xFF, 0x5C, 0x7F, 0xFF, 0x7B, 0x7F, 0xFF, 0x8E, 0x7E, 0x98, 0x6C,
+    0x7F, 0xFF, 0x95, 0x7E, 0xA0, 0x8A, 0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xBE, 0x7F,
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFD, 0x7F, 0xFF, 0x67, 0x61, 0x6E, 0x7E, 0x89, 0xDA, 0xE1, 0x07, 0x71,
     0x65, 0x7E, 0x76, 0x15, 0x65, 0x2E, 0x65, 0x6C, 0x72, 0x73, 0x7E, 0x8F, 0xF6, 0x7F, 0xFF, 0xF4,
     0x7E, 0x77, 0xA3, 0x7F, 0xAA, 0x80, 0x7F, 0xFF, 0xF9, 0x61, 0x68, 0x7E, 0x80, 0x10, 0xE2, 0x00,
     0xE1, 0x2E, 0x65, 0x7E, 0x75, 0xC1, 0x7E, 0x79, 0x32, 0x62, 0x6C, 0x72, 0x7E, 0x76, 0x1D, 0x7F,
@@ -6402,9 +6402,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xDD, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7E, 0x8E, 0xC8, 0x62, 0x68, 0x6B, 0x7E, 0x8E,
     0x2F, 0x7E, 0x8E, 0x93, 0xE2, 0x00, 0xB1, 0x65, 0x66, 0x7E, 0x8F, 0x48, 0x7F, 0x45, 0x1B, 0x63,
     0x73, 0x74, 0x75, 0x7E, 0x8E, 0x7F, 0x7F, 0x7D, 0x4F, 0x7E, 0x8E, 0x1B, 0xEC, 0x07, 0xB1, 0x62,
-    0x63, 0x64, 0x66, 0x68, 0x6B, 0x6C, 0x70, 0x73, 0xC3, 0x74, 0x7A, 0x7E, 0x74, 0x5D, 0x7F, 0xFF,
+    0x63, 0x64, 0x66, 0x68, 0x6B, 0x6C, 0x70, 0x73, 0x74, 0x7A, 0xC3, 0x7E, 0x74, 0x5D, 0x7F, 0xFF,
     0xDF, 0x7E, 0x8E, 0x72, 0x7F, 0xFF, 0xE8, 0x7F, 0x78, 0xF6, 0x7E, 0x8E, 0x72, 0x7E, 0x92, 0xD5,
-    0x7E, 0x8E, 0x72, 0x7F, 0xFF, 0xF3, 0x7E, 0xD2, 0x65, 0x7E, 0x80, 0xE0, 0x7E, 0x8E, 0x72, 0x62,
+    0x7E, 0x8E, 0x72, 0x7F, 0xFF, 0xF3, 0x7E, 0x80, 0xE0, 0x7E, 0x8E, 0x72, 0x7E, 0xD2, 0x65, 0x62,
     0x65, 0x75, 0x7E, 0x8E, 0x3F, 0x7E, 0x8E, 0x3F, 0xE1, 0x00, 0xA1, 0x72, 0x7E, 0x79, 0xB8, 0x21,
     0x65, 0xF9, 0x21, 0x6B, 0xFD, 0x62, 0x6C, 0x6D, 0x7E, 0x84, 0xBB, 0x7E, 0x74, 0x11, 0xE2, 0x06,
     0xF1, 0x65, 0x6C, 0x7F, 0xFF, 0xF7, 0x7E, 0x74, 0x05, 0x61, 0x68, 0x7E, 0x75, 0x5E, 0xA1, 0x00,
@@ -6475,9 +6475,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x97, 0x49, 0x7E, 0x6F, 0xFA, 0x64, 0x61, 0x6B, 0x70, 0x74, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xEE,
     0x7E, 0x6F, 0xF4, 0x7F, 0xFF, 0xF7, 0xE5, 0x00, 0xB1, 0x65, 0x66, 0x69, 0x6C, 0x6D, 0x7E, 0x8B,
     0xEF, 0x7E, 0x8B, 0x79, 0x7E, 0x6F, 0x73, 0x7E, 0x93, 0xDD, 0x7E, 0x93, 0xDD, 0xEC, 0x06, 0xF1,
-    0x61, 0xC3, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7F, 0xFE, 0x11, 0x7F,
-    0xFE, 0x5B, 0x7E, 0x8E, 0xC6, 0x7F, 0xFE, 0xD3, 0x7F, 0x2F, 0x85, 0x7F, 0xFF, 0x14, 0x7F, 0xFF,
-    0x47, 0x7F, 0xFF, 0xA8, 0x7F, 0xFF, 0xD8, 0x7E, 0x8B, 0xE0, 0x7F, 0xFF, 0xE9, 0x7E, 0xB6, 0xFC,
+    0x61, 0x63, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0xC3, 0x7F, 0xFE, 0x11, 0x7E,
+    0x8E, 0xC6, 0x7F, 0xFE, 0xD3, 0x7F, 0x2F, 0x85, 0x7F, 0xFF, 0x14, 0x7F, 0xFF, 0x47, 0x7F, 0xFF,
+    0xA8, 0x7F, 0xFF, 0xD8, 0x7E, 0x8B, 0xE0, 0x7F, 0xFF, 0xE9, 0x7E, 0xB6, 0xFC, 0x7F, 0xFE, 0x5B,
     0x62, 0x2E, 0x6D, 0x7E, 0x88, 0xCD, 0x7E, 0x88, 0xCD, 0x66, 0x64, 0x6E, 0x73, 0x74, 0x75, 0x76,
     0x7E, 0x88, 0x9B, 0x7F, 0xFF, 0xF7, 0x7E, 0x88, 0x9B, 0x7E, 0x96, 0x42, 0x7E, 0xE4, 0xA7, 0x7E,
     0x88, 0x9B, 0xE1, 0x01, 0x61, 0x65, 0x7E, 0x70, 0x97, 0x21, 0x73, 0xF9, 0x62, 0x6E, 0x72, 0x7F,
@@ -6515,10 +6515,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0x6D, 0x84, 0x61, 0x72, 0x7E, 0xC6, 0xE2, 0x21, 0x6B, 0xFB, 0x62, 0x69, 0x72, 0x7E, 0x6D,
     0x6B, 0x7F, 0xFF, 0xFD, 0x63, 0x6B, 0x70, 0x74, 0x7E, 0x70, 0x6C, 0x7E, 0x6F, 0xC0, 0x7E, 0x6E,
     0x49, 0x64, 0x61, 0x65, 0x6F, 0x73, 0x7F, 0xFF, 0xD1, 0x7F, 0xFF, 0xEA, 0x7E, 0x6D, 0xF0, 0x7F,
-    0xFF, 0xF3, 0x6D, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0xC3, 0x74, 0x77,
+    0xFF, 0xF3, 0x6D, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x77, 0xC3,
     0x7F, 0xFE, 0xD8, 0x7F, 0xA8, 0x9B, 0x7F, 0xFE, 0xF1, 0x7F, 0xFF, 0x01, 0x7F, 0xFF, 0x04, 0x7E,
     0x6D, 0x10, 0x7F, 0xFF, 0x12, 0x7F, 0xFF, 0x4C, 0x7E, 0x87, 0x5C, 0x7F, 0xFF, 0x99, 0x7F, 0xFF,
-    0xBD, 0x7F, 0xFF, 0xEF, 0x7E, 0x87, 0x5C, 0xA0, 0x28, 0xD3, 0x63, 0x73, 0x74, 0x7A, 0x7F, 0xFF,
+    0xEF, 0x7E, 0x87, 0x5C, 0x7F, 0xFF, 0xBD, 0xA0, 0x28, 0xD3, 0x63, 0x73, 0x74, 0x7A, 0x7F, 0xFF,
     0xFD, 0x7E, 0x88, 0xC2, 0x7E, 0x87, 0x24, 0xE3, 0x07, 0x71, 0x62, 0x63, 0x75, 0x7E, 0x86, 0x7A,
     0x7E, 0x86, 0x7A, 0x7E, 0x86, 0x7A, 0xE4, 0x01, 0x61, 0x64, 0x6B, 0x73, 0x7A, 0x7E, 0x6C, 0x89,
     0x7E, 0x6C, 0x89, 0x7E, 0x6C, 0x89, 0x7E, 0x6C, 0x89, 0x67, 0x66, 0x69, 0x6B, 0x6D, 0x72, 0x76,
@@ -6553,10 +6553,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xC0, 0x7E, 0xB0, 0x1D, 0x7F, 0xFF, 0xC3, 0x7E, 0x86, 0x4C, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF,
     0xE5, 0x7F, 0xFF, 0xFB, 0xE2, 0x00, 0x41, 0x65, 0x6F, 0x7E, 0xDA, 0x1C, 0x7E, 0x6A, 0xCE, 0xE5,
     0x00, 0x81, 0x65, 0x69, 0x75, 0x77, 0x79, 0x7E, 0xF6, 0x02, 0x7E, 0x6B, 0x40, 0x7E, 0x6B, 0x40,
-    0x7F, 0xFF, 0xF5, 0x7E, 0x86, 0x24, 0x6D, 0x2E, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x6B, 0x6E,
-    0x6F, 0x73, 0x74, 0x7A, 0x7E, 0x85, 0x87, 0x7F, 0xFE, 0xA1, 0x7E, 0x98, 0x6E, 0x7F, 0xFE, 0xB2,
-    0x7F, 0xFE, 0xFA, 0x7E, 0x73, 0xF5, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF, 0x58, 0x7F,
-    0xFF, 0x5D, 0x7F, 0xFF, 0x73, 0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xE9, 0x62, 0x66, 0x73, 0x7E, 0x90,
+    0x7F, 0xFF, 0xF5, 0x7E, 0x86, 0x24, 0x6D, 0x2E, 0x61, 0x64, 0x65, 0x66, 0x67, 0x6B, 0x6E, 0x6F,
+    0x73, 0x74, 0x7A, 0xC3, 0x7E, 0x85, 0x87, 0x7F, 0xFE, 0xA1, 0x7F, 0xFE, 0xB2, 0x7F, 0xFE, 0xFA,
+    0x7E, 0x73, 0xF5, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF, 0x58, 0x7F, 0xFF, 0x5D, 0x7F,
+    0xFF, 0x73, 0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xE9, 0x7E, 0x98, 0x6E, 0x62, 0x66, 0x73, 0x7E, 0x90,
     0x54, 0x7E, 0x90, 0x54, 0xA0, 0x29, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6F, 0x7E, 0x90, 0x6C, 0x7F,
     0xFF, 0xFD, 0x7E, 0xC9, 0x70, 0x7E, 0xD0, 0xFB, 0x61, 0x74, 0x7F, 0x3D, 0x6B, 0xE8, 0x01, 0x31,
     0x2E, 0x62, 0x65, 0x67, 0x6C, 0x73, 0x75, 0x7A, 0x7E, 0x84, 0xA4, 0x7E, 0x9E, 0x7E, 0x7E, 0xA1,
@@ -6584,11 +6584,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x82, 0x64, 0x7E, 0x83, 0x93, 0x7E, 0x82, 0xA8, 0x61, 0x74, 0x7E, 0xD8, 0x08, 0x62, 0x63, 0x69,
     0x7E, 0x83, 0xC0, 0x7F, 0xFF, 0xFB, 0x21, 0x65, 0xF7, 0x61, 0x75, 0x7E, 0x8F, 0x18, 0x64, 0x2E,
     0x65, 0x67, 0x6F, 0x7E, 0x84, 0x35, 0x7F, 0xFF, 0xFB, 0x7E, 0x84, 0x35, 0x7E, 0xCD, 0x88, 0x72,
-    0x61, 0xC3, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75,
-    0x77, 0x7A, 0x7F, 0xFE, 0x6E, 0x7F, 0xFE, 0x99, 0x7F, 0xFE, 0xA2, 0x7F, 0xFE, 0xEC, 0x7F, 0xFF,
-    0x23, 0x7F, 0xFF, 0x35, 0x7F, 0xFF, 0x45, 0x7E, 0x68, 0x8D, 0x7F, 0xFF, 0x66, 0x7F, 0xFF, 0x7C,
-    0x7F, 0xFF, 0x7F, 0x7F, 0xFF, 0x88, 0x7F, 0xFF, 0x9E, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xC5, 0x7F,
-    0xFF, 0xCA, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xEF, 0x61, 0x61, 0x7E, 0x7E, 0xB9, 0x62, 0x6B, 0x73,
+    0x61, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77,
+    0x7A, 0xC3, 0x7F, 0xFE, 0x6E, 0x7F, 0xFE, 0xA2, 0x7F, 0xFE, 0xEC, 0x7F, 0xFF, 0x23, 0x7F, 0xFF,
+    0x35, 0x7F, 0xFF, 0x45, 0x7E, 0x68, 0x8D, 0x7F, 0xFF, 0x66, 0x7F, 0xFF, 0x7C, 0x7F, 0xFF, 0x7F,
+    0x7F, 0xFF, 0x88, 0x7F, 0xFF, 0x9E, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xC5, 0x7F, 0xFF, 0xCA, 0x7F,
+    0xFF, 0xE7, 0x7F, 0xFF, 0xEF, 0x7F, 0xFE, 0x99, 0x61, 0x61, 0x7E, 0x7E, 0xB9, 0x62, 0x6B, 0x73,
     0x7E, 0x6B, 0x07, 0x7E, 0x68, 0x42, 0x63, 0x69, 0x72, 0x73, 0x7F, 0x0B, 0x64, 0x7F, 0xFF, 0xF2,
     0x7F, 0xFF, 0xF7, 0xE1, 0x05, 0x11, 0x70, 0x7E, 0x68, 0x93, 0x62, 0x69, 0x6F, 0x7E, 0x8A, 0x75,
     0x7F, 0xFF, 0xF9, 0x61, 0x69, 0x7E, 0x68, 0xF5, 0x21, 0x72, 0xFB, 0x64, 0x65, 0x6C, 0x72, 0x75,
@@ -6688,10 +6688,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x63, 0x65, 0x67, 0x69, 0x7F, 0xFF, 0xF7, 0x7E, 0x7C, 0xBE, 0x7E, 0x66, 0xFD, 0x61, 0x69, 0x7E,
     0x7C, 0xB1, 0x62, 0x65, 0x6E, 0x7E, 0x7C, 0x0F, 0x7E, 0x7C, 0x0F, 0x61, 0x69, 0x7E, 0x65, 0xC9,
     0x64, 0x61, 0xC3, 0x65, 0x6F, 0x7F, 0xFF, 0xF2, 0x7E, 0x8A, 0xD3, 0x7F, 0xFF, 0xFB, 0x7E, 0x7B,
-    0x94, 0xD4, 0x07, 0xB1, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x78, 0x7A, 0xFC, 0x60, 0xFC, 0x7A, 0xFC, 0x7D, 0xFC, 0xA5,
-    0xFC, 0xC8, 0xFD, 0x3B, 0xFD, 0x5F, 0xFD, 0xAC, 0xFD, 0xE8, 0xFD, 0xFD, 0xFE, 0x20, 0xFE, 0xB5,
-    0xFE, 0xF4, 0xFF, 0x03, 0xFF, 0x0C, 0xFF, 0x48, 0xFF, 0xA3, 0xFF, 0xCF, 0xFF, 0xDC, 0xFF, 0xEF,
+    0x94, 0xD4, 0x07, 0xB1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x72, 0x73, 0x74, 0x76, 0x78, 0x7A, 0xC3, 0xFC, 0x60, 0xFC, 0x7D, 0xFC, 0xA5, 0xFC, 0xC8,
+    0xFD, 0x3B, 0xFD, 0x5F, 0xFD, 0xAC, 0xFD, 0xE8, 0xFD, 0xFD, 0xFE, 0x20, 0xFE, 0xB5, 0xFE, 0xF4,
+    0xFF, 0x03, 0xFF, 0x0C, 0xFF, 0x48, 0xFF, 0xA3, 0xFF, 0xCF, 0xFF, 0xDC, 0xFF, 0xEF, 0xFC, 0x7A,
     0x62, 0x67, 0x70, 0x7E, 0x7D, 0xC9, 0x7E, 0x7D, 0xC9, 0x62, 0x65, 0x69, 0x7E, 0x8C, 0xF8, 0x7E,
     0x6A, 0x15, 0xE5, 0x06, 0xC1, 0x62, 0x65, 0x6C, 0x6E, 0x72, 0x7E, 0xD2, 0xA1, 0x7F, 0x20, 0xFD,
     0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7E, 0x87, 0xD9, 0x61, 0x68, 0x7E, 0x7B, 0x18, 0x62, 0xA4,
@@ -6730,10 +6730,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x6E, 0x7E, 0x5F, 0xF0, 0x7E, 0xF8, 0x14, 0x62, 0x65, 0x69, 0x7F, 0xFF, 0xF7, 0x7E, 0x7A,
     0xA5, 0x62, 0x61, 0xC3, 0x7E, 0x5F, 0xDE, 0x7F, 0xA5, 0x46, 0x62, 0x6C, 0x75, 0x7F, 0xFF, 0xF7,
     0x7E, 0x63, 0x40, 0x61, 0x75, 0x7E, 0x92, 0x40, 0x21, 0x61, 0xFB, 0x61, 0xBC, 0x7E, 0x6E, 0xA7,
-    0x21, 0xC3, 0xFB, 0x6C, 0x61, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0xC3, 0x73,
+    0x21, 0xC3, 0xFB, 0x6C, 0x61, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0xC3,
     0x7E, 0x60, 0x6E, 0x7F, 0xFF, 0xBF, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xD5, 0x7F, 0x16, 0x52, 0x7F,
-    0xFF, 0xE7, 0x7F, 0xFF, 0xF5, 0x7F, 0xFF, 0xFD, 0x7F, 0x7E, 0xE1, 0x7E, 0x8D, 0xC5, 0x7F, 0xC2,
-    0xE8, 0x7E, 0xDC, 0x87, 0x62, 0x65, 0x70, 0x7E, 0x6D, 0x0B, 0x7E, 0x61, 0xC9, 0x62, 0x68, 0x74,
+    0xFF, 0xE7, 0x7F, 0xFF, 0xF5, 0x7F, 0xFF, 0xFD, 0x7F, 0x7E, 0xE1, 0x7E, 0x8D, 0xC5, 0x7E, 0xDC,
+    0x87, 0x7F, 0xC2, 0xE8, 0x62, 0x65, 0x70, 0x7E, 0x6D, 0x0B, 0x7E, 0x61, 0xC9, 0x62, 0x68, 0x74,
     0x7E, 0xB1, 0x3C, 0x7E, 0xF4, 0xB5, 0x62, 0x65, 0x74, 0x7E, 0x82, 0x4D, 0x7E, 0x79, 0xAB, 0x6C,
     0x62, 0x63, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x78, 0x7F, 0xAA, 0x8A, 0x7E,
     0x95, 0xEF, 0x7E, 0x72, 0x69, 0x7F, 0xFF, 0x01, 0x7F, 0xFF, 0x06, 0x7F, 0xFF, 0x17, 0x7F, 0xFF,
@@ -6756,11 +6756,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xE0, 0x63, 0x67, 0x6E, 0x73, 0x7E, 0x78, 0x80, 0x7E, 0x78, 0x80, 0x7E, 0x78, 0x80, 0x62, 0x65,
     0x74, 0x7E, 0x5E, 0x55, 0x7E, 0x70, 0x19, 0x63, 0x6D, 0x72, 0x73, 0x7E, 0x84, 0x04, 0x7F, 0xFF,
     0xEA, 0x7F, 0xFF, 0xF7, 0xF3, 0x06, 0xF2, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0xC3, 0x72, 0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFD, 0x8C, 0x7E, 0x5E, 0x45,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFD, 0x8C, 0x7E, 0x5E, 0x45,
     0x7E, 0x78, 0x5D, 0x7F, 0xFD, 0xB5, 0x7F, 0xFE, 0xBB, 0x7E, 0x5E, 0x45, 0x7E, 0x5E, 0x45, 0x7F,
     0xFF, 0x20, 0x7E, 0x5E, 0x45, 0x7E, 0x5F, 0xA3, 0x7E, 0x83, 0xEB, 0x7F, 0xFF, 0x30, 0x7F, 0xFF,
-    0x5A, 0x7F, 0xFF, 0x83, 0x7F, 0x68, 0x0A, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xF3,
-    0x7E, 0x5E, 0x45, 0x63, 0x70, 0x72, 0x73, 0x7E, 0x79, 0x86, 0x7E, 0xD7, 0xB3, 0x7E, 0xA1, 0x8A,
+    0x5A, 0x7F, 0x68, 0x0A, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xF3, 0x7E, 0x5E, 0x45,
+    0x7F, 0xFF, 0x83, 0x63, 0x70, 0x72, 0x73, 0x7E, 0x79, 0x86, 0x7E, 0xD7, 0xB3, 0x7E, 0xA1, 0x8A,
     0x62, 0x72, 0x74, 0x7E, 0x78, 0x01, 0x7E, 0x79, 0x79, 0x61, 0x74, 0x7E, 0x8A, 0x8A, 0x62, 0x73,
     0x77, 0x7E, 0x78, 0x9C, 0x7E, 0x78, 0x9C, 0x21, 0x73, 0xF7, 0x6A, 0x62, 0x64, 0x65, 0x6B, 0x6C,
     0x6D, 0x70, 0x72, 0x74, 0x75, 0x7E, 0x7C, 0x83, 0x7F, 0x11, 0xAD, 0x7F, 0xFF, 0xD9, 0x7E, 0xA0,
@@ -6820,12 +6820,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x07, 0x71, 0x6F, 0x7E, 0x5A, 0x33, 0x62, 0x65, 0x72, 0x7E, 0x9D, 0x21, 0x7E, 0x5A, 0x60, 0x65,
     0x65, 0x68, 0x69, 0x74, 0x7A, 0x7E, 0x98, 0xE9, 0x7E, 0x7F, 0xC0, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF,
     0xF7, 0x7E, 0x74, 0x6F, 0x62, 0x72, 0x76, 0x7E, 0x62, 0xB0, 0x7E, 0x75, 0x18, 0xE2, 0x06, 0xB1,
-    0x65, 0x69, 0x7E, 0x74, 0x8D, 0x7E, 0x73, 0x44, 0xF5, 0x07, 0xB1, 0x62, 0x63, 0x64, 0x65, 0xC3,
-    0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78,
-    0x7F, 0xFD, 0xD2, 0x7F, 0xFD, 0xFF, 0x7F, 0xFE, 0x02, 0x7F, 0xFE, 0x19, 0x7F, 0xFE, 0x3E, 0x7F,
-    0xFE, 0x4E, 0x7F, 0xFE, 0x7C, 0x7F, 0xFE, 0xAD, 0x7E, 0xAD, 0x34, 0x7F, 0xFE, 0xBA, 0x7F, 0xFE,
-    0xCC, 0x7F, 0xFE, 0xD5, 0x7F, 0xFE, 0xF9, 0x7F, 0xFF, 0x0E, 0x7F, 0xFF, 0x20, 0x7F, 0xFF, 0x6C,
-    0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF5, 0x7E, 0x74, 0x46, 0x62,
+    0x65, 0x69, 0x7E, 0x74, 0x8D, 0x7E, 0x73, 0x44, 0xF5, 0x07, 0xB1, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0xC3,
+    0x7F, 0xFD, 0xD2, 0x7F, 0xFD, 0xFF, 0x7F, 0xFE, 0x02, 0x7F, 0xFE, 0x19, 0x7F, 0xFE, 0x4E, 0x7F,
+    0xFE, 0x7C, 0x7F, 0xFE, 0xAD, 0x7E, 0xAD, 0x34, 0x7F, 0xFE, 0xBA, 0x7F, 0xFE, 0xCC, 0x7F, 0xFE,
+    0xD5, 0x7F, 0xFE, 0xF9, 0x7F, 0xFF, 0x0E, 0x7F, 0xFF, 0x20, 0x7F, 0xFF, 0x6C, 0x7F, 0xFF, 0xB2,
+    0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF5, 0x7E, 0x74, 0x46, 0x7F, 0xFE, 0x3E, 0x62,
     0x6E, 0x74, 0x7E, 0x8A, 0xAD, 0x7E, 0x5A, 0xC1, 0xE1, 0x06, 0xC1, 0x65, 0x7E, 0x59, 0xCE, 0x62,
     0x65, 0x72, 0x7E, 0x75, 0x5A, 0x7E, 0x75, 0x5A, 0x65, 0x61, 0x69, 0x6F, 0xC3, 0x75, 0x7F, 0x00,
     0x44, 0x7E, 0x88, 0x86, 0x7F, 0xFF, 0xF7, 0x7F, 0x51, 0x9E, 0x7E, 0x7D, 0xBB, 0x62, 0x65, 0x70,
@@ -6887,10 +6887,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x72, 0x75, 0x7F, 0xFF, 0x5E, 0x7E, 0xEE, 0x5D, 0x7F, 0xFF, 0x9B, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF,
     0xD1, 0x7F, 0xFF, 0xF1, 0x7E, 0x78, 0x1A, 0x65, 0x66, 0x6B, 0x6C, 0x73, 0x76, 0x7E, 0x70, 0xC6,
     0x7E, 0x70, 0xC6, 0x7E, 0x70, 0xC6, 0x7E, 0x71, 0xB2, 0x7E, 0x70, 0x3A, 0x62, 0x6D, 0x6E, 0x7F,
-    0xFF, 0xEB, 0x7F, 0x12, 0x7E, 0xEE, 0x06, 0xF1, 0x61, 0xC3, 0x62, 0x63, 0x65, 0x69, 0x6B, 0x6C,
-    0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x7F, 0xFD, 0x48, 0x7F, 0xFD, 0x8C, 0x7F, 0x5E, 0x97, 0x7F,
-    0xFD, 0xCF, 0x7F, 0xFE, 0x40, 0x7F, 0xFE, 0x65, 0x7F, 0xFE, 0x77, 0x7F, 0xFE, 0x89, 0x7F, 0xFE,
-    0x91, 0x7F, 0xFE, 0xA0, 0x7F, 0xFE, 0xF4, 0x7E, 0x7B, 0xAA, 0x7F, 0xFF, 0xC5, 0x7F, 0xFF, 0xF7,
+    0xFF, 0xEB, 0x7F, 0x12, 0x7E, 0xEE, 0x06, 0xF1, 0x61, 0x62, 0x63, 0x65, 0x69, 0x6B, 0x6C, 0x6E,
+    0x6F, 0x70, 0x73, 0x74, 0x75, 0xC3, 0x7F, 0xFD, 0x48, 0x7F, 0x5E, 0x97, 0x7F, 0xFD, 0xCF, 0x7F,
+    0xFE, 0x40, 0x7F, 0xFE, 0x65, 0x7F, 0xFE, 0x77, 0x7F, 0xFE, 0x89, 0x7F, 0xFE, 0x91, 0x7F, 0xFE,
+    0xA0, 0x7F, 0xFE, 0xF4, 0x7E, 0x7B, 0xAA, 0x7F, 0xFF, 0xC5, 0x7F, 0xFF, 0xF7, 0x7F, 0xFD, 0x8C,
     0x61, 0x68, 0x7E, 0xCE, 0x63, 0x62, 0x68, 0x72, 0x7E, 0x6F, 0xDC, 0x7F, 0x26, 0x0F, 0xE1, 0x00,
     0x51, 0x72, 0x7E, 0x6F, 0xD3, 0x63, 0x6C, 0x74, 0x75, 0x7E, 0x6F, 0xCC, 0x7E, 0x6F, 0xCC, 0x7E,
     0x71, 0x44, 0x61, 0x70, 0x7E, 0x64, 0x31, 0xE1, 0x00, 0xA1, 0x66, 0x7E, 0x59, 0xC9, 0x21, 0x72,
@@ -6946,10 +6946,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x8C, 0x7E, 0xAF, 0xB7, 0x7E, 0x52, 0x8C, 0x63, 0x69, 0x6E, 0x72, 0x7E, 0x52, 0x7F, 0x7E, 0x82,
     0xA3, 0x7E, 0x52, 0xE8, 0x63, 0x61, 0x65, 0x69, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF3, 0x7E, 0x53,
     0x0D, 0x64, 0x65, 0x68, 0x6D, 0x72, 0x7F, 0xFF, 0xC9, 0x7E, 0x6C, 0x80, 0x7F, 0xFF, 0xD2, 0x7F,
-    0xFF, 0xF3, 0xED, 0x06, 0xF1, 0x61, 0xC3, 0x62, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75,
-    0x77, 0x7A, 0x7F, 0xFD, 0x60, 0x7F, 0xFD, 0xAF, 0x7F, 0xFD, 0xB9, 0x7F, 0xFE, 0x6A, 0x7F, 0xFE,
-    0xA7, 0x7F, 0xFE, 0xDF, 0x7F, 0xFF, 0x22, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x9F, 0x7E, 0x6C, 0x6F,
-    0x7F, 0xFF, 0xEF, 0x7E, 0x99, 0x87, 0x7E, 0xD1, 0xBA, 0xE3, 0x29, 0xC2, 0x61, 0x6F, 0x73, 0x7E,
+    0xFF, 0xF3, 0xED, 0x06, 0xF1, 0x61, 0x62, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77,
+    0x7A, 0xC3, 0x7F, 0xFD, 0x60, 0x7F, 0xFD, 0xB9, 0x7F, 0xFE, 0x6A, 0x7F, 0xFE, 0xA7, 0x7F, 0xFE,
+    0xDF, 0x7F, 0xFF, 0x22, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x9F, 0x7E, 0x6C, 0x6F, 0x7F, 0xFF, 0xEF,
+    0x7E, 0x99, 0x87, 0x7E, 0xD1, 0xBA, 0x7F, 0xFD, 0xAF, 0xE3, 0x29, 0xC2, 0x61, 0x6F, 0x73, 0x7E,
     0xFF, 0x45, 0x7E, 0x6B, 0x2B, 0x7E, 0x5B, 0x32, 0x63, 0x6F, 0x72, 0x73, 0x7E, 0x55, 0x66, 0x7E,
     0x55, 0x66, 0x7E, 0x95, 0x05, 0x62, 0x73, 0x74, 0x7F, 0x44, 0x14, 0x7F, 0xFF, 0xF3, 0x62, 0x68,
     0x6B, 0x7F, 0xFF, 0xF7, 0x7E, 0x76, 0x54, 0x62, 0x65, 0x72, 0x7E, 0xB5, 0xAC, 0x7E, 0x6A, 0xFD,
@@ -7025,14 +7025,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x72, 0x49, 0x7E, 0x66, 0xA7, 0x7E, 0x74, 0x7A, 0x7E, 0x66, 0xA7, 0xEB, 0x06, 0xF1, 0x61, 0xC3,
     0x65, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0x76, 0x77, 0x7F, 0xFF, 0x07, 0x7F, 0xFF, 0x34, 0x7F,
     0xFF, 0x82, 0x7F, 0xFF, 0xB4, 0x7E, 0x67, 0xA6, 0x7F, 0xFF, 0xC5, 0x7E, 0xBF, 0x13, 0x7F, 0xFF,
-    0xDA, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xEF, 0x7B, 0x61, 0xC3, 0x62, 0x63, 0x64,
-    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7F, 0xD7, 0xED, 0x7F, 0xD9, 0x7E, 0x7F, 0xDA, 0xA8, 0x7F,
-    0xDB, 0x52, 0x7F, 0xDD, 0x93, 0x7F, 0xE5, 0xAA, 0x7F, 0xE6, 0x89, 0x7F, 0xE6, 0xF9, 0x7F, 0xE7,
-    0x2F, 0x7F, 0xEA, 0xE7, 0x7E, 0x67, 0x74, 0x7F, 0xEB, 0xB1, 0x7F, 0xEF, 0x1A, 0x7F, 0xF0, 0x80,
-    0x7F, 0xF0, 0xD8, 0x7F, 0xF3, 0x2E, 0x7F, 0xF3, 0xC6, 0x7E, 0x67, 0x74, 0x7F, 0xF4, 0x28, 0x7F,
-    0xF7, 0x5B, 0x7F, 0xFB, 0x08, 0x7F, 0xFE, 0x30, 0x7F, 0xFE, 0x7E, 0x7E, 0x67, 0x74, 0x7E, 0x67,
-    0x74, 0x7F, 0xFE, 0xB2, 0x7F, 0xFF, 0xD1, 0x64, 0x6C, 0x6E, 0x72, 0x74, 0x7E, 0x8F, 0x4D, 0x7E,
+    0xDA, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xEF, 0x7B, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x7F, 0xD7, 0xED, 0x7F, 0xDA, 0xA8, 0x7F, 0xDB, 0x52, 0x7F,
+    0xDD, 0x93, 0x7F, 0xE5, 0xAA, 0x7F, 0xE6, 0x89, 0x7F, 0xE6, 0xF9, 0x7F, 0xE7, 0x2F, 0x7F, 0xEA,
+    0xE7, 0x7E, 0x67, 0x74, 0x7F, 0xEB, 0xB1, 0x7F, 0xEF, 0x1A, 0x7F, 0xF0, 0x80, 0x7F, 0xF0, 0xD8,
+    0x7F, 0xF3, 0x2E, 0x7F, 0xF3, 0xC6, 0x7E, 0x67, 0x74, 0x7F, 0xF4, 0x28, 0x7F, 0xF7, 0x5B, 0x7F,
+    0xFB, 0x08, 0x7F, 0xFE, 0x30, 0x7F, 0xFE, 0x7E, 0x7E, 0x67, 0x74, 0x7E, 0x67, 0x74, 0x7F, 0xFE,
+    0xB2, 0x7F, 0xFF, 0xD1, 0x7F, 0xD9, 0x7E, 0x64, 0x6C, 0x6E, 0x72, 0x74, 0x7E, 0x8F, 0x4D, 0x7E,
     0x4C, 0xF2, 0x7E, 0x90, 0x46, 0x7E, 0x73, 0xA4, 0x61, 0xA4, 0x7E, 0xB0, 0x2B, 0x62, 0x61, 0xC3,
     0x7E, 0x65, 0xF1, 0x7F, 0xFF, 0xFB, 0x62, 0x61, 0x69, 0x7E, 0x4C, 0xD0, 0x7E, 0x66, 0x07, 0x6F,
     0x62, 0x64, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x77, 0x7A, 0x7E,
@@ -7068,10 +7068,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6E, 0x7E, 0xD7, 0x24, 0x7F, 0xFF, 0xF7, 0x63, 0x6E, 0x70, 0x72, 0x7E, 0x64, 0x5A, 0x7E, 0x64,
     0x16, 0x7E, 0x6C, 0xED, 0xE2, 0x03, 0x41, 0x62, 0x6E, 0x7E, 0x4B, 0x10, 0x7E, 0x4B, 0x10, 0x21,
     0x72, 0xF5, 0x21, 0x65, 0xFD, 0x62, 0x6B, 0x74, 0x7E, 0x4B, 0xAE, 0x7F, 0xFF, 0xFD, 0xE1, 0x00,
-    0x51, 0x74, 0x7E, 0x64, 0x33, 0x61, 0xA4, 0x7E, 0x56, 0x65, 0x21, 0xC3, 0xFB, 0x6C, 0x61, 0xC3,
-    0x62, 0x64, 0x65, 0x69, 0x6B, 0x6C, 0x6F, 0x73, 0x75, 0x7A, 0x7F, 0xFF, 0x87, 0x7E, 0x77, 0xCF,
-    0x7E, 0x4A, 0x3F, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xC1, 0x7E, 0x4A, 0x3F, 0x7E,
-    0xCE, 0x1D, 0x7F, 0xFF, 0xCA, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF1, 0x7F, 0xFF, 0xFD, 0x61, 0xB6,
+    0x51, 0x74, 0x7E, 0x64, 0x33, 0x61, 0xA4, 0x7E, 0x56, 0x65, 0x21, 0xC3, 0xFB, 0x6C, 0x61, 0x62,
+    0x64, 0x65, 0x69, 0x6B, 0x6C, 0x6F, 0x73, 0x75, 0x7A, 0xC3, 0x7F, 0xFF, 0x87, 0x7E, 0x4A, 0x3F,
+    0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xC1, 0x7E, 0x4A, 0x3F, 0x7E, 0xCE, 0x1D, 0x7F,
+    0xFF, 0xCA, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF1, 0x7F, 0xFF, 0xFD, 0x7E, 0x77, 0xCF, 0x61, 0xB6,
     0x7E, 0xA9, 0x49, 0x66, 0x62, 0x69, 0x6F, 0xC3, 0x70, 0x74, 0x7E, 0x65, 0x49, 0x7E, 0xCB, 0xE7,
     0x7E, 0x6C, 0x97, 0x7F, 0xFF, 0xFB, 0x7E, 0x65, 0x49, 0x7E, 0x65, 0x49, 0x67, 0x65, 0x67, 0x6C,
     0x6E, 0x72, 0x74, 0x75, 0x7E, 0x63, 0x72, 0x7E, 0x65, 0x8A, 0x7E, 0xAD, 0xA7, 0x7E, 0x49, 0xED,
@@ -7087,12 +7087,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xF3, 0x7E, 0xCB, 0x8A, 0x7F, 0xFF, 0xF6, 0x7E, 0x64, 0xEC, 0x7E, 0x64, 0xEC, 0x7F, 0xFF, 0xFB,
     0x62, 0x67, 0x6E, 0x7E, 0x49, 0xA6, 0x7E, 0x49, 0xA6, 0x21, 0x61, 0xF7, 0x62, 0x6D, 0x73, 0x7E,
     0x49, 0x2D, 0x7E, 0x49, 0x97, 0x61, 0x65, 0x7E, 0x75, 0x4C, 0x64, 0x61, 0x65, 0x75, 0xC3, 0x7E,
-    0x64, 0xB9, 0x7E, 0x4A, 0x73, 0x7E, 0x62, 0xA4, 0x7E, 0xAC, 0x3B, 0x72, 0x61, 0xC3, 0x62, 0x63,
-    0x64, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0x7A, 0x7F, 0xFF,
-    0x21, 0x7F, 0xFF, 0x3E, 0x7F, 0xFF, 0x43, 0x7F, 0xFF, 0x51, 0x7F, 0xFF, 0x54, 0x7F, 0xFF, 0x64,
-    0x7F, 0xFF, 0x79, 0x7F, 0xD0, 0x27, 0x7F, 0xFF, 0x86, 0x7E, 0x63, 0xE4, 0x7F, 0xFF, 0x8F, 0x7F,
-    0xFF, 0x98, 0x7F, 0xFF, 0xA1, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF,
-    0xEA, 0x7F, 0xFF, 0xEF, 0x62, 0x62, 0x72, 0x7E, 0x6E, 0xDB, 0x7E, 0x62, 0x40, 0x62, 0x61, 0x6C,
+    0x64, 0xB9, 0x7E, 0x4A, 0x73, 0x7E, 0x62, 0xA4, 0x7E, 0xAC, 0x3B, 0x72, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3, 0x7F, 0xFF,
+    0x21, 0x7F, 0xFF, 0x43, 0x7F, 0xFF, 0x51, 0x7F, 0xFF, 0x54, 0x7F, 0xFF, 0x64, 0x7F, 0xFF, 0x79,
+    0x7F, 0xD0, 0x27, 0x7F, 0xFF, 0x86, 0x7E, 0x63, 0xE4, 0x7F, 0xFF, 0x8F, 0x7F, 0xFF, 0x98, 0x7F,
+    0xFF, 0xA1, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF,
+    0xEF, 0x7F, 0xFF, 0x3E, 0x62, 0x62, 0x72, 0x7E, 0x6E, 0xDB, 0x7E, 0x62, 0x40, 0x62, 0x61, 0x6C,
     0x7E, 0x64, 0x56, 0x7E, 0x64, 0x56, 0x64, 0x66, 0x68, 0x70, 0x72, 0x7E, 0x6F, 0xD5, 0x7E, 0x6E,
     0x89, 0x7F, 0xFF, 0xF7, 0x7E, 0x63, 0x3B, 0x62, 0x67, 0x6E, 0x7E, 0x63, 0x75, 0x7E, 0x49, 0x0F,
     0xE1, 0x02, 0xC2, 0x75, 0x7E, 0x62, 0x1E, 0xE2, 0x07, 0x71, 0x6C, 0x72, 0x7E, 0x4B, 0x26, 0x7E,
@@ -7101,10 +7101,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6F, 0x72, 0x77, 0x7F, 0xFF, 0xF7, 0x7E, 0x57, 0xD6, 0x7E, 0x4D, 0x05, 0x7E, 0x4D, 0x05, 0x7E,
     0x4D, 0x05, 0x7E, 0x4D, 0x05, 0x7E, 0x57, 0xD6, 0x21, 0x68, 0xE3, 0x64, 0x63, 0x65, 0x70, 0x75,
     0x7F, 0xFF, 0xFD, 0x7E, 0x63, 0xE8, 0x7E, 0x48, 0xBB, 0x7E, 0x48, 0xBB, 0x62, 0x2E, 0x69, 0x7E,
-    0x63, 0x10, 0x7E, 0x63, 0xD7, 0x6D, 0x61, 0x62, 0x65, 0x67, 0x69, 0x6B, 0x6D, 0x6F, 0xC3, 0x72,
-    0x73, 0x74, 0x75, 0x7F, 0xFF, 0x92, 0x7E, 0x63, 0x77, 0x7E, 0xCB, 0x12, 0x7F, 0xFF, 0x9B, 0x7E,
-    0x62, 0xBC, 0x7F, 0xFF, 0xA2, 0x7F, 0xFF, 0xAD, 0x7F, 0xFF, 0xB6, 0x7F, 0xB2, 0xAB, 0x7E, 0x62,
-    0xB9, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x7E, 0x62, 0xBC, 0x62, 0x68, 0x6F, 0x7E, 0x49, 0x53,
+    0x63, 0x10, 0x7E, 0x63, 0xD7, 0x6D, 0x61, 0x62, 0x65, 0x67, 0x69, 0x6B, 0x6D, 0x6F, 0x72, 0x73,
+    0x74, 0x75, 0xC3, 0x7F, 0xFF, 0x92, 0x7E, 0x63, 0x77, 0x7E, 0xCB, 0x12, 0x7F, 0xFF, 0x9B, 0x7E,
+    0x62, 0xBC, 0x7F, 0xFF, 0xA2, 0x7F, 0xFF, 0xAD, 0x7F, 0xFF, 0xB6, 0x7E, 0x62, 0xB9, 0x7F, 0xFF,
+    0xE6, 0x7F, 0xFF, 0xF7, 0x7E, 0x62, 0xBC, 0x7F, 0xB2, 0xAB, 0x62, 0x68, 0x6F, 0x7E, 0x49, 0x53,
     0x7E, 0x62, 0x87, 0x61, 0x72, 0x7E, 0x52, 0xFB, 0xE3, 0x0B, 0xD2, 0x61, 0x65, 0x72, 0x7E, 0x62,
     0x79, 0x7E, 0x64, 0x8B, 0x7E, 0x62, 0x79, 0x61, 0x6F, 0x7E, 0xAC, 0xCF, 0x62, 0x6C, 0x6E, 0x7E,
     0x63, 0x0E, 0x7F, 0xAE, 0x05, 0x65, 0x61, 0x65, 0x69, 0x6F, 0x72, 0x7E, 0x4D, 0x01, 0x7F, 0xFF,
@@ -7193,10 +7193,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0x4A, 0xFD, 0x62, 0x73, 0x77, 0x7E, 0x43, 0x7F, 0x7E, 0x43, 0x7F, 0x64, 0x69, 0x6E, 0x72,
     0x74, 0x7F, 0x3E, 0x3D, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xF7, 0x7E, 0x43, 0x0A, 0x62, 0x65, 0x6F,
     0x7E, 0xB2, 0x98, 0x7F, 0x51, 0x98, 0x45, 0x61, 0x65, 0x68, 0x69, 0x72, 0xFF, 0xCF, 0xFF, 0xE6,
-    0x86, 0x78, 0x92, 0x8A, 0xFF, 0xF7, 0x6D, 0x2E, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B,
-    0x73, 0x74, 0x75, 0x7A, 0x7E, 0x5B, 0xEB, 0x7F, 0xFF, 0x04, 0x7E, 0x70, 0x6E, 0x7F, 0xFF, 0x19,
-    0x7F, 0xFF, 0x44, 0x7E, 0x42, 0x73, 0x7F, 0xFF, 0x5D, 0x7F, 0xFF, 0x61, 0x7E, 0x42, 0x76, 0x7F,
-    0xFF, 0xA2, 0x7F, 0xFF, 0xF0, 0x7E, 0x4C, 0x07, 0x7E, 0xA7, 0x25, 0xE1, 0x0D, 0x02, 0x75, 0x7E,
+    0x86, 0x78, 0x92, 0x8A, 0xFF, 0xF7, 0x6D, 0x2E, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x73,
+    0x74, 0x75, 0x7A, 0xC3, 0x7E, 0x5B, 0xEB, 0x7F, 0xFF, 0x04, 0x7F, 0xFF, 0x19, 0x7F, 0xFF, 0x44,
+    0x7E, 0x42, 0x73, 0x7F, 0xFF, 0x5D, 0x7F, 0xFF, 0x61, 0x7E, 0x42, 0x76, 0x7F, 0xFF, 0xA2, 0x7F,
+    0xFF, 0xF0, 0x7E, 0x4C, 0x07, 0x7E, 0xA7, 0x25, 0x7E, 0x70, 0x6E, 0xE1, 0x0D, 0x02, 0x75, 0x7E,
     0x5C, 0xC3, 0xE2, 0x05, 0x11, 0x73, 0x75, 0x7E, 0x42, 0xA1, 0x7E, 0x64, 0x94, 0x62, 0x65, 0x75,
     0x7F, 0x25, 0x51, 0x7E, 0x42, 0xE2, 0x63, 0x64, 0x73, 0x74, 0x7E, 0x5C, 0x0E, 0x7E, 0x5C, 0x0E,
     0x7E, 0x5C, 0x0E, 0x63, 0x64, 0x66, 0x6B, 0x7E, 0x5C, 0x01, 0x7E, 0x5C, 0x01, 0x7E, 0x73, 0xB8,
@@ -7395,10 +7395,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x72, 0x7E, 0x79, 0x99, 0x7E, 0x36, 0x11, 0x61, 0x72, 0x7E, 0x56, 0x4D, 0x61, 0x72, 0x7E, 0x38,
     0x91, 0x66, 0x61, 0x63, 0x65, 0x6B, 0x70, 0x74, 0x7E, 0x4F, 0x73, 0x7E, 0x36, 0x68, 0x7F, 0xFF,
     0xE2, 0x7F, 0xFF, 0xED, 0x7F, 0xFF, 0xF6, 0x7F, 0xFF, 0xFB, 0x62, 0x65, 0x6D, 0x7E, 0x3E, 0xAF,
-    0x7E, 0x50, 0x67, 0xED, 0x06, 0xF1, 0x61, 0xC3, 0x63, 0x65, 0x68, 0x69, 0x6D, 0x6F, 0x72, 0x73,
-    0x74, 0x75, 0x7A, 0x7F, 0xFE, 0xBE, 0x7F, 0xFE, 0xCC, 0x7E, 0x50, 0x5E, 0x7F, 0xFF, 0x1C, 0x7E,
-    0x55, 0x40, 0x7F, 0xFF, 0x6B, 0x7F, 0xFF, 0x89, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0xAF, 0x7F, 0xFF,
-    0xDE, 0x7E, 0x36, 0x46, 0x7F, 0xFF, 0xF7, 0x7E, 0x36, 0x46, 0xE3, 0x00, 0xA1, 0x6B, 0x73, 0x7A,
+    0x7E, 0x50, 0x67, 0xED, 0x06, 0xF1, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6D, 0x6F, 0x72, 0x73, 0x74,
+    0x75, 0x7A, 0xC3, 0x7F, 0xFE, 0xBE, 0x7E, 0x50, 0x5E, 0x7F, 0xFF, 0x1C, 0x7E, 0x55, 0x40, 0x7F,
+    0xFF, 0x6B, 0x7F, 0xFF, 0x89, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0xAF, 0x7F, 0xFF, 0xDE, 0x7E, 0x36,
+    0x46, 0x7F, 0xFF, 0xF7, 0x7E, 0x36, 0x46, 0x7F, 0xFE, 0xCC, 0xE3, 0x00, 0xA1, 0x6B, 0x73, 0x7A,
     0x7E, 0x7E, 0x44, 0x7E, 0x7E, 0x44, 0x7E, 0x7E, 0x44, 0x62, 0x6C, 0x72, 0x7E, 0x4F, 0x34, 0x7F,
     0xFF, 0xF1, 0x62, 0x70, 0x74, 0x7E, 0x38, 0xFE, 0x7E, 0x38, 0xFE, 0x63, 0x65, 0x73, 0x75, 0x7F,
     0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7E, 0x4F, 0x22, 0xA1, 0x06, 0xF1, 0x6B, 0xF3, 0x62, 0x65, 0x6C,
@@ -7420,29 +7420,29 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x36, 0x7F, 0xFF, 0xE2, 0x7E, 0x5A, 0xBF, 0x7E, 0x4E, 0x36, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF5,
     0x7E, 0x4E, 0x00, 0x61, 0x9F, 0x7E, 0x40, 0x8B, 0x64, 0x61, 0x65, 0x6F, 0x73, 0x7E, 0x7F, 0xE8,
     0x7E, 0x5E, 0x8C, 0x7E, 0x93, 0x9F, 0x7E, 0xE1, 0x57, 0xED, 0x07, 0xB1, 0x61, 0x63, 0x65, 0x66,
-    0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0xC3, 0x74, 0x7E, 0x53, 0xBA, 0x7F, 0xFE, 0xDF, 0x7F,
+    0x67, 0x68, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xC3, 0x7E, 0x53, 0xBA, 0x7F, 0xFE, 0xDF, 0x7F,
     0xFE, 0xFA, 0x7E, 0x4D, 0xCB, 0x7E, 0x4E, 0xD5, 0x7E, 0x53, 0x38, 0x7F, 0xFF, 0x1C, 0x7F, 0xFF,
-    0x36, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x98, 0x7F, 0xFF, 0xCB, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xEF,
+    0x36, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x98, 0x7F, 0xFF, 0xCB, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF, 0xEA,
     0x61, 0x72, 0x7E, 0x3A, 0x20, 0xA1, 0x01, 0x81, 0x65, 0xFB, 0xA1, 0x00, 0x51, 0x74, 0xFB, 0x41,
     0x72, 0x91, 0xA1, 0x21, 0x65, 0xFC, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x22,
     0x6C, 0x74, 0xEB, 0xFD, 0xA1, 0x08, 0x62, 0x65, 0xFB, 0x62, 0x70, 0x74, 0x7E, 0x5A, 0x06, 0x7E,
     0x4D, 0xD8, 0xE4, 0x07, 0xB1, 0x61, 0x6C, 0x6F, 0x73, 0x7E, 0x53, 0x51, 0x7E, 0x76, 0xB2, 0x7E,
-    0xB4, 0x04, 0x7F, 0xFF, 0xF7, 0x7A, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A,
-    0x7F, 0xED, 0x2A, 0x7F, 0xED, 0xF7, 0x7F, 0xEE, 0x34, 0x7F, 0xEE, 0x53, 0x7F, 0xEE, 0xD2, 0x7F,
-    0xF3, 0x4E, 0x7F, 0xF3, 0xA4, 0x7F, 0xF3, 0xB3, 0x7F, 0xF3, 0xCC, 0x7F, 0xF5, 0xE9, 0x7F, 0xF6,
-    0x34, 0x7E, 0x93, 0x93, 0x7F, 0xF6, 0x49, 0x7F, 0xF8, 0x00, 0x7F, 0xF8, 0x46, 0x7F, 0xF9, 0xBF,
-    0x7F, 0xFA, 0xF9, 0x7E, 0x4E, 0x59, 0x7F, 0xFB, 0x2F, 0x7F, 0xFC, 0x81, 0x7F, 0xFD, 0xFE, 0x7F,
-    0xFF, 0x84, 0x7E, 0x4E, 0x59, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xED, 0x7E, 0x4E, 0x95, 0xE1, 0x07,
+    0xB4, 0x04, 0x7F, 0xFF, 0xF7, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3,
+    0x7F, 0xED, 0x2A, 0x7F, 0xEE, 0x34, 0x7F, 0xEE, 0x53, 0x7F, 0xEE, 0xD2, 0x7F, 0xF3, 0x4E, 0x7F,
+    0xF3, 0xA4, 0x7F, 0xF3, 0xB3, 0x7F, 0xF3, 0xCC, 0x7F, 0xF5, 0xE9, 0x7F, 0xF6, 0x34, 0x7E, 0x93,
+    0x93, 0x7F, 0xF6, 0x49, 0x7F, 0xF8, 0x00, 0x7F, 0xF8, 0x46, 0x7F, 0xF9, 0xBF, 0x7F, 0xFA, 0xF9,
+    0x7E, 0x4E, 0x59, 0x7F, 0xFB, 0x2F, 0x7F, 0xFC, 0x81, 0x7F, 0xFD, 0xFE, 0x7F, 0xFF, 0x84, 0x7E,
+    0x4E, 0x59, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xED, 0x7E, 0x4E, 0x95, 0x7F, 0xED, 0xF7, 0xE1, 0x07,
     0x71, 0x72, 0x7E, 0x4D, 0x53, 0x62, 0xA4, 0xB6, 0x7E, 0x4D, 0x85, 0x7E, 0x4D, 0x85, 0x64, 0x63,
     0x69, 0x6E, 0x72, 0x7E, 0x4D, 0x7C, 0x7E, 0x4C, 0xFF, 0x7E, 0x33, 0xA1, 0x7E, 0x33, 0x67, 0xE1,
     0x02, 0xF1, 0x74, 0x7E, 0x9B, 0x29, 0x62, 0x72, 0x73, 0x7E, 0x4D, 0x2B, 0x7E, 0x4C, 0xE7, 0x65,
     0x61, 0x65, 0x69, 0x75, 0xC3, 0x7E, 0x4C, 0xDE, 0x7E, 0x4C, 0xDE, 0x7E, 0x4C, 0xDE, 0x7E, 0x3A,
-    0x7E, 0x7E, 0xB3, 0xDA, 0xF0, 0x06, 0xB1, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-    0x6C, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFF, 0xBA, 0x7F, 0xFF, 0xC1, 0x7E, 0x4D, 0xF8,
-    0x7E, 0x4D, 0xF8, 0x7F, 0xFF, 0xCA, 0x7F, 0x14, 0x83, 0x7E, 0x4D, 0xAA, 0x7E, 0x4C, 0xAA, 0x7F,
-    0xFF, 0xDB, 0x7E, 0x4C, 0xA0, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xEB, 0x7E, 0x4D, 0xF8, 0x7E, 0x4D,
-    0xF8, 0x7E, 0x53, 0xEE, 0x7E, 0x4D, 0xAA, 0xA0, 0x2A, 0xB2, 0xE2, 0x00, 0xA1, 0x2E, 0x74, 0x7E,
+    0x7E, 0x7E, 0xB3, 0xDA, 0xF0, 0x06, 0xB1, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6C,
+    0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFF, 0xBA, 0x7E, 0x4D, 0xF8, 0x7E, 0x4D, 0xF8,
+    0x7F, 0xFF, 0xCA, 0x7F, 0x14, 0x83, 0x7E, 0x4D, 0xAA, 0x7E, 0x4C, 0xAA, 0x7F, 0xFF, 0xDB, 0x7E,
+    0x4C, 0xA0, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xEB, 0x7E, 0x4D, 0xF8, 0x7E, 0x4D, 0xF8, 0x7E, 0x53,
+    0xEE, 0x7E, 0x4D, 0xAA, 0x7F, 0xFF, 0xC1, 0xA0, 0x2A, 0xB2, 0xE2, 0x00, 0xA1, 0x2E, 0x74, 0x7E,
     0x4E, 0x10, 0x7F, 0xFF, 0xFD, 0x62, 0x62, 0x73, 0x7E, 0x36, 0x4B, 0x7E, 0x36, 0x4B, 0xA2, 0x00,
     0x81, 0x6E, 0x72, 0xEC, 0xF7, 0xA0, 0x2A, 0xD3, 0xE3, 0x00, 0xD1, 0x63, 0x65, 0x70, 0x7E, 0x4E,
     0x5E, 0x7E, 0x4F, 0xB2, 0x7F, 0xFF, 0xFD, 0x61, 0x63, 0x7E, 0x3D, 0x71, 0x63, 0x66, 0x6B, 0x73,
@@ -7486,11 +7486,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x05, 0x7F, 0xFF, 0xF9, 0x7E, 0x4B, 0x34, 0x7E, 0x4A, 0x05, 0x7E, 0x4A, 0x49, 0x62, 0x61, 0x72,
     0x7E, 0x31, 0x1C, 0x7E, 0x30, 0x52, 0x62, 0x2E, 0x6B, 0x7E, 0x4B, 0x57, 0x7F, 0xFF, 0xF7, 0x64,
     0x2E, 0x64, 0x6F, 0x79, 0x7E, 0x49, 0xBF, 0x7E, 0x49, 0xBF, 0x7E, 0x30, 0x40, 0x7E, 0x4B, 0x4E,
-    0xE1, 0x06, 0xC1, 0x6B, 0x7E, 0x30, 0x29, 0x71, 0x2E, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67,
-    0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7E, 0x49, 0x9A, 0x7F, 0xFF, 0x0A, 0x7F,
-    0xFF, 0x31, 0x7F, 0xFF, 0x3A, 0x7E, 0x35, 0x47, 0x7F, 0xFF, 0x7C, 0x7E, 0x30, 0x25, 0x7E, 0x30,
-    0x22, 0x7F, 0xFF, 0xA1, 0x7E, 0x30, 0x25, 0x7F, 0xFF, 0xAD, 0x7E, 0x49, 0xBC, 0x7F, 0xFF, 0xC1,
-    0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF9, 0x7E, 0x4A, 0xA7, 0x62, 0x6C, 0x74, 0x7E,
+    0xE1, 0x06, 0xC1, 0x6B, 0x7E, 0x30, 0x29, 0x71, 0x2E, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69,
+    0x6B, 0x6C, 0x6D, 0x6F, 0x73, 0x74, 0x75, 0x79, 0xC3, 0x7E, 0x49, 0x9A, 0x7F, 0xFF, 0x0A, 0x7F,
+    0xFF, 0x3A, 0x7E, 0x35, 0x47, 0x7F, 0xFF, 0x7C, 0x7E, 0x30, 0x25, 0x7E, 0x30, 0x22, 0x7F, 0xFF,
+    0xA1, 0x7E, 0x30, 0x25, 0x7F, 0xFF, 0xAD, 0x7E, 0x49, 0xBC, 0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xDF,
+    0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF9, 0x7E, 0x4A, 0xA7, 0x7F, 0xFF, 0x31, 0x62, 0x6C, 0x74, 0x7E,
     0x5D, 0x08, 0x7E, 0x5D, 0x08, 0x61, 0x70, 0x7E, 0x34, 0x3E, 0xA1, 0x08, 0x32, 0x73, 0xFB, 0x64,
     0x2E, 0x69, 0x6E, 0x72, 0x7E, 0x49, 0xEB, 0x7E, 0x49, 0x6E, 0x7F, 0xFF, 0xFB, 0x7E, 0x93, 0x84,
     0xE2, 0x02, 0xF1, 0x64, 0x6E, 0x7E, 0x5C, 0xE4, 0x7E, 0x49, 0x5D, 0x6A, 0x61, 0xC3, 0x65, 0x69,
@@ -7503,11 +7503,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x4A, 0x23, 0xE2, 0x00, 0xA1, 0x65, 0x67, 0x7E, 0x33, 0xDE, 0x7E, 0x33, 0xDE, 0x64, 0x66, 0x67,
     0x6D, 0x73, 0x7E, 0x2F, 0xB9, 0x7E, 0x93, 0x93, 0x7E, 0x2F, 0xB9, 0x7E, 0x30, 0x15, 0x22, 0x6E,
     0x72, 0xE4, 0xEF, 0x63, 0x65, 0x69, 0x77, 0x7F, 0xFF, 0xFB, 0x7E, 0x2F, 0xDC, 0x7E, 0x2F, 0x93,
-    0x73, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73,
-    0x74, 0x75, 0x77, 0x7A, 0x7F, 0xFF, 0x94, 0x7E, 0xF3, 0xE1, 0x7E, 0x49, 0x9E, 0x7F, 0xFF, 0xA3,
-    0x7F, 0xFF, 0xB2, 0x7E, 0x49, 0xEC, 0x7F, 0x0E, 0x2E, 0x7E, 0x49, 0x9E, 0x7E, 0x49, 0x9E, 0x7E,
-    0x4A, 0xB3, 0x7E, 0x49, 0xEC, 0x7E, 0x4A, 0xB3, 0x7F, 0xFF, 0xBF, 0x7E, 0x49, 0x9E, 0x7F, 0xFF,
-    0xC6, 0x7F, 0xFF, 0xC9, 0x7E, 0x49, 0x3A, 0x7E, 0x49, 0x9E, 0x7F, 0xFF, 0xF3, 0x61, 0xB6, 0x7E,
+    0x73, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74,
+    0x75, 0x77, 0x7A, 0xC3, 0x7F, 0xFF, 0x94, 0x7E, 0x49, 0x9E, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB2,
+    0x7E, 0x49, 0xEC, 0x7F, 0x0E, 0x2E, 0x7E, 0x49, 0x9E, 0x7E, 0x49, 0x9E, 0x7E, 0x4A, 0xB3, 0x7E,
+    0x49, 0xEC, 0x7E, 0x4A, 0xB3, 0x7F, 0xFF, 0xBF, 0x7E, 0x49, 0x9E, 0x7F, 0xFF, 0xC6, 0x7F, 0xFF,
+    0xC9, 0x7E, 0x49, 0x3A, 0x7E, 0x49, 0x9E, 0x7F, 0xFF, 0xF3, 0x7E, 0xF3, 0xE1, 0x61, 0xB6, 0x7E,
     0x4A, 0x2B, 0x61, 0x6C, 0x7E, 0x49, 0x9A, 0x64, 0x2E, 0x61, 0x65, 0x73, 0x7E, 0x48, 0xE3, 0x7E,
     0x49, 0x4A, 0x7F, 0xFF, 0xFB, 0x7E, 0x48, 0xE3, 0x65, 0x65, 0x66, 0x6C, 0x6F, 0x72, 0x7E, 0x54,
     0x87, 0x7F, 0xFF, 0xEF, 0x7E, 0x48, 0xD2, 0x7E, 0x4F, 0x7A, 0x7E, 0x48, 0x2C, 0xE3, 0x07, 0x71,
@@ -7515,18 +7515,18 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x48, 0xAE, 0x7E, 0x49, 0x15, 0x62, 0x69, 0x73, 0x7E, 0x34, 0x29, 0x7E, 0x2E, 0xEE, 0x62, 0x2E,
     0x65, 0x7E, 0x49, 0x4E, 0x7E, 0x49, 0x4E, 0x62, 0x61, 0xC3, 0x7E, 0x2F, 0x48, 0x7E, 0x36, 0x64,
     0x63, 0x2E, 0x65, 0x74, 0x7E, 0x49, 0x7D, 0x7E, 0x2F, 0x22, 0x7F, 0xFF, 0xF7, 0xE1, 0x06, 0xF1,
-    0x61, 0x7E, 0x49, 0x70, 0xF4, 0x06, 0xB1, 0x2E, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x68, 0x69,
-    0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x7E, 0x49, 0xEC, 0x7F, 0xFF,
-    0xB9, 0x7F, 0xFF, 0xC8, 0x7E, 0xE2, 0x86, 0x7E, 0x48, 0xDA, 0x7E, 0x57, 0x8D, 0x7F, 0xFF, 0xD1,
-    0x7E, 0x47, 0xCD, 0x7E, 0x57, 0x8D, 0x7E, 0x47, 0xCD, 0x7E, 0x59, 0x7C, 0x7F, 0xFF, 0xDA, 0x7E,
-    0x5E, 0xFB, 0x7E, 0x47, 0xCD, 0x7E, 0x5E, 0xED, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF9, 0x7F, 0x74,
-    0x9E, 0x7E, 0x47, 0xCD, 0x7E, 0x59, 0x7C, 0xE3, 0x07, 0x71, 0x6E, 0x72, 0x75, 0x7E, 0x47, 0xA6,
+    0x61, 0x7E, 0x49, 0x70, 0xF4, 0x06, 0xB1, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x68, 0x69, 0x6B,
+    0x6C, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xC3, 0x7E, 0x49, 0xEC, 0x7F, 0xFF,
+    0xB9, 0x7E, 0xE2, 0x86, 0x7E, 0x48, 0xDA, 0x7E, 0x57, 0x8D, 0x7F, 0xFF, 0xD1, 0x7E, 0x47, 0xCD,
+    0x7E, 0x57, 0x8D, 0x7E, 0x47, 0xCD, 0x7E, 0x59, 0x7C, 0x7F, 0xFF, 0xDA, 0x7E, 0x5E, 0xFB, 0x7E,
+    0x47, 0xCD, 0x7E, 0x5E, 0xED, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF9, 0x7F, 0x74, 0x9E, 0x7E, 0x47,
+    0xCD, 0x7E, 0x59, 0x7C, 0x7F, 0xFF, 0xC8, 0xE3, 0x07, 0x71, 0x6E, 0x72, 0x75, 0x7E, 0x47, 0xA6,
     0x7E, 0x47, 0xA6, 0x7E, 0x2E, 0x02, 0x62, 0x6D, 0x77, 0x7E, 0x47, 0x97, 0x7E, 0x47, 0x97, 0x21,
     0x68, 0xF7, 0xE1, 0x06, 0xC1, 0x68, 0x7E, 0x2E, 0x54, 0x62, 0x61, 0x65, 0x7E, 0x48, 0x68, 0x7F,
-    0x3F, 0xFB, 0xE1, 0x06, 0xC1, 0x6C, 0x7E, 0x35, 0xB4, 0x6C, 0x2E, 0x61, 0xC3, 0x63, 0x65, 0x66,
-    0x69, 0x70, 0x73, 0x74, 0x75, 0x79, 0x7E, 0x57, 0x08, 0x7F, 0xFF, 0xCE, 0x7E, 0x5E, 0x23, 0x7F,
-    0xFF, 0xE6, 0x7E, 0x47, 0xF1, 0x7E, 0x47, 0xF1, 0x7E, 0x47, 0x48, 0x7F, 0xFF, 0xE9, 0x7E, 0x98,
-    0x55, 0x7F, 0xFF, 0xF0, 0x7E, 0x47, 0x4B, 0x7F, 0xFF, 0xF9, 0x63, 0x6C, 0x74, 0x75, 0x7E, 0x31,
+    0x3F, 0xFB, 0xE1, 0x06, 0xC1, 0x6C, 0x7E, 0x35, 0xB4, 0x6C, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x69,
+    0x70, 0x73, 0x74, 0x75, 0x79, 0xC3, 0x7E, 0x57, 0x08, 0x7F, 0xFF, 0xCE, 0x7F, 0xFF, 0xE6, 0x7E,
+    0x47, 0xF1, 0x7E, 0x47, 0xF1, 0x7E, 0x47, 0x48, 0x7F, 0xFF, 0xE9, 0x7E, 0x98, 0x55, 0x7F, 0xFF,
+    0xF0, 0x7E, 0x47, 0x4B, 0x7F, 0xFF, 0xF9, 0x7E, 0x5E, 0x23, 0x63, 0x6C, 0x74, 0x75, 0x7E, 0x31,
     0xC8, 0x7E, 0x47, 0x43, 0x7E, 0x47, 0x87, 0x61, 0x68, 0x7E, 0x6D, 0x83, 0x63, 0x61, 0x63, 0x65,
     0x7E, 0x9A, 0x7F, 0x7F, 0xFF, 0xFB, 0x7E, 0x32, 0xBA, 0x62, 0x61, 0x65, 0x7E, 0x49, 0x1A, 0x7E,
     0xD2, 0x07, 0xE8, 0x07, 0xB1, 0x61, 0x65, 0x68, 0x6C, 0x6D, 0x6F, 0x73, 0x74, 0x7F, 0xFF, 0xD8,
@@ -7539,12 +7539,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xE3, 0x07, 0xB1, 0x61, 0x65, 0x69, 0x7E, 0x47, 0x8E, 0x7F, 0x48, 0x41, 0x7E, 0x86, 0x04, 0x64,
     0x2E, 0x69, 0x70, 0x74, 0x7E, 0x47, 0x1B, 0x7E, 0x46, 0x75, 0x7E, 0x47, 0x1B, 0x7E, 0x46, 0x7F,
     0x7A, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0xC3, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x7A, 0x7E, 0x48, 0x48, 0x7E, 0x48,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x7A, 0xC3, 0x7E, 0x48, 0x48, 0x7E, 0x48,
     0x48, 0x7F, 0xF9, 0xC4, 0x7F, 0xFA, 0x9A, 0x7F, 0xFA, 0xCF, 0x7F, 0xFB, 0x0A, 0x7F, 0xFB, 0x37,
     0x7F, 0xFB, 0x6D, 0x7F, 0xFB, 0x80, 0x7F, 0xFB, 0x9F, 0x7F, 0xFB, 0xB2, 0x7F, 0xFC, 0xC7, 0x7F,
-    0xFD, 0x3B, 0x7F, 0xFD, 0xD0, 0x7E, 0x49, 0xC9, 0x7F, 0xFE, 0x1D, 0x7F, 0xFE, 0x38, 0x7E, 0x46,
-    0xCE, 0x7F, 0xFE, 0x94, 0x7F, 0xFF, 0x19, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0xC5, 0x7F, 0xFF, 0xE0,
-    0x7E, 0x48, 0x48, 0x7F, 0xFF, 0xEF, 0x7E, 0x78, 0x3D, 0xE1, 0x02, 0xF1, 0x69, 0x7E, 0x2C, 0xEA,
+    0xFD, 0x3B, 0x7F, 0xFD, 0xD0, 0x7E, 0x49, 0xC9, 0x7F, 0xFE, 0x38, 0x7E, 0x46, 0xCE, 0x7F, 0xFE,
+    0x94, 0x7F, 0xFF, 0x19, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0xC5, 0x7F, 0xFF, 0xE0, 0x7E, 0x48, 0x48,
+    0x7F, 0xFF, 0xEF, 0x7E, 0x78, 0x3D, 0x7F, 0xFE, 0x1D, 0xE1, 0x02, 0xF1, 0x69, 0x7E, 0x2C, 0xEA,
     0x66, 0x65, 0x69, 0x6D, 0x6E, 0x72, 0x75, 0x7E, 0x47, 0x8D, 0x7E, 0x2C, 0xE9, 0x7E, 0x48, 0x10,
     0x7E, 0x47, 0xBC, 0x7F, 0xFF, 0xF9, 0x7E, 0x2C, 0xE9, 0x41, 0x65, 0xFD, 0x99, 0xA1, 0x02, 0xF1,
     0x66, 0xFC, 0x63, 0x6D, 0x72, 0x73, 0x7E, 0x2F, 0x9B, 0x7E, 0x47, 0x6B, 0x7F, 0x1D, 0x60, 0x63,
@@ -7614,10 +7614,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0x9A, 0x96, 0x62, 0x61, 0xC3, 0x7E, 0x4A, 0xE7, 0x7E, 0x56, 0x82, 0x66, 0x61, 0x63, 0x65,
     0x6B, 0x70, 0x7A, 0x7F, 0xB8, 0xB2, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xEE, 0x7E, 0x62, 0xE8, 0x7F,
     0xFF, 0xF7, 0x7E, 0x64, 0x2F, 0x62, 0x61, 0x69, 0x7E, 0x3B, 0xE1, 0x7E, 0x4F, 0xF0, 0xEC, 0x06,
-    0xF1, 0x61, 0xC3, 0x63, 0x64, 0x65, 0x69, 0x6B, 0x6E, 0x6F, 0x72, 0x73, 0x77, 0x7F, 0xFD, 0xC4,
-    0x7F, 0xFD, 0xFA, 0x7E, 0x47, 0x95, 0x7F, 0xFD, 0xFD, 0x7F, 0xFF, 0x09, 0x7F, 0xFF, 0x4E, 0x7F,
-    0xD5, 0x7F, 0x7E, 0x3C, 0x52, 0x7F, 0xFF, 0x6D, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF,
-    0xF7, 0x64, 0x62, 0x6E, 0x70, 0x72, 0x7E, 0x28, 0x68, 0x7E, 0x28, 0x68, 0x7E, 0x41, 0x73, 0x7E,
+    0xF1, 0x61, 0x63, 0x64, 0x65, 0x69, 0x6B, 0x6E, 0x6F, 0x72, 0x73, 0x77, 0xC3, 0x7F, 0xFD, 0xC4,
+    0x7E, 0x47, 0x95, 0x7F, 0xFD, 0xFD, 0x7F, 0xFF, 0x09, 0x7F, 0xFF, 0x4E, 0x7F, 0xD5, 0x7F, 0x7E,
+    0x3C, 0x52, 0x7F, 0xFF, 0x6D, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xF7, 0x7F, 0xFD,
+    0xFA, 0x64, 0x62, 0x6E, 0x70, 0x72, 0x7E, 0x28, 0x68, 0x7E, 0x28, 0x68, 0x7E, 0x41, 0x73, 0x7E,
     0x67, 0xDE, 0x62, 0x65, 0x73, 0x7F, 0xF6, 0x47, 0x7E, 0x28, 0x23, 0x21, 0x6C, 0xF7, 0x63, 0x65,
     0x6E, 0x72, 0x7F, 0xFF, 0xFD, 0x7E, 0x43, 0x1E, 0x7E, 0x28, 0x4B, 0x62, 0x72, 0x73, 0x7E, 0x42,
     0x56, 0x7E, 0x41, 0x53, 0x61, 0x61, 0x7E, 0x58, 0xA4, 0xE6, 0x06, 0xF1, 0x61, 0x65, 0x68, 0x6B,
@@ -7664,13 +7664,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0x40, 0xE3, 0x7E, 0x40, 0xE3, 0x7E, 0x40, 0xE3, 0x7E, 0x40, 0xE3, 0x7E, 0x40, 0xE3, 0x7E,
     0x40, 0xE3, 0x7F, 0x80, 0x6E, 0x7E, 0x40, 0xE3, 0x7E, 0x40, 0xE3, 0x7E, 0x40, 0x1C, 0x7E, 0x40,
     0x1C, 0xE1, 0x02, 0xF1, 0x69, 0x7F, 0x12, 0xD3, 0x61, 0x61, 0x7E, 0x4B, 0x89, 0xE3, 0x02, 0xF1,
-    0x69, 0x77, 0x79, 0x7F, 0xFF, 0xFB, 0x7E, 0x25, 0x45, 0x7E, 0x3E, 0x91, 0x77, 0x2E, 0x61, 0xC3,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x77, 0x7A, 0x7E, 0x40, 0x11, 0x7F, 0xFE, 0xDB, 0x7E, 0x52, 0xF8, 0x7E, 0x3E, 0x75,
-    0x7E, 0x3E, 0x75, 0x7F, 0xFE, 0xE6, 0x7F, 0xFF, 0x39, 0x7E, 0x62, 0x66, 0x7F, 0xFF, 0x6E, 0x7E,
-    0x3E, 0x75, 0x7E, 0x45, 0xF5, 0x7E, 0x3E, 0x75, 0x7E, 0x96, 0x87, 0x7E, 0x3E, 0x75, 0x7F, 0xFF,
-    0x83, 0x7E, 0x47, 0x3B, 0x7E, 0x3E, 0x75, 0x7F, 0xFF, 0x99, 0x7F, 0xFF, 0xB4, 0x7E, 0x3E, 0xE5,
-    0x7F, 0xFF, 0xE5, 0x7E, 0x3E, 0x75, 0x7F, 0xFF, 0xF1, 0xE1, 0x06, 0xF1, 0x73, 0x7E, 0x51, 0xCB,
+    0x69, 0x77, 0x79, 0x7F, 0xFF, 0xFB, 0x7E, 0x25, 0x45, 0x7E, 0x3E, 0x91, 0x77, 0x2E, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x7A, 0xC3, 0x7E, 0x40, 0x11, 0x7F, 0xFE, 0xDB, 0x7E, 0x3E, 0x75, 0x7E, 0x3E, 0x75,
+    0x7F, 0xFE, 0xE6, 0x7F, 0xFF, 0x39, 0x7E, 0x62, 0x66, 0x7F, 0xFF, 0x6E, 0x7E, 0x3E, 0x75, 0x7E,
+    0x45, 0xF5, 0x7E, 0x3E, 0x75, 0x7E, 0x96, 0x87, 0x7E, 0x3E, 0x75, 0x7F, 0xFF, 0x83, 0x7E, 0x47,
+    0x3B, 0x7E, 0x3E, 0x75, 0x7F, 0xFF, 0x99, 0x7F, 0xFF, 0xB4, 0x7E, 0x3E, 0xE5, 0x7F, 0xFF, 0xE5,
+    0x7E, 0x3E, 0x75, 0x7F, 0xFF, 0xF1, 0x7E, 0x52, 0xF8, 0xE1, 0x06, 0xF1, 0x73, 0x7E, 0x51, 0xCB,
     0x65, 0x65, 0x66, 0x69, 0x6F, 0x74, 0x7E, 0x4A, 0xD3, 0x7E, 0x4B, 0xBB, 0x7E, 0x3E, 0x14, 0x7F,
     0xFF, 0xF9, 0x7E, 0x2E, 0x1B, 0xE1, 0x05, 0x11, 0x61, 0x7E, 0x26, 0x29, 0x6C, 0x2E, 0x62, 0x66,
     0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x7E, 0x3F, 0x05, 0x7E, 0x26, 0x45, 0x7E,
@@ -7770,10 +7770,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x68, 0x6D, 0x7E, 0x20, 0x61, 0x7E, 0x1E, 0xD2, 0x61, 0x72, 0x7E, 0x26, 0x07, 0x21, 0xBC,
     0xFB, 0x62, 0x65, 0xC3, 0x7E, 0x52, 0xEE, 0x7F, 0xFF, 0xFD, 0xE4, 0x06, 0xC1, 0x65, 0x66, 0x74,
     0x79, 0x7F, 0xFF, 0xE6, 0x7E, 0x38, 0x23, 0x7F, 0xFF, 0xF7, 0x7E, 0x39, 0x07, 0xEE, 0x06, 0xF1,
-    0x61, 0xC3, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x7F, 0xFE,
-    0x52, 0x7F, 0xFE, 0x94, 0x7E, 0x44, 0x82, 0x7F, 0xFF, 0x15, 0x7F, 0xFF, 0x2E, 0x7E, 0x3A, 0xF0,
-    0x7F, 0xAB, 0x91, 0x7F, 0xFF, 0x53, 0x7E, 0x38, 0xF4, 0x7F, 0xFF, 0x68, 0x7F, 0xFF, 0x7B, 0x7E,
-    0x38, 0xF4, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xED, 0x61, 0x72, 0x7E, 0x2E, 0x91, 0xA1, 0x00, 0x91,
+    0x61, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0xC3, 0x7F, 0xFE,
+    0x52, 0x7E, 0x44, 0x82, 0x7F, 0xFF, 0x15, 0x7F, 0xFF, 0x2E, 0x7E, 0x3A, 0xF0, 0x7F, 0xAB, 0x91,
+    0x7F, 0xFF, 0x53, 0x7E, 0x38, 0xF4, 0x7F, 0xFF, 0x68, 0x7F, 0xFF, 0x7B, 0x7E, 0x38, 0xF4, 0x7F,
+    0xFF, 0xC8, 0x7F, 0xFF, 0xED, 0x7F, 0xFE, 0x94, 0x61, 0x72, 0x7E, 0x2E, 0x91, 0xA1, 0x00, 0x91,
     0x65, 0xFB, 0x63, 0x62, 0x6C, 0x75, 0x7F, 0xFF, 0xFB, 0x7E, 0xA0, 0xBC, 0x7E, 0x37, 0xCB, 0xE2,
     0x02, 0x61, 0x72, 0x78, 0x7E, 0x25, 0x5E, 0x7E, 0x1E, 0x1A, 0x61, 0x72, 0x7E, 0x26, 0xEA, 0xA3,
     0x0B, 0xF3, 0x61, 0x65, 0x6F, 0xE3, 0xF0, 0xFB, 0x62, 0x65, 0x69, 0x7E, 0x64, 0xB9, 0x7E, 0x60,
@@ -7804,11 +7804,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x1D, 0x37, 0x62, 0x6C, 0x6F, 0x7F, 0xFF, 0xF9, 0x7E, 0x42, 0x8D, 0x63, 0x6D, 0x70, 0x75, 0x7E,
     0x5F, 0x6E, 0x7E, 0x37, 0xB1, 0x7E, 0x36, 0xF6, 0x63, 0x63, 0x65, 0x70, 0x7E, 0x36, 0xE9, 0x7E,
     0x36, 0xE9, 0x7E, 0x36, 0xE9, 0x62, 0x2E, 0x73, 0x7E, 0x37, 0xEB, 0x7E, 0x36, 0x75, 0x61, 0x74,
-    0x7E, 0x9E, 0xCD, 0xE1, 0x07, 0xF2, 0x2E, 0x7E, 0x37, 0x5A, 0x6F, 0x61, 0xC3, 0x64, 0x66, 0x67,
-    0x68, 0x69, 0x6A, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x76, 0x7F, 0xFF, 0xDE, 0x7E, 0x41, 0x4E,
-    0x7E, 0x37, 0x82, 0x7E, 0x37, 0x82, 0x7F, 0xFF, 0xEB, 0x7E, 0x37, 0x82, 0x7F, 0xFF, 0xF4, 0x7E,
-    0x37, 0x82, 0x7E, 0xFB, 0x54, 0x7F, 0xC1, 0x72, 0x7E, 0x42, 0x15, 0x7F, 0xFF, 0xF9, 0x7E, 0x37,
-    0x82, 0x7E, 0x42, 0x55, 0x7E, 0x37, 0x82, 0x63, 0x6B, 0x72, 0x73, 0x7E, 0x42, 0x18, 0x7E, 0x5E,
+    0x7E, 0x9E, 0xCD, 0xE1, 0x07, 0xF2, 0x2E, 0x7E, 0x37, 0x5A, 0x6F, 0x61, 0x64, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x76, 0xC3, 0x7F, 0xFF, 0xDE, 0x7E, 0x37, 0x82,
+    0x7E, 0x37, 0x82, 0x7F, 0xFF, 0xEB, 0x7E, 0x37, 0x82, 0x7F, 0xFF, 0xF4, 0x7E, 0x37, 0x82, 0x7E,
+    0xFB, 0x54, 0x7F, 0xC1, 0x72, 0x7E, 0x42, 0x15, 0x7F, 0xFF, 0xF9, 0x7E, 0x37, 0x82, 0x7E, 0x42,
+    0x55, 0x7E, 0x37, 0x82, 0x7E, 0x41, 0x4E, 0x63, 0x6B, 0x72, 0x73, 0x7E, 0x42, 0x18, 0x7E, 0x5E,
     0xCD, 0x7E, 0x36, 0x8A, 0x62, 0x6F, 0x72, 0x7E, 0x42, 0x2F, 0x7E, 0x37, 0x38, 0x62, 0x61, 0x65,
     0x7E, 0x35, 0x90, 0x7E, 0x55, 0x55, 0x21, 0x68, 0xF7, 0xE3, 0x06, 0xD2, 0x2E, 0x6C, 0x75, 0x7E,
     0x36, 0x68, 0x7E, 0x1C, 0x19, 0x7E, 0x36, 0x68, 0xE3, 0x00, 0x51, 0x64, 0x6B, 0x6E, 0x7E, 0x1B,
@@ -7916,10 +7916,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x66, 0x61, 0x65, 0x6F, 0x72, 0x73, 0x75, 0x7E, 0x16, 0x81, 0x7F, 0xFF, 0xEF, 0x7E, 0x15, 0xE3,
     0x7E, 0x16, 0x81, 0x7E, 0x16, 0xCD, 0x7E, 0x15, 0xE6, 0xE1, 0x00, 0xB1, 0x73, 0x7E, 0x2F, 0xE8,
     0x61, 0x65, 0x7F, 0x05, 0x05, 0xE1, 0x2B, 0xB3, 0x6F, 0x7E, 0x16, 0x5C, 0x6F, 0x2E, 0x61, 0x62,
-    0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0xC3, 0x74, 0x75, 0x7E, 0x30, 0x61, 0x7F,
+    0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x74, 0x75, 0xC3, 0x7E, 0x30, 0x61, 0x7F,
     0xFF, 0xA3, 0x7F, 0x27, 0xCE, 0x7E, 0x2F, 0xD2, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xED, 0x7E, 0x30,
     0x90, 0x7F, 0xFF, 0xF4, 0x7E, 0x2F, 0xD2, 0x7F, 0xFF, 0xF9, 0x7E, 0x30, 0x90, 0x7E, 0x30, 0x61,
-    0x7F, 0x16, 0xF2, 0x7E, 0x30, 0x90, 0x7E, 0x2F, 0xD5, 0x61, 0x6C, 0x7E, 0x17, 0xDB, 0xE2, 0x01,
+    0x7E, 0x30, 0x90, 0x7E, 0x2F, 0xD5, 0x7F, 0x16, 0xF2, 0x61, 0x6C, 0x7E, 0x17, 0xDB, 0xE2, 0x01,
     0x61, 0x69, 0x72, 0x7E, 0x15, 0x78, 0x7E, 0x21, 0x4A, 0x64, 0x65, 0x6C, 0x72, 0x76, 0x7F, 0xFF,
     0xF5, 0x7E, 0x30, 0x9A, 0x7E, 0x1C, 0xDD, 0x7E, 0x30, 0x9A, 0xE5, 0x02, 0xF1, 0x2E, 0x65, 0x68,
     0x6B, 0x74, 0x7E, 0x30, 0x86, 0x7F, 0xFF, 0xDF, 0x7E, 0x2F, 0x77, 0x7E, 0x3B, 0x05, 0x7F, 0xFF,
@@ -7973,11 +7973,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x3F, 0x23, 0x62, 0x72, 0x73, 0x7E, 0x36, 0x6F, 0x7E, 0x11, 0xED, 0x62, 0x61, 0x6F, 0x7E, 0x36,
     0x66, 0x7E, 0x36, 0x66, 0x63, 0x69, 0x75, 0xC3, 0x7E, 0x2D, 0x06, 0x7E, 0x2D, 0x06, 0x7E, 0xD9,
     0x42, 0x62, 0x65, 0x6C, 0x7E, 0x36, 0x50, 0x7E, 0x36, 0x50, 0xE1, 0x00, 0xD1, 0x65, 0x7E, 0x36,
-    0x47, 0x70, 0x61, 0x62, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0xC3, 0x73, 0x75,
-    0x77, 0x7A, 0x7F, 0xFF, 0xD1, 0x7E, 0x75, 0x96, 0x7F, 0x30, 0x9F, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF,
+    0x47, 0x70, 0x61, 0x62, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x75, 0x77,
+    0x7A, 0xC3, 0x7F, 0xFF, 0xD1, 0x7E, 0x75, 0x96, 0x7F, 0x30, 0x9F, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF,
     0xE3, 0x7E, 0x2D, 0xB8, 0x7E, 0x2B, 0x3D, 0x7F, 0xFF, 0xF0, 0x7E, 0x40, 0x17, 0x7E, 0x40, 0x17,
-    0x7F, 0xFF, 0xF9, 0x7E, 0x40, 0xA1, 0x7E, 0x54, 0xDD, 0x7E, 0x13, 0x80, 0x7E, 0x2D, 0xB8, 0x7E,
-    0x2D, 0xB8, 0x62, 0x68, 0x79, 0x7E, 0x2D, 0x77, 0x7E, 0x2C, 0x8B, 0xE2, 0x00, 0x51, 0x69, 0x74,
+    0x7F, 0xFF, 0xF9, 0x7E, 0x54, 0xDD, 0x7E, 0x13, 0x80, 0x7E, 0x2D, 0xB8, 0x7E, 0x2D, 0xB8, 0x7E,
+    0x40, 0xA1, 0x62, 0x68, 0x79, 0x7E, 0x2D, 0x77, 0x7E, 0x2C, 0x8B, 0xE2, 0x00, 0x51, 0x69, 0x74,
     0x7E, 0x4A, 0x7D, 0x7E, 0x11, 0xA7, 0x6D, 0x62, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x70, 0x71,
     0x72, 0x74, 0x75, 0x78, 0x7E, 0x30, 0xD0, 0x7F, 0xFE, 0xF5, 0x7F, 0xFF, 0x15, 0x7F, 0xFF, 0x43,
     0x7F, 0xFF, 0x4C, 0x7F, 0xFF, 0x6B, 0x7E, 0x4D, 0x99, 0x7E, 0xC9, 0x82, 0x7E, 0x3E, 0x8E, 0x7F,
@@ -8022,10 +8022,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x79, 0x7F, 0xFF, 0x13, 0x7F, 0xFF, 0x39, 0x7F, 0xFF, 0x9B, 0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xDA,
     0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF9, 0x7E, 0x28, 0x59, 0x62, 0x6F, 0x73, 0x7E, 0x1F, 0xD7, 0x7E,
     0x51, 0xE5, 0x63, 0x6D, 0x72, 0x74, 0x7F, 0xFF, 0xF7, 0x7E, 0xDA, 0xD4, 0x7E, 0x33, 0x21, 0xEF,
-    0x06, 0xF2, 0x61, 0xC3, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0x7F, 0xFB, 0xAB, 0x7F, 0xFB, 0xEC, 0x7F, 0xFC, 0x2F, 0x7F, 0xFD, 0x47, 0x7F, 0xFD, 0x85,
-    0x7F, 0xFD, 0xAF, 0x7F, 0xFD, 0xE0, 0x7F, 0xFD, 0xF3, 0x7F, 0xFE, 0x0B, 0x7F, 0xFE, 0x17, 0x7F,
-    0xFE, 0x7A, 0x7F, 0xFE, 0xA0, 0x7E, 0x34, 0xC0, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xF3, 0x61, 0x6E,
+    0x06, 0xF2, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75,
+    0xC3, 0x7F, 0xFB, 0xAB, 0x7F, 0xFC, 0x2F, 0x7F, 0xFD, 0x47, 0x7F, 0xFD, 0x85, 0x7F, 0xFD, 0xAF,
+    0x7F, 0xFD, 0xE0, 0x7F, 0xFD, 0xF3, 0x7F, 0xFE, 0x0B, 0x7F, 0xFE, 0x17, 0x7F, 0xFE, 0x7A, 0x7F,
+    0xFE, 0xA0, 0x7E, 0x34, 0xC0, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xF3, 0x7F, 0xFB, 0xEC, 0x61, 0x6E,
     0x7E, 0xA5, 0x78, 0x21, 0x65, 0xFB, 0x62, 0x68, 0x6B, 0x7E, 0x2B, 0x50, 0x7E, 0x28, 0x07, 0x63,
     0x6D, 0x6E, 0x72, 0x7E, 0x28, 0xE2, 0x7E, 0x54, 0x17, 0x7E, 0xDF, 0x15, 0x61, 0x74, 0x7E, 0x1D,
     0x00, 0x66, 0x61, 0x65, 0x69, 0x6B, 0x6C, 0x74, 0x7E, 0x0E, 0xB2, 0x7E, 0x64, 0x27, 0x7E, 0x5D,
@@ -8083,10 +8083,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x24, 0x8A, 0x7F, 0xFF, 0xFB, 0xE1, 0x09, 0x42, 0x6E, 0x7E, 0x0B, 0x04, 0x61, 0x73, 0x7E, 0xB0,
     0xD8, 0x63, 0x2E, 0x69, 0x72, 0x7E, 0x0B, 0x65, 0x7E, 0x0B, 0x65, 0x7E, 0x0B, 0x65, 0x62, 0x61,
     0x65, 0x7E, 0x0B, 0xF3, 0x7F, 0xFF, 0xF3, 0x23, 0x65, 0x6D, 0x72, 0xDE, 0xE5, 0xF7, 0xEE, 0x06,
-    0xF1, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0x7F,
-    0xFD, 0x08, 0x7F, 0xFD, 0x42, 0x7F, 0xFE, 0x2D, 0x7F, 0xFE, 0x93, 0x7F, 0xFE, 0xF1, 0x7F, 0xFF,
-    0x14, 0x7F, 0xD4, 0x8E, 0x7F, 0xFF, 0x1D, 0x7F, 0xFF, 0x39, 0x7F, 0xFF, 0xA6, 0x7F, 0xFF, 0xCC,
-    0x7E, 0x0C, 0xA9, 0x7F, 0xFF, 0xF9, 0x7E, 0x0B, 0x4B, 0xE1, 0x08, 0xA2, 0x72, 0x7E, 0x98, 0x3C,
+    0xF1, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7F,
+    0xFD, 0x08, 0x7F, 0xFE, 0x2D, 0x7F, 0xFE, 0x93, 0x7F, 0xFE, 0xF1, 0x7F, 0xFF, 0x14, 0x7F, 0xD4,
+    0x8E, 0x7F, 0xFF, 0x1D, 0x7F, 0xFF, 0x39, 0x7F, 0xFF, 0xA6, 0x7F, 0xFF, 0xCC, 0x7E, 0x0C, 0xA9,
+    0x7F, 0xFF, 0xF9, 0x7E, 0x0B, 0x4B, 0x7F, 0xFD, 0x42, 0xE1, 0x08, 0xA2, 0x72, 0x7E, 0x98, 0x3C,
     0x61, 0x6C, 0x7E, 0x11, 0x76, 0xA1, 0x07, 0xB1, 0x65, 0xFB, 0xE3, 0x07, 0x71, 0x2E, 0x61, 0x64,
     0x7E, 0x25, 0x17, 0x7E, 0x0A, 0x8F, 0x7E, 0x25, 0x17, 0x6F, 0x2E, 0x61, 0x62, 0x63, 0x65, 0x6B,
     0x6C, 0x6D, 0x6E, 0x6F, 0x73, 0x74, 0x76, 0x77, 0x7A, 0x7E, 0x24, 0xA1, 0x7E, 0x24, 0xA1, 0x7E,
@@ -8144,14 +8144,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xAF, 0x21, 0x65, 0xF7, 0x61, 0x6C, 0x7E, 0x8A, 0xE2, 0x21, 0x6C, 0xFB, 0x65, 0x65, 0x69, 0x6F,
     0xC3, 0x75, 0x7E, 0x23, 0xAD, 0x7F, 0xFF, 0xFD, 0x7E, 0x20, 0xA5, 0x7E, 0x2E, 0x78, 0x7E, 0x20,
     0xA5, 0xC8, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6F, 0x75, 0x77, 0xFE, 0xCE, 0xFF, 0x00,
-    0xFF, 0x86, 0xFF, 0xB8, 0xFF, 0xBB, 0xFF, 0xC2, 0xFF, 0xE0, 0xFF, 0xEB, 0x7B, 0x61, 0xC3, 0x62,
-    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7F, 0xDA, 0x14, 0x7F, 0xDB, 0x79, 0x7F, 0xDB,
-    0xF1, 0x7F, 0xDC, 0x55, 0x7F, 0xDE, 0xD2, 0x7F, 0xE5, 0x92, 0x7F, 0xE6, 0x82, 0x7F, 0xE8, 0x91,
-    0x7F, 0xE8, 0xF3, 0x7F, 0xEB, 0xD5, 0x7F, 0x7B, 0x3A, 0x7F, 0xEE, 0x42, 0x7F, 0xEE, 0xAD, 0x7F,
-    0xEE, 0xE4, 0x7F, 0xF0, 0x3C, 0x7F, 0xF2, 0x9B, 0x7F, 0xF3, 0x0A, 0x7E, 0x21, 0x82, 0x7F, 0xF3,
-    0x5F, 0x7F, 0xF8, 0x53, 0x7F, 0xFC, 0x22, 0x7F, 0xFD, 0xDF, 0x7F, 0xFE, 0x3B, 0x7F, 0xFE, 0x5D,
-    0x7E, 0x20, 0xD0, 0x7F, 0xFE, 0x76, 0x7F, 0xFF, 0xE5, 0x63, 0x65, 0x69, 0x72, 0x7E, 0x20, 0x0B,
+    0xFF, 0x86, 0xFF, 0xB8, 0xFF, 0xBB, 0xFF, 0xC2, 0xFF, 0xE0, 0xFF, 0xEB, 0x7B, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x7F, 0xDA, 0x14, 0x7F, 0xDB, 0xF1, 0x7F, 0xDC,
+    0x55, 0x7F, 0xDE, 0xD2, 0x7F, 0xE5, 0x92, 0x7F, 0xE6, 0x82, 0x7F, 0xE8, 0x91, 0x7F, 0xE8, 0xF3,
+    0x7F, 0xEB, 0xD5, 0x7F, 0x7B, 0x3A, 0x7F, 0xEE, 0x42, 0x7F, 0xEE, 0xAD, 0x7F, 0xEE, 0xE4, 0x7F,
+    0xF0, 0x3C, 0x7F, 0xF2, 0x9B, 0x7F, 0xF3, 0x0A, 0x7E, 0x21, 0x82, 0x7F, 0xF3, 0x5F, 0x7F, 0xF8,
+    0x53, 0x7F, 0xFC, 0x22, 0x7F, 0xFD, 0xDF, 0x7F, 0xFE, 0x3B, 0x7F, 0xFE, 0x5D, 0x7E, 0x20, 0xD0,
+    0x7F, 0xFE, 0x76, 0x7F, 0xFF, 0xE5, 0x7F, 0xDB, 0x79, 0x63, 0x65, 0x69, 0x72, 0x7E, 0x20, 0x0B,
     0x7E, 0x20, 0x08, 0x7E, 0x20, 0x0B, 0xE1, 0x02, 0xF1, 0x68, 0x7E, 0x4A, 0x47, 0xE1, 0x06, 0xC1,
     0x61, 0x7E, 0x06, 0x7C, 0xE2, 0x02, 0xF1, 0x72, 0x74, 0x7F, 0xFF, 0xF9, 0x7E, 0x06, 0x75, 0x62,
     0x6C, 0x75, 0x7E, 0x06, 0x6A, 0x7E, 0x1F, 0xE5, 0xE2, 0x02, 0xF1, 0x62, 0x73, 0x7E, 0x20, 0xE9,
@@ -8189,10 +8189,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0x1D, 0xE8, 0x7E, 0x1E, 0xF2, 0x7E, 0x39, 0xFB, 0x62, 0x65, 0x73, 0x7E, 0x2A, 0x36, 0x7E,
     0x1E, 0x81, 0x65, 0x61, 0x63, 0x68, 0x6B, 0x74, 0x7F, 0x66, 0x44, 0x7E, 0x1E, 0xDF, 0x7E, 0x2A,
     0x6D, 0x7E, 0x20, 0xDB, 0x7F, 0xFF, 0xF7, 0xE3, 0x06, 0xF1, 0x65, 0x6E, 0x73, 0x7E, 0x20, 0xBE,
-    0x7E, 0x20, 0xC2, 0x7E, 0x04, 0xB2, 0xE1, 0x06, 0xF1, 0x74, 0x7E, 0x04, 0xA3, 0x6C, 0x61, 0xC3,
-    0x62, 0x65, 0x69, 0x6A, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0x7F, 0xFE, 0xBE, 0x7F, 0xFE, 0xDE,
-    0x7E, 0x1C, 0x97, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF, 0x84, 0x7E, 0x1F, 0x8B, 0x7F, 0xFF, 0x9F, 0x7F,
-    0xFF, 0xAE, 0x7F, 0xFF, 0xBF, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF9, 0x62, 0x73,
+    0x7E, 0x20, 0xC2, 0x7E, 0x04, 0xB2, 0xE1, 0x06, 0xF1, 0x74, 0x7E, 0x04, 0xA3, 0x6C, 0x61, 0x62,
+    0x65, 0x69, 0x6A, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xC3, 0x7F, 0xFE, 0xBE, 0x7E, 0x1C, 0x97,
+    0x7F, 0xFF, 0x4F, 0x7F, 0xFF, 0x84, 0x7E, 0x1F, 0x8B, 0x7F, 0xFF, 0x9F, 0x7F, 0xFF, 0xAE, 0x7F,
+    0xFF, 0xBF, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF9, 0x7F, 0xFE, 0xDE, 0x62, 0x73,
     0x75, 0x7E, 0x03, 0xFE, 0x7E, 0x03, 0xFE, 0xE1, 0x07, 0xA1, 0x6C, 0x7E, 0x1E, 0x13, 0x64, 0x62,
     0x6E, 0x72, 0x75, 0x7E, 0x05, 0xB3, 0x7E, 0xC5, 0x3F, 0x7E, 0x04, 0x24, 0x7E, 0x03, 0xEB, 0x61,
     0x72, 0x7E, 0x5B, 0x5F, 0xA0, 0x2C, 0x83, 0x63, 0x67, 0x6B, 0x6C, 0x7F, 0xFF, 0xFD, 0x7E, 0x2B,
@@ -8203,9 +8203,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x9B, 0x64, 0x65, 0x68, 0x70, 0x74, 0x7E, 0x1D, 0xA9, 0x7E, 0x03, 0x88, 0x7E, 0x03, 0xC1, 0x7F,
     0xFF, 0xF3, 0x61, 0x72, 0x7E, 0x60, 0x29, 0x21, 0x65, 0xFB, 0x63, 0x66, 0x6E, 0x74, 0x7E, 0x03,
     0xA8, 0x7E, 0x1C, 0xF4, 0x7E, 0x05, 0x37, 0x6E, 0x61, 0x64, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F,
-    0xC3, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7F, 0xFF, 0x77, 0x7F, 0xFF, 0x88, 0x7F, 0xFF, 0x9D, 0x7F,
-    0xFF, 0xB6, 0x7E, 0x03, 0x62, 0x7E, 0x03, 0x62, 0x7E, 0x03, 0x62, 0x7F, 0xFF, 0xBF, 0x7F, 0xFF,
-    0xC8, 0x7E, 0x23, 0xBE, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF3, 0x7E, 0x03, 0x62,
+    0x72, 0x73, 0x74, 0x75, 0x77, 0xC3, 0x7F, 0xFF, 0x77, 0x7F, 0xFF, 0x88, 0x7F, 0xFF, 0x9D, 0x7F,
+    0xFF, 0xB6, 0x7E, 0x03, 0x62, 0x7E, 0x03, 0x62, 0x7E, 0x03, 0x62, 0x7F, 0xFF, 0xBF, 0x7E, 0x23,
+    0xBE, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF3, 0x7E, 0x03, 0x62, 0x7F, 0xFF, 0xC8,
     0x61, 0x64, 0x7E, 0x1C, 0xAE, 0xA0, 0x2C, 0xB3, 0x62, 0x61, 0x63, 0x7E, 0x03, 0x27, 0x7F, 0xFF,
     0xFD, 0x42, 0x73, 0x77, 0xFF, 0xF7, 0xFF, 0x43, 0x62, 0x6C, 0x72, 0x7E, 0x03, 0x4A, 0x7F, 0xFF,
     0xF9, 0x63, 0x70, 0x74, 0x7A, 0x7E, 0x04, 0xD0, 0x7E, 0x04, 0x62, 0x7E, 0x03, 0x08, 0x66, 0x61,
@@ -8263,11 +8263,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0x01, 0x30, 0xE3, 0x00, 0xB1, 0x65, 0x6F, 0x79, 0x7E, 0x22, 0x1C, 0x7E, 0x19, 0x6A, 0x7E,
     0x19, 0x6A, 0x65, 0x2E, 0x61, 0x65, 0x68, 0x72, 0x7E, 0x19, 0x3C, 0x7E, 0x40, 0xB7, 0x7F, 0xFF,
     0xE8, 0x7F, 0xFF, 0xF1, 0x7E, 0x19, 0x68, 0x75, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0xC3, 0x74, 0x75, 0x76, 0x78, 0x7F, 0xFD, 0xDB,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0xC3, 0x7F, 0xFD, 0xDB,
     0x7F, 0xFD, 0xF8, 0x7E, 0x96, 0x6E, 0x7E, 0x1F, 0x0C, 0x7F, 0xFD, 0xFD, 0x7F, 0xFE, 0x06, 0x7F,
     0xFE, 0x13, 0x7F, 0xFE, 0x24, 0x7F, 0xFE, 0x2C, 0x7F, 0xFE, 0x70, 0x7F, 0xFE, 0xAF, 0x7F, 0xFE,
-    0xD0, 0x7E, 0xEB, 0x94, 0x7F, 0xFE, 0xDF, 0x7F, 0xFF, 0x33, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xD0,
-    0x7F, 0xFF, 0xEB, 0x7E, 0x19, 0x75, 0x7E, 0xFE, 0x64, 0x7E, 0x19, 0x87, 0xE3, 0x08, 0x62, 0x63,
+    0xD0, 0x7E, 0xEB, 0x94, 0x7F, 0xFE, 0xDF, 0x7F, 0xFF, 0x33, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xEB,
+    0x7E, 0x19, 0x75, 0x7E, 0xFE, 0x64, 0x7E, 0x19, 0x87, 0x7F, 0xFF, 0xD0, 0xE3, 0x08, 0x62, 0x63,
     0x64, 0x67, 0x7D, 0xFF, 0xBD, 0x7E, 0x25, 0x63, 0x7E, 0x25, 0x63, 0x66, 0x61, 0x67, 0x6B, 0x74,
     0x77, 0x7A, 0x7E, 0x1A, 0x52, 0x7E, 0x1A, 0x52, 0x7E, 0x1A, 0x52, 0x7E, 0x1A, 0x52, 0x7E, 0x1A,
     0x52, 0x7E, 0x1A, 0x52, 0x63, 0x62, 0x72, 0x73, 0x7E, 0x1B, 0x25, 0x7E, 0x1B, 0x25, 0x7F, 0x63,
@@ -8287,10 +8287,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x70, 0x74, 0x75, 0x7E, 0x28, 0x09, 0x7F, 0xFF, 0xE5, 0x7E, 0x24, 0x88, 0x7E, 0x2C, 0x85, 0x7F,
     0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7E, 0x17, 0xFF, 0x63, 0x68, 0x72, 0x73, 0x7E, 0x18, 0xB9, 0x7E,
     0x68, 0xF7, 0x7D, 0xFE, 0x31, 0xE3, 0x06, 0xF1, 0x68, 0x6D, 0x72, 0x7E, 0x22, 0x8E, 0x7E, 0x17,
-    0x9C, 0x7E, 0x22, 0x8E, 0x6C, 0x61, 0xC3, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x74,
-    0x75, 0x7F, 0xFE, 0xC8, 0x7F, 0xB8, 0xB8, 0x7F, 0xFE, 0xFD, 0x7F, 0xFF, 0x58, 0x7E, 0x1D, 0xFD,
-    0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x8B, 0x7F, 0xFF, 0x9A, 0x7F, 0xFF, 0xA5, 0x7F, 0xFF, 0xC7, 0x7F,
-    0xFF, 0xE4, 0x7F, 0xFF, 0xF1, 0x65, 0x62, 0x63, 0x6E, 0x72, 0x75, 0x7E, 0x17, 0x5C, 0x7E, 0x22,
+    0x9C, 0x7E, 0x22, 0x8E, 0x6C, 0x61, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x74, 0x75,
+    0xC3, 0x7F, 0xFE, 0xC8, 0x7F, 0xFE, 0xFD, 0x7F, 0xFF, 0x58, 0x7E, 0x1D, 0xFD, 0x7F, 0xFF, 0x80,
+    0x7F, 0xFF, 0x8B, 0x7F, 0xFF, 0x9A, 0x7F, 0xFF, 0xA5, 0x7F, 0xFF, 0xC7, 0x7F, 0xFF, 0xE4, 0x7F,
+    0xFF, 0xF1, 0x7F, 0xB8, 0xB8, 0x65, 0x62, 0x63, 0x6E, 0x72, 0x75, 0x7E, 0x17, 0x5C, 0x7E, 0x22,
     0x4E, 0x7E, 0x1D, 0x0B, 0x7F, 0xF9, 0x47, 0x7E, 0x29, 0x50, 0x61, 0x69, 0x7D, 0xFE, 0x74, 0x62,
     0x63, 0x72, 0x7E, 0x01, 0x41, 0x7E, 0x1D, 0x3B, 0x63, 0x65, 0x69, 0x73, 0x7F, 0xFF, 0xF7, 0x7E,
     0x36, 0xB8, 0x7E, 0x24, 0x47, 0x62, 0x66, 0x69, 0x7E, 0x19, 0xB4, 0x7D, 0xFF, 0x08, 0x65, 0x69,
@@ -8326,10 +8326,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0xEB, 0x63, 0x65, 0x6D, 0x6E, 0x7E, 0x16, 0x5E, 0x7D, 0xFB, 0xD6, 0x7E, 0x15, 0xBE,
     0x64, 0x61, 0x65, 0x69, 0x73, 0x7D, 0xFB, 0xC9, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF, 0xF3, 0x7E, 0x47,
     0xA2, 0xE1, 0x07, 0xA1, 0x70, 0x7D, 0xFC, 0x28, 0xE1, 0x06, 0xB1, 0x6D, 0x7E, 0x20, 0x1B, 0x6F,
-    0x61, 0xC3, 0x65, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7F,
-    0xFE, 0xAE, 0x7F, 0xFE, 0xB9, 0x7F, 0xFE, 0xCB, 0x7E, 0x15, 0x7D, 0x7F, 0xFE, 0xE7, 0x7F, 0xFF,
-    0x27, 0x7F, 0xFF, 0x3C, 0x7F, 0xFF, 0x71, 0x7F, 0xFF, 0x93, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xF2,
-    0x7D, 0xFC, 0x1A, 0x7F, 0xFF, 0xF9, 0x7E, 0x16, 0x32, 0x7E, 0x15, 0x7D, 0xE1, 0x07, 0x12, 0x61,
+    0x61, 0x65, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0xC3, 0x7F,
+    0xFE, 0xAE, 0x7F, 0xFE, 0xCB, 0x7E, 0x15, 0x7D, 0x7F, 0xFE, 0xE7, 0x7F, 0xFF, 0x27, 0x7F, 0xFF,
+    0x3C, 0x7F, 0xFF, 0x71, 0x7F, 0xFF, 0x93, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xF2, 0x7D, 0xFC, 0x1A,
+    0x7F, 0xFF, 0xF9, 0x7E, 0x16, 0x32, 0x7E, 0x15, 0x7D, 0x7F, 0xFE, 0xB9, 0xE1, 0x07, 0x12, 0x61,
     0x7F, 0x42, 0xC6, 0xE1, 0x07, 0x12, 0x6D, 0x7D, 0xFB, 0x69, 0xE2, 0x1E, 0xB2, 0x65, 0x69, 0x7E,
     0x21, 0x99, 0x7E, 0x15, 0x10, 0x62, 0x2E, 0x65, 0x7E, 0x18, 0x45, 0x7E, 0x16, 0x68, 0x21, 0x68,
     0xF7, 0x64, 0x63, 0x6D, 0x72, 0x73, 0x7F, 0xFF, 0xFD, 0x7E, 0x14, 0xCD, 0x7E, 0x14, 0xCD, 0x7E,
@@ -8391,11 +8391,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7A, 0x7F, 0xFF, 0xF1, 0x63, 0x6B, 0x6D, 0x6E, 0x7E, 0x11, 0x69, 0x7E, 0x11, 0x69, 0x7E, 0x11,
     0xAD, 0x67, 0x61, 0x65, 0x69, 0x6F, 0xC3, 0x77, 0x79, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xE2, 0x7F,
     0xFF, 0xF3, 0x7E, 0x11, 0x69, 0x7E, 0x1D, 0x64, 0x7E, 0x11, 0x33, 0x7E, 0x11, 0x33, 0x72, 0x61,
-    0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x76, 0x79,
-    0x7A, 0x7F, 0xFD, 0x61, 0x7F, 0xFD, 0x93, 0x7F, 0xFD, 0xA0, 0x7F, 0xFD, 0xB0, 0x7F, 0xFE, 0x0B,
-    0x7F, 0xFE, 0x48, 0x7F, 0xFE, 0x7B, 0x7F, 0xFE, 0x8C, 0x7F, 0xFE, 0xA3, 0x7F, 0xFE, 0xCF, 0x7F,
-    0xFF, 0x4C, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x85, 0x7F, 0xFF, 0x9A, 0x7F, 0xFF, 0x9D, 0x7D, 0xF7,
-    0xE9, 0x7F, 0xFF, 0xA4, 0x7F, 0xFF, 0xE3, 0x62, 0x6C, 0x72, 0x7E, 0x26, 0x81, 0x7E, 0x26, 0x81,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6F, 0x73, 0x74, 0x75, 0x76, 0x79, 0x7A,
+    0xC3, 0x7F, 0xFD, 0x61, 0x7F, 0xFD, 0xA0, 0x7F, 0xFD, 0xB0, 0x7F, 0xFE, 0x0B, 0x7F, 0xFE, 0x48,
+    0x7F, 0xFE, 0x7B, 0x7F, 0xFE, 0x8C, 0x7F, 0xFE, 0xA3, 0x7F, 0xFE, 0xCF, 0x7F, 0xFF, 0x4C, 0x7F,
+    0xFF, 0x72, 0x7F, 0xFF, 0x85, 0x7F, 0xFF, 0x9A, 0x7F, 0xFF, 0x9D, 0x7D, 0xF7, 0xE9, 0x7F, 0xFF,
+    0xA4, 0x7F, 0xFF, 0xE3, 0x7F, 0xFD, 0x93, 0x62, 0x6C, 0x72, 0x7E, 0x26, 0x81, 0x7E, 0x26, 0x81,
     0x64, 0x61, 0x67, 0x69, 0x6C, 0x7D, 0xF7, 0x49, 0x7E, 0x13, 0x49, 0x7D, 0xF8, 0xA0, 0x7E, 0x11,
     0xD1, 0xE6, 0x07, 0x91, 0x65, 0x68, 0x69, 0x6B, 0x72, 0x74, 0x7E, 0x22, 0x70, 0x7E, 0x10, 0xDC,
     0x7D, 0xF8, 0x8F, 0x7E, 0x12, 0x6C, 0x7E, 0x10, 0xDC, 0x7E, 0xBE, 0xA1, 0xE1, 0x08, 0x82, 0x65,
@@ -8476,11 +8476,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x65, 0x6B, 0x6D, 0x72, 0x74, 0x7E, 0x0B, 0xF4, 0x7E, 0x0D, 0x01, 0x7E, 0x1D, 0xE8, 0x7E, 0x19,
     0x9E, 0x7E, 0x0D, 0x01, 0x61, 0x6B, 0x7D, 0xF6, 0xCF, 0x21, 0x61, 0xFB, 0x62, 0x61, 0x74, 0x7D,
     0xF5, 0x28, 0x7F, 0xFF, 0xFD, 0xE3, 0x00, 0xE1, 0x69, 0x6C, 0x72, 0x7E, 0x95, 0x85, 0x7D, 0xFA,
-    0x31, 0x7F, 0xFF, 0xF7, 0xA1, 0x05, 0x11, 0x65, 0xF1, 0x71, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67,
-    0x69, 0x6A, 0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x7F, 0xFC, 0xF3, 0x7F, 0xFD,
-    0x2D, 0x7F, 0xFD, 0x8A, 0x7F, 0xFD, 0xFC, 0x7F, 0xFE, 0x2B, 0x7F, 0xFE, 0x37, 0x7F, 0xFE, 0xCA,
-    0x7E, 0x0C, 0xC5, 0x7F, 0xFE, 0xE5, 0x7F, 0xFE, 0xF6, 0x7F, 0xFF, 0x11, 0x7F, 0xFF, 0x16, 0x7F,
-    0xFF, 0x6A, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xC4, 0x7E, 0x0D, 0x9F, 0x7F, 0xFF, 0xFB, 0xE1, 0x06,
+    0x31, 0x7F, 0xFF, 0xF7, 0xA1, 0x05, 0x11, 0x65, 0xF1, 0x71, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F, 0xFC, 0xF3, 0x7F, 0xFD,
+    0x8A, 0x7F, 0xFD, 0xFC, 0x7F, 0xFE, 0x2B, 0x7F, 0xFE, 0x37, 0x7F, 0xFE, 0xCA, 0x7E, 0x0C, 0xC5,
+    0x7F, 0xFE, 0xE5, 0x7F, 0xFE, 0xF6, 0x7F, 0xFF, 0x11, 0x7F, 0xFF, 0x16, 0x7F, 0xFF, 0x6A, 0x7F,
+    0xFF, 0xAB, 0x7F, 0xFF, 0xC4, 0x7E, 0x0D, 0x9F, 0x7F, 0xFF, 0xFB, 0x7F, 0xFD, 0x2D, 0xE1, 0x06,
     0xB2, 0x6E, 0x7E, 0x0C, 0x83, 0x62, 0x65, 0x6C, 0x7E, 0x0C, 0x7C, 0x7E, 0x0B, 0x6F, 0x63, 0x69,
     0x6C, 0x6E, 0x7D, 0xF1, 0xEE, 0x7E, 0x0B, 0x9C, 0x7E, 0x0B, 0x66, 0x62, 0x67, 0x6F, 0x7E, 0x3B,
     0xCB, 0x7F, 0x1A, 0xEB, 0xE1, 0x01, 0x61, 0x74, 0x7E, 0x0B, 0xC0, 0x63, 0x69, 0x6E, 0x72, 0x7E,
@@ -8516,11 +8516,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x65, 0x6F, 0xC3, 0x7E, 0xB6, 0xE7, 0x7E, 0x0C, 0x02, 0x7E, 0xC1, 0x75, 0x63, 0x61, 0x6F, 0x75,
     0x7E, 0x0A, 0x75, 0x7E, 0x0A, 0x75, 0x7E, 0x0A, 0x75, 0x63, 0x69, 0x74, 0x7A, 0x7E, 0x0A, 0x01,
     0x7F, 0xFF, 0xF3, 0x7E, 0x0A, 0x68, 0xA0, 0x0A, 0xF2, 0xE2, 0x18, 0x82, 0x65, 0x68, 0x7F, 0xFF,
-    0xFD, 0x7E, 0x0A, 0x58, 0x70, 0x2E, 0x61, 0xC3, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x79, 0x7E, 0x0A, 0x4A, 0x7F, 0xFE, 0x91, 0x7E, 0xC5, 0xCA, 0x7F, 0xFE,
-    0xCF, 0x7F, 0xFF, 0x30, 0x7F, 0xFF, 0x51, 0x7F, 0xFF, 0x7E, 0x7F, 0xFF, 0x9E, 0x7E, 0x45, 0x39,
-    0x7F, 0xFF, 0xA7, 0x7F, 0xFF, 0xB4, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xF5, 0x7E,
-    0x0A, 0x4A, 0x7E, 0x0A, 0x4A, 0xE3, 0x00, 0xB1, 0x62, 0x72, 0x74, 0x7E, 0x0A, 0x0C, 0x7E, 0x0A,
+    0xFD, 0x7E, 0x0A, 0x58, 0x70, 0x2E, 0x61, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x79, 0xC3, 0x7E, 0x0A, 0x4A, 0x7F, 0xFE, 0x91, 0x7F, 0xFE, 0xCF, 0x7F, 0xFF,
+    0x30, 0x7F, 0xFF, 0x51, 0x7F, 0xFF, 0x7E, 0x7F, 0xFF, 0x9E, 0x7E, 0x45, 0x39, 0x7F, 0xFF, 0xA7,
+    0x7F, 0xFF, 0xB4, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xF5, 0x7E, 0x0A, 0x4A, 0x7E,
+    0x0A, 0x4A, 0x7E, 0xC5, 0xCA, 0xE3, 0x00, 0xB1, 0x62, 0x72, 0x74, 0x7E, 0x0A, 0x0C, 0x7E, 0x0A,
     0x0C, 0x7E, 0x0A, 0x0C, 0x62, 0x65, 0x68, 0x7E, 0x09, 0xFD, 0x7E, 0x09, 0xFD, 0xE2, 0x02, 0x61,
     0x64, 0x72, 0x7E, 0x0B, 0x6C, 0x7E, 0x09, 0xF4, 0xE3, 0x07, 0x91, 0x68, 0x74, 0x75, 0x7E, 0x09,
     0xE9, 0x7E, 0x09, 0xE9, 0x7E, 0x08, 0xE6, 0xE1, 0x02, 0x61, 0x65, 0x7D, 0xF1, 0x2D, 0x67, 0x2E,
@@ -8613,12 +8613,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF7, 0x7E, 0x13, 0xBD, 0x66, 0x68, 0x6D, 0x6E,
     0x72, 0x73, 0x74, 0x7E, 0x14, 0x8E, 0x7D, 0xF2, 0xB8, 0x7E, 0x04, 0x65, 0x7D, 0xEA, 0x4D, 0x7E,
     0x03, 0x62, 0x7E, 0x0F, 0xF3, 0xE1, 0x04, 0x51, 0x61, 0x7E, 0x03, 0x3C, 0x61, 0x65, 0x7E, 0x2A,
-    0x50, 0x75, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0x6E, 0x6F,
-    0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x7F, 0xFB, 0x55, 0x7F, 0xFB, 0xC4, 0x7F, 0xFB, 0xEA,
-    0x7F, 0xFB, 0xF1, 0x7F, 0xFC, 0x3B, 0x7F, 0xFC, 0xE3, 0x7F, 0xFD, 0x23, 0x7F, 0xFD, 0x4B, 0x7E,
-    0x3D, 0xA5, 0x7F, 0xFD, 0xAE, 0x7F, 0xFD, 0xCA, 0x7F, 0xFE, 0x44, 0x7F, 0xFE, 0x68, 0x7F, 0xFE,
-    0x75, 0x7E, 0x7B, 0x24, 0x7F, 0xFE, 0x9F, 0x7F, 0xFE, 0xCB, 0x7F, 0xFF, 0xB6, 0x7F, 0xFF, 0xDB,
-    0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFB, 0xA0, 0x2D, 0x84, 0xE7, 0x06, 0xC1, 0x61, 0x62, 0x65, 0x69,
+    0x50, 0x75, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F, 0xFB, 0x55, 0x7F, 0xFB, 0xEA, 0x7F, 0xFB, 0xF1,
+    0x7F, 0xFC, 0x3B, 0x7F, 0xFC, 0xE3, 0x7F, 0xFD, 0x23, 0x7F, 0xFD, 0x4B, 0x7E, 0x3D, 0xA5, 0x7F,
+    0xFD, 0xAE, 0x7F, 0xFD, 0xCA, 0x7F, 0xFE, 0x44, 0x7F, 0xFE, 0x68, 0x7F, 0xFE, 0x75, 0x7E, 0x7B,
+    0x24, 0x7F, 0xFE, 0x9F, 0x7F, 0xFE, 0xCB, 0x7F, 0xFF, 0xB6, 0x7F, 0xFF, 0xDB, 0x7F, 0xFF, 0xF4,
+    0x7F, 0xFF, 0xFB, 0x7F, 0xFB, 0xC4, 0xA0, 0x2D, 0x84, 0xE7, 0x06, 0xC1, 0x61, 0x62, 0x65, 0x69,
     0x6D, 0x72, 0x73, 0x7D, 0xFC, 0xAF, 0x7E, 0x02, 0xE5, 0x7D, 0xFC, 0xAF, 0x7D, 0xE9, 0x60, 0x7E,
     0x8F, 0x80, 0x7E, 0x12, 0x9B, 0x7F, 0xFF, 0xFD, 0x62, 0x72, 0x75, 0x7D, 0xEC, 0xB8, 0x7E, 0x05,
     0x18, 0x61, 0x65, 0x7D, 0xEC, 0xB2, 0xE3, 0x06, 0xF1, 0x61, 0x65, 0x6C, 0x7F, 0xFF, 0xF2, 0x7E,
@@ -8700,9 +8700,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7E, 0x40, 0x42, 0x7D, 0xEC, 0x73, 0x62, 0x6E, 0x72, 0x7F, 0xE1, 0x4A, 0x7E, 0x0B, 0x95, 0x62,
     0x6B, 0x72, 0x7E, 0x0C, 0xD1, 0x7E, 0x0C, 0xD1, 0x62, 0x64, 0x72, 0x7D, 0xE4, 0x9A, 0x7F, 0xFF,
     0xF7, 0x63, 0x61, 0xC3, 0x65, 0x7E, 0x06, 0xE9, 0x7E, 0x12, 0x53, 0x7F, 0xFF, 0xF7, 0x4C, 0x61,
-    0xC3, 0x65, 0x66, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xFD, 0xDD, 0xFE, 0x1B, 0xFE,
-    0xBC, 0xFE, 0xDE, 0xFF, 0x02, 0xFF, 0x10, 0xFF, 0x1E, 0xFF, 0x54, 0xFF, 0x86, 0xFF, 0xC3, 0xFF,
-    0xD8, 0xFF, 0xF3, 0x62, 0x65, 0x69, 0x7D, 0xE4, 0xCB, 0x7D, 0xFE, 0xAE, 0x21, 0x68, 0xF7, 0x62,
+    0x65, 0x66, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0xFD, 0xDD, 0xFE, 0xBC, 0xFE,
+    0xDE, 0xFF, 0x02, 0xFF, 0x10, 0xFF, 0x1E, 0xFF, 0x54, 0xFF, 0x86, 0xFF, 0xC3, 0xFF, 0xD8, 0xFF,
+    0xF3, 0xFE, 0x1B, 0x62, 0x65, 0x69, 0x7D, 0xE4, 0xCB, 0x7D, 0xFE, 0xAE, 0x21, 0x68, 0xF7, 0x62,
     0x66, 0x6C, 0x7D, 0xE5, 0xE2, 0x7E, 0x0A, 0x30, 0xE2, 0x00, 0xB1, 0x61, 0x65, 0x7E, 0x06, 0x67,
     0x7D, 0xFD, 0x8C, 0x61, 0x73, 0x7E, 0x23, 0xEC, 0x63, 0x2E, 0x6C, 0x73, 0x7D, 0xFD, 0xA5, 0x7D,
     0xFD, 0xA5, 0x7D, 0xFD, 0xA5, 0x63, 0x65, 0x69, 0x73, 0x7F, 0xFF, 0xF3, 0x7D, 0xFD, 0x6F, 0x7D,
@@ -8728,11 +8728,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xF7, 0x63, 0x61, 0x6E, 0x73, 0x7E, 0x0B, 0xF0, 0x7F, 0xFF, 0xED, 0x7F, 0xFF, 0xFD, 0x61, 0x6C,
     0x7D, 0xE6, 0x18, 0xA1, 0x02, 0x61, 0x61, 0xFB, 0x61, 0x6E, 0x7E, 0x34, 0x22, 0x64, 0x61, 0x65,
     0x69, 0x6F, 0x7E, 0x04, 0xE7, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF, 0xF6, 0x7F, 0xFF, 0xFB, 0x5A, 0x61,
-    0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xDC, 0x76, 0xDC, 0xFA, 0xDE, 0x5F, 0xDF,
-    0xB0, 0xE0, 0x9A, 0xE2, 0xE9, 0xE4, 0x76, 0xE5, 0x58, 0xE6, 0xE1, 0xE7, 0x5D, 0xE7, 0x89, 0xE8,
-    0x0F, 0xEA, 0xF0, 0xEC, 0xB7, 0xF0, 0x4B, 0xF1, 0x10, 0xF2, 0xC6, 0xF8, 0xD3, 0xFB, 0xAB, 0xFE,
-    0x40, 0xFF, 0x01, 0xFF, 0x40, 0xFF, 0x67, 0xFF, 0x96, 0xFF, 0xB7, 0xFF, 0xEF, 0x62, 0x75, 0xC3,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0xDC, 0x76, 0xDE, 0x5F, 0xDF, 0xB0, 0xE0,
+    0x9A, 0xE2, 0xE9, 0xE4, 0x76, 0xE5, 0x58, 0xE6, 0xE1, 0xE7, 0x5D, 0xE7, 0x89, 0xE8, 0x0F, 0xEA,
+    0xF0, 0xEC, 0xB7, 0xF0, 0x4B, 0xF1, 0x10, 0xF2, 0xC6, 0xF8, 0xD3, 0xFB, 0xAB, 0xFE, 0x40, 0xFF,
+    0x01, 0xFF, 0x40, 0xFF, 0x67, 0xFF, 0x96, 0xFF, 0xB7, 0xFF, 0xEF, 0xDC, 0xFA, 0x62, 0x75, 0xC3,
     0x7D, 0xE2, 0xA9, 0x7D, 0xE9, 0xFF, 0x64, 0xC3, 0x6C, 0x72, 0x77, 0x7E, 0x34, 0x8E, 0x7D, 0xE2,
     0xF8, 0x7F, 0xFF, 0xF7, 0x7D, 0xFC, 0xB8, 0x61, 0x74, 0x7E, 0x53, 0x9F, 0x21, 0x68, 0xFB, 0x61,
     0x65, 0x7D, 0xE6, 0xB4, 0x21, 0x6B, 0xFB, 0x61, 0x65, 0x7E, 0x0D, 0x4A, 0x62, 0x66, 0x6D, 0x7D,
@@ -8769,12 +8769,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xD5, 0x7D, 0xF9, 0xD5, 0x7D, 0xF9, 0xD5, 0x7D, 0xFA, 0x52, 0x7D, 0xF9, 0xD5, 0x63, 0x61, 0x74,
     0x75, 0x7D, 0xFA, 0xEF, 0x7D, 0xFA, 0xEF, 0x7D, 0xFA, 0xEF, 0xE2, 0x02, 0xC2, 0x69, 0x72, 0x7D,
     0xE1, 0x9F, 0x7D, 0xE0, 0x4B, 0x63, 0x61, 0x65, 0x79, 0x7D, 0xFA, 0xD7, 0x7F, 0xFF, 0xF5, 0x7D,
-    0xFA, 0x25, 0xE1, 0x06, 0xF1, 0x65, 0x7D, 0xF9, 0x9B, 0x72, 0x61, 0xC3, 0x62, 0x65, 0x67, 0x69,
-    0x6B, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x7A, 0x7F, 0xFF, 0x39, 0x7F,
-    0xFF, 0x5A, 0x7D, 0xFA, 0x75, 0x7F, 0xFF, 0x6A, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0x91, 0x7F, 0xFF,
-    0xAE, 0x7D, 0xFA, 0x75, 0x7E, 0x00, 0x4C, 0x7F, 0xFF, 0xBF, 0x7E, 0x1C, 0xFF, 0x7D, 0xFA, 0x75,
-    0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF9, 0x7D, 0xFA, 0x75, 0x7D, 0xFA, 0x75, 0x7D,
-    0xE9, 0x72, 0x41, 0x61, 0xAF, 0x3F, 0x21, 0x68, 0xFC, 0x62, 0x6F, 0x72, 0x7D, 0xFA, 0x28, 0x7D,
+    0xFA, 0x25, 0xE1, 0x06, 0xF1, 0x65, 0x7D, 0xF9, 0x9B, 0x72, 0x61, 0x62, 0x65, 0x67, 0x69, 0x6B,
+    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x7A, 0xC3, 0x7F, 0xFF, 0x39, 0x7D,
+    0xFA, 0x75, 0x7F, 0xFF, 0x6A, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0x91, 0x7F, 0xFF, 0xAE, 0x7D, 0xFA,
+    0x75, 0x7E, 0x00, 0x4C, 0x7F, 0xFF, 0xBF, 0x7E, 0x1C, 0xFF, 0x7D, 0xFA, 0x75, 0x7F, 0xFF, 0xD4,
+    0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF9, 0x7D, 0xFA, 0x75, 0x7D, 0xFA, 0x75, 0x7D, 0xE9, 0x72, 0x7F,
+    0xFF, 0x5A, 0x41, 0x61, 0xAF, 0x3F, 0x21, 0x68, 0xFC, 0x62, 0x6F, 0x72, 0x7D, 0xFA, 0x28, 0x7D,
     0xFA, 0x28, 0x62, 0x61, 0xC3, 0x7D, 0xE3, 0x0E, 0x7E, 0x45, 0xED, 0xE3, 0x00, 0xA1, 0x67, 0x73,
     0x74, 0x7D, 0xE4, 0x25, 0x7F, 0xFF, 0xF7, 0x7D, 0xE0, 0x67, 0x62, 0x69, 0x72, 0x7E, 0x00, 0xB3,
     0x7F, 0xFF, 0xF1, 0x63, 0x61, 0x65, 0x70, 0x7D, 0xFB, 0x13, 0x7F, 0xFF, 0xF7, 0x7D, 0xDF, 0xE3,
@@ -8785,10 +8785,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x63, 0x6C, 0x72, 0x7A, 0x7D, 0xFA, 0xC3, 0x7D, 0xFA, 0xC3, 0x7D, 0xFA, 0xC3, 0x63, 0x66, 0x6E,
     0x73, 0x7D, 0xFA, 0x5F, 0x7E, 0x22, 0xE0, 0x7F, 0xFF, 0xF3, 0x61, 0x69, 0x7D, 0xFB, 0x21, 0xF2,
     0x07, 0xB1, 0x61, 0x62, 0x63, 0x65, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73,
-    0xC3, 0x74, 0x75, 0x7A, 0x7D, 0xF9, 0x2B, 0x7F, 0xFC, 0xD7, 0x7F, 0xFC, 0xED, 0x7F, 0xFD, 0x29,
+    0x74, 0x75, 0x7A, 0xC3, 0x7D, 0xF9, 0x2B, 0x7F, 0xFC, 0xD7, 0x7F, 0xFC, 0xED, 0x7F, 0xFD, 0x29,
     0x7F, 0x2D, 0x20, 0x7F, 0xFD, 0x4E, 0x7E, 0x41, 0x56, 0x7F, 0xFD, 0x55, 0x7F, 0xFD, 0xA3, 0x7F,
-    0xFD, 0xBC, 0x7F, 0xFE, 0x0F, 0x7F, 0xFE, 0x44, 0x7F, 0xFF, 0x1A, 0x7F, 0xFF, 0xAC, 0x7E, 0x3D,
-    0x82, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xFB, 0x61, 0x65, 0x7E, 0x8F, 0xA6, 0xA1,
+    0xFD, 0xBC, 0x7F, 0xFE, 0x0F, 0x7F, 0xFE, 0x44, 0x7F, 0xFF, 0x1A, 0x7F, 0xFF, 0xAC, 0x7F, 0xFF,
+    0xCC, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xFB, 0x7E, 0x3D, 0x82, 0x61, 0x65, 0x7E, 0x8F, 0xA6, 0xA1,
     0x00, 0xB1, 0x6B, 0xFB, 0x61, 0x65, 0x7D, 0xEF, 0x4D, 0x62, 0x62, 0x6B, 0x7D, 0xDF, 0x86, 0x7E,
     0x3C, 0x48, 0x65, 0x68, 0x69, 0x6E, 0x70, 0x72, 0x7D, 0xDF, 0x4C, 0x7D, 0xDF, 0xAF, 0x7E, 0x2F,
     0x83, 0x7D, 0xDF, 0x14, 0x7F, 0xFF, 0xF7, 0xE8, 0x06, 0xF1, 0x61, 0x65, 0x68, 0x69, 0x6F, 0x72,
@@ -8826,10 +8826,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x6E, 0x74, 0x7D, 0xE2, 0x3E, 0x7D, 0xDC, 0xD2, 0xA0, 0x2E, 0x53, 0x67, 0x65, 0x69, 0x6C,
     0x6D, 0x6F, 0x70, 0x75, 0x7D, 0xDC, 0xC6, 0x7D, 0xF6, 0xAE, 0x7D, 0xDC, 0x8D, 0x7D, 0xDC, 0x8D,
     0x7F, 0xFF, 0xFD, 0x7D, 0xDD, 0x5D, 0x7D, 0xF6, 0xAE, 0x62, 0x61, 0x77, 0x7D, 0xDC, 0x70, 0x7D,
-    0xF7, 0x43, 0x6D, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x7A,
-    0x7F, 0xFF, 0xAA, 0x7E, 0x0A, 0x62, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xC9, 0x7D, 0xDC, 0x67, 0x7F,
-    0xFF, 0xCE, 0x7D, 0xE5, 0xE9, 0x7E, 0x45, 0xD9, 0x7D, 0xF6, 0x18, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF,
-    0xF7, 0x7D, 0xDC, 0x6A, 0x7D, 0xDC, 0x6A, 0xE1, 0x07, 0x71, 0x74, 0x7D, 0xDC, 0x6B, 0xE5, 0x05,
+    0xF7, 0x43, 0x6D, 0x61, 0x64, 0x65, 0x66, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x7A, 0xC3,
+    0x7F, 0xFF, 0xAA, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xC9, 0x7D, 0xDC, 0x67, 0x7F, 0xFF, 0xCE, 0x7D,
+    0xE5, 0xE9, 0x7E, 0x45, 0xD9, 0x7D, 0xF6, 0x18, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xF7, 0x7D, 0xDC,
+    0x6A, 0x7D, 0xDC, 0x6A, 0x7E, 0x0A, 0x62, 0xE1, 0x07, 0x71, 0x74, 0x7D, 0xDC, 0x6B, 0xE5, 0x05,
     0x11, 0x64, 0x65, 0x6B, 0x73, 0x75, 0x7D, 0xF6, 0xFE, 0x7D, 0xF6, 0x13, 0x7D, 0xF6, 0x13, 0x7D,
     0xF6, 0x13, 0x7D, 0xF5, 0xCF, 0x66, 0x62, 0x63, 0x69, 0x6C, 0x6E, 0x73, 0x7D, 0xFE, 0x8F, 0x7D,
     0xF5, 0xFC, 0x7D, 0xDD, 0x82, 0x7E, 0x43, 0xF3, 0x7D, 0xE2, 0xF1, 0x7D, 0xDC, 0x7E, 0x63, 0x6B,
@@ -8837,10 +8837,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x73, 0x75, 0x7F, 0xFF, 0xFB, 0x7E, 0xD7, 0x89, 0x62, 0x61, 0x65, 0x7F, 0xFF, 0xF7, 0x7D,
     0xF6, 0x01, 0x63, 0x62, 0x65, 0x73, 0x7D, 0xDD, 0x9F, 0x7D, 0xDB, 0xD7, 0x7D, 0xF6, 0x5F, 0x62,
     0x61, 0x65, 0x7D, 0xE4, 0x1F, 0x7E, 0xFA, 0xB1, 0x61, 0x69, 0x7E, 0x60, 0x5D, 0x61, 0x65, 0x7D,
-    0xDC, 0x81, 0x6C, 0x61, 0xC3, 0x65, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x77, 0x7A, 0x7F,
-    0xFF, 0x8C, 0x7E, 0x04, 0x71, 0x7F, 0xFF, 0xA3, 0x7F, 0x2F, 0x4E, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF,
-    0xD7, 0x7F, 0x6D, 0x55, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xED, 0x7F, 0xFF, 0xF6, 0x7E, 0xF0, 0x68,
-    0x7F, 0xFF, 0xFB, 0x61, 0x6F, 0x7D, 0xFC, 0x41, 0x64, 0x61, 0x65, 0x73, 0x74, 0x7D, 0xDB, 0xF1,
+    0xDC, 0x81, 0x6C, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x77, 0x7A, 0xC3, 0x7F,
+    0xFF, 0x8C, 0x7F, 0xFF, 0xA3, 0x7F, 0x2F, 0x4E, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xD7, 0x7F, 0x6D,
+    0x55, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xED, 0x7F, 0xFF, 0xF6, 0x7E, 0xF0, 0x68, 0x7F, 0xFF, 0xFB,
+    0x7E, 0x04, 0x71, 0x61, 0x6F, 0x7D, 0xFC, 0x41, 0x64, 0x61, 0x65, 0x73, 0x74, 0x7D, 0xDB, 0xF1,
     0x7D, 0xDE, 0x48, 0x7D, 0xE5, 0x03, 0x7F, 0xFF, 0xFB, 0x61, 0x7A, 0x7F, 0x10, 0xD6, 0x21, 0x6E,
     0xFB, 0x62, 0x65, 0x72, 0x7F, 0xFF, 0xFD, 0x7D, 0xDB, 0xD8, 0xF1, 0x07, 0xB1, 0x61, 0x62, 0x63,
     0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x78, 0x79, 0x7F, 0xFD,
@@ -8877,11 +8877,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xF3, 0xE7, 0x09, 0xB2, 0x61, 0x65, 0x6B, 0x6C, 0x70, 0x74, 0x7A, 0x7E, 0xBA, 0x76, 0x7D,
     0xFB, 0xBD, 0x7D, 0xF3, 0xEF, 0x7D, 0xF3, 0xEF, 0x7F, 0xEE, 0x67, 0x7F, 0xFE, 0x4F, 0x7D, 0xF3,
     0xEF, 0xE1, 0x02, 0xF1, 0x72, 0x7D, 0xF3, 0xD0, 0x63, 0x68, 0x6D, 0x73, 0x7F, 0xFF, 0xF9, 0x7D,
-    0xFD, 0xAB, 0x7E, 0xF3, 0xB4, 0x70, 0x2E, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C,
-    0x6D, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7D, 0xF3, 0xB9, 0x7F, 0xFE, 0x2C, 0x7F, 0xFE, 0x6D, 0x7F,
-    0xFE, 0x72, 0x7F, 0xFE, 0xD3, 0x7D, 0xD9, 0xA4, 0x7D, 0xF3, 0xB9, 0x7F, 0xFF, 0x19, 0x7D, 0xF3,
-    0xB9, 0x7F, 0xFF, 0x5F, 0x7D, 0xF3, 0xB9, 0x7F, 0xFF, 0x8D, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xCD,
-    0x7E, 0xBA, 0x92, 0x7F, 0xFF, 0xF3, 0x61, 0x61, 0x7E, 0x11, 0xEA, 0xE2, 0x08, 0x62, 0x6C, 0x72,
+    0xFD, 0xAB, 0x7E, 0xF3, 0xB4, 0x70, 0x2E, 0x61, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6B, 0x6C, 0x6D,
+    0x6F, 0x72, 0x73, 0x74, 0x75, 0xC3, 0x7D, 0xF3, 0xB9, 0x7F, 0xFE, 0x2C, 0x7F, 0xFE, 0x72, 0x7F,
+    0xFE, 0xD3, 0x7D, 0xD9, 0xA4, 0x7D, 0xF3, 0xB9, 0x7F, 0xFF, 0x19, 0x7D, 0xF3, 0xB9, 0x7F, 0xFF,
+    0x5F, 0x7D, 0xF3, 0xB9, 0x7F, 0xFF, 0x8D, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xCD, 0x7E, 0xBA, 0x92,
+    0x7F, 0xFF, 0xF3, 0x7F, 0xFE, 0x6D, 0x61, 0x61, 0x7E, 0x11, 0xEA, 0xE2, 0x08, 0x62, 0x6C, 0x72,
     0x7D, 0xF2, 0x73, 0x7F, 0xFF, 0xFB, 0x61, 0x6B, 0x7D, 0xD9, 0x9C, 0x63, 0x68, 0x6C, 0x72, 0x7D,
     0xF4, 0x78, 0x7D, 0xD8, 0xDE, 0x7D, 0xF3, 0xB1, 0xE1, 0x03, 0x52, 0x74, 0x7E, 0x3F, 0xF4, 0x21,
     0x73, 0xF9, 0x62, 0x61, 0x65, 0x7D, 0xDC, 0x8C, 0x7F, 0xFF, 0xFD, 0x21, 0x74, 0xF7, 0x6A, 0x63,
@@ -8894,12 +8894,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x72, 0x73, 0x74, 0x7F, 0xFF, 0xFB, 0x7D, 0xDA, 0x2A, 0x7D, 0xD8, 0xC6, 0x7D, 0xE4, 0xB6, 0x7D,
     0xDD, 0x20, 0x63, 0x2E, 0x65, 0x72, 0x7D, 0xF1, 0xBF, 0x7E, 0x83, 0x0D, 0x7E, 0x03, 0xF1, 0xE1,
     0x00, 0xB1, 0x68, 0x7E, 0x55, 0x98, 0x62, 0x73, 0x74, 0x7D, 0xDE, 0xB3, 0x7D, 0xD8, 0x33, 0xF4,
-    0x07, 0xB1, 0x2E, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x7D, 0xF2, 0xAF, 0x7F, 0xFF, 0x6F, 0x7F, 0xFF, 0xA1, 0x7D,
-    0xF2, 0xAF, 0x7D, 0xF2, 0xAF, 0x7F, 0xFF, 0xBC, 0x7D, 0xF2, 0xAF, 0x7D, 0xF2, 0xAF, 0x7F, 0xFF,
-    0xCE, 0x7D, 0xF2, 0xAF, 0x7D, 0xF1, 0xA5, 0x7D, 0xF2, 0xAF, 0x7D, 0xF2, 0xAF, 0x7F, 0xFF, 0xE3,
-    0x7D, 0xF1, 0xA5, 0x7D, 0xF2, 0xAF, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF7, 0x7E, 0x11, 0xA6, 0x7D,
-    0xF2, 0xAF, 0xE7, 0x2C, 0x12, 0x62, 0x6B, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x7D, 0xD7, 0xDA, 0x7D,
+    0x07, 0xB1, 0x2E, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72,
+    0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7D, 0xF2, 0xAF, 0x7F, 0xFF, 0x6F, 0x7D, 0xF2, 0xAF, 0x7D,
+    0xF2, 0xAF, 0x7F, 0xFF, 0xBC, 0x7D, 0xF2, 0xAF, 0x7D, 0xF2, 0xAF, 0x7F, 0xFF, 0xCE, 0x7D, 0xF2,
+    0xAF, 0x7D, 0xF1, 0xA5, 0x7D, 0xF2, 0xAF, 0x7D, 0xF2, 0xAF, 0x7F, 0xFF, 0xE3, 0x7D, 0xF1, 0xA5,
+    0x7D, 0xF2, 0xAF, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF7, 0x7E, 0x11, 0xA6, 0x7D, 0xF2, 0xAF, 0x7F,
+    0xFF, 0xA1, 0xE7, 0x2C, 0x12, 0x62, 0x6B, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x7D, 0xD7, 0xDA, 0x7D,
     0xD9, 0x31, 0x7E, 0x09, 0x83, 0x7D, 0xF1, 0xBF, 0x7D, 0xD7, 0xDA, 0x7D, 0xF1, 0x52, 0x7D, 0xD7,
     0xDA, 0x62, 0x6F, 0x73, 0x7D, 0xD8, 0x22, 0x7D, 0xD8, 0x22, 0x62, 0x65, 0x68, 0x7E, 0x2F, 0x7B,
     0x7F, 0xFF, 0xF7, 0x62, 0x65, 0x6C, 0x7D, 0xD8, 0x85, 0x7D, 0xD8, 0x85, 0x21, 0x6B, 0xF7, 0x62,
@@ -8990,10 +8990,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0xEC, 0xE9, 0x7D, 0xEC, 0xE9, 0x7D, 0xEC, 0xE9, 0xE4, 0x02, 0xF1, 0x61, 0x70, 0x74, 0x79,
     0x7D, 0xD2, 0xC0, 0x7D, 0xD2, 0xC0, 0x7F, 0xFF, 0xEF, 0x7D, 0xEC, 0xD8, 0x63, 0x61, 0x65, 0x6F,
     0x7D, 0xD2, 0xAA, 0x7D, 0xD2, 0xAA, 0x7D, 0xEC, 0xC5, 0x62, 0x63, 0x6D, 0x7D, 0xEB, 0xB5, 0x7D,
-    0xF6, 0x9A, 0xEC, 0x06, 0xF2, 0x61, 0x65, 0x66, 0x68, 0x6C, 0x6F, 0xC3, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0x7F, 0xFE, 0xDE, 0x7F, 0xFF, 0x2A, 0x7F, 0xFF, 0x43, 0x7F, 0x35, 0x77, 0x7F, 0xFF, 0x5D,
-    0x7F, 0xFF, 0x7C, 0x7F, 0xFF, 0x90, 0x7D, 0xD2, 0x97, 0x7F, 0xFF, 0xAD, 0x7F, 0xFF, 0xD7, 0x7F,
-    0xFF, 0xEA, 0x7F, 0xFF, 0xF7, 0x68, 0x66, 0x67, 0x6C, 0x6D, 0x70, 0x73, 0x76, 0x7A, 0x7D, 0xEC,
+    0xF6, 0x9A, 0xEC, 0x06, 0xF2, 0x61, 0x65, 0x66, 0x68, 0x6C, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75,
+    0xC3, 0x7F, 0xFE, 0xDE, 0x7F, 0xFF, 0x2A, 0x7F, 0xFF, 0x43, 0x7F, 0x35, 0x77, 0x7F, 0xFF, 0x5D,
+    0x7F, 0xFF, 0x7C, 0x7D, 0xD2, 0x97, 0x7F, 0xFF, 0xAD, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xEA, 0x7F,
+    0xFF, 0xF7, 0x7F, 0xFF, 0x90, 0x68, 0x66, 0x67, 0x6C, 0x6D, 0x70, 0x73, 0x76, 0x7A, 0x7D, 0xEC,
     0x15, 0x7D, 0xED, 0x91, 0x7D, 0xEC, 0x15, 0x7D, 0xEC, 0x15, 0x7D, 0xEC, 0x15, 0x7D, 0xEC, 0x15,
     0x7D, 0xEC, 0x15, 0x7D, 0xEC, 0x15, 0x66, 0x65, 0x66, 0x6B, 0x6C, 0x72, 0x78, 0x7F, 0xFF, 0xDF,
     0x7D, 0xD1, 0xD3, 0x7D, 0xEB, 0xF4, 0x7D, 0xEB, 0xF4, 0x7D, 0xD1, 0xD3, 0x7D, 0xEB, 0xF4, 0x6A,
@@ -9056,10 +9056,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0xE8, 0xC7, 0xE1, 0x0D, 0x02, 0x6F, 0x7D, 0xF0, 0xC7, 0x65, 0x68, 0x6B, 0x6C, 0x73, 0x74,
     0x7D, 0xE8, 0xB7, 0x7D, 0xE8, 0xB7, 0x7D, 0xE8, 0xB7, 0x7D, 0xE8, 0xB7, 0x7D, 0xE8, 0xB7, 0x64,
     0x68, 0x6D, 0x6E, 0x72, 0x7D, 0xE8, 0xA2, 0x7D, 0xF9, 0x86, 0x7D, 0xFB, 0x9C, 0x7F, 0xFF, 0xEB,
-    0xED, 0x06, 0xF1, 0x61, 0xC3, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x75, 0x79, 0x7A,
-    0x7F, 0xFE, 0xDC, 0x7F, 0xFE, 0xFD, 0x7F, 0xFF, 0x0D, 0x7F, 0xFF, 0x54, 0x7E, 0x69, 0xE5, 0x7F,
-    0x31, 0x59, 0x7F, 0xFF, 0xA4, 0x7F, 0xFF, 0xB1, 0x7F, 0xFF, 0xCA, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF,
-    0xEF, 0x7D, 0xE9, 0x68, 0x7D, 0xCE, 0x79, 0x62, 0x65, 0x6F, 0x7D, 0xD0, 0x18, 0x7D, 0xCE, 0xDA,
+    0xED, 0x06, 0xF1, 0x61, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x75, 0x79, 0x7A, 0xC3,
+    0x7F, 0xFE, 0xDC, 0x7F, 0xFF, 0x0D, 0x7F, 0xFF, 0x54, 0x7E, 0x69, 0xE5, 0x7F, 0x31, 0x59, 0x7F,
+    0xFF, 0xA4, 0x7F, 0xFF, 0xB1, 0x7F, 0xFF, 0xCA, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xEF, 0x7D, 0xE9,
+    0x68, 0x7D, 0xCE, 0x79, 0x7F, 0xFE, 0xFD, 0x62, 0x65, 0x6F, 0x7D, 0xD0, 0x18, 0x7D, 0xCE, 0xDA,
     0xE3, 0x06, 0xF1, 0x62, 0x66, 0x6C, 0x7D, 0xCD, 0xCC, 0x7D, 0xE7, 0xEA, 0x7F, 0xFF, 0xF7, 0x62,
     0x61, 0x72, 0x7D, 0xCE, 0x27, 0x7D, 0xCE, 0x27, 0x21, 0x66, 0xF7, 0xE3, 0x06, 0xF1, 0x65, 0x6C,
     0x6F, 0x7D, 0xF3, 0x84, 0x7D, 0xE7, 0x29, 0x7D, 0xE7, 0x5F, 0x61, 0x63, 0x7D, 0xCE, 0x75, 0x63,
@@ -9079,14 +9079,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x74, 0x7D, 0xE5, 0x3A, 0x7D, 0xE6, 0xFA, 0x7D, 0xE7, 0x5E, 0x7D, 0xEE, 0x66, 0x7F, 0xFF, 0x10,
     0x7F, 0xFF, 0x28, 0x7D, 0xEB, 0xC1, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0x4C, 0x7F, 0xFF, 0x7E, 0x7F,
     0xFF, 0x8E, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xF3, 0xE1, 0x06, 0xF1, 0x61, 0x7E,
-    0x20, 0x11, 0xE2, 0x2E, 0xD3, 0x73, 0x74, 0x7D, 0xF2, 0xAD, 0x7D, 0xE7, 0x1F, 0x79, 0x61, 0xC3,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0x7F, 0xED, 0x82, 0x7F, 0xEE, 0x7A, 0x7D, 0xE7, 0x11,
-    0x7F, 0xEE, 0x83, 0x7F, 0xEE, 0x8A, 0x7F, 0xF1, 0x2D, 0x7F, 0xF3, 0x58, 0x7F, 0xF3, 0x9E, 0x7F,
-    0xF4, 0x62, 0x7F, 0xF6, 0x30, 0x7D, 0xE7, 0x11, 0x7F, 0xF6, 0x6A, 0x7F, 0xF6, 0xE2, 0x7F, 0xF7,
-    0x01, 0x7F, 0xF7, 0x0C, 0x7F, 0xF8, 0xEF, 0x7F, 0xFA, 0x65, 0x7F, 0xFC, 0x68, 0x7F, 0xFD, 0x12,
-    0x7F, 0xFE, 0x83, 0x7F, 0xFF, 0xB3, 0x7D, 0xE7, 0x11, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF5, 0x7D,
-    0xE7, 0x11, 0x63, 0x65, 0x69, 0x6E, 0x7D, 0xCE, 0x6D, 0x7D, 0xCC, 0x94, 0x7D, 0xCC, 0x91, 0x63,
+    0x20, 0x11, 0xE2, 0x2E, 0xD3, 0x73, 0x74, 0x7D, 0xF2, 0xAD, 0x7D, 0xE7, 0x1F, 0x79, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3, 0x7F, 0xED, 0x82, 0x7D, 0xE7, 0x11, 0x7F, 0xEE, 0x83,
+    0x7F, 0xEE, 0x8A, 0x7F, 0xF1, 0x2D, 0x7F, 0xF3, 0x58, 0x7F, 0xF3, 0x9E, 0x7F, 0xF4, 0x62, 0x7F,
+    0xF6, 0x30, 0x7D, 0xE7, 0x11, 0x7F, 0xF6, 0x6A, 0x7F, 0xF6, 0xE2, 0x7F, 0xF7, 0x01, 0x7F, 0xF7,
+    0x0C, 0x7F, 0xF8, 0xEF, 0x7F, 0xFA, 0x65, 0x7F, 0xFC, 0x68, 0x7F, 0xFD, 0x12, 0x7F, 0xFE, 0x83,
+    0x7F, 0xFF, 0xB3, 0x7D, 0xE7, 0x11, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF5, 0x7D, 0xE7, 0x11, 0x7F,
+    0xEE, 0x7A, 0x63, 0x65, 0x69, 0x6E, 0x7D, 0xCE, 0x6D, 0x7D, 0xCC, 0x94, 0x7D, 0xCC, 0x91, 0x63,
     0x72, 0x74, 0x77, 0x7F, 0xFF, 0xF3, 0x7F, 0x82, 0x5D, 0x7D, 0xE6, 0x9F, 0xE4, 0x06, 0xC1, 0x61,
     0x65, 0x69, 0x6F, 0x7E, 0x4F, 0x57, 0x7F, 0xFF, 0xF3, 0x7F, 0x42, 0xF4, 0x7D, 0xE6, 0x2E, 0xE2,
     0x07, 0xB1, 0x73, 0x75, 0x7D, 0xE6, 0x7F, 0x7F, 0xFF, 0xED, 0x63, 0x62, 0x6C, 0x72, 0x7D, 0xE5,
@@ -9151,11 +9151,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x72, 0x7D, 0xCD, 0x4F, 0x7D, 0xCC, 0x39, 0x61, 0xBC, 0x7D, 0xEB, 0x35, 0x63, 0x65, 0x75, 0xC3,
     0x7F, 0x36, 0x65, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x62, 0x6B, 0x74, 0x7D, 0xC9, 0xF8, 0x7F,
     0xFF, 0xF3, 0x64, 0x61, 0xC3, 0x65, 0x68, 0x7E, 0x51, 0x9C, 0x7D, 0xEB, 0x0D, 0x7D, 0xFE, 0x6C,
-    0x7D, 0xE5, 0x56, 0xE1, 0x08, 0x62, 0x6E, 0x7D, 0xC8, 0x16, 0x71, 0x2E, 0x61, 0xC3, 0x62, 0x65,
-    0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x71, 0x73, 0x74, 0x75, 0x7A, 0x7D, 0xE3, 0x23, 0x7F,
-    0xFE, 0xD7, 0x7F, 0xFE, 0xFA, 0x7F, 0xFF, 0x15, 0x7F, 0xFF, 0x3E, 0x7D, 0xE2, 0x94, 0x7F, 0xFF,
-    0x7D, 0x7F, 0xFF, 0x8E, 0x7F, 0xFF, 0x95, 0x7F, 0x84, 0x1D, 0x7F, 0xFF, 0xB4, 0x7F, 0xFF, 0xBB,
-    0x7D, 0xE2, 0x30, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF9, 0x7D, 0xE2, 0x30, 0x63,
+    0x7D, 0xE5, 0x56, 0xE1, 0x08, 0x62, 0x6E, 0x7D, 0xC8, 0x16, 0x71, 0x2E, 0x61, 0x62, 0x65, 0x67,
+    0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70, 0x71, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7D, 0xE3, 0x23, 0x7F,
+    0xFE, 0xD7, 0x7F, 0xFF, 0x15, 0x7F, 0xFF, 0x3E, 0x7D, 0xE2, 0x94, 0x7F, 0xFF, 0x7D, 0x7F, 0xFF,
+    0x8E, 0x7F, 0xFF, 0x95, 0x7F, 0x84, 0x1D, 0x7F, 0xFF, 0xB4, 0x7F, 0xFF, 0xBB, 0x7D, 0xE2, 0x30,
+    0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF9, 0x7D, 0xE2, 0x30, 0x7F, 0xFE, 0xFA, 0x63,
     0x62, 0x6E, 0x73, 0x7D, 0xC8, 0x37, 0x7D, 0xC8, 0x37, 0x7D, 0xC8, 0x37, 0xE3, 0x02, 0x91, 0x65,
     0x6B, 0x77, 0x7D, 0xC8, 0x96, 0x7D, 0xC8, 0x96, 0x7D, 0xC8, 0x96, 0x64, 0x64, 0x69, 0x6E, 0x72,
     0x7D, 0xC8, 0x1B, 0x7D, 0xC8, 0x1B, 0x7E, 0x37, 0xBA, 0x7F, 0xFF, 0xF1, 0x64, 0x61, 0x65, 0x6F,
@@ -9180,12 +9180,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x2E, 0x6B, 0x70, 0x7D, 0xE1, 0x90, 0x7D, 0xCC, 0x31, 0x7D, 0xC8, 0x4A, 0x62, 0x68, 0x69, 0x7E,
     0xB4, 0x28, 0x7D, 0xC7, 0xC4, 0x62, 0x68, 0x72, 0x7D, 0xEC, 0xDC, 0x7D, 0xC6, 0xD1, 0x66, 0x61,
     0x65, 0x69, 0x75, 0xC3, 0x77, 0x7F, 0xFF, 0xF7, 0x7D, 0xF1, 0x93, 0x7D, 0xC7, 0x11, 0x7D, 0xE1,
-    0x2E, 0x7E, 0x43, 0x80, 0x7D, 0xC6, 0xC8, 0x73, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
-    0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFE, 0xDB, 0x7E, 0x8B,
-    0x0A, 0x7D, 0xE1, 0x15, 0x7D, 0xD4, 0x84, 0x7F, 0xFF, 0x37, 0x7F, 0xFF, 0x57, 0x7E, 0x58, 0x73,
-    0x7F, 0xFF, 0x8D, 0x7F, 0xFF, 0x9A, 0x7D, 0xC7, 0x4D, 0x7D, 0xE0, 0xC7, 0x7F, 0xFF, 0xA9, 0x7F,
-    0xFF, 0xB0, 0x7F, 0xFF, 0xB9, 0x7D, 0xE0, 0xC7, 0x7F, 0xFF, 0xC6, 0x7F, 0xFF, 0xD5, 0x7D, 0xCF,
-    0xD6, 0x7F, 0xFF, 0xE7, 0x62, 0x6B, 0x73, 0x7D, 0xDF, 0x99, 0x7D, 0xDF, 0x99, 0x63, 0x61, 0x6C,
+    0x2E, 0x7E, 0x43, 0x80, 0x7D, 0xC6, 0xC8, 0x73, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFE, 0xDB, 0x7D, 0xE1,
+    0x15, 0x7D, 0xD4, 0x84, 0x7F, 0xFF, 0x37, 0x7F, 0xFF, 0x57, 0x7E, 0x58, 0x73, 0x7F, 0xFF, 0x8D,
+    0x7F, 0xFF, 0x9A, 0x7D, 0xC7, 0x4D, 0x7D, 0xE0, 0xC7, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xB0, 0x7F,
+    0xFF, 0xB9, 0x7D, 0xE0, 0xC7, 0x7F, 0xFF, 0xC6, 0x7F, 0xFF, 0xD5, 0x7D, 0xCF, 0xD6, 0x7F, 0xFF,
+    0xE7, 0x7E, 0x8B, 0x0A, 0x62, 0x6B, 0x73, 0x7D, 0xDF, 0x99, 0x7D, 0xDF, 0x99, 0x63, 0x61, 0x6C,
     0x72, 0x7D, 0xE0, 0xBF, 0x7D, 0xCD, 0x30, 0x7D, 0xC6, 0x59, 0x67, 0x2E, 0x61, 0x66, 0x68, 0x6F,
     0x70, 0x72, 0x7D, 0xE0, 0x00, 0x7D, 0xEB, 0xB5, 0x7D, 0xE0, 0xB2, 0x7E, 0x3B, 0x07, 0x7F, 0xFF,
     0xEA, 0x7F, 0xFF, 0xF3, 0x7E, 0x53, 0x59, 0xE3, 0x02, 0xF1, 0x62, 0x6B, 0x6E, 0x7D, 0xDF, 0x66,
@@ -9232,12 +9232,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0xDE, 0x76, 0x7D, 0xDE, 0x35, 0x7F, 0xFF, 0xAA, 0x7F, 0xFF, 0xEB, 0xE2, 0x06, 0xF1, 0x6F,
     0x74, 0x7D, 0xDC, 0xA8, 0x7D, 0xDC, 0xB2, 0x62, 0x61, 0x75, 0x7E, 0xC2, 0x29, 0x7D, 0xF9, 0x8C,
     0x78, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x70,
-    0x71, 0x72, 0x73, 0xC3, 0x74, 0x75, 0x78, 0x79, 0x7A, 0x7F, 0xF7, 0x2A, 0x7F, 0xF7, 0x75, 0x7F,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x78, 0x79, 0x7A, 0xC3, 0x7F, 0xF7, 0x2A, 0x7F, 0xF7, 0x75, 0x7F,
     0xF8, 0x01, 0x7F, 0xF8, 0x6F, 0x7F, 0xF8, 0xE9, 0x7F, 0xF9, 0x40, 0x7F, 0xF9, 0x5D, 0x7F, 0xF9,
     0x7F, 0x7F, 0xF9, 0x98, 0x7D, 0xDE, 0x78, 0x7F, 0xF9, 0xC0, 0x7F, 0xFB, 0x0A, 0x7F, 0xFB, 0x99,
-    0x7F, 0xFC, 0xD7, 0x7F, 0xFD, 0x3A, 0x7E, 0x22, 0xD8, 0x7F, 0xFD, 0xA3, 0x7F, 0xFD, 0xFB, 0x7E,
-    0x21, 0x91, 0x7F, 0xFE, 0x90, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xEC, 0x7D, 0xD0, 0xA8, 0x7F, 0xFF,
-    0xF7, 0x61, 0x68, 0x7E, 0x17, 0x37, 0xE1, 0x06, 0xF1, 0x72, 0x7D, 0xC2, 0xB3, 0xE1, 0x06, 0xF1,
+    0x7F, 0xFC, 0xD7, 0x7F, 0xFD, 0x3A, 0x7E, 0x22, 0xD8, 0x7F, 0xFD, 0xA3, 0x7F, 0xFD, 0xFB, 0x7F,
+    0xFE, 0x90, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xEC, 0x7D, 0xD0, 0xA8, 0x7F, 0xFF, 0xF7, 0x7E, 0x21,
+    0x91, 0x61, 0x68, 0x7E, 0x17, 0x37, 0xE1, 0x06, 0xF1, 0x72, 0x7D, 0xC2, 0xB3, 0xE1, 0x06, 0xF1,
     0x65, 0x7E, 0xAB, 0xF1, 0x63, 0x2E, 0x69, 0x73, 0x7D, 0xDC, 0xC6, 0x7D, 0xDC, 0xC6, 0x7D, 0xDC,
     0xC6, 0xE4, 0x06, 0xF2, 0x2E, 0x61, 0x6D, 0x6F, 0x7D, 0xDC, 0x10, 0x7D, 0xC2, 0x98, 0x7D, 0xC5,
     0xDC, 0x7D, 0xC2, 0x98, 0x63, 0x61, 0x63, 0x73, 0x7D, 0xC2, 0xF5, 0x7D, 0xC2, 0xF5, 0x7D, 0xCA,
@@ -9379,11 +9379,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xF4, 0x7D, 0xD4, 0xF4, 0x7D, 0xD4, 0xF4, 0x7D, 0xCA, 0x8B, 0x7D, 0xD4, 0xF4, 0x7F, 0xFF, 0xFD,
     0x7D, 0xD4, 0xF4, 0x7D, 0xD4, 0xF4, 0x7D, 0xD4, 0xF4, 0xE1, 0x00, 0xA1, 0x72, 0x7D, 0xBA, 0xC9,
     0x63, 0x6C, 0x6E, 0x72, 0x7D, 0xD2, 0x9C, 0x7E, 0x20, 0x1B, 0x7F, 0xFF, 0xF9, 0x63, 0x61, 0x65,
-    0x77, 0x7D, 0xBA, 0x92, 0x7F, 0xFF, 0xF3, 0x7D, 0xBC, 0x22, 0x70, 0x2E, 0xC3, 0x62, 0x63, 0x64,
-    0x65, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x73, 0x74, 0x7A, 0x7D, 0xD4, 0xE3, 0x7D, 0xEA,
-    0x22, 0x7F, 0xFE, 0x9D, 0x7F, 0xFE, 0xA9, 0x7F, 0xFE, 0xB3, 0x7F, 0xFE, 0xC9, 0x7F, 0xFE, 0xCE,
-    0x7F, 0xFE, 0xF6, 0x7D, 0xD4, 0xE3, 0x7E, 0x21, 0x98, 0x7F, 0xFF, 0x05, 0x7F, 0xFF, 0x12, 0x7F,
-    0xFF, 0x39, 0x7F, 0xFF, 0xAE, 0x7D, 0xD1, 0x97, 0x7F, 0xFF, 0xF3, 0x61, 0x72, 0x7E, 0x97, 0xDC,
+    0x77, 0x7D, 0xBA, 0x92, 0x7F, 0xFF, 0xF3, 0x7D, 0xBC, 0x22, 0x70, 0x2E, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6D, 0x6E, 0x73, 0x74, 0x7A, 0xC3, 0x7D, 0xD4, 0xE3, 0x7F, 0xFE,
+    0x9D, 0x7F, 0xFE, 0xA9, 0x7F, 0xFE, 0xB3, 0x7F, 0xFE, 0xC9, 0x7F, 0xFE, 0xCE, 0x7F, 0xFE, 0xF6,
+    0x7D, 0xD4, 0xE3, 0x7E, 0x21, 0x98, 0x7F, 0xFF, 0x05, 0x7F, 0xFF, 0x12, 0x7F, 0xFF, 0x39, 0x7F,
+    0xFF, 0xAE, 0x7D, 0xD1, 0x97, 0x7F, 0xFF, 0xF3, 0x7D, 0xEA, 0x22, 0x61, 0x72, 0x7E, 0x97, 0xDC,
     0x61, 0x6E, 0x7D, 0xBF, 0xD9, 0x21, 0x69, 0xFB, 0x62, 0x6D, 0x72, 0x7D, 0xB9, 0xEE, 0x7F, 0xFF,
     0xFD, 0x64, 0x65, 0x69, 0x6F, 0x75, 0x7F, 0xFF, 0xEA, 0x7D, 0xBA, 0x2E, 0x7D, 0xC5, 0x99, 0x7F,
     0xFF, 0xF7, 0x63, 0x6B, 0x74, 0x7A, 0x7D, 0xD4, 0x3A, 0x7F, 0xFF, 0xEF, 0x7D, 0xD3, 0xEC, 0xE7,
@@ -9426,10 +9426,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x72, 0xEB, 0xE6, 0x02, 0xF1, 0x61, 0x65, 0x69, 0x75, 0x77, 0x79, 0x7D, 0xE2, 0x4F, 0x7F, 0xFF,
     0xFD, 0x7D, 0xBF, 0x6C, 0x7D, 0xC3, 0x71, 0x7D, 0xB7, 0x84, 0x7D, 0xD2, 0xB1, 0x74, 0x2E, 0x61,
     0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75,
-    0xC3, 0x7A, 0x7D, 0xD2, 0x10, 0x7F, 0xFE, 0x61, 0x7F, 0xFE, 0x93, 0x7F, 0xFE, 0xB5, 0x7F, 0x9B,
+    0x7A, 0xC3, 0x7D, 0xD2, 0x10, 0x7F, 0xFE, 0x61, 0x7F, 0xFE, 0x93, 0x7F, 0xFE, 0xB5, 0x7F, 0x9B,
     0x88, 0x7F, 0xFE, 0xD7, 0x7F, 0xFE, 0xE8, 0x7F, 0xFE, 0xED, 0x7D, 0xEE, 0xDA, 0x7F, 0xFE, 0xFA,
     0x7D, 0xD1, 0x1D, 0x7D, 0xD1, 0x1D, 0x7F, 0xFF, 0x1C, 0x7F, 0xFF, 0x31, 0x7D, 0xCF, 0xF5, 0x7F,
-    0xFF, 0x56, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xC4, 0x7D, 0xEC, 0x8A, 0x7F, 0xFF, 0xE5, 0xE1, 0x07,
+    0xFF, 0x56, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xE5, 0x7D, 0xEC, 0x8A, 0xE1, 0x07,
     0x71, 0x6E, 0x7E, 0x1A, 0x65, 0x63, 0x61, 0xC3, 0x65, 0x7D, 0xD0, 0xC5, 0x7D, 0xE6, 0xF7, 0x7D,
     0xE2, 0xCC, 0x67, 0x65, 0x66, 0x69, 0x6F, 0x70, 0x72, 0x75, 0x7F, 0xFF, 0xEC, 0x7D, 0xD1, 0x1F,
     0x7E, 0x92, 0xB7, 0x7E, 0x1D, 0x60, 0x7D, 0xD1, 0x1C, 0x7F, 0xFF, 0xF3, 0x7D, 0xD0, 0xB8, 0x62,
@@ -9460,11 +9460,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x8B, 0x64, 0x2E, 0x69, 0x6E, 0x73, 0x7D, 0xB4, 0xFE, 0x7D, 0xDB, 0x82, 0x7D, 0xB4, 0xFE, 0x7D,
     0xB4, 0xFE, 0x65, 0x61, 0xC3, 0x65, 0x75, 0x79, 0x7D, 0xCF, 0xBD, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF,
     0xEF, 0x7D, 0xDB, 0x71, 0x7D, 0xDB, 0x71, 0x75, 0x2E, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0xC3, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0x7D, 0xCF, 0xE6,
+    0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3, 0x7D, 0xCF, 0xE6,
     0x7F, 0xFE, 0x58, 0x7F, 0xFE, 0x6E, 0x7F, 0xFE, 0x7B, 0x7F, 0xFE, 0x96, 0x7F, 0xFE, 0xCA, 0x7F,
     0xFE, 0xDB, 0x7F, 0x73, 0x05, 0x7F, 0xFE, 0xF9, 0x7F, 0xFF, 0x0D, 0x7F, 0xFF, 0x42, 0x7F, 0xFF,
-    0x61, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x87, 0x7F, 0xFF, 0x98, 0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xAA,
-    0x7D, 0xC6, 0xAB, 0x7D, 0xCE, 0x4D, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xEB, 0xE1, 0x07, 0x71, 0x65,
+    0x61, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x87, 0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xAA, 0x7D, 0xC6, 0xAB,
+    0x7D, 0xCE, 0x4D, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0x98, 0xE1, 0x07, 0x71, 0x65,
     0x7D, 0xB6, 0x22, 0x63, 0x68, 0x72, 0x74, 0x7D, 0xB4, 0xAF, 0x7F, 0xFF, 0xF9, 0x7D, 0xCE, 0x6E,
     0x63, 0x66, 0x6C, 0x6E, 0x7D, 0xCE, 0x51, 0x7D, 0xCE, 0x8A, 0x7D, 0xCE, 0x8A, 0x64, 0x66, 0x6D,
     0x70, 0x77, 0x7D, 0xB5, 0x35, 0x7D, 0xB4, 0xD9, 0x7D, 0xB5, 0x35, 0x7D, 0xB4, 0xD9, 0x62, 0x6E,
@@ -9484,13 +9484,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x5D, 0x7D, 0xBD, 0x0A, 0x7D, 0xCE, 0x0D, 0x7D, 0xDE, 0xF4, 0x7F, 0xFF, 0xF7, 0x7D, 0xCE, 0x0D,
     0x7D, 0xCE, 0xCB, 0x7D, 0xCB, 0x4D, 0xE1, 0x06, 0xF1, 0x6C, 0x7D, 0xCD, 0x07, 0x62, 0x61, 0x69,
     0x7F, 0xFF, 0xF9, 0x7D, 0xEC, 0xDF, 0xE1, 0x06, 0xC1, 0x6E, 0x7D, 0xB4, 0xA7, 0x63, 0x61, 0x69,
-    0x6F, 0x7D, 0xB9, 0xEB, 0x7F, 0xFF, 0xF9, 0x7D, 0xCD, 0xD1, 0xF8, 0x07, 0xB1, 0x61, 0xC3, 0x62,
-    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x77, 0x78, 0x79, 0x7F, 0xF6, 0x93, 0x7F, 0xF6, 0xA8, 0x7F, 0xF6, 0xBA, 0x7F, 0xF7,
-    0x1E, 0x7F, 0xF7, 0x47, 0x7F, 0xF7, 0x58, 0x7F, 0xF7, 0x69, 0x7F, 0xF7, 0x8A, 0x7F, 0xF7, 0xE6,
-    0x7F, 0xF9, 0x70, 0x7F, 0xF9, 0xD8, 0x7F, 0xFA, 0x23, 0x7F, 0xFA, 0x7D, 0x7F, 0xFC, 0x43, 0x7D,
-    0xCF, 0xC3, 0x7F, 0xFC, 0xA8, 0x7F, 0xFE, 0x6D, 0x7F, 0xFF, 0x55, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF,
-    0xB7, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xF3, 0x7E, 0x1C, 0x68, 0x7D, 0xCD, 0xC4, 0x64, 0x63, 0x70,
+    0x6F, 0x7D, 0xB9, 0xEB, 0x7F, 0xFF, 0xF9, 0x7D, 0xCD, 0xD1, 0xF8, 0x07, 0xB1, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0xC3, 0x7F, 0xF6, 0x93, 0x7F, 0xF6, 0xBA, 0x7F, 0xF7, 0x1E, 0x7F, 0xF7,
+    0x47, 0x7F, 0xF7, 0x58, 0x7F, 0xF7, 0x69, 0x7F, 0xF7, 0x8A, 0x7F, 0xF7, 0xE6, 0x7F, 0xF9, 0x70,
+    0x7F, 0xF9, 0xD8, 0x7F, 0xFA, 0x23, 0x7F, 0xFA, 0x7D, 0x7F, 0xFC, 0x43, 0x7D, 0xCF, 0xC3, 0x7F,
+    0xFC, 0xA8, 0x7F, 0xFE, 0x6D, 0x7F, 0xFF, 0x55, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF,
+    0xE3, 0x7F, 0xFF, 0xF3, 0x7E, 0x1C, 0x68, 0x7D, 0xCD, 0xC4, 0x7F, 0xF6, 0xA8, 0x64, 0x63, 0x70,
     0x73, 0x75, 0x7E, 0x98, 0x61, 0x7D, 0xCC, 0x54, 0x7E, 0x34, 0x43, 0x7D, 0xCE, 0xE2, 0x62, 0x65,
     0x74, 0x7D, 0xCD, 0xDF, 0x7D, 0xE5, 0x3F, 0x21, 0x73, 0xF7, 0x62, 0x61, 0x65, 0x7D, 0xE1, 0x91,
     0x7D, 0xB2, 0xF8, 0x62, 0x64, 0x6C, 0x7D, 0xCE, 0xB6, 0x7F, 0xFF, 0xF7, 0x63, 0x6E, 0x72, 0x73,
@@ -9534,10 +9534,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xB0, 0xCE, 0x7D, 0xCA, 0xE9, 0x64, 0x65, 0x6F, 0x72, 0x75, 0x7E, 0x14, 0x32, 0x7D, 0xB1, 0x20,
     0x7D, 0xB2, 0x22, 0x7D, 0xC5, 0x73, 0x66, 0x61, 0x63, 0x65, 0x69, 0x70, 0x74, 0x7D, 0xB1, 0x0F,
     0x7D, 0xB0, 0xB3, 0x7F, 0xFF, 0xD9, 0x7D, 0xB0, 0xB3, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xEF, 0xED,
-    0x06, 0xF1, 0x61, 0xC3, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x7F,
-    0xFE, 0x67, 0x7F, 0xFE, 0x9F, 0x7D, 0xB0, 0x9A, 0x7F, 0xFF, 0x05, 0x7D, 0xB0, 0x9A, 0x7F, 0xFF,
-    0x27, 0x7F, 0xFF, 0x50, 0x7D, 0xC4, 0x51, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x7B, 0x7F, 0xFF, 0xB7,
-    0x7F, 0xFF, 0xE7, 0x7D, 0xC4, 0x51, 0xE1, 0x06, 0xF1, 0x62, 0x7D, 0xB1, 0x54, 0xE1, 0x06, 0xF1,
+    0x06, 0xF1, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0xC3, 0x7F,
+    0xFE, 0x67, 0x7D, 0xB0, 0x9A, 0x7F, 0xFF, 0x05, 0x7D, 0xB0, 0x9A, 0x7F, 0xFF, 0x27, 0x7F, 0xFF,
+    0x50, 0x7D, 0xC4, 0x51, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x7B, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xE7,
+    0x7D, 0xC4, 0x51, 0x7F, 0xFE, 0x9F, 0xE1, 0x06, 0xF1, 0x62, 0x7D, 0xB1, 0x54, 0xE1, 0x06, 0xF1,
     0x67, 0x7D, 0xB1, 0xDB, 0x69, 0x2E, 0x61, 0x65, 0x68, 0x6B, 0x6C, 0x6E, 0x72, 0x75, 0x7D, 0xC9,
     0x5D, 0x7D, 0xCA, 0x6A, 0x7D, 0xCA, 0x6A, 0x7D, 0xCA, 0x6A, 0x7D, 0xCA, 0x6A, 0x7F, 0xFF, 0xF2,
     0x7F, 0xFF, 0xF9, 0x7D, 0xCA, 0x6A, 0x7D, 0xCA, 0x6A, 0x63, 0xA4, 0xB6, 0xBC, 0x7D, 0xCA, 0x45,
@@ -9724,10 +9724,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFB, 0x7D, 0xCA, 0x9F, 0x7D, 0xCA, 0x9F, 0x7D, 0xA4, 0xF9, 0x7D, 0xA4, 0xF9, 0xE1, 0x05, 0x11,
     0x65, 0x7D, 0xA4, 0xD6, 0x62, 0x65, 0x72, 0x7F, 0xFF, 0xF9, 0x7D, 0xBE, 0xED, 0xE3, 0x06, 0xB1,
     0x6D, 0x72, 0x73, 0x7D, 0xCF, 0xC8, 0x7D, 0xBE, 0xE4, 0x7D, 0xA4, 0xC6, 0xEF, 0x06, 0xF1, 0x61,
-    0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x7F, 0xFE,
-    0x8B, 0x7F, 0xFE, 0xD1, 0x7F, 0xFE, 0xDE, 0x7F, 0xFF, 0x4A, 0x7D, 0xCA, 0x63, 0x7D, 0xA4, 0xBD,
-    0x7F, 0xFF, 0x7E, 0x7F, 0xFF, 0x87, 0x7D, 0xA4, 0xBD, 0x7F, 0xFF, 0x9E, 0x7F, 0xFF, 0xC4, 0x7F,
-    0xFF, 0xE8, 0x7F, 0xFF, 0xF1, 0x7D, 0xBE, 0x20, 0x7D, 0xCA, 0x63, 0x61, 0x64, 0x7D, 0xCE, 0xBF,
+    0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F, 0xFE,
+    0x8B, 0x7F, 0xFE, 0xDE, 0x7F, 0xFF, 0x4A, 0x7D, 0xCA, 0x63, 0x7D, 0xA4, 0xBD, 0x7F, 0xFF, 0x7E,
+    0x7F, 0xFF, 0x87, 0x7D, 0xA4, 0xBD, 0x7F, 0xFF, 0x9E, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xE8, 0x7F,
+    0xFF, 0xF1, 0x7D, 0xBE, 0x20, 0x7D, 0xCA, 0x63, 0x7F, 0xFE, 0xD1, 0x61, 0x64, 0x7D, 0xCE, 0xBF,
     0x62, 0x66, 0x6C, 0x7D, 0xC0, 0xFA, 0x7D, 0xBD, 0xAD, 0x21, 0x72, 0xF7, 0xE1, 0x01, 0x31, 0x72,
     0x7D, 0xC6, 0x78, 0x64, 0x65, 0x6A, 0x6F, 0x73, 0x7F, 0xFF, 0xF6, 0x7D, 0xBE, 0x7B, 0x7F, 0xFF,
     0xF9, 0x7D, 0xBE, 0x7B, 0x62, 0x6C, 0x73, 0x7D, 0xBD, 0x89, 0x7D, 0xBF, 0x82, 0x64, 0x2E, 0x65,
@@ -9785,11 +9785,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xEB, 0x21, 0x65, 0xF9, 0x63, 0x6C, 0x74, 0x76, 0x7F, 0xFF, 0xFD, 0x7D, 0xBA, 0xC6, 0x7D, 0xBA,
     0x2A, 0x63, 0x2E, 0x61, 0x6B, 0x7D, 0xBB, 0xAC, 0x7D, 0xBB, 0x20, 0x7D, 0xBB, 0xAC, 0x77, 0x2E,
     0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
-    0x73, 0xC3, 0x74, 0x75, 0x77, 0x78, 0x7D, 0xBB, 0xEA, 0x7F, 0xFC, 0x7D, 0x7F, 0xFC, 0x95, 0x7F,
+    0x73, 0x74, 0x75, 0x77, 0x78, 0xC3, 0x7D, 0xBB, 0xEA, 0x7F, 0xFC, 0x7D, 0x7F, 0xFC, 0x95, 0x7F,
     0xFC, 0xC0, 0x7F, 0xFC, 0xC5, 0x7F, 0xFD, 0x1E, 0x7F, 0xFD, 0x4B, 0x7F, 0xFD, 0x58, 0x7F, 0xFD,
     0x64, 0x7F, 0xFD, 0x79, 0x7F, 0xFD, 0x82, 0x7F, 0xFD, 0xC5, 0x7F, 0xFE, 0x0F, 0x7F, 0xFE, 0x73,
-    0x7F, 0xFE, 0x94, 0x7F, 0xFE, 0xA1, 0x7F, 0xFE, 0xE1, 0x7F, 0xFF, 0x4B, 0x7F, 0xFF, 0x81, 0x7F,
-    0xFF, 0xBB, 0x7F, 0xFF, 0xE6, 0x7E, 0xF4, 0x9E, 0x7F, 0xFF, 0xF3, 0xE1, 0x02, 0x52, 0x2E, 0x7D,
+    0x7F, 0xFE, 0x94, 0x7F, 0xFE, 0xA1, 0x7F, 0xFE, 0xE1, 0x7F, 0xFF, 0x4B, 0x7F, 0xFF, 0xBB, 0x7F,
+    0xFF, 0xE6, 0x7E, 0xF4, 0x9E, 0x7F, 0xFF, 0xF3, 0x7F, 0xFF, 0x81, 0xE1, 0x02, 0x52, 0x2E, 0x7D,
     0xA0, 0x34, 0x63, 0x61, 0x65, 0x69, 0x7D, 0xA1, 0x2F, 0x7F, 0xFF, 0xF9, 0x7D, 0xA8, 0x7C, 0x62,
     0x72, 0x73, 0x7F, 0xFF, 0xF3, 0x7D, 0xA6, 0x9A, 0x63, 0x61, 0xC3, 0x6F, 0x7D, 0xB9, 0x8C, 0x7D,
     0xCE, 0x0C, 0x7D, 0xB9, 0x8C, 0xE1, 0x06, 0xC1, 0x69, 0x7D, 0xC4, 0x6E, 0x63, 0x61, 0x69, 0x74,
@@ -9812,11 +9812,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0x61, 0x7D, 0xC3, 0xC2, 0x62, 0x6C, 0x73, 0x7D, 0x9E, 0xF4, 0x7D, 0xA0, 0x55, 0x65, 0x62,
     0x65, 0x6E, 0x72, 0x73, 0x7D, 0xCA, 0x57, 0x7F, 0xFF, 0xF7, 0x7D, 0x9F, 0x55, 0x7D, 0xA6, 0x2F,
     0x7E, 0x58, 0x2D, 0xE2, 0x06, 0xC1, 0x62, 0x63, 0x7D, 0x9F, 0x40, 0x7F, 0x45, 0xE8, 0xE2, 0x02,
-    0x61, 0x65, 0x72, 0x7F, 0xFF, 0xF5, 0x7D, 0xB9, 0xDF, 0xEE, 0x06, 0xF2, 0x61, 0xC3, 0x63, 0x65,
-    0x67, 0x68, 0x69, 0x6B, 0x6E, 0x6F, 0x74, 0x75, 0x79, 0x7A, 0x7F, 0xFF, 0x14, 0x7F, 0xFF, 0x40,
-    0x7D, 0xBE, 0x2A, 0x7F, 0xFF, 0x7E, 0x7D, 0x9F, 0x30, 0x7F, 0xFF, 0x9B, 0x7F, 0xFF, 0xB4, 0x7D,
-    0x9F, 0x30, 0x7F, 0xFF, 0xC7, 0x7F, 0xFF, 0xD5, 0x7E, 0x46, 0x67, 0x7F, 0xFF, 0xF5, 0x7D, 0xB7,
-    0x21, 0x7D, 0x9F, 0x30, 0xE1, 0x02, 0x61, 0x68, 0x7D, 0xD5, 0x8C, 0x67, 0x61, 0x62, 0x66, 0x67,
+    0x61, 0x65, 0x72, 0x7F, 0xFF, 0xF5, 0x7D, 0xB9, 0xDF, 0xEE, 0x06, 0xF2, 0x61, 0x63, 0x65, 0x67,
+    0x68, 0x69, 0x6B, 0x6E, 0x6F, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F, 0xFF, 0x14, 0x7D, 0xBE, 0x2A,
+    0x7F, 0xFF, 0x7E, 0x7D, 0x9F, 0x30, 0x7F, 0xFF, 0x9B, 0x7F, 0xFF, 0xB4, 0x7D, 0x9F, 0x30, 0x7F,
+    0xFF, 0xC7, 0x7F, 0xFF, 0xD5, 0x7E, 0x46, 0x67, 0x7F, 0xFF, 0xF5, 0x7D, 0xB7, 0x21, 0x7D, 0x9F,
+    0x30, 0x7F, 0xFF, 0x40, 0xE1, 0x02, 0x61, 0x68, 0x7D, 0xD5, 0x8C, 0x67, 0x61, 0x62, 0x66, 0x67,
     0x70, 0x74, 0x7A, 0x7D, 0xB9, 0x06, 0x7D, 0xB9, 0x92, 0x7D, 0xB9, 0x92, 0x7E, 0x52, 0xCC, 0x7D,
     0xB9, 0x92, 0x7D, 0xBA, 0x7E, 0x7D, 0xBA, 0x7E, 0x66, 0x2E, 0x65, 0x67, 0x6D, 0x6E, 0x73, 0x7E,
     0x22, 0x0E, 0x7E, 0xC8, 0x93, 0x7D, 0x9E, 0x9A, 0x7D, 0x9E, 0x9A, 0x7D, 0x9E, 0x9A, 0x7D, 0xA3,
@@ -9849,9 +9849,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xA2, 0x62, 0x7D, 0x9E, 0x07, 0xE2, 0x00, 0x81, 0x6C, 0x6E, 0x7D, 0xC1, 0x2C, 0x7F, 0xFF, 0xF7,
     0x62, 0x69, 0x70, 0x7D, 0x9C, 0x9F, 0x7D, 0xB6, 0x3D, 0xE1, 0x00, 0x81, 0x61, 0x7D, 0x9C, 0x96,
     0x61, 0xB6, 0x7D, 0x9C, 0x92, 0x61, 0x74, 0x7D, 0xAE, 0x97, 0x6D, 0x62, 0x66, 0x68, 0x69, 0x6C,
-    0x6E, 0x6F, 0xC3, 0x72, 0x73, 0x74, 0x77, 0x7A, 0x7F, 0xFF, 0xEF, 0x7D, 0x9C, 0x88, 0x7D, 0xC4,
-    0xE6, 0x7D, 0xB7, 0x93, 0x7D, 0x9C, 0x88, 0x7D, 0xB6, 0x23, 0x7D, 0xB9, 0xD3, 0x7F, 0xFF, 0xF6,
-    0x7D, 0x9C, 0x88, 0x7F, 0xFF, 0xFB, 0x7D, 0x9C, 0x88, 0x7D, 0x9C, 0x88, 0x7D, 0xB6, 0x6A, 0xE1,
+    0x6E, 0x6F, 0x72, 0x73, 0x74, 0x77, 0x7A, 0xC3, 0x7F, 0xFF, 0xEF, 0x7D, 0x9C, 0x88, 0x7D, 0xC4,
+    0xE6, 0x7D, 0xB7, 0x93, 0x7D, 0x9C, 0x88, 0x7D, 0xB6, 0x23, 0x7D, 0xB9, 0xD3, 0x7D, 0x9C, 0x88,
+    0x7F, 0xFF, 0xFB, 0x7D, 0x9C, 0x88, 0x7D, 0x9C, 0x88, 0x7D, 0xB6, 0x6A, 0x7F, 0xFF, 0xF6, 0xE1,
     0x05, 0x11, 0x73, 0x7D, 0xB6, 0x35, 0x68, 0x69, 0x6D, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x7F,
     0xFF, 0x9F, 0x7F, 0xFF, 0xAA, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xF9, 0x7D, 0xC9, 0xF1, 0x7D, 0xB5,
     0xC8, 0x7D, 0xC9, 0x6E, 0x7D, 0xB5, 0xE7, 0xE1, 0x01, 0x31, 0x67, 0x7D, 0x9C, 0x28, 0x63, 0x65,
@@ -9864,11 +9864,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x79, 0x7F, 0xFE, 0xEA, 0x7F, 0xFF, 0x0C, 0x7F, 0xFF, 0x7F, 0x7F, 0xB4, 0x59, 0x7F, 0xFF, 0xA7,
     0x7F, 0xFF, 0xB4, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xF1, 0x7D, 0xB5, 0x3A, 0x62, 0x66, 0x77, 0x7D,
     0xB6, 0xB1, 0x7D, 0xB6, 0x25, 0x62, 0x69, 0x6D, 0x7D, 0x9B, 0x97, 0x7F, 0xFF, 0xF7, 0x61, 0x69,
-    0x7D, 0xC1, 0xC5, 0xF2, 0x06, 0xF2, 0x61, 0xC3, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x70, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0x7F, 0xFD, 0x3E, 0x7F, 0xFD, 0x6B, 0x7F, 0xFD,
-    0xAD, 0x7F, 0xFD, 0xF0, 0x7F, 0xFE, 0x25, 0x7F, 0xFE, 0x32, 0x7F, 0xFE, 0x44, 0x7F, 0xFE, 0x5D,
-    0x7F, 0xB2, 0xB3, 0x7F, 0xFE, 0x6B, 0x7F, 0xFE, 0x6E, 0x7F, 0xFE, 0x84, 0x7D, 0xC1, 0x9C, 0x7F,
-    0xFF, 0xC4, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7E, 0x55, 0xC6, 0x7F, 0xFF, 0xFB, 0x62, 0x65,
+    0x7D, 0xC1, 0xC5, 0xF2, 0x06, 0xF2, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0xC3, 0x7F, 0xFD, 0x3E, 0x7F, 0xFD, 0xAD, 0x7F, 0xFD,
+    0xF0, 0x7F, 0xFE, 0x25, 0x7F, 0xFE, 0x32, 0x7F, 0xFE, 0x44, 0x7F, 0xFE, 0x5D, 0x7F, 0xB2, 0xB3,
+    0x7F, 0xFE, 0x6B, 0x7F, 0xFE, 0x6E, 0x7F, 0xFE, 0x84, 0x7D, 0xC1, 0x9C, 0x7F, 0xFF, 0xC4, 0x7F,
+    0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7E, 0x55, 0xC6, 0x7F, 0xFF, 0xFB, 0x7F, 0xFD, 0x6B, 0x62, 0x65,
     0x6F, 0x7F, 0x8C, 0xD0, 0x7D, 0xB7, 0x3B, 0x62, 0x68, 0x74, 0x7D, 0xB5, 0xBA, 0x7D, 0xB8, 0x23,
     0x62, 0x61, 0x65, 0x7D, 0xB5, 0xB1, 0x7E, 0xC9, 0x13, 0x61, 0x73, 0x7E, 0x14, 0x2A, 0x21, 0x65,
     0xFB, 0x63, 0x61, 0x72, 0x74, 0x7D, 0xB5, 0xA0, 0x7D, 0xB5, 0xA0, 0x7F, 0xFF, 0xFD, 0x62, 0x6C,
@@ -9924,10 +9924,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6C, 0x73, 0x7D, 0x9A, 0x41, 0x7D, 0xB3, 0xFB, 0x7D, 0xB3, 0xFB, 0x68, 0x65, 0x68, 0x6D, 0x6E,
     0x70, 0x72, 0x73, 0x74, 0x7D, 0xE1, 0x12, 0x7D, 0xB2, 0x76, 0x7E, 0x41, 0xE7, 0x7F, 0xFF, 0xEA,
     0x7D, 0xC3, 0x5A, 0x7F, 0xFF, 0xF3, 0x7D, 0x9C, 0xB2, 0x7D, 0xBC, 0x88, 0xED, 0x06, 0xF1, 0x61,
-    0xC3, 0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0x7F, 0xFD, 0x1C, 0x7F,
-    0xFD, 0x67, 0x7F, 0xFE, 0x5A, 0x7F, 0xFE, 0xB1, 0x7F, 0xFE, 0xDD, 0x7F, 0xFF, 0x1D, 0x7F, 0xFF,
-    0x78, 0x7F, 0xFF, 0xAC, 0x7D, 0x98, 0x3D, 0x7F, 0xFF, 0xDF, 0x7E, 0xCA, 0xA3, 0x7D, 0xE5, 0x9B,
-    0x7D, 0x98, 0x3D, 0xE1, 0x07, 0xA1, 0x72, 0x7E, 0x25, 0x32, 0xE1, 0x00, 0x91, 0x6E, 0x7E, 0xEA,
+    0x65, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0xC3, 0x7F, 0xFD, 0x1C, 0x7F,
+    0xFE, 0x5A, 0x7F, 0xFE, 0xB1, 0x7F, 0xFE, 0xDD, 0x7F, 0xFF, 0x1D, 0x7F, 0xFF, 0x78, 0x7F, 0xFF,
+    0xAC, 0x7D, 0x98, 0x3D, 0x7F, 0xFF, 0xDF, 0x7E, 0xCA, 0xA3, 0x7D, 0xE5, 0x9B, 0x7D, 0x98, 0x3D,
+    0x7F, 0xFD, 0x67, 0xE1, 0x07, 0xA1, 0x72, 0x7E, 0x25, 0x32, 0xE1, 0x00, 0x91, 0x6E, 0x7E, 0xEA,
     0xC9, 0x21, 0x65, 0xF9, 0xA0, 0x30, 0x33, 0x21, 0x72, 0xFD, 0x63, 0x65, 0x6F, 0x73, 0x7D, 0x9A,
     0xE8, 0x7E, 0x14, 0x47, 0x7D, 0x99, 0x24, 0x63, 0x61, 0x65, 0x74, 0x7D, 0x97, 0xDC, 0x7F, 0xFF,
     0xF0, 0x7F, 0xFF, 0xF3, 0x61, 0xB6, 0x7D, 0xC0, 0x50, 0x62, 0x6F, 0xC3, 0x7D, 0xE0, 0x05, 0x7F,
@@ -9974,10 +9974,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xE1, 0x22, 0x22, 0x66, 0x7D, 0x96, 0xA1, 0x65, 0x61, 0x65, 0x6F, 0x72, 0x73, 0x7F, 0xFF, 0xD5,
     0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF9, 0x7D, 0xAE, 0x83, 0x7E, 0x50, 0x8D, 0xE1, 0x06, 0xF1, 0x77,
     0x7D, 0xAE, 0x38, 0x72, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E,
-    0x70, 0x72, 0x73, 0xC3, 0x74, 0x7A, 0x7F, 0xFD, 0x20, 0x7F, 0xFD, 0x2E, 0x7F, 0xFD, 0x81, 0x7F,
+    0x70, 0x72, 0x73, 0x74, 0x7A, 0xC3, 0x7F, 0xFD, 0x20, 0x7F, 0xFD, 0x2E, 0x7F, 0xFD, 0x81, 0x7F,
     0xFD, 0x8F, 0x7F, 0xFD, 0xB2, 0x7F, 0xFD, 0xCF, 0x7F, 0xFD, 0xEE, 0x7F, 0xFD, 0xFF, 0x7F, 0xFE,
     0x13, 0x7F, 0xFE, 0x1C, 0x7F, 0xFE, 0x41, 0x7F, 0xFF, 0x33, 0x7F, 0xFF, 0x70, 0x7F, 0xFF, 0x81,
-    0x7F, 0xFF, 0xAA, 0x7E, 0x88, 0x2D, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF, 0xF9, 0x62, 0x65, 0x74, 0x7D,
+    0x7F, 0xFF, 0xAA, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF, 0xF9, 0x7E, 0x88, 0x2D, 0x62, 0x65, 0x74, 0x7D,
     0x94, 0xD7, 0x7E, 0xB5, 0xDE, 0x63, 0x61, 0x6E, 0x73, 0x7D, 0x94, 0x64, 0x7F, 0xFF, 0xF7, 0x7D,
     0x94, 0x64, 0xE2, 0x06, 0xF1, 0x65, 0x6F, 0x7F, 0xFF, 0xF3, 0x7D, 0xAD, 0xD2, 0x62, 0x67, 0x69,
     0x7E, 0x12, 0xAB, 0x7E, 0x3B, 0x3F, 0x61, 0x66, 0x7D, 0x94, 0xFC, 0x62, 0x2E, 0x6C, 0x7D, 0xAD,
@@ -10008,14 +10008,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x73, 0x7D, 0xB7, 0x43, 0x7D, 0xAC, 0x5F, 0x64, 0x61, 0x65, 0x69, 0x6F, 0x7D, 0xB7, 0xCC, 0x7F,
     0xFF, 0xEA, 0x7F, 0xFF, 0xF7, 0x7D, 0xAC, 0x2A, 0xC9, 0x06, 0xF1, 0x61, 0x62, 0x65, 0x69, 0x6B,
     0x6F, 0x74, 0x75, 0x77, 0xFE, 0xA3, 0xFE, 0xD4, 0xFF, 0x68, 0xFF, 0x9E, 0xFF, 0xAB, 0xFF, 0xB5,
-    0xFF, 0xC7, 0xFF, 0xD0, 0xFF, 0xEF, 0x7B, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
-    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
-    0x79, 0x7A, 0x7F, 0xCF, 0x6A, 0x7F, 0xD1, 0x1E, 0x7F, 0xD2, 0x93, 0x7F, 0xD3, 0x47, 0x7F, 0xD5,
-    0xA0, 0x7F, 0xDF, 0x44, 0x7F, 0xE0, 0x3F, 0x7F, 0xE2, 0x59, 0x7F, 0xE3, 0x0E, 0x7F, 0xE7, 0x76,
-    0x7D, 0xAD, 0x08, 0x7F, 0xE9, 0x65, 0x7F, 0xEA, 0x2C, 0x7F, 0xEC, 0x24, 0x7F, 0xEE, 0x36, 0x7F,
-    0xF1, 0xF8, 0x7F, 0xF2, 0x93, 0x7D, 0xAD, 0x08, 0x7F, 0xF3, 0xC3, 0x7F, 0xF6, 0xFD, 0x7F, 0xFA,
-    0xB6, 0x7F, 0xFD, 0xCD, 0x7F, 0xFE, 0x2C, 0x7F, 0xFE, 0x4E, 0x7D, 0xB1, 0x6B, 0x7F, 0xFE, 0x5F,
-    0x7F, 0xFF, 0xE2, 0xE1, 0x0C, 0xE2, 0x74, 0x7E, 0x00, 0x52, 0x61, 0x74, 0x7D, 0xB8, 0x99, 0x21,
+    0xFF, 0xC7, 0xFF, 0xD0, 0xFF, 0xEF, 0x7B, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7A, 0xC3, 0x7F, 0xCF, 0x6A, 0x7F, 0xD2, 0x93, 0x7F, 0xD3, 0x47, 0x7F, 0xD5, 0xA0, 0x7F, 0xDF,
+    0x44, 0x7F, 0xE0, 0x3F, 0x7F, 0xE2, 0x59, 0x7F, 0xE3, 0x0E, 0x7F, 0xE7, 0x76, 0x7D, 0xAD, 0x08,
+    0x7F, 0xE9, 0x65, 0x7F, 0xEA, 0x2C, 0x7F, 0xEC, 0x24, 0x7F, 0xEE, 0x36, 0x7F, 0xF1, 0xF8, 0x7F,
+    0xF2, 0x93, 0x7D, 0xAD, 0x08, 0x7F, 0xF3, 0xC3, 0x7F, 0xF6, 0xFD, 0x7F, 0xFA, 0xB6, 0x7F, 0xFD,
+    0xCD, 0x7F, 0xFE, 0x2C, 0x7F, 0xFE, 0x4E, 0x7D, 0xB1, 0x6B, 0x7F, 0xFE, 0x5F, 0x7F, 0xFF, 0xE2,
+    0x7F, 0xD1, 0x1E, 0xE1, 0x0C, 0xE2, 0x74, 0x7E, 0x00, 0x52, 0x61, 0x74, 0x7D, 0xB8, 0x99, 0x21,
     0x61, 0xFB, 0x64, 0x6C, 0x6E, 0x72, 0x74, 0x7D, 0xAC, 0x28, 0x7D, 0xAB, 0xAB, 0x7D, 0x9D, 0x47,
     0x7D, 0xAC, 0x28, 0x61, 0x74, 0x7D, 0xB4, 0x71, 0x62, 0x2E, 0x72, 0x7D, 0xAB, 0x95, 0x7D, 0xAB,
     0xD9, 0xE2, 0x06, 0xC1, 0x75, 0xC3, 0x7D, 0xB4, 0x3E, 0x7D, 0x99, 0xAB, 0xE9, 0x06, 0xF2, 0xC3,
@@ -10055,10 +10055,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xF1, 0x6C, 0x7D, 0xAB, 0x68, 0xE1, 0x00, 0x91, 0x68, 0x7D, 0xAB, 0x5E, 0xE1, 0x07, 0x71, 0x63,
     0x7D, 0x8F, 0xBD, 0x62, 0x6B, 0x74, 0x7D, 0x92, 0x81, 0x7D, 0x91, 0x0A, 0x64, 0x69, 0x6F, 0x72,
     0x73, 0x7D, 0x90, 0x1A, 0x7D, 0x90, 0x1A, 0x7D, 0xE4, 0xC2, 0x7F, 0xFF, 0xF7, 0x6F, 0x2E, 0x61,
-    0xC3, 0x62, 0x65, 0x66, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0x7D, 0xA9, 0xBD,
-    0x7F, 0xFF, 0xB1, 0x7D, 0xBD, 0x97, 0x7D, 0xFA, 0x04, 0x7F, 0xFF, 0xBE, 0x7D, 0xA9, 0xBD, 0x7D,
-    0xB5, 0xD6, 0x7D, 0xA9, 0xBD, 0x7F, 0xFF, 0xD1, 0x7D, 0xAA, 0xDF, 0x7D, 0xA9, 0x9E, 0x7F, 0xFF,
-    0xD8, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xEF, 0x7D, 0xA9, 0xBD, 0x64, 0x65, 0x6C, 0x6E, 0x74, 0x7D,
+    0x62, 0x65, 0x66, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xC3, 0x7D, 0xA9, 0xBD,
+    0x7F, 0xFF, 0xB1, 0x7D, 0xFA, 0x04, 0x7F, 0xFF, 0xBE, 0x7D, 0xA9, 0xBD, 0x7D, 0xB5, 0xD6, 0x7D,
+    0xA9, 0xBD, 0x7F, 0xFF, 0xD1, 0x7D, 0xAA, 0xDF, 0x7D, 0xA9, 0x9E, 0x7F, 0xFF, 0xD8, 0x7F, 0xFF,
+    0xDF, 0x7F, 0xFF, 0xEF, 0x7D, 0xA9, 0xBD, 0x7D, 0xBD, 0x97, 0x64, 0x65, 0x6C, 0x6E, 0x74, 0x7D,
     0xA9, 0x03, 0x7D, 0xAA, 0xF9, 0x7D, 0xA9, 0x03, 0x7E, 0x23, 0xD9, 0x63, 0x62, 0x6E, 0x72, 0x7D,
     0x8F, 0xBB, 0x7D, 0x8F, 0xBB, 0x7D, 0x90, 0x24, 0x62, 0x72, 0x75, 0x7D, 0x94, 0xBA, 0x7D, 0xB5,
     0xB9, 0x62, 0x62, 0x74, 0x7D, 0x8F, 0xA5, 0x7D, 0x8F, 0xA5, 0x62, 0x65, 0x69, 0x7D, 0x8F, 0x9C,
@@ -10067,11 +10067,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0xC3, 0x7D, 0xA9, 0xDD, 0x7E, 0x47, 0x9D, 0x64, 0x65, 0x6C, 0x75, 0xC3, 0x7F, 0x2B, 0x87,
     0x7D, 0x8F, 0x3A, 0x7D, 0xAA, 0x9B, 0x7E, 0x11, 0xFC, 0xE1, 0x02, 0x61, 0x75, 0x7D, 0xAA, 0x04,
     0xE2, 0x20, 0x13, 0x2E, 0x70, 0x7D, 0xA9, 0xFD, 0x7D, 0x8E, 0xEF, 0x62, 0x72, 0x77, 0x7D, 0xA9,
-    0xB1, 0x7D, 0xA9, 0xB1, 0x70, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C,
-    0x6D, 0x6F, 0x73, 0x74, 0x77, 0x7F, 0xFF, 0x76, 0x7D, 0xBC, 0xD0, 0x7D, 0xF3, 0x1E, 0x7D, 0x8F,
-    0x45, 0x7F, 0xFF, 0xB2, 0x7D, 0xB9, 0x00, 0x7F, 0xFF, 0xCB, 0x7D, 0xC0, 0x00, 0x7D, 0xAF, 0x7E,
-    0x7F, 0xFF, 0xD4, 0x7D, 0xA9, 0x5A, 0x7F, 0xFF, 0xE5, 0x7D, 0xEE, 0x13, 0x7F, 0xFF, 0xEC, 0x7F,
-    0xFF, 0xF7, 0x7D, 0xA9, 0x5A, 0xE6, 0x06, 0xB1, 0x65, 0x66, 0x69, 0x6F, 0x70, 0x72, 0x7D, 0xA8,
+    0xB1, 0x7D, 0xA9, 0xB1, 0x70, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D,
+    0x6F, 0x73, 0x74, 0x77, 0xC3, 0x7F, 0xFF, 0x76, 0x7D, 0xF3, 0x1E, 0x7D, 0x8F, 0x45, 0x7F, 0xFF,
+    0xB2, 0x7D, 0xB9, 0x00, 0x7F, 0xFF, 0xCB, 0x7D, 0xC0, 0x00, 0x7D, 0xAF, 0x7E, 0x7F, 0xFF, 0xD4,
+    0x7D, 0xA9, 0x5A, 0x7F, 0xFF, 0xE5, 0x7D, 0xEE, 0x13, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF7, 0x7D,
+    0xA9, 0x5A, 0x7D, 0xBC, 0xD0, 0xE6, 0x06, 0xB1, 0x65, 0x66, 0x69, 0x6F, 0x70, 0x72, 0x7D, 0xA8,
     0x0F, 0x7D, 0xA9, 0x19, 0x7D, 0x8E, 0xFE, 0x7D, 0xAF, 0x5D, 0x7D, 0xAC, 0x70, 0x7D, 0xA8, 0x0C,
     0x65, 0x2E, 0x65, 0x6C, 0x73, 0x75, 0x7D, 0xA8, 0x9A, 0x7D, 0xA9, 0x8D, 0x7D, 0x8E, 0xE6, 0x7D,
     0xA9, 0x8D, 0x7D, 0xA9, 0x4C, 0x61, 0x74, 0x7D, 0xA9, 0xF8, 0xE1, 0x06, 0xF1, 0x73, 0x7D, 0x8F,
@@ -10094,14 +10094,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xF3, 0x7F, 0x00, 0x74, 0xE1, 0x08, 0x32, 0x61, 0x7D, 0xE0, 0x9A, 0xE1, 0x02, 0xA1, 0x65, 0x7D,
     0x8D, 0x8A, 0xE2, 0x02, 0xF1, 0x61, 0x69, 0x7D, 0xA8, 0xE1, 0x7F, 0xFF, 0xF9, 0xE1, 0x07, 0xC2,
     0x65, 0x7D, 0xDB, 0xA4, 0x62, 0x61, 0x72, 0x7E, 0x32, 0x26, 0x7D, 0xB3, 0xAD, 0x70, 0x62, 0x64,
-    0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0xC3, 0x77, 0x7A, 0x7D, 0xA8,
+    0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3, 0x7D, 0xA8,
     0xC6, 0x7D, 0xA7, 0xFF, 0x7E, 0x4E, 0x80, 0x7D, 0xA8, 0xC6, 0x7D, 0xA8, 0xC6, 0x7D, 0xA8, 0xC6,
     0x7D, 0xA8, 0xC6, 0x7D, 0xA8, 0xC6, 0x7D, 0xA6, 0xB1, 0x7D, 0xA8, 0xC6, 0x7F, 0xFF, 0xF0, 0x7F,
-    0xFF, 0xF7, 0x7D, 0xA6, 0xB1, 0x7D, 0xF0, 0x48, 0x7D, 0xA8, 0xC6, 0x7D, 0xA8, 0xC6, 0x61, 0x69,
+    0xFF, 0xF7, 0x7D, 0xA6, 0xB1, 0x7D, 0xA8, 0xC6, 0x7D, 0xA8, 0xC6, 0x7D, 0xF0, 0x48, 0x61, 0x69,
     0x7D, 0x8F, 0xE2, 0x21, 0x72, 0xFB, 0x21, 0x6F, 0xFD, 0x6D, 0x2E, 0x63, 0x65, 0x66, 0x67, 0x69,
-    0x6B, 0x6D, 0x6E, 0x72, 0x73, 0xC3, 0x74, 0x7D, 0xA6, 0x58, 0x7D, 0xA8, 0x77, 0x7F, 0xFF, 0x5B,
+    0x6B, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0xC3, 0x7D, 0xA6, 0x58, 0x7D, 0xA8, 0x77, 0x7F, 0xFF, 0x5B,
     0x7F, 0xFF, 0x60, 0x7F, 0xFF, 0x7E, 0x7D, 0x8D, 0x50, 0x7D, 0xA8, 0x23, 0x7D, 0xA8, 0x77, 0x7F,
-    0xFF, 0x8B, 0x7F, 0xFF, 0x99, 0x7F, 0xFF, 0xB4, 0x7F, 0x45, 0xF3, 0x7F, 0xFF, 0xFD, 0x62, 0x69,
+    0xFF, 0x8B, 0x7F, 0xFF, 0x99, 0x7F, 0xFF, 0xB4, 0x7F, 0xFF, 0xFD, 0x7F, 0x45, 0xF3, 0x62, 0x69,
     0x6F, 0x7D, 0xEB, 0xE9, 0x7D, 0xA7, 0xBF, 0xF5, 0x07, 0xB1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
     0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x78, 0x79, 0x7F,
     0xFA, 0x8C, 0x7F, 0xFA, 0xC5, 0x7F, 0xFB, 0x0C, 0x7F, 0xFB, 0x1D, 0x7F, 0xFB, 0x56, 0x7F, 0xFB,
@@ -10186,14 +10186,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x80, 0x7E, 0x1D, 0x64, 0x7F, 0xFF, 0xF7, 0x7D, 0xA1, 0xC3, 0x63, 0x61, 0x68, 0x73, 0x7D, 0xA2,
     0x62, 0x7D, 0xA2, 0x62, 0x7D, 0xA2, 0x62, 0x61, 0xA4, 0x7F, 0x58, 0xBB, 0x63, 0x63, 0x67, 0x74,
     0x7D, 0xA2, 0x50, 0x7D, 0xA2, 0x50, 0x7D, 0xA2, 0x50, 0xE4, 0x01, 0x31, 0x61, 0xC3, 0x65, 0x69,
-    0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF3, 0x7D, 0xC0, 0xC3, 0x7A, 0x2E, 0x61, 0xC3,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x7A, 0x7F, 0xFC, 0x86, 0x7F, 0xFC, 0xE4, 0x7F, 0xFD, 0x31,
-    0x7D, 0xA1, 0xE2, 0x7D, 0xA1, 0xE2, 0x7D, 0xA1, 0xE2, 0x7F, 0xFD, 0xB5, 0x7D, 0xA1, 0xE2, 0x7D,
-    0xA1, 0xE2, 0x7D, 0xA1, 0xE2, 0x7F, 0xFD, 0xEE, 0x7D, 0xA1, 0xE2, 0x7D, 0xA1, 0xE2, 0x7F, 0xFE,
-    0x42, 0x7F, 0xFE, 0x9F, 0x7F, 0xFE, 0xC6, 0x7F, 0xFF, 0x01, 0x7D, 0xA1, 0xE2, 0x7D, 0xA1, 0xE2,
-    0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xBB, 0x7D, 0xA1, 0xE2, 0x7F,
-    0xFF, 0xED, 0x7D, 0xA1, 0xE2, 0x62, 0x70, 0x73, 0x7D, 0xA1, 0xC7, 0x7D, 0xA1, 0xC7, 0x66, 0x61,
+    0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF3, 0x7D, 0xC0, 0xC3, 0x7A, 0x2E, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x7A, 0xC3, 0x7F, 0xFC, 0x86, 0x7F, 0xFC, 0xE4, 0x7D, 0xA1, 0xE2,
+    0x7D, 0xA1, 0xE2, 0x7D, 0xA1, 0xE2, 0x7F, 0xFD, 0xB5, 0x7D, 0xA1, 0xE2, 0x7D, 0xA1, 0xE2, 0x7D,
+    0xA1, 0xE2, 0x7F, 0xFD, 0xEE, 0x7D, 0xA1, 0xE2, 0x7D, 0xA1, 0xE2, 0x7F, 0xFE, 0x42, 0x7F, 0xFE,
+    0x9F, 0x7F, 0xFE, 0xC6, 0x7F, 0xFF, 0x01, 0x7D, 0xA1, 0xE2, 0x7D, 0xA1, 0xE2, 0x7F, 0xFF, 0x72,
+    0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xBB, 0x7D, 0xA1, 0xE2, 0x7F, 0xFF, 0xED, 0x7D,
+    0xA1, 0xE2, 0x7F, 0xFD, 0x31, 0x62, 0x70, 0x73, 0x7D, 0xA1, 0xC7, 0x7D, 0xA1, 0xC7, 0x66, 0x61,
     0x63, 0x64, 0x6D, 0x6E, 0x75, 0x7D, 0xA1, 0x70, 0x7D, 0xA1, 0x70, 0x7D, 0xA1, 0x70, 0x7D, 0xA1,
     0x70, 0x7D, 0xA1, 0x70, 0x7F, 0xFF, 0xF7, 0x62, 0x65, 0x69, 0x7D, 0x86, 0xD5, 0x7D, 0xA0, 0x4A,
     0xEB, 0x07, 0xB1, 0x2E, 0x61, 0x65, 0x68, 0x6A, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0x7D, 0xA1,
@@ -10255,10 +10255,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x6C, 0x6F, 0x7D, 0x83, 0x4F, 0x7D, 0x83, 0x4F, 0x62, 0x65, 0x69, 0x7D, 0x8A, 0xB7, 0x7D,
     0x83, 0x46, 0xE3, 0x0C, 0xE2, 0x6B, 0x74, 0x7A, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7D, 0x83,
     0x37, 0x61, 0x78, 0x7D, 0x83, 0x64, 0x21, 0x65, 0xFB, 0x61, 0xBC, 0x7D, 0x9C, 0x9B, 0x6E, 0x2E,
-    0x61, 0x62, 0x64, 0x65, 0x66, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0xC3, 0x7A, 0x7D, 0x9C, 0x93,
+    0x61, 0x62, 0x64, 0x65, 0x66, 0x69, 0x6B, 0x6E, 0x6F, 0x73, 0x74, 0x7A, 0xC3, 0x7D, 0x9C, 0x93,
     0x7F, 0xFF, 0x38, 0x7F, 0xFF, 0x55, 0x7D, 0x84, 0xE3, 0x7F, 0xFF, 0x8E, 0x7F, 0xFF, 0xAF, 0x7F,
     0xFF, 0xC9, 0x7D, 0x83, 0x1E, 0x7D, 0xAC, 0x53, 0x7D, 0xC4, 0x51, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF,
-    0xF8, 0x7F, 0xFF, 0xFB, 0x7D, 0x83, 0x1E, 0x61, 0x67, 0x7D, 0xE6, 0x9C, 0x62, 0x69, 0x70, 0x7F,
+    0xF8, 0x7D, 0x83, 0x1E, 0x7F, 0xFF, 0xFB, 0x61, 0x67, 0x7D, 0xE6, 0x9C, 0x62, 0x69, 0x70, 0x7F,
     0xFF, 0xFB, 0x7D, 0x9E, 0x20, 0xE1, 0x00, 0x41, 0x2E, 0x7D, 0xBC, 0x3D, 0x65, 0x62, 0x67, 0x68,
     0x72, 0x75, 0x7D, 0x83, 0x06, 0x7D, 0xEA, 0xAC, 0x7D, 0x9C, 0x71, 0x7D, 0x83, 0x06, 0x7F, 0xFF,
     0xF9, 0x62, 0x6C, 0x72, 0x7D, 0x9E, 0x55, 0x7E, 0x34, 0x35, 0x21, 0x65, 0xF7, 0x62, 0x64, 0x65,
@@ -10278,11 +10278,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x86, 0x75, 0x6A, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6E, 0x72, 0x73, 0x77, 0x7A, 0x7D, 0x9D,
     0x70, 0x7F, 0xFF, 0xFB, 0x7D, 0x9D, 0x70, 0x7D, 0x9D, 0x70, 0x7E, 0x0B, 0x84, 0x7D, 0x9D, 0x70,
     0x7E, 0xDC, 0xFB, 0x7D, 0x9D, 0x70, 0x7D, 0x9C, 0xA9, 0x7D, 0x9C, 0xA9, 0x62, 0x75, 0x79, 0x7D,
-    0x82, 0x63, 0x7D, 0xB7, 0xF2, 0x6F, 0x2E, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B,
-    0x6F, 0x73, 0x74, 0x75, 0x7A, 0x7D, 0x9C, 0xB8, 0x7F, 0xFE, 0xD7, 0x7D, 0xAF, 0x9F, 0x7F, 0xFE,
-    0xF5, 0x7F, 0xFF, 0x1A, 0x7F, 0xFF, 0x3F, 0x7F, 0xFF, 0x46, 0x7F, 0xFF, 0x54, 0x7F, 0xFF, 0x57,
-    0x7F, 0xFF, 0x70, 0x7F, 0xFF, 0x7D, 0x7F, 0xFF, 0xAC, 0x7F, 0xFF, 0xCE, 0x7D, 0xA2, 0xD4, 0x7F,
-    0xFF, 0xF7, 0x64, 0x62, 0x66, 0x68, 0x72, 0x7D, 0x81, 0xD7, 0x7D, 0x9B, 0xEF, 0x7D, 0x9B, 0xEF,
+    0x82, 0x63, 0x7D, 0xB7, 0xF2, 0x6F, 0x2E, 0x61, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6F,
+    0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7D, 0x9C, 0xB8, 0x7F, 0xFE, 0xD7, 0x7F, 0xFE, 0xF5, 0x7F, 0xFF,
+    0x1A, 0x7F, 0xFF, 0x3F, 0x7F, 0xFF, 0x46, 0x7F, 0xFF, 0x54, 0x7F, 0xFF, 0x57, 0x7F, 0xFF, 0x70,
+    0x7F, 0xFF, 0x7D, 0x7F, 0xFF, 0xAC, 0x7F, 0xFF, 0xCE, 0x7D, 0xA2, 0xD4, 0x7F, 0xFF, 0xF7, 0x7D,
+    0xAF, 0x9F, 0x64, 0x62, 0x66, 0x68, 0x72, 0x7D, 0x81, 0xD7, 0x7D, 0x9B, 0xEF, 0x7D, 0x9B, 0xEF,
     0x7D, 0x81, 0xD7, 0x62, 0x73, 0x74, 0x7D, 0x9A, 0xDB, 0x7D, 0x9A, 0xFA, 0x63, 0x65, 0x66, 0x69,
     0x7D, 0xA7, 0x87, 0x7D, 0xA7, 0x63, 0x7F, 0xFF, 0xF7, 0x62, 0x64, 0x7A, 0x7D, 0x9C, 0x71, 0x7D,
     0x81, 0x46, 0x6A, 0x2E, 0x64, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x74, 0x7D, 0x9B, 0xBF,
@@ -10305,11 +10305,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x9A, 0xBF, 0x7F, 0xFF, 0xF7, 0x7D, 0x9B, 0xD1, 0x7D, 0x9B, 0xD1, 0xE1, 0x0B, 0x72, 0x6E, 0x7D,
     0x84, 0xB5, 0x21, 0x68, 0xF9, 0x64, 0x2E, 0x61, 0x65, 0x6B, 0x7D, 0x9B, 0x28, 0x7D, 0xD7, 0x99,
     0x7F, 0xFF, 0xFD, 0x7D, 0x80, 0x4D, 0x62, 0x2E, 0x6D, 0x7D, 0x80, 0x70, 0x7D, 0x9B, 0x34, 0x21,
-    0x6D, 0xF7, 0x71, 0x2E, 0x61, 0xC3, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x73, 0x75, 0x76, 0x79, 0x7D, 0x99, 0x6F, 0x7F, 0xFE, 0xC0, 0x7F, 0xFE, 0xF2, 0x7F, 0xFE, 0xFB,
-    0x7F, 0xFF, 0x44, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x6A, 0x7F, 0xFF, 0x7C, 0x7F, 0xFF, 0x8E, 0x7F,
-    0xFF, 0xA1, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xAE, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF,
-    0xFD, 0x7D, 0x9B, 0x8E, 0x7D, 0x99, 0x72, 0x62, 0x6E, 0x70, 0x7D, 0x9A, 0xE3, 0x7D, 0xA6, 0x2A,
+    0x6D, 0xF7, 0x71, 0x2E, 0x61, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x73,
+    0x75, 0x76, 0x79, 0xC3, 0x7D, 0x99, 0x6F, 0x7F, 0xFE, 0xC0, 0x7F, 0xFE, 0xFB, 0x7F, 0xFF, 0x44,
+    0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x6A, 0x7F, 0xFF, 0x7C, 0x7F, 0xFF, 0x8E, 0x7F, 0xFF, 0xA1, 0x7F,
+    0xFF, 0xAB, 0x7F, 0xFF, 0xAE, 0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xFD, 0x7D, 0x9B,
+    0x8E, 0x7D, 0x99, 0x72, 0x7F, 0xFE, 0xF2, 0x62, 0x6E, 0x70, 0x7D, 0x9A, 0xE3, 0x7D, 0xA6, 0x2A,
     0x21, 0x61, 0xF7, 0x62, 0x61, 0x65, 0x7D, 0x9B, 0x40, 0x7D, 0xA4, 0x39, 0x64, 0x63, 0x69, 0x6C,
     0x6D, 0x7D, 0x9A, 0xCE, 0x7D, 0x9A, 0xCE, 0x7D, 0x9A, 0xCE, 0x7E, 0x06, 0x57, 0xE5, 0x00, 0x51,
     0x61, 0x65, 0x69, 0x6F, 0x75, 0x7D, 0x9A, 0x14, 0x7F, 0xFF, 0xEF, 0x7D, 0x9A, 0x14, 0x7D, 0x9A,
@@ -10428,10 +10428,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x06, 0xF1, 0x61, 0x65, 0x69, 0x6F, 0x7F, 0xFF, 0xF0, 0x7D, 0x91, 0xFF, 0x7F, 0xFF, 0xF7, 0x7D,
     0x91, 0xFF, 0xE1, 0x05, 0x11, 0x6F, 0x7D, 0x78, 0x6A, 0xE4, 0x06, 0xF1, 0x65, 0x6C, 0x6E, 0x72,
     0x7D, 0x91, 0xE5, 0x7E, 0x3E, 0xC1, 0x7D, 0x91, 0xE5, 0x7D, 0x91, 0xE5, 0xF0, 0x07, 0x12, 0x2E,
-    0x61, 0xC3, 0x62, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7D,
-    0x92, 0xD2, 0x7F, 0xFE, 0xD3, 0x7F, 0xFE, 0xFC, 0x7D, 0x92, 0xD2, 0x7F, 0xFF, 0x10, 0x7D, 0x91,
-    0xD2, 0x7F, 0xFF, 0x32, 0x7D, 0x92, 0xD2, 0x7F, 0xFF, 0x73, 0x7D, 0x92, 0xD2, 0x7F, 0xFF, 0xA6,
-    0x7F, 0xFF, 0xD3, 0x7D, 0xCF, 0xF9, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xED, 0x7D, 0x92, 0xD2, 0x62,
+    0x61, 0x62, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x76, 0xC3, 0x7D,
+    0x92, 0xD2, 0x7F, 0xFE, 0xD3, 0x7D, 0x92, 0xD2, 0x7F, 0xFF, 0x10, 0x7D, 0x91, 0xD2, 0x7F, 0xFF,
+    0x32, 0x7D, 0x92, 0xD2, 0x7F, 0xFF, 0x73, 0x7D, 0x92, 0xD2, 0x7F, 0xFF, 0xA6, 0x7F, 0xFF, 0xD3,
+    0x7D, 0xCF, 0xF9, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xED, 0x7D, 0x92, 0xD2, 0x7F, 0xFE, 0xFC, 0x62,
     0x61, 0x73, 0x7D, 0x79, 0xAF, 0x7D, 0xBB, 0x6E, 0x21, 0x64, 0xF7, 0x62, 0x68, 0x70, 0x7D, 0x93,
     0x95, 0x7D, 0x77, 0xFE, 0x6B, 0x62, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75, 0x76,
     0x7D, 0x91, 0x7A, 0x7D, 0x91, 0x7A, 0x7D, 0x91, 0x7A, 0x7D, 0x92, 0x16, 0x7D, 0x79, 0xC3, 0x7F,
@@ -10484,11 +10484,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0xF7, 0x7D, 0x90, 0x4F, 0x61, 0x9F, 0x7D, 0xFB, 0x6B, 0x61, 0x64, 0x7D, 0x76, 0x4F,
     0x63, 0x6E, 0x72, 0x74, 0x7F, 0xFF, 0xFB, 0x7D, 0x8F, 0x0A, 0x7D, 0x90, 0x2C, 0xE1, 0x02, 0xF1,
     0x65, 0x7D, 0xD4, 0x1A, 0xF4, 0x07, 0xB1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0xC3, 0x75, 0x78, 0x7A, 0x7F, 0xFE, 0x0A, 0x7F, 0xFE,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x78, 0x7A, 0xC3, 0x7F, 0xFE, 0x0A, 0x7F, 0xFE,
     0x1D, 0x7F, 0xFE, 0x3C, 0x7F, 0xFE, 0x3F, 0x7F, 0xFE, 0x4C, 0x7F, 0xFE, 0x6E, 0x7D, 0x8D, 0x40,
     0x7F, 0xFE, 0x87, 0x7D, 0xF9, 0xFB, 0x7F, 0xFE, 0xC7, 0x7F, 0xFE, 0xF8, 0x7F, 0xFF, 0x2C, 0x7D,
-    0x94, 0x3F, 0x7F, 0xFF, 0x4B, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF,
-    0xEC, 0x7D, 0x93, 0xBD, 0x7F, 0xFF, 0xF9, 0x62, 0x65, 0x6B, 0x7D, 0x90, 0x19, 0x7D, 0x8F, 0x55,
+    0x94, 0x3F, 0x7F, 0xFF, 0x4B, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xEC, 0x7D, 0x93,
+    0xBD, 0x7F, 0xFF, 0xF9, 0x7F, 0xFF, 0xE2, 0x62, 0x65, 0x6B, 0x7D, 0x90, 0x19, 0x7D, 0x8F, 0x55,
     0x63, 0x6E, 0x72, 0x74, 0x7D, 0x8E, 0x9A, 0x7D, 0x8F, 0x4C, 0x7D, 0x8E, 0x9A, 0x63, 0x61, 0x65,
     0x6F, 0x7D, 0x8F, 0x80, 0x7E, 0x23, 0xF5, 0x7D, 0x8F, 0x3F, 0xE1, 0x08, 0x51, 0x61, 0x7D, 0x78,
     0x24, 0x66, 0x61, 0xC3, 0x65, 0x69, 0x6D, 0x74, 0x7D, 0x8F, 0x2B, 0x7E, 0x2C, 0xEB, 0x7D, 0x8F,
@@ -10499,10 +10499,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x74, 0x7F, 0xFF, 0xEC, 0x7D, 0x8F, 0x23, 0x7D, 0x8E, 0x30, 0x7F, 0xFF, 0xF3, 0x61, 0x73, 0x7E,
     0x72, 0x10, 0x65, 0x2E, 0x65, 0x69, 0x72, 0x73, 0x7D, 0x8F, 0x8E, 0x7D, 0x96, 0x3B, 0x7D, 0x8E,
     0xCA, 0x7D, 0x8E, 0xCA, 0x7D, 0x8F, 0x8E, 0xE1, 0x02, 0xF1, 0x69, 0x7D, 0x97, 0xBB, 0x6F, 0x61,
-    0x63, 0x65, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xC3, 0x74, 0x75, 0x7A, 0x7D, 0x8E,
+    0x63, 0x65, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7D, 0x8E,
     0xAE, 0x7F, 0xFF, 0x59, 0x7F, 0xFF, 0x62, 0x7F, 0xFF, 0x6F, 0x7D, 0x8E, 0x60, 0x7F, 0xFF, 0x83,
-    0x7D, 0x74, 0x4B, 0x7F, 0xFF, 0xA5, 0x7D, 0x8E, 0x60, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xDF, 0x7E,
-    0x5E, 0x2C, 0x7F, 0xFF, 0xE4, 0x7D, 0x8E, 0x60, 0x7F, 0xFF, 0xF9, 0x64, 0x64, 0x6E, 0x72, 0x74,
+    0x7D, 0x74, 0x4B, 0x7F, 0xFF, 0xA5, 0x7D, 0x8E, 0x60, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xDF, 0x7F,
+    0xFF, 0xE4, 0x7D, 0x8E, 0x60, 0x7F, 0xFF, 0xF9, 0x7E, 0x5E, 0x2C, 0x64, 0x64, 0x6E, 0x72, 0x74,
     0x7D, 0x8E, 0x23, 0x7D, 0x8D, 0xBF, 0x7D, 0x8E, 0x23, 0x7D, 0x8D, 0xBF, 0xE1, 0x07, 0xB1, 0x72,
     0x7D, 0x8D, 0x05, 0x63, 0xA4, 0xB6, 0xBC, 0x7F, 0xFF, 0xE8, 0x7D, 0x8C, 0xFE, 0x7F, 0xFF, 0xF9,
     0x61, 0x69, 0x7D, 0x8F, 0x10, 0x63, 0x63, 0x6E, 0x73, 0x7D, 0x8D, 0x95, 0x7D, 0x8E, 0x47, 0x7D,
@@ -10547,11 +10547,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x64, 0x6B, 0x7D, 0x8B, 0x2B, 0x7D, 0x8B, 0xDD, 0xE2, 0x0C, 0xE2, 0x65, 0x70, 0x7D, 0x72, 0x0C,
     0x7D, 0xA8, 0xDF, 0x68, 0x62, 0x66, 0x6B, 0x6C, 0x6E, 0x70, 0x72, 0x74, 0x7D, 0x8B, 0xC9, 0x7D,
     0x8B, 0x7B, 0x7D, 0x8B, 0x17, 0x7F, 0x3C, 0x15, 0x7F, 0xFF, 0xEC, 0x7D, 0x8B, 0x7B, 0x7F, 0xFF,
-    0xF5, 0x7D, 0x8B, 0x7B, 0xF0, 0x06, 0xC1, 0x2E, 0x61, 0xC3, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6C,
-    0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7D, 0x8B, 0x5A, 0x7F, 0xFC, 0xFA, 0x7F, 0xFD, 0x4F,
-    0x7D, 0x8B, 0x5A, 0x7F, 0xFD, 0xA6, 0x7D, 0x8C, 0x18, 0x7F, 0xFD, 0xFF, 0x7F, 0xFE, 0x2B, 0x7F,
-    0xFE, 0x59, 0x7D, 0x8C, 0x18, 0x7F, 0xFE, 0x8D, 0x7F, 0xFF, 0xAE, 0x7F, 0x54, 0x8F, 0x7D, 0x8B,
-    0x5D, 0x7F, 0xFF, 0xDF, 0x7D, 0x8C, 0x18, 0xE1, 0x02, 0x61, 0x74, 0x7E, 0x90, 0x53, 0xE1, 0x02,
+    0xF5, 0x7D, 0x8B, 0x7B, 0xF0, 0x06, 0xC1, 0x2E, 0x61, 0x63, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6E,
+    0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0xC3, 0x7D, 0x8B, 0x5A, 0x7F, 0xFC, 0xFA, 0x7D, 0x8B, 0x5A,
+    0x7F, 0xFD, 0xA6, 0x7D, 0x8C, 0x18, 0x7F, 0xFD, 0xFF, 0x7F, 0xFE, 0x2B, 0x7F, 0xFE, 0x59, 0x7D,
+    0x8C, 0x18, 0x7F, 0xFE, 0x8D, 0x7F, 0xFF, 0xAE, 0x7F, 0x54, 0x8F, 0x7D, 0x8B, 0x5D, 0x7F, 0xFF,
+    0xDF, 0x7D, 0x8C, 0x18, 0x7F, 0xFD, 0x4F, 0xE1, 0x02, 0x61, 0x74, 0x7E, 0x90, 0x53, 0xE1, 0x02,
     0x61, 0x63, 0x7F, 0x17, 0x9D, 0x63, 0xA4, 0xB6, 0xBC, 0x7D, 0x8A, 0x09, 0x7D, 0x83, 0x89, 0x7F,
     0xFF, 0xF9, 0xE1, 0x02, 0x61, 0x63, 0x7E, 0x06, 0xE8, 0x62, 0x65, 0x74, 0x7D, 0x72, 0x1D, 0x7D,
     0x7C, 0x01, 0x61, 0x63, 0x7F, 0x17, 0x79, 0xA1, 0x02, 0x61, 0x65, 0xFB, 0xE6, 0x0B, 0xF3, 0x61,
@@ -10612,10 +10612,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x67, 0x6B, 0x72, 0x73, 0x7D, 0x88, 0x0F, 0x7D, 0x88, 0x0F, 0x7D, 0x88, 0x0F, 0x7D, 0x88, 0x0F,
     0x7F, 0xFF, 0xF7, 0x62, 0x73, 0x77, 0x7D, 0x87, 0xFA, 0x7D, 0x87, 0xFA, 0x64, 0x6D, 0x6E, 0x70,
     0x72, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xF7, 0x7D, 0x86, 0x62, 0x7F, 0xCD, 0x96, 0xF0, 0x06, 0xF2,
-    0x61, 0xC3, 0x63, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x71, 0x73, 0x74, 0x75, 0x7A,
-    0x7F, 0xFC, 0xEE, 0x7F, 0xFD, 0x20, 0x7F, 0xFD, 0x45, 0x7F, 0xFE, 0x46, 0x7F, 0xFE, 0x7F, 0x7F,
-    0xFE, 0x82, 0x7F, 0xFE, 0xA5, 0x7F, 0xFE, 0xC3, 0x7D, 0xB0, 0x90, 0x7F, 0xFE, 0xD5, 0x7F, 0xFE,
-    0xEA, 0x7F, 0xFE, 0xF7, 0x7F, 0xFE, 0xFC, 0x7F, 0xFF, 0x9F, 0x7F, 0xFF, 0xEF, 0x7D, 0x86, 0x44,
+    0x61, 0x63, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x71, 0x73, 0x74, 0x75, 0x7A, 0xC3,
+    0x7F, 0xFC, 0xEE, 0x7F, 0xFD, 0x45, 0x7F, 0xFE, 0x46, 0x7F, 0xFE, 0x7F, 0x7F, 0xFE, 0x82, 0x7F,
+    0xFE, 0xA5, 0x7F, 0xFE, 0xC3, 0x7D, 0xB0, 0x90, 0x7F, 0xFE, 0xD5, 0x7F, 0xFE, 0xEA, 0x7F, 0xFE,
+    0xF7, 0x7F, 0xFE, 0xFC, 0x7F, 0xFF, 0x9F, 0x7F, 0xFF, 0xEF, 0x7D, 0x86, 0x44, 0x7F, 0xFD, 0x20,
     0x62, 0x6C, 0x73, 0x7D, 0x87, 0x5C, 0x7D, 0x88, 0x26, 0xE1, 0x07, 0x91, 0x69, 0x7D, 0x6C, 0xED,
     0x6D, 0x2E, 0x62, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x74, 0x75, 0x7A, 0x7D, 0x86,
     0x9A, 0x7D, 0x87, 0x4C, 0x7D, 0x87, 0x4C, 0x7F, 0xFF, 0xF0, 0x7F, 0x3D, 0xB2, 0x7D, 0x87, 0x4C,
@@ -10696,12 +10696,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x82, 0xB2, 0xE1, 0x07, 0x91, 0x69, 0x7D, 0x84, 0x50, 0xE1, 0x07, 0x91, 0x69, 0x7D, 0x9A,
     0x23, 0xA0, 0x33, 0x52, 0x62, 0x2E, 0x61, 0x7D, 0x90, 0x90, 0x7D, 0x82, 0x78, 0xE3, 0x07, 0x91,
     0x61, 0xC3, 0x6F, 0x7D, 0x67, 0xD5, 0x7D, 0x9E, 0x5C, 0x7D, 0x96, 0x6E, 0x75, 0x2E, 0x61, 0x62,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0xC3, 0x70, 0x72, 0x73, 0x74, 0x75,
-    0x77, 0x7A, 0x7D, 0x8E, 0x05, 0x7F, 0xFF, 0x8E, 0x7F, 0xFF, 0x9A, 0x7D, 0x82, 0x60, 0x7F, 0xFF,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77,
+    0x7A, 0xC3, 0x7D, 0x8E, 0x05, 0x7F, 0xFF, 0x8E, 0x7F, 0xFF, 0x9A, 0x7D, 0x82, 0x60, 0x7F, 0xFF,
     0xAE, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xDE, 0x7D, 0x82, 0x60, 0x7D, 0x84, 0x0D, 0x7F, 0xFF, 0xE5,
-    0x7D, 0x82, 0x60, 0x7D, 0x82, 0x60, 0x7F, 0xFF, 0xE8, 0x7E, 0xBC, 0x58, 0x7D, 0x82, 0x60, 0x7D,
-    0x82, 0x60, 0x7D, 0x82, 0x60, 0x7D, 0x82, 0x60, 0x7D, 0x82, 0x60, 0x7D, 0x82, 0x60, 0x7F, 0xFF,
-    0xF1, 0xE1, 0x01, 0x61, 0x72, 0x7D, 0x6A, 0xAF, 0xE3, 0x00, 0xE1, 0x61, 0x6E, 0x72, 0x7D, 0x6A,
+    0x7D, 0x82, 0x60, 0x7D, 0x82, 0x60, 0x7F, 0xFF, 0xE8, 0x7D, 0x82, 0x60, 0x7D, 0x82, 0x60, 0x7D,
+    0x82, 0x60, 0x7D, 0x82, 0x60, 0x7D, 0x82, 0x60, 0x7D, 0x82, 0x60, 0x7F, 0xFF, 0xF1, 0x7E, 0xBC,
+    0x58, 0xE1, 0x01, 0x61, 0x72, 0x7D, 0x6A, 0xAF, 0xE3, 0x00, 0xE1, 0x61, 0x6E, 0x72, 0x7D, 0x6A,
     0xA8, 0x7D, 0x82, 0x45, 0x7D, 0x6A, 0xA8, 0xE3, 0x06, 0xF1, 0x65, 0x73, 0x74, 0x7F, 0xFF, 0xEA,
     0x7D, 0x69, 0x4F, 0x7F, 0xFF, 0xF1, 0x62, 0x62, 0x67, 0x7D, 0x67, 0x80, 0x7D, 0x67, 0x80, 0xE3,
     0x06, 0xF1, 0x61, 0x69, 0x74, 0x7F, 0xFF, 0xF7, 0x7D, 0x82, 0xA1, 0x7D, 0x82, 0xA1, 0xE3, 0x02,
@@ -10749,17 +10749,17 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x7F, 0x68, 0x7D, 0x7F, 0x68, 0x7D, 0x7F, 0xA9, 0xE3, 0x02, 0xF1, 0x73, 0x74, 0x7A, 0x7D,
     0x7E, 0x81, 0x7E, 0x15, 0x47, 0x7D, 0x7E, 0xE8, 0x63, 0x61, 0x65, 0x74, 0x7D, 0x7F, 0x24, 0x7D,
     0x7F, 0xEB, 0x7D, 0x7F, 0x65, 0x71, 0x2E, 0x62, 0x63, 0x64, 0x65, 0x66, 0x68, 0x69, 0x6C, 0x6E,
-    0x6F, 0x70, 0x72, 0x73, 0xC3, 0x74, 0x75, 0x7D, 0x7F, 0x17, 0x7F, 0xFF, 0x49, 0x7F, 0xFF, 0x4E,
+    0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0xC3, 0x7D, 0x7F, 0x17, 0x7F, 0xFF, 0x49, 0x7F, 0xFF, 0x4E,
     0x7D, 0x7E, 0xC9, 0x7F, 0xFF, 0x5A, 0x7F, 0xFF, 0x7F, 0x7D, 0x7D, 0xBC, 0x7F, 0xFF, 0x84, 0x7D,
     0x85, 0x82, 0x7F, 0xFF, 0x8D, 0x7D, 0x7F, 0x17, 0x7F, 0xFF, 0x9E, 0x7F, 0xFF, 0xAF, 0x7F, 0xFF,
-    0xE4, 0x7E, 0x4E, 0x95, 0x7F, 0xFF, 0xF3, 0x7D, 0x7F, 0x17, 0x63, 0x63, 0x67, 0x75, 0x7D, 0x8A,
+    0xE4, 0x7F, 0xFF, 0xF3, 0x7D, 0x7F, 0x17, 0x7E, 0x4E, 0x95, 0x63, 0x63, 0x67, 0x75, 0x7D, 0x8A,
     0x77, 0x7D, 0x7E, 0xD2, 0x7D, 0xE0, 0xA7, 0x63, 0x61, 0x65, 0x74, 0x7D, 0x67, 0xB7, 0x7D, 0x7F,
     0x06, 0x7D, 0x7F, 0x06, 0xA0, 0x33, 0xA2, 0x62, 0x69, 0x6C, 0x7D, 0x7E, 0xB5, 0x7F, 0xFF, 0xFD,
     0x62, 0x69, 0x73, 0x7D, 0x95, 0x08, 0x7D, 0x7F, 0x76, 0x63, 0x67, 0x6B, 0x73, 0x7F, 0xFF, 0xF7,
     0x7D, 0x80, 0xC1, 0x7D, 0x7E, 0xA3, 0x6C, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6E,
-    0x73, 0xC3, 0x75, 0x7D, 0x7E, 0x96, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xD1, 0x7D, 0x7E, 0x96, 0x7F,
+    0x73, 0x75, 0xC3, 0x7D, 0x7E, 0x96, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF, 0xD1, 0x7D, 0x7E, 0x96, 0x7F,
     0xFF, 0xE1, 0x7D, 0x7E, 0x96, 0x7D, 0x7E, 0x96, 0x7D, 0xCF, 0xB6, 0x7F, 0xFF, 0xF3, 0x7D, 0xA7,
-    0xC7, 0x7E, 0x4E, 0x14, 0x7E, 0x21, 0x48, 0x66, 0x63, 0x67, 0x6E, 0x73, 0xC3, 0x75, 0x7D, 0x7F,
+    0xC7, 0x7E, 0x21, 0x48, 0x7E, 0x4E, 0x14, 0x66, 0x63, 0x67, 0x6E, 0x73, 0xC3, 0x75, 0x7D, 0x7F,
     0x2C, 0x7D, 0x7E, 0x65, 0x7D, 0x7D, 0xB3, 0x7D, 0x7D, 0xB3, 0x7E, 0x4D, 0xE3, 0x7E, 0x21, 0x17,
     0x62, 0x70, 0x73, 0x7D, 0x7E, 0x4C, 0x7D, 0x7C, 0xFE, 0x61, 0x6D, 0x7E, 0x20, 0xF5, 0x23, 0xA4,
     0xB6, 0xBC, 0xD9, 0xF2, 0xFB, 0x63, 0x62, 0x66, 0x73, 0x7D, 0x89, 0xDC, 0x7D, 0x7F, 0x01, 0x7D,
@@ -10793,13 +10793,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0x7D, 0x7D, 0x7B, 0xDE, 0x7D, 0xA4, 0x88, 0x7D, 0x7B, 0xDE, 0x7D, 0x86, 0x27, 0x7F, 0xFF,
     0x9D, 0x7F, 0xFF, 0xAD, 0x7F, 0xFF, 0xD7, 0x7D, 0x7D, 0x00, 0x7D, 0x8A, 0xF5, 0xE1, 0x06, 0xF1,
     0x61, 0x7D, 0x75, 0x39, 0x62, 0x61, 0x6C, 0x7D, 0x7A, 0xFD, 0x7D, 0x8A, 0xBD, 0x7B, 0x2E, 0x61,
-    0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0x7D, 0x7C, 0x01, 0x7F, 0xF6, 0xF7, 0x7F,
-    0xF7, 0xF7, 0x7D, 0x7C, 0x01, 0x7F, 0xF8, 0x01, 0x7D, 0x7C, 0x01, 0x7F, 0xFA, 0xA6, 0x7D, 0x7C,
-    0x01, 0x7D, 0x7C, 0x01, 0x7F, 0xFB, 0x15, 0x7F, 0xFC, 0x31, 0x7D, 0x7C, 0x01, 0x7F, 0xFC, 0x7A,
-    0x7D, 0x7C, 0x01, 0x7D, 0x7C, 0x01, 0x7D, 0x7C, 0x01, 0x7F, 0xFD, 0x38, 0x7D, 0x7C, 0x01, 0x7D,
-    0x7C, 0x01, 0x7F, 0xFF, 0x01, 0x7F, 0xFF, 0x1B, 0x7D, 0xA2, 0x02, 0x7F, 0xFF, 0xBF, 0x7D, 0x7C,
-    0x01, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF7, 0x7D, 0xB9, 0x0F, 0x62, 0x6C, 0x6E, 0x7D, 0xA0, 0xF5,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3, 0x7D, 0x7C, 0x01, 0x7F, 0xF6, 0xF7, 0x7D,
+    0x7C, 0x01, 0x7F, 0xF8, 0x01, 0x7D, 0x7C, 0x01, 0x7F, 0xFA, 0xA6, 0x7D, 0x7C, 0x01, 0x7D, 0x7C,
+    0x01, 0x7F, 0xFB, 0x15, 0x7F, 0xFC, 0x31, 0x7D, 0x7C, 0x01, 0x7F, 0xFC, 0x7A, 0x7D, 0x7C, 0x01,
+    0x7D, 0x7C, 0x01, 0x7D, 0x7C, 0x01, 0x7F, 0xFD, 0x38, 0x7D, 0x7C, 0x01, 0x7D, 0x7C, 0x01, 0x7F,
+    0xFF, 0x01, 0x7F, 0xFF, 0x1B, 0x7D, 0xA2, 0x02, 0x7F, 0xFF, 0xBF, 0x7D, 0x7C, 0x01, 0x7F, 0xFF,
+    0xF0, 0x7F, 0xFF, 0xF7, 0x7D, 0xB9, 0x0F, 0x7F, 0xF7, 0xF7, 0x62, 0x6C, 0x6E, 0x7D, 0xA0, 0xF5,
     0x7D, 0x7B, 0x97, 0xE3, 0x06, 0xD2, 0x61, 0x69, 0x73, 0x7D, 0x61, 0x09, 0x7D, 0x7B, 0xD9, 0x7D,
     0x61, 0x09, 0x61, 0x65, 0x7D, 0x6B, 0xB6, 0x21, 0x64, 0xFB, 0x21, 0x6E, 0xFD, 0x62, 0x65, 0x70,
     0x7F, 0xFF, 0xFD, 0x7D, 0x93, 0x60, 0x62, 0x65, 0x73, 0x7D, 0x72, 0x6D, 0x7D, 0x62, 0x37, 0x63,
@@ -10849,22 +10849,22 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x81, 0x69, 0x7D, 0x5E, 0x2B, 0xA1, 0x07, 0xF2, 0x6E, 0xF9, 0xEA, 0x06, 0xC1, 0x61, 0xC3, 0x65,
     0x69, 0x6F, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7D, 0x79, 0x62, 0x7F, 0xFF, 0x9C, 0x7F, 0xFF, 0xC1,
     0x7F, 0xFF, 0xE7, 0x7D, 0x78, 0xA4, 0x7D, 0x77, 0xA4, 0x7D, 0xA0, 0xEA, 0x7F, 0xFF, 0xFB, 0x7D,
-    0x78, 0xA4, 0x7D, 0x78, 0xA4, 0x7A, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-    0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A,
-    0x7F, 0xD1, 0x52, 0x7F, 0xD2, 0x7D, 0x7F, 0xD2, 0xCE, 0x7F, 0xD7, 0x2B, 0x7F, 0xD7, 0x83, 0x7F,
-    0xDF, 0x41, 0x7F, 0xDF, 0xB2, 0x7F, 0xDF, 0xFA, 0x7F, 0xE0, 0xAF, 0x7F, 0xE3, 0xFC, 0x7E, 0xD2,
-    0x31, 0x7F, 0xE5, 0xA7, 0x7F, 0xE6, 0x58, 0x7F, 0xE6, 0xD5, 0x7F, 0xE7, 0x0E, 0x7F, 0xE9, 0x1F,
-    0x7F, 0xED, 0x1F, 0x7E, 0x6F, 0x8A, 0x7F, 0xED, 0x97, 0x7F, 0xF1, 0x28, 0x7F, 0xFC, 0x78, 0x7F,
-    0xFE, 0xA7, 0x7F, 0xFE, 0xF8, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0x56, 0x7F, 0xFF, 0xD5, 0x63, 0x6E,
+    0x78, 0xA4, 0x7D, 0x78, 0xA4, 0x7A, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3,
+    0x7F, 0xD1, 0x52, 0x7F, 0xD2, 0xCE, 0x7F, 0xD7, 0x2B, 0x7F, 0xD7, 0x83, 0x7F, 0xDF, 0x41, 0x7F,
+    0xDF, 0xB2, 0x7F, 0xDF, 0xFA, 0x7F, 0xE0, 0xAF, 0x7F, 0xE3, 0xFC, 0x7E, 0xD2, 0x31, 0x7F, 0xE5,
+    0xA7, 0x7F, 0xE6, 0x58, 0x7F, 0xE6, 0xD5, 0x7F, 0xE7, 0x0E, 0x7F, 0xE9, 0x1F, 0x7F, 0xED, 0x1F,
+    0x7E, 0x6F, 0x8A, 0x7F, 0xED, 0x97, 0x7F, 0xF1, 0x28, 0x7F, 0xFC, 0x78, 0x7F, 0xFE, 0xA7, 0x7F,
+    0xFE, 0xF8, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0x56, 0x7F, 0xFF, 0xD5, 0x7F, 0xD2, 0x7D, 0x63, 0x6E,
     0x72, 0x74, 0x7D, 0x77, 0xAC, 0x7D, 0x78, 0x13, 0x7D, 0x78, 0x5E, 0xE1, 0x02, 0xF1, 0x6E, 0x7D,
     0x77, 0x66, 0xA0, 0x35, 0x15, 0x21, 0x74, 0xFD, 0x62, 0xA4, 0xB6, 0x7D, 0xC1, 0x2B, 0x7D, 0x79,
     0x0B, 0x63, 0x61, 0xC3, 0x65, 0x7D, 0x79, 0x02, 0x7F, 0xFF, 0xF7, 0x7D, 0xD8, 0x85, 0xE2, 0x07,
     0x71, 0x65, 0x73, 0x7D, 0x76, 0xFF, 0x7D, 0x60, 0xD2, 0x75, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67,
-    0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0xC3, 0x77, 0x79, 0x7A, 0x7F,
+    0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7A, 0xC3, 0x7F,
     0xFF, 0xD2, 0x7D, 0x78, 0x93, 0x7D, 0x77, 0xD5, 0x7D, 0x7E, 0x8E, 0x7D, 0x77, 0xD5, 0x7D, 0x77,
     0xD5, 0x7D, 0x77, 0xD5, 0x7F, 0xFF, 0xDC, 0x7D, 0x78, 0x93, 0x7F, 0xFF, 0xE8, 0x7E, 0x6A, 0xC8,
     0x7D, 0x77, 0xD5, 0x7D, 0x6A, 0xDB, 0x7D, 0x78, 0x11, 0x7D, 0x77, 0xD5, 0x7D, 0x78, 0x93, 0x7F,
-    0xFF, 0xF5, 0x7F, 0xDA, 0x30, 0x7D, 0x77, 0xD5, 0x7D, 0x5D, 0x53, 0x7D, 0x77, 0xD5, 0x66, 0x65,
+    0xFF, 0xF5, 0x7D, 0x77, 0xD5, 0x7D, 0x5D, 0x53, 0x7D, 0x77, 0xD5, 0x7F, 0xDA, 0x30, 0x66, 0x65,
     0x69, 0x6F, 0x72, 0x73, 0x75, 0x7D, 0x78, 0x0F, 0x7D, 0x77, 0x83, 0x7D, 0x77, 0x83, 0x7D, 0x5D,
     0x34, 0x7D, 0x77, 0xCE, 0x7D, 0x77, 0x83, 0xE4, 0x06, 0xF2, 0x65, 0x68, 0x6C, 0x75, 0x7D, 0x81,
     0x4C, 0x7F, 0xFF, 0xE7, 0x7D, 0x77, 0x03, 0x7D, 0x77, 0x03, 0x61, 0x72, 0x7D, 0xC0, 0x89, 0x61,
@@ -10913,9 +10913,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x75, 0xC6, 0x7D, 0x5B, 0x80, 0xE3, 0x07, 0x71, 0x62, 0x70, 0x72, 0x7D, 0x73, 0xC7, 0x7D,
     0x73, 0xC7, 0x7D, 0x7C, 0x9E, 0xE1, 0x0C, 0xE2, 0x61, 0x7D, 0x61, 0x58, 0x62, 0x65, 0x73, 0x7D,
     0x76, 0x30, 0x7D, 0x5A, 0x46, 0x6E, 0x2E, 0x61, 0x62, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6F,
-    0xC3, 0x70, 0x73, 0x74, 0x7D, 0x73, 0x7C, 0x7F, 0xFF, 0x13, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x70,
+    0x70, 0x73, 0x74, 0xC3, 0x7D, 0x73, 0x7C, 0x7F, 0xFF, 0x13, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x70,
     0x7F, 0xFF, 0x8D, 0x7F, 0xFF, 0x9B, 0x7D, 0x7A, 0xAD, 0x7F, 0xFF, 0xC7, 0x7F, 0xFF, 0xD8, 0x7F,
-    0xFF, 0xE1, 0x7E, 0x2B, 0x7D, 0x7D, 0x5A, 0x07, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF7, 0x63, 0x69,
+    0xFF, 0xE1, 0x7D, 0x5A, 0x07, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF7, 0x7E, 0x2B, 0x7D, 0x63, 0x69,
     0x6E, 0x72, 0x7D, 0x86, 0xF6, 0x7D, 0x73, 0xEC, 0x7D, 0xBD, 0x85, 0x41, 0x78, 0xAC, 0xE3, 0x61,
     0x73, 0x7D, 0xBF, 0xEC, 0x63, 0x69, 0x6E, 0x72, 0x7D, 0x5A, 0x22, 0x7F, 0xFF, 0xFB, 0x7D, 0x5A,
     0x8B, 0x63, 0x65, 0x69, 0x6F, 0x7F, 0xFF, 0xF3, 0x7D, 0x5A, 0x15, 0x7D, 0x5A, 0xB0, 0x62, 0x6C,
@@ -10938,12 +10938,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0xFF, 0xF7, 0x62, 0x61, 0xC3, 0x7F, 0x8E, 0x5D, 0x7E, 0x11, 0x29, 0x63, 0x68, 0x6D, 0x7A,
     0x7D, 0x59, 0x66, 0x7D, 0x59, 0x66, 0x7D, 0x59, 0x66, 0x21, 0x72, 0xF3, 0x66, 0x2E, 0x61, 0x65,
     0x75, 0xC3, 0x77, 0x7D, 0x73, 0x91, 0x7D, 0x59, 0x88, 0x7F, 0xFF, 0xFD, 0x7D, 0xDC, 0x37, 0x7D,
-    0xDB, 0x78, 0x7D, 0x58, 0xEA, 0x73, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-    0x6A, 0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x77, 0x7A, 0x7F, 0xFE, 0xFB, 0x7D, 0x86, 0x5F, 0x7F,
-    0xFF, 0x02, 0x7F, 0xFF, 0x0F, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x39, 0x7D, 0x72, 0xE9, 0x7F, 0xFF,
-    0x52, 0x7E, 0xDF, 0x7D, 0x7D, 0x73, 0x78, 0x7D, 0x73, 0x78, 0x7F, 0xFF, 0x5C, 0x7D, 0x72, 0xE9,
-    0x7E, 0x1D, 0xFB, 0x7F, 0xFF, 0x71, 0x7F, 0xFF, 0x91, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xCE, 0x7F,
-    0xFF, 0xE7, 0x62, 0x2E, 0x73, 0x7E, 0x0D, 0x41, 0x7D, 0x71, 0xBB, 0x61, 0x6B, 0x7D, 0x79, 0x9F,
+    0xDB, 0x78, 0x7D, 0x58, 0xEA, 0x73, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A,
+    0x6B, 0x6C, 0x6E, 0x6F, 0x73, 0x74, 0x77, 0x7A, 0xC3, 0x7F, 0xFE, 0xFB, 0x7F, 0xFF, 0x02, 0x7F,
+    0xFF, 0x0F, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x39, 0x7D, 0x72, 0xE9, 0x7F, 0xFF, 0x52, 0x7E, 0xDF,
+    0x7D, 0x7D, 0x73, 0x78, 0x7D, 0x73, 0x78, 0x7F, 0xFF, 0x5C, 0x7D, 0x72, 0xE9, 0x7E, 0x1D, 0xFB,
+    0x7F, 0xFF, 0x71, 0x7F, 0xFF, 0x91, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xCE, 0x7F, 0xFF, 0xE7, 0x7D,
+    0x86, 0x5F, 0x62, 0x2E, 0x73, 0x7E, 0x0D, 0x41, 0x7D, 0x71, 0xBB, 0x61, 0x6B, 0x7D, 0x79, 0x9F,
     0x63, 0x2E, 0x61, 0x72, 0x7D, 0x71, 0x8E, 0x7D, 0x72, 0xDC, 0x7D, 0x71, 0x8E, 0x65, 0x65, 0x66,
     0x6C, 0x6F, 0x70, 0x7F, 0xFF, 0xE5, 0x7D, 0x72, 0x81, 0x7D, 0x71, 0x77, 0x7F, 0xFF, 0xEE, 0x7F,
     0xFF, 0xF3, 0xE6, 0x06, 0xC1, 0x62, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x7F, 0x0E, 0x90, 0x7E, 0x13,
@@ -10959,10 +10959,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7F, 0x82, 0xC0, 0x7D, 0x57, 0xBA, 0x7D, 0xF9, 0xA9, 0xE8, 0x06, 0xF1, 0x61, 0x65, 0x69, 0x6F,
     0x72, 0x73, 0xC3, 0x79, 0x7D, 0x58, 0x05, 0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xEA, 0x7D, 0x58, 0x48,
     0x7F, 0xFF, 0xF3, 0x7D, 0x57, 0xAA, 0x7D, 0xA0, 0x86, 0x7D, 0x71, 0x61, 0x6F, 0x61, 0x62, 0x63,
-    0x64, 0x65, 0x68, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0xC3, 0x74, 0x75, 0x7A, 0x7F, 0xFF, 0x36, 0x7D,
+    0x64, 0x65, 0x68, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFF, 0x36, 0x7D,
     0x57, 0x20, 0x7F, 0xFF, 0x5A, 0x7D, 0x71, 0x3E, 0x7F, 0xFF, 0x6A, 0x7D, 0x68, 0xF6, 0x7F, 0xFF,
-    0x7F, 0x7D, 0x57, 0xD3, 0x7F, 0xFF, 0x9C, 0x7D, 0x71, 0x3E, 0x7F, 0xFF, 0xAD, 0x7E, 0x28, 0x96,
-    0x7F, 0xFF, 0xDD, 0x7D, 0x7D, 0x3F, 0x7D, 0xDA, 0xFE, 0xE2, 0x07, 0x32, 0x69, 0x6F, 0x7D, 0x72,
+    0x7F, 0x7D, 0x57, 0xD3, 0x7F, 0xFF, 0x9C, 0x7D, 0x71, 0x3E, 0x7F, 0xFF, 0xAD, 0x7F, 0xFF, 0xDD,
+    0x7D, 0x7D, 0x3F, 0x7D, 0xDA, 0xFE, 0x7E, 0x28, 0x96, 0xE2, 0x07, 0x32, 0x69, 0x6F, 0x7D, 0x72,
     0x7A, 0x7D, 0x71, 0xB3, 0xE1, 0x00, 0x81, 0x69, 0x7D, 0x5A, 0x4C, 0xE3, 0x0C, 0xE2, 0x65, 0x69,
     0x6F, 0x7F, 0xFF, 0xF9, 0x7D, 0x57, 0x84, 0x7D, 0x57, 0x3B, 0x67, 0x2E, 0x63, 0x6B, 0x70, 0x73,
     0x74, 0x7A, 0x7D, 0x70, 0xE0, 0x7D, 0x7F, 0xF7, 0x7D, 0x68, 0x9C, 0x7D, 0x81, 0x70, 0x7F, 0xFF,
@@ -10986,19 +10986,19 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6D, 0x6E, 0x72, 0x77, 0x7D, 0x64, 0xFF, 0x7D, 0x5A, 0x32, 0x7D, 0x5A, 0x32, 0x7D, 0x5A, 0x32,
     0x7D, 0x65, 0x03, 0xA1, 0x07, 0x71, 0x68, 0xEB, 0x62, 0x69, 0x6E, 0x7D, 0x7B, 0xF9, 0x7D, 0x71,
     0x1E, 0x72, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x6B, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74,
-    0x75, 0xC3, 0x77, 0x7A, 0x7D, 0x71, 0x12, 0x7F, 0xFF, 0xF2, 0x7D, 0x70, 0x4B, 0x7F, 0xFF, 0xF7,
+    0x75, 0x77, 0x7A, 0xC3, 0x7D, 0x71, 0x12, 0x7F, 0xFF, 0xF2, 0x7D, 0x70, 0x4B, 0x7F, 0xFF, 0xF7,
     0x7D, 0x71, 0x12, 0x7D, 0x71, 0x12, 0x7D, 0x71, 0x12, 0x7D, 0x6E, 0xFD, 0x7D, 0x71, 0x12, 0x7D,
     0x6E, 0xFD, 0x7D, 0xEB, 0x89, 0x7D, 0x71, 0x12, 0x7D, 0x71, 0x12, 0x7F, 0x30, 0x67, 0x7D, 0x71,
-    0x12, 0x7D, 0xD8, 0x73, 0x7D, 0x71, 0x12, 0x7D, 0x71, 0x12, 0x6A, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x12, 0x7D, 0x71, 0x12, 0x7D, 0x71, 0x12, 0x7D, 0xD8, 0x73, 0x6A, 0x62, 0x63, 0x64, 0x65, 0x66,
     0x67, 0x6B, 0x6C, 0x6D, 0x73, 0x7F, 0xFF, 0x01, 0x7F, 0xFF, 0x12, 0x7E, 0x67, 0xB0, 0x7F, 0xFF,
     0x19, 0x7F, 0xFF, 0x43, 0x7F, 0xFF, 0x84, 0x7F, 0xFF, 0x8D, 0x7D, 0x6E, 0xB4, 0x7D, 0x75, 0xD8,
     0x7F, 0xFF, 0xB7, 0x62, 0x69, 0x74, 0x7D, 0xC3, 0x42, 0x7D, 0x70, 0x49, 0x76, 0x61, 0x62, 0x63,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xC3, 0x74, 0x75,
-    0x76, 0x78, 0x7A, 0x7F, 0xF7, 0x72, 0x7F, 0xF7, 0xAD, 0x7F, 0xF8, 0x1B, 0x7F, 0xF8, 0x3F, 0x7F,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x78, 0x7A, 0xC3, 0x7F, 0xF7, 0x72, 0x7F, 0xF7, 0xAD, 0x7F, 0xF8, 0x1B, 0x7F, 0xF8, 0x3F, 0x7F,
     0xF8, 0xE2, 0x7F, 0xF9, 0x21, 0x7F, 0xF9, 0x66, 0x7F, 0xF9, 0x9C, 0x7F, 0xF9, 0xA8, 0x7F, 0xF9,
     0xEF, 0x7F, 0xFA, 0xF9, 0x7F, 0xFB, 0x6B, 0x7F, 0xFC, 0x99, 0x7F, 0xFD, 0x01, 0x7F, 0xFD, 0xE0,
-    0x7F, 0xFE, 0x3E, 0x7F, 0xFE, 0x5B, 0x7F, 0xFE, 0xA2, 0x7F, 0xFF, 0xCE, 0x7D, 0xCF, 0x02, 0x7F,
-    0xFF, 0xF7, 0x7D, 0x6F, 0x1E, 0x63, 0x69, 0x6C, 0x79, 0x7D, 0x6E, 0xC5, 0x7D, 0x6E, 0xC5, 0x7D,
+    0x7F, 0xFE, 0x3E, 0x7F, 0xFE, 0xA2, 0x7F, 0xFF, 0xCE, 0x7D, 0xCF, 0x02, 0x7F, 0xFF, 0xF7, 0x7D,
+    0x6F, 0x1E, 0x7F, 0xFE, 0x5B, 0x63, 0x69, 0x6C, 0x79, 0x7D, 0x6E, 0xC5, 0x7D, 0x6E, 0xC5, 0x7D,
     0x6F, 0x29, 0x62, 0x65, 0x74, 0x7D, 0x6E, 0xB8, 0x7D, 0x6F, 0xDA, 0xE1, 0x06, 0xF1, 0x73, 0x7D,
     0x6E, 0x13, 0x63, 0x64, 0x67, 0x7A, 0x7F, 0xF8, 0x26, 0x7F, 0xFF, 0xF9, 0x7D, 0x6E, 0xA8, 0x62,
     0x6E, 0x72, 0x7D, 0x56, 0x65, 0x7F, 0x7F, 0xDF, 0x63, 0x65, 0x6D, 0x75, 0x7F, 0xFF, 0xF7, 0x7D,
@@ -11082,13 +11082,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x55, 0xEB, 0x21, 0x69, 0xFB, 0xA1, 0x00, 0x61, 0x65, 0xFD, 0x62, 0x69, 0x72, 0x7D, 0x70,
     0xC2, 0x7F, 0xFF, 0xFB, 0x63, 0x61, 0x65, 0xC3, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xF7, 0x7D, 0x98,
     0xAD, 0xE2, 0x07, 0x71, 0x67, 0x72, 0x7D, 0x50, 0xD9, 0x7D, 0x69, 0x60, 0xE1, 0x07, 0x71, 0x6B,
-    0x7D, 0x51, 0x35, 0xE1, 0x07, 0x71, 0x74, 0x7D, 0x69, 0x0A, 0x79, 0x2E, 0x61, 0xC3, 0x62, 0x63,
-    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x77, 0x7A, 0x7D, 0x69, 0x80, 0x7F, 0xFE, 0xE4, 0x7F, 0xFF, 0x03, 0x7F, 0xFF, 0x08,
-    0x7D, 0x69, 0x80, 0x7F, 0x6E, 0x54, 0x7F, 0xFF, 0x54, 0x7F, 0xFF, 0x8D, 0x7D, 0x69, 0x80, 0x7D,
-    0x69, 0x80, 0x7F, 0xFF, 0xA7, 0x7D, 0xB4, 0xA8, 0x7F, 0xFF, 0xDA, 0x7D, 0x69, 0x80, 0x7D, 0x69,
-    0x80, 0x7F, 0xFF, 0xE7, 0x7D, 0xB4, 0xA8, 0x7D, 0x69, 0x80, 0x7D, 0x69, 0x80, 0x7F, 0xFF, 0xF2,
-    0x7D, 0xB4, 0xA8, 0x7F, 0xFF, 0xF9, 0x7D, 0x69, 0x80, 0x7D, 0x69, 0x80, 0x7E, 0x0A, 0x61, 0x62,
+    0x7D, 0x51, 0x35, 0xE1, 0x07, 0x71, 0x74, 0x7D, 0x69, 0x0A, 0x79, 0x2E, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x7A, 0xC3, 0x7D, 0x69, 0x80, 0x7F, 0xFE, 0xE4, 0x7F, 0xFF, 0x08, 0x7D, 0x69, 0x80,
+    0x7F, 0x6E, 0x54, 0x7F, 0xFF, 0x54, 0x7F, 0xFF, 0x8D, 0x7D, 0x69, 0x80, 0x7D, 0x69, 0x80, 0x7F,
+    0xFF, 0xA7, 0x7D, 0xB4, 0xA8, 0x7F, 0xFF, 0xDA, 0x7D, 0x69, 0x80, 0x7D, 0x69, 0x80, 0x7F, 0xFF,
+    0xE7, 0x7D, 0xB4, 0xA8, 0x7D, 0x69, 0x80, 0x7D, 0x69, 0x80, 0x7F, 0xFF, 0xF2, 0x7D, 0xB4, 0xA8,
+    0x7F, 0xFF, 0xF9, 0x7D, 0x69, 0x80, 0x7D, 0x69, 0x80, 0x7E, 0x0A, 0x61, 0x7F, 0xFF, 0x03, 0x62,
     0x63, 0x74, 0x7D, 0x68, 0x9E, 0x7D, 0x4F, 0x00, 0x66, 0x6B, 0x6C, 0x6E, 0x72, 0x74, 0x75, 0x7D,
     0x68, 0x95, 0x7D, 0x69, 0x12, 0x7D, 0x6A, 0xFB, 0x7F, 0xFF, 0xF7, 0x7D, 0x74, 0x7D, 0x7D, 0x68,
     0x95, 0x61, 0xA4, 0x7E, 0x0F, 0xB3, 0x67, 0x65, 0x66, 0x67, 0x68, 0x6E, 0x73, 0x77, 0x7D, 0x99,
@@ -11098,20 +11098,20 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x72, 0x62, 0x70, 0x72, 0x7D, 0x68, 0x3C, 0x7D, 0x71, 0x13, 0x62, 0x6C, 0x72, 0x7F, 0x94, 0x32,
     0x7D, 0x6A, 0x2C, 0x65, 0x65, 0x66, 0x68, 0x6C, 0x6F, 0x7F, 0xFF, 0xF7, 0x7D, 0x6A, 0x20, 0x7D,
     0x69, 0x59, 0x7D, 0x50, 0xCC, 0x7D, 0x4F, 0x3F, 0x62, 0x6E, 0x72, 0x7D, 0x68, 0x15, 0x7D, 0x68,
-    0x59, 0xEC, 0x02, 0xF1, 0x2E, 0x61, 0xC3, 0x62, 0x65, 0x69, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75,
-    0x7D, 0x68, 0x89, 0x7F, 0xFF, 0x77, 0x7F, 0xFF, 0x90, 0x7D, 0xB4, 0x03, 0x7F, 0xFF, 0xB2, 0x7F,
-    0xFF, 0xBF, 0x7F, 0xC6, 0x74, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xE2, 0x7D, 0x4E, 0x6B, 0x7D, 0x4E,
-    0x6B, 0x7F, 0xFF, 0xF7, 0x67, 0x62, 0x64, 0x65, 0x67, 0x6E, 0x72, 0x75, 0x7D, 0xB6, 0x14, 0x7D,
+    0x59, 0xEC, 0x02, 0xF1, 0x2E, 0x61, 0x62, 0x65, 0x69, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xC3,
+    0x7D, 0x68, 0x89, 0x7F, 0xFF, 0x77, 0x7D, 0xB4, 0x03, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xBF, 0x7F,
+    0xC6, 0x74, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xE2, 0x7D, 0x4E, 0x6B, 0x7D, 0x4E, 0x6B, 0x7F, 0xFF,
+    0xF7, 0x7F, 0xFF, 0x90, 0x67, 0x62, 0x64, 0x65, 0x67, 0x6E, 0x72, 0x75, 0x7D, 0xB6, 0x14, 0x7D,
     0x4E, 0x6E, 0x7D, 0x8E, 0x81, 0x7D, 0xB6, 0x14, 0x7D, 0x67, 0xD9, 0x7D, 0x70, 0xB0, 0x7D, 0x4E,
     0x35, 0xE1, 0x06, 0xC1, 0x68, 0x7D, 0x4E, 0x18, 0x21, 0xA4, 0xF9, 0x62, 0x6C, 0x70, 0x7D, 0x74,
     0x86, 0x7D, 0x74, 0x86, 0x68, 0x61, 0x66, 0x68, 0x6B, 0x6C, 0x70, 0x72, 0x74, 0x7F, 0xFF, 0xF7,
     0x7D, 0x69, 0x9F, 0x7D, 0x69, 0x9F, 0x7D, 0x69, 0x9F, 0x7D, 0x69, 0x9F, 0x7D, 0x69, 0x9F, 0x7D,
     0x4E, 0x3E, 0x7D, 0x69, 0x9F, 0x62, 0x2E, 0x64, 0x7D, 0x87, 0x4D, 0x7D, 0x4F, 0x38, 0x64, 0x64,
     0x65, 0x73, 0x74, 0x7D, 0x67, 0xC6, 0x7D, 0x96, 0xDE, 0x7D, 0x67, 0xC6, 0x7D, 0x67, 0xC6, 0x6D,
-    0x65, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0xC3, 0x70, 0x73, 0x74, 0x75, 0x7D, 0x82, 0x2C,
+    0x65, 0x66, 0x67, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x75, 0xC3, 0x7D, 0x82, 0x2C,
     0x7D, 0x67, 0x6E, 0x7D, 0x74, 0x42, 0x7D, 0x67, 0xB5, 0x7D, 0x67, 0xB5, 0x7D, 0x4D, 0xD0, 0x7D,
-    0x67, 0xB5, 0x7D, 0x67, 0xB5, 0x7D, 0xD6, 0xDE, 0x7D, 0x67, 0xB5, 0x7D, 0x67, 0xB5, 0x7D, 0x67,
-    0xB5, 0x7D, 0x67, 0x6E, 0x62, 0x63, 0x73, 0x7D, 0x4E, 0x65, 0x7D, 0x67, 0x39, 0x6E, 0x2E, 0x62,
+    0x67, 0xB5, 0x7D, 0x67, 0xB5, 0x7D, 0x67, 0xB5, 0x7D, 0x67, 0xB5, 0x7D, 0x67, 0xB5, 0x7D, 0x67,
+    0x6E, 0x7D, 0xD6, 0xDE, 0x62, 0x63, 0x73, 0x7D, 0x4E, 0x65, 0x7D, 0x67, 0x39, 0x6E, 0x2E, 0x62,
     0x63, 0x64, 0x66, 0x69, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7D, 0x68, 0x14, 0x7D,
     0x70, 0x07, 0x7D, 0x4D, 0x8C, 0x7D, 0x67, 0x74, 0x7D, 0x67, 0x30, 0x7F, 0xFF, 0xA8, 0x7D, 0x67,
     0x74, 0x7F, 0xFF, 0xB1, 0x7D, 0x67, 0x30, 0x7F, 0xFF, 0xC2, 0x7F, 0xFF, 0xF7, 0x7D, 0xBF, 0xD5,
@@ -11127,10 +11127,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0xC3, 0x7E, 0xE1, 0xEC, 0x67, 0x61, 0x65, 0x68, 0x69, 0x6B, 0x72, 0x7A, 0x7F, 0xFF, 0xD4,
     0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xEE, 0x7D, 0x8C, 0xB2, 0x7D, 0x68, 0x5E, 0x7F, 0xFF, 0xFB, 0x7D,
     0x67, 0x97, 0x63, 0x65, 0x77, 0x79, 0x7F, 0x8F, 0xE7, 0x7F, 0xEA, 0xBC, 0x7D, 0x82, 0xEC, 0x70,
-    0x2E, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x79, 0x7A,
-    0x7D, 0x68, 0x31, 0x7F, 0xFE, 0x65, 0x7F, 0xFE, 0x89, 0x7F, 0xFE, 0x95, 0x7F, 0xFF, 0x0E, 0x7D,
-    0x56, 0x1C, 0x7F, 0xFF, 0x4C, 0x7F, 0xFF, 0x61, 0x7D, 0x4C, 0x9D, 0x7D, 0x4E, 0x62, 0x7F, 0xFF,
-    0x6E, 0x7D, 0x66, 0xBB, 0x7F, 0xFF, 0x95, 0x7F, 0xFF, 0xD6, 0x7D, 0x66, 0x15, 0x7F, 0xFF, 0xF3,
+    0x2E, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x79, 0x7A, 0xC3,
+    0x7D, 0x68, 0x31, 0x7F, 0xFE, 0x65, 0x7F, 0xFE, 0x95, 0x7F, 0xFF, 0x0E, 0x7D, 0x56, 0x1C, 0x7F,
+    0xFF, 0x4C, 0x7F, 0xFF, 0x61, 0x7D, 0x4C, 0x9D, 0x7D, 0x4E, 0x62, 0x7F, 0xFF, 0x6E, 0x7D, 0x66,
+    0xBB, 0x7F, 0xFF, 0x95, 0x7F, 0xFF, 0xD6, 0x7D, 0x66, 0x15, 0x7F, 0xFF, 0xF3, 0x7F, 0xFE, 0x89,
     0x61, 0x69, 0x7D, 0x85, 0xC2, 0x21, 0x65, 0xFB, 0x64, 0x62, 0x66, 0x72, 0x75, 0x7D, 0x4C, 0xC1,
     0x7D, 0x72, 0x67, 0x7F, 0xFF, 0xFD, 0x7D, 0x66, 0xD9, 0xE5, 0x02, 0xF1, 0x2E, 0x66, 0x69, 0x6F,
     0x70, 0x7D, 0x66, 0xC5, 0x7D, 0x72, 0x56, 0x7D, 0xD0, 0x21, 0x7D, 0xB3, 0x09, 0x7E, 0x53, 0x26,
@@ -11151,10 +11151,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x64, 0xFC, 0xE2, 0x07, 0x72, 0x61, 0x69, 0x7D, 0x65, 0x32, 0x7D, 0x65, 0x32, 0xE1, 0x07, 0x52,
     0x68, 0x7D, 0x4C, 0xE1, 0x65, 0x64, 0x65, 0x73, 0x74, 0x7A, 0x7D, 0x65, 0x20, 0x7D, 0x94, 0x38,
     0x7D, 0x65, 0x20, 0x7F, 0xFF, 0xF9, 0x7D, 0x73, 0x9C, 0x61, 0xB6, 0x7D, 0x4C, 0xC5, 0xED, 0x07,
-    0x71, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6B, 0x6E, 0x6F, 0xC3, 0x70, 0x72, 0x73, 0x77, 0x7D, 0x65,
+    0x71, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6B, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x77, 0xC3, 0x7D, 0x65,
     0x06, 0x7D, 0x65, 0x06, 0x7D, 0x65, 0x06, 0x7D, 0x65, 0x06, 0x7D, 0x4B, 0x21, 0x7D, 0x69, 0x4B,
-    0x7D, 0x4C, 0x6F, 0x7D, 0x4C, 0xC0, 0x7F, 0xFF, 0xFB, 0x7D, 0x65, 0x06, 0x7D, 0x65, 0x06, 0x7D,
-    0x65, 0x06, 0x7D, 0x65, 0x06, 0x6B, 0x2E, 0x62, 0x63, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73,
+    0x7D, 0x4C, 0x6F, 0x7D, 0x4C, 0xC0, 0x7D, 0x65, 0x06, 0x7D, 0x65, 0x06, 0x7D, 0x65, 0x06, 0x7D,
+    0x65, 0x06, 0x7F, 0xFF, 0xFB, 0x6B, 0x2E, 0x62, 0x63, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73,
     0x74, 0x7D, 0x65, 0x05, 0x7D, 0x6D, 0x5F, 0x7D, 0xB2, 0x1F, 0x7F, 0xFF, 0x8C, 0x7D, 0x67, 0xD1,
     0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xAF, 0x7D, 0x65, 0xB7, 0x7F, 0xFF, 0xC9, 0x7D, 0x65, 0x05, 0x7D,
     0x6D, 0x5F, 0x61, 0x67, 0x7D, 0x4F, 0x51, 0x21, 0x6C, 0xFB, 0x21, 0x6F, 0xFD, 0x62, 0x62, 0x6E,
@@ -11177,12 +11177,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x44, 0x21, 0x65, 0xFB, 0x21, 0x73, 0xFD, 0x62, 0x67, 0x73, 0x7F, 0xFF, 0xFD, 0x7D, 0x49, 0xA8,
     0xE2, 0x00, 0x51, 0x66, 0x6E, 0x7D, 0x77, 0xB0, 0x7F, 0xFF, 0xF7, 0xE2, 0x00, 0x91, 0x2E, 0x73,
     0x7D, 0x70, 0x06, 0x7D, 0x49, 0xFB, 0x63, 0x62, 0x65, 0x67, 0x7D, 0x65, 0x1D, 0x7F, 0xFF, 0xF5,
-    0x7D, 0x65, 0x1D, 0x75, 0x2E, 0x61, 0xC3, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C,
-    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x7A, 0x7D, 0x64, 0x8A, 0x7F, 0xFD, 0x82, 0x7F,
-    0xFD, 0xC2, 0x7F, 0xFD, 0xE2, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x92, 0x7F, 0xFE, 0xC7, 0x7F, 0xFE,
-    0xD3, 0x7F, 0xFE, 0xF5, 0x7F, 0xFF, 0x12, 0x7F, 0xFF, 0x42, 0x7F, 0xFF, 0x4D, 0x7D, 0xDB, 0xA7,
-    0x7F, 0xFF, 0x50, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x86, 0x7F, 0xFF, 0x92, 0x7F, 0xFF, 0xAF, 0x7F,
-    0xFF, 0xC0, 0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xF3, 0x62, 0x6B, 0x75, 0x7D, 0xB1, 0x00, 0x7D, 0x63,
+    0x7D, 0x65, 0x1D, 0x75, 0x2E, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7D, 0x64, 0x8A, 0x7F, 0xFD, 0x82, 0x7F,
+    0xFD, 0xE2, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x92, 0x7F, 0xFE, 0xC7, 0x7F, 0xFE, 0xD3, 0x7F, 0xFE,
+    0xF5, 0x7F, 0xFF, 0x12, 0x7F, 0xFF, 0x42, 0x7F, 0xFF, 0x4D, 0x7D, 0xDB, 0xA7, 0x7F, 0xFF, 0x50,
+    0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x86, 0x7F, 0xFF, 0x92, 0x7F, 0xFF, 0xAF, 0x7F, 0xFF, 0xC0, 0x7F,
+    0xFF, 0xDD, 0x7F, 0xFF, 0xF3, 0x7F, 0xFD, 0xC2, 0x62, 0x6B, 0x75, 0x7D, 0xB1, 0x00, 0x7D, 0x63,
     0x09, 0x63, 0x62, 0x65, 0x6C, 0x7D, 0x49, 0x1E, 0x7D, 0x93, 0xE9, 0x7D, 0x49, 0x1E, 0x64, 0x6C,
     0x70, 0x72, 0x78, 0x7D, 0x7D, 0x6D, 0x7D, 0x62, 0xF3, 0x7F, 0xFF, 0xF3, 0x7D, 0x62, 0xAF, 0x64,
     0x61, 0x65, 0x68, 0x6F, 0x7D, 0x4A, 0x05, 0x7D, 0x49, 0xB0, 0x7D, 0x62, 0x9E, 0x7D, 0x4A, 0x05,
@@ -11246,12 +11246,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x9D, 0x27, 0xE1, 0x00, 0xE1, 0x6E, 0x7D, 0x5F, 0xDE, 0x22, 0x61, 0x69, 0xF4, 0xF9, 0xE7,
     0x06, 0xB1, 0x62, 0x65, 0x68, 0x70, 0x72, 0x73, 0x74, 0x7D, 0x5F, 0xCF, 0x7D, 0x5E, 0xE4, 0x7D,
     0x5F, 0xCF, 0x7D, 0x5F, 0xCF, 0x7D, 0x5E, 0xC2, 0x7D, 0x5E, 0xC2, 0x7D, 0x5F, 0xCF, 0xE1, 0x06,
-    0xF1, 0x69, 0x7D, 0x7E, 0xAE, 0x61, 0x64, 0x7D, 0x5F, 0xA9, 0x75, 0x2E, 0x61, 0xC3, 0x62, 0x63,
-    0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x79,
-    0x7D, 0x5F, 0xA4, 0x7F, 0xFE, 0x81, 0x7F, 0xFE, 0x98, 0x7D, 0x5F, 0xA4, 0x7D, 0x5F, 0xA4, 0x7F,
-    0xFE, 0xFC, 0x7D, 0x5F, 0xA4, 0x7D, 0x5F, 0xA4, 0x7F, 0xFF, 0x44, 0x7D, 0x5F, 0xA4, 0x7D, 0x9C,
-    0x8A, 0x7F, 0xFF, 0x65, 0x7F, 0xFF, 0x6C, 0x7F, 0xFF, 0x97, 0x7D, 0x5F, 0xA4, 0x7F, 0xFF, 0xD0,
-    0x7D, 0x5F, 0xA4, 0x7D, 0x9C, 0xB2, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFB, 0x66,
+    0xF1, 0x69, 0x7D, 0x7E, 0xAE, 0x61, 0x64, 0x7D, 0x5F, 0xA9, 0x75, 0x2E, 0x61, 0x62, 0x63, 0x65,
+    0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x79, 0xC3,
+    0x7D, 0x5F, 0xA4, 0x7F, 0xFE, 0x81, 0x7D, 0x5F, 0xA4, 0x7D, 0x5F, 0xA4, 0x7F, 0xFE, 0xFC, 0x7D,
+    0x5F, 0xA4, 0x7D, 0x5F, 0xA4, 0x7F, 0xFF, 0x44, 0x7D, 0x5F, 0xA4, 0x7D, 0x9C, 0x8A, 0x7F, 0xFF,
+    0x65, 0x7F, 0xFF, 0x6C, 0x7F, 0xFF, 0x97, 0x7D, 0x5F, 0xA4, 0x7F, 0xFF, 0xD0, 0x7D, 0x5F, 0xA4,
+    0x7D, 0x9C, 0xB2, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xFB, 0x7F, 0xFE, 0x98, 0x66,
     0x63, 0x67, 0x6C, 0x6D, 0x70, 0x73, 0x7D, 0x5F, 0x52, 0x7E, 0xE9, 0xFD, 0x7D, 0xB6, 0xBF, 0x7D,
     0x6A, 0xE0, 0x7D, 0x6A, 0xE0, 0x7D, 0x5F, 0x52, 0x61, 0x65, 0x7D, 0xBF, 0xCE, 0x63, 0x65, 0x6B,
     0x6F, 0x7D, 0x5F, 0x34, 0x7F, 0xFF, 0xFB, 0x7D, 0x44, 0xAF, 0x63, 0x61, 0x65, 0x6E, 0x7D, 0x5E,
@@ -11298,10 +11298,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x64, 0xAE, 0x62, 0x6C, 0x73, 0x7D, 0x68, 0x8F, 0x7D, 0x42, 0xED, 0x64, 0x2E, 0x65, 0x70, 0x75,
     0x7D, 0x5D, 0x22, 0x7F, 0xFF, 0xF7, 0x7D, 0x43, 0xDC, 0x7D, 0x78, 0x53, 0x62, 0x2E, 0x72, 0x7D,
     0x5D, 0x9A, 0x7D, 0x68, 0x75, 0x21, 0x65, 0xF7, 0x6E, 0x61, 0x65, 0x66, 0x67, 0x69, 0x6A, 0x6B,
-    0x6E, 0x6F, 0xC3, 0x73, 0x74, 0x75, 0x76, 0x7F, 0xFF, 0x52, 0x7F, 0xFF, 0x6F, 0x7F, 0xFF, 0x86,
+    0x6E, 0x6F, 0x73, 0x74, 0x75, 0x76, 0xC3, 0x7F, 0xFF, 0x52, 0x7F, 0xFF, 0x6F, 0x7F, 0xFF, 0x86,
     0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB8, 0x7D, 0x5D, 0x34, 0x7F, 0xFF, 0xC1, 0x7E, 0xE7, 0x24, 0x7F,
-    0xFF, 0xCA, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xFD, 0x7E, 0xDE, 0x99, 0x7D, 0x5D,
-    0x34, 0xE1, 0x07, 0x71, 0x6E, 0x7F, 0x2B, 0x94, 0x63, 0x2E, 0x70, 0x73, 0x7D, 0x5B, 0xD2, 0x7D,
+    0xFF, 0xCA, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xFD, 0x7E, 0xDE, 0x99, 0x7D, 0x5D, 0x34, 0x7F, 0xFF,
+    0xD5, 0xE1, 0x07, 0x71, 0x6E, 0x7F, 0x2B, 0x94, 0x63, 0x2E, 0x70, 0x73, 0x7D, 0x5B, 0xD2, 0x7D,
     0x42, 0xBC, 0x7D, 0x5B, 0xD2, 0x61, 0x75, 0x7D, 0xFF, 0x31, 0x62, 0x64, 0x6E, 0x7D, 0x5B, 0xC0,
     0x7D, 0x5B, 0x24, 0x65, 0x61, 0x64, 0x65, 0x68, 0x6E, 0x7F, 0xFF, 0xF7, 0x7D, 0x5C, 0xD9, 0x7D,
     0x5C, 0x1E, 0x7D, 0x67, 0xAC, 0x7D, 0x93, 0x17, 0x65, 0x2E, 0x63, 0x69, 0x6E, 0x73, 0x7D, 0x5C,
@@ -11345,10 +11345,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xFD, 0x7D, 0x3F, 0x83, 0x7D, 0x60, 0x65, 0x7D, 0x9E, 0x73, 0x62, 0x68, 0x6B, 0x7D, 0x59,
     0x3F, 0x7D, 0x59, 0xF1, 0x63, 0x2E, 0x73, 0x75, 0x7D, 0x5A, 0xA9, 0x7D, 0x5A, 0xAF, 0x7D, 0x59,
     0xE8, 0x62, 0x66, 0x73, 0x7D, 0x59, 0x29, 0x7D, 0x59, 0xDB, 0x62, 0x68, 0x6F, 0x7D, 0x59, 0x87,
-    0x7D, 0x59, 0x87, 0x6C, 0x63, 0x64, 0x66, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0xC3, 0x74,
+    0x7D, 0x59, 0x87, 0x6C, 0x63, 0x64, 0x66, 0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0xC3,
     0x7F, 0xFF, 0xD8, 0x7D, 0xC3, 0x8C, 0x7D, 0x3F, 0x66, 0x7D, 0xC3, 0x8C, 0x7F, 0xFF, 0xE1, 0x7D,
-    0x65, 0x0C, 0x7D, 0x5A, 0x8D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7D, 0x58, 0x90, 0x7D, 0x9D,
-    0x6E, 0x7D, 0x58, 0x90, 0x62, 0x73, 0x74, 0x7D, 0x5B, 0xB6, 0x7D, 0x3F, 0x9E, 0x61, 0x74, 0x7D,
+    0x65, 0x0C, 0x7D, 0x5A, 0x8D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7D, 0x58, 0x90, 0x7D, 0x58,
+    0x90, 0x7D, 0x9D, 0x6E, 0x62, 0x73, 0x74, 0x7D, 0x5B, 0xB6, 0x7D, 0x3F, 0x9E, 0x61, 0x74, 0x7D,
     0x61, 0xAF, 0x63, 0x69, 0x6E, 0x72, 0x7D, 0x3F, 0x8D, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x68,
     0x61, 0x65, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x7D, 0x3F, 0x14, 0x7F, 0xFF, 0xF3, 0x7D, 0x59,
     0x7D, 0x7D, 0x3F, 0x14, 0x7D, 0x3F, 0x17, 0x7D, 0x3F, 0x14, 0x7D, 0x3F, 0x4F, 0x7D, 0x3F, 0xB2,
@@ -11382,11 +11382,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xE7, 0x62, 0x64, 0x6E, 0x7D, 0x5F, 0x53, 0x7F, 0xFF, 0xF7, 0x63, 0x62, 0x65, 0x70, 0x7D, 0x56,
     0x73, 0x7D, 0x56, 0x73, 0x7D, 0x56, 0x73, 0xE1, 0x07, 0xC2, 0x74, 0x7D, 0x3C, 0xFB, 0x65, 0x2E,
     0x61, 0x68, 0x6E, 0x73, 0x7D, 0x58, 0x55, 0x7D, 0x42, 0x60, 0x7D, 0x58, 0x55, 0x7D, 0x58, 0x55,
-    0x7F, 0xFF, 0xF9, 0x70, 0x2E, 0x61, 0xC3, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6E, 0x6F, 0x73,
-    0x74, 0x75, 0x77, 0x7A, 0x7D, 0x56, 0xC7, 0x7F, 0xFF, 0x7B, 0x7D, 0x70, 0xA7, 0x7F, 0xFF, 0x98,
-    0x7D, 0x68, 0xCE, 0x7F, 0xFF, 0xA9, 0x7D, 0x40, 0x19, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xCE, 0x7D,
-    0x3C, 0xA6, 0x7F, 0xFF, 0xD7, 0x7D, 0x56, 0xC7, 0x7F, 0xFF, 0xEB, 0x7D, 0x46, 0x3A, 0x7D, 0x56,
-    0xC7, 0x7D, 0x3C, 0xA9, 0xE1, 0x00, 0xA1, 0x73, 0x7D, 0xDE, 0xC1, 0x21, 0x72, 0xF9, 0x21, 0x65,
+    0x7F, 0xFF, 0xF9, 0x70, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6E, 0x6F, 0x73, 0x74,
+    0x75, 0x77, 0x7A, 0xC3, 0x7D, 0x56, 0xC7, 0x7F, 0xFF, 0x7B, 0x7F, 0xFF, 0x98, 0x7D, 0x68, 0xCE,
+    0x7F, 0xFF, 0xA9, 0x7D, 0x40, 0x19, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xCE, 0x7D, 0x3C, 0xA6, 0x7F,
+    0xFF, 0xD7, 0x7D, 0x56, 0xC7, 0x7F, 0xFF, 0xEB, 0x7D, 0x46, 0x3A, 0x7D, 0x56, 0xC7, 0x7D, 0x3C,
+    0xA9, 0x7D, 0x70, 0xA7, 0xE1, 0x00, 0xA1, 0x73, 0x7D, 0xDE, 0xC1, 0x21, 0x72, 0xF9, 0x21, 0x65,
     0xFD, 0x63, 0x61, 0x6F, 0x75, 0x7D, 0x80, 0x5C, 0x7D, 0x3C, 0xC5, 0x7D, 0x5E, 0xAE, 0x68, 0x2E,
     0x61, 0x68, 0x6B, 0x6D, 0x70, 0x73, 0x74, 0x7D, 0x56, 0x6C, 0x7D, 0x56, 0x6C, 0x7D, 0x3C, 0xBB,
     0x7D, 0x5D, 0xDC, 0x7D, 0x62, 0x61, 0x7E, 0xD2, 0x16, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF3, 0xE1,
@@ -11394,12 +11394,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0xC3, 0x65, 0x68, 0x72, 0x73, 0x7D, 0x5E, 0xAB, 0x7D, 0x6A, 0x15, 0x7F, 0xFF, 0xF7, 0x7D,
     0x79, 0x63, 0x7D, 0xA6, 0xE0, 0x7D, 0x3D, 0xE2, 0xE2, 0x0C, 0xE2, 0x69, 0x6E, 0x7D, 0x75, 0x84,
     0x7D, 0x56, 0x89, 0xE1, 0x07, 0xA1, 0x69, 0x7D, 0x75, 0x49, 0x76, 0x61, 0x62, 0x63, 0x64, 0x65,
-    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0xC3, 0x74, 0x75,
-    0x78, 0x7F, 0xFC, 0x69, 0x7F, 0xFC, 0x76, 0x7F, 0xFC, 0xAB, 0x7F, 0xFC, 0xBA, 0x7F, 0xFC, 0xF9,
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x78,
+    0xC3, 0x7F, 0xFC, 0x69, 0x7F, 0xFC, 0x76, 0x7F, 0xFC, 0xAB, 0x7F, 0xFC, 0xBA, 0x7F, 0xFC, 0xF9,
     0x7F, 0xFD, 0x66, 0x7D, 0x5B, 0xD7, 0x7D, 0xCE, 0x1D, 0x7F, 0xFD, 0x81, 0x7D, 0x56, 0x10, 0x7F,
     0xFD, 0x96, 0x7F, 0xFD, 0x9F, 0x7F, 0xFD, 0xCC, 0x7F, 0xFE, 0x23, 0x7D, 0x56, 0x10, 0x7F, 0xFE,
-    0x92, 0x7F, 0xFF, 0x49, 0x7F, 0xFF, 0xA4, 0x7D, 0x9A, 0x67, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xEE,
-    0x7F, 0xFF, 0xF9, 0x61, 0x72, 0x7E, 0x55, 0x31, 0xE2, 0x0B, 0xF3, 0x61, 0x68, 0x7F, 0xFF, 0xFB,
+    0x92, 0x7F, 0xFF, 0x49, 0x7F, 0xFF, 0xA4, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF9,
+    0x7D, 0x9A, 0x67, 0x61, 0x72, 0x7E, 0x55, 0x31, 0xE2, 0x0B, 0xF3, 0x61, 0x68, 0x7F, 0xFF, 0xFB,
     0x7D, 0x4C, 0xEA, 0xE1, 0x00, 0x81, 0x75, 0x7D, 0x3B, 0xF3, 0x62, 0x61, 0x6C, 0x7D, 0x3B, 0x85,
     0x7D, 0x3B, 0x85, 0x62, 0x68, 0x74, 0x7F, 0xFF, 0xF7, 0x7D, 0x55, 0x97, 0x63, 0x6D, 0x72, 0x73,
     0x7D, 0x3B, 0xDA, 0x7D, 0x3B, 0xDA, 0x7D, 0x61, 0xE5, 0x64, 0x65, 0x6F, 0x74, 0x75, 0x7D, 0x58,
@@ -11420,11 +11420,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x8B, 0x7D, 0xDF, 0x0A, 0x7D, 0x3A, 0xF0, 0x62, 0x2E, 0x76, 0x7D, 0x55, 0x45, 0x7D, 0x60, 0xEA,
     0x65, 0x2E, 0x62, 0x63, 0x70, 0xC3, 0x7D, 0x54, 0x8A, 0x7F, 0xFF, 0xF7, 0x7D, 0x55, 0x3C, 0x7D,
     0x56, 0x03, 0x7F, 0xB1, 0x71, 0x73, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
-    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0xC3, 0x74, 0x75, 0x7D, 0x55, 0x68, 0x7D, 0x3A, 0x54, 0x7F,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x73, 0x74, 0x75, 0xC3, 0x7D, 0x55, 0x68, 0x7D, 0x3A, 0x54, 0x7F,
     0xFE, 0xCE, 0x7F, 0xFE, 0xDE, 0x7F, 0xFF, 0x05, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0x40, 0x7F, 0xFF,
     0x55, 0x7F, 0xFF, 0x5E, 0x7F, 0xFF, 0x6B, 0x7F, 0xFF, 0x72, 0x7F, 0xFF, 0x80, 0x7D, 0xF7, 0xD9,
-    0x7F, 0xFF, 0xAC, 0x7D, 0x56, 0x2F, 0x7F, 0xFF, 0xCE, 0x7F, 0xB1, 0x5C, 0x7F, 0xFF, 0xD1, 0x7F,
-    0xFF, 0xEB, 0x63, 0x64, 0x65, 0x67, 0x7D, 0x54, 0xDA, 0x7D, 0x54, 0x28, 0x7D, 0x54, 0xDA, 0x63,
+    0x7F, 0xFF, 0xAC, 0x7D, 0x56, 0x2F, 0x7F, 0xFF, 0xCE, 0x7F, 0xFF, 0xD1, 0x7F, 0xFF, 0xEB, 0x7F,
+    0xB1, 0x5C, 0x63, 0x64, 0x65, 0x67, 0x7D, 0x54, 0xDA, 0x7D, 0x54, 0x28, 0x7D, 0x54, 0xDA, 0x63,
     0x63, 0x73, 0xC3, 0x7D, 0x54, 0xCD, 0x7D, 0x54, 0xCD, 0x7F, 0xB1, 0x02, 0x67, 0x64, 0x67, 0x68,
     0x6E, 0x73, 0xC3, 0x75, 0x7D, 0x55, 0x30, 0x7D, 0x54, 0x0E, 0x7D, 0x54, 0x72, 0x7F, 0xFF, 0xE6,
     0x7D, 0x54, 0x72, 0x7D, 0x98, 0x65, 0x7F, 0xFF, 0xF3, 0x66, 0x63, 0x68, 0x6D, 0x6E, 0x70, 0x73,
@@ -11437,9 +11437,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x06, 0xF1, 0x68, 0x6B, 0xC3, 0x7D, 0x52, 0xEF, 0x7D, 0x82, 0xD6, 0x7F, 0xFF, 0xFB, 0x64, 0x65,
     0x66, 0x6C, 0x6F, 0x7D, 0x54, 0x2E, 0x7D, 0x54, 0xF2, 0x7D, 0x54, 0x2E, 0x7D, 0x54, 0xF5, 0x61,
     0x9F, 0x7D, 0x52, 0xCF, 0xC1, 0x07, 0x91, 0x65, 0x92, 0x50, 0x6C, 0x62, 0x63, 0x66, 0x67, 0x68,
-    0x6B, 0x6D, 0x6E, 0x73, 0xC3, 0x74, 0x7A, 0x7D, 0x3F, 0xF8, 0x7D, 0x54, 0x12, 0x7D, 0x54, 0x12,
+    0x6B, 0x6D, 0x6E, 0x73, 0x74, 0x7A, 0xC3, 0x7D, 0x3F, 0xF8, 0x7D, 0x54, 0x12, 0x7D, 0x54, 0x12,
     0x7D, 0x54, 0xD9, 0x7D, 0x54, 0xD9, 0x7D, 0x54, 0x12, 0x7D, 0x54, 0xD9, 0x7D, 0x54, 0xD9, 0x7D,
-    0x3E, 0x68, 0x7F, 0xFF, 0xF5, 0x7F, 0xFF, 0xFA, 0x7D, 0x52, 0xC4, 0xE1, 0x07, 0x71, 0x69, 0x7D,
+    0x3E, 0x68, 0x7F, 0xFF, 0xFA, 0x7D, 0x52, 0xC4, 0x7F, 0xFF, 0xF5, 0xE1, 0x07, 0x71, 0x69, 0x7D,
     0x53, 0xE1, 0x64, 0x61, 0x64, 0x6E, 0x74, 0x7D, 0x52, 0x8C, 0x7F, 0xFF, 0xF9, 0x7D, 0x54, 0xA7,
     0x7D, 0x54, 0xA1, 0x65, 0x61, 0x65, 0x6F, 0x70, 0x72, 0x7D, 0x52, 0x7B, 0x7D, 0x53, 0xC9, 0x7D,
     0x54, 0x90, 0x7D, 0x54, 0x93, 0x7D, 0x53, 0xC9, 0x62, 0x6B, 0x6E, 0x7D, 0x55, 0xD2, 0x7D, 0x54,
@@ -11507,10 +11507,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x59, 0xA2, 0x7D, 0x59, 0xA2, 0x7D, 0x59, 0xA2, 0x62, 0x6E, 0x74, 0x7F, 0xFF, 0xE7, 0x7D, 0x51,
     0xF2, 0x63, 0x65, 0x71, 0x74, 0x7D, 0x39, 0xFC, 0x7D, 0x50, 0x0C, 0x7D, 0x50, 0xF8, 0x62, 0x69,
     0x6F, 0x7D, 0x64, 0x1A, 0x7D, 0x4F, 0x73, 0xF1, 0x02, 0xF1, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0xC3, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0x7D, 0x58, 0x0C, 0x7D, 0x4F,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3, 0x7D, 0x58, 0x0C, 0x7D, 0x4F,
     0x6A, 0x7D, 0x4F, 0x6A, 0x7D, 0x4F, 0x6A, 0x7D, 0xA6, 0x34, 0x7D, 0x4F, 0x6A, 0x7D, 0x4F, 0x6A,
-    0x7D, 0x4F, 0x6A, 0x7D, 0x4F, 0x6A, 0x7D, 0x58, 0x0C, 0x7E, 0x06, 0x5B, 0x7D, 0x4F, 0x6A, 0x7D,
-    0x4F, 0x6A, 0x7D, 0x4F, 0x6A, 0x7D, 0x36, 0xAA, 0x7D, 0x4F, 0x6A, 0x7D, 0x4F, 0x6A, 0x61, 0x73,
+    0x7D, 0x4F, 0x6A, 0x7D, 0x4F, 0x6A, 0x7D, 0x58, 0x0C, 0x7D, 0x4F, 0x6A, 0x7D, 0x4F, 0x6A, 0x7D,
+    0x4F, 0x6A, 0x7D, 0x36, 0xAA, 0x7D, 0x4F, 0x6A, 0x7D, 0x4F, 0x6A, 0x7E, 0x06, 0x5B, 0x61, 0x73,
     0x7F, 0x76, 0x04, 0xE3, 0x00, 0xB1, 0x61, 0x68, 0x69, 0x7D, 0x63, 0xC5, 0x7D, 0x50, 0x96, 0x7D,
     0x50, 0x96, 0xE1, 0x02, 0xF2, 0x69, 0x7D, 0x61, 0xB2, 0x70, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69,
     0x6B, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x76, 0x78, 0x7D, 0x53, 0xA4, 0x7D, 0x34, 0xF0,
@@ -11551,11 +11551,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x4D, 0x79, 0x7D, 0x4D, 0x79, 0x7D, 0x4D, 0x79, 0x7D, 0x4E, 0x65, 0x7D, 0x4E, 0x65, 0x7D,
     0x4E, 0x65, 0x7D, 0x4D, 0x79, 0x67, 0x2E, 0x62, 0x6C, 0x6D, 0x6E, 0x72, 0x74, 0x7D, 0x4B, 0xAC,
     0x7D, 0xC4, 0x65, 0x7D, 0x56, 0x9E, 0x7F, 0xFF, 0xCF, 0x7D, 0x56, 0x9E, 0x7D, 0x56, 0x9E, 0x7D,
-    0x56, 0x9E, 0xF2, 0x06, 0xF1, 0x61, 0xC3, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F,
-    0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0x7F, 0xFC, 0x3D, 0x7F, 0xFC, 0x8A, 0x7D, 0x4C, 0x9F,
-    0x7F, 0xFC, 0xEC, 0x7F, 0xFD, 0x97, 0x7D, 0x74, 0xE2, 0x7F, 0xFD, 0xFB, 0x7F, 0xFE, 0x15, 0x7F,
-    0x21, 0x60, 0x7F, 0x49, 0x44, 0x7F, 0xFE, 0x3D, 0x7F, 0xFE, 0xAB, 0x7D, 0xA4, 0x0C, 0x7F, 0xFE,
-    0xCD, 0x7F, 0xFF, 0x8B, 0x7F, 0xFF, 0xE3, 0x7D, 0x3C, 0xA1, 0x7E, 0x22, 0x33, 0xE1, 0x09, 0x42,
+    0x56, 0x9E, 0xF2, 0x06, 0xF1, 0x61, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6F, 0x70,
+    0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3, 0x7F, 0xFC, 0x3D, 0x7D, 0x4C, 0x9F, 0x7F, 0xFC, 0xEC,
+    0x7F, 0xFD, 0x97, 0x7D, 0x74, 0xE2, 0x7F, 0xFD, 0xFB, 0x7F, 0xFE, 0x15, 0x7F, 0x21, 0x60, 0x7F,
+    0x49, 0x44, 0x7F, 0xFE, 0x3D, 0x7F, 0xFE, 0xAB, 0x7D, 0xA4, 0x0C, 0x7F, 0xFE, 0xCD, 0x7F, 0xFF,
+    0x8B, 0x7F, 0xFF, 0xE3, 0x7D, 0x3C, 0xA1, 0x7E, 0x22, 0x33, 0x7F, 0xFC, 0x8A, 0xE1, 0x09, 0x42,
     0x68, 0x7D, 0x59, 0x8C, 0x62, 0x68, 0x72, 0x7D, 0x4C, 0x4D, 0x7D, 0x4C, 0x4D, 0x61, 0x73, 0x7D,
     0x37, 0x35, 0x21, 0x65, 0xFB, 0x64, 0x61, 0xC3, 0x6C, 0x75, 0x7D, 0x4C, 0xE5, 0x7E, 0x79, 0xD1,
     0x7D, 0x35, 0x79, 0x7D, 0x4C, 0xE5, 0x66, 0x61, 0x62, 0x64, 0x6B, 0x72, 0x77, 0x7D, 0x4D, 0xA3,
@@ -11599,10 +11599,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xC3, 0x65, 0x75, 0x7D, 0x56, 0xFF, 0x7D, 0xCF, 0x38, 0x7D, 0x5F, 0xF1, 0x7D, 0x2F, 0xB8, 0x66,
     0x61, 0x63, 0x65, 0x70, 0x74, 0x75, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xE2, 0x7D,
     0x42, 0x89, 0x7F, 0xFF, 0xEF, 0x7D, 0x5F, 0xE0, 0x64, 0x65, 0x66, 0x68, 0x72, 0x7D, 0x37, 0xF1,
-    0x7D, 0x72, 0x5F, 0x7D, 0x49, 0xA9, 0x7D, 0x31, 0xDA, 0xEC, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x68,
-    0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x77, 0x7A, 0x7F, 0xFD, 0x93, 0x7F, 0xFD, 0xCD, 0x7F, 0xFE,
-    0xC6, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x1F, 0x7F, 0xFF, 0x40, 0x7F, 0xFF, 0x67, 0x7F, 0xFF, 0x95,
-    0x7F, 0xFF, 0xD6, 0x7F, 0xFF, 0xEF, 0x7D, 0x76, 0xB0, 0x7D, 0x2F, 0x80, 0x64, 0x2E, 0x6D, 0x70,
+    0x7D, 0x72, 0x5F, 0x7D, 0x49, 0xA9, 0x7D, 0x31, 0xDA, 0xEC, 0x06, 0xF1, 0x61, 0x65, 0x68, 0x69,
+    0x6C, 0x6F, 0x72, 0x73, 0x75, 0x77, 0x7A, 0xC3, 0x7F, 0xFD, 0x93, 0x7F, 0xFE, 0xC6, 0x7F, 0xFF,
+    0x00, 0x7F, 0xFF, 0x1F, 0x7F, 0xFF, 0x40, 0x7F, 0xFF, 0x67, 0x7F, 0xFF, 0x95, 0x7F, 0xFF, 0xD6,
+    0x7F, 0xFF, 0xEF, 0x7D, 0x76, 0xB0, 0x7D, 0x2F, 0x80, 0x7F, 0xFD, 0xCD, 0x64, 0x2E, 0x6D, 0x70,
     0x76, 0x7D, 0x49, 0x65, 0x7D, 0x49, 0x65, 0x7D, 0x49, 0x65, 0x7D, 0x49, 0x65, 0x63, 0x6C, 0x6E,
     0x72, 0x7F, 0xFF, 0xEF, 0x7D, 0x58, 0x07, 0x7D, 0x7C, 0x6A, 0x61, 0x62, 0x7D, 0x2F, 0x64, 0x21,
     0x61, 0xFB, 0xE3, 0x07, 0x71, 0x65, 0x6F, 0x73, 0x7D, 0x69, 0x52, 0x7D, 0x49, 0x3F, 0x7D, 0x2F,
@@ -11670,10 +11670,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x65, 0x72, 0x7D, 0x53, 0xC4, 0x7D, 0x53, 0xC4, 0xE1, 0x08, 0x82, 0x66, 0x7D, 0x2B, 0x09,
     0x21, 0xB6, 0xF9, 0x62, 0x61, 0xC3, 0x7D, 0xC3, 0x40, 0x7E, 0x5A, 0x7E, 0x21, 0x72, 0xF7, 0x61,
     0x65, 0x7D, 0x5D, 0x88, 0x6F, 0x2E, 0x62, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x6F,
-    0xC3, 0x74, 0x77, 0x7A, 0x7D, 0x47, 0xA6, 0x7E, 0x32, 0xF7, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xDC,
+    0x74, 0x77, 0x7A, 0xC3, 0x7D, 0x47, 0xA6, 0x7E, 0x32, 0xF7, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xDC,
     0x7E, 0x32, 0xF7, 0x7E, 0x01, 0x0A, 0x7E, 0x42, 0x9C, 0x7D, 0xA7, 0xD6, 0x7D, 0x8E, 0x93, 0x7D,
-    0x47, 0xA6, 0x7D, 0x2C, 0x09, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFB, 0x7D, 0x8E,
-    0x93, 0x66, 0x64, 0x69, 0x6C, 0x6E, 0x72, 0x73, 0x7D, 0x6A, 0x71, 0x7F, 0xFF, 0x58, 0x7F, 0xFF,
+    0x47, 0xA6, 0x7D, 0x2C, 0x09, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFB, 0x7D, 0x8E, 0x93, 0x7F, 0xFF,
+    0xEC, 0x66, 0x64, 0x69, 0x6C, 0x6E, 0x72, 0x73, 0x7D, 0x6A, 0x71, 0x7F, 0xFF, 0x58, 0x7F, 0xFF,
     0x6D, 0x7F, 0xFF, 0x87, 0x7F, 0xFF, 0xC3, 0x7D, 0x2A, 0xE8, 0x66, 0x64, 0x66, 0x68, 0x73, 0x74,
     0x76, 0x7D, 0x46, 0x5F, 0x7D, 0x44, 0xE7, 0x7D, 0x46, 0x5F, 0x7D, 0x6D, 0x84, 0x7D, 0x44, 0xE7,
     0x7D, 0x44, 0xE7, 0x64, 0x64, 0x6D, 0x6E, 0x73, 0x7D, 0x49, 0x6A, 0x7D, 0x6E, 0x0A, 0x7F, 0xFF,
@@ -11683,24 +11683,24 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0x64, 0x7D, 0x2A, 0xB7, 0x21, 0x6E, 0xFB, 0x62, 0x61, 0x69, 0x7F, 0xFF, 0xFD, 0x7D, 0xEF,
     0x0A, 0xC8, 0x06, 0xF1, 0x61, 0xC3, 0x65, 0x69, 0x6F, 0x74, 0x75, 0x77, 0xFE, 0xB0, 0xFE, 0xC4,
     0xFF, 0x80, 0xFF, 0xB2, 0xFF, 0xC3, 0xFF, 0xD8, 0xFF, 0xE6, 0xFF, 0xF7, 0xFB, 0x07, 0xB1, 0x61,
-    0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7F, 0xD4, 0xE0, 0x7F, 0xD6, 0xAF,
-    0x7F, 0xD6, 0xEC, 0x7F, 0xD7, 0x29, 0x7F, 0xD7, 0x4E, 0x7F, 0xE2, 0x45, 0x7F, 0xE2, 0xB0, 0x7F,
-    0xE3, 0x0E, 0x7F, 0xE4, 0xBE, 0x7F, 0xE9, 0x4C, 0x7D, 0x44, 0x62, 0x7F, 0xE9, 0x8E, 0x7F, 0xE9,
-    0xD2, 0x7F, 0xEA, 0x1D, 0x7F, 0xEA, 0x48, 0x7F, 0xED, 0xEE, 0x7F, 0xEE, 0x4C, 0x7D, 0x44, 0x62,
-    0x7F, 0xF3, 0x77, 0x7F, 0xF7, 0xC6, 0x7F, 0xFA, 0xCD, 0x7F, 0xFD, 0xFC, 0x7F, 0xFE, 0x46, 0x7F,
-    0xFE, 0x74, 0x7D, 0x48, 0xC5, 0x7F, 0xFE, 0x88, 0x7F, 0xFF, 0xE5, 0xE1, 0x07, 0x12, 0x68, 0x7D,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x7F, 0xD4, 0xE0, 0x7F, 0xD6, 0xEC,
+    0x7F, 0xD7, 0x29, 0x7F, 0xD7, 0x4E, 0x7F, 0xE2, 0x45, 0x7F, 0xE2, 0xB0, 0x7F, 0xE3, 0x0E, 0x7F,
+    0xE4, 0xBE, 0x7F, 0xE9, 0x4C, 0x7D, 0x44, 0x62, 0x7F, 0xE9, 0x8E, 0x7F, 0xE9, 0xD2, 0x7F, 0xEA,
+    0x1D, 0x7F, 0xEA, 0x48, 0x7F, 0xED, 0xEE, 0x7F, 0xEE, 0x4C, 0x7D, 0x44, 0x62, 0x7F, 0xF3, 0x77,
+    0x7F, 0xF7, 0xC6, 0x7F, 0xFA, 0xCD, 0x7F, 0xFD, 0xFC, 0x7F, 0xFE, 0x46, 0x7F, 0xFE, 0x74, 0x7D,
+    0x48, 0xC5, 0x7F, 0xFE, 0x88, 0x7F, 0xFF, 0xE5, 0x7F, 0xD6, 0xAF, 0xE1, 0x07, 0x12, 0x68, 0x7D,
     0x43, 0x12, 0x62, 0x61, 0x72, 0x7E, 0x07, 0x3E, 0x7D, 0x29, 0xD7, 0x61, 0xA4, 0x7E, 0x37, 0x7E,
     0x61, 0x74, 0x7D, 0xC6, 0x21, 0xE6, 0x01, 0x61, 0x66, 0x67, 0x6B, 0x6C, 0x72, 0x7A, 0x7D, 0xC6,
     0x1C, 0x7D, 0xC6, 0x1C, 0x7D, 0xC6, 0x1C, 0x7D, 0xC6, 0x1C, 0x7D, 0x43, 0x3F, 0x7D, 0xC6, 0x1C,
     0xE6, 0x00, 0x51, 0x62, 0x69, 0x6D, 0x6E, 0x72, 0x74, 0x7D, 0x56, 0x64, 0x7D, 0x56, 0x64, 0x7E,
     0x60, 0x76, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xE5, 0x7D, 0x56, 0x64, 0xE2, 0x02, 0xF1, 0x64, 0x6E,
-    0x7D, 0xC6, 0x12, 0x7D, 0xC6, 0x12, 0xE1, 0x02, 0x61, 0x6F, 0x7D, 0x29, 0x19, 0x73, 0x61, 0xC3,
-    0x62, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77,
-    0x7A, 0x7D, 0xC6, 0xF9, 0x7F, 0xFF, 0xAE, 0x7D, 0x42, 0x91, 0x7D, 0x42, 0x91, 0x7F, 0xFF, 0xD3,
-    0x7D, 0x42, 0x91, 0x7D, 0x42, 0x91, 0x7D, 0x42, 0x91, 0x7F, 0xFF, 0xEE, 0x7D, 0x42, 0x91, 0x7D,
-    0x42, 0x91, 0x7D, 0x4B, 0x4A, 0x7D, 0x29, 0x0F, 0x7D, 0x42, 0x91, 0x7D, 0x42, 0x91, 0x7F, 0xFF,
-    0xF9, 0x7D, 0x4B, 0x57, 0x7D, 0x42, 0x91, 0x7D, 0x29, 0x0F, 0x65, 0x2E, 0x61, 0x65, 0x73, 0x74,
+    0x7D, 0xC6, 0x12, 0x7D, 0xC6, 0x12, 0xE1, 0x02, 0x61, 0x6F, 0x7D, 0x29, 0x19, 0x73, 0x61, 0x62,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A,
+    0xC3, 0x7D, 0xC6, 0xF9, 0x7D, 0x42, 0x91, 0x7D, 0x42, 0x91, 0x7F, 0xFF, 0xD3, 0x7D, 0x42, 0x91,
+    0x7D, 0x42, 0x91, 0x7D, 0x42, 0x91, 0x7F, 0xFF, 0xEE, 0x7D, 0x42, 0x91, 0x7D, 0x42, 0x91, 0x7D,
+    0x4B, 0x4A, 0x7D, 0x29, 0x0F, 0x7D, 0x42, 0x91, 0x7D, 0x42, 0x91, 0x7F, 0xFF, 0xF9, 0x7D, 0x4B,
+    0x57, 0x7D, 0x42, 0x91, 0x7D, 0x29, 0x0F, 0x7F, 0xFF, 0xAE, 0x65, 0x2E, 0x61, 0x65, 0x73, 0x74,
     0x7D, 0x42, 0x44, 0x7D, 0xC2, 0x82, 0x7D, 0x42, 0x37, 0x7D, 0x42, 0x44, 0x7D, 0x40, 0x70, 0x63,
     0x61, 0x65, 0x73, 0x7D, 0x29, 0xB2, 0x7D, 0x29, 0xB2, 0x7D, 0x29, 0x14, 0xA0, 0x35, 0xF4, 0x21,
     0x6E, 0xFD, 0x62, 0x61, 0x73, 0x7F, 0xFF, 0xFD, 0x7D, 0x29, 0x01, 0x65, 0x61, 0x65, 0x6B, 0x74,
@@ -11753,10 +11753,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x29, 0x33, 0x7D, 0x26, 0x95, 0x62, 0x69, 0x72, 0x7E, 0x21, 0x43, 0x7F, 0xFF, 0xE7, 0x64,
     0x61, 0x65, 0x69, 0x73, 0x7D, 0x5D, 0x28, 0x7F, 0xFF, 0xF7, 0x7D, 0x2D, 0xEF, 0x7D, 0x2C, 0x44,
     0xE4, 0x20, 0x22, 0x68, 0x6D, 0x72, 0x74, 0x7D, 0x25, 0x89, 0x7D, 0x40, 0x9D, 0x7D, 0x40, 0x9D,
-    0x7D, 0x25, 0x89, 0x6D, 0x61, 0xC3, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75,
-    0x77, 0x7F, 0xFE, 0xC1, 0x7F, 0xFE, 0xEA, 0x7F, 0xFF, 0x26, 0x7F, 0xFF, 0x4D, 0x7D, 0x25, 0x76,
-    0x7F, 0xFF, 0x62, 0x7D, 0x25, 0x76, 0x7F, 0xFF, 0x6D, 0x7D, 0x25, 0x76, 0x7F, 0xFF, 0xA5, 0x7F,
-    0xFF, 0xDC, 0x7F, 0xFF, 0xED, 0x7D, 0x25, 0x76, 0x63, 0x65, 0x74, 0x7A, 0x7D, 0x42, 0x95, 0x7D,
+    0x7D, 0x25, 0x89, 0x6D, 0x61, 0x65, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x77,
+    0xC3, 0x7F, 0xFE, 0xC1, 0x7F, 0xFF, 0x26, 0x7F, 0xFF, 0x4D, 0x7D, 0x25, 0x76, 0x7F, 0xFF, 0x62,
+    0x7D, 0x25, 0x76, 0x7F, 0xFF, 0x6D, 0x7D, 0x25, 0x76, 0x7F, 0xFF, 0xA5, 0x7F, 0xFF, 0xDC, 0x7F,
+    0xFF, 0xED, 0x7D, 0x25, 0x76, 0x7F, 0xFE, 0xEA, 0x63, 0x65, 0x74, 0x7A, 0x7D, 0x42, 0x95, 0x7D,
     0x40, 0x55, 0x7F, 0x21, 0x6C, 0x63, 0x6C, 0x6E, 0x72, 0x7D, 0x56, 0xB8, 0x7F, 0xFF, 0xF3, 0x7F,
     0x19, 0xC6, 0xE1, 0x02, 0xF1, 0x6E, 0x7D, 0x25, 0x27, 0x62, 0x70, 0x74, 0x7D, 0x30, 0xEA, 0x7D,
     0x5C, 0x27, 0x64, 0x61, 0x65, 0x69, 0x73, 0x7D, 0x4A, 0x31, 0x7F, 0xFF, 0xE3, 0x7F, 0xFF, 0xF0,
@@ -11803,10 +11803,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x27, 0x2F, 0x7F, 0xFF, 0xFB, 0x7F, 0x98, 0xBD, 0x62, 0x61, 0x65, 0x7D, 0x24, 0x6C, 0x7F, 0xFF,
     0xEF, 0x61, 0x6F, 0x7D, 0x28, 0xA5, 0x63, 0x65, 0x6B, 0x70, 0x7F, 0xF7, 0x91, 0x7D, 0x23, 0xCD,
     0x7F, 0xFF, 0xFB, 0x63, 0x65, 0x69, 0x77, 0x7E, 0x1E, 0x0B, 0x7D, 0x2A, 0xBB, 0x7D, 0x22, 0xD3,
-    0xED, 0x06, 0xF1, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6F, 0x73, 0x76, 0x7A,
-    0x7F, 0xFF, 0x82, 0x7D, 0x50, 0x54, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB1, 0x7D, 0x83, 0xE9, 0x7F,
-    0xFF, 0xD8, 0x7D, 0x3B, 0xDE, 0x7E, 0x01, 0x67, 0x7D, 0x30, 0x36, 0x7D, 0x3B, 0xD4, 0x7F, 0xFF,
-    0xE6, 0x7D, 0x3B, 0xDE, 0x7F, 0xFF, 0xF3, 0xE2, 0x06, 0xF1, 0x66, 0x6F, 0x7D, 0x24, 0x48, 0x7D,
+    0xED, 0x06, 0xF1, 0x61, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6F, 0x73, 0x76, 0x7A, 0xC3,
+    0x7F, 0xFF, 0x82, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB1, 0x7D, 0x83, 0xE9, 0x7F, 0xFF, 0xD8, 0x7D,
+    0x3B, 0xDE, 0x7E, 0x01, 0x67, 0x7D, 0x30, 0x36, 0x7D, 0x3B, 0xD4, 0x7F, 0xFF, 0xE6, 0x7D, 0x3B,
+    0xDE, 0x7F, 0xFF, 0xF3, 0x7D, 0x50, 0x54, 0xE2, 0x06, 0xF1, 0x66, 0x6F, 0x7D, 0x24, 0x48, 0x7D,
     0x3B, 0x9D, 0xE2, 0x00, 0x41, 0x64, 0x74, 0x7D, 0x22, 0x65, 0x7D, 0x89, 0xF6, 0xE2, 0x05, 0x11,
     0x2E, 0x73, 0x7D, 0x3D, 0x3D, 0x7D, 0x26, 0x32, 0xA0, 0x36, 0x93, 0x62, 0x67, 0x74, 0x7D, 0x3B,
     0xE9, 0x7F, 0xFF, 0xFD, 0x64, 0x61, 0x63, 0x70, 0x74, 0x7D, 0x4F, 0x90, 0x7D, 0x4A, 0xE6, 0x7D,
@@ -11825,11 +11825,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x21, 0x66, 0x7F, 0xFF, 0xFD, 0x61, 0x61, 0x7D, 0x61, 0x0E, 0x21, 0x72, 0xFB, 0x62, 0x66, 0x74,
     0x7D, 0x3E, 0x0D, 0x7D, 0x3E, 0x0D, 0x65, 0x65, 0x68, 0x6D, 0x6E, 0x72, 0x7D, 0x4E, 0x3E, 0x7D,
     0x4E, 0x3E, 0x7D, 0x3A, 0x98, 0x7F, 0xFF, 0xF7, 0x7D, 0x3A, 0x98, 0x61, 0x6F, 0x7D, 0x28, 0x42,
-    0x71, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74,
-    0x75, 0x7A, 0x7F, 0xFE, 0xE2, 0x7D, 0x49, 0xB3, 0x7D, 0x2A, 0x7B, 0x7F, 0xFF, 0x49, 0x7F, 0xFF,
-    0x7F, 0x7F, 0xFF, 0x82, 0x7F, 0xFF, 0x90, 0x7D, 0x27, 0xB2, 0x7D, 0x2F, 0x3B, 0x7D, 0x7E, 0xA5,
-    0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xAA, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xDA, 0x7F,
-    0xFF, 0xE6, 0x7F, 0xFF, 0xFB, 0x62, 0x61, 0x6C, 0x7D, 0x7E, 0xC3, 0x7D, 0x3A, 0x58, 0x21, 0x68,
+    0x71, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75,
+    0x7A, 0xC3, 0x7F, 0xFE, 0xE2, 0x7D, 0x2A, 0x7B, 0x7F, 0xFF, 0x49, 0x7F, 0xFF, 0x7F, 0x7F, 0xFF,
+    0x82, 0x7F, 0xFF, 0x90, 0x7D, 0x27, 0xB2, 0x7D, 0x2F, 0x3B, 0x7D, 0x7E, 0xA5, 0x7F, 0xFF, 0x9D,
+    0x7F, 0xFF, 0xAA, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xE6, 0x7F,
+    0xFF, 0xFB, 0x7D, 0x49, 0xB3, 0x62, 0x61, 0x6C, 0x7D, 0x7E, 0xC3, 0x7D, 0x3A, 0x58, 0x21, 0x68,
     0xF7, 0x62, 0x6E, 0x73, 0x7D, 0x27, 0x85, 0x7D, 0x21, 0x12, 0x64, 0x61, 0x63, 0x6F, 0x74, 0x7D,
     0x21, 0x64, 0x7D, 0x21, 0xA7, 0x7D, 0x21, 0x0C, 0x7D, 0x21, 0x0C, 0x62, 0x65, 0x68, 0x7D, 0x3D,
     0x7B, 0x7D, 0x20, 0xFB, 0xE7, 0x06, 0xF1, 0x63, 0x65, 0x69, 0x6C, 0x70, 0x73, 0x74, 0x7F, 0xFF,
@@ -11838,12 +11838,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x62, 0x63, 0x74, 0x7E, 0xA2, 0xDB, 0x7D, 0x20, 0xC6, 0xE6, 0x06, 0xF1, 0x61, 0x65, 0x69, 0x72,
     0x73, 0x79, 0x7F, 0xFF, 0xEA, 0x7D, 0x3A, 0xD8, 0x7D, 0xAD, 0xCE, 0x7D, 0xF0, 0x1B, 0x7F, 0xFF,
     0xF7, 0x7D, 0x20, 0x53, 0x78, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0xC3, 0x74, 0x76, 0x77, 0x78, 0x7A, 0x7D, 0x3A, 0xBA,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x76, 0x77, 0x78, 0x7A, 0xC3, 0x7D, 0x3A, 0xBA,
     0x7D, 0x3A, 0xBA, 0x7F, 0xFB, 0xD7, 0x7F, 0xFC, 0x19, 0x7F, 0xFC, 0x30, 0x7F, 0xFC, 0x49, 0x7F,
     0xFC, 0x50, 0x7F, 0xFC, 0x80, 0x7F, 0xFC, 0xBB, 0x7D, 0x3A, 0x08, 0x7D, 0x3A, 0xBA, 0x7F, 0xFD,
     0x27, 0x7F, 0xFD, 0x47, 0x7F, 0xFD, 0xDC, 0x7D, 0x77, 0xA0, 0x7F, 0xFE, 0x13, 0x7F, 0xFF, 0x3C,
-    0x7F, 0xFF, 0xB0, 0x7D, 0x7E, 0xAD, 0x7F, 0xFF, 0xE5, 0x7D, 0x3A, 0xBA, 0x7D, 0x3A, 0xBA, 0x7D,
-    0xC5, 0xB1, 0x7D, 0x3A, 0xBA, 0x61, 0x9F, 0x7D, 0x20, 0x0D, 0x62, 0x6E, 0xC3, 0x7D, 0x3A, 0x57,
+    0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xE5, 0x7D, 0x3A, 0xBA, 0x7D, 0x3A, 0xBA, 0x7D, 0xC5, 0xB1, 0x7D,
+    0x3A, 0xBA, 0x7D, 0x7E, 0xAD, 0x61, 0x9F, 0x7D, 0x20, 0x0D, 0x62, 0x6E, 0xC3, 0x7D, 0x3A, 0x57,
     0x7F, 0xFF, 0xFB, 0xE2, 0x00, 0xB1, 0x61, 0x65, 0x7D, 0x3A, 0x4E, 0x7D, 0xB7, 0x03, 0xE2, 0x00,
     0xB1, 0x65, 0x6D, 0x7D, 0x3A, 0x43, 0x7D, 0x3A, 0x43, 0x61, 0x9F, 0x7D, 0x44, 0x1A, 0x69, 0x62,
     0x64, 0x65, 0x6C, 0x6E, 0x72, 0xC3, 0x74, 0x75, 0x7D, 0xF4, 0xF6, 0x7D, 0x44, 0x15, 0x7F, 0xFF,
@@ -11958,11 +11958,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x18, 0xDF, 0x7F, 0xFF, 0xF9, 0x41, 0x6D, 0x8B, 0xE9, 0x62, 0x69, 0x72, 0x7D, 0x1E, 0x75, 0x7F,
     0xFF, 0xFC, 0x64, 0x61, 0x65, 0x69, 0x73, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF7, 0x7D, 0x31, 0xAB,
     0x7D, 0x22, 0x49, 0xE2, 0x06, 0xB1, 0x6D, 0x72, 0x7D, 0xC2, 0xAF, 0x7D, 0x3D, 0x20, 0x61, 0x77,
-    0x7D, 0x19, 0x1B, 0x73, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6E,
-    0x6F, 0x70, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x7F, 0xFE, 0x80, 0x7F, 0xFE, 0xA3, 0x7D, 0x19, 0x16,
-    0x7D, 0x38, 0x10, 0x7F, 0xFE, 0xD7, 0x7F, 0xFE, 0xFF, 0x7D, 0x19, 0x16, 0x7D, 0x19, 0x16, 0x7F,
-    0xFF, 0x33, 0x7F, 0xFF, 0x3C, 0x7F, 0xFF, 0x77, 0x7D, 0x2C, 0xCD, 0x7F, 0xFF, 0x88, 0x7D, 0x75,
-    0x33, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xF0, 0x7D, 0x3A, 0x33, 0x7F, 0xFF, 0xFB,
+    0x7D, 0x19, 0x1B, 0x73, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x6F,
+    0x70, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xC3, 0x7F, 0xFE, 0x80, 0x7D, 0x19, 0x16, 0x7D, 0x38, 0x10,
+    0x7F, 0xFE, 0xD7, 0x7F, 0xFE, 0xFF, 0x7D, 0x19, 0x16, 0x7D, 0x19, 0x16, 0x7F, 0xFF, 0x33, 0x7F,
+    0xFF, 0x3C, 0x7F, 0xFF, 0x77, 0x7D, 0x2C, 0xCD, 0x7F, 0xFF, 0x88, 0x7D, 0x75, 0x33, 0x7F, 0xFF,
+    0xAB, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xF0, 0x7D, 0x3A, 0x33, 0x7F, 0xFF, 0xFB, 0x7F, 0xFE, 0xA3,
     0x61, 0x73, 0x7E, 0x37, 0xD4, 0x63, 0x62, 0x6C, 0x74, 0x7D, 0x32, 0xDC, 0x7D, 0x34, 0x54, 0x7D,
     0x34, 0x54, 0x65, 0x63, 0x67, 0x6D, 0x6F, 0x74, 0x7D, 0x33, 0x5B, 0x7D, 0x34, 0x47, 0x7D, 0x34,
     0x47, 0x7D, 0x32, 0xCF, 0x7D, 0x34, 0x47, 0x61, 0x74, 0x7E, 0x51, 0xF4, 0x62, 0x6C, 0x6D, 0x7D,
@@ -11985,12 +11985,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xAF, 0x21, 0x68, 0xF9, 0xE1, 0x00, 0x81, 0x77, 0x7D, 0x17, 0x2B, 0x63, 0x64, 0x69, 0x72, 0x7D,
     0x31, 0x06, 0x7D, 0x1C, 0xC3, 0x7F, 0xFF, 0xF9, 0xE1, 0x06, 0xC1, 0x6C, 0x7D, 0x39, 0x67, 0x65,
     0x63, 0x65, 0x6B, 0x74, 0x75, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xEC, 0x7F, 0xFF, 0xF9, 0x7D, 0x23,
-    0x89, 0x7D, 0x47, 0xB0, 0xE1, 0x07, 0xB1, 0x77, 0x7D, 0x31, 0x7A, 0x73, 0x61, 0xC3, 0x64, 0x65,
-    0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0x7F,
-    0xFE, 0xD3, 0x7F, 0xFF, 0x09, 0x7D, 0x17, 0x5E, 0x7F, 0xFF, 0x44, 0x7D, 0x32, 0x4D, 0x7F, 0xFF,
-    0x65, 0x7F, 0xFF, 0x6C, 0x7D, 0x32, 0x4D, 0x7D, 0x32, 0x4D, 0x7F, 0xFF, 0x90, 0x7D, 0x31, 0x76,
-    0x7F, 0xFF, 0x98, 0x7F, 0xFF, 0xB6, 0x7D, 0x32, 0x4D, 0x7F, 0xFF, 0xE4, 0x7E, 0xC8, 0xD0, 0x7D,
-    0x6A, 0x61, 0x7E, 0x7A, 0x3E, 0x7F, 0xFF, 0xF9, 0xE2, 0x02, 0xF1, 0x65, 0x72, 0x7D, 0x30, 0x45,
+    0x89, 0x7D, 0x47, 0xB0, 0xE1, 0x07, 0xB1, 0x77, 0x7D, 0x31, 0x7A, 0x73, 0x61, 0x64, 0x65, 0x66,
+    0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F,
+    0xFE, 0xD3, 0x7D, 0x17, 0x5E, 0x7F, 0xFF, 0x44, 0x7D, 0x32, 0x4D, 0x7F, 0xFF, 0x65, 0x7F, 0xFF,
+    0x6C, 0x7D, 0x32, 0x4D, 0x7D, 0x32, 0x4D, 0x7F, 0xFF, 0x90, 0x7D, 0x31, 0x76, 0x7F, 0xFF, 0x98,
+    0x7F, 0xFF, 0xB6, 0x7D, 0x32, 0x4D, 0x7F, 0xFF, 0xE4, 0x7E, 0xC8, 0xD0, 0x7D, 0x6A, 0x61, 0x7E,
+    0x7A, 0x3E, 0x7F, 0xFF, 0xF9, 0x7F, 0xFF, 0x09, 0xE2, 0x02, 0xF1, 0x65, 0x72, 0x7D, 0x30, 0x45,
     0x7D, 0x7A, 0x5B, 0xE1, 0x37, 0x02, 0x74, 0x7D, 0x16, 0x96, 0x63, 0x2E, 0x65, 0x73, 0x7D, 0x43,
     0xBA, 0x7D, 0x30, 0x14, 0x7D, 0x30, 0x14, 0x6B, 0x2E, 0x62, 0x63, 0x65, 0x67, 0x6C, 0x70, 0x72,
     0x73, 0x75, 0x7A, 0x7D, 0x31, 0x55, 0x7F, 0xFF, 0xE1, 0x7D, 0x30, 0x07, 0x7D, 0x30, 0x07, 0x7D,
@@ -12006,10 +12006,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x88, 0x7F, 0xFF, 0xFB, 0xE2, 0x06, 0xF1, 0x62, 0x70, 0x7D, 0x7D, 0xB4, 0x7D, 0x2F, 0xBD, 0x62,
     0xA4, 0xBC, 0x7D, 0x15, 0xCA, 0x7D, 0x15, 0xCA, 0xE3, 0x37, 0x02, 0xC3, 0x65, 0x69, 0x7F, 0xFF,
     0xF7, 0x7D, 0x15, 0xC1, 0x7D, 0x15, 0xC1, 0x62, 0x65, 0x6D, 0x7D, 0xC3, 0xD2, 0x7D, 0x2F, 0x9A,
-    0x6D, 0x2E, 0x61, 0xC3, 0x64, 0x65, 0x67, 0x69, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x7A, 0x7D, 0x30,
-    0x2E, 0x7F, 0xFF, 0x54, 0x7F, 0xFF, 0x6C, 0x7D, 0x2F, 0xCA, 0x7F, 0xFF, 0xA9, 0x7D, 0x30, 0x7C,
-    0x7F, 0xFF, 0xC5, 0x7D, 0x2F, 0xCA, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xE8, 0x7D, 0xD6, 0x84, 0x7F,
-    0xFF, 0xF7, 0x7D, 0x2F, 0xCA, 0x64, 0x2E, 0x64, 0x6E, 0x73, 0x7D, 0x2F, 0x18, 0x7D, 0x2F, 0xFC,
+    0x6D, 0x2E, 0x61, 0x64, 0x65, 0x67, 0x69, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x7A, 0xC3, 0x7D, 0x30,
+    0x2E, 0x7F, 0xFF, 0x54, 0x7D, 0x2F, 0xCA, 0x7F, 0xFF, 0xA9, 0x7D, 0x30, 0x7C, 0x7F, 0xFF, 0xC5,
+    0x7D, 0x2F, 0xCA, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xE8, 0x7D, 0xD6, 0x84, 0x7F, 0xFF, 0xF7, 0x7D,
+    0x2F, 0xCA, 0x7F, 0xFF, 0x6C, 0x64, 0x2E, 0x64, 0x6E, 0x73, 0x7D, 0x2F, 0x18, 0x7D, 0x2F, 0xFC,
     0x7D, 0x2F, 0xFC, 0x7D, 0x2F, 0xFC, 0xE1, 0x00, 0xB1, 0x66, 0x7D, 0x31, 0x63, 0x62, 0x6F, 0x7A,
     0x7E, 0x22, 0x1F, 0x7D, 0x4C, 0x23, 0xE1, 0x00, 0xD1, 0x6C, 0x7D, 0x31, 0x53, 0x6A, 0x63, 0x64,
     0x68, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x75, 0x7D, 0x2F, 0xD4, 0x7D, 0x15, 0xBC, 0x7D, 0x15,
@@ -12048,12 +12048,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x2D, 0xCB, 0x7E, 0x4B, 0xFA, 0x7F, 0xFF, 0xF6, 0x7D, 0x2D, 0xCB, 0x7F, 0xFF, 0xF9, 0x7D, 0x2D,
     0xCB, 0x7D, 0x6C, 0x33, 0x7D, 0x1C, 0xC8, 0x7D, 0x35, 0x9C, 0x61, 0x73, 0x7D, 0x16, 0x63, 0xE1,
     0x06, 0xF1, 0x6C, 0x7E, 0x3C, 0x92, 0xA1, 0x07, 0xB1, 0x6F, 0xF9, 0xE1, 0x07, 0xB1, 0xC3, 0x7D,
-    0x3E, 0x76, 0xF4, 0x07, 0xA1, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E,
-    0x6F, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0x7F, 0xFC, 0x85, 0x7F, 0x74, 0xEC, 0x7F,
-    0xFD, 0x5E, 0x7F, 0xFD, 0xBB, 0x7F, 0xFD, 0xE4, 0x7F, 0xFE, 0x84, 0x7F, 0xFE, 0xAA, 0x7F, 0xFE,
-    0xFC, 0x7F, 0xFF, 0x28, 0x7F, 0xFF, 0x31, 0x7F, 0xFF, 0x4C, 0x7F, 0xFF, 0x55, 0x7D, 0x2E, 0x66,
-    0x7F, 0xFF, 0x89, 0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF9, 0x7D,
-    0x2C, 0x8C, 0x7F, 0xFA, 0x5C, 0x6E, 0x2E, 0x61, 0x63, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0x73,
+    0x3E, 0x76, 0xF4, 0x07, 0xA1, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7A, 0xC3, 0x7F, 0xFC, 0x85, 0x7F, 0xFD, 0x5E, 0x7F,
+    0xFD, 0xBB, 0x7F, 0xFD, 0xE4, 0x7F, 0xFE, 0x84, 0x7F, 0xFE, 0xAA, 0x7F, 0xFE, 0xFC, 0x7F, 0xFF,
+    0x28, 0x7F, 0xFF, 0x31, 0x7F, 0xFF, 0x4C, 0x7F, 0xFF, 0x55, 0x7D, 0x2E, 0x66, 0x7F, 0xFF, 0x89,
+    0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF9, 0x7D, 0x2C, 0x8C, 0x7F,
+    0xFA, 0x5C, 0x7F, 0x74, 0xEC, 0x6E, 0x2E, 0x61, 0x63, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6D, 0x73,
     0x74, 0x75, 0x76, 0x77, 0x7D, 0x2C, 0x39, 0x7D, 0x87, 0x09, 0x7D, 0x87, 0x09, 0x7D, 0xB7, 0xFF,
     0x7D, 0x2C, 0x39, 0x7D, 0x2C, 0x39, 0x7E, 0xEB, 0xFE, 0x7D, 0x2C, 0x39, 0x7D, 0x2C, 0x39, 0x7D,
     0x2C, 0x39, 0x7D, 0x2C, 0x39, 0x7D, 0x2D, 0x3C, 0x7D, 0x2C, 0x39, 0x7D, 0x2C, 0x39, 0xE8, 0x06,
@@ -12127,12 +12127,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x6B, 0x6C, 0x7D, 0x28, 0x38, 0x7D, 0x28, 0x38, 0x7D, 0x28, 0x38, 0x64, 0x63, 0x67, 0x70, 0x72,
     0x7D, 0x28, 0x26, 0x7D, 0x27, 0xE2, 0x7D, 0x28, 0x26, 0x7F, 0xFF, 0xF1, 0x65, 0x61, 0x65, 0x69,
     0x6F, 0x77, 0x7F, 0xFF, 0xD9, 0x7F, 0xFF, 0xEF, 0x7D, 0x34, 0x67, 0x7D, 0x4D, 0xE2, 0x7D, 0x27,
-    0xA8, 0x74, 0x2E, 0x61, 0xC3, 0x62, 0x63, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x7D, 0x28, 0x9D, 0x7F, 0xFD, 0x11, 0x7F, 0xFD, 0x62, 0x7D,
-    0x40, 0x7B, 0x7F, 0xFD, 0x6F, 0x7F, 0xFD, 0x9B, 0x7F, 0xFD, 0xFC, 0x7F, 0xFE, 0x23, 0x7F, 0xFE,
-    0x63, 0x7F, 0xFE, 0x7E, 0x7F, 0xFE, 0xC3, 0x7F, 0xFE, 0xDD, 0x7F, 0xFE, 0xEF, 0x7D, 0x0E, 0x88,
-    0x7D, 0x8D, 0xEB, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x81, 0x7F, 0xFF, 0xAD, 0x7E, 0xAF, 0xBE, 0x7F,
-    0xFF, 0xEB, 0x61, 0x68, 0x7D, 0x35, 0x87, 0x63, 0x68, 0x72, 0x73, 0x7D, 0x28, 0x4A, 0x7D, 0x28,
+    0xA8, 0x74, 0x2E, 0x61, 0x62, 0x63, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x7A, 0xC3, 0x7D, 0x28, 0x9D, 0x7F, 0xFD, 0x11, 0x7D, 0x40, 0x7B, 0x7F,
+    0xFD, 0x6F, 0x7F, 0xFD, 0x9B, 0x7F, 0xFD, 0xFC, 0x7F, 0xFE, 0x23, 0x7F, 0xFE, 0x63, 0x7F, 0xFE,
+    0x7E, 0x7F, 0xFE, 0xC3, 0x7F, 0xFE, 0xDD, 0x7F, 0xFE, 0xEF, 0x7D, 0x0E, 0x88, 0x7D, 0x8D, 0xEB,
+    0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x81, 0x7F, 0xFF, 0xAD, 0x7E, 0xAF, 0xBE, 0x7F, 0xFF, 0xEB, 0x7F,
+    0xFD, 0x62, 0x61, 0x68, 0x7D, 0x35, 0x87, 0x63, 0x68, 0x72, 0x73, 0x7D, 0x28, 0x4A, 0x7D, 0x28,
     0x4A, 0x7D, 0x28, 0x4A, 0x64, 0x61, 0x69, 0x74, 0x7A, 0x7D, 0xB2, 0x0F, 0x7D, 0x2A, 0xA6, 0x7D,
     0x50, 0xDA, 0x7D, 0x2A, 0xA6, 0x63, 0x62, 0x6D, 0x74, 0x7D, 0x28, 0x2C, 0x7D, 0x50, 0xC9, 0x7D,
     0x28, 0x2C, 0x63, 0x67, 0x74, 0x7A, 0x7D, 0x29, 0x97, 0x7D, 0x28, 0x1F, 0x7D, 0x28, 0x1F, 0xE1,
@@ -12187,11 +12187,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xFF, 0xE0, 0x7E, 0xB8, 0x32, 0x7D, 0xA4, 0x5D, 0x7E, 0x26, 0x4C, 0x7F, 0xFF, 0xED, 0x7F, 0xFF,
     0xF7, 0x7D, 0xFA, 0x8E, 0x64, 0x62, 0x64, 0x67, 0x7A, 0x7D, 0x26, 0x75, 0x7D, 0x26, 0x75, 0x7D,
     0x25, 0x89, 0x7D, 0x25, 0x89, 0x63, 0x65, 0x66, 0x6D, 0x7D, 0x79, 0x2A, 0x7D, 0x2E, 0xCE, 0x7F,
-    0xFF, 0xEF, 0x72, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70,
-    0x73, 0x74, 0x75, 0x79, 0x7A, 0x7F, 0xFC, 0xD4, 0x7F, 0xFD, 0x12, 0x7F, 0xFD, 0x1B, 0x7F, 0xFD,
-    0xD0, 0x7D, 0x7B, 0xA2, 0x7F, 0xFE, 0x0D, 0x7D, 0x24, 0xDF, 0x7F, 0xFE, 0x2E, 0x7F, 0xFE, 0x57,
-    0x7D, 0x23, 0xCF, 0x7F, 0xFE, 0x68, 0x7F, 0xFE, 0x76, 0x7F, 0xFE, 0xC9, 0x7F, 0xFF, 0x5D, 0x7F,
-    0xFF, 0xBD, 0x7F, 0xFF, 0xF3, 0x7D, 0xC4, 0x97, 0x7D, 0xB0, 0x77, 0x62, 0x6C, 0x72, 0x7D, 0xBF,
+    0xFF, 0xEF, 0x72, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x70, 0x73,
+    0x74, 0x75, 0x79, 0x7A, 0xC3, 0x7F, 0xFC, 0xD4, 0x7F, 0xFD, 0x1B, 0x7F, 0xFD, 0xD0, 0x7D, 0x7B,
+    0xA2, 0x7F, 0xFE, 0x0D, 0x7D, 0x24, 0xDF, 0x7F, 0xFE, 0x2E, 0x7F, 0xFE, 0x57, 0x7D, 0x23, 0xCF,
+    0x7F, 0xFE, 0x68, 0x7F, 0xFE, 0x76, 0x7F, 0xFE, 0xC9, 0x7F, 0xFF, 0x5D, 0x7F, 0xFF, 0xBD, 0x7F,
+    0xFF, 0xF3, 0x7D, 0xC4, 0x97, 0x7D, 0xB0, 0x77, 0x7F, 0xFD, 0x12, 0x62, 0x6C, 0x72, 0x7D, 0xBF,
     0xFF, 0x7D, 0x24, 0x96, 0x62, 0x65, 0x66, 0x7D, 0x26, 0xF6, 0x7D, 0x24, 0x8D, 0x64, 0x67, 0x6B,
     0x6C, 0x74, 0x7D, 0x24, 0x84, 0x7D, 0x24, 0x84, 0x7D, 0x3A, 0xDB, 0x7D, 0x25, 0xFC, 0x62, 0x61,
     0x64, 0x7D, 0x24, 0x73, 0x7D, 0x24, 0x73, 0x62, 0x66, 0x74, 0x7D, 0x24, 0x6A, 0x7D, 0x24, 0xF6,
@@ -12232,9 +12232,9 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x72, 0x74, 0x7D, 0x21, 0x62, 0x7D, 0x0D, 0x73, 0x7D, 0x09, 0x2C, 0x7D, 0x35, 0xD5, 0x7F, 0xFF,
     0xFD, 0x7D, 0x2A, 0x39, 0x66, 0x61, 0x65, 0x69, 0x6F, 0xC3, 0x77, 0x7D, 0x21, 0x20, 0x7F, 0xFF,
     0xE7, 0x7D, 0x52, 0xA2, 0x7D, 0x21, 0x20, 0x7D, 0x2D, 0x51, 0x7D, 0x21, 0x20, 0xEC, 0x06, 0xF1,
-    0x61, 0xC3, 0x65, 0x66, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0x7F, 0xFD, 0xB3, 0x7F,
-    0xFD, 0xED, 0x7F, 0xFE, 0x3A, 0x7D, 0x1B, 0xB3, 0x7F, 0xFE, 0x6F, 0x7F, 0xFE, 0x8E, 0x7F, 0xFF,
-    0x12, 0x7F, 0xFF, 0x4A, 0x7F, 0xFF, 0x7A, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xE7,
+    0x61, 0x65, 0x66, 0x68, 0x69, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x7A, 0xC3, 0x7F, 0xFD, 0xB3, 0x7F,
+    0xFE, 0x3A, 0x7D, 0x1B, 0xB3, 0x7F, 0xFE, 0x6F, 0x7F, 0xFE, 0x8E, 0x7F, 0xFF, 0x12, 0x7F, 0xFF,
+    0x4A, 0x7F, 0xFF, 0x7A, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xB5, 0x7F, 0xFF, 0xE7, 0x7F, 0xFD, 0xED,
     0xE1, 0x00, 0x51, 0x6E, 0x7D, 0x0E, 0x36, 0xA1, 0x04, 0x51, 0x65, 0xF9, 0x61, 0x78, 0x7D, 0x0D,
     0x54, 0x21, 0x65, 0xFB, 0x21, 0x73, 0xFD, 0x21, 0x67, 0xFD, 0xA2, 0x0B, 0xF3, 0x6D, 0x6E, 0xED,
     0xFD, 0x62, 0x61, 0xC3, 0x7D, 0x07, 0x38, 0x7D, 0xA8, 0x31, 0x63, 0x2E, 0x6E, 0x72, 0x7D, 0x20,
@@ -12248,14 +12248,14 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x25, 0xE1, 0x7D, 0xC4, 0xF0, 0x7D, 0x06, 0xBD, 0x63, 0x66, 0x72, 0x74, 0x7D, 0x07, 0x20,
     0x7D, 0x21, 0x38, 0x7D, 0x21, 0x38, 0x61, 0x70, 0x7D, 0x57, 0x98, 0xE1, 0x0B, 0x52, 0x62, 0x7D,
     0x20, 0x42, 0xE6, 0x06, 0xF1, 0x61, 0x65, 0x69, 0x6F, 0x75, 0x7A, 0x7E, 0x54, 0xAD, 0x7F, 0xFF,
-    0xC9, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF9, 0x79, 0x61, 0xC3,
-    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
-    0x73, 0x74, 0x75, 0x76, 0x78, 0x79, 0x7A, 0x7F, 0xDE, 0x2C, 0x7F, 0xDE, 0x96, 0x7F, 0xDF, 0x83,
-    0x7F, 0xE1, 0x76, 0x7F, 0xE1, 0xFE, 0x7F, 0xE6, 0x47, 0x7F, 0xE8, 0x52, 0x7F, 0xEA, 0x30, 0x7F,
-    0xEA, 0xD2, 0x7F, 0xEB, 0x60, 0x7D, 0x6A, 0xAA, 0x7F, 0xEC, 0x0F, 0x7F, 0xED, 0xD6, 0x7F, 0xEF,
-    0x8E, 0x7F, 0xF3, 0x75, 0x7F, 0xF4, 0x01, 0x7F, 0xF4, 0xB1, 0x7F, 0xF8, 0x64, 0x7F, 0xFC, 0x25,
-    0x7F, 0xFE, 0xF0, 0x7F, 0xFF, 0x3D, 0x7F, 0xFF, 0x5A, 0x7F, 0xFF, 0x6E, 0x7F, 0xFF, 0x7D, 0x7F,
-    0xFF, 0xE5, 0x62, 0x72, 0x73, 0x7D, 0x06, 0x87, 0x7D, 0x20, 0x9C, 0x62, 0x6D, 0x72, 0x7D, 0x2C,
+    0xC9, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF9, 0x79, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x78, 0x79, 0x7A, 0xC3, 0x7F, 0xDE, 0x2C, 0x7F, 0xDF, 0x83, 0x7F, 0xE1, 0x76,
+    0x7F, 0xE1, 0xFE, 0x7F, 0xE6, 0x47, 0x7F, 0xE8, 0x52, 0x7F, 0xEA, 0x30, 0x7F, 0xEA, 0xD2, 0x7F,
+    0xEB, 0x60, 0x7D, 0x6A, 0xAA, 0x7F, 0xEC, 0x0F, 0x7F, 0xED, 0xD6, 0x7F, 0xEF, 0x8E, 0x7F, 0xF3,
+    0x75, 0x7F, 0xF4, 0x01, 0x7F, 0xF4, 0xB1, 0x7F, 0xF8, 0x64, 0x7F, 0xFC, 0x25, 0x7F, 0xFE, 0xF0,
+    0x7F, 0xFF, 0x3D, 0x7F, 0xFF, 0x5A, 0x7F, 0xFF, 0x6E, 0x7F, 0xFF, 0x7D, 0x7F, 0xFF, 0xE5, 0x7F,
+    0xDE, 0x96, 0x62, 0x72, 0x73, 0x7D, 0x06, 0x87, 0x7D, 0x20, 0x9C, 0x62, 0x6D, 0x72, 0x7D, 0x2C,
     0x24, 0x7D, 0x20, 0x96, 0x62, 0x6F, 0x70, 0x7D, 0x06, 0x0B, 0x7D, 0x06, 0x0B, 0x62, 0x6E, 0x72,
     0x7D, 0x06, 0x69, 0x7F, 0xFF, 0xF7, 0x63, 0x61, 0x6F, 0x73, 0x7D, 0x06, 0xA9, 0x7D, 0x06, 0x60,
     0x7D, 0x06, 0x98, 0x63, 0x61, 0x70, 0x75, 0x7D, 0x06, 0x53, 0x7D, 0x06, 0x53, 0x7D, 0x06, 0x53,
@@ -12294,10 +12294,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x65, 0x7E, 0x1B, 0xC1, 0x62, 0x61, 0x65, 0x7D, 0x04, 0x0E, 0x7D, 0x05, 0x9D, 0x63, 0x65, 0x74,
     0x77, 0x7D, 0x0F, 0xED, 0x7D, 0x05, 0x26, 0x7D, 0x03, 0xCC, 0xE1, 0x00, 0x81, 0x65, 0x7D, 0x09,
     0xEC, 0x62, 0x65, 0x73, 0x7D, 0x05, 0x0C, 0x7D, 0x1E, 0x40, 0x61, 0xBC, 0x7D, 0x05, 0x03, 0xEF,
-    0x09, 0xE2, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x73, 0x74, 0x75, 0xC3,
-    0x7A, 0x7F, 0xFF, 0x78, 0x7F, 0xFF, 0x92, 0x7D, 0x05, 0x72, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xC9,
+    0x09, 0xE2, 0x61, 0x62, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6D, 0x6E, 0x73, 0x74, 0x75, 0x7A,
+    0xC3, 0x7F, 0xFF, 0x78, 0x7F, 0xFF, 0x92, 0x7D, 0x05, 0x72, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xC9,
     0x7E, 0x07, 0x20, 0x7D, 0x2C, 0xE5, 0x7D, 0x03, 0xAD, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xD5, 0x7F,
-    0xFF, 0xDE, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7D, 0x03, 0xAD, 0x61, 0x69,
+    0xFF, 0xDE, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xF2, 0x7D, 0x03, 0xAD, 0x7F, 0xFF, 0xFB, 0x61, 0x69,
     0x7D, 0xEC, 0x1B, 0x62, 0x70, 0x74, 0x7D, 0x1C, 0xE1, 0x7F, 0xFF, 0xFB, 0x62, 0x65, 0x6F, 0x7D,
     0x4A, 0xF9, 0x7D, 0x03, 0xC7, 0xE1, 0x0D, 0x02, 0x72, 0x7D, 0x1C, 0xCF, 0x70, 0x61, 0x62, 0x63,
     0x65, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x7F, 0xFE, 0x79,
@@ -12339,12 +12339,12 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x8F, 0x53, 0x7D, 0x1A, 0xFF, 0x7F, 0xFF, 0xF3, 0x7D, 0x19, 0x7B, 0x7D, 0x1A, 0xFF, 0xE1, 0x04,
     0x51, 0x6E, 0x7D, 0x40, 0xE1, 0x63, 0x66, 0x67, 0x6B, 0x7D, 0x1B, 0x79, 0x7D, 0x1B, 0x79, 0x7D,
     0x1B, 0x79, 0x22, 0x65, 0x6D, 0xEC, 0xF3, 0xF9, 0x07, 0xB1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
-    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0xC3, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
-    0x76, 0x77, 0x7A, 0x7F, 0xFB, 0xD2, 0x7D, 0x1B, 0xA3, 0x7D, 0x1F, 0xCA, 0x7F, 0xFC, 0x07, 0x7F,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x7A, 0xC3, 0x7F, 0xFB, 0xD2, 0x7D, 0x1B, 0xA3, 0x7D, 0x1F, 0xCA, 0x7F, 0xFC, 0x07, 0x7F,
     0xFD, 0x95, 0x7F, 0xFD, 0xD6, 0x7D, 0x1B, 0xA3, 0x7D, 0x1F, 0xCA, 0x7F, 0xFE, 0xA0, 0x7D, 0x1B,
     0x67, 0x7D, 0x60, 0xA1, 0x7F, 0xFE, 0xDA, 0x7F, 0xFE, 0xE5, 0x7D, 0x1F, 0xCA, 0x7F, 0xFF, 0x74,
-    0x7F, 0xFF, 0x96, 0x7F, 0xFF, 0x99, 0x7D, 0x1B, 0x67, 0x7F, 0xFF, 0xAA, 0x7F, 0xFF, 0xC8, 0x7D,
-    0x1B, 0xA3, 0x7F, 0xFF, 0xFB, 0x7D, 0x1B, 0x67, 0x7D, 0x1B, 0x67, 0x7D, 0x1B, 0x67, 0x61, 0x62,
+    0x7F, 0xFF, 0x99, 0x7D, 0x1B, 0x67, 0x7F, 0xFF, 0xAA, 0x7F, 0xFF, 0xC8, 0x7D, 0x1B, 0xA3, 0x7F,
+    0xFF, 0xFB, 0x7D, 0x1B, 0x67, 0x7D, 0x1B, 0x67, 0x7D, 0x1B, 0x67, 0x7F, 0xFF, 0x96, 0x61, 0x62,
     0x7D, 0x01, 0x47, 0xE1, 0x07, 0x71, 0x72, 0x7E, 0xA0, 0xEE, 0x63, 0x6F, 0x74, 0x75, 0x7D, 0x1A,
     0xF7, 0x7F, 0xFF, 0xF9, 0x7D, 0x1A, 0xF7, 0xA1, 0x02, 0xF1, 0x68, 0xF3, 0x64, 0x6C, 0x6E, 0x73,
     0x75, 0x7E, 0x54, 0x70, 0x7D, 0x96, 0x1F, 0x7D, 0x1A, 0x7E, 0x7D, 0x19, 0xE2, 0x61, 0x66, 0x7F,
@@ -12440,10 +12440,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7C, 0xFB, 0x93, 0x62, 0x6D, 0x72, 0x7C, 0xFB, 0x8C, 0x7C, 0xFB, 0x8C, 0x69, 0x61, 0xC3, 0x65,
     0x68, 0x69, 0x6F, 0x72, 0x73, 0x75, 0x7F, 0xFF, 0xC2, 0x7D, 0x03, 0x06, 0x7F, 0xFF, 0xE7, 0x7C,
     0xFB, 0xB5, 0x7F, 0xFF, 0xF0, 0x7D, 0x0B, 0xC4, 0x7F, 0x6B, 0x7E, 0x7E, 0x19, 0x65, 0x7F, 0xFF,
-    0xF7, 0x6C, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6F, 0xC3, 0x73, 0x74, 0x7D, 0xFD,
+    0xF7, 0x6C, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6F, 0x73, 0x74, 0xC3, 0x7D, 0xFD,
     0xFE, 0x7F, 0xFE, 0xF4, 0x7D, 0x15, 0x0D, 0x7F, 0xFF, 0x0A, 0x7D, 0x0B, 0x7F, 0x7F, 0xFF, 0x2F,
-    0x7F, 0xFF, 0x4C, 0x7F, 0xFF, 0x67, 0x7C, 0xFA, 0x88, 0x7D, 0x03, 0x5C, 0x7F, 0xFF, 0x94, 0x7F,
-    0xFF, 0xDB, 0xE1, 0x07, 0x71, 0x6E, 0x7C, 0xFD, 0x9B, 0x62, 0x2E, 0x65, 0x7C, 0xFB, 0x29, 0x7C,
+    0x7F, 0xFF, 0x4C, 0x7F, 0xFF, 0x67, 0x7C, 0xFA, 0x88, 0x7F, 0xFF, 0x94, 0x7F, 0xFF, 0xDB, 0x7D,
+    0x03, 0x5C, 0xE1, 0x07, 0x71, 0x6E, 0x7C, 0xFD, 0x9B, 0x62, 0x2E, 0x65, 0x7C, 0xFB, 0x29, 0x7C,
     0xFD, 0xC7, 0x62, 0x64, 0x67, 0x7F, 0xFF, 0xF7, 0x7C, 0xFE, 0xDE, 0x61, 0x65, 0x7E, 0x8F, 0x08,
     0x21, 0x77, 0xFB, 0xE6, 0x01, 0x61, 0x63, 0x69, 0x6D, 0x6E, 0x72, 0x78, 0x7C, 0xFD, 0xAD, 0x7C,
     0xFD, 0xAD, 0x7D, 0x83, 0xE9, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF, 0xFD, 0x7C, 0xFA, 0xA3, 0xE1, 0x01,
@@ -12504,13 +12504,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0xB1, 0x74, 0xF9, 0x23, 0x66, 0x6D, 0x73, 0xC0, 0xE5, 0xFB, 0xE1, 0x00, 0xB1, 0x74, 0x7D, 0x17,
     0x0B, 0xE1, 0x06, 0xD2, 0x7A, 0x7C, 0xF6, 0xAB, 0x67, 0x63, 0x65, 0x66, 0x6E, 0x72, 0x73, 0x74,
     0x7F, 0xFF, 0x48, 0x7F, 0xFF, 0x61, 0x7D, 0x56, 0x60, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xEB, 0x7F,
-    0xFF, 0xF2, 0x7F, 0xFF, 0xF9, 0xF8, 0x07, 0xB1, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
-    0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A,
-    0x7F, 0xF8, 0x0D, 0x7F, 0xF8, 0xB8, 0x7F, 0xF8, 0xBF, 0x7D, 0x15, 0x6C, 0x7D, 0x11, 0x09, 0x7F,
-    0xFC, 0xB4, 0x7D, 0x15, 0x6C, 0x7D, 0x11, 0x09, 0x7F, 0xFC, 0xF8, 0x7F, 0xFE, 0x0F, 0x7D, 0x0F,
-    0xFC, 0x7D, 0x15, 0x6C, 0x7D, 0x15, 0x6C, 0x7D, 0x15, 0x6C, 0x7F, 0xFE, 0x41, 0x7F, 0xFE, 0xD9,
-    0x7D, 0x15, 0x6C, 0x7D, 0x11, 0x09, 0x7F, 0xFE, 0xE6, 0x7F, 0xFE, 0xFD, 0x7F, 0xFF, 0x14, 0x7F,
-    0xFF, 0xE3, 0x7D, 0x11, 0x09, 0x7D, 0x11, 0x09, 0xE3, 0x06, 0xF1, 0x65, 0x72, 0x79, 0x7D, 0x0F,
+    0xFF, 0xF2, 0x7F, 0xFF, 0xF9, 0xF8, 0x07, 0xB1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x77, 0x7A, 0xC3,
+    0x7F, 0xF8, 0x0D, 0x7F, 0xF8, 0xBF, 0x7D, 0x15, 0x6C, 0x7D, 0x11, 0x09, 0x7F, 0xFC, 0xB4, 0x7D,
+    0x15, 0x6C, 0x7D, 0x11, 0x09, 0x7F, 0xFC, 0xF8, 0x7F, 0xFE, 0x0F, 0x7D, 0x0F, 0xFC, 0x7D, 0x15,
+    0x6C, 0x7D, 0x15, 0x6C, 0x7D, 0x15, 0x6C, 0x7F, 0xFE, 0x41, 0x7F, 0xFE, 0xD9, 0x7D, 0x15, 0x6C,
+    0x7D, 0x11, 0x09, 0x7F, 0xFE, 0xE6, 0x7F, 0xFE, 0xFD, 0x7F, 0xFF, 0x14, 0x7F, 0xFF, 0xE3, 0x7D,
+    0x11, 0x09, 0x7D, 0x11, 0x09, 0x7F, 0xF8, 0xB8, 0xE3, 0x06, 0xF1, 0x65, 0x72, 0x79, 0x7D, 0x0F,
     0x9C, 0x7D, 0x0F, 0x9C, 0x7C, 0xF6, 0x24, 0xA0, 0x38, 0x64, 0xA0, 0x38, 0xA3, 0x62, 0x61, 0x6C,
     0x7C, 0xF6, 0x0C, 0x7C, 0xFC, 0x8C, 0xE1, 0x06, 0xC1, 0x65, 0x7D, 0x20, 0xB4, 0x62, 0x68, 0x69,
     0x7C, 0xF6, 0x35, 0x7D, 0x11, 0x93, 0xE6, 0x06, 0xF1, 0x2E, 0x61, 0x62, 0x65, 0x74, 0x7A, 0x7D,
@@ -12570,11 +12570,11 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x0D, 0x7D, 0x12, 0x0D, 0x7D, 0x0C, 0x76, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF1, 0xE3, 0x10, 0x42,
     0x65, 0x69, 0x6F, 0x7D, 0x0C, 0x11, 0x7D, 0x50, 0x34, 0x7D, 0x0C, 0x11, 0x61, 0x2E, 0x7D, 0x0D,
     0xDC, 0x77, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0xC3, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7F, 0xFC, 0xA0, 0x7D, 0x0D, 0x39, 0x7F,
+    0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xC3, 0x7F, 0xFC, 0xA0, 0x7D, 0x0D, 0x39, 0x7F,
     0xFC, 0xDB, 0x7F, 0xFC, 0xEE, 0x7F, 0xFD, 0x27, 0x7F, 0xFD, 0x56, 0x7D, 0x0D, 0x39, 0x7D, 0x11,
     0x60, 0x7F, 0xFD, 0xB6, 0x7F, 0xFD, 0xE9, 0x7F, 0xFD, 0xF0, 0x7F, 0xFE, 0x03, 0x7D, 0x11, 0x60,
-    0x7F, 0xFE, 0x19, 0x7F, 0xFE, 0x36, 0x7F, 0xFE, 0x5C, 0x7D, 0x11, 0x60, 0x7F, 0xFE, 0x73, 0x7F,
-    0xFF, 0x90, 0x7F, 0xFF, 0xD5, 0x7F, 0xFF, 0xEC, 0x7D, 0x0C, 0xFD, 0x7F, 0xFF, 0xFB, 0x62, 0x72,
+    0x7F, 0xFE, 0x19, 0x7F, 0xFE, 0x5C, 0x7D, 0x11, 0x60, 0x7F, 0xFE, 0x73, 0x7F, 0xFF, 0x90, 0x7F,
+    0xFF, 0xD5, 0x7F, 0xFF, 0xEC, 0x7D, 0x0C, 0xFD, 0x7F, 0xFF, 0xFB, 0x7F, 0xFE, 0x36, 0x62, 0x72,
     0x73, 0x7C, 0xF5, 0xE0, 0x7C, 0xF6, 0x41, 0xA1, 0x02, 0xF1, 0x74, 0xF7, 0xA1, 0x07, 0xB1, 0x68,
     0xFB, 0x63, 0x2E, 0x61, 0x62, 0x7D, 0x0B, 0x8D, 0x7D, 0x0C, 0x90, 0x7D, 0x0B, 0x8D, 0x63, 0x67,
     0x6B, 0x7A, 0x7C, 0xF2, 0x6B, 0x7D, 0x0B, 0x80, 0x7D, 0x0B, 0x80, 0x61, 0x70, 0x7D, 0x18, 0x04,
@@ -12634,13 +12634,13 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x21, 0x23, 0x65, 0x68, 0x6F, 0xE5, 0xEE, 0xF9, 0xE1, 0x06, 0xC1, 0x65, 0x7C, 0xEE, 0xFB, 0xA1,
     0x06, 0xB1, 0x72, 0xF9, 0x61, 0x74, 0x7C, 0xEE, 0x88, 0x62, 0x65, 0x6F, 0x7F, 0xFF, 0xFB, 0x7D,
     0x0D, 0x6B, 0x61, 0x75, 0x7E, 0x88, 0x34, 0x61, 0x72, 0x7C, 0xEF, 0xFE, 0x21, 0x65, 0xFB, 0x79,
-    0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7F, 0xFC, 0x81, 0x7F, 0xFC, 0xA7, 0x7D,
-    0x0F, 0xF7, 0x7F, 0xFC, 0xB3, 0x7F, 0xFC, 0xCE, 0x7F, 0xFC, 0xFA, 0x7F, 0xFD, 0x1D, 0x7F, 0xFD,
-    0x29, 0x7F, 0xFD, 0x32, 0x7D, 0x4E, 0x29, 0x7F, 0xFD, 0x39, 0x7F, 0xFD, 0xB1, 0x7F, 0xFD, 0xF2,
-    0x7F, 0xFE, 0x3C, 0x7F, 0xFE, 0x92, 0x7F, 0xFE, 0xED, 0x7F, 0xFF, 0x31, 0x7F, 0xFF, 0x90, 0x7F,
-    0xFF, 0xD2, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF3, 0x7D, 0x08, 0x3D, 0x7D, 0x08,
-    0x3D, 0x7F, 0xFF, 0xFD, 0xE2, 0x07, 0xF2, 0x61, 0xC3, 0x7D, 0x08, 0x8D, 0x7D, 0x13, 0x14, 0x62,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x7F, 0xFC, 0x81, 0x7D, 0x0F, 0xF7, 0x7F,
+    0xFC, 0xB3, 0x7F, 0xFC, 0xCE, 0x7F, 0xFC, 0xFA, 0x7F, 0xFD, 0x1D, 0x7F, 0xFD, 0x29, 0x7F, 0xFD,
+    0x32, 0x7D, 0x4E, 0x29, 0x7F, 0xFD, 0x39, 0x7F, 0xFD, 0xB1, 0x7F, 0xFD, 0xF2, 0x7F, 0xFE, 0x3C,
+    0x7F, 0xFE, 0x92, 0x7F, 0xFE, 0xED, 0x7F, 0xFF, 0x31, 0x7F, 0xFF, 0x90, 0x7F, 0xFF, 0xD2, 0x7F,
+    0xFF, 0xE0, 0x7F, 0xFF, 0xEA, 0x7F, 0xFF, 0xF3, 0x7D, 0x08, 0x3D, 0x7D, 0x08, 0x3D, 0x7F, 0xFF,
+    0xFD, 0x7F, 0xFC, 0xA7, 0xE2, 0x07, 0xF2, 0x61, 0xC3, 0x7D, 0x08, 0x8D, 0x7D, 0x13, 0x14, 0x62,
     0x63, 0x68, 0x7D, 0x08, 0x7F, 0x7F, 0xFF, 0xF5, 0x62, 0x73, 0xC3, 0x7D, 0x09, 0x8B, 0x7F, 0x5C,
     0x8F, 0xE8, 0x06, 0xC1, 0x63, 0x68, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75, 0x7D, 0x51, 0x29, 0x7D,
     0x07, 0x60, 0x7D, 0x09, 0x2B, 0x7F, 0x5C, 0x7D, 0x7E, 0x3F, 0x7A, 0x7D, 0x19, 0x54, 0x7D, 0x09,
@@ -12723,10 +12723,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x5D, 0x16, 0x61, 0x61, 0x7C, 0xED, 0xAF, 0x63, 0x6E, 0x72, 0x73, 0x7E, 0xC3, 0xF0, 0x7F,
     0xFF, 0xFB, 0x7C, 0xE9, 0x6B, 0x63, 0x73, 0x74, 0x77, 0x7C, 0xE9, 0xCD, 0x7C, 0xED, 0x8B, 0x7C,
     0xED, 0x8B, 0x21, 0x72, 0xF3, 0x64, 0x61, 0x65, 0x69, 0x79, 0x7D, 0x14, 0x1C, 0x7F, 0xFF, 0xFD,
-    0x7C, 0xE9, 0x9A, 0x7C, 0xE9, 0x51, 0x6D, 0x61, 0xC3, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E,
-    0x6F, 0x73, 0x74, 0x7A, 0x7F, 0xFF, 0x4B, 0x7D, 0x16, 0xCE, 0x7F, 0xFF, 0x69, 0x7F, 0xFF, 0x7D,
-    0x7C, 0xF2, 0x55, 0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xAA, 0x7C, 0xE8, 0xD6, 0x7C, 0xE8, 0xD3, 0x7D,
-    0x02, 0x84, 0x7F, 0xFF, 0xBC, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xEF, 0x63, 0x65, 0x66, 0x70, 0x7D,
+    0x7C, 0xE9, 0x9A, 0x7C, 0xE9, 0x51, 0x6D, 0x61, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6E, 0x6F,
+    0x73, 0x74, 0x7A, 0xC3, 0x7F, 0xFF, 0x4B, 0x7F, 0xFF, 0x69, 0x7F, 0xFF, 0x7D, 0x7C, 0xF2, 0x55,
+    0x7F, 0xFF, 0x9D, 0x7F, 0xFF, 0xAA, 0x7C, 0xE8, 0xD6, 0x7C, 0xE8, 0xD3, 0x7D, 0x02, 0x84, 0x7F,
+    0xFF, 0xBC, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xEF, 0x7D, 0x16, 0xCE, 0x63, 0x65, 0x66, 0x70, 0x7D,
     0x0E, 0xD8, 0x7D, 0x0E, 0xB4, 0x7C, 0xF4, 0xC3, 0x65, 0x64, 0x65, 0x67, 0x6E, 0x74, 0x7C, 0xE8,
     0x91, 0x7C, 0xE8, 0x91, 0x7C, 0xEA, 0x59, 0x7C, 0xE8, 0x91, 0x7D, 0x02, 0x79, 0x62, 0xA4, 0xB6,
     0x7D, 0x02, 0x2D, 0x7D, 0x13, 0xE8, 0x62, 0x67, 0x6E, 0x7E, 0x52, 0x6D, 0x7D, 0x02, 0x17, 0x65,
@@ -12748,10 +12748,10 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x61, 0x6D, 0x6E, 0x72, 0x7F, 0xFF, 0xF0, 0x7C, 0xE7, 0xB7, 0x7F, 0xFF, 0xF5, 0x61, 0x61, 0x7F,
     0x12, 0xDF, 0x66, 0x61, 0x65, 0x69, 0x6F, 0x72, 0x73, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xEC, 0x7C,
     0xEF, 0xBC, 0x7C, 0xE8, 0x1D, 0x7F, 0xFF, 0xFB, 0x7C, 0xE8, 0x0C, 0x61, 0x65, 0x7F, 0x32, 0x3B,
-    0x6F, 0x61, 0xC3, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x71, 0x73, 0x74, 0x77, 0x7A,
-    0x7F, 0xFE, 0xB8, 0x7F, 0xFE, 0xCD, 0x7F, 0xFE, 0xDF, 0x7F, 0xFE, 0xF4, 0x7F, 0xFE, 0xFD, 0x7F,
-    0xFF, 0x1F, 0x7F, 0xFF, 0x3F, 0x7F, 0xFF, 0x5E, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x7D, 0x7D, 0x02,
-    0x8C, 0x7F, 0xFF, 0xA2, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xFB, 0x7F, 0x1D, 0x85, 0xE1, 0x00, 0xB1,
+    0x6F, 0x61, 0x65, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x71, 0x73, 0x74, 0x77, 0x7A, 0xC3,
+    0x7F, 0xFE, 0xB8, 0x7F, 0xFE, 0xDF, 0x7F, 0xFE, 0xF4, 0x7F, 0xFE, 0xFD, 0x7F, 0xFF, 0x1F, 0x7F,
+    0xFF, 0x3F, 0x7F, 0xFF, 0x5E, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x7D, 0x7D, 0x02, 0x8C, 0x7F, 0xFF,
+    0xA2, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xFB, 0x7F, 0x1D, 0x85, 0x7F, 0xFE, 0xCD, 0xE1, 0x00, 0xB1,
     0x75, 0x7C, 0xE7, 0x0C, 0xE2, 0x10, 0xC2, 0x67, 0x6E, 0x7C, 0xEA, 0x7C, 0x7C, 0xEA, 0x7C, 0xE2,
     0x28, 0x22, 0x66, 0x7A, 0x7C, 0xEA, 0x71, 0x7C, 0xEA, 0x71, 0x63, 0x62, 0x6E, 0x72, 0x7C, 0xE7,
     0x5C, 0x7E, 0x42, 0xD4, 0x7F, 0xFF, 0xF5, 0x62, 0x2E, 0x6E, 0x7C, 0xE7, 0x5F, 0x7C, 0xE7, 0x5F,
@@ -12884,25 +12884,232 @@ alignas(4) constexpr uint8_t de_trie_data[] = {
     0x7D, 0x03, 0x68, 0x7C, 0xFE, 0x22, 0x7D, 0xC5, 0x44, 0x7C, 0xE8, 0x80, 0xE2, 0x06, 0xC1, 0x6C,
     0x72, 0x7C, 0xDE, 0xF0, 0x7D, 0x03, 0x57, 0x61, 0x67, 0x7C, 0xE7, 0xBD, 0xE6, 0x06, 0xF1, 0x61,
     0x69, 0x6F, 0xC3, 0x75, 0x77, 0x7F, 0xFF, 0xD8, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xF0, 0x7D, 0x04,
-    0x89, 0x7F, 0xFF, 0xFB, 0x7C, 0xF8, 0x58, 0xFA, 0x07, 0xB1, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65,
-    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
-    0x76, 0x77, 0x79, 0x7A, 0x7F, 0xF2, 0x30, 0x7F, 0xF3, 0x10, 0x7F, 0xF3, 0x1E, 0x7C, 0xFD, 0xAA,
-    0x7F, 0xF3, 0x47, 0x7F, 0xF8, 0x92, 0x7F, 0xF8, 0xDB, 0x7F, 0xF9, 0x03, 0x7F, 0xF9, 0x08, 0x7F,
-    0xFA, 0x52, 0x7C, 0xF9, 0x47, 0x7F, 0xFA, 0x93, 0x7F, 0xFA, 0xBB, 0x7F, 0xFA, 0xCF, 0x7F, 0xFA,
-    0xDF, 0x7F, 0xFB, 0x9E, 0x7F, 0xFB, 0xE3, 0x7C, 0xF9, 0x47, 0x7F, 0xFB, 0xEA, 0x7F, 0xFC, 0x0D,
-    0x7F, 0xFC, 0xAA, 0x7F, 0xFE, 0x54, 0x7C, 0xF9, 0x47, 0x7F, 0xFF, 0x92, 0x7F, 0xFF, 0xAC, 0x7F,
-    0xFF, 0xE5, 0x7C, 0x2E, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B,
-    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7C,
-    0xF7, 0x80, 0x7D, 0x2B, 0x60, 0x7D, 0x3D, 0x63, 0x7D, 0x54, 0x1A, 0x7D, 0x5E, 0x81, 0x7D, 0x7A,
-    0x65, 0x7D, 0xBB, 0x52, 0x7D, 0xD2, 0x23, 0x7D, 0xEB, 0xF8, 0x7E, 0x14, 0x69, 0x7E, 0x43, 0x7E,
-    0x7E, 0x45, 0xF1, 0x7E, 0x61, 0x55, 0x7E, 0x91, 0x68, 0x7E, 0xAA, 0x83, 0x7E, 0xD7, 0x5A, 0x7E,
-    0xFB, 0xCC, 0x7F, 0x11, 0xCB, 0x7F, 0x12, 0x5D, 0x7F, 0x4B, 0xD4, 0x7F, 0x80, 0x63, 0x7F, 0xB4,
-    0x7A, 0x7F, 0xD7, 0xDB, 0x7F, 0xDD, 0x75, 0x7F, 0xE7, 0xD3, 0x7F, 0xEB, 0xDF, 0x7F, 0xEF, 0xED,
-    0x7F, 0xFF, 0x95,
+    0x89, 0x7F, 0xFF, 0xFB, 0x7C, 0xF8, 0x58, 0xFA, 0x07, 0xB1, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x79, 0x7A, 0xC3, 0x7F, 0xF2, 0x30, 0x7F, 0xF3, 0x1E, 0x7C, 0xFD, 0xAA, 0x7F, 0xF3, 0x47,
+    0x7F, 0xF8, 0x92, 0x7F, 0xF8, 0xDB, 0x7F, 0xF9, 0x03, 0x7F, 0xF9, 0x08, 0x7F, 0xFA, 0x52, 0x7C,
+    0xF9, 0x47, 0x7F, 0xFA, 0x93, 0x7F, 0xFA, 0xBB, 0x7F, 0xFA, 0xCF, 0x7F, 0xFA, 0xDF, 0x7F, 0xFB,
+    0x9E, 0x7F, 0xFB, 0xE3, 0x7C, 0xF9, 0x47, 0x7F, 0xFB, 0xEA, 0x7F, 0xFC, 0x0D, 0x7F, 0xFC, 0xAA,
+    0x7F, 0xFE, 0x54, 0x7C, 0xF9, 0x47, 0x7F, 0xFF, 0x92, 0x7F, 0xFF, 0xAC, 0x7F, 0xFF, 0xE5, 0x7F,
+    0xF3, 0x10, 0x7C, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0x7C,
+    0xF7, 0x80, 0x7D, 0x2B, 0x60, 0x7D, 0x54, 0x1A, 0x7D, 0x5E, 0x81, 0x7D, 0x7A, 0x65, 0x7D, 0xBB,
+    0x52, 0x7D, 0xD2, 0x23, 0x7D, 0xEB, 0xF8, 0x7E, 0x14, 0x69, 0x7E, 0x43, 0x7E, 0x7E, 0x45, 0xF1,
+    0x7E, 0x61, 0x55, 0x7E, 0x91, 0x68, 0x7E, 0xAA, 0x83, 0x7E, 0xD7, 0x5A, 0x7E, 0xFB, 0xCC, 0x7F,
+    0x11, 0xCB, 0x7F, 0x12, 0x5D, 0x7F, 0x4B, 0xD4, 0x7F, 0x80, 0x63, 0x7F, 0xB4, 0x7A, 0x7F, 0xD7,
+    0xDB, 0x7F, 0xDD, 0x75, 0x7F, 0xE7, 0xD3, 0x7F, 0xEB, 0xDF, 0x7F, 0xEF, 0xED, 0x7F, 0xFF, 0x95,
+    0x7D, 0x3D, 0x63,
+};
+
+// Dense lookup tables for the root and depth-1 transitions; nodes with at least
+// 12 transitions have their labels sorted.
+constexpr uint8_t de_root_slots[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint8_t de_byte_classes[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A,
+    0xFF, 0x1B, 0x1C, 0xFF, 0x1D, 0xFF, 0xFF, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0xFF, 0x23, 0xFF, 0x24,
+    0xFF, 0x25, 0xFF, 0x26, 0xFF, 0xFF, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint32_t de_depth1_targets[] = {
+    0x00001CC2u, 0x000050A2u, 0x0000795Cu, 0x000083C3u, 0x00009FA7u, 0x0000E094u, 0x0000F765u, 0x0001113Au,
+    0x000139ABu, 0x000168C0u, 0x00016B33u, 0x00018697u, 0x0001B6AAu, 0x0001CFC5u, 0x0001FC9Cu, 0x0002210Eu,
+    0x0002370Du, 0x0002379Fu, 0x00027116u, 0x0002A5A5u, 0x0002D9BCu, 0x0002FD1Du, 0x000302B7u, 0x00030D15u,
+    0x00031121u, 0x0003152Fu, 0x000324D7u, 0x000062A5u,
+};
+
+constexpr uint32_t de_depth2_targets[] = {
+    0x000006AFu, 0x0000086Bu, 0x000008ADu, 0x00000A1Fu, 0x00000D34u, 0x00000E31u, 0x00000F31u, 0x0000102Du,
+    0x00001090u, 0x000010B4u, 0x0000110Bu, 0x00001232u, 0x00001368u, 0x00001442u, 0x000014F6u, 0x00001596u,
+    0xFFFFFFFFu, 0x000016D5u, 0x0000186Eu, 0x00001A48u, 0x00001AF9u, 0x00001B29u, 0x00001BEDu, 0x00001BFDu,
+    0x00001C08u, 0x00001CB2u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x000006FDu, 0x00001DDDu, 0x0000203Cu, 0x00002291u, 0x00002405u, 0x000027B6u, 0x0000298Du,
+    0x00002B8Bu, 0x00002D6Bu, 0x00002E8Au, 0x00002EB9u, 0x00002FFAu, 0x000035C2u, 0x00003845u, 0x00003E74u,
+    0x00003EDCu, 0x00003FA7u, 0x00003FD6u, 0x00004563u, 0x0000485Du, 0x00004BA6u, 0x00004F94u, 0x00004FFCu,
+    0x00005012u, 0x00005031u, 0x00005057u, 0x00005092u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001E11u, 0x000065E9u, 0x000066C5u, 0x000066DDu, 0x000066F6u,
+    0x00006CC5u, 0x00006D2Au, 0x00006D5Au, 0x00006D66u, 0x00006E92u, 0x00006ECEu, 0x00006ED3u, 0x000070AFu,
+    0x000070CEu, 0x000070DAu, 0x00007212u, 0x0000724Eu, 0x00001E1Eu, 0x0000746Bu, 0x000076D4u, 0x0000772Fu,
+    0x000078D1u, 0x00001E1Eu, 0x0000790Cu, 0xFFFFFFFFu, 0x00007931u, 0x00007953u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000667Au, 0x000079FEu, 0xFFFFFFFFu,
+    0x00007A46u, 0x00007A4Fu, 0x00007AD0u, 0x00001D6Cu, 0x00001D14u, 0x00007F5Cu, 0x00007FB5u, 0xFFFFFFFFu,
+    0x000081AAu, 0x00008225u, 0x00008230u, 0xFFFFFFFFu, 0x000082D6u, 0x00002281u, 0x00001E1Eu, 0x00008337u,
+    0x00008359u, 0x0000837Bu, 0x000083A3u, 0x00007034u, 0xFFFFFFFFu, 0x00001E1Eu, 0x000083BAu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00007A35u,
+    0x0000886Eu, 0x00008948u, 0x0000895Fu, 0x000089A3u, 0x0000918Au, 0x000091D7u, 0x00009212u, 0x00009232u,
+    0x00009496u, 0x00001E1Eu, 0x000094D8u, 0x00009517u, 0x00002281u, 0x00009541u, 0x000096C5u, 0x00006358u,
+    0x00001E1Eu, 0x000099EBu, 0x00009CC3u, 0x00009D61u, 0x00009EF4u, 0x00009F31u, 0x00009F60u, 0xFFFFFFFFu,
+    0x00009F8Eu, 0x00001E5Au, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00008941u, 0x0000A1CCu, 0x0000A3DCu, 0x0000A590u, 0x0000A6FDu, 0x0000A918u, 0x0000AAF3u,
+    0x0000AC64u, 0x0000AFAEu, 0x0000B63Bu, 0x0000B68Du, 0x0000B76Bu, 0x0000BE06u, 0x0000C016u, 0x0000C7C2u,
+    0x0000C8C4u, 0x0000C9C5u, 0x0000CA08u, 0x0000D40Bu, 0x0000D8EBu, 0x0000DC1Du, 0x0000DECDu, 0x0000DF3Cu,
+    0x0000DFA0u, 0x0000E00Bu, 0x0000E045u, 0x0000E07Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000A227u, 0x0000E37Eu, 0x0000E492u, 0x000066DDu, 0x0000E49Du,
+    0x0000E8E8u, 0x0000EA48u, 0x0000EA98u, 0x0000EAABu, 0x0000EC93u, 0x0000ECDBu, 0x0000ECEAu, 0x0000EE5Eu,
+    0x0000EE9Cu, 0x0000EEA7u, 0x0000EF9Au, 0x00006358u, 0x00001E1Eu, 0x0000F18Bu, 0x0000F3B8u, 0x0000F5E2u,
+    0x0000F713u, 0x00001E1Eu, 0x00001E1Eu, 0xFFFFFFFFu, 0x00001D6Cu, 0x0000F756u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000E46Eu, 0x0000FAD2u, 0x0000FB6Eu,
+    0x00002281u, 0x0000FBF0u, 0x000101E4u, 0x00010240u, 0x00010265u, 0x000102AEu, 0x0001040Du, 0x00001E1Eu,
+    0x0001045Bu, 0x000106DEu, 0x00010728u, 0x00010812u, 0x0001095Eu, 0x0001099Fu, 0x000109AAu, 0x00010C03u,
+    0x00010EFFu, 0x00010F68u, 0x000110E0u, 0x00011111u, 0x00011118u, 0xFFFFFFFFu, 0x00003171u, 0x0001112Fu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000FB5Bu,
+    0x00011704u, 0x00011841u, 0x0001184Fu, 0x0001185Au, 0x00011E37u, 0x00011E8Fu, 0x00011EA9u, 0x00011EDBu,
+    0x000120F9u, 0xFFFFFFFFu, 0x0001214Au, 0x000123F6u, 0x00012566u, 0x000126E4u, 0x0001293Eu, 0x00012993u,
+    0xFFFFFFFFu, 0x00012D2Du, 0x00013143u, 0x00013674u, 0x000138C1u, 0x00001E1Eu, 0x00013941u, 0xFFFFFFFFu,
+    0x0001397Au, 0x000139A0u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00011822u, 0x00013C9Cu, 0x00013E98u, 0x0001402Eu, 0x0001415Du, 0x000146C1u, 0x00014877u,
+    0x00014AB6u, 0x00014B4Du, 0x00014B81u, 0x00014BADu, 0x00014DC7u, 0x0001516Eu, 0x00015338u, 0x000158EFu,
+    0x00015A30u, 0x00015AF2u, 0xFFFFFFFFu, 0x00015CDDu, 0x000161AEu, 0x00016655u, 0x00016696u, 0x000167B5u,
+    0x000167D8u, 0x000167EDu, 0x00001D6Cu, 0x0001689Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00013D4Au, 0x0001696Fu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001E1Eu,
+    0x00016A1Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00016A42u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00002281u, 0xFFFFFFFFu, 0x00016A8Fu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00016AC0u,
+    0x00016B14u, 0x00001E1Eu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00016FA7u, 0x0001705Fu,
+    0x00017072u, 0x00017085u, 0x0001758Du, 0x000175E5u, 0x00017607u, 0x00017622u, 0x00017795u, 0x000177D6u,
+    0x00017801u, 0x00017A1Du, 0x00017A4Cu, 0x00017AE8u, 0x00017D47u, 0x00017D97u, 0x0001152Fu, 0x00017F4Fu,
+    0x00018209u, 0x0001844Eu, 0x00018633u, 0x00011111u, 0x00001E1Eu, 0xFFFFFFFFu, 0x0001866Eu, 0x00018690u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00017053u,
+    0x00018E97u, 0x00019152u, 0x000191FCu, 0x0001943Du, 0x00019C54u, 0x00019D33u, 0x00019DA3u, 0x00019DD9u,
+    0x0001A191u, 0x00001E1Eu, 0x0001A25Bu, 0x0001A5C4u, 0x0001A72Au, 0x0001A782u, 0x0001A9D8u, 0x0001AA70u,
+    0x00001E1Eu, 0x0001AAD2u, 0x0001AE05u, 0x0001B1B2u, 0x0001B4DAu, 0x0001B528u, 0x00001E1Eu, 0x00001E1Eu,
+    0x0001B55Cu, 0x0001B67Bu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00019028u, 0x0001BCEFu, 0x0001BDF9u, 0x0001BE18u, 0x0001BE97u, 0x0001C313u, 0x0001C369u,
+    0x0001C378u, 0x0001C391u, 0x0001C5AEu, 0x0001C5F9u, 0x00006358u, 0x0001C60Eu, 0x0001C7C5u, 0x0001C80Bu,
+    0x0001C984u, 0x0001CABEu, 0x00001E1Eu, 0x0001CAF4u, 0x0001CC46u, 0x0001CDC3u, 0x0001CF49u, 0x00001E1Eu,
+    0x0001CFA4u, 0xFFFFFFFFu, 0x0001CFB2u, 0x00001E5Au, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0001BDBCu, 0x0001D6B0u, 0x0001D88Du, 0x0001D8F1u, 0x0001DB6Eu,
+    0x0001E22Eu, 0x0001E31Eu, 0x0001E52Du, 0x0001E58Fu, 0x0001E871u, 0x000177D6u, 0x0001EADEu, 0x0001EB49u,
+    0x0001EB80u, 0x0001ECD8u, 0x0001EF37u, 0x0001EFA6u, 0x00001E1Eu, 0x0001EFFBu, 0x0001F4EFu, 0x0001F8BEu,
+    0x0001FA7Bu, 0x0001FAD7u, 0x0001FAF9u, 0x00001D6Cu, 0x0001FB12u, 0x0001FC81u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0001D815u, 0x0001FD84u, 0x0001FF6Du,
+    0x000200BEu, 0x000201A8u, 0x000203F7u, 0x00020584u, 0x00020666u, 0x000207EFu, 0x0002086Bu, 0x00020897u,
+    0x0002091Du, 0x00020BFEu, 0x00020DC5u, 0x00021159u, 0x0002121Eu, 0x000213D4u, 0xFFFFFFFFu, 0x000219E1u,
+    0x00021CB9u, 0x00021F4Eu, 0x0002200Fu, 0x0002204Eu, 0x00022075u, 0x000220A4u, 0x000220C5u, 0x000220FDu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0001FE08u,
+    0x0002248Fu, 0x00001E1Eu, 0x00022590u, 0x00022597u, 0x0002283Au, 0x00022A65u, 0x00022AABu, 0x00022B6Fu,
+    0x00022D3Du, 0x00001E1Eu, 0x00022D77u, 0x00022DEFu, 0x00022E0Eu, 0x00022E19u, 0x00022FFCu, 0x00023172u,
+    0xFFFFFFFFu, 0x00023375u, 0x0002341Fu, 0x00023590u, 0x000236C0u, 0x00001E1Eu, 0x000236FBu, 0xFFFFFFFFu,
+    0x00023702u, 0x00001E1Eu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00022587u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001E1Eu, 0xFFFFFFFFu, 0x0002378Cu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00024080u, 0x000243A9u, 0x0002445Du, 0x000246B6u,
+    0x0002505Au, 0x00025155u, 0x0002536Fu, 0x00025424u, 0x0002588Cu, 0x00001E1Eu, 0x00025A7Bu, 0x00025B42u,
+    0x00025D3Au, 0x00025F4Cu, 0x0002630Eu, 0x000263A9u, 0x00001E1Eu, 0x000264D9u, 0x00026813u, 0x00026BCCu,
+    0x00026EE3u, 0x00026F42u, 0x00026F64u, 0x00002281u, 0x00026F75u, 0x000270F8u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00024234u, 0x000276F7u, 0x00027873u,
+    0x00027CD0u, 0x00027D28u, 0x000284E6u, 0x00028557u, 0x0002859Fu, 0x00028654u, 0x000289A1u, 0x000177D6u,
+    0x00028B4Cu, 0x00028BFDu, 0x00028C7Au, 0x00028CB3u, 0x00028EC4u, 0x000292C4u, 0x0001152Fu, 0x0002933Cu,
+    0x000296CDu, 0x0002A21Du, 0x0002A44Cu, 0x0002A49Du, 0x0002A4D0u, 0xFFFFFFFFu, 0x0002A4FBu, 0x0002A57Au,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00027822u,
+    0x0002AE9Cu, 0x0002B0A8u, 0x0002B0E5u, 0x0002B10Au, 0x0002BC01u, 0x0002BC6Cu, 0x0002BCCAu, 0x0002BE7Au,
+    0x0002C308u, 0x00001E1Eu, 0x0002C34Au, 0x0002C38Eu, 0x0002C3D9u, 0x0002C404u, 0x0002C7AAu, 0x0002C808u,
+    0x00001E1Eu, 0x0002CD33u, 0x0002D182u, 0x0002D489u, 0x0002D7B8u, 0x0002D802u, 0x0002D830u, 0x00002281u,
+    0x0002D844u, 0x0002D9A1u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x0002B06Bu, 0x0002DB49u, 0x0002DCA0u, 0x0002DE93u, 0x0002DF1Bu, 0x0002E364u, 0x0002E56Fu,
+    0x0002E74Du, 0x0002E7EFu, 0x0002E87Du, 0x000067C7u, 0x0002E92Cu, 0x0002EAF3u, 0x0002ECABu, 0x0002F092u,
+    0x0002F11Eu, 0x0002F1CEu, 0xFFFFFFFFu, 0x0002F581u, 0x0002F942u, 0x0002FC0Du, 0x0002FC5Au, 0x0002FC77u,
+    0xFFFFFFFFu, 0x0002FC8Bu, 0x0002FC9Au, 0x0002FD02u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0002DBB3u, 0x0002FE89u, 0x00001E5Au, 0x00002281u, 0x0002FEBEu,
+    0x0003004Cu, 0x0003008Du, 0x00001E5Au, 0x00002281u, 0x00030157u, 0x00001E1Eu, 0x00006358u, 0x00030191u,
+    0x0003019Cu, 0x00002281u, 0x0003022Bu, 0x00030250u, 0x00001E1Eu, 0x00030261u, 0x0003027Fu, 0x00001E5Au,
+    0x000302B2u, 0x00001E1Eu, 0x00001E1Eu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001E1Eu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0003024Du, 0x00030522u, 0x000305D4u,
+    0x00002281u, 0x00001E1Eu, 0x000309C9u, 0x00002281u, 0x00001E1Eu, 0x00030A0Du, 0x00030B24u, 0x00001D11u,
+    0x00002281u, 0x00002281u, 0x00002281u, 0x00030B56u, 0x00030BEEu, 0x00002281u, 0x00001E1Eu, 0x00030BFBu,
+    0x00030C12u, 0x00030C29u, 0x00030CF8u, 0xFFFFFFFFu, 0x00001E1Eu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001E1Eu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000305CDu,
+    0x00030DC1u, 0x00001E5Au, 0x00030DFCu, 0x00030E0Fu, 0x00030E48u, 0x00030E77u, 0x00001E5Au, 0x00002281u,
+    0x00030ED7u, 0xFFFFFFFFu, 0x00030F0Au, 0x00030F11u, 0x00030F24u, 0x00002281u, 0x00030F3Au, 0x00030F7Du,
+    0xFFFFFFFFu, 0x00002281u, 0x00030F94u, 0x000310B1u, 0x000310F6u, 0x0003110Du, 0x00001E1Eu, 0xFFFFFFFFu,
+    0x0003111Cu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00030F57u, 0x000311B0u, 0x00002526u, 0x000311E2u, 0x000311FDu, 0x00031229u, 0x0003124Cu,
+    0x00031258u, 0x00031261u, 0x00006358u, 0xFFFFFFFFu, 0x00031268u, 0x000312E0u, 0x00031321u, 0x0003136Bu,
+    0x000313C1u, 0x0003141Cu, 0xFFFFFFFFu, 0x00031460u, 0x000314BFu, 0x00031501u, 0x0003150Fu, 0x00031519u,
+    0x00031522u, 0x00001D6Cu, 0x00001D6Cu, 0x0003152Cu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000311D6u, 0x00031707u, 0x000317F5u, 0x00002281u, 0x0003181Eu,
+    0x00031D69u, 0x00031DB2u, 0x00031DDAu, 0x00031DDFu, 0x00031F29u, 0x00001E1Eu, 0x00031F6Au, 0x00031F92u,
+    0x00031FA6u, 0x00031FB6u, 0x00032075u, 0x000320BAu, 0x00001E1Eu, 0x000320C1u, 0x000320E4u, 0x00032181u,
+    0x0003232Bu, 0x00001E1Eu, 0x00032469u, 0xFFFFFFFFu, 0x00032483u, 0x000324BCu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000317E7u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00005CC6u, 0x00002303u, 0x0000577Eu, 0x00005738u, 0x00001EF8u, 0x000057A5u, 0x0000578Au, 0x000057AEu,
+    0x000057AAu, 0x00002303u, 0x00002303u, 0x000057B4u, 0x000057BEu, 0x00005AC1u, 0x0000626Eu, 0xFFFFFFFFu,
+};
+
+constexpr SerializedTrieAcceleration de_acceleration = {
+    de_root_slots,
+    de_byte_classes,
+    de_depth1_targets,
+    de_depth2_targets,
+    42u,
+    12u,
 };
 
 constexpr SerializedHyphenationPatterns de_patterns = {
     0x32542u,
     de_trie_data,
     sizeof(de_trie_data),
+    &de_acceleration,
 };
@@ -78,9 +78,9 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x41, 0x72, 0xFE, 0x9E, 0xC1, 0x00, 0x71, 0x6C, 0xFE, 0x3A, 0x41, 0x65, 0xFE, 0x4F, 0xA0, 0x11,
     0x73, 0x21, 0x6C, 0xFD, 0x21, 0x79, 0xFD, 0x21, 0x68, 0xFD, 0xA0, 0x11, 0xA2, 0x21, 0x62, 0xFD,
     0x21, 0x69, 0xFD, 0x21, 0x73, 0xFD, 0x21, 0x72, 0xFD, 0xA1, 0x00, 0xD1, 0x65, 0xFD, 0x4D, 0x61,
-    0x62, 0x65, 0x67, 0x6C, 0x6E, 0x71, 0x72, 0x73, 0x75, 0x79, 0x74, 0x76, 0xFF, 0x9F, 0xFE, 0x0A,
-    0xFF, 0xA4, 0xFF, 0xA8, 0xFF, 0xAF, 0xFF, 0xBC, 0xFF, 0xCF, 0xFF, 0xD2, 0xFE, 0x1C, 0xFF, 0xD6,
-    0xFF, 0xDC, 0xFF, 0xE9, 0xFF, 0xFB, 0x41, 0x73, 0xFF, 0x71, 0x41, 0x6D, 0xFE, 0xF6, 0x21, 0x72,
+    0x62, 0x65, 0x67, 0x6C, 0x6E, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x79, 0xFF, 0x9F, 0xFE, 0x0A,
+    0xFF, 0xA4, 0xFF, 0xA8, 0xFF, 0xAF, 0xFF, 0xBC, 0xFF, 0xCF, 0xFF, 0xD2, 0xFE, 0x1C, 0xFF, 0xE9,
+    0xFF, 0xD6, 0xFF, 0xFB, 0xFF, 0xDC, 0x41, 0x73, 0xFF, 0x71, 0x41, 0x6D, 0xFE, 0xF6, 0x21, 0x72,
     0xFC, 0x22, 0x65, 0x6F, 0xF5, 0xFD, 0xA0, 0x11, 0xC3, 0x21, 0x6D, 0xFD, 0x21, 0x6F, 0xFD, 0xA1,
     0x00, 0xD1, 0x73, 0xFD, 0xA0, 0x01, 0x32, 0x21, 0x74, 0xFD, 0xA0, 0x11, 0xF2, 0x43, 0x67, 0x6D,
     0x74, 0xFD, 0xD3, 0xFD, 0xF8, 0xFF, 0xFD, 0xA2, 0x00, 0xD1, 0x6E, 0x6F, 0xF0, 0xF6, 0x42, 0x61,
@@ -151,11 +151,11 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x65, 0x69, 0xED, 0xFD, 0x41, 0x6C, 0xFD, 0x15, 0xA0, 0x14, 0x32, 0x21, 0x6C, 0xFD, 0x21, 0x62,
     0xFD, 0x22, 0x69, 0x65, 0xF3, 0xFD, 0xA0, 0x12, 0x32, 0x21, 0x69, 0xFD, 0x21, 0x6E, 0xFD, 0x21,
     0x6C, 0xFD, 0xA0, 0x12, 0x53, 0x21, 0x65, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x72, 0xFD, 0x22, 0x69,
-    0x6F, 0xF1, 0xFD, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6C, 0x6D,
-    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x6B, 0xF9, 0xE3, 0xFA, 0x40, 0xFA,
-    0xA2, 0xFA, 0xF2, 0xFB, 0x6B, 0xFB, 0x9E, 0xFB, 0xD2, 0xFC, 0x32, 0xFC, 0x74, 0xFC, 0x84, 0xFC,
-    0xD1, 0xFD, 0x53, 0xFD, 0x85, 0xFD, 0xBB, 0xFE, 0x0B, 0xFE, 0x76, 0xFE, 0xE7, 0xFF, 0x65, 0xFF,
-    0xA8, 0xFF, 0xCC, 0xFF, 0xDE, 0xF9, 0xB2, 0xFF, 0xFB, 0xA0, 0x01, 0x91, 0xA0, 0x01, 0x71, 0x22,
+    0x6F, 0xF1, 0xFD, 0x57, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C,
+    0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0xF9, 0xE3, 0xFA, 0x40, 0xFA,
+    0xA2, 0xFA, 0xF2, 0xFB, 0x6B, 0xFB, 0x9E, 0xFB, 0xD2, 0xFC, 0x32, 0xFC, 0x74, 0xFC, 0x84, 0xFF,
+    0xFB, 0xFC, 0xD1, 0xFD, 0x53, 0xFD, 0x85, 0xFD, 0xBB, 0xFE, 0x0B, 0xFE, 0x76, 0xFE, 0xE7, 0xFF,
+    0x65, 0xFF, 0xA8, 0xFF, 0xCC, 0xFF, 0xDE, 0xF9, 0xB2, 0xA0, 0x01, 0x91, 0xA0, 0x01, 0x71, 0x22,
     0x6C, 0x6E, 0xFD, 0xFD, 0xA0, 0x01, 0x21, 0x21, 0x64, 0xFD, 0xA1, 0x00, 0xD1, 0x72, 0xFD, 0xA0,
     0x01, 0xA2, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x42, 0x61, 0x74, 0xF9, 0x28, 0xFF, 0xFD, 0x21,
     0x74, 0xE5, 0x21, 0x61, 0xFD, 0xA0, 0x01, 0xC2, 0x22, 0x7A, 0x63, 0xFD, 0xD4, 0x21, 0x69, 0xFB,
@@ -287,8 +287,8 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0xA0, 0x01, 0x92, 0x42, 0x69, 0x75, 0xF8, 0x30, 0xF8, 0x01, 0x41, 0x72, 0xF7, 0xFA, 0xC2, 0x04,
     0x42, 0x70, 0x74, 0xF8, 0x2D, 0xFF, 0xFC, 0x41, 0x7A, 0xF1, 0x29, 0xC3, 0x02, 0x71, 0x69, 0x72,
     0x77, 0xFF, 0xFC, 0xF7, 0xE9, 0xF8, 0x20, 0x41, 0x69, 0xFC, 0xAF, 0x4C, 0x2E, 0x61, 0x64, 0x67,
-    0x6C, 0x6D, 0x6E, 0x73, 0x74, 0x77, 0x79, 0x76, 0xF7, 0xCE, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xC5,
-    0xFF, 0xCC, 0xFF, 0xD5, 0xFF, 0xD8, 0xFF, 0xE3, 0xFF, 0xF0, 0xF8, 0x10, 0xFB, 0x89, 0xFF, 0xFC,
+    0x6C, 0x6D, 0x6E, 0x73, 0x74, 0x76, 0x77, 0x79, 0xF7, 0xCE, 0xFF, 0xB2, 0xFF, 0xB9, 0xFF, 0xC5,
+    0xFF, 0xCC, 0xFF, 0xD5, 0xFF, 0xD8, 0xFF, 0xE3, 0xFF, 0xF0, 0xFF, 0xFC, 0xF8, 0x10, 0xFB, 0x89,
     0xA0, 0x02, 0x41, 0xA0, 0x04, 0x62, 0xA0, 0x15, 0x32, 0x21, 0x66, 0xFD, 0xA1, 0x02, 0x31, 0x69,
     0xFD, 0xC2, 0x02, 0x71, 0x6E, 0x72, 0xF7, 0xA3, 0xF8, 0x30, 0xA0, 0x04, 0x82, 0x41, 0x7A, 0xF7,
     0xCE, 0x41, 0x62, 0xF2, 0x55, 0x21, 0x61, 0xFC, 0xA2, 0x03, 0xD1, 0x69, 0x6C, 0xF5, 0xFD, 0x41,
@@ -356,9 +356,9 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0xFA, 0xF5, 0xAD, 0xEE, 0x83, 0x43, 0x65, 0x68, 0x69, 0xF3, 0xA4, 0xF3, 0xE6, 0xF5, 0x83, 0x42,
     0x61, 0x69, 0xF3, 0x9A, 0xF3, 0x9A, 0x21, 0x74, 0xF9, 0x41, 0x7A, 0xEC, 0xD1, 0xA1, 0x03, 0xE2,
     0x69, 0xFC, 0xA0, 0x10, 0x42, 0x21, 0x72, 0xFD, 0x21, 0x61, 0xFD, 0xCE, 0x03, 0xD1, 0x61, 0x63,
-    0x65, 0x66, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x7A, 0x67, 0xFF, 0x9E, 0xF3, 0x89,
-    0xFF, 0xA7, 0xFF, 0xB2, 0xF3, 0x7E, 0xFF, 0xB5, 0xFB, 0xD5, 0xFF, 0xC8, 0xED, 0x17, 0xFF, 0xDA,
-    0xFF, 0xEB, 0xFF, 0xF2, 0xF5, 0x75, 0xFF, 0xFD, 0xC1, 0x01, 0xF1, 0x69, 0xF3, 0x93, 0x41, 0x6F,
+    0x65, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0x7A, 0xFF, 0x9E, 0xF3, 0x89,
+    0xFF, 0xA7, 0xFF, 0xB2, 0xFF, 0xFD, 0xF3, 0x7E, 0xFF, 0xB5, 0xFB, 0xD5, 0xFF, 0xC8, 0xED, 0x17,
+    0xFF, 0xDA, 0xFF, 0xEB, 0xFF, 0xF2, 0xF5, 0x75, 0xC1, 0x01, 0xF1, 0x69, 0xF3, 0x93, 0x41, 0x6F,
     0xF3, 0x4E, 0x21, 0x69, 0xFC, 0x21, 0x74, 0xFD, 0xC2, 0x01, 0x91, 0x61, 0x65, 0xFF, 0xFD, 0xF5,
     0x38, 0x21, 0x72, 0xF7, 0x42, 0x6D, 0x61, 0xEC, 0x64, 0xEC, 0x67, 0x42, 0x63, 0x6D, 0xF3, 0x2E,
     0xEC, 0x57, 0xC4, 0x06, 0x33, 0x61, 0x65, 0x69, 0x79, 0xFF, 0xEF, 0xFF, 0xF2, 0xFF, 0xF9, 0xEC,
@@ -368,9 +368,9 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x21, 0x6F, 0xFD, 0x44, 0x61, 0x69, 0x6C, 0x68, 0xF3, 0x28, 0xFC, 0x1A, 0xF3, 0x7E, 0xFF, 0xFD,
     0x41, 0x6E, 0xED, 0x97, 0x42, 0x62, 0x6F, 0xF2, 0xD5, 0xFF, 0xFC, 0xC1, 0x00, 0x61, 0x65, 0xEB,
     0xF7, 0x42, 0x65, 0x69, 0xEC, 0x0F, 0xF2, 0xD3, 0x41, 0x74, 0xEC, 0xAE, 0x21, 0x73, 0xFC, 0xCE,
-    0x03, 0xD1, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x77, 0x7A, 0x75,
+    0x03, 0xD1, 0x61, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75, 0x76, 0x77, 0x7A,
     0xF2, 0xF4, 0xED, 0x87, 0xFF, 0xA2, 0xFF, 0xAC, 0xFF, 0xB7, 0xFA, 0x1C, 0xFF, 0xBE, 0xFF, 0xD4,
-    0xFF, 0xE5, 0xEC, 0x26, 0xFF, 0xEC, 0xEC, 0x7C, 0xFF, 0xF2, 0xFF, 0xFD, 0x41, 0x63, 0xF4, 0x84,
+    0xFF, 0xE5, 0xEC, 0x26, 0xFF, 0xFD, 0xFF, 0xEC, 0xEC, 0x7C, 0xFF, 0xF2, 0x41, 0x63, 0xF4, 0x84,
     0x42, 0x2E, 0x69, 0xF4, 0x80, 0xFF, 0xFC, 0x42, 0x73, 0x74, 0xF0, 0x9C, 0xFF, 0xF9, 0x41, 0x61,
     0xFA, 0xD5, 0x44, 0x61, 0x64, 0x74, 0x76, 0xEB, 0xBB, 0xF4, 0x6E, 0xFF, 0xFC, 0xEB, 0xA6, 0xC1,
     0x02, 0xE1, 0x65, 0xEB, 0xAB, 0x21, 0x69, 0xFA, 0xC4, 0x00, 0xD1, 0x66, 0x6E, 0x73, 0x74, 0xEB,
@@ -396,8 +396,8 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x64, 0x6B, 0x79, 0xEA, 0x7A, 0xEA, 0x7A, 0xF1, 0x2A, 0x41, 0x62, 0xED, 0x77, 0xC3, 0x02, 0x71,
     0x69, 0x6F, 0x61, 0xFB, 0xF8, 0xF1, 0x1C, 0xFF, 0xFC, 0xC1, 0x05, 0x22, 0x65, 0xEA, 0x57, 0x41,
     0x65, 0xF9, 0x7B, 0x21, 0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0xCC, 0x06, 0xD2, 0x2E, 0x62, 0x63, 0x66,
-    0x67, 0x6D, 0x6E, 0x72, 0x74, 0x76, 0x79, 0x6C, 0xF2, 0xF7, 0xFF, 0xCC, 0xEA, 0x2C, 0xF1, 0x00,
-    0xF9, 0x57, 0xFF, 0xCF, 0xFF, 0xD2, 0xFF, 0xD6, 0xFF, 0xE4, 0xFF, 0xF0, 0xF2, 0xF7, 0xFF, 0xFD,
+    0x67, 0x6C, 0x6D, 0x6E, 0x72, 0x74, 0x76, 0x79, 0xF2, 0xF7, 0xFF, 0xCC, 0xEA, 0x2C, 0xF1, 0x00,
+    0xF9, 0x57, 0xFF, 0xFD, 0xFF, 0xCF, 0xFF, 0xD2, 0xFF, 0xD6, 0xFF, 0xE4, 0xFF, 0xF0, 0xF2, 0xF7,
     0x41, 0x62, 0xF1, 0x05, 0xA0, 0x09, 0xA2, 0x21, 0x62, 0xFD, 0xA2, 0x07, 0x42, 0x61, 0x69, 0xF6,
     0xFD, 0x41, 0x73, 0xF2, 0x96, 0x42, 0x66, 0x6C, 0xEA, 0x14, 0xFF, 0xFC, 0x42, 0x69, 0x6F, 0xEA,
     0x07, 0xF1, 0x6E, 0x41, 0x6E, 0xEF, 0x2E, 0x41, 0x6C, 0xF1, 0x4A, 0xA0, 0x17, 0x22, 0x21, 0x72,
@@ -414,10 +414,10 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x74, 0x75, 0x69, 0xF0, 0x6F, 0xF0, 0x7E, 0xFC, 0x2C, 0xFF, 0xF9, 0xF0, 0xA7, 0xF9, 0x43, 0x41,
     0x63, 0xF3, 0x2E, 0xC2, 0x01, 0xF1, 0x6F, 0x69, 0xF3, 0x2A, 0xFF, 0xFC, 0x41, 0x6C, 0xE9, 0x2E,
     0xA1, 0x01, 0xF1, 0x69, 0xFC, 0xA0, 0x17, 0x42, 0x21, 0x69, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x69,
-    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x52, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x69, 0x6C,
-    0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x79, 0x66, 0xF8, 0x29, 0xFF, 0x0E, 0xFF, 0x15,
-    0xFF, 0x36, 0xFF, 0x43, 0xFF, 0x46, 0xFF, 0x4A, 0xFF, 0x58, 0xFF, 0x7A, 0xFF, 0x8D, 0xFF, 0x9C,
-    0xF0, 0x50, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xDC, 0xFF, 0xE9, 0xEF, 0xD2, 0xFF, 0xFD, 0xA0, 0x02,
+    0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x69, 0xFD, 0x52, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x69,
+    0x6C, 0x6D, 0x6E, 0x70, 0x71, 0x72, 0x73, 0x74, 0x76, 0x79, 0xF8, 0x29, 0xFF, 0x0E, 0xFF, 0x15,
+    0xFF, 0x36, 0xFF, 0x43, 0xFF, 0x46, 0xFF, 0xFD, 0xFF, 0x4A, 0xFF, 0x58, 0xFF, 0x7A, 0xFF, 0x8D,
+    0xFF, 0x9C, 0xF0, 0x50, 0xFF, 0xAF, 0xFF, 0xC3, 0xFF, 0xDC, 0xFF, 0xE9, 0xEF, 0xD2, 0xA0, 0x02,
     0x22, 0x21, 0x74, 0xFD, 0x44, 0x61, 0x65, 0x69, 0x79, 0xF0, 0xB5, 0xFF, 0xFD, 0xF0, 0x04, 0xEF,
     0xF5, 0xA0, 0x07, 0x82, 0xC1, 0x07, 0xA3, 0x62, 0xE8, 0xCC, 0x42, 0x6D, 0x69, 0xF0, 0x17, 0xE9,
     0x10, 0x43, 0x61, 0x65, 0x74, 0xFF, 0xF9, 0xF0, 0x98, 0xF0, 0xB3, 0xA0, 0x07, 0xD2, 0x21, 0x6E,
@@ -427,19 +427,19 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x6E, 0x72, 0xF2, 0x70, 0xF2, 0x70, 0xC2, 0x00, 0xD1, 0x65, 0x74, 0xFF, 0xF7, 0xEB, 0xD3, 0xA0,
     0x07, 0xF2, 0xC2, 0x00, 0x61, 0x69, 0x74, 0xF1, 0x1E, 0xFF, 0xFD, 0x41, 0x69, 0xEF, 0x7E, 0xA0,
     0x08, 0x12, 0xA0, 0x0F, 0x02, 0x21, 0x79, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x74, 0xFD, 0x21, 0x65,
-    0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74,
-    0x76, 0x6D, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0x90, 0xF0, 0x43, 0xFF, 0x9D, 0xFF, 0xA4, 0xF1, 0x8B,
-    0xFF, 0xAD, 0xFF, 0xBA, 0xFF, 0xC6, 0xFE, 0x56, 0xFF, 0xD5, 0xFF, 0xE1, 0xFF, 0xEA, 0xFF, 0xEE,
-    0xFF, 0xFD, 0xA0, 0x05, 0x52, 0x42, 0x2E, 0x73, 0xF0, 0x0F, 0xEE, 0xD4, 0x41, 0x64, 0xFE, 0x3E,
+    0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73,
+    0x74, 0x76, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0x90, 0xF0, 0x43, 0xFF, 0x9D, 0xFF, 0xA4, 0xF1, 0x8B,
+    0xFF, 0xAD, 0xFF, 0xFD, 0xFF, 0xBA, 0xFF, 0xC6, 0xFE, 0x56, 0xFF, 0xD5, 0xFF, 0xE1, 0xFF, 0xEA,
+    0xFF, 0xEE, 0xA0, 0x05, 0x52, 0x42, 0x2E, 0x73, 0xF0, 0x0F, 0xEE, 0xD4, 0x41, 0x64, 0xFE, 0x3E,
     0x44, 0x2E, 0x64, 0x73, 0x61, 0xF0, 0x04, 0xF0, 0x04, 0xFF, 0xF5, 0xFF, 0xFC, 0xA0, 0x17, 0x63,
     0x21, 0x65, 0xFD, 0x46, 0x61, 0x65, 0x6F, 0x75, 0x79, 0x69, 0xF8, 0xE6, 0xFF, 0xED, 0xF7, 0x27,
     0xF8, 0xE6, 0xF7, 0x0D, 0xFF, 0xFD, 0xA0, 0x08, 0x33, 0x43, 0x61, 0x69, 0x6F, 0xEF, 0x38, 0xE7,
     0xC9, 0xF6, 0xB1, 0x41, 0x69, 0xF6, 0xB4, 0x42, 0x61, 0x69, 0xF2, 0xBB, 0xE7, 0xBB, 0x41, 0x64,
     0xE7, 0xCC, 0x41, 0x70, 0xE7, 0xB6, 0x41, 0x74, 0xF8, 0xB3, 0xA0, 0x17, 0x92, 0x21, 0x64, 0xFD,
     0x21, 0x72, 0xFD, 0x21, 0x6F, 0xFD, 0xD0, 0x03, 0xD1, 0x2E, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6D,
-    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x76, 0x78, 0x77, 0xEF, 0xAE, 0xF2, 0xF8, 0xF0, 0x6A, 0xF9,
+    0x6E, 0x6F, 0x70, 0x72, 0x73, 0x75, 0x76, 0x77, 0x78, 0xEF, 0xAE, 0xF2, 0xF8, 0xF0, 0x6A, 0xF9,
     0x08, 0xEF, 0x93, 0xFF, 0xD3, 0xFF, 0xDD, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xEC, 0xEF, 0x93, 0xEF,
-    0xAE, 0xFF, 0xF0, 0xEF, 0x0B, 0xEF, 0xAE, 0xFF, 0xFD, 0x41, 0x6F, 0xEB, 0xD2, 0x42, 0x67, 0x69,
+    0xAE, 0xFF, 0xF0, 0xEF, 0x0B, 0xFF, 0xFD, 0xEF, 0xAE, 0x41, 0x6F, 0xEB, 0xD2, 0x42, 0x67, 0x69,
     0xFF, 0xFC, 0xEE, 0x3C, 0xA0, 0x17, 0xB2, 0x21, 0x6C, 0xFD, 0xA1, 0x02, 0xE1, 0x61, 0xFD, 0xC2,
     0x00, 0x51, 0x61, 0x6E, 0xE8, 0x68, 0xFF, 0xFB, 0x41, 0x61, 0xF7, 0x0D, 0x21, 0x74, 0xFC, 0xA0,
     0x17, 0xD3, 0x21, 0x67, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6C, 0xFD, 0x44, 0x62, 0x6C, 0x66, 0x70,
@@ -682,9 +682,9 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x8F, 0xD8, 0x95, 0xFF, 0xFD, 0x42, 0x6E, 0x73, 0xDF, 0x86, 0xDF, 0x4F, 0x41, 0x65, 0xDC, 0xCF,
     0x45, 0x61, 0x64, 0x6C, 0x70, 0x74, 0xFF, 0xF5, 0xF2, 0x61, 0xD8, 0xA5, 0xFF, 0xFC, 0xE6, 0x9B,
     0xC1, 0x02, 0xE1, 0x61, 0xD8, 0x6A, 0x41, 0x73, 0xDB, 0x7A, 0x21, 0x72, 0xFC, 0x41, 0x68, 0xDC,
-    0xCA, 0x21, 0x63, 0xFC, 0x4E, 0x62, 0x63, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75,
-    0x7A, 0x69, 0x74, 0xFF, 0x81, 0xD8, 0x41, 0xFF, 0x85, 0xDF, 0x80, 0xFF, 0x92, 0xDF, 0xAD, 0xFF,
-    0xAB, 0xFF, 0xC7, 0xFF, 0xDC, 0xE3, 0x1A, 0xD8, 0xAE, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF, 0xFD, 0x42,
+    0xCA, 0x21, 0x63, 0xFC, 0x4E, 0x62, 0x63, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73,
+    0x74, 0x75, 0x7A, 0xFF, 0x81, 0xD8, 0x41, 0xFF, 0x85, 0xDF, 0x80, 0xFF, 0xF6, 0xFF, 0x92, 0xDF,
+    0xAD, 0xFF, 0xAB, 0xFF, 0xC7, 0xFF, 0xDC, 0xE3, 0x1A, 0xFF, 0xFD, 0xD8, 0xAE, 0xFF, 0xEC, 0x42,
     0x64, 0x72, 0xED, 0x82, 0xE0, 0x25, 0x42, 0x6E, 0x74, 0xDF, 0x7B, 0xDE, 0xE6, 0x21, 0x61, 0xF9,
     0xC1, 0x01, 0x41, 0x6F, 0xDE, 0xEF, 0x42, 0x69, 0x79, 0xEC, 0xFB, 0xD8, 0x02, 0x43, 0x69, 0x6C,
     0x6F, 0xF7, 0x7B, 0xFF, 0xF9, 0xDE, 0xCF, 0xC1, 0x00, 0x41, 0x74, 0xD8, 0x09, 0xA1, 0x02, 0x81,
@@ -774,10 +774,10 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x73, 0x74, 0xF0, 0xF9, 0xD2, 0xBC, 0xDA, 0xAD, 0x41, 0x61, 0xD2, 0xD7, 0x21, 0x72, 0xFC, 0xC2,
     0x02, 0x41, 0x65, 0x75, 0xD9, 0xBC, 0xFF, 0xFD, 0xA0, 0x0B, 0xC2, 0x42, 0x2E, 0x68, 0xE1, 0xC5,
     0xFF, 0xFD, 0xC1, 0x01, 0xF1, 0x73, 0xD9, 0x6A, 0xA0, 0x1A, 0x12, 0x21, 0x73, 0xFD, 0x21, 0x61,
-    0xFD, 0x21, 0x72, 0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6E, 0x6F,
-    0x73, 0x74, 0x75, 0x79, 0x66, 0xE1, 0xAC, 0xFF, 0x57, 0xFF, 0x65, 0xFF, 0x6F, 0xFF, 0x78, 0xFF,
-    0x8A, 0xFF, 0xB6, 0xD9, 0x55, 0xD9, 0x55, 0xE1, 0xAC, 0xFF, 0xC8, 0xFF, 0xDB, 0xFF, 0xE7, 0xFF,
-    0xEE, 0xD9, 0x55, 0xFF, 0xFD, 0x42, 0x65, 0x72, 0xD2, 0x4D, 0xDC, 0x58, 0x41, 0x72, 0xD5, 0x5F,
+    0xFD, 0x21, 0x72, 0xFD, 0x50, 0x2E, 0x61, 0x63, 0x64, 0x65, 0x66, 0x67, 0x69, 0x6B, 0x6C, 0x6E,
+    0x6F, 0x73, 0x74, 0x75, 0x79, 0xE1, 0xAC, 0xFF, 0x57, 0xFF, 0x65, 0xFF, 0x6F, 0xFF, 0x78, 0xFF,
+    0xFD, 0xFF, 0x8A, 0xFF, 0xB6, 0xD9, 0x55, 0xD9, 0x55, 0xE1, 0xAC, 0xFF, 0xC8, 0xFF, 0xDB, 0xFF,
+    0xE7, 0xFF, 0xEE, 0xD9, 0x55, 0x42, 0x65, 0x72, 0xD2, 0x4D, 0xDC, 0x58, 0x41, 0x72, 0xD5, 0x5F,
     0x43, 0x61, 0x65, 0x69, 0xD2, 0x5D, 0xFF, 0xFC, 0xD2, 0x5A, 0x43, 0x68, 0x69, 0x6F, 0xD9, 0x1A,
     0xD9, 0x12, 0xD9, 0xA7, 0xCA, 0x02, 0x41, 0x2E, 0x67, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74,
     0x75, 0xD9, 0x05, 0xFF, 0xE1, 0xDA, 0xA6, 0xD9, 0x9D, 0xFF, 0xEC, 0xDE, 0x3F, 0xD5, 0x13, 0xDA,
@@ -863,10 +863,10 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0xF2, 0x95, 0xD5, 0x25, 0xC1, 0x02, 0x71, 0x2E, 0xD5, 0xEC, 0xC3, 0x00, 0xD1, 0x63, 0x71, 0x73,
     0xD7, 0xAA, 0xD5, 0xE6, 0xFF, 0xFA, 0x43, 0x2E, 0x61, 0x73, 0xCD, 0x12, 0xCD, 0x12, 0xCD, 0x12,
     0x21, 0x72, 0xF6, 0x42, 0x61, 0x65, 0xD4, 0x54, 0xFF, 0xFD, 0xC1, 0x02, 0x71, 0x65, 0xD3, 0xCF,
-    0xA0, 0x1A, 0xF3, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x4C, 0x61, 0x62, 0x66,
-    0x67, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x79, 0x63, 0xFF, 0x67, 0xD6, 0xD2, 0xD1, 0xD7, 0xFF,
-    0x7D, 0xFF, 0x93, 0xFF, 0x9D, 0xFF, 0xAD, 0xFF, 0xB8, 0xFF, 0xCE, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF,
-    0xFD, 0xC1, 0x02, 0x41, 0x72, 0xD3, 0x9B, 0xC1, 0x01, 0x71, 0x72, 0xCE, 0x50, 0xC3, 0x08, 0x33,
+    0xA0, 0x1A, 0xF3, 0x21, 0x62, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x74, 0xFD, 0x4C, 0x61, 0x62, 0x63,
+    0x66, 0x67, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x76, 0x79, 0xFF, 0x67, 0xD6, 0xD2, 0xFF, 0xFD, 0xD1,
+    0xD7, 0xFF, 0x7D, 0xFF, 0x93, 0xFF, 0x9D, 0xFF, 0xAD, 0xFF, 0xB8, 0xFF, 0xCE, 0xFF, 0xE7, 0xFF,
+    0xEE, 0xC1, 0x02, 0x41, 0x72, 0xD3, 0x9B, 0xC1, 0x01, 0x71, 0x72, 0xCE, 0x50, 0xC3, 0x08, 0x33,
     0x61, 0x65, 0x6F, 0xFF, 0xFA, 0xD5, 0xB0, 0xCC, 0xCD, 0x45, 0x67, 0x6D, 0x72, 0x73, 0x74, 0xD4,
     0x18, 0xD6, 0xB4, 0xE3, 0x5A, 0xD4, 0x18, 0xD6, 0xB7, 0x46, 0x69, 0x6F, 0x73, 0x74, 0x75, 0x79,
     0xF9, 0xC3, 0xD6, 0xB1, 0xD3, 0x70, 0xE2, 0xE4, 0xD4, 0x90, 0xD3, 0xEE, 0x43, 0x61, 0x65, 0x69,
@@ -895,10 +895,10 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0xD6, 0x84, 0xF1, 0x74, 0x42, 0x69, 0x79, 0xD5, 0x11, 0xD3, 0xEC, 0x21, 0x68, 0xF9, 0x21, 0x70,
     0xFD, 0x44, 0x2E, 0x65, 0x6F, 0x74, 0xD3, 0xDF, 0xCB, 0x32, 0xFF, 0xFD, 0xCB, 0x17, 0x42, 0x6E,
     0x74, 0xCF, 0xF9, 0xDA, 0x32, 0x41, 0x2E, 0xCA, 0xFD, 0x42, 0x64, 0x72, 0xFF, 0xFC, 0xFD, 0x6A,
-    0x21, 0x65, 0xF9, 0x21, 0x64, 0xFD, 0x4F, 0x2E, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x6F, 0x70,
-    0x72, 0x73, 0x74, 0x75, 0x76, 0x61, 0xD2, 0xFE, 0xFF, 0x89, 0xD4, 0xD8, 0xD1, 0xC3, 0xFF, 0x98,
-    0xE4, 0xD0, 0xFF, 0xAD, 0xCF, 0xE1, 0xFF, 0xB4, 0xFF, 0xC4, 0xFF, 0xDB, 0xDB, 0x8F, 0xFF, 0xE8,
-    0xD1, 0xC3, 0xFF, 0xFD, 0x42, 0x61, 0x69, 0xD2, 0x13, 0xD1, 0x98, 0x42, 0x6E, 0x74, 0xD1, 0xC8,
+    0x21, 0x65, 0xF9, 0x21, 0x64, 0xFD, 0x4F, 0x2E, 0x61, 0x62, 0x63, 0x66, 0x67, 0x6D, 0x6E, 0x6F,
+    0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0xD2, 0xFE, 0xFF, 0xFD, 0xFF, 0x89, 0xD4, 0xD8, 0xD1, 0xC3,
+    0xFF, 0x98, 0xE4, 0xD0, 0xFF, 0xAD, 0xCF, 0xE1, 0xFF, 0xB4, 0xFF, 0xC4, 0xFF, 0xDB, 0xDB, 0x8F,
+    0xFF, 0xE8, 0xD1, 0xC3, 0x42, 0x61, 0x69, 0xD2, 0x13, 0xD1, 0x98, 0x42, 0x6E, 0x74, 0xD1, 0xC8,
     0xD2, 0x0C, 0xC5, 0x02, 0x41, 0x61, 0x68, 0x69, 0x6C, 0x72, 0xF6, 0x7E, 0xFF, 0xF2, 0xFF, 0xF9,
     0xD2, 0xA7, 0xD1, 0x8A, 0xC3, 0x08, 0x63, 0x63, 0x65, 0x69, 0xD2, 0x95, 0xD1, 0xD5, 0xE5, 0x60,
     0x41, 0x65, 0xCA, 0xBF, 0x42, 0x67, 0x6E, 0xD1, 0x70, 0xFF, 0xFC, 0xC3, 0x02, 0xB1, 0x6E, 0x72,
@@ -910,9 +910,9 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0xA2, 0x21, 0x2E, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x69, 0xFD, 0x44, 0x61, 0x69, 0x6E, 0x62, 0xD1,
     0x97, 0xD2, 0xF6, 0xFF, 0xED, 0xFF, 0xFD, 0xC1, 0x01, 0xE1, 0x72, 0xCA, 0x33, 0x42, 0x73, 0x74,
     0xCA, 0x15, 0xD0, 0x29, 0xA0, 0x1B, 0x82, 0x21, 0x72, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6B, 0xFD,
-    0x4C, 0x61, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6D, 0x6F, 0x70, 0x73, 0x74, 0x6E, 0xD0, 0xE4, 0xD9,
-    0x6D, 0xFF, 0xB9, 0xFF, 0xC0, 0xCA, 0x08, 0xD0, 0xE7, 0xFF, 0xDA, 0xFF, 0xE7, 0xD0, 0xD9, 0xFF,
-    0xED, 0xDF, 0x71, 0xFF, 0xFD, 0xA0, 0x0D, 0x92, 0x42, 0x6E, 0x74, 0xD0, 0xB4, 0xFF, 0xFD, 0x21,
+    0x4C, 0x61, 0x62, 0x63, 0x65, 0x66, 0x69, 0x6D, 0x6E, 0x6F, 0x70, 0x73, 0x74, 0xD0, 0xE4, 0xD9,
+    0x6D, 0xFF, 0xB9, 0xFF, 0xC0, 0xCA, 0x08, 0xD0, 0xE7, 0xFF, 0xDA, 0xFF, 0xFD, 0xFF, 0xE7, 0xD0,
+    0xD9, 0xFF, 0xED, 0xDF, 0x71, 0xA0, 0x0D, 0x92, 0x42, 0x6E, 0x74, 0xD0, 0xB4, 0xFF, 0xFD, 0x21,
     0x65, 0xF9, 0x41, 0x79, 0xD8, 0xB8, 0xC2, 0x05, 0x92, 0x65, 0x74, 0xD0, 0xA6, 0xFF, 0xFC, 0xA0,
     0x1B, 0xC3, 0x21, 0x69, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD, 0xC6, 0x03, 0xD1, 0x61, 0x62,
     0x6D, 0x6E, 0x73, 0x67, 0xD0, 0x8E, 0xD0, 0x8E, 0xD5, 0x13, 0xD6, 0x11, 0xFF, 0xEB, 0xFF, 0xFD,
@@ -969,9 +969,9 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0xFD, 0xC2, 0x00, 0xD1, 0x65, 0x70, 0xCE, 0xD6, 0xCD, 0x9A, 0xA0, 0x10, 0x12, 0x21, 0x74, 0xFD,
     0xA1, 0x00, 0xF1, 0x65, 0xFD, 0x21, 0x68, 0xFB, 0x41, 0x6E, 0xE9, 0xB7, 0xA1, 0x02, 0x71, 0x69,
     0xFC, 0x42, 0x66, 0x73, 0xCD, 0x3B, 0xFF, 0xFB, 0x41, 0x73, 0xD5, 0x8E, 0x21, 0x61, 0xFC, 0x21,
-    0x6C, 0xFD, 0xCE, 0x03, 0xD1, 0x63, 0x64, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74,
-    0x75, 0x76, 0x65, 0xFF, 0x67, 0xFF, 0x6A, 0xD0, 0x5E, 0xFF, 0x73, 0xCD, 0x27, 0xFF, 0x80, 0xCF,
-    0xAA, 0xFF, 0xAA, 0xFF, 0xC6, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xEF, 0xD0, 0x5B, 0xFF, 0xFD, 0xC1,
+    0x6C, 0xFD, 0xCE, 0x03, 0xD1, 0x63, 0x64, 0x65, 0x67, 0x69, 0x6B, 0x6C, 0x6D, 0x6E, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0xFF, 0x67, 0xFF, 0x6A, 0xFF, 0xFD, 0xD0, 0x5E, 0xFF, 0x73, 0xCD, 0x27, 0xFF,
+    0x80, 0xCF, 0xAA, 0xFF, 0xAA, 0xFF, 0xC6, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0xEF, 0xD0, 0x5B, 0xC1,
     0x00, 0xA1, 0x62, 0xC6, 0x41, 0x42, 0x61, 0x69, 0xFF, 0xFA, 0xC6, 0x44, 0x21, 0x72, 0xF9, 0x41,
     0x73, 0xCB, 0x62, 0x21, 0x61, 0xFC, 0xC5, 0x02, 0x11, 0x61, 0x65, 0x6E, 0x72, 0x73, 0xC6, 0x12,
     0xD1, 0x10, 0xCF, 0xC0, 0xCC, 0xE6, 0xCC, 0xEE, 0x41, 0x74, 0xC7, 0xD2, 0x21, 0x69, 0xFC, 0x44,
@@ -1161,10 +1161,10 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x69, 0x6E, 0x6F, 0xFB, 0xA9, 0xFF, 0xF9, 0xC1, 0xCB, 0xC8, 0x67, 0xC2, 0x7C, 0x41, 0x61, 0xC1,
     0xBB, 0xA0, 0x12, 0x52, 0x21, 0x63, 0xFD, 0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD,
     0x59, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
-    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x79, 0x78, 0xFA, 0x2B, 0xFA, 0x56, 0xFA, 0xA1,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0xFA, 0x2B, 0xFA, 0x56, 0xFA, 0xA1,
     0xFA, 0xE9, 0xFB, 0x03, 0xFB, 0x1F, 0xFB, 0x60, 0xFB, 0x79, 0xFB, 0x9F, 0xC1, 0x3C, 0xFB, 0xC1,
     0xFC, 0x53, 0xFC, 0xDD, 0xFD, 0x69, 0xFD, 0x9B, 0xFD, 0xE0, 0xC2, 0xDA, 0xFE, 0x8D, 0xFF, 0x01,
-    0xFF, 0x69, 0xFF, 0x92, 0xFF, 0xCF, 0xFF, 0xDD, 0xFF, 0xED, 0xFF, 0xFD, 0x43, 0x61, 0x65, 0x74,
+    0xFF, 0x69, 0xFF, 0x92, 0xFF, 0xCF, 0xFF, 0xDD, 0xFF, 0xFD, 0xFF, 0xED, 0x43, 0x61, 0x65, 0x74,
     0xC1, 0x85, 0xC1, 0x85, 0xBA, 0x1C, 0x42, 0x6E, 0x74, 0xC2, 0xDA, 0xC1, 0x61, 0x21, 0x61, 0xF9,
     0xC1, 0x01, 0x41, 0x6E, 0xBA, 0x02, 0x41, 0x74, 0xBD, 0x2D, 0x21, 0x61, 0xFC, 0xA1, 0x01, 0x41,
     0x6D, 0xFD, 0x44, 0x61, 0x65, 0x74, 0x79, 0xB9, 0xF6, 0xD0, 0xDA, 0xBD, 0x09, 0xC1, 0x09, 0xC1,
@@ -1249,10 +1249,10 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x42, 0x65, 0x68, 0xB7, 0xA8, 0xC2, 0xBB, 0xC1, 0x00, 0x41, 0x66, 0xB5, 0x19, 0x43, 0x63, 0x65,
     0x69, 0xB5, 0x13, 0xFF, 0xFA, 0xD0, 0xE4, 0x41, 0x6E, 0xBA, 0x0F, 0x21, 0x6F, 0xFC, 0x21, 0x69,
     0xFD, 0x42, 0x61, 0x65, 0xE3, 0x2A, 0xCB, 0xCB, 0x41, 0x69, 0xC0, 0x36, 0x41, 0x67, 0xEE, 0x20,
-    0x42, 0x67, 0x6F, 0xE9, 0x8B, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x50, 0x62, 0x63, 0x66, 0x69, 0x6C,
-    0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0x64, 0x6F, 0xFF, 0x79, 0xFF, 0x89, 0xFF,
-    0x90, 0xBB, 0xFF, 0xBE, 0xD6, 0xFF, 0xAC, 0xFF, 0xB6, 0xFF, 0xC6, 0xFF, 0xD3, 0xBB, 0xFF, 0xFF,
-    0xE4, 0xB6, 0x37, 0xFF, 0xE7, 0xFF, 0xEE, 0xFF, 0xFD, 0xF1, 0x85, 0x42, 0x62, 0x67, 0xBC, 0x8E,
+    0x42, 0x67, 0x6F, 0xE9, 0x8B, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x50, 0x62, 0x63, 0x64, 0x66, 0x69,
+    0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x7A, 0xFF, 0x79, 0xFF, 0x89, 0xFF,
+    0xFD, 0xFF, 0x90, 0xBB, 0xFF, 0xBE, 0xD6, 0xFF, 0xAC, 0xFF, 0xB6, 0xF1, 0x85, 0xFF, 0xC6, 0xFF,
+    0xD3, 0xBB, 0xFF, 0xFF, 0xE4, 0xB6, 0x37, 0xFF, 0xE7, 0xFF, 0xEE, 0x42, 0x62, 0x67, 0xBC, 0x8E,
     0xBC, 0x8E, 0xA0, 0x21, 0x92, 0x42, 0x2E, 0x65, 0xBB, 0x6F, 0xFF, 0xFD, 0xC2, 0x02, 0x11, 0x65,
     0x67, 0xBB, 0x60, 0xFF, 0xF9, 0xC2, 0x00, 0xD1, 0x66, 0x6E, 0xB4, 0x83, 0xFF, 0xF7, 0xC3, 0x02,
     0xB1, 0x61, 0x69, 0x6F, 0xFF, 0xDD, 0xFF, 0xF7, 0xBB, 0xE3, 0xC1, 0x02, 0x11, 0x6E, 0xB4, 0x68,
@@ -1434,9 +1434,9 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x79, 0xB1, 0x6C, 0xFF, 0xF9, 0xB1, 0x6C, 0x42, 0x64, 0x62, 0xB1, 0x62, 0xAF, 0x58, 0xC3, 0x02,
     0x31, 0x61, 0x69, 0x79, 0xFF, 0xEF, 0xFF, 0xF9, 0xB0, 0x3B, 0x41, 0x69, 0xD1, 0x0C, 0xA1, 0x02,
     0x11, 0x6C, 0xFC, 0x41, 0x63, 0xB8, 0x37, 0xA0, 0x24, 0x63, 0x21, 0x64, 0xFD, 0x21, 0x69, 0xFD,
-    0x21, 0x70, 0xFD, 0x4D, 0x2E, 0x61, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x77, 0x79, 0x62, 0x73,
-    0x75, 0xB8, 0x6D, 0xFF, 0x51, 0xFF, 0x74, 0xC2, 0x7A, 0xFF, 0x84, 0xFF, 0x9C, 0xFF, 0xAD, 0xFF,
-    0xDB, 0xBB, 0xB3, 0xFF, 0xEB, 0xB0, 0x21, 0xFF, 0xF0, 0xFF, 0xFD, 0x42, 0x73, 0x74, 0xAF, 0xF9,
+    0x21, 0x70, 0xFD, 0x4D, 0x2E, 0x61, 0x62, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x77,
+    0x79, 0xB8, 0x6D, 0xFF, 0x51, 0xB0, 0x21, 0xFF, 0x74, 0xC2, 0x7A, 0xFF, 0x84, 0xFF, 0x9C, 0xFF,
+    0xAD, 0xFF, 0xDB, 0xFF, 0xF0, 0xFF, 0xFD, 0xBB, 0xB3, 0xFF, 0xEB, 0x42, 0x73, 0x74, 0xAF, 0xF9,
     0xAA, 0xAC, 0xC1, 0x02, 0x81, 0x69, 0xA9, 0x28, 0xA0, 0x24, 0x93, 0x21, 0x65, 0xFD, 0x21, 0x72,
     0xFD, 0x21, 0x65, 0xFD, 0xC9, 0x03, 0xD1, 0x61, 0x62, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x70,
     0xDD, 0x59, 0xC2, 0xE6, 0xFB, 0x71, 0xFF, 0xE7, 0xB0, 0xF5, 0xFF, 0xEE, 0xB3, 0x09, 0xB3, 0x09,
@@ -1457,10 +1457,10 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x43, 0x65, 0x6C, 0x61, 0xB6, 0xEA, 0xAE, 0xE4, 0xFF, 0xFD, 0xA0, 0x25, 0x42, 0x21, 0x68, 0xFD,
     0x45, 0x61, 0x63, 0x65, 0x69, 0x72, 0xA7, 0xF8, 0xAE, 0xC9, 0xAE, 0xC9, 0xB7, 0x3D, 0xFF, 0xFD,
     0x42, 0x65, 0x79, 0xA7, 0xE8, 0xAE, 0xC4, 0x42, 0x69, 0x75, 0xB0, 0x91, 0xB1, 0xF3, 0x41, 0x6E,
-    0xB4, 0x47, 0x21, 0x6F, 0xFC, 0xD2, 0x03, 0xD1, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x69, 0x6C, 0x6D,
-    0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x67, 0xAF, 0xDF, 0xFF, 0x82, 0xB0, 0x59,
-    0xB2, 0x5F, 0xB9, 0x36, 0xFF, 0x89, 0xFF, 0x97, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xCB, 0xFF, 0xDB,
-    0xFF, 0xEB, 0xFF, 0xF2, 0xA8, 0x3D, 0xA7, 0xD3, 0xB6, 0xFB, 0xFF, 0x93, 0xFF, 0xFD, 0x41, 0x72,
+    0xB4, 0x47, 0x21, 0x6F, 0xFC, 0xD2, 0x03, 0xD1, 0x2E, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6C,
+    0x6D, 0x6E, 0x70, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0xAF, 0xDF, 0xFF, 0x82, 0xB0, 0x59,
+    0xB2, 0x5F, 0xB9, 0x36, 0xFF, 0xFD, 0xFF, 0x89, 0xFF, 0x97, 0xFF, 0xB0, 0xFF, 0xBB, 0xFF, 0xCB,
+    0xFF, 0xDB, 0xFF, 0xEB, 0xFF, 0xF2, 0xA8, 0x3D, 0xA7, 0xD3, 0xB6, 0xFB, 0xFF, 0x93, 0x41, 0x72,
     0xDE, 0x72, 0x21, 0x65, 0xFC, 0xC3, 0x01, 0x41, 0x65, 0x63, 0x69, 0xA7, 0xAE, 0xA7, 0x9F, 0xFF,
     0xFD, 0xC2, 0x01, 0x91, 0x68, 0x72, 0xFF, 0xF4, 0xAF, 0xF9, 0x41, 0x68, 0xF9, 0xB6, 0x43, 0x64,
     0x74, 0x63, 0xA8, 0x3B, 0xAE, 0x4B, 0xFF, 0xFC, 0x42, 0x65, 0x74, 0xA7, 0x6A, 0xB0, 0x38, 0xC1,
@@ -1505,9 +1505,9 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0x72, 0xAC, 0x1F, 0x43, 0x61, 0x6F, 0x79, 0xFF, 0xF9, 0xAB, 0xD6, 0xAB, 0xD6, 0x42, 0x65, 0x7A,
     0xAC, 0x0E, 0xA5, 0x13, 0x42, 0x61, 0x69, 0xAE, 0xF9, 0xFF, 0xF9, 0x42, 0x72, 0x74, 0xAD, 0xB5,
     0xAB, 0xBE, 0x41, 0x61, 0xB4, 0x4B, 0x41, 0x79, 0xA5, 0x9D, 0x21, 0x67, 0xFC, 0x21, 0x6F, 0xFD,
-    0xCE, 0x03, 0xD1, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6D, 0x6E, 0x72, 0x73, 0x75, 0x77, 0x6C,
-    0x74, 0xAB, 0xEB, 0xFF, 0xBA, 0xCF, 0x84, 0xB4, 0x00, 0xFF, 0xBE, 0xAD, 0xC9, 0xFF, 0xC2, 0xFF,
-    0xD3, 0xFF, 0xE4, 0xA6, 0x76, 0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xFD, 0xB4, 0xE1, 0xC1, 0x01, 0x81,
+    0xCE, 0x03, 0xD1, 0x62, 0x63, 0x64, 0x66, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x72, 0x73, 0x74, 0x75,
+    0x77, 0xAB, 0xEB, 0xFF, 0xBA, 0xCF, 0x84, 0xB4, 0x00, 0xFF, 0xBE, 0xAD, 0xC9, 0xFF, 0xFD, 0xFF,
+    0xC2, 0xFF, 0xD3, 0xFF, 0xE4, 0xA6, 0x76, 0xB4, 0xE1, 0xFF, 0xEB, 0xFF, 0xF2, 0xC1, 0x01, 0x81,
     0x74, 0xA4, 0xA5, 0x43, 0x68, 0x69, 0x74, 0xA4, 0xBD, 0xFF, 0xFA, 0xA5, 0x3C, 0xA0, 0x25, 0xD2,
     0x21, 0x62, 0xFD, 0xA1, 0x00, 0x61, 0x61, 0xFD, 0x21, 0x73, 0xFB, 0x43, 0x6E, 0x73, 0x72, 0xA4,
     0xA5, 0xD3, 0xFE, 0xFF, 0xFD, 0x21, 0x65, 0xF6, 0xA0, 0x25, 0xB2, 0x21, 0x72, 0xFD, 0x21, 0x6F,
@@ -1643,10 +1643,10 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0xFD, 0x61, 0x6F, 0x7F, 0x9D, 0xF6, 0x21, 0x72, 0xFB, 0x21, 0x61, 0xFD, 0xA1, 0x00, 0x51, 0x70,
     0xFD, 0x42, 0x61, 0x65, 0xA1, 0xA0, 0xCE, 0xC6, 0xA1, 0x00, 0x51, 0x74, 0xF9, 0x22, 0x61, 0x69,
     0xEF, 0xFB, 0x44, 0x68, 0x6C, 0x70, 0x74, 0xA3, 0x95, 0xA3, 0xAF, 0xA3, 0xEE, 0xAE, 0x8D, 0x6F,
-    0x61, 0x62, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x79, 0x63, 0x7F,
-    0xFF, 0x21, 0x7F, 0xA4, 0xAB, 0x7F, 0xFF, 0x62, 0x7F, 0x9C, 0x9F, 0x7F, 0xFF, 0x92, 0x7F, 0xA4,
-    0x2A, 0x7F, 0xFF, 0xB1, 0x7F, 0xDD, 0x27, 0x7F, 0xFF, 0xC3, 0x7F, 0xA3, 0x0D, 0x7F, 0xFF, 0xEE,
-    0x7F, 0xFF, 0xF3, 0x7F, 0xA3, 0x0A, 0x7F, 0xA3, 0xA2, 0x7F, 0xA3, 0x88, 0xE5, 0x02, 0xB1, 0x63,
+    0x61, 0x62, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x79, 0x7F,
+    0xFF, 0x21, 0x7F, 0xA4, 0xAB, 0x7F, 0xA3, 0x88, 0x7F, 0xFF, 0x62, 0x7F, 0x9C, 0x9F, 0x7F, 0xFF,
+    0x92, 0x7F, 0xA4, 0x2A, 0x7F, 0xFF, 0xB1, 0x7F, 0xDD, 0x27, 0x7F, 0xFF, 0xC3, 0x7F, 0xA3, 0x0D,
+    0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF3, 0x7F, 0xA3, 0x0A, 0x7F, 0xA3, 0xA2, 0xE5, 0x02, 0xB1, 0x63,
     0x67, 0x6D, 0x70, 0x73, 0x7F, 0xA0, 0x19, 0x7F, 0xDC, 0xEA, 0x7F, 0x9C, 0x0E, 0x7F, 0xA3, 0xED,
     0x7F, 0x9C, 0x14, 0xA0, 0x06, 0x72, 0x41, 0x75, 0xB3, 0x54, 0x62, 0x69, 0x6F, 0x7F, 0x9B, 0xDE,
     0x7F, 0xA2, 0xBA, 0xC3, 0x02, 0xB1, 0x63, 0x64, 0x72, 0xFF, 0xF3, 0xA3, 0x06, 0xFF, 0xF7, 0xE1,
@@ -1693,8 +1693,156 @@ alignas(4) constexpr uint8_t en_trie_data[] = {
     0xDD, 0xF6, 0x7C, 0xFA, 0x00, 0xFC, 0x31, 0xFD, 0x52, 0xFE, 0x1F, 0xFF, 0x55, 0xFF, 0xDB,
 };
 
+// Dense lookup tables for the root and depth-1 transitions; nodes with at least
+// 12 transitions have their labels sorted.
+constexpr uint8_t en_root_slots[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint8_t en_byte_classes[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint32_t en_depth1_targets[] = {
+    0x00000903u, 0x0000105Fu, 0x00001383u, 0x000017E4u, 0x00001BF5u, 0x00002479u, 0x000026A7u, 0x0000297Eu,
+    0x00002C58u, 0x0000328Du, 0x0000332Au, 0x000033FBu, 0x000038D0u, 0x00003CEBu, 0x000041E1u, 0x00004810u,
+    0x00004C88u, 0x00004D12u, 0x00005378u, 0x000059CAu, 0x00005F69u, 0x000062EDu, 0x0000651Eu, 0x0000663Fu,
+    0x0000670Cu, 0x00006842u, 0x000068C8u,
+};
+
+constexpr uint32_t en_depth2_targets[] = {
+    0x000002E6u, 0x00000343u, 0x000003A5u, 0x000003F5u, 0x0000046Eu, 0x000004A1u, 0x000004D5u, 0x00000535u,
+    0x00000577u, 0x00000587u, 0x000008FEu, 0x000005D4u, 0x00000656u, 0x00000688u, 0x000006BEu, 0x0000070Eu,
+    0xFFFFFFFFu, 0x00000779u, 0x000007EAu, 0x00000868u, 0x000008ABu, 0x000008CFu, 0x000008E1u, 0xFFFFFFFFu,
+    0x000002B5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000991u, 0x000009EBu, 0x00000A3Au, 0x00000A53u, 0x00000A64u,
+    0x00000A9Du, 0x00000AB6u, 0x00000AD8u, 0x00000AEAu, 0x00000AF1u, 0x00000B50u, 0x00000BBCu, 0x00000CD9u,
+    0x00000949u, 0x00000D55u, 0x00000D6Eu, 0x00000E3Eu, 0x00000EA7u, 0x00000F96u, 0x00000FDDu, 0x00001022u,
+    0x00001033u, 0x00001047u, 0x0000104Au, 0x00001058u, 0x000010F7u, 0x00001123u, 0xFFFFFFFFu, 0x0000112Au,
+    0x0000117Bu, 0x000011A0u, 0xFFFFFFFFu, 0x000011A3u, 0x00001218u, 0x00000AEAu, 0x000009E1u, 0x00001264u,
+    0x0000112Au, 0x00001271u, 0x000012C7u, 0x00000949u, 0xFFFFFFFFu, 0x000012F8u, 0x000012FFu, 0x00001305u,
+    0x00001360u, 0x00000AEAu, 0x00001379u, 0xFFFFFFFFu, 0x0000137Cu, 0xFFFFFFFFu, 0x00001440u, 0xFFFFFFFFu,
+    0x00001475u, 0xFFFFFFFFu, 0x000014C7u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000154Eu, 0x000015CBu, 0xFFFFFFFFu,
+    0x000015F8u, 0x00001622u, 0xFFFFFFFFu, 0x0000094Cu, 0x0000168Fu, 0xFFFFFFFFu, 0x00000AEAu, 0x0000171Bu,
+    0x0000172Bu, 0x00001756u, 0x000017C2u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000017E1u, 0x000002B5u,
+    0x00001849u, 0x00000AEAu, 0x0000094Cu, 0x0000187Au, 0x00001977u, 0x0000112Au, 0x000019B4u, 0x000019C1u,
+    0x00001A41u, 0x00000AEAu, 0x00001A72u, 0x00001A93u, 0x00000AEAu, 0x00001AA6u, 0x00001AD6u, 0x00000AEAu,
+    0xFFFFFFFFu, 0x00001B65u, 0x00001B7Au, 0x00001B8Au, 0x00001BC7u, 0x00000AEAu, 0x00000AEAu, 0xFFFFFFFFu,
+    0x00001BECu, 0xFFFFFFFFu, 0x00001CB6u, 0x00001CEAu, 0x00001D70u, 0x00001DCEu, 0x00001DF7u, 0x00001E4Fu,
+    0x00001E7Cu, 0x00001E92u, 0x00001EB2u, 0x00001ED3u, 0x00001EDCu, 0x00001F82u, 0x00001FF7u, 0x00002084u,
+    0x000020CBu, 0x00002133u, 0x0000215Fu, 0x00002238u, 0x00002330u, 0x000023AEu, 0x000023E3u, 0x0000243Au,
+    0x0000245Eu, 0x0000246Bu, 0x0000246Fu, 0xFFFFFFFFu, 0x000024EEu, 0x00001379u, 0xFFFFFFFFu, 0x00000949u,
+    0x00002539u, 0x00002566u, 0xFFFFFFFFu, 0x00000949u, 0x000025E5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00002621u,
+    0x00000949u, 0x00000949u, 0x00002655u, 0x00001379u, 0xFFFFFFFFu, 0x0000266Eu, 0x000011BAu, 0x0000267Bu,
+    0x0000268Fu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000017E1u, 0xFFFFFFFFu, 0x0000270Du, 0x000009C7u,
+    0xFFFFFFFFu, 0x000009E1u, 0x00002774u, 0xFFFFFFFFu, 0x00002793u, 0x000027AEu, 0x000027EFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00002849u, 0x00002854u, 0x00002898u, 0x000028C9u, 0x000009C7u, 0xFFFFFFFFu, 0x0000292Du,
+    0x0000293Fu, 0x00002945u, 0x0000295Fu, 0xFFFFFFFFu, 0x000009C7u, 0xFFFFFFFFu, 0x00002975u, 0xFFFFFFFFu,
+    0x00002A34u, 0x00000AEAu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00002ABBu, 0x00000AEAu, 0xFFFFFFFFu, 0x00000AEAu,
+    0x00002B28u, 0xFFFFFFFFu, 0x00000949u, 0x00002B53u, 0x00002B5Cu, 0x00002B69u, 0x00002BD0u, 0x00001379u,
+    0xFFFFFFFFu, 0x00002BECu, 0x00002BF5u, 0x00002C0Du, 0x00002C24u, 0xFFFFFFFFu, 0x00002C38u, 0xFFFFFFFFu,
+    0x00002C51u, 0xFFFFFFFFu, 0x00002CB6u, 0x00002CF4u, 0x00002D61u, 0x00002DBDu, 0x00002DF6u, 0x00002E2Au,
+    0x00002E7Du, 0x000009C7u, 0x00002E9Bu, 0x00002E9Eu, 0x00000949u, 0x00002EDAu, 0x00002F35u, 0x00002FF4u,
+    0x00003044u, 0x00003079u, 0x0000309Fu, 0x000030E7u, 0x00003173u, 0x0000322Eu, 0x00000AEAu, 0x00003273u,
+    0x00001379u, 0x00000C80u, 0x00000949u, 0x00003283u, 0x000032F3u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00003313u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000331Fu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00003327u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00003333u, 0x00000AEAu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000335Bu, 0x000009C7u, 0xFFFFFFFFu, 0x000009E1u, 0x000033A1u, 0xFFFFFFFFu,
+    0x000009E1u, 0x000033BDu, 0x00000AEAu, 0x000033C6u, 0x000033D7u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000033E4u,
+    0x000033ECu, 0x0000094Cu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AEAu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x0000347Eu, 0x000034A0u, 0x000034B6u, 0x000034DAu, 0x0000358Cu, 0x000035B1u, 0x000035BDu, 0x000011BAu,
+    0x00003654u, 0x00000949u, 0x0000368Eu, 0x000036D1u, 0x000036F7u, 0x00003703u, 0x00003786u, 0x000037C2u,
+    0xFFFFFFFFu, 0x0000112Au, 0x000037D4u, 0x00003814u, 0x00003870u, 0x0000389Fu, 0x000018BAu, 0xFFFFFFFFu,
+    0x000038BBu, 0xFFFFFFFFu, 0x000039ADu, 0x000039E1u, 0x00001379u, 0xFFFFFFFFu, 0x00003A87u, 0x0000112Au,
+    0xFFFFFFFFu, 0x000011A0u, 0x00003B3Du, 0xFFFFFFFFu, 0x00000949u, 0x0000112Au, 0x00003B66u, 0x00003B6Fu,
+    0x00003C22u, 0x00003C8Cu, 0xFFFFFFFFu, 0x000011A3u, 0x00003CB2u, 0x00000949u, 0x00003CD6u, 0xFFFFFFFFu,
+    0x00000949u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00003D95u, 0x00001AA6u, 0x00003DE9u, 0x00003E2Eu,
+    0x00003EB6u, 0x00003EF7u, 0x00003F40u, 0x00003F62u, 0x00003FB5u, 0x00000AEAu, 0x00003FE5u, 0x00003FF4u,
+    0x00004000u, 0x0000400Cu, 0x000040D5u, 0x0000410Au, 0x00000AEAu, 0x00004113u, 0x0000413Du, 0x0000418Cu,
+    0x000041B8u, 0x000019C1u, 0x00001C3Bu, 0xFFFFFFFFu, 0x000041D4u, 0x000041DBu, 0x0000423Bu, 0x00004266u,
+    0x000042B1u, 0x000042F9u, 0x00004313u, 0x0000432Fu, 0x00004370u, 0x00004389u, 0x000043AFu, 0x0000094Cu,
+    0x000043D1u, 0x00004463u, 0x000044EDu, 0x00004579u, 0x000045ABu, 0x000045F0u, 0x00000AEAu, 0x0000469Du,
+    0x00004711u, 0x00004779u, 0x000047A2u, 0x000047DFu, 0x000047EDu, 0x0000480Du, 0x000047FDu, 0xFFFFFFFFu,
+    0x000048E9u, 0x0000112Au, 0xFFFFFFFFu, 0x000009E1u, 0x0000497Cu, 0x00000949u, 0x00000949u, 0x000049E9u,
+    0x00004A57u, 0xFFFFFFFFu, 0x00004A73u, 0x00004AA3u, 0x0000112Au, 0x000011BAu, 0x00004B03u, 0x00004B41u,
+    0xFFFFFFFFu, 0x00004BE7u, 0x00004C0Bu, 0x00004C30u, 0x00004C6Cu, 0xFFFFFFFFu, 0x000009C7u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00004D09u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00004DAAu, 0x00004DFEu, 0x00004E22u, 0x00004E43u,
+    0x00004F3Cu, 0x00004F73u, 0x00004F96u, 0x00004FA8u, 0x00005071u, 0x000009C7u, 0x000050B7u, 0x000050E4u,
+    0x0000510Cu, 0x0000513Eu, 0x000051DAu, 0x00005221u, 0xFFFFFFFFu, 0x0000524Eu, 0x00005292u, 0x000052F9u,
+    0x00005320u, 0x00005359u, 0x00000AEAu, 0xFFFFFFFFu, 0x00005367u, 0x00005375u, 0x0000540Fu, 0x00001379u,
+    0x000054C0u, 0x00001379u, 0x00005585u, 0x000011A3u, 0x000011BAu, 0x000055E3u, 0x00005645u, 0xFFFFFFFFu,
+    0x00005684u, 0x000056A3u, 0x000056D0u, 0x00001C3Bu, 0x0000572Cu, 0x000057BDu, 0x000057E0u, 0x00000AEAu,
+    0x0000583Bu, 0x00005933u, 0x00005974u, 0x00000949u, 0x0000599Bu, 0xFFFFFFFFu, 0x000059B8u, 0xFFFFFFFFu,
+    0x00005AA5u, 0x000018BAu, 0x00005AF1u, 0x0000112Au, 0x00005BABu, 0x000018BAu, 0x0000112Au, 0x00005C5Au,
+    0x00005CF5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00005D45u, 0x00005D54u, 0x00003703u, 0x00005DA0u, 0x0000112Au,
+    0xFFFFFFFFu, 0x00005EB1u, 0x00005EC7u, 0x00005EE2u, 0x00005F1Cu, 0x00000949u, 0x00005F40u, 0xFFFFFFFFu,
+    0x00005F5Du, 0x00001BB5u, 0x00005FD4u, 0x00006006u, 0x00006014u, 0x0000604Eu, 0x00006073u, 0x0000607Au,
+    0x00006085u, 0xFFFFFFFFu, 0x0000609Cu, 0x0000094Cu, 0x00000949u, 0x000060F6u, 0x0000612Fu, 0x00006168u,
+    0x00006181u, 0x000061ABu, 0xFFFFFFFFu, 0x0000620Eu, 0x00006268u, 0x000062D4u, 0x000062E7u, 0x000019C1u,
+    0xFFFFFFFFu, 0x00001543u, 0xFFFFFFFFu, 0x00000A20u, 0x0000636Eu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00006408u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000649Bu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00006508u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000A81u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000A69u, 0xFFFFFFFFu, 0x00006560u, 0x00000AEAu,
+    0x000009C7u, 0xFFFFFFFFu, 0x000065A1u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000002DEu, 0x000065D1u, 0xFFFFFFFFu,
+    0x00000A69u, 0x000065F0u, 0xFFFFFFFFu, 0x00004366u, 0x00006602u, 0x0000094Cu, 0xFFFFFFFFu, 0x0000662Du,
+    0x00006632u, 0x00000949u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000009E1u, 0xFFFFFFFFu,
+    0x0000667Cu, 0xFFFFFFFFu, 0x00006693u, 0xFFFFFFFFu, 0x000066A3u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000066B6u,
+    0x000066C8u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00002111u, 0x000066ECu,
+    0x00006707u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000066F3u, 0x000066F9u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000009E1u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000672Eu, 0x00000AEAu, 0x0000674Cu, 0x00000AEAu, 0x0000676Du, 0xFFFFFFFFu,
+    0x00000E18u, 0x000011A3u, 0x00000AEAu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000677Au, 0x0000679Bu, 0x000067A5u,
+    0x000067BCu, 0x000067E6u, 0xFFFFFFFFu, 0x000067F6u, 0x0000681Au, 0x0000683Bu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000AEAu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00006876u, 0x00000949u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00006887u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000689Eu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000B40u,
+    0x00000949u, 0xFFFFFFFFu, 0x000068B3u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000002B5u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000068BFu,
+};
+
+constexpr SerializedTrieAcceleration en_acceleration = {
+    en_root_slots,
+    en_byte_classes,
+    en_depth1_targets,
+    en_depth2_targets,
+    26u,
+    12u,
+};
+
 constexpr SerializedHyphenationPatterns en_patterns = {
     0x68EDu,
     en_trie_data,
     sizeof(en_trie_data),
+    &en_acceleration,
 };
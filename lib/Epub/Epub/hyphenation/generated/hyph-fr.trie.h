@@ -170,11 +170,11 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0x61, 0xC3, 0x69, 0x6F, 0x72, 0x75, 0x79, 0xFF, 0xC3, 0xFF, 0xD7, 0xFF, 0xDA, 0xFF, 0xE1, 0xFF,
     0xF9, 0xF6, 0x99, 0xF6, 0x99, 0xC5, 0x02, 0x52, 0x63, 0x70, 0x71, 0x73, 0x74, 0xFF, 0x6B, 0xFF,
     0x91, 0xFF, 0x9E, 0xFF, 0xA1, 0xFF, 0xE8, 0x21, 0x73, 0xEE, 0x42, 0xC3, 0x65, 0xFF, 0x41, 0xFF,
-    0xFD, 0x41, 0x74, 0xF7, 0x02, 0x21, 0x61, 0xFC, 0x53, 0x61, 0xC3, 0x62, 0x63, 0x64, 0x65, 0x69,
-    0x6D, 0x70, 0x73, 0x6F, 0x6B, 0x74, 0x67, 0x6E, 0x72, 0x6C, 0x75, 0x79, 0xF8, 0xB1, 0xF8, 0xE6,
-    0xF9, 0x32, 0xF9, 0xCA, 0xFB, 0x03, 0xF7, 0x50, 0xFB, 0x2C, 0xFC, 0x27, 0xFD, 0x92, 0xFE, 0x6E,
-    0xFE, 0x87, 0xFE, 0x93, 0xFE, 0xAD, 0xFE, 0xCA, 0xFE, 0xD7, 0xFF, 0xF2, 0xFF, 0xFD, 0xF8, 0x85,
-    0xF8, 0x85, 0xA0, 0x00, 0x81, 0x41, 0xAE, 0xFE, 0x87, 0xA0, 0x02, 0x31, 0x21, 0x2E, 0xFD, 0x21,
+    0xFD, 0x41, 0x74, 0xF7, 0x02, 0x21, 0x61, 0xFC, 0x53, 0x61, 0x62, 0x63, 0x64, 0x65, 0x67, 0x69,
+    0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x72, 0x73, 0x74, 0x75, 0x79, 0xC3, 0xF8, 0xB1, 0xF9, 0x32,
+    0xF9, 0xCA, 0xFB, 0x03, 0xF7, 0x50, 0xFE, 0xCA, 0xFB, 0x2C, 0xFE, 0x93, 0xFF, 0xFD, 0xFC, 0x27,
+    0xFE, 0xD7, 0xFE, 0x87, 0xFD, 0x92, 0xFF, 0xF2, 0xFE, 0x6E, 0xFE, 0xAD, 0xF8, 0x85, 0xF8, 0x85,
+    0xF8, 0xE6, 0xA0, 0x00, 0x81, 0x41, 0xAE, 0xFE, 0x87, 0xA0, 0x02, 0x31, 0x21, 0x2E, 0xFD, 0x21,
     0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x42, 0x74, 0x65, 0xF8, 0x91, 0xFF, 0xFD, 0x23, 0x68, 0xC3, 0x73,
     0xE6, 0xE9, 0xF9, 0x21, 0x68, 0xDF, 0xA0, 0x00, 0xA2, 0x21, 0x65, 0xFD, 0x21, 0x72, 0xFD, 0x21,
     0x64, 0xFD, 0x21, 0xA8, 0xFD, 0xA0, 0x00, 0xE1, 0x21, 0x6C, 0xFD, 0x21, 0x6F, 0xFD, 0x21, 0x6F,
@@ -194,10 +194,10 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0x21, 0x69, 0xFD, 0x21, 0x75, 0xFD, 0x22, 0x63, 0x71, 0xDE, 0xFD, 0x21, 0x73, 0xC8, 0x21, 0x6F,
     0xFD, 0x21, 0x6E, 0xFD, 0x41, 0x6C, 0xF8, 0x6B, 0x21, 0x69, 0xFC, 0xA0, 0x05, 0xE1, 0x21, 0x2E,
     0xFD, 0x21, 0x74, 0xFD, 0x21, 0x6E, 0xFD, 0x21, 0x65, 0xFD, 0x21, 0x6D, 0xFD, 0x21, 0x61, 0xFD,
-    0x21, 0x67, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x6D, 0xFF, 0xA3, 0x4E, 0x62, 0x64,
-    0xC3, 0x6C, 0x6E, 0x70, 0x72, 0x73, 0x63, 0x67, 0x76, 0x6D, 0x69, 0x75, 0xFE, 0xCF, 0xFE, 0xD6,
-    0xFE, 0xE5, 0xFF, 0x00, 0xFF, 0x49, 0xFF, 0x5E, 0xFF, 0x91, 0xFF, 0xA2, 0xFF, 0xC9, 0xFF, 0xD4,
-    0xFF, 0xDB, 0xFF, 0xF9, 0xFF, 0xFC, 0xFF, 0xFC, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB,
+    0x21, 0x67, 0xFD, 0x21, 0x6C, 0xFD, 0x21, 0x61, 0xFD, 0x41, 0x6D, 0xFF, 0xA3, 0x4E, 0x62, 0x63,
+    0x64, 0x67, 0x69, 0x6C, 0x6D, 0x6E, 0x70, 0x72, 0x73, 0x75, 0x76, 0xC3, 0xFE, 0xCF, 0xFF, 0xC9,
+    0xFE, 0xD6, 0xFF, 0xD4, 0xFF, 0xFC, 0xFF, 0x00, 0xFF, 0xF9, 0xFF, 0x49, 0xFF, 0x5E, 0xFF, 0x91,
+    0xFF, 0xA2, 0xFF, 0xFC, 0xFF, 0xDB, 0xFE, 0xE5, 0x47, 0xA2, 0xA9, 0xA8, 0xAA, 0xAE, 0xB4, 0xBB,
     0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xFE, 0xBD, 0xA0, 0x02,
     0x41, 0x21, 0x2E, 0xFD, 0xA0, 0x00, 0x41, 0x21, 0x2E, 0xFD, 0x21, 0x74, 0xFD, 0xA3, 0x00, 0xE1,
     0x2E, 0x73, 0x6E, 0xF1, 0xF4, 0xFD, 0x23, 0x2E, 0x73, 0x6E, 0xE8, 0xEB, 0xF4, 0xA1, 0x00, 0xE2,
@@ -225,9 +225,9 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0xFE, 0x91, 0xFE, 0x94, 0xA0, 0x03, 0x63, 0x21, 0x63, 0xFD, 0xA0, 0x03, 0x93, 0x21, 0x74, 0xFD,
     0x21, 0xA9, 0xFD, 0x22, 0x61, 0xC3, 0xF4, 0xFD, 0x21, 0x72, 0xFB, 0xA2, 0x00, 0x81, 0x65, 0x6F,
     0xE2, 0xFD, 0xC2, 0x00, 0x81, 0x65, 0x6F, 0xFF, 0xDB, 0xFB, 0x6A, 0x41, 0x64, 0xF5, 0x75, 0x21,
-    0x6E, 0xFC, 0x21, 0x65, 0xFD, 0xCD, 0x00, 0xE2, 0x2E, 0x62, 0x65, 0x67, 0x6C, 0x6D, 0x6E, 0x70,
-    0x72, 0x73, 0x74, 0x77, 0x69, 0xFE, 0x59, 0xFE, 0x5F, 0xFF, 0xBB, 0xFE, 0x5F, 0xFF, 0xE6, 0xFE,
-    0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF, 0xED, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF, 0xFD, 0x41,
+    0x6E, 0xFC, 0x21, 0x65, 0xFD, 0xCD, 0x00, 0xE2, 0x2E, 0x62, 0x65, 0x67, 0x69, 0x6C, 0x6D, 0x6E,
+    0x70, 0x72, 0x73, 0x74, 0x77, 0xFE, 0x59, 0xFE, 0x5F, 0xFF, 0xBB, 0xFE, 0x5F, 0xFF, 0xFD, 0xFF,
+    0xE6, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0xFF, 0xED, 0xFE, 0x5F, 0xFE, 0x5F, 0xFE, 0x5F, 0x41,
     0x6C, 0xF2, 0xB8, 0xA1, 0x00, 0xE1, 0x6C, 0xFC, 0xA0, 0x03, 0xC2, 0xC9, 0x00, 0xE2, 0x2E, 0x62,
     0x65, 0x66, 0x67, 0x68, 0x70, 0x73, 0x74, 0xFE, 0x23, 0xFE, 0x29, 0xFE, 0x3B, 0xFE, 0x29, 0xFE,
     0x29, 0xFF, 0xFD, 0xFE, 0x29, 0xFE, 0x29, 0xFE, 0x29, 0xC2, 0x00, 0xE2, 0x65, 0x61, 0xFE, 0x1D,
@@ -243,9 +243,9 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0x00, 0xE1, 0x61, 0xC3, 0x65, 0x6E, 0x67, 0x72, 0x6D, 0xFF, 0x8C, 0xFF, 0x9E, 0xFF, 0xA1, 0xFF,
     0xD4, 0xFF, 0xE7, 0xFF, 0xF1, 0xFF, 0xFD, 0x41, 0x93, 0xFB, 0xFE, 0x41, 0x72, 0xF2, 0x88, 0xA1,
     0x00, 0xE1, 0x72, 0xFC, 0xC1, 0x00, 0xE1, 0x72, 0xFE, 0x7D, 0x41, 0x64, 0xF2, 0x79, 0x21, 0x69,
-    0xFC, 0x4D, 0x61, 0xC3, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0xC5, 0x72, 0x75, 0x79, 0x63, 0xFE,
-    0x8A, 0xFD, 0x27, 0xFD, 0x4C, 0xFE, 0xE4, 0xFF, 0x12, 0xFF, 0x1A, 0xFF, 0x38, 0xFF, 0xCE, 0xFF,
-    0xE6, 0xFD, 0x5C, 0xFF, 0xEE, 0xFF, 0xF3, 0xFF, 0xFD, 0x41, 0x63, 0xFC, 0x7B, 0xC3, 0x00, 0xE1,
+    0xFC, 0x4D, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6B, 0x6C, 0x6F, 0x72, 0x75, 0x79, 0xC3, 0xC5, 0xFE,
+    0x8A, 0xFF, 0xFD, 0xFD, 0x4C, 0xFE, 0xE4, 0xFF, 0x12, 0xFF, 0x1A, 0xFF, 0x38, 0xFF, 0xCE, 0xFD,
+    0x5C, 0xFF, 0xEE, 0xFF, 0xF3, 0xFD, 0x27, 0xFF, 0xE6, 0x41, 0x63, 0xFC, 0x7B, 0xC3, 0x00, 0xE1,
     0x61, 0x6B, 0x65, 0xFF, 0xFC, 0xFD, 0x17, 0xFD, 0x29, 0x41, 0x63, 0xFF, 0x53, 0x21, 0x69, 0xFC,
     0x21, 0x66, 0xFD, 0x21, 0x69, 0xFD, 0xA1, 0x00, 0xE1, 0x6E, 0xFD, 0x41, 0x74, 0xF2, 0x5A, 0xA1,
     0x00, 0x91, 0x65, 0xFC, 0x21, 0x6C, 0xFB, 0xC3, 0x00, 0xE1, 0x6C, 0x6D, 0x74, 0xFF, 0xFD, 0xFC,
@@ -297,9 +297,9 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0xFF, 0xDA, 0xFA, 0x23, 0xFF, 0xE7, 0xFF, 0xDA, 0xFA, 0x23, 0xFF, 0xF9, 0x41, 0xA9, 0xF8, 0xC6,
     0x41, 0x75, 0xF8, 0xC2, 0x22, 0xC3, 0x65, 0xF8, 0xFC, 0x41, 0x68, 0xF8, 0xB9, 0x21, 0x63, 0xFC,
     0x21, 0x79, 0xFD, 0x41, 0x72, 0xF8, 0xAF, 0x22, 0xA8, 0xA9, 0xFC, 0xFC, 0x21, 0xC3, 0xFB, 0x4D,
-    0x72, 0x75, 0x61, 0x69, 0x6F, 0x6C, 0x65, 0xC3, 0x68, 0x6E, 0x73, 0x74, 0x79, 0xFE, 0xAE, 0xFE,
-    0xD4, 0xFF, 0x0C, 0xFC, 0x95, 0xFF, 0x43, 0xFF, 0x4A, 0xFF, 0x5D, 0xFF, 0x86, 0xFF, 0xC2, 0xFF,
-    0xE5, 0xFF, 0xF1, 0xFF, 0xFD, 0xF8, 0x86, 0x41, 0x63, 0xF1, 0xA8, 0x21, 0x6F, 0xFC, 0x41, 0x64,
+    0x61, 0x65, 0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x74, 0x75, 0x79, 0xC3, 0xFF, 0x0C, 0xFF,
+    0x5D, 0xFF, 0xC2, 0xFC, 0x95, 0xFF, 0x4A, 0xFF, 0xE5, 0xFF, 0x43, 0xFE, 0xAE, 0xFF, 0xF1, 0xFF,
+    0xFD, 0xFE, 0xD4, 0xF8, 0x86, 0xFF, 0x86, 0x41, 0x63, 0xF1, 0xA8, 0x21, 0x6F, 0xFC, 0x41, 0x64,
     0xF1, 0xA1, 0x21, 0x69, 0xFC, 0x41, 0x67, 0xF1, 0x9A, 0x41, 0x67, 0xF0, 0xB7, 0x21, 0x6C, 0xFC,
     0x41, 0x6C, 0xF1, 0x8F, 0x23, 0x69, 0x75, 0x6F, 0xF1, 0xF9, 0xFC, 0x41, 0x67, 0xF8, 0x89, 0x21,
     0x69, 0xFC, 0x21, 0x6C, 0xFD, 0x21, 0x6C, 0xFD, 0x42, 0x65, 0x69, 0xFF, 0xFD, 0xF6, 0x84, 0x42,
@@ -329,9 +329,9 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0x6D, 0xFD, 0x21, 0x67, 0xFD, 0x21, 0x61, 0xFD, 0x21, 0x72, 0xFD, 0x21, 0x68, 0xFD, 0x21, 0x70,
     0xFD, 0xA3, 0x00, 0xE1, 0x73, 0x6C, 0x61, 0xD3, 0xDD, 0xFD, 0xA0, 0x05, 0x52, 0x21, 0x6C, 0xFD,
     0x21, 0x64, 0xFA, 0x21, 0x75, 0xFD, 0x22, 0x61, 0x6F, 0xF7, 0xFD, 0x41, 0x6E, 0xF7, 0xEF, 0x21,
-    0x65, 0xFC, 0x4D, 0x27, 0x61, 0xC3, 0x64, 0x65, 0x69, 0x68, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79,
-    0xF6, 0x83, 0xFF, 0x76, 0xFF, 0x91, 0xFF, 0xA7, 0xF7, 0xEB, 0xFF, 0xDF, 0xFF, 0xF4, 0xFF, 0xFD,
-    0xF6, 0x83, 0xF7, 0xFB, 0xFB, 0x78, 0xF6, 0x83, 0xF6, 0x83, 0x41, 0x63, 0xFA, 0x33, 0x41, 0x72,
+    0x65, 0xFC, 0x4D, 0x27, 0x61, 0x64, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xC3,
+    0xF6, 0x83, 0xFF, 0x76, 0xFF, 0xA7, 0xF7, 0xEB, 0xFF, 0xF4, 0xFF, 0xDF, 0xFF, 0xFD, 0xF6, 0x83,
+    0xF7, 0xFB, 0xFB, 0x78, 0xF6, 0x83, 0xF6, 0x83, 0xFF, 0x91, 0x41, 0x63, 0xFA, 0x33, 0x41, 0x72,
     0xF6, 0xA6, 0xA1, 0x01, 0xC2, 0x61, 0xFC, 0x41, 0x73, 0xEF, 0xDE, 0xC2, 0x05, 0x23, 0x63, 0x74,
     0xF0, 0x03, 0xFF, 0xFC, 0x45, 0x70, 0x61, 0x68, 0x6F, 0x75, 0xFF, 0xEE, 0xFF, 0xF7, 0xEC, 0xAD,
     0xF0, 0x56, 0xF0, 0x56, 0x21, 0x73, 0xF0, 0x21, 0x6E, 0xFD, 0xC4, 0x00, 0xE2, 0x69, 0x75, 0x61,
@@ -361,10 +361,10 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0xC4, 0xF4, 0xD1, 0x45, 0x61, 0x65, 0x69, 0x6F, 0x79, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4, 0xCF, 0xF4,
     0xCF, 0xF4, 0xCF, 0x41, 0x75, 0xFA, 0x87, 0x21, 0x71, 0xFC, 0x21, 0x6F, 0xFD, 0x21, 0x6C, 0xFD,
     0x21, 0x69, 0xFD, 0x21, 0x64, 0xFD, 0x42, 0x6D, 0x6E, 0xF2, 0xE6, 0xFF, 0xFD, 0xC2, 0x00, 0xE2,
-    0x65, 0x61, 0xF5, 0xF9, 0xFF, 0xF9, 0xC1, 0x00, 0xE1, 0x65, 0xF5, 0xF0, 0x4C, 0x61, 0xC3, 0x65,
-    0x68, 0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x75, 0x73, 0x79, 0xF4, 0x79, 0xF5, 0xBC, 0xF5, 0xE1, 0xFF,
-    0xC7, 0xF7, 0xA7, 0xF5, 0xF1, 0xF5, 0xF1, 0xF4, 0x79, 0xFF, 0xF1, 0xFF, 0xFA, 0xF9, 0x6E, 0xF4,
-    0x79, 0x41, 0x69, 0xEF, 0xBB, 0x21, 0x75, 0xFC, 0x42, 0x71, 0x2E, 0xFF, 0xFD, 0xF5, 0xA6, 0xC5,
+    0x65, 0x61, 0xF5, 0xF9, 0xFF, 0xF9, 0xC1, 0x00, 0xE1, 0x65, 0xF5, 0xF0, 0x4C, 0x61, 0x65, 0x68,
+    0x69, 0x6C, 0x6E, 0x6F, 0x72, 0x73, 0x75, 0x79, 0xC3, 0xF4, 0x79, 0xF5, 0xE1, 0xFF, 0xC7, 0xF7,
+    0xA7, 0xF5, 0xF1, 0xF5, 0xF1, 0xF4, 0x79, 0xFF, 0xF1, 0xF9, 0x6E, 0xFF, 0xFA, 0xF4, 0x79, 0xF5,
+    0xBC, 0x41, 0x69, 0xEF, 0xBB, 0x21, 0x75, 0xFC, 0x42, 0x71, 0x2E, 0xFF, 0xFD, 0xF5, 0xA6, 0xC5,
     0x00, 0xE1, 0x72, 0x6D, 0x73, 0x2E, 0x6E, 0xEA, 0xD7, 0xF6, 0x80, 0xFF, 0xF9, 0xF5, 0x9F, 0xF5,
     0xAB, 0x41, 0x69, 0xF6, 0xD1, 0x42, 0x6C, 0x73, 0xFF, 0xFC, 0xEB, 0x02, 0xA0, 0x02, 0xD2, 0x21,
     0x68, 0xFD, 0x42, 0xC3, 0x61, 0xFA, 0x3F, 0xFF, 0xFD, 0xC2, 0x06, 0x02, 0x6F, 0x73, 0xF5, 0x12,
@@ -384,9 +384,9 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0xFD, 0x41, 0x67, 0xFF, 0x5F, 0x41, 0x6B, 0xF3, 0x5D, 0x42, 0x63, 0x6D, 0xFF, 0xFC, 0xFF, 0x62,
     0x41, 0x74, 0xFA, 0x90, 0x21, 0x63, 0xFC, 0x42, 0x6F, 0x75, 0xFF, 0x81, 0xFF, 0xFD, 0x41, 0x65,
     0xF3, 0x44, 0x21, 0x6C, 0xFC, 0x27, 0x61, 0x65, 0xC3, 0x69, 0x6F, 0x72, 0x79, 0xBD, 0xC4, 0xD9,
-    0xDC, 0xE4, 0xF2, 0xFD, 0x4D, 0x65, 0x75, 0x70, 0x6C, 0x61, 0xC3, 0x63, 0x68, 0x69, 0x6F, 0xC5,
-    0x74, 0x79, 0xFE, 0xCB, 0xFF, 0x04, 0xFF, 0x40, 0xFF, 0x5F, 0xF3, 0x11, 0xF4, 0x54, 0xFF, 0x7F,
-    0xFF, 0x8C, 0xF3, 0x11, 0xF3, 0x11, 0xF7, 0x13, 0xFF, 0xF1, 0xF3, 0x11, 0x41, 0x69, 0xF3, 0x97,
+    0xDC, 0xE4, 0xF2, 0xFD, 0x4D, 0x61, 0x63, 0x65, 0x68, 0x69, 0x6C, 0x6F, 0x70, 0x74, 0x75, 0x79,
+    0xC3, 0xC5, 0xF3, 0x11, 0xFF, 0x7F, 0xFE, 0xCB, 0xFF, 0x8C, 0xF3, 0x11, 0xFF, 0x5F, 0xF3, 0x11,
+    0xFF, 0x40, 0xFF, 0xF1, 0xFF, 0x04, 0xF3, 0x11, 0xF4, 0x54, 0xF7, 0x13, 0x41, 0x69, 0xF3, 0x97,
     0x21, 0x6E, 0xFC, 0x21, 0x6F, 0xFD, 0x22, 0x6D, 0x73, 0xFD, 0xF6, 0x21, 0x6F, 0xFB, 0x21, 0x6E,
     0xFD, 0x41, 0x75, 0xED, 0x66, 0x41, 0x73, 0xEC, 0x54, 0x21, 0x64, 0xFC, 0x21, 0x75, 0xFD, 0x41,
     0x6F, 0xF6, 0xA4, 0x42, 0x73, 0x70, 0xEA, 0xC3, 0xFF, 0xFC, 0x21, 0x69, 0xF9, 0x43, 0x6D, 0x62,
@@ -438,16 +438,182 @@ alignas(4) constexpr uint8_t fr_trie_data[] = {
     0x42, 0x73, 0x6C, 0xFF, 0xFD, 0xF8, 0x38, 0x41, 0x6F, 0xFD, 0x5C, 0x21, 0x74, 0xFC, 0x22, 0x61,
     0x73, 0xF2, 0xFD, 0x42, 0xA9, 0xA8, 0xEF, 0xD2, 0xEF, 0xD2, 0x47, 0x61, 0x65, 0xC3, 0x69, 0x6F,
     0x75, 0x79, 0xEF, 0xCB, 0xF1, 0x33, 0xFF, 0xF9, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB, 0xEF, 0xCB,
-    0x5D, 0x27, 0x2E, 0x61, 0x62, 0xC3, 0x63, 0x6A, 0x6D, 0x72, 0x70, 0x69, 0x65, 0x64, 0x74, 0x66,
-    0x67, 0x73, 0x6F, 0x77, 0x68, 0x75, 0x76, 0x6C, 0x78, 0x6B, 0x71, 0x6E, 0x79, 0x7A, 0xE7, 0xD0,
-    0xEF, 0x48, 0xF0, 0xCD, 0xF1, 0x53, 0xF2, 0x28, 0xF3, 0xD1, 0xF3, 0xFD, 0xF4, 0xAD, 0xF5, 0x6F,
-    0xF7, 0x2F, 0xF8, 0x34, 0xF8, 0x98, 0xF9, 0x32, 0xFA, 0x80, 0xFA, 0xE4, 0xFB, 0x3C, 0xFC, 0xA4,
-    0xFD, 0x6C, 0xFD, 0x97, 0xFE, 0x19, 0xFE, 0x4A, 0xFE, 0xDD, 0xFF, 0x35, 0xFF, 0x58, 0xFF, 0x65,
-    0xFF, 0x88, 0xFF, 0xAA, 0xFF, 0xDE, 0xFF, 0xEA,
+    0x5D, 0x27, 0x2E, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D,
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0xC3, 0xE7, 0xD0,
+    0xEF, 0x48, 0xF0, 0xCD, 0xF1, 0x53, 0xF3, 0xD1, 0xF9, 0x32, 0xF8, 0x98, 0xFA, 0xE4, 0xFB, 0x3C,
+    0xFE, 0x19, 0xF8, 0x34, 0xF3, 0xFD, 0xFF, 0x65, 0xFF, 0x35, 0xF4, 0xAD, 0xFF, 0xAA, 0xFD, 0x6C,
+    0xF7, 0x2F, 0xFF, 0x88, 0xF5, 0x6F, 0xFC, 0xA4, 0xFA, 0x80, 0xFE, 0x4A, 0xFE, 0xDD, 0xFD, 0x97,
+    0xFF, 0x58, 0xFF, 0xDE, 0xFF, 0xEA, 0xF2, 0x28,
+};
+
+// Dense lookup tables for the root and depth-1 transitions; nodes with at least
+// 12 transitions have their labels sorted.
+constexpr uint8_t fr_root_slots[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint8_t fr_byte_classes[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x01, 0x02, 0x03, 0x04, 0x05, 0xFF, 0x06, 0x07, 0x08, 0xFF, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0xFF, 0x0F, 0x10, 0x11, 0x12, 0x13, 0xFF, 0x14, 0x15, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1B, 0xFF, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint32_t fr_depth1_targets[] = {
+    0x000002C0u, 0x00000A38u, 0x00000BBDu, 0x00000C43u, 0x00000EC1u, 0x00001422u, 0x00001388u, 0x000015D4u,
+    0x0000162Cu, 0x00001909u, 0x00001324u, 0x00000EEDu, 0x00001A55u, 0x00001A25u, 0x00000F9Du, 0x00001A9Au,
+    0x0000185Cu, 0x0000121Fu, 0x00001A78u, 0x0000105Fu, 0x00001794u, 0x00001570u, 0x0000193Au, 0x000019CDu,
+    0x00001887u, 0x00001A48u, 0x00001ACEu, 0x00001ADAu, 0x00000D18u,
+};
+
+constexpr uint32_t fr_depth2_targets[] = {
+    0xFFFFFFFFu, 0x00000147u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000188u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000283u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000002B2u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x000002BDu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000002BDu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000168u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000002E9u, 0x0000036Au,
+    0x00000402u, 0x0000053Bu, 0x00000188u, 0x00000902u, 0xFFFFFFFFu, 0x00000564u, 0x000008CBu, 0x00000A35u,
+    0x0000065Fu, 0x0000090Fu, 0x000008BFu, 0x000007CAu, 0x00000A2Au, 0x000008A6u, 0x000008E5u, 0x000002BDu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x000002BDu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x0000031Eu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000A8Cu, 0x00000B86u, 0x00000A93u, 0xFFFFFFFFu,
+    0x00000B91u, 0xFFFFFFFFu, 0x00000BB9u, 0xFFFFFFFFu, 0x00000ABDu, 0x00000BB6u, 0x00000B06u, 0xFFFFFFFFu,
+    0x00000B1Bu, 0x00000B4Eu, 0x00000B5Fu, 0xFFFFFFFFu, 0x00000BB9u, 0x00000B98u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA2u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000C0Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u,
+    0xFFFFFFFFu, 0x00000C1Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000C35u, 0xFFFFFFFFu, 0x00000C3Au, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000BE8u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000D4Bu, 0xFFFFFFFFu, 0x00000EBEu,
+    0xFFFFFFFFu, 0x00000C0Du, 0xFFFFFFFFu, 0x00000DA5u, 0x00000DD3u, 0x00000DDBu, 0x00000DF9u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000E8Fu, 0xFFFFFFFFu, 0x00000C1Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000EAFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000EB4u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000BE8u,
+    0x00000EA7u, 0x00000AA5u, 0x00001398u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000013C9u, 0x00000C0Du, 0xFFFFFFFFu,
+    0x00001416u, 0x00001401u, 0xFFFFFFFFu, 0x0000141Fu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu,
+    0x00000C1Du, 0x00000F9Au, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000013B3u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001367u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000BB9u, 0x00001352u, 0xFFFFFFFFu,
+    0x00001373u, 0xFFFFFFFFu, 0x00001385u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001398u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000C0Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000015B5u, 0xFFFFFFFFu, 0x000015BEu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000AA5u, 0xFFFFFFFFu, 0x000015CBu, 0x00000F9Au, 0xFFFFFFFFu, 0x00001398u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001598u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000C0Du, 0xFFFFFFFFu, 0x000015F3u,
+    0x00000DD3u, 0xFFFFFFFFu, 0x00000C1Du, 0xFFFFFFFFu, 0x00000C1Du, 0x00000AA5u, 0xFFFFFFFFu, 0x0000161Du,
+    0x00000F9Au, 0xFFFFFFFFu, 0x00001626u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000BE8u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000F7Au, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000DD3u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001398u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001904u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x000018B4u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001304u, 0x0000130Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001309u, 0x000012EDu, 0x00001296u, 0x0000131Bu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x000012C1u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001320u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA2u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000EE9u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000C16u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000C04u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000C0Du, 0xFFFFFFFFu, 0x00001A4Fu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0x00000AC2u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000BE8u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x000019FAu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000C0Du, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000DD3u, 0xFFFFFFFFu, 0x000019EFu, 0x00001A22u, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x000012BAu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000019FFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000F7Au, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000F17u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000F97u, 0x00000F51u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000F9Au, 0xFFFFFFFFu,
+    0x00000F06u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000F64u, 0x00000EA7u, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000C0Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001A97u, 0xFFFFFFFFu, 0x00001A84u, 0xFFFFFFFFu, 0x000012F2u,
+    0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000BE8u, 0x00000EA7u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001801u, 0x00001808u, 0x0000156Cu, 0xFFFFFFFFu, 0x000017CEu, 0xFFFFFFFFu,
+    0x0000180Fu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000017EDu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000017D1u, 0x00000BB9u,
+    0x00001852u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001859u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA2u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000112Bu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000117Cu, 0xFFFFFFFFu, 0x000011E1u, 0x00000EB4u, 0xFFFFFFFFu, 0x00001169u,
+    0xFFFFFFFFu, 0x00001204u, 0x00001162u, 0xFFFFFFFFu, 0x000010CDu, 0x00001210u, 0x0000121Cu, 0x000010F3u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x000011A5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001A71u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00001030u, 0xFFFFFFFFu, 0x00000B98u, 0xFFFFFFFFu, 0x0000100Au, 0xFFFFFFFFu, 0x00001058u, 0x00000FFAu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000B98u, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x0000101Cu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001040u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000FE0u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0x00001713u,
+    0xFFFFFFFFu, 0x0000165Fu, 0xFFFFFFFFu, 0x00001720u, 0x00000AA5u, 0xFFFFFFFFu, 0x000016F3u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000AA5u, 0x000016D4u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001785u, 0x00001698u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000BE8u,
+    0x00000EA7u, 0xFFFFFFFFu, 0x00001490u, 0xFFFFFFFFu, 0x00001569u, 0xFFFFFFFFu, 0x000014BDu, 0xFFFFFFFFu,
+    0x000014EFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000151Eu, 0xFFFFFFFFu,
+    0x0000147Au, 0xFFFFFFFFu, 0x0000156Cu, 0x00001512u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001546u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000B98u, 0xFFFFFFFFu, 0x0000191Fu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001930u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001937u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000B98u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000195Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x0000198Au, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001966u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x000019C8u, 0xFFFFFFFFu, 0x00000C1Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x000019A8u, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00001882u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000C0Du, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0x00000AC2u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000141Bu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001A44u, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001AC0u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001ACBu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000C0Du, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000AA5u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00001AD3u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000BB9u, 0x00000AA5u, 0x00000BB9u, 0x00000CFFu, 0x00000BB9u, 0xFFFFFFFFu,
+    0xFFFFFFFFu,
+};
+
+constexpr SerializedTrieAcceleration fr_acceleration = {
+    fr_root_slots,
+    fr_byte_classes,
+    fr_depth1_targets,
+    fr_depth2_targets,
+    29u,
+    12u,
 };
 
 constexpr SerializedHyphenationPatterns fr_patterns = {
     0x1AF0u,
     fr_trie_data,
     sizeof(fr_trie_data),
+    &fr_acceleration,
 };
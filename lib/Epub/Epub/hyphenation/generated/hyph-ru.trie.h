@@ -76,9 +76,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBE, 0xB0, 0xEA, 0xFD, 0xA0, 0x01, 0x81, 0x21,
     0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x43, 0xD0,
     0xD1, 0x2D, 0xFF, 0xE9, 0xFF, 0xFD, 0xFC, 0xF8, 0x41, 0x2D, 0xFC, 0xEE, 0x50, 0xB0, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xBA, 0xFC, 0xED, 0xFD,
-    0x13, 0xFD, 0x45, 0xFD, 0x59, 0xFD, 0xB5, 0xFD, 0xC6, 0xFD, 0xE4, 0xFE, 0x1A, 0xFE, 0x5A, 0xFE,
-    0xA0, 0xFE, 0xFF, 0xFF, 0x9A, 0xFF, 0xF2, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x41, 0x82, 0xFC,
+    0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFC, 0xED, 0xFD,
+    0x13, 0xFD, 0x45, 0xFD, 0x59, 0xFD, 0xB5, 0xFD, 0xC6, 0xFF, 0xFC, 0xFD, 0xE4, 0xFE, 0x1A, 0xFF,
+    0xFC, 0xFF, 0xFC, 0xFE, 0x5A, 0xFE, 0xA0, 0xFE, 0xFF, 0xFF, 0x9A, 0xFF, 0xF2, 0x41, 0x82, 0xFC,
     0xE7, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0x80, 0xFC, 0x66, 0x21, 0xD1,
     0xFC, 0x41, 0xB2, 0xFC, 0xD3, 0x21, 0xD0, 0xFC, 0x43, 0xB1, 0xB7, 0xB0, 0xFF, 0xF6, 0xFF, 0xFD,
     0xFF, 0x5C, 0x21, 0xD0, 0xF6, 0x42, 0x81, 0x87, 0xFD, 0x1A, 0xFC, 0x4B, 0x21, 0xD1, 0xF9, 0x21,
@@ -99,10 +99,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xD0, 0xFF, 0xF0, 0xFB, 0xAB, 0x41, 0x80, 0xFF, 0x00, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x42,
     0xD0, 0x2D, 0xFF, 0xFD, 0xFB, 0x97, 0x41, 0x81, 0xFD, 0x2A, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD,
     0x21, 0x91, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xFA, 0xFF, 0xFD, 0xFB, 0x83, 0x41, 0x81, 0xFB,
-    0x15, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xFB, 0x75, 0x51, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x8E,
-    0x91, 0x84, 0x86, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8F, 0xFF, 0x19, 0xFF, 0x55, 0xFF, 0x7E,
-    0xFF, 0xC3, 0xFF, 0xD7, 0xFF, 0xEB, 0xFF, 0xF9, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
-    0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0x42, 0xD0, 0xD1, 0xFE,
+    0x15, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xFB, 0x75, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86,
+    0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFF, 0x19, 0xFF, 0x55, 0xFF, 0x7E,
+    0xFF, 0xC3, 0xFE, 0x80, 0xFF, 0xD7, 0xFE, 0x80, 0xFF, 0xEB, 0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80,
+    0xFE, 0x80, 0xFE, 0x80, 0xFE, 0x80, 0xFF, 0xF9, 0xFE, 0x80, 0xFE, 0x80, 0x42, 0xD0, 0xD1, 0xFE,
     0x50, 0xFF, 0xCC, 0xA0, 0x01, 0xB1, 0x21, 0xBF, 0xFD, 0x22, 0x80, 0x86, 0xFA, 0xFA, 0xA0, 0x0D,
     0x42, 0xA3, 0x01, 0x92, 0xD0, 0xD1, 0x2D, 0xF5, 0xF8, 0xFD, 0xA0, 0x01, 0xC1, 0x21, 0x82, 0xFD,
     0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0xA0, 0x00, 0xD1, 0x21, 0xB0, 0xFD, 0x21,
@@ -169,10 +169,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x21, 0x87, 0xFD, 0xA2, 0x02, 0x21, 0xD0, 0xD1, 0xF1, 0xFD, 0x22, 0xBB, 0xBE, 0xE0, 0xF9, 0x41,
     0xBB, 0xFC, 0x3D, 0x21, 0xD0, 0xFC, 0x42, 0xB0, 0xB5, 0xFB, 0xFD, 0xFF, 0xFD, 0x21, 0xD0, 0xF9,
     0x21, 0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD, 0xFB, 0xFB, 0x41, 0x2D, 0xFB,
-    0xF1, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB6, 0xB9, 0xFB, 0xF0, 0xFC, 0x29, 0xFC, 0x89, 0xFC, 0xD9, 0xFD, 0x4C, 0xFD, 0x73, 0xFD, 0xE1,
-    0xFD, 0xFB, 0xFE, 0x49, 0xFE, 0xA5, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0x9F, 0xFF, 0xF2, 0xFF, 0xFC,
-    0xFF, 0xFC, 0x41, 0x82, 0xFC, 0x0D, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0xA1, 0x00, 0x91, 0xD1,
+    0xF1, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xFB, 0xF0, 0xFC, 0x29, 0xFC, 0x89, 0xFC, 0xD9, 0xFD, 0x4C, 0xFD, 0x73, 0xFF, 0xFC,
+    0xFD, 0xE1, 0xFD, 0xFB, 0xFF, 0xFC, 0xFE, 0x49, 0xFE, 0xA5, 0xFF, 0x01, 0xFF, 0x81, 0xFF, 0x9F,
+    0xFF, 0xF2, 0x41, 0x82, 0xFC, 0x0D, 0x21, 0xD1, 0xFC, 0x21, 0x81, 0xFD, 0xA1, 0x00, 0x91, 0xD1,
     0xFD, 0x41, 0xBA, 0xFB, 0xA2, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0xBB,
     0xFB, 0x95, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x83, 0xFD, 0xAD, 0x21,
     0xD1, 0xFC, 0x41, 0xB2, 0xFB, 0xE8, 0x21, 0xD0, 0xFC, 0x41, 0xBB, 0xFB, 0xE1, 0x21, 0xD0, 0xFC,
@@ -211,9 +211,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xFF, 0xF8, 0xFF, 0xFC, 0xF9, 0x82, 0x41, 0x82, 0xF9, 0xF2, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xF9,
     0x74, 0x43, 0xB1, 0xB2, 0xB7, 0xF9, 0x62, 0xF9, 0x62, 0xF9, 0x62, 0xC2, 0x00, 0x91, 0xD0, 0x2D,
     0xFF, 0xF6, 0xF9, 0x63, 0xC1, 0x00, 0x91, 0x2D, 0xF9, 0x5A, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84,
-    0x85, 0x87, 0x88, 0x8D, 0x8E, 0x8F, 0x91, 0x86, 0x89, 0x8A, 0x8B, 0x8C, 0xFE, 0x1D, 0xFE, 0xAA,
-    0xFF, 0x3E, 0xFF, 0x79, 0xFF, 0x85, 0xFF, 0x9E, 0xFF, 0xB3, 0xFF, 0xC3, 0xFF, 0xD2, 0xFF, 0xE0,
-    0xFF, 0xF1, 0xFF, 0xFA, 0xFD, 0x63, 0xFD, 0x63, 0xFD, 0x63, 0xFD, 0x63, 0xFD, 0x63, 0x42, 0xD0,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFE, 0x1D, 0xFE, 0xAA,
+    0xFF, 0x3E, 0xFF, 0x79, 0xFF, 0x85, 0xFF, 0x9E, 0xFD, 0x63, 0xFF, 0xB3, 0xFF, 0xC3, 0xFD, 0x63,
+    0xFD, 0x63, 0xFD, 0x63, 0xFD, 0x63, 0xFF, 0xD2, 0xFF, 0xE0, 0xFF, 0xF1, 0xFF, 0xFA, 0x42, 0xD0,
     0xD1, 0xFD, 0x33, 0xFF, 0xCC, 0x41, 0xB2, 0xF9, 0x0E, 0x21, 0xD0, 0xFC, 0x41, 0xD1, 0xFA, 0xCF,
     0x41, 0x83, 0xF9, 0x56, 0xA1, 0x01, 0x31, 0xD1, 0xFC, 0x41, 0x8E, 0xFB, 0x93, 0x21, 0xD1, 0xFC,
     0x46, 0xB1, 0xB3, 0xB4, 0xB7, 0xBB, 0xBE, 0xFF, 0xE9, 0xFF, 0xEC, 0xFD, 0xA3, 0xFF, 0xF4, 0xFF,
@@ -253,9 +253,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xBB, 0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0x80, 0xF7, 0x29, 0xC2, 0x03, 0x91, 0xD0, 0xD1, 0xFD,
     0xBB, 0xFF, 0xFC, 0x21, 0xD1, 0xF3, 0x24, 0x80, 0x81, 0x82, 0x8F, 0xD6, 0xEB, 0xF4, 0xFD, 0xC3,
     0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB4, 0xFF, 0xF7, 0xF6, 0xBF, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xB9, 0xBC, 0xBF, 0xFD, 0xDA, 0xFD, 0xE6,
-    0xFD, 0xF0, 0xFD, 0xF9, 0xFD, 0xE6, 0xFE, 0x69, 0xFE, 0x75, 0xFE, 0x7B, 0xFE, 0xC7, 0xFE, 0xD3,
-    0xFF, 0x5E, 0xFE, 0xD3, 0xFF, 0xF4, 0xFA, 0xC2, 0xFA, 0xC2, 0xFA, 0xC2, 0x41, 0xBE, 0xF6, 0xDE,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0xDA, 0xFD, 0xE6,
+    0xFD, 0xF0, 0xFD, 0xF9, 0xFD, 0xE6, 0xFE, 0x69, 0xFE, 0x75, 0xFE, 0x7B, 0xFE, 0xC7, 0xFA, 0xC2,
+    0xFE, 0xD3, 0xFF, 0x5E, 0xFA, 0xC2, 0xFE, 0xD3, 0xFF, 0xF4, 0xFA, 0xC2, 0x41, 0xBE, 0xF6, 0xDE,
     0x21, 0xD0, 0xFC, 0xA0, 0x03, 0x32, 0x46, 0xB1, 0xB2, 0xB7, 0xBB, 0xBC, 0xBD, 0xF6, 0x93, 0xF6,
     0xD7, 0xFF, 0xFA, 0xFE, 0xB4, 0xFF, 0xFD, 0xF6, 0xD7, 0x45, 0x81, 0x82, 0x85, 0x87, 0x8F, 0xF8,
     0x7F, 0xF8, 0x2E, 0xF6, 0xAA, 0xFE, 0xA1, 0xFE, 0xD0, 0x22, 0xD0, 0xD1, 0xDD, 0xF0, 0x44, 0xB4,
@@ -278,9 +278,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x2D, 0xF7, 0x03, 0xF5, 0x50, 0xC2, 0x05, 0x02, 0xD1, 0x2D, 0xFB, 0xD1, 0xF5, 0x49, 0xC1, 0x02,
     0xB1, 0x2D, 0xF5, 0x40, 0x41, 0xB4, 0xFC, 0x28, 0xC2, 0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xF5,
     0x36, 0xA0, 0x0C, 0xD1, 0x42, 0x2E, 0x2D, 0xFF, 0xFD, 0xF5, 0x2A, 0x51, 0x80, 0x81, 0x82, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x8A, 0xFF, 0x6D, 0xFF,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFF, 0x6D, 0xFF,
     0x84, 0xFB, 0xC9, 0xFF, 0x94, 0xFC, 0xE5, 0xFC, 0x56, 0xFC, 0xE5, 0xFC, 0x56, 0xFC, 0xE5, 0xFC,
-    0xE5, 0xFF, 0xB4, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDA, 0xFF, 0xE3, 0xFF, 0xED, 0xFF, 0xF9, 0x42,
+    0xE5, 0xFF, 0xF9, 0xFF, 0xB4, 0xFF, 0xC7, 0xFF, 0xD3, 0xFF, 0xDA, 0xFF, 0xE3, 0xFF, 0xED, 0x42,
     0xD0, 0xD1, 0xFE, 0x3C, 0xFF, 0xCC, 0x42, 0x80, 0x8C, 0xF6, 0xA2, 0xF7, 0xD3, 0x21, 0xD1, 0xF9,
     0x41, 0xB4, 0xFD, 0xBA, 0x21, 0xD0, 0xFC, 0x46, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xBD, 0xF9, 0x7C,
     0xFC, 0x23, 0xFF, 0xF6, 0xFF, 0xFD, 0xF5, 0x05, 0xFC, 0x47, 0xC1, 0x01, 0x31, 0xD1, 0xF8, 0x28,
@@ -328,10 +328,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x64, 0xF2, 0x64, 0xFF, 0xFD, 0x41, 0x82, 0xF6, 0xCE, 0x22, 0xD0, 0xD1, 0xEF, 0xFC, 0x41, 0x82,
     0xFA, 0xFC, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xF6, 0x0D, 0xFF, 0xFC, 0x45, 0x80, 0x81, 0x82, 0x85,
     0x8E, 0xFF, 0xD3, 0xFF, 0xEE, 0xFB, 0x48, 0xFF, 0xF7, 0xF4, 0x2D, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0x9D, 0xFF, 0xF0, 0xF2, 0x03, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB,
-    0xBC, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xFD, 0x51, 0xF9, 0x2C, 0xFD, 0x61, 0xFD, 0x6B, 0xFD, 0x78,
-    0xFD, 0xF5, 0xFE, 0x24, 0xFE, 0x96, 0xFE, 0xAC, 0xFF, 0x02, 0xFF, 0x16, 0xFF, 0x52, 0xFF, 0xF6,
-    0xFD, 0x6B, 0xF6, 0x08, 0xF6, 0x08, 0x42, 0xB2, 0xBC, 0xF2, 0x27, 0xFB, 0x4D, 0x43, 0x81, 0x85,
+    0x9D, 0xFF, 0xF0, 0xF2, 0x03, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0x51, 0xF9, 0x2C, 0xFD, 0x61, 0xFD, 0x6B, 0xFD, 0x78,
+    0xFD, 0xF5, 0xF6, 0x08, 0xFE, 0x24, 0xFE, 0x96, 0xF6, 0x08, 0xFE, 0xAC, 0xFF, 0x02, 0xFF, 0x16,
+    0xFF, 0x52, 0xFF, 0xF6, 0xFD, 0x6B, 0x42, 0xB2, 0xBC, 0xF2, 0x27, 0xFB, 0x4D, 0x43, 0x81, 0x85,
     0x86, 0xF2, 0x06, 0xFB, 0x46, 0xF2, 0x96, 0x43, 0x2E, 0xD0, 0xD1, 0xF2, 0x8C, 0xFF, 0xEF, 0xFF,
     0xF6, 0x41, 0xBD, 0xFB, 0x32, 0x42, 0x2E, 0xD0, 0xF2, 0x7E, 0xFF, 0xFC, 0x45, 0xB4, 0xB7, 0xB8,
     0xBA, 0xBB, 0xF3, 0xBC, 0xF9, 0xDE, 0xF1, 0xE7, 0xF1, 0xE7, 0xF1, 0xE7, 0x42, 0x81, 0x82, 0xF1,
@@ -392,9 +392,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xEF, 0xEE, 0x2A, 0xF2, 0x2A, 0xEE, 0x63, 0xEE, 0xAF, 0x21, 0xD0, 0xF0, 0x45, 0x81, 0x82, 0x83,
     0x87, 0x8E, 0xFF, 0xFD, 0xF9, 0xE7, 0xEE, 0x34, 0xF2, 0x17, 0xF5, 0x6E, 0x43, 0xD0, 0xD1, 0x2D,
     0xFF, 0xC4, 0xFF, 0xF0, 0xEE, 0x12, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0x32, 0xFE, 0x3E, 0xFE, 0x47, 0xF5, 0xCA, 0xFE,
-    0x59, 0xFE, 0x7F, 0xF6, 0x28, 0xF5, 0x3B, 0xFE, 0xA9, 0xF5, 0x3B, 0xFF, 0x33, 0xF6, 0x28, 0xFF,
-    0x9D, 0xFF, 0xF6, 0xF5, 0xCA, 0xF2, 0x17, 0x42, 0xB5, 0xB9, 0xEE, 0x1C, 0xEE, 0x1C, 0x42, 0xD0,
+    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFE, 0x32, 0xFE, 0x3E, 0xFE, 0x47, 0xF5, 0xCA, 0xFE,
+    0x59, 0xFE, 0x7F, 0xF6, 0x28, 0xF5, 0x3B, 0xFE, 0xA9, 0xF2, 0x17, 0xF5, 0x3B, 0xFF, 0x33, 0xF6,
+    0x28, 0xFF, 0x9D, 0xFF, 0xF6, 0xF5, 0xCA, 0x42, 0xB5, 0xB9, 0xEE, 0x1C, 0xEE, 0x1C, 0x42, 0xD0,
     0xD1, 0xFF, 0xF9, 0xF9, 0x34, 0x42, 0xB3, 0xBA, 0xEE, 0x0E, 0xEE, 0x0E, 0x41, 0x86, 0xEE, 0x07,
     0x22, 0xD0, 0xD1, 0xF5, 0xFC, 0x41, 0xBD, 0xEF, 0x4B, 0x21, 0xD0, 0xFC, 0x44, 0xB2, 0xBA, 0xBB,
     0xBD, 0xFF, 0xFD, 0xED, 0xF7, 0xED, 0xF7, 0xED, 0xF7, 0x42, 0x81, 0x87, 0xED, 0xEA, 0xED, 0xEA,
@@ -407,10 +407,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xED, 0x49, 0xA0, 0x03, 0xD1, 0x22, 0xB0, 0xB1, 0xFD, 0xFD, 0x41, 0x80, 0xEF, 0xF6, 0x21, 0xD1,
     0xFC, 0x21, 0x82, 0xFD, 0xC3, 0x04, 0x23, 0xD0, 0xD1, 0x2D, 0xFF, 0xF1, 0xFF, 0xFD, 0xED, 0x2A,
     0xC1, 0x01, 0x31, 0xD0, 0xF8, 0xE6, 0x21, 0x81, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFA, 0x94, 0xFF,
-    0xFD, 0xED, 0x15, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x87, 0x88, 0x8D, 0x8A, 0x91, 0x85, 0x86,
-    0x89, 0x8B, 0x8C, 0x8E, 0x8F, 0xFF, 0xC2, 0xFF, 0xE1, 0xF5, 0x2B, 0xFF, 0xF6, 0xF4, 0xCD, 0xF4,
-    0x3E, 0xF5, 0x2B, 0xF5, 0x2B, 0xF7, 0xE1, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1,
-    0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0xCF, 0xFF, 0xCC,
+    0xFD, 0xED, 0x15, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B,
+    0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFF, 0xC2, 0xFF, 0xE1, 0xF5, 0x2B, 0xFF, 0xF6, 0xF4, 0xCD, 0xF1,
+    0x1A, 0xF1, 0x1A, 0xF4, 0x3E, 0xF5, 0x2B, 0xF1, 0x1A, 0xF7, 0xE1, 0xF1, 0x1A, 0xF1, 0x1A, 0xF5,
+    0x2B, 0xF1, 0x1A, 0xF1, 0x1A, 0xF1, 0x1A, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0xCF, 0xFF, 0xCC,
     0x41, 0xD0, 0xF1, 0xC9, 0x21, 0xB5, 0xFC, 0x42, 0xD0, 0xD1, 0xFF, 0xFD, 0xF0, 0x2B, 0x44, 0xB1,
     0xB3, 0xB7, 0xBE, 0xEE, 0x7A, 0xFF, 0xF9, 0xEC, 0xEE, 0xEC, 0xB5, 0x41, 0x80, 0xEF, 0x41, 0x21,
     0xD1, 0xFC, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x42, 0x81, 0x82, 0xFF, 0xFD, 0xF2, 0xB2, 0xC3,
@@ -464,9 +464,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xBB, 0xF7, 0x16, 0xF2, 0x8D, 0xFF, 0xFD, 0x21, 0xD0, 0xF6, 0x41, 0xD1, 0xFD, 0x8E, 0x46, 0x80,
     0x81, 0x82, 0x85, 0x88, 0x89, 0xFF, 0x93, 0xFF, 0xB9, 0xFF, 0xDC, 0xFF, 0xE5, 0xFF, 0xF9, 0xFF,
     0xFC, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0x57, 0xFF, 0xED, 0xE9, 0x8D, 0x50, 0xB0, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFC, 0xE2,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFC, 0xE2,
     0xF0, 0xB4, 0xFD, 0x3D, 0xF4, 0xF3, 0xFD, 0x49, 0xFD, 0xD2, 0xFD, 0xED, 0xFD, 0x49, 0xFE, 0x74,
-    0xF0, 0xB4, 0xFE, 0x8A, 0xFE, 0x93, 0xFE, 0xCF, 0xFF, 0xF4, 0xF1, 0x43, 0xED, 0x90, 0x41, 0x88,
+    0xED, 0x90, 0xF0, 0xB4, 0xFE, 0x8A, 0xFE, 0x93, 0xFE, 0xCF, 0xFF, 0xF4, 0xF1, 0x43, 0x41, 0x88,
     0xEB, 0x6A, 0x21, 0xD1, 0xFC, 0x42, 0xB2, 0xBD, 0xEA, 0x1E, 0xF1, 0x85, 0x21, 0xD0, 0xF9, 0x44,
     0xB1, 0xB2, 0xB7, 0xBD, 0xE9, 0x84, 0xFF, 0xF3, 0xFF, 0xFD, 0xEE, 0x63, 0xA0, 0x06, 0xD3, 0x45,
     0x80, 0x81, 0x85, 0x87, 0x8E, 0xE9, 0x74, 0xFF, 0xFD, 0xE9, 0x74, 0xE9, 0x74, 0xE9, 0x8E, 0x22,
@@ -502,10 +502,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x2D, 0xFF, 0xE9, 0xFF, 0xF6, 0xE7, 0x53, 0x42, 0xB5, 0xBA, 0xE9, 0x61, 0xE8, 0x1C, 0xC1, 0x02,
     0xB1, 0xD1, 0xF7, 0xC1, 0x44, 0x82, 0x8E, 0x8F, 0x91, 0xE8, 0x0F, 0xE9, 0x54, 0xFF, 0xFA, 0xE9,
     0x54, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xE8, 0x02, 0xFF, 0xE6, 0xFF, 0xF3, 0xE7, 0x2D, 0x51, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x8D,
+    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91,
     0xFF, 0x05, 0xFF, 0x1B, 0xEE, 0x53, 0xFF, 0x6F, 0xEE, 0xE2, 0xED, 0xC6, 0xFF, 0x86, 0xEE, 0x53,
-    0xFC, 0x32, 0xEE, 0xE2, 0xFF, 0x9D, 0xFF, 0xCD, 0xFF, 0xF3, 0xF6, 0xDD, 0xF1, 0xE0, 0xF1, 0xE0,
-    0xEB, 0x2F, 0x42, 0xD0, 0xD1, 0xFD, 0x6B, 0xFF, 0xCC, 0x42, 0xB8, 0xBE, 0xF2, 0xFC, 0xE7, 0x2D,
+    0xFC, 0x32, 0xEE, 0xE2, 0xFF, 0x9D, 0xFF, 0xCD, 0xFF, 0xF3, 0xEB, 0x2F, 0xF6, 0xDD, 0xF1, 0xE0,
+    0xF1, 0xE0, 0x42, 0xD0, 0xD1, 0xFD, 0x6B, 0xFF, 0xCC, 0x42, 0xB8, 0xBE, 0xF2, 0xFC, 0xE7, 0x2D,
     0xA1, 0x01, 0xB1, 0xD0, 0xF9, 0x41, 0x80, 0xF0, 0xCB, 0x21, 0xD1, 0xFC, 0x21, 0xB4, 0xFD, 0x21,
     0xD0, 0xFD, 0x43, 0xB4, 0xB7, 0xBD, 0xFF, 0xEE, 0xE6, 0xC1, 0xFF, 0xFD, 0x41, 0x82, 0xEC, 0xCE,
     0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFC, 0xE6, 0xBE, 0x41, 0x81, 0xE7, 0x03,
@@ -586,9 +586,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xB0, 0xB5, 0xB8, 0xBB, 0xBD, 0xBE, 0xFF, 0xCD, 0xE2, 0xE4, 0xE7, 0xC2, 0xFF, 0xF9, 0xF4, 0xD3,
     0xE2, 0xE4, 0xA0, 0x07, 0x62, 0x43, 0x81, 0x82, 0x91, 0xFF, 0xFD, 0xF4, 0xBD, 0xE2, 0xCE, 0x43,
     0xD0, 0xD1, 0x2D, 0xFF, 0xE0, 0xFF, 0xF6, 0xE1, 0xEF, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
-    0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFB, 0x27, 0xFB, 0x69, 0xFB, 0xE9,
-    0xFC, 0x28, 0xFC, 0xA9, 0xFC, 0xDD, 0xFD, 0x0B, 0xFD, 0x9C, 0xFD, 0xBD, 0xFD, 0xFC, 0xFE, 0x32,
-    0xFE, 0x66, 0xFE, 0x84, 0xFF, 0x8E, 0xFF, 0xF6, 0xE5, 0xF4, 0x41, 0xD1, 0xE8, 0x0F, 0x21, 0xBA,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFB, 0x27, 0xFB, 0x69, 0xFB, 0xE9,
+    0xFC, 0x28, 0xFC, 0xA9, 0xFC, 0xDD, 0xFD, 0x0B, 0xFD, 0x9C, 0xFD, 0xBD, 0xE5, 0xF4, 0xFD, 0xFC,
+    0xFE, 0x32, 0xFE, 0x66, 0xFE, 0x84, 0xFF, 0x8E, 0xFF, 0xF6, 0x41, 0xD1, 0xE8, 0x0F, 0x21, 0xBA,
     0xFC, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x41, 0x91, 0xE1, 0xD6, 0xC2, 0x00, 0xA1, 0xD0, 0xD1, 0xE7,
     0x24, 0xFF, 0xFC, 0x41, 0xBE, 0xE1, 0xA7, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xE7, 0x9F, 0x41, 0xBD,
     0xE5, 0x69, 0x21, 0xD0, 0xFC, 0x44, 0xB4, 0xBA, 0xBC, 0xBF, 0xFF, 0xF2, 0xE2, 0x2F, 0xFF, 0xFD,
@@ -627,10 +627,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE4, 0xFF, 0xFB, 0xDF, 0x7E, 0x41, 0xB2, 0xE0, 0x49, 0x42, 0xD0,
     0x2D, 0xFF, 0xFC, 0xDF, 0x70, 0x42, 0xD0, 0x2D, 0xFC, 0xEF, 0xDF, 0x69, 0x41, 0xB3, 0xDF, 0x57,
     0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xDF, 0x5E, 0x41, 0xB7, 0xDF, 0x4C, 0xC2, 0x00, 0x91, 0xD0, 0x2D,
-    0xFF, 0xFC, 0xDF, 0x53, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8D, 0x8E,
-    0x8F, 0x91, 0x89, 0x8A, 0x8B, 0x8C, 0xFE, 0x5D, 0xFE, 0xEF, 0xFF, 0x40, 0xFF, 0x61, 0xFF, 0x7C,
-    0xFF, 0xCC, 0xFF, 0xDA, 0xFF, 0xE1, 0xE5, 0xB9, 0xE6, 0x90, 0xFF, 0xEC, 0xFF, 0xF7, 0xE5, 0xF0,
-    0xE3, 0x59, 0xE3, 0x59, 0xE3, 0x59, 0xE3, 0x59, 0x42, 0xD0, 0xD1, 0xFD, 0x31, 0xFF, 0xCC, 0x42,
+    0xFF, 0xFC, 0xDF, 0x53, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A,
+    0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFE, 0x5D, 0xFE, 0xEF, 0xFF, 0x40, 0xFF, 0x61, 0xFF, 0x7C,
+    0xFF, 0xCC, 0xFF, 0xDA, 0xFF, 0xE1, 0xE5, 0xB9, 0xE3, 0x59, 0xE3, 0x59, 0xE3, 0x59, 0xE3, 0x59,
+    0xE6, 0x90, 0xFF, 0xEC, 0xFF, 0xF7, 0xE5, 0xF0, 0x42, 0xD0, 0xD1, 0xFD, 0x31, 0xFF, 0xCC, 0x42,
     0xD0, 0xD1, 0xE3, 0x6F, 0xE2, 0x73, 0x42, 0xB1, 0xB7, 0xFF, 0xF9, 0xDF, 0x36, 0x41, 0x82, 0xE3,
     0x79, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFC, 0xDE, 0xFD, 0x43, 0xB0, 0xB8, 0xBB, 0xDF,
     0xC8, 0xDF, 0x52, 0xEB, 0x9A, 0xC3, 0x01, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xFE, 0x53, 0xDE,
@@ -649,24 +649,24 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x2D, 0xE7, 0xA0, 0xDE, 0x22, 0x41, 0xB1, 0xE7, 0x9E, 0xA0, 0x08, 0x04, 0xC1, 0x01, 0xC1, 0xD1,
     0xFA, 0x73, 0x22, 0x82, 0x83, 0xF7, 0xFA, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEE, 0xFF, 0xFB, 0xDE,
     0x07, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xE7, 0x7B, 0xDD, 0xFD, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0xF7, 0xF1, 0xBC, 0xE5,
-    0x27, 0xFF, 0x0B, 0xFF, 0x64, 0xFF, 0x93, 0xFF, 0xAA, 0xF1, 0xBC, 0xFF, 0xB8, 0xE5, 0x27, 0xE5,
-    0x27, 0xFF, 0xC9, 0xFF, 0xD2, 0xFF, 0xED, 0xFF, 0xF7, 0xE2, 0x03, 0x42, 0xD1, 0x2D, 0xFD, 0x2D,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFE, 0xF7, 0xF1, 0xBC, 0xE5,
+    0x27, 0xFF, 0x0B, 0xFF, 0x64, 0xFF, 0x93, 0xFF, 0xAA, 0xF1, 0xBC, 0xFF, 0xB8, 0xE2, 0x03, 0xE5,
+    0x27, 0xE5, 0x27, 0xFF, 0xC9, 0xFF, 0xD2, 0xFF, 0xED, 0xFF, 0xF7, 0x42, 0xD1, 0x2D, 0xFD, 0x2D,
     0xDD, 0xC3, 0xC2, 0x02, 0x21, 0x2E, 0x2D, 0xE8, 0x8F, 0xDD, 0xBC, 0x43, 0x2E, 0xD1, 0x2D, 0xDE,
     0x88, 0xE8, 0x50, 0xDD, 0xB3, 0x41, 0xB2, 0xE4, 0xF5, 0x41, 0x81, 0xE0, 0xF1, 0x43, 0xD0, 0xD1,
-    0x2D, 0xFF, 0xF8, 0xFF, 0xFC, 0xDD, 0xA1, 0x51, 0x80, 0x81, 0x84, 0x86, 0x87, 0x8A, 0x8C, 0x91,
-    0x82, 0x83, 0x85, 0x88, 0x89, 0x8B, 0x8D, 0x8E, 0x8F, 0xFF, 0xD4, 0xE4, 0xCA, 0xE5, 0x59, 0xE5,
-    0x59, 0xE4, 0xCA, 0xFF, 0xDB, 0xFF, 0xE4, 0xFF, 0xF6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1,
-    0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xC2, 0x02, 0xB1, 0xD0, 0xD1,
+    0x2D, 0xFF, 0xF8, 0xFF, 0xFC, 0xDD, 0xA1, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFF, 0xD4, 0xE4, 0xCA, 0xE1, 0xA6, 0xE1,
+    0xA6, 0xE5, 0x59, 0xE1, 0xA6, 0xE5, 0x59, 0xE4, 0xCA, 0xE1, 0xA6, 0xE1, 0xA6, 0xFF, 0xDB, 0xE1,
+    0xA6, 0xFF, 0xE4, 0xE1, 0xA6, 0xE1, 0xA6, 0xE1, 0xA6, 0xFF, 0xF6, 0xC2, 0x02, 0xB1, 0xD0, 0xD1,
     0xFF, 0x6F, 0xFF, 0xCC, 0x41, 0xB8, 0xDF, 0x14, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xF1, 0x40, 0x42,
     0x80, 0x83, 0xFF, 0xF9, 0xDD, 0x94, 0x21, 0xD1, 0xF9, 0x41, 0xD1, 0xE8, 0xA9, 0x41, 0x85, 0xDD,
     0x92, 0x42, 0xD0, 0xD1, 0xDE, 0x49, 0xFF, 0xFC, 0x41, 0xD1, 0xEF, 0xD7, 0x41, 0xB5, 0xDD, 0x7A,
     0x41, 0x91, 0xDD, 0x76, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x21, 0xBD, 0xFB, 0x21, 0xD0, 0xFD, 0x41,
     0xB0, 0xDD, 0x67, 0xC2, 0x05, 0x02, 0xD0, 0xD1, 0xFF, 0xFC, 0xE4, 0x87, 0x41, 0xBB, 0xDD, 0x63,
     0x21, 0xD0, 0xFC, 0x41, 0xB7, 0xDD, 0x5C, 0x21, 0xD0, 0xFC, 0x4E, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xB8, 0xBE, 0xDD, 0x55, 0xDD, 0x55, 0xFF, 0xBC, 0xDF,
-    0xC6, 0xFF, 0xBF, 0xFF, 0xC7, 0xE8, 0x2A, 0xE5, 0xE0, 0xFF, 0xCE, 0xFF, 0xE2, 0xFF, 0xE9, 0xDD,
-    0x55, 0xFF, 0xF6, 0xFF, 0xFD, 0x43, 0xB2, 0xB4, 0xB6, 0xDD, 0x2A, 0xE5, 0xB5, 0xDD, 0x2A, 0x21,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF, 0xDD, 0x55, 0xDD, 0x55, 0xFF, 0xBC, 0xDF,
+    0xC6, 0xFF, 0xBF, 0xFF, 0xC7, 0xE8, 0x2A, 0xE5, 0xE0, 0xFF, 0xF6, 0xFF, 0xCE, 0xFF, 0xE2, 0xFF,
+    0xE9, 0xFF, 0xFD, 0xDD, 0x55, 0x43, 0xB2, 0xB4, 0xB6, 0xDD, 0x2A, 0xE5, 0xB5, 0xDD, 0x2A, 0x21,
     0xD0, 0xF6, 0xC1, 0x01, 0xE1, 0xD1, 0xED, 0x5F, 0x41, 0xB2, 0xF2, 0x20, 0x21, 0xD0, 0xFC, 0x21,
     0xB0, 0xFD, 0xA1, 0x01, 0xE1, 0xD0, 0xFD, 0x49, 0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x88, 0x8F,
     0x8E, 0xFF, 0xE8, 0xFF, 0xEB, 0xEA, 0x31, 0xDD, 0x08, 0xFF, 0xFB, 0xE0, 0xFF, 0xE5, 0x93, 0xDD,
@@ -711,9 +711,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xF9, 0xC1, 0x01, 0xE1, 0xD0, 0xDB, 0x42, 0x47, 0x80, 0x81, 0x82, 0x85, 0x88, 0x8D, 0x8E, 0xFF,
     0xC0, 0xFF, 0xCC, 0xFF, 0xF5, 0xDC, 0x51, 0xFF, 0xFA, 0xDC, 0x51, 0xDC, 0x51, 0x43, 0xD0, 0xD1,
     0x2D, 0xFF, 0x72, 0xFF, 0xEA, 0xDA, 0x21, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
-    0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB9, 0xBF, 0xFD, 0x7C, 0xE1, 0xDF, 0xFD, 0xEC, 0xFE, 0x07,
-    0xFE, 0x25, 0xFE, 0x36, 0xE5, 0x89, 0xFE, 0x3F, 0xFE, 0x78, 0xFE, 0x93, 0xFE, 0xB5, 0xFE, 0xC1,
-    0xFF, 0x08, 0xFF, 0xF6, 0xDE, 0x26, 0xDE, 0x26, 0x42, 0x81, 0x87, 0xDA, 0x37, 0xDA, 0x45, 0xC2,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0x7C, 0xE1, 0xDF, 0xFD, 0xEC, 0xFE, 0x07,
+    0xFE, 0x25, 0xFE, 0x36, 0xE5, 0x89, 0xFE, 0x3F, 0xFE, 0x78, 0xDE, 0x26, 0xFE, 0x93, 0xFE, 0xB5,
+    0xFE, 0xC1, 0xFF, 0x08, 0xFF, 0xF6, 0xDE, 0x26, 0x42, 0x81, 0x87, 0xDA, 0x37, 0xDA, 0x45, 0xC2,
     0x00, 0x91, 0xD0, 0xD1, 0xE6, 0xD3, 0xFF, 0xF9, 0x42, 0xD0, 0xD1, 0xDB, 0x21, 0xF6, 0xD5, 0x41,
     0x81, 0xF1, 0x05, 0xA1, 0x00, 0x91, 0xD1, 0xFC, 0x44, 0xB0, 0xB5, 0xB8, 0xBE, 0xFF, 0xE7, 0xFF,
     0xF0, 0xFD, 0xBF, 0xFF, 0xFB, 0x43, 0x83, 0x8E, 0x8F, 0xD9, 0xFE, 0xDA, 0x18, 0xEA, 0x88, 0x43,
@@ -731,10 +731,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x42, 0x81, 0x89, 0xF1, 0x9E, 0xD9, 0xD3, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xEF, 0xFF,
     0xF9, 0xD8, 0xF7, 0x42, 0xB5, 0xB8, 0xDB, 0x05, 0xDB, 0x05, 0x42, 0x8E, 0x8F, 0xDA, 0xFE, 0xE0,
     0x30, 0xA0, 0x0B, 0xF1, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xEF, 0xFF, 0xF6, 0xFF, 0xFD, 0xD8,
-    0xDA, 0x51, 0x80, 0x81, 0x82, 0x83, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8E, 0x8F, 0x91, 0x84,
-    0x85, 0x89, 0x8D, 0xFF, 0x1E, 0xE0, 0x00, 0xFF, 0x28, 0xFF, 0x9B, 0xE0, 0x8F, 0xDF, 0x73, 0xE0,
-    0x8F, 0xFF, 0xAA, 0xFF, 0xD6, 0xFF, 0xF3, 0xE8, 0x8A, 0xE3, 0x8D, 0xE3, 0x8D, 0xDC, 0xDC, 0xDC,
-    0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x42, 0xD0, 0xD1, 0xFE, 0x82, 0xFF, 0xCC, 0xC1, 0x01, 0xE1, 0xD1,
+    0xDA, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xFF, 0x1E, 0xE0, 0x00, 0xFF, 0x28, 0xFF, 0x9B, 0xDC, 0xDC, 0xDC, 0xDC, 0xE0,
+    0x8F, 0xDF, 0x73, 0xE0, 0x8F, 0xDC, 0xDC, 0xFF, 0xAA, 0xFF, 0xD6, 0xFF, 0xF3, 0xDC, 0xDC, 0xE8,
+    0x8A, 0xE3, 0x8D, 0xE3, 0x8D, 0x42, 0xD0, 0xD1, 0xFE, 0x82, 0xFF, 0xCC, 0xC1, 0x01, 0xE1, 0xD1,
     0xDF, 0x0C, 0x41, 0xD0, 0xE9, 0xF4, 0x41, 0xBE, 0xDF, 0x73, 0x21, 0xD0, 0xFC, 0xC1, 0x00, 0xD1,
     0xD0, 0xDC, 0xE1, 0x42, 0xB0, 0xB4, 0xFF, 0xFA, 0xDB, 0x66, 0x21, 0xD0, 0xF9, 0x49, 0xB1, 0xB2,
     0xB3, 0xB4, 0xB7, 0xBC, 0xBD, 0xBE, 0xBF, 0xD8, 0xD0, 0xD8, 0xD0, 0xFF, 0xDF, 0xFF, 0xE5, 0xFF,
@@ -821,24 +821,24 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x21, 0xBB, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xFD, 0xD6, 0x27, 0xD3, 0x5B, 0x42, 0xBB, 0xBD,
     0xDD, 0xA8, 0xD3, 0x46, 0xC1, 0x01, 0xB1, 0xD0, 0xF6, 0x2B, 0x21, 0x82, 0xFA, 0x43, 0xD0, 0xD1,
     0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xD3, 0x41, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xD8, 0x6D, 0xD3, 0x37,
-    0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x8E, 0x8F, 0x91, 0x86, 0x89, 0x8A, 0x8B,
-    0x8C, 0x8D, 0xFE, 0x5C, 0xFF, 0x07, 0xFF, 0x57, 0xFF, 0x63, 0xFF, 0x75, 0xFF, 0xBF, 0xD9, 0xD4,
-    0xFF, 0xD3, 0xFF, 0xED, 0xFF, 0xF7, 0xD9, 0xD4, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D,
-    0xD7, 0x3D, 0xD7, 0x3D, 0x42, 0xD0, 0xD1, 0xFD, 0xC4, 0xFF, 0xCC, 0x41, 0xB2, 0xE7, 0x57, 0xC2,
+    0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x91, 0xFE, 0x5C, 0xFF, 0x07, 0xFF, 0x57, 0xFF, 0x63, 0xFF, 0x75, 0xFF, 0xBF, 0xD7, 0x3D,
+    0xD9, 0xD4, 0xFF, 0xD3, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D, 0xD7, 0x3D, 0xFF, 0xED,
+    0xFF, 0xF7, 0xD9, 0xD4, 0x42, 0xD0, 0xD1, 0xFD, 0xC4, 0xFF, 0xCC, 0x41, 0xB2, 0xE7, 0x57, 0xC2,
     0x01, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xD2, 0xEF, 0x42, 0xD0, 0x2D, 0xDC, 0x64, 0xD2, 0xE6, 0x42,
     0x81, 0x82, 0xD3, 0xF8, 0xD7, 0x84, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xD2, 0xD8, 0x42, 0xD0, 0x2D,
-    0xD7, 0x31, 0xD2, 0xD1, 0x42, 0xD1, 0x2D, 0xD4, 0x8F, 0xD2, 0xCA, 0x50, 0xB4, 0xBD, 0xBE, 0xBF,
-    0xBA, 0xB0, 0xB1, 0xB2, 0xB3, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBB, 0xBC, 0xFF, 0xD4, 0xFF, 0xDD,
-    0xFF, 0xEB, 0xFF, 0xF2, 0xFF, 0xF9, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2,
-    0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0x42, 0xB0, 0xB5, 0xD2,
+    0xD7, 0x31, 0xD2, 0xD1, 0x42, 0xD1, 0x2D, 0xD4, 0x8F, 0xD2, 0xCA, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6, 0xD2, 0xD6, 0xD2,
+    0xD6, 0xD2, 0xD6, 0xD2, 0xFF, 0xD4, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2, 0xD6, 0xD2,
+    0xFF, 0xF9, 0xD6, 0xD2, 0xD6, 0xD2, 0xFF, 0xDD, 0xFF, 0xEB, 0xFF, 0xF2, 0x42, 0xB0, 0xB5, 0xD2,
     0xAD, 0xD2, 0x87, 0x21, 0xD0, 0xF9, 0x41, 0xBE, 0xDC, 0xDF, 0x41, 0x83, 0xE6, 0xE8, 0x22, 0xD0,
     0xD1, 0xF8, 0xFC, 0x44, 0xB1, 0xBA, 0xBC, 0xBD, 0xD2, 0xDA, 0xFF, 0xF0, 0xFF, 0xFB, 0xD2, 0xDA,
     0x42, 0x84, 0x88, 0xE6, 0xD2, 0xD2, 0xCD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xF9, 0xD2,
     0x67, 0x42, 0xD0, 0x2D, 0xE6, 0xBA, 0xD2, 0x5D, 0x41, 0x81, 0xDF, 0xBB, 0x43, 0xD0, 0xD1, 0x2D,
-    0xE6, 0xAF, 0xFF, 0xFC, 0xD2, 0x52, 0xC1, 0x01, 0x31, 0x2D, 0xD2, 0x48, 0x51, 0x81, 0x82, 0x85,
-    0x8F, 0x91, 0x80, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0xFF, 0xDB,
-    0xFF, 0xE5, 0xFF, 0xF0, 0xFF, 0xFA, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51,
-    0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51,
+    0xE6, 0xAF, 0xFF, 0xFC, 0xD2, 0x52, 0xC1, 0x01, 0x31, 0x2D, 0xD2, 0x48, 0x51, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xD6, 0x51,
+    0xFF, 0xDB, 0xFF, 0xE5, 0xD6, 0x51, 0xD6, 0x51, 0xFF, 0xF0, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51,
+    0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xD6, 0x51, 0xFF, 0xFA, 0xD6, 0x51,
     0xC2, 0x03, 0x32, 0xD0, 0xD1, 0xFF, 0x4B, 0xFF, 0xCC, 0x41, 0x80, 0xD3, 0x0E, 0x42, 0xD0, 0xD1,
     0xD6, 0x61, 0xFF, 0xFC, 0x41, 0xD0, 0xF4, 0xC8, 0x21, 0xBD, 0xFC, 0xC2, 0x00, 0xA1, 0xD0, 0xD1,
     0xFF, 0xFD, 0xD3, 0xB0, 0x42, 0xBD, 0xBE, 0xD1, 0xF6, 0xD2, 0x18, 0x21, 0xD0, 0xF9, 0x41, 0x81,
@@ -877,10 +877,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xD0, 0xF6, 0xA0, 0x08, 0xF2, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
     0xFD, 0x46, 0x80, 0x81, 0x82, 0x84, 0x85, 0x88, 0xFF, 0xDB, 0xFF, 0xEC, 0xDF, 0x5D, 0xD4, 0x72,
     0xFF, 0xFD, 0xD1, 0xE7, 0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xAB, 0xFF, 0xED, 0xCF, 0xBA,
-    0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB6,
-    0xB9, 0xFE, 0x35, 0xD6, 0xE1, 0xFE, 0x5F, 0xD7, 0x70, 0xFE, 0x69, 0xFE, 0x8A, 0xD6, 0xE1, 0xFE,
-    0xAD, 0xFE, 0xB7, 0xFF, 0x49, 0xD7, 0x70, 0xFF, 0x69, 0xFF, 0xF4, 0xD7, 0x70, 0xD3, 0xBD, 0xD3,
-    0xBD, 0x42, 0xBB, 0xBE, 0xCF, 0xC2, 0xCF, 0xD9, 0x42, 0x81, 0x87, 0xF2, 0x68, 0xCF, 0xBB, 0x22,
+    0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xFE, 0x35, 0xD6, 0xE1, 0xFE, 0x5F, 0xD7, 0x70, 0xFE, 0x69, 0xFE, 0x8A, 0xD3, 0xBD, 0xD6,
+    0xE1, 0xFE, 0xAD, 0xD3, 0xBD, 0xFE, 0xB7, 0xFF, 0x49, 0xD7, 0x70, 0xFF, 0x69, 0xFF, 0xF4, 0xD7,
+    0x70, 0x42, 0xBB, 0xBE, 0xCF, 0xC2, 0xCF, 0xD9, 0x42, 0x81, 0x87, 0xF2, 0x68, 0xCF, 0xBB, 0x22,
     0xD0, 0xD1, 0xF2, 0xF9, 0x44, 0xB1, 0xB4, 0xB7, 0xBE, 0xD1, 0x84, 0xCF, 0xAF, 0xCF, 0xC9, 0xE6,
     0xA0, 0x42, 0x82, 0x85, 0xCF, 0xBC, 0xCF, 0xA2, 0x22, 0xD0, 0xD1, 0xEC, 0xF9, 0x45, 0xB0, 0xB1,
     0xB5, 0xBA, 0xBE, 0xCF, 0x96, 0xCF, 0x96, 0xCF, 0xB0, 0xCF, 0x96, 0xCF, 0x96, 0x46, 0x80, 0x81,
@@ -902,10 +902,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xD0, 0xDB, 0x64, 0x42, 0x82, 0x89, 0xD0, 0x65, 0xD5, 0x97, 0x21, 0xD1, 0xF9, 0x46, 0x80, 0x81,
     0x82, 0x87, 0x8E, 0x91, 0xFF, 0xDF, 0xFF, 0xE5, 0xFF, 0xEC, 0xFF, 0xF2, 0xFF, 0xFD, 0xD5, 0x8D,
     0xC3, 0x00, 0xA1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF, 0xED, 0xCE, 0x2E, 0xC1, 0x00, 0xA1, 0x2D,
-    0xCE, 0x22, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x8C, 0x8E, 0x91, 0x8A,
-    0x89, 0x8B, 0x8D, 0x8F, 0xFF, 0x08, 0xFF, 0x73, 0xFF, 0x8D, 0xFF, 0xEE, 0xD5, 0xDE, 0xE1, 0xE4,
-    0xD5, 0xDE, 0xD5, 0x4F, 0xD5, 0xDE, 0xD8, 0xDC, 0xFF, 0xFA, 0xD8, 0xDC, 0xD8, 0xF2, 0xD2, 0x2B,
-    0xD2, 0x2B, 0xD2, 0x2B, 0xD2, 0x2B, 0x42, 0xD0, 0xD1, 0xFE, 0x3A, 0xFF, 0xCC, 0x42, 0xB5, 0xBB,
+    0xCE, 0x22, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
+    0x8D, 0x8E, 0x8F, 0x91, 0xFF, 0x08, 0xFF, 0x73, 0xFF, 0x8D, 0xFF, 0xEE, 0xD5, 0xDE, 0xE1, 0xE4,
+    0xD5, 0xDE, 0xD5, 0x4F, 0xD5, 0xDE, 0xD2, 0x2B, 0xD8, 0xF2, 0xD2, 0x2B, 0xD8, 0xDC, 0xD2, 0x2B,
+    0xFF, 0xFA, 0xD2, 0x2B, 0xD8, 0xDC, 0x42, 0xD0, 0xD1, 0xFE, 0x3A, 0xFF, 0xCC, 0x42, 0xB5, 0xBB,
     0xCE, 0xB6, 0xCD, 0xD6, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xCF, 0x97, 0x41, 0xBE, 0xCE, 0xA8, 0x42,
     0xD0, 0xD1, 0xFF, 0xFC, 0xD1, 0x33, 0x41, 0xD0, 0xD8, 0x45, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD,
     0xC1, 0x00, 0xA1, 0xD1, 0xD6, 0xE6, 0x41, 0xB8, 0xD9, 0x5F, 0x42, 0x2E, 0xD0, 0xCF, 0xCE, 0xFF,
@@ -947,10 +947,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xFF, 0xF9, 0xD0, 0xF1, 0x42, 0xBA, 0xBF, 0xCB, 0xD6, 0xCE, 0xC6, 0x21, 0xD0, 0xF9, 0x42, 0xD0,
     0xD1, 0xD7, 0x31, 0xD4, 0x98, 0x45, 0x80, 0x81, 0x82, 0x88, 0x91, 0xFF, 0xE8, 0xFF, 0xF6, 0xFF,
     0xF9, 0xCF, 0xCD, 0xFB, 0x50, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xB8, 0xFF, 0xF0, 0xCB,
-    0x59, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB6, 0xB9, 0xFD, 0xFA, 0xFE, 0x07, 0xFE, 0x1A, 0xFE, 0x35, 0xE0, 0x5F, 0xFE, 0xB6, 0xFE, 0xC7,
-    0xFF, 0x27, 0xFF, 0x3A, 0xFF, 0x4A, 0xD3, 0x0F, 0xFF, 0x57, 0xFF, 0xF4, 0xD3, 0x0F, 0xCF, 0x5C,
-    0xCF, 0x5C, 0x41, 0xB1, 0xCB, 0x64, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xFC, 0xCB, 0x18, 0xA0,
+    0x59, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xFD, 0xFA, 0xFE, 0x07, 0xFE, 0x1A, 0xFE, 0x35, 0xE0, 0x5F, 0xFE, 0xB6, 0xCF, 0x5C,
+    0xFE, 0xC7, 0xFF, 0x27, 0xCF, 0x5C, 0xFF, 0x3A, 0xFF, 0x4A, 0xD3, 0x0F, 0xFF, 0x57, 0xFF, 0xF4,
+    0xD3, 0x0F, 0x41, 0xB1, 0xCB, 0x64, 0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xFC, 0xCB, 0x18, 0xA0,
     0x09, 0x42, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xD3, 0xE2, 0x21, 0xD0, 0xFC, 0x21,
     0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x4A, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xBA, 0xBD, 0xBE, 0xBF,
     0xCC, 0xB0, 0xCB, 0x27, 0xCB, 0x41, 0xFF, 0xF0, 0xCD, 0x13, 0xE4, 0x55, 0xCC, 0xB0, 0xCD, 0x13,
@@ -972,10 +972,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x3D, 0xFF, 0xEF, 0xFF, 0xF9, 0xC9, 0xF1, 0x41, 0xD0, 0xFC, 0xF3,
     0x44, 0xB4, 0xB7, 0xBA, 0xBD, 0xCA, 0x2C, 0xFF, 0xFC, 0xCE, 0x5D, 0xCB, 0xF8, 0x41, 0xBA, 0xFD,
     0x14, 0x21, 0xD0, 0xFC, 0x42, 0x81, 0x85, 0xFF, 0xFD, 0xCB, 0xE4, 0x43, 0xD0, 0xD1, 0x2D, 0xFF,
-    0xE5, 0xFF, 0xF9, 0xC9, 0xC3, 0x51, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x8B, 0x8C, 0x8E,
-    0x8F, 0x91, 0x8A, 0x80, 0x88, 0x89, 0x8D, 0xFE, 0xA1, 0xD0, 0x5F, 0xFE, 0xFB, 0xDE, 0xCB, 0xFF,
-    0x08, 0xD1, 0x7B, 0xD0, 0x5F, 0xFF, 0x22, 0xFF, 0x82, 0xFF, 0x9A, 0xFF, 0xC8, 0xFF, 0xF6, 0xD4,
-    0x8F, 0xCD, 0xC8, 0xCD, 0xC8, 0xCD, 0xC8, 0xCD, 0xC8, 0x42, 0xD0, 0xD1, 0xFE, 0x38, 0xFF, 0xCC,
+    0xE5, 0xFF, 0xF9, 0xC9, 0xC3, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xCD, 0xC8, 0xFE, 0xA1, 0xD0, 0x5F, 0xFE, 0xFB, 0xDE,
+    0xCB, 0xFF, 0x08, 0xD1, 0x7B, 0xD0, 0x5F, 0xCD, 0xC8, 0xCD, 0xC8, 0xD4, 0x8F, 0xFF, 0x22, 0xFF,
+    0x82, 0xCD, 0xC8, 0xFF, 0x9A, 0xFF, 0xC8, 0xFF, 0xF6, 0x42, 0xD0, 0xD1, 0xFE, 0x38, 0xFF, 0xCC,
     0x41, 0xD0, 0xEA, 0x27, 0xC1, 0x03, 0x91, 0xD0, 0xCE, 0x75, 0x42, 0x80, 0x8C, 0xC9, 0x69, 0xC9,
     0x69, 0x21, 0xD1, 0xF9, 0x41, 0xBB, 0xD2, 0xEF, 0x21, 0xD0, 0xFC, 0x47, 0xB2, 0xB3, 0xB4, 0xB7,
     0xBA, 0xBB, 0xBD, 0xFF, 0xE5, 0xFF, 0xE9, 0xFF, 0xF6, 0xCE, 0x6B, 0xD0, 0x51, 0xFF, 0xFD, 0xE2,
@@ -1011,10 +1011,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x77, 0xC7, 0xB2, 0xC7, 0xB2, 0xCA, 0xD0, 0x21, 0xD0, 0xF3, 0x41, 0xB8, 0xCE, 0xC0, 0x42, 0xD0,
     0xD1, 0xFF, 0xFC, 0xC9, 0x2D, 0x44, 0x80, 0x81, 0x82, 0x84, 0xD0, 0x77, 0xFF, 0xF2, 0xFF, 0xF9,
     0xCE, 0xB5, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB9, 0xFF, 0xF3, 0xC7, 0x5C, 0xC2, 0x02, 0x21, 0xD0,
-    0x2D, 0xCB, 0xB2, 0xC7, 0x52, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA,
-    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0x2A, 0xFE, 0x41, 0xDC, 0x5B, 0xFE, 0x4E, 0xCE, 0x7C,
-    0xFE, 0xCF, 0xCF, 0x0B, 0xDB, 0x11, 0xFF, 0x1E, 0xFF, 0x28, 0xFF, 0x3E, 0xCF, 0x0B, 0xFF, 0x7F,
-    0xFF, 0xED, 0xFF, 0xF7, 0xCB, 0x58, 0x43, 0xB0, 0xB8, 0xBE, 0xED, 0xC5, 0xC7, 0xED, 0xD0, 0x9D,
+    0x2D, 0xCB, 0xB2, 0xC7, 0x52, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFE, 0x2A, 0xFE, 0x41, 0xDC, 0x5B, 0xFE, 0x4E, 0xCE, 0x7C,
+    0xFE, 0xCF, 0xCF, 0x0B, 0xDB, 0x11, 0xFF, 0x1E, 0xCB, 0x58, 0xFF, 0x28, 0xFF, 0x3E, 0xCF, 0x0B,
+    0xFF, 0x7F, 0xFF, 0xED, 0xFF, 0xF7, 0x43, 0xB0, 0xB8, 0xBE, 0xED, 0xC5, 0xC7, 0xED, 0xD0, 0x9D,
     0x41, 0x8B, 0xC7, 0x53, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFC, 0xC7, 0x0A, 0x41, 0xD1,
     0xEE, 0xE7, 0x43, 0xBA, 0xBD, 0xBE, 0xC6, 0xF1, 0xC6, 0xF1, 0xFF, 0xFC, 0x41, 0xB8, 0xD3, 0x99,
     0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0xC3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD,
@@ -1028,9 +1028,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xFC, 0xCB, 0xAD, 0xC6, 0x73, 0x42, 0x81, 0x8E, 0xC7, 0x3E, 0xC6, 0xC5, 0x43, 0x2E, 0xD1, 0x2D,
     0xC7, 0x37, 0xFF, 0xF9, 0xC6, 0x62, 0xC2, 0x02, 0x21, 0xD1, 0x2D, 0xC8, 0x0B, 0xC6, 0x58, 0x42,
     0x80, 0x81, 0xC6, 0x7D, 0xE4, 0x9B, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xC6, 0x48, 0x51, 0x80, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x8A, 0x91, 0xFF,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFF,
     0x37, 0xFF, 0x59, 0xCD, 0x74, 0xFF, 0x82, 0xFF, 0x8D, 0xCD, 0x74, 0xCE, 0x03, 0xFF, 0xAF, 0xD1,
-    0xB3, 0xFF, 0xBE, 0xFF, 0xCE, 0xFF, 0xDF, 0xFF, 0xE9, 0xF8, 0x1F, 0xFF, 0xF9, 0xD1, 0x17, 0xCA,
+    0xB3, 0xFF, 0xBE, 0xD1, 0x17, 0xFF, 0xCE, 0xFF, 0xDF, 0xFF, 0xE9, 0xF8, 0x1F, 0xFF, 0xF9, 0xCA,
     0x50, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0xC4, 0xFF, 0xCC, 0x41, 0xB8, 0xD6, 0x60, 0x42, 0xD0,
     0xD1, 0xFF, 0xFC, 0xCF, 0x28, 0x41, 0xB4, 0xC6, 0x41, 0x21, 0xD0, 0xFC, 0x41, 0x81, 0xD2, 0x30,
     0x42, 0xD0, 0xD1, 0xCD, 0x3D, 0xFF, 0xFC, 0x41, 0xBA, 0xE7, 0x15, 0x21, 0xD0, 0xFC, 0x41, 0xBD,
@@ -1083,9 +1083,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xBB, 0xBF, 0xC6, 0xF5, 0xC4, 0x09, 0xC6, 0x4C, 0x41, 0x87, 0xC2, 0xEB, 0x22, 0xD0, 0xD1, 0xF2,
     0xFC, 0x45, 0x80, 0x81, 0x82, 0x84, 0x8D, 0xFF, 0xE6, 0xFF, 0xFB, 0xCE, 0xB2, 0xCB, 0xC9, 0xC3,
     0x3E, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xFF, 0xBD, 0xFF, 0xF0, 0xC2, 0xDD, 0x50, 0xB0, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0xBC, 0xFD, 0x50,
-    0xD6, 0x99, 0xCA, 0x04, 0xFD, 0x69, 0xFD, 0xBF, 0xFE, 0xA1, 0xFE, 0xB4, 0xFF, 0x27, 0xFF, 0x55,
-    0xC9, 0x77, 0xFF, 0x68, 0xFF, 0xF4, 0xE6, 0xF9, 0xC6, 0xE0, 0xC6, 0xE0, 0xC6, 0xE0, 0x43, 0xB5,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0x50,
+    0xD6, 0x99, 0xCA, 0x04, 0xFD, 0x69, 0xFD, 0xBF, 0xFE, 0xA1, 0xC6, 0xE0, 0xFE, 0xB4, 0xFF, 0x27,
+    0xC6, 0xE0, 0xFF, 0x55, 0xC9, 0x77, 0xC6, 0xE0, 0xFF, 0x68, 0xFF, 0xF4, 0xE6, 0xF9, 0x43, 0xB5,
     0xB8, 0xBE, 0xCC, 0x25, 0xCC, 0x25, 0xC2, 0xE5, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xC2, 0x96, 0x42,
     0xB5, 0xBE, 0xC2, 0x84, 0xC3, 0xDE, 0x21, 0xD0, 0xF9, 0xC1, 0x00, 0xA1, 0xD0, 0xC2, 0xA3, 0x41,
     0xBA, 0xC3, 0x98, 0x21, 0xD0, 0xFC, 0x48, 0xB2, 0xB3, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xD6,
@@ -1107,10 +1107,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xE0, 0xFF, 0xED, 0xC1, 0x86, 0xA0, 0x04, 0x23, 0x21, 0x80, 0xFD, 0xC2, 0x03, 0xE2, 0xD1, 0x2D,
     0xFF, 0xFD, 0xC1, 0x73, 0x41, 0xB2, 0xC1, 0x9E, 0xC2, 0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xC1,
     0x66, 0x41, 0xB1, 0xC4, 0xA9, 0xC2, 0x02, 0xB1, 0xD0, 0x2D, 0xFF, 0xFC, 0xC1, 0x59, 0x51, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x8A,
+    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91,
     0xFE, 0xBA, 0xFF, 0x01, 0xFF, 0x67, 0xFF, 0x7D, 0xCC, 0xC2, 0xFF, 0x86, 0xC9, 0x12, 0xFF, 0x8F,
-    0xFF, 0x98, 0xC9, 0x12, 0xFF, 0xA1, 0xFF, 0xCA, 0xF3, 0x2E, 0xFF, 0xDD, 0xFF, 0xEA, 0xFF, 0xF7,
-    0xCC, 0x26, 0x42, 0xD0, 0xD1, 0xFE, 0x4B, 0xFF, 0xCC, 0x42, 0xB2, 0xBF, 0xC1, 0x30, 0xC1, 0x71,
+    0xFF, 0x98, 0xC9, 0x12, 0xCC, 0x26, 0xFF, 0xA1, 0xFF, 0xCA, 0xF3, 0x2E, 0xFF, 0xDD, 0xFF, 0xEA,
+    0xFF, 0xF7, 0x42, 0xD0, 0xD1, 0xFE, 0x4B, 0xFF, 0xCC, 0x42, 0xB2, 0xBF, 0xC1, 0x30, 0xC1, 0x71,
     0xC2, 0x04, 0xC3, 0xD0, 0x2D, 0xFF, 0xF9, 0xC1, 0x0E, 0x41, 0xD0, 0xF3, 0x32, 0x41, 0xB5, 0xE0,
     0x46, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xD8, 0x95, 0x41, 0xB3, 0xC1, 0x9C, 0x21, 0xD0, 0xFC, 0x42,
     0xBB, 0xBC, 0xFF, 0xFD, 0xC4, 0xC8, 0x42, 0x81, 0x82, 0xC1, 0x39, 0xC1, 0xBD, 0x22, 0xD0, 0xD1,
@@ -1242,9 +1242,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x45, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xB9, 0x0D, 0x43, 0xB2, 0xB4, 0xB7, 0xB8, 0xFB, 0xB8, 0xFB,
     0xB8, 0xFB, 0xC3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xE6, 0xF7, 0xB8, 0xFC, 0x41, 0xB6,
     0xB9, 0xF9, 0xC2, 0x00, 0x91, 0xD0, 0x2D, 0xFF, 0xFC, 0xB8, 0xEC, 0x51, 0x80, 0x81, 0x82, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x8D, 0x8E, 0x8F, 0x91, 0x89, 0x8A, 0x8B, 0x8C, 0xFD, 0x11, 0xFE,
-    0x25, 0xFE, 0xFC, 0xFF, 0x19, 0xFF, 0x4E, 0xFF, 0x76, 0xFF, 0x80, 0xFF, 0xA3, 0xFF, 0xC8, 0xFF,
-    0xD6, 0xC0, 0xA5, 0xFF, 0xE7, 0xFF, 0xF7, 0xBC, 0xF2, 0xBC, 0xF2, 0xBC, 0xF2, 0xBC, 0xF2, 0x42,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFD, 0x11, 0xFE,
+    0x25, 0xFE, 0xFC, 0xFF, 0x19, 0xFF, 0x4E, 0xFF, 0x76, 0xFF, 0x80, 0xFF, 0xA3, 0xFF, 0xC8, 0xBC,
+    0xF2, 0xBC, 0xF2, 0xBC, 0xF2, 0xBC, 0xF2, 0xFF, 0xD6, 0xC0, 0xA5, 0xFF, 0xE7, 0xFF, 0xF7, 0x42,
     0xD0, 0xD1, 0xFC, 0x43, 0xFF, 0xCC, 0x42, 0xB8, 0xBB, 0xC4, 0xBF, 0xB8, 0xB4, 0x42, 0xD0, 0xD1,
     0xFF, 0xF9, 0xDF, 0x22, 0x44, 0xB2, 0xB4, 0xB5, 0xB7, 0xFF, 0xF9, 0xBD, 0x3F, 0xCB, 0xCC, 0xBD,
     0xA2, 0x43, 0xB0, 0xB5, 0xBE, 0xB8, 0xE9, 0xB8, 0xBB, 0xB8, 0xE9, 0x42, 0x83, 0x8B, 0xB8, 0xDF,
@@ -1290,10 +1290,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xFC, 0x47, 0x80, 0x81, 0x82, 0x85, 0x88, 0x8D, 0x91, 0xFF, 0xC0, 0xFF, 0xD5, 0xFF, 0xDE, 0xB9,
     0x59, 0xFF, 0xF6, 0xDA, 0x5D, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x84, 0xFF, 0xEA, 0xB5,
     0xF7, 0x41, 0xD0, 0xED, 0xEB, 0x21, 0xBE, 0xFC, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xFF, 0xFD, 0xB5,
-    0xE6, 0x50, 0xB0, 0xB2, 0xB4, 0xB5, 0xB8, 0xBA, 0xBB, 0xBD, 0xBE, 0xBF, 0xB1, 0xB3, 0xB6, 0xB7,
-    0xB9, 0xBC, 0xFD, 0x8A, 0xC9, 0xA5, 0xBD, 0x10, 0xFE, 0x0A, 0xFE, 0x48, 0xFE, 0x52, 0xFE, 0xDA,
-    0xFE, 0xF5, 0xFF, 0xE6, 0xFF, 0xF7, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC, 0xB9, 0xEC,
-    0xB9, 0xEC, 0x41, 0xB3, 0xB6, 0x08, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xC9, 0x9E, 0x21, 0xD0, 0xFC,
+    0xE6, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
+    0xBE, 0xBF, 0xFD, 0x8A, 0xB9, 0xEC, 0xC9, 0xA5, 0xB9, 0xEC, 0xBD, 0x10, 0xFE, 0x0A, 0xB9, 0xEC,
+    0xB9, 0xEC, 0xFE, 0x48, 0xB9, 0xEC, 0xFE, 0x52, 0xFE, 0xDA, 0xB9, 0xEC, 0xFE, 0xF5, 0xFF, 0xE6,
+    0xFF, 0xF7, 0x41, 0xB3, 0xB6, 0x08, 0x21, 0xD0, 0xFC, 0x41, 0xBD, 0xC9, 0x9E, 0x21, 0xD0, 0xFC,
     0x46, 0xB2, 0xB7, 0xB9, 0xBB, 0xBE, 0xBC, 0xBC, 0xEA, 0xB5, 0xFA, 0xB8, 0x89, 0xB5, 0xFA, 0xFF,
     0xF6, 0xFF, 0xFD, 0x41, 0x82, 0xBC, 0xD7, 0x22, 0xD0, 0xD1, 0xE9, 0xFC, 0x41, 0x8C, 0xC9, 0xAC,
     0xA1, 0x01, 0xC1, 0xD1, 0xFC, 0x46, 0xB2, 0xB3, 0xB4, 0xBA, 0xBB, 0xBF, 0xB5, 0x85, 0xB8, 0x64,
@@ -1315,9 +1315,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xB7, 0x49, 0xB4, 0x84, 0x42, 0xD1, 0x2D, 0xBD, 0x31, 0xB4, 0x7A, 0xC1, 0x02, 0x52, 0x2D, 0xB4,
     0x73, 0x41, 0xD1, 0xEB, 0xC6, 0x42, 0x81, 0x82, 0xFF, 0xFC, 0xB9, 0x0E, 0xC2, 0x01, 0x31, 0xD1,
     0x2D, 0xFF, 0xF9, 0xB4, 0x62, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-    0x8C, 0x8D, 0x8E, 0x91, 0x8A, 0x8B, 0x8F, 0xFF, 0x62, 0xFF, 0x88, 0xFF, 0x9F, 0xFF, 0xCB, 0xBF,
-    0xCB, 0xBB, 0x9F, 0xBC, 0x1B, 0xFC, 0xCE, 0xBC, 0x1B, 0xBC, 0x1B, 0xFF, 0xD5, 0xFF, 0xDF, 0xFF,
-    0xE6, 0xFF, 0xF7, 0xBF, 0x2F, 0xB8, 0x68, 0xB8, 0x68, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0x48,
+    0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFF, 0x62, 0xFF, 0x88, 0xFF, 0x9F, 0xFF, 0xCB, 0xBF,
+    0xCB, 0xBB, 0x9F, 0xBC, 0x1B, 0xFC, 0xCE, 0xBC, 0x1B, 0xBC, 0x1B, 0xBF, 0x2F, 0xB8, 0x68, 0xFF,
+    0xD5, 0xFF, 0xDF, 0xFF, 0xE6, 0xB8, 0x68, 0xFF, 0xF7, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0x48,
     0xFF, 0xCC, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
     0xBD, 0xBE, 0xBF, 0xBA, 0xFC, 0xBF, 0x2D, 0xC4, 0x2B, 0xC7, 0x45, 0xCD, 0x30, 0xD5, 0x06, 0xD6,
     0xB9, 0xDB, 0x83, 0xE1, 0x22, 0xE2, 0x0E, 0xE6, 0x34, 0xEA, 0x97, 0xEE, 0x0F, 0xF3, 0x00, 0xFB,
@@ -1410,10 +1410,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xFF, 0xE2, 0xFF, 0xEF, 0xB2, 0x93, 0xFF, 0xFD, 0xFA, 0xFB, 0xC7, 0x12, 0x44, 0x2E, 0xD0, 0xD1,
     0x2D, 0xB0, 0x9C, 0xFF, 0x55, 0xFF, 0xE4, 0xAE, 0x82, 0x41, 0x8E, 0xAE, 0xD4, 0x42, 0xD0, 0xD1,
     0xAF, 0xDC, 0xFF, 0xFC, 0x21, 0xBB, 0xF9, 0xC2, 0x02, 0x21, 0xD0, 0x2D, 0xFF, 0xFD, 0xAE, 0x67,
-    0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB9, 0xFB, 0x52, 0xFB, 0x81, 0xFB, 0xD8, 0xFB, 0xEC, 0xFC, 0x13, 0xFD, 0x20, 0xFD, 0x42, 0xFD,
-    0x50, 0xFD, 0xF6, 0xFE, 0x07, 0xFE, 0x1D, 0xFE, 0x26, 0xFE, 0x65, 0xFF, 0xDC, 0xFF, 0xF7, 0xB2,
-    0x6D, 0x43, 0xBA, 0xBD, 0xBF, 0xAE, 0x22, 0xAE, 0x8C, 0xAE, 0x22, 0xC1, 0x02, 0xD1, 0xD0, 0xBF,
+    0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0xFB, 0x52, 0xFB, 0x81, 0xFB, 0xD8, 0xFB, 0xEC, 0xFC, 0x13, 0xFD, 0x20, 0xFD, 0x42, 0xFD,
+    0x50, 0xFD, 0xF6, 0xB2, 0x6D, 0xFE, 0x07, 0xFE, 0x1D, 0xFE, 0x26, 0xFE, 0x65, 0xFF, 0xDC, 0xFF,
+    0xF7, 0x43, 0xBA, 0xBD, 0xBF, 0xAE, 0x22, 0xAE, 0x8C, 0xAE, 0x22, 0xC1, 0x02, 0xD1, 0xD0, 0xBF,
     0x06, 0x21, 0xB2, 0xFA, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0xC3, 0x09, 0x62, 0xD0, 0xD1, 0x2D,
     0xFF, 0xE7, 0xFF, 0xFD, 0xAE, 0x14, 0x41, 0x82, 0xAF, 0x21, 0x42, 0xD0, 0xD1, 0xBA, 0xF8, 0xFF,
     0xFC, 0x21, 0xBA, 0xF9, 0x21, 0xD0, 0xFD, 0x42, 0xB0, 0xBB, 0xAE, 0x3F, 0xAD, 0xEC, 0xA1, 0x02,
@@ -1503,9 +1503,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xBB, 0xA9, 0x66, 0xA9, 0x95, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB5, 0xE5, 0x45, 0xB0, 0xB5, 0xB8,
     0xBD, 0xBE, 0xBD, 0xB5, 0xFF, 0xE2, 0xFF, 0xEB, 0xA8, 0xCD, 0xFF, 0xF9, 0xC3, 0x01, 0xB1, 0xD0,
     0xD1, 0x2D, 0xFF, 0xF0, 0xB9, 0x59, 0xA8, 0xA2, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
-    0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFC, 0xD2, 0xFD, 0x12, 0xFD, 0x22, 0xFD,
-    0x35, 0xFD, 0x4B, 0xFD, 0xA8, 0xB8, 0x53, 0xAF, 0x3C, 0xFD, 0xC8, 0xFE, 0x4A, 0xFE, 0xDC, 0xFE,
-    0xFA, 0xFF, 0x37, 0xFF, 0xA3, 0xFF, 0xF4, 0xAC, 0xA5, 0x42, 0x81, 0x82, 0xA8, 0xB6, 0xA8, 0xAA,
+    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFC, 0xD2, 0xFD, 0x12, 0xFD, 0x22, 0xFD,
+    0x35, 0xFD, 0x4B, 0xFD, 0xA8, 0xB8, 0x53, 0xAF, 0x3C, 0xFD, 0xC8, 0xAC, 0xA5, 0xFE, 0x4A, 0xFE,
+    0xDC, 0xFE, 0xFA, 0xFF, 0x37, 0xFF, 0xA3, 0xFF, 0xF4, 0x42, 0x81, 0x82, 0xA8, 0xB6, 0xA8, 0xAA,
     0x42, 0xD0, 0xD1, 0xB5, 0x49, 0xFF, 0xF9, 0x42, 0xB1, 0xB4, 0xB2, 0x49, 0xC7, 0x47, 0x21, 0xD0,
     0xF9, 0x22, 0xB0, 0xB5, 0xEF, 0xFD, 0xC3, 0x02, 0xB1, 0x2E, 0xD0, 0x2D, 0xA9, 0x1D, 0xFF, 0xFB,
     0xA8, 0x48, 0xA0, 0x0A, 0x82, 0xC1, 0x00, 0xA1, 0xD0, 0xA8, 0xC0, 0x41, 0x80, 0xA8, 0xE8, 0x21,
@@ -1564,9 +1564,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xC1, 0xA4, 0xF4, 0x41, 0x82, 0xDA, 0x1C, 0xC3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0xAA, 0x60, 0xFF,
     0xFC, 0xA4, 0xE7, 0x41, 0xBA, 0xF4, 0xB0, 0x41, 0xD1, 0xBF, 0xC0, 0x21, 0x81, 0xFC, 0xC3, 0x03,
     0xE2, 0xD0, 0xD1, 0x2D, 0xFF, 0xF5, 0xFF, 0xFD, 0xA4, 0xD0, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84,
-    0x85, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x89, 0xFC, 0x7C, 0xFC, 0xBB,
-    0xFE, 0x7E, 0xFE, 0xD9, 0xFE, 0xE9, 0xFE, 0xF0, 0xFF, 0x10, 0xFF, 0x4B, 0xFF, 0x57, 0xFF, 0x6D,
-    0xFF, 0x92, 0xFF, 0xB5, 0xFF, 0xC9, 0xFF, 0xD0, 0xFF, 0xDD, 0xFF, 0xF4, 0xA8, 0xD3, 0x42, 0xD0,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xFC, 0x7C, 0xFC, 0xBB,
+    0xFE, 0x7E, 0xFE, 0xD9, 0xFE, 0xE9, 0xFE, 0xF0, 0xFF, 0x10, 0xFF, 0x4B, 0xFF, 0x57, 0xA8, 0xD3,
+    0xFF, 0x6D, 0xFF, 0x92, 0xFF, 0xB5, 0xFF, 0xC9, 0xFF, 0xD0, 0xFF, 0xDD, 0xFF, 0xF4, 0x42, 0xD0,
     0xD1, 0xFB, 0xFA, 0xFF, 0xCC, 0x42, 0xD0, 0xD1, 0xA8, 0xE9, 0xAD, 0xB1, 0x41, 0x80, 0xA4, 0xB6,
     0x21, 0xD1, 0xFC, 0xC1, 0x02, 0xB1, 0xD0, 0xA9, 0x76, 0x41, 0xBB, 0xB2, 0x3C, 0x21, 0xD0, 0xFC,
     0x47, 0xB1, 0xB2, 0xB3, 0xB7, 0xBA, 0xBD, 0xBF, 0xFF, 0xE5, 0xFF, 0xF0, 0xFF, 0xF3, 0xA7, 0xBA,
@@ -1608,9 +1608,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x07, 0xA2, 0x7A, 0x21, 0xD0, 0xF9, 0x44, 0x80, 0x81, 0x82, 0x89, 0xFF, 0xE1, 0xFF, 0xF1, 0xFF,
     0xFD, 0xA4, 0x42, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAD, 0xFF, 0xF3, 0xA2, 0x1B, 0x41, 0xB0, 0xBA,
     0x4D, 0xC2, 0x05, 0x22, 0xD0, 0x2D, 0xFF, 0xFC, 0xA2, 0x0D, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
-    0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFD, 0xBC, 0xB5, 0xCC, 0xFE,
-    0x11, 0xA9, 0xC6, 0xA9, 0x37, 0xFE, 0xA2, 0xA9, 0xC6, 0xA9, 0x37, 0xFF, 0x08, 0xFF, 0x30, 0xFF,
-    0x43, 0xFF, 0x62, 0xA9, 0x37, 0xFF, 0xE9, 0xFF, 0xF7, 0xA6, 0x13, 0x42, 0xB3, 0xB6, 0xC5, 0x70,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0xBC, 0xB5, 0xCC, 0xFE,
+    0x11, 0xA9, 0xC6, 0xA9, 0x37, 0xFE, 0xA2, 0xA9, 0xC6, 0xA9, 0x37, 0xFF, 0x08, 0xA6, 0x13, 0xFF,
+    0x30, 0xFF, 0x43, 0xFF, 0x62, 0xA9, 0x37, 0xFF, 0xE9, 0xFF, 0xF7, 0x42, 0xB3, 0xB6, 0xC5, 0x70,
     0xAB, 0x58, 0x21, 0xD0, 0xF9, 0xC1, 0x02, 0x21, 0xD0, 0xB5, 0xBE, 0x42, 0x83, 0x8C, 0xA3, 0xDD,
     0xA2, 0x08, 0x42, 0xD0, 0xD1, 0xB0, 0xE6, 0xFF, 0xF9, 0x42, 0x88, 0x91, 0xA1, 0xFA, 0xA1, 0xFA,
     0x42, 0xD0, 0xD1, 0xA6, 0xCE, 0xFF, 0xF9, 0x42, 0xB0, 0xBD, 0xA1, 0xEC, 0xA1, 0xEC, 0x21, 0xD0,
@@ -1688,9 +1688,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x7F, 0xFF, 0xF3, 0x7F, 0x9D, 0x37, 0xC1, 0x00, 0xA1, 0xD1, 0xE1, 0x8D, 0x21, 0xBB, 0xFA, 0x61,
     0xBE, 0x7F, 0x9D, 0x3A, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
     0xF2, 0x7F, 0xFF, 0xFD, 0x7F, 0x9D, 0x14, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
-    0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0xFE, 0x15, 0xFE, 0x4C, 0xFE, 0x6A, 0xFE, 0xA9,
-    0xFE, 0xDC, 0xFF, 0x09, 0xFF, 0x1D, 0xFF, 0x37, 0xA3, 0xAD, 0xFF, 0x5B, 0xFF, 0x86, 0xFF, 0x93,
-    0xFF, 0xA1, 0xFF, 0xD0, 0xFF, 0xF3, 0xA1, 0x16, 0x41, 0x80, 0xB4, 0x0C, 0x21, 0xD1, 0xFC, 0x21,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFE, 0x15, 0xFE, 0x4C, 0xFE, 0x6A, 0xFE, 0xA9,
+    0xFE, 0xDC, 0xFF, 0x09, 0xFF, 0x1D, 0xFF, 0x37, 0xA3, 0xAD, 0xA1, 0x16, 0xFF, 0x5B, 0xFF, 0x86,
+    0xFF, 0x93, 0xFF, 0xA1, 0xFF, 0xD0, 0xFF, 0xF3, 0x41, 0x80, 0xB4, 0x0C, 0x21, 0xD1, 0xFC, 0x21,
     0x82, 0xFD, 0xA1, 0x00, 0x91, 0xD1, 0xFD, 0x41, 0xB5, 0xA8, 0xDE, 0x21, 0xD0, 0xFC, 0xC1, 0x00,
     0xA1, 0xD0, 0xBF, 0xAE, 0x21, 0xB4, 0xFA, 0xA1, 0x00, 0x91, 0xD0, 0xFD, 0x65, 0xB0, 0xB5, 0xB8,
     0xBA, 0xBE, 0x7F, 0x9C, 0xF7, 0x7F, 0xFF, 0xE6, 0x7F, 0x9C, 0xF7, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF,
@@ -1721,11 +1721,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xD1, 0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0xFF, 0xF3, 0x7F, 0x9B, 0x20, 0xE1, 0x00, 0xA1, 0xD0, 0x7F,
     0x9B, 0x8A, 0x64, 0xB5, 0xB8, 0xBB, 0xBF, 0x7F, 0x9B, 0x27, 0x7F, 0x9B, 0x27, 0x7F, 0xFF, 0xF9,
     0x7F, 0x9B, 0x6B, 0x61, 0x91, 0x7F, 0x9B, 0x16, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEA, 0x7F,
-    0xFF, 0xFB, 0x7F, 0x9A, 0xF6, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87, 0x88, 0x8D, 0x8F,
-    0x91, 0x86, 0x89, 0x8A, 0x8B, 0x8C, 0x8E, 0x7F, 0xFE, 0x65, 0x7F, 0xFE, 0xF3, 0x7F, 0xFF, 0x4E,
-    0x7F, 0xFF, 0x60, 0x7F, 0xFF, 0x78, 0x7F, 0xFF, 0xAB, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xF3, 0x7F,
-    0xA2, 0xAB, 0x7F, 0xBB, 0x96, 0x7F, 0xA1, 0x8F, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E,
-    0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x42, 0xD0, 0xD1, 0xFD, 0x9D, 0xFF,
+    0xFF, 0xFB, 0x7F, 0x9A, 0xF6, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0xFE, 0x65, 0x7F, 0xFE, 0xF3, 0x7F, 0xFF, 0x4E,
+    0x7F, 0xFF, 0x60, 0x7F, 0xFF, 0x78, 0x7F, 0xFF, 0xAB, 0x7F, 0x9E, 0xF8, 0x7F, 0xFF, 0xC9, 0x7F,
+    0xFF, 0xF3, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0x9E, 0xF8, 0x7F, 0xA2,
+    0xAB, 0x7F, 0x9E, 0xF8, 0x7F, 0xBB, 0x96, 0x7F, 0xA1, 0x8F, 0x42, 0xD0, 0xD1, 0xFD, 0x9D, 0xFF,
     0xBB, 0xC1, 0x01, 0xE1, 0xD1, 0xAD, 0xEA, 0x21, 0xB4, 0xFA, 0x21, 0xD0, 0xFD, 0x64, 0xB1, 0xB3,
     0xB7, 0xBD, 0x7F, 0x9C, 0x4B, 0x7F, 0xAD, 0xC3, 0x7F, 0x9F, 0x99, 0x7F, 0xFF, 0xFD, 0x64, 0x82,
     0x85, 0x88, 0x8D, 0x7F, 0x9C, 0x37, 0x7F, 0x9A, 0x75, 0x7F, 0xA1, 0xCC, 0x7F, 0x9A, 0xDC, 0x63,
@@ -1739,11 +1739,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x82, 0x83, 0x7F, 0xA5, 0xE2, 0x7F, 0x9A, 0x2D, 0x42, 0xD0, 0xD1, 0xCE, 0x6E, 0xFF, 0xF7, 0x41,
     0xBF, 0xA6, 0x06, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0xA1, 0x03, 0x91, 0xD0, 0xFD, 0x43, 0x80,
     0x81, 0x82, 0xFF, 0xEA, 0xC3, 0x43, 0xFF, 0xFB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD0, 0x7F,
-    0xFF, 0xF6, 0x7F, 0x99, 0xD6, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB8, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xB6, 0xB7, 0xB9, 0xBF, 0x7F, 0xFF, 0x5A, 0x7F, 0xA0, 0xFC, 0x7F, 0xA0, 0xFC, 0x7F,
-    0xA1, 0x8B, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF, 0x74, 0x7F, 0xFF, 0x9A, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF,
-    0xB6, 0x7F, 0xA1, 0x8B, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF, 0xF3, 0x7F, 0x9D, 0xD8, 0x7F, 0x9D, 0xD8,
-    0x7F, 0x9D, 0xD8, 0x7F, 0x9D, 0xD8, 0x62, 0xB1, 0xB7, 0x7F, 0x99, 0xCD, 0x7F, 0x99, 0xE4, 0x62,
+    0xFF, 0xF6, 0x7F, 0x99, 0xD6, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0xFF, 0x5A, 0x7F, 0xA0, 0xFC, 0x7F, 0xA0, 0xFC, 0x7F,
+    0xA1, 0x8B, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF, 0x74, 0x7F, 0x9D, 0xD8, 0x7F, 0x9D, 0xD8, 0x7F, 0xFF,
+    0x9A, 0x7F, 0x9D, 0xD8, 0x7F, 0xA0, 0xFC, 0x7F, 0xFF, 0xB6, 0x7F, 0xA1, 0x8B, 0x7F, 0xA0, 0xFC,
+    0x7F, 0xFF, 0xF3, 0x7F, 0x9D, 0xD8, 0x62, 0xB1, 0xB7, 0x7F, 0x99, 0xCD, 0x7F, 0x99, 0xE4, 0x62,
     0x81, 0x82, 0x7F, 0x99, 0xDB, 0x7F, 0x99, 0xC4, 0x22, 0xD0, 0xD1, 0xEE, 0xF7, 0x62, 0xD0, 0xD1,
     0x7F, 0x9A, 0xBC, 0x7F, 0xB2, 0xBF, 0x62, 0xB6, 0xB7, 0x7F, 0x99, 0xC7, 0x7F, 0x99, 0xC7, 0xA1,
     0x00, 0x91, 0xD0, 0xF7, 0xE1, 0x00, 0x91, 0xD0, 0x7F, 0x9A, 0xA5, 0x24, 0xB0, 0xB5, 0xB8, 0xBE,
@@ -1752,10 +1752,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x32, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x99, 0x30, 0x41, 0xBF, 0xAE, 0x7F, 0x62, 0x82, 0x84,
     0x7F, 0xAD, 0x2E, 0x7F, 0x99, 0xF6, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xFF, 0xF7,
     0x7F, 0x99, 0x18, 0x62, 0x2E, 0x2D, 0x7F, 0x99, 0xE0, 0x7F, 0x99, 0x0B, 0x71, 0x80, 0x81, 0x82,
-    0x83, 0x84, 0x87, 0x88, 0x8C, 0x8E, 0x8A, 0x91, 0x85, 0x86, 0x89, 0x8B, 0x8D, 0x8F, 0x7F, 0xFF,
-    0xB8, 0x7F, 0xA1, 0x22, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xEA, 0x7F, 0xA0, 0xC4, 0x7F, 0xA0, 0x35,
-    0x7F, 0xA4, 0x74, 0x7F, 0xFF, 0xF7, 0x7F, 0xE4, 0x8F, 0x7F, 0xA3, 0xD8, 0x7F, 0x9D, 0x11, 0x7F,
-    0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D, 0x11, 0x7F, 0x9D,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0xFF,
+    0xB8, 0x7F, 0xA1, 0x22, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xEA, 0x7F, 0xA0, 0xC4, 0x7F, 0x9D, 0x11,
+    0x7F, 0x9D, 0x11, 0x7F, 0xA0, 0x35, 0x7F, 0xA4, 0x74, 0x7F, 0x9D, 0x11, 0x7F, 0xA3, 0xD8, 0x7F,
+    0x9D, 0x11, 0x7F, 0xFF, 0xF7, 0x7F, 0x9D, 0x11, 0x7F, 0xE4, 0x8F, 0x7F, 0x9D, 0x11, 0x7F, 0x9D,
     0x11, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFE, 0xF4, 0xFF, 0xBB, 0x65, 0xB1, 0xB4, 0xBA, 0xBD, 0xBE,
     0x7F, 0x9D, 0x18, 0x7F, 0x98, 0xA9, 0x7F, 0xA2, 0x39, 0x7F, 0x99, 0xC4, 0x7F, 0x98, 0xC0, 0x61,
     0x88, 0x7F, 0x98, 0xE4, 0x21, 0xD1, 0xFB, 0x21, 0x80, 0xFD, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D,
@@ -1776,11 +1776,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x0C, 0xFF, 0xFB, 0x62, 0xBC, 0xBD, 0x7F, 0x97, 0xF0, 0x7F, 0xA1, 0x30, 0x21, 0xD0, 0xF7, 0x65,
     0x80, 0x81, 0x84, 0x85, 0x8F, 0x7F, 0xA0, 0xAD, 0x7F, 0xFF, 0xFD, 0x7F, 0x97, 0xF0, 0x7F, 0x9C,
     0x1E, 0x7F, 0x97, 0xF0, 0xE3, 0x02, 0xB1, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xD8, 0x7F, 0xFF, 0xEB,
-    0x7F, 0x97, 0x8A, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD,
-    0xBE, 0xBF, 0xB6, 0xB9, 0x7F, 0xFE, 0xE7, 0x7F, 0x9E, 0xAE, 0x7F, 0xFF, 0x06, 0x7F, 0x9F, 0x3D,
-    0x7F, 0xBB, 0xA3, 0x7F, 0xFF, 0x15, 0x7F, 0x9F, 0x43, 0x7F, 0xFF, 0x34, 0x7F, 0x9F, 0x43, 0x7F,
-    0xFF, 0x92, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xF1, 0x7F, 0x9E, 0xC1, 0x7F, 0x9B,
-    0x8A, 0x7F, 0x9B, 0x8A, 0x62, 0xB7, 0xBD, 0x7F, 0x97, 0x7F, 0x7F, 0x99, 0x54, 0xA0, 0x0B, 0xC3,
+    0x7F, 0x97, 0x8A, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0xFE, 0xE7, 0x7F, 0x9E, 0xAE, 0x7F, 0xFF, 0x06, 0x7F, 0x9F, 0x3D,
+    0x7F, 0xBB, 0xA3, 0x7F, 0xFF, 0x15, 0x7F, 0x9B, 0x8A, 0x7F, 0x9F, 0x43, 0x7F, 0xFF, 0x34, 0x7F,
+    0x9B, 0x8A, 0x7F, 0x9F, 0x43, 0x7F, 0xFF, 0x92, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF,
+    0xF1, 0x7F, 0x9E, 0xC1, 0x62, 0xB7, 0xBD, 0x7F, 0x97, 0x7F, 0x7F, 0x99, 0x54, 0xA0, 0x0B, 0xC3,
     0x21, 0x81, 0xFD, 0x22, 0xD0, 0xD1, 0xF1, 0xFD, 0x61, 0xB9, 0x7F, 0x97, 0x6B, 0x21, 0xD0, 0xFB,
     0x41, 0xBF, 0xBA, 0x10, 0x42, 0xD0, 0xD1, 0xFF, 0xFC, 0xA4, 0x46, 0x61, 0x87, 0x7F, 0x97, 0x64,
     0xA1, 0x02, 0xB1, 0xD1, 0xFB, 0x62, 0xB2, 0xBC, 0x7F, 0x97, 0x4E, 0x7F, 0xFF, 0xFB, 0x21, 0xD0,
@@ -1791,10 +1791,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x8F, 0x7F, 0xFF, 0xF6, 0x7F, 0x98, 0xDD, 0x7F, 0x98, 0xDD, 0x7F, 0x97, 0x98, 0x7F, 0xFF, 0xFC,
     0x64, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0x98, 0xC8, 0x7F, 0xFF, 0xD0, 0x7F, 0xFF, 0xEB, 0x7F, 0x96,
     0xAE, 0x61, 0x8E, 0x7F, 0x96, 0xF9, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x96, 0x98, 0x71,
-    0x80, 0x81, 0x82, 0x83, 0x85, 0x87, 0x88, 0x8C, 0x8A, 0x91, 0x84, 0x86, 0x89, 0x8B, 0x8D, 0x8E,
-    0x8F, 0x7F, 0xFF, 0xA4, 0x7F, 0xAA, 0x57, 0x7F, 0x9D, 0xC2, 0x7F, 0xFF, 0xE1, 0x7F, 0x9E, 0x57,
-    0x7F, 0xAA, 0x57, 0x7F, 0x9E, 0x51, 0x7F, 0xFF, 0xF7, 0x7F, 0xA1, 0x65, 0x7F, 0x9A, 0x9E, 0x7F,
-    0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x91, 0x7F, 0xFF, 0xA4, 0x7F, 0xAA, 0x57, 0x7F, 0x9D, 0xC2, 0x7F, 0xFF, 0xE1, 0x7F, 0x9A, 0x9E,
+    0x7F, 0x9E, 0x57, 0x7F, 0x9A, 0x9E, 0x7F, 0xAA, 0x57, 0x7F, 0x9E, 0x51, 0x7F, 0x9A, 0x9E, 0x7F,
+    0xA1, 0x65, 0x7F, 0x9A, 0x9E, 0x7F, 0xFF, 0xF7, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A, 0x9E, 0x7F, 0x9A,
     0x9E, 0x7F, 0x9A, 0x9E, 0x42, 0xD0, 0xD1, 0xFE, 0xCF, 0xFF, 0xBB, 0x62, 0xBC, 0xBF, 0x7F, 0x9D,
     0x8F, 0x7F, 0x9A, 0xA7, 0x61, 0x85, 0x7F, 0x9D, 0x86, 0xE4, 0x01, 0x31, 0x2E, 0xD0, 0xD1, 0x2D,
     0x7F, 0x9D, 0x81, 0x7F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFB, 0x7F, 0x96, 0x35, 0x62, 0x8B, 0x91, 0x7F,
@@ -1806,16 +1806,16 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x3B, 0x7F, 0x96, 0x28, 0x63, 0x81, 0x83, 0x84, 0x7F, 0x9A, 0x21, 0x7F, 0x95, 0xD6, 0x7F, 0x9B,
     0xD6, 0xE3, 0x01, 0x31, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF3, 0x7F, 0x95, 0xBD,
     0x42, 0xB1, 0xB4, 0xAB, 0xA4, 0xAB, 0x08, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF9, 0x7F, 0xD1,
-    0xA5, 0x7F, 0x95, 0xA7, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xB6, 0xB9, 0x7F, 0xFF, 0x65, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0x81, 0x7F, 0x9D,
-    0x5C, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xB0, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xDD, 0x7F, 0xA9, 0x62,
-    0x7F, 0x9C, 0xCD, 0x7F, 0x9D, 0x5C, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xF3, 0x7F, 0xA1, 0x0C, 0x7F,
-    0x99, 0xA9, 0x7F, 0x99, 0xA9, 0xE1, 0x03, 0x91, 0x2D, 0x7F, 0x95, 0x59, 0xC1, 0x01, 0xB1, 0xD0,
+    0xA5, 0x7F, 0x95, 0xA7, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0xFF, 0x65, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0x81, 0x7F, 0x9D,
+    0x5C, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xB0, 0x7F, 0x99, 0xA9, 0x7F, 0x9C, 0xCD, 0x7F, 0xFF, 0xDD,
+    0x7F, 0x99, 0xA9, 0x7F, 0xA9, 0x62, 0x7F, 0x9C, 0xCD, 0x7F, 0x9D, 0x5C, 0x7F, 0x9C, 0xCD, 0x7F,
+    0xFF, 0xF3, 0x7F, 0xA1, 0x0C, 0xE1, 0x03, 0x91, 0x2D, 0x7F, 0x95, 0x59, 0xC1, 0x01, 0xB1, 0xD0,
     0xCC, 0x05, 0x21, 0xBF, 0xFA, 0xE2, 0x03, 0x91, 0xD0, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x95, 0x49,
-    0x71, 0x80, 0x81, 0x82, 0x83, 0x86, 0x88, 0x8B, 0x8E, 0x8A, 0x91, 0x84, 0x85, 0x87, 0x89, 0x8C,
-    0x8D, 0x8F, 0x7F, 0x9C, 0x71, 0x7F, 0x9C, 0x71, 0x7F, 0x9C, 0x71, 0x7F, 0xFF, 0xE5, 0x7F, 0x9D,
-    0x00, 0x7F, 0xAA, 0x50, 0x7F, 0xFF, 0xF5, 0x7F, 0xC2, 0xF6, 0x7F, 0xA0, 0x14, 0x7F, 0x99, 0x4D,
-    0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F,
+    0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E,
+    0x8F, 0x91, 0x7F, 0x9C, 0x71, 0x7F, 0x9C, 0x71, 0x7F, 0x9C, 0x71, 0x7F, 0xFF, 0xE5, 0x7F, 0x99,
+    0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0x9D, 0x00, 0x7F, 0x99, 0x4D, 0x7F, 0xAA, 0x50, 0x7F, 0x99, 0x4D,
+    0x7F, 0xA0, 0x14, 0x7F, 0xFF, 0xF5, 0x7F, 0x99, 0x4D, 0x7F, 0x99, 0x4D, 0x7F, 0xC2, 0xF6, 0x7F,
     0x99, 0x4D, 0x7F, 0x99, 0x4D, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x5F, 0xFF, 0xBB, 0x61, 0xD1,
     0x7F, 0x94, 0xEB, 0x62, 0xD0, 0xD1, 0x7F, 0x96, 0x56, 0x7F, 0xAB, 0x33, 0x21, 0xB2, 0xF7, 0x62,
     0xD0, 0xD1, 0x7F, 0xFF, 0xFD, 0x7F, 0x98, 0x43, 0x22, 0xB4, 0xB5, 0xE6, 0xF7, 0x62, 0xB2, 0xB5,
@@ -1830,20 +1830,20 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xD0, 0xF7, 0xE1, 0x02, 0x21, 0x2E, 0x7F, 0x94, 0xAB, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x9C,
     0x81, 0x7F, 0xFF, 0xF4, 0x7F, 0xFF, 0xF9, 0x7F, 0x9C, 0x81, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xEF,
     0x7F, 0x94, 0x34, 0x63, 0xB0, 0xB5, 0xBE, 0x7F, 0x95, 0x00, 0x7F, 0x95, 0x00, 0x7F, 0x94, 0x8A,
-    0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0x1E, 0x70, 0xB0, 0xB1, 0xB2, 0xB4,
-    0xB5, 0xB6, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB3, 0xB7, 0xB9, 0xBF, 0x7F, 0xFF, 0x66, 0x7F,
-    0x9B, 0x46, 0x7F, 0x9A, 0xB9, 0x7F, 0x9B, 0x46, 0x7F, 0xFF, 0x8B, 0x7F, 0xFF, 0x9A, 0x7F, 0xFF,
-    0xAA, 0x7F, 0x9B, 0x46, 0x7F, 0xFF, 0xDF, 0x7F, 0xFF, 0xF5, 0x7F, 0x9B, 0x46, 0x7F, 0xFE, 0xBA,
-    0x7F, 0x98, 0x22, 0x7F, 0x98, 0x22, 0x7F, 0x98, 0x22, 0x7F, 0x98, 0x22, 0x63, 0xB0, 0xB5, 0xBC,
+    0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0x1E, 0x70, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0xFF, 0x66, 0x7F,
+    0x9B, 0x46, 0x7F, 0x9A, 0xB9, 0x7F, 0x98, 0x22, 0x7F, 0x9B, 0x46, 0x7F, 0xFF, 0x8B, 0x7F, 0xFF,
+    0x9A, 0x7F, 0x98, 0x22, 0x7F, 0xFF, 0xAA, 0x7F, 0x98, 0x22, 0x7F, 0x9B, 0x46, 0x7F, 0xFF, 0xDF,
+    0x7F, 0xFF, 0xF5, 0x7F, 0x9B, 0x46, 0x7F, 0xFE, 0xBA, 0x7F, 0x98, 0x22, 0x63, 0xB0, 0xB5, 0xBC,
     0x7F, 0x9D, 0x57, 0x7F, 0x94, 0x31, 0x7F, 0x94, 0xA7, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3,
     0x7F, 0x94, 0xBF, 0x7F, 0x93, 0xC5, 0xE2, 0x02, 0xB1, 0xD0, 0x2D, 0x7F, 0xDC, 0x05, 0x7F, 0x93,
     0xB8, 0x64, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0x94, 0x82, 0x7F, 0xBA, 0xC2, 0x7F, 0xA3, 0x47, 0x7F,
     0x93, 0xAD, 0x41, 0x80, 0xF0, 0xF0, 0xE2, 0x02, 0xB1, 0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x93,
-    0x98, 0x71, 0x81, 0x82, 0x83, 0x85, 0x87, 0x8C, 0x91, 0x8A, 0x80, 0x84, 0x86, 0x88, 0x89, 0x8B,
-    0x8D, 0x8E, 0x8F, 0x7F, 0x9A, 0xC0, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xD5, 0x7F, 0xC5, 0x6B, 0x7F,
-    0x9A, 0xC0, 0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0xF5, 0x7F, 0x9E, 0x63, 0x7F, 0x97, 0x9C, 0x7F, 0x97,
-    0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C,
-    0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C, 0x42, 0xD0, 0xD1, 0xFF, 0x35, 0xFF, 0xBB, 0x62, 0xD0, 0xD1,
+    0x98, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0x7F, 0x97, 0x9C, 0x7F, 0x9A, 0xC0, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xD5, 0x7F,
+    0x97, 0x9C, 0x7F, 0xC5, 0x6B, 0x7F, 0x97, 0x9C, 0x7F, 0x9A, 0xC0, 0x7F, 0x97, 0x9C, 0x7F, 0x97,
+    0x9C, 0x7F, 0x9E, 0x63, 0x7F, 0x97, 0x9C, 0x7F, 0xFF, 0xE0, 0x7F, 0x97, 0x9C, 0x7F, 0x97, 0x9C,
+    0x7F, 0x97, 0x9C, 0x7F, 0xFF, 0xF5, 0x42, 0xD0, 0xD1, 0xFF, 0x35, 0xFF, 0xBB, 0x62, 0xD0, 0xD1,
     0x7F, 0x98, 0x3C, 0x7F, 0x94, 0xFE, 0x61, 0xBA, 0x7F, 0x9C, 0x6D, 0x21, 0xD0, 0xFB, 0x64, 0xB1,
     0xB3, 0xB4, 0xBD, 0x7F, 0x97, 0x94, 0x7F, 0xFF, 0xEF, 0x7F, 0x97, 0xD5, 0x7F, 0xFF, 0xFD, 0x63,
     0x80, 0x81, 0x82, 0x7F, 0x96, 0xFE, 0x7F, 0xB1, 0x6B, 0x7F, 0xDA, 0xB6, 0x63, 0xD0, 0xD1, 0x2D,
@@ -1865,45 +1865,45 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x8B, 0xFA, 0xE2, 0x02, 0x21, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x92, 0x1C, 0x41, 0xB8, 0xB3,
     0x3F, 0x41, 0x83, 0xF8, 0xD0, 0xE3, 0x03, 0x32, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF8, 0x7F, 0xFF,
     0xFC, 0x7F, 0x92, 0x09, 0xE2, 0x02, 0x42, 0xD1, 0x2D, 0x7F, 0xD5, 0x1A, 0x7F, 0x91, 0xFA, 0x70,
-    0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB3, 0xB4, 0xB6, 0xB7, 0xB9, 0xBE,
-    0x7F, 0xFE, 0xDD, 0x7F, 0x99, 0x22, 0x7F, 0xFE, 0xEE, 0x7F, 0xFF, 0x0A, 0x7F, 0xFF, 0x25, 0x7F,
-    0xFF, 0x36, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF5, 0x7F, 0x95,
-    0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x7F, 0xFE, 0xDD, 0x7F, 0x99, 0x22, 0x7F, 0xFE, 0xEE, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F,
+    0xFF, 0x0A, 0x7F, 0x95, 0xFE, 0x7F, 0x95, 0xFE, 0x7F, 0xFF, 0x25, 0x7F, 0x95, 0xFE, 0x7F, 0xFF,
+    0x36, 0x7F, 0xFF, 0xBD, 0x7F, 0xFF, 0xD3, 0x7F, 0xFF, 0xE6, 0x7F, 0x95, 0xFE, 0x7F, 0xFF, 0xF5,
     0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x93, 0x81, 0x7F, 0x93, 0xDA, 0x7F, 0x91, 0xAE, 0x61, 0xB5, 0x7F,
     0x98, 0x8C, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0xC9, 0xEF, 0x7F, 0x91, 0x9C, 0x62,
     0xB5, 0xB8, 0x7F, 0x98, 0xDB, 0x7F, 0x98, 0xDB, 0x63, 0x8E, 0x8F, 0x91, 0x7F, 0x98, 0xD2, 0x7F,
     0x98, 0xD2, 0x7F, 0x98, 0xD2, 0xE4, 0x02, 0x21, 0x2E, 0xD0, 0xD1, 0x2D, 0x7F, 0xB2, 0xA7, 0x7F,
     0xFF, 0xEA, 0x7F, 0xFF, 0xF3, 0x7F, 0x91, 0x79, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86,
-    0x87, 0x8C, 0x8E, 0x8A, 0x91, 0x88, 0x89, 0x8B, 0x8D, 0x8F, 0x7F, 0x98, 0x99, 0x7F, 0x98, 0x99,
+    0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0x98, 0x99, 0x7F, 0x98, 0x99,
     0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xCA, 0x7F, 0x99, 0x28, 0x7F, 0x98, 0x0C, 0x7F, 0x99, 0x28, 0x7F,
-    0x98, 0x99, 0x7F, 0xFF, 0xED, 0x7F, 0xDC, 0xF3, 0x7F, 0x9C, 0x3C, 0x7F, 0x95, 0x75, 0x7F, 0x95,
-    0x75, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0xC2, 0x02, 0xB1,
+    0x98, 0x99, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0x7F, 0x9C, 0x3C, 0x7F, 0x95, 0x75, 0x7F, 0xFF,
+    0xED, 0x7F, 0x95, 0x75, 0x7F, 0xDC, 0xF3, 0x7F, 0x95, 0x75, 0x7F, 0x95, 0x75, 0xC2, 0x02, 0xB1,
     0xD0, 0xD1, 0xFF, 0x32, 0xFF, 0xBB, 0x64, 0xB1, 0xB3, 0xB4, 0xB8, 0x7F, 0xCD, 0x3A, 0x7F, 0x95,
     0x7C, 0x7F, 0x97, 0x24, 0x7F, 0xED, 0xC9, 0x63, 0x81, 0x85, 0x88, 0x7F, 0x91, 0x35, 0x7F, 0x91,
     0x35, 0x7F, 0x9E, 0x81, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xF3, 0x7F, 0x90,
-    0xFA, 0x41, 0xBF, 0xC3, 0xED, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x90, 0xE9, 0x70, 0xB2,
-    0xB5, 0xB8, 0xBC, 0xBD, 0xB0, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xB9, 0xBA, 0xBB, 0xBE, 0xBF, 0x7F,
-    0xA5, 0xF2, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x7F, 0x98, 0xA2, 0x7F, 0x98, 0x13, 0x7F, 0x94,
-    0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF,
-    0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x71,
-    0x80, 0x8C, 0x8A, 0x91, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8B, 0x8D, 0x8E,
-    0x8F, 0x7F, 0x97, 0xD2, 0x7F, 0xF7, 0x94, 0x7F, 0x9B, 0x75, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE,
+    0xFA, 0x41, 0xBF, 0xC3, 0xED, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x90, 0xE9, 0x70, 0xB0,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F,
+    0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0xA5, 0xF2, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0xFF,
+    0xE6, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x7F, 0xFF, 0xF7, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF,
+    0x7F, 0x94, 0xEF, 0x7F, 0x98, 0xA2, 0x7F, 0x98, 0x13, 0x7F, 0x94, 0xEF, 0x7F, 0x94, 0xEF, 0x71,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x91, 0x7F, 0x97, 0xD2, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE,
     0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F,
-    0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94,
+    0x9B, 0x75, 0x7F, 0x94, 0xAE, 0x7F, 0xF7, 0x94, 0x7F, 0x94, 0xAE, 0x7F, 0x94, 0xAE, 0x7F, 0x94,
     0xAE, 0x7F, 0x94, 0xAE, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x7A, 0xFF, 0xBB, 0x63, 0xB3, 0xB4,
     0xBB, 0x7F, 0x90, 0x46, 0x7F, 0x96, 0x45, 0x7F, 0x90, 0x46, 0xA0, 0x02, 0x42, 0x63, 0x80, 0x81,
     0x85, 0x7F, 0xFF, 0xFD, 0x7F, 0x90, 0x36, 0x7F, 0x91, 0x4A, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
-    0xE3, 0x7F, 0xFF, 0xF3, 0x7F, 0x90, 0x34, 0x70, 0xB5, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7,
-    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0x36, 0x7F, 0x94,
-    0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36,
+    0xE3, 0x7F, 0xFF, 0xF3, 0x7F, 0x90, 0x34, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94,
+    0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0xFF, 0xF3, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36,
     0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F,
     0x94, 0x36, 0x7F, 0x94, 0x36, 0x7F, 0x94, 0x36, 0xE2, 0x01, 0xB1, 0xD0, 0x2D, 0x7F, 0x9F, 0x37,
     0x7F, 0x8F, 0xE6, 0x21, 0x80, 0x97, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x8F, 0xD8, 0x71,
-    0x8E, 0x8F, 0x91, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
-    0x8D, 0x7F, 0x97, 0x15, 0x7F, 0xFF, 0xE9, 0x7F, 0xFF, 0xF7, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x91, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE,
     0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F,
-    0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93,
-    0xDE, 0x7F, 0x93, 0xDE, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFF, 0x63, 0xFF, 0xBB, 0x64, 0xB0, 0xB8,
+    0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x93, 0xDE, 0x7F, 0x97, 0x15, 0x7F, 0xFF,
+    0xE9, 0x7F, 0xFF, 0xF7, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFF, 0x63, 0xFF, 0xBB, 0x64, 0xB0, 0xB8,
     0xBB, 0xBD, 0x7F, 0x8F, 0x9C, 0x7F, 0x8F, 0x9C, 0x7F, 0x8F, 0x76, 0x7F, 0x8F, 0xE0, 0x62, 0xD0,
     0x2D, 0x7F, 0xFF, 0xEF, 0x7F, 0x8F, 0x70, 0x62, 0xB5, 0xBE, 0x7F, 0x8F, 0x5C, 0x7F, 0x90, 0x80,
     0x42, 0xD0, 0xD1, 0xFF, 0xF7, 0xCA, 0x32, 0x21, 0x80, 0xF9, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x95,
@@ -1914,10 +1914,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0x97, 0xDC, 0x7F, 0x8F, 0x0F, 0x61, 0xBB, 0x7F, 0x9B,
     0x19, 0x21, 0xD0, 0xFB, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x62, 0xD0, 0x2D,
     0x7F, 0xFF, 0xFD, 0x7F, 0x8E, 0xF1, 0x62, 0xD0, 0x2D, 0x7F, 0xF1, 0xC9, 0x7F, 0x8E, 0xE8, 0x70,
-    0xB1, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB0, 0xB2, 0xB9, 0xBE,
-    0x7F, 0x95, 0x4E, 0x7F, 0xFF, 0x6F, 0x7F, 0xFF, 0x8B, 0x7F, 0x96, 0x25, 0x7F, 0xB7, 0xB2, 0x7F,
-    0xFF, 0xA9, 0x7F, 0xFF, 0xB2, 0x7F, 0xFF, 0xD0, 0x7F, 0xBC, 0x15, 0x7F, 0xF1, 0x6B, 0x7F, 0xFF,
-    0xEE, 0x7F, 0xFF, 0xF7, 0x7F, 0x92, 0xEE, 0x7F, 0x92, 0xEE, 0x7F, 0x92, 0xEE, 0x7F, 0x92, 0xEE,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0x7F, 0x92, 0xEE, 0x7F, 0x95, 0x4E, 0x7F, 0x92, 0xEE, 0x7F, 0xFF, 0x6F, 0x7F, 0xFF, 0x8B, 0x7F,
+    0x96, 0x25, 0x7F, 0xB7, 0xB2, 0x7F, 0xFF, 0xA9, 0x7F, 0xFF, 0xB2, 0x7F, 0x92, 0xEE, 0x7F, 0xFF,
+    0xD0, 0x7F, 0xBC, 0x15, 0x7F, 0xF1, 0x6B, 0x7F, 0xFF, 0xEE, 0x7F, 0x92, 0xEE, 0x7F, 0xFF, 0xF7,
     0x41, 0xD1, 0xB1, 0x5D, 0x63, 0xB0, 0xB2, 0xB5, 0x7F, 0xDF, 0x1F, 0x7F, 0x8E, 0x8F, 0x7F, 0xFF,
     0xFC, 0x42, 0x8C, 0x91, 0xA2, 0xEE, 0xFF, 0xEF, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEC, 0x7F,
     0xFF, 0xF9, 0x7F, 0x8E, 0x86, 0x62, 0xD0, 0xD1, 0x7F, 0x8E, 0xAA, 0x7F, 0x93, 0xE9, 0x66, 0xB0,
@@ -1927,11 +1927,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xFF, 0xEF, 0x7F, 0x8E, 0x46, 0x62, 0x80, 0x8C, 0x7F, 0x8E, 0x2E, 0x7F, 0xBA, 0x58, 0x63, 0xD0,
     0xD1, 0x2D, 0x7F, 0xCC, 0xC6, 0x7F, 0xFF, 0xF7, 0x7F, 0x8E, 0x30, 0x63, 0xD0, 0xD1, 0x2D, 0x7F,
     0x8F, 0x3F, 0x7F, 0xB1, 0x94, 0x7F, 0x8E, 0x23, 0x41, 0xB2, 0xA9, 0x96, 0x62, 0xD0, 0x2D, 0x7F,
-    0xFF, 0xFC, 0x7F, 0x8E, 0x12, 0x71, 0x80, 0x81, 0x82, 0x83, 0x88, 0x8F, 0x91, 0x84, 0x85, 0x86,
-    0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x7F, 0xFF, 0x83, 0x7F, 0xFF, 0xC3, 0x7F, 0xFF, 0xD9,
-    0x7F, 0x95, 0x4F, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF7, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F,
-    0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92,
-    0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFE,
+    0xFF, 0xFC, 0x7F, 0x8E, 0x12, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0xFF, 0x83, 0x7F, 0xFF, 0xC3, 0x7F, 0xFF, 0xD9,
+    0x7F, 0x95, 0x4F, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F,
+    0xFF, 0xE6, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92, 0x18, 0x7F, 0x92,
+    0x18, 0x7F, 0x92, 0x18, 0x7F, 0xFF, 0xF7, 0x7F, 0x92, 0x18, 0xC2, 0x00, 0x91, 0xD0, 0xD1, 0xFE,
     0xE5, 0xFF, 0xBB, 0x41, 0xD1, 0x9E, 0x4E, 0x21, 0xB0, 0xFC, 0xE2, 0x01, 0xB1, 0xD0, 0x2D, 0x7F,
     0xFF, 0xFD, 0x7F, 0x8D, 0xB4, 0x62, 0xD1, 0x2D, 0x7F, 0x9A, 0x84, 0x7F, 0x8D, 0xA9, 0x62, 0xD1,
     0x2D, 0x7F, 0xDB, 0x51, 0x7F, 0x8D, 0xA0, 0x62, 0xB7, 0xBA, 0x7F, 0x92, 0x9F, 0x7F, 0x8D, 0xC5,
@@ -1940,11 +1940,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x82, 0x21, 0xD0, 0xF7, 0x62, 0xB8, 0xBE, 0x7F, 0xFF, 0xFD, 0x7F, 0x8D, 0xC6, 0x62, 0xD0, 0x2D,
     0x7F, 0xFF, 0xF7, 0x7F, 0x8D, 0x61, 0x41, 0xB5, 0xAA, 0x01, 0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC,
     0x7F, 0x8D, 0x54, 0x61, 0xBE, 0x7F, 0x8D, 0xCF, 0x21, 0xD0, 0xFB, 0x21, 0x82, 0xFD, 0x63, 0xD0,
-    0xD1, 0x2D, 0x7F, 0x8E, 0x5C, 0x7F, 0xFF, 0xFD, 0x7F, 0x8D, 0x40, 0x70, 0xB1, 0xB2, 0xB4, 0xB5,
-    0xB7, 0xB8, 0xBA, 0xBC, 0xBD, 0xBE, 0xBF, 0xB0, 0xB3, 0xB6, 0xB9, 0xBB, 0x7F, 0xFF, 0x7F, 0x7F,
-    0xFF, 0x8A, 0x7F, 0xFF, 0x93, 0x7F, 0xFF, 0xA5, 0x7F, 0xFF, 0xB4, 0x7F, 0xD8, 0xC0, 0x7F, 0x93,
-    0xA2, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xDF, 0x7F, 0xBF, 0x11, 0x7F, 0xFF, 0xF3, 0x7F, 0x91, 0x42,
-    0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x7F, 0x91, 0x42, 0x62, 0xBA, 0xBD, 0x7F,
+    0xD1, 0x2D, 0x7F, 0x8E, 0x5C, 0x7F, 0xFF, 0xFD, 0x7F, 0x8D, 0x40, 0x70, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0x91, 0x42, 0x7F,
+    0xFF, 0x7F, 0x7F, 0xFF, 0x8A, 0x7F, 0x91, 0x42, 0x7F, 0xFF, 0x93, 0x7F, 0xFF, 0xA5, 0x7F, 0x91,
+    0x42, 0x7F, 0xFF, 0xB4, 0x7F, 0xD8, 0xC0, 0x7F, 0x91, 0x42, 0x7F, 0x93, 0xA2, 0x7F, 0x91, 0x42,
+    0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xDF, 0x7F, 0xBF, 0x11, 0x7F, 0xFF, 0xF3, 0x62, 0xBA, 0xBD, 0x7F,
     0x8C, 0xE7, 0x7F, 0x8D, 0x51, 0x62, 0xD0, 0xD1, 0x7F, 0x8D, 0x9A, 0x7F, 0x99, 0xC4, 0x21, 0x82,
     0xF7, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEB, 0x7F, 0xFF, 0xFD, 0x7F, 0x8C, 0xDD, 0x41, 0xBC,
     0xDF, 0xBC, 0x21, 0xD0, 0xFC, 0x64, 0xB0, 0xB8, 0xBC, 0xBE, 0x7F, 0xFF, 0xFD, 0x7F, 0xB1, 0x19,
@@ -1956,33 +1956,33 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x8C, 0xD1, 0x7F, 0x8C, 0xD1, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xF7, 0x7F,
     0x8C, 0x69, 0x41, 0xD1, 0x9D, 0xA5, 0x62, 0xB2, 0xB3, 0x7F, 0x8C, 0x86, 0x7F, 0xFF, 0xFC, 0xE2,
     0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x8C, 0x4F, 0x61, 0xB7, 0x7F, 0x91, 0x4C, 0xE2,
-    0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8C, 0x3F, 0x71, 0x81, 0x82, 0x85, 0x89, 0x8E,
-    0x8F, 0x91, 0x80, 0x83, 0x84, 0x86, 0x87, 0x88, 0x8A, 0x8B, 0x8C, 0x8D, 0x7F, 0xFF, 0x57, 0x7F,
-    0xFF, 0x96, 0x7F, 0xFF, 0xB0, 0x7F, 0xFF, 0xCB, 0x7F, 0xBE, 0x12, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF,
-    0xF5, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43,
-    0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0xC2,
+    0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8C, 0x3F, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0x90, 0x43, 0x7F,
+    0xFF, 0x57, 0x7F, 0xFF, 0x96, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0xFF, 0xB0, 0x7F, 0x90,
+    0x43, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0xFF, 0xCB, 0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43,
+    0x7F, 0x90, 0x43, 0x7F, 0x90, 0x43, 0x7F, 0xBE, 0x12, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xF5, 0xC2,
     0x00, 0x91, 0xD0, 0xD1, 0xFE, 0xBC, 0xFF, 0xBB, 0xE2, 0x00, 0x91, 0xD1, 0x2D, 0x7F, 0x8D, 0x99,
     0x7F, 0x8B, 0xE6, 0xE1, 0x01, 0xF1, 0xD1, 0x7F, 0x8E, 0xB4, 0x21, 0x81, 0xF9, 0x63, 0xD0, 0xD1,
     0x2D, 0x7F, 0x8F, 0xC2, 0x7F, 0xFF, 0xFD, 0x7F, 0x8B, 0xD1, 0x61, 0xB5, 0x7F, 0x95, 0x46, 0x62,
     0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8B, 0xBF, 0xE2, 0x00, 0xA1, 0xD0, 0x2D, 0x7F, 0x8B, 0xD4,
     0x7F, 0x8B, 0xB6, 0xE2, 0x00, 0xA1, 0xD1, 0x2D, 0x7F, 0xAF, 0x1C, 0x7F, 0x8B, 0xAB, 0x62, 0xD0,
     0x2D, 0x7F, 0xAC, 0x49, 0x7F, 0x8B, 0xA0, 0x41, 0xB8, 0xEC, 0x42, 0xE2, 0x00, 0xA1, 0xD0, 0x2D,
-    0x7F, 0xFF, 0xFC, 0x7F, 0x8B, 0x93, 0x70, 0xB2, 0xB3, 0xB4, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
-    0xB0, 0xB1, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0x7F, 0xFF, 0xA2, 0x7F, 0x93, 0x4A, 0x7F, 0x96, 0x38,
-    0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF, 0xDD, 0x7F, 0xFF, 0xE8, 0x7F,
-    0xFF, 0xF5, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F,
-    0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0xC1, 0x00, 0x91, 0xD1, 0x9E, 0x1A, 0x63, 0xB5, 0xB8,
+    0x7F, 0xFF, 0xFC, 0x7F, 0x8B, 0x93, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
+    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0xFF, 0xA2,
+    0x7F, 0x93, 0x4A, 0x7F, 0x96, 0x38, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F,
+    0x8F, 0x97, 0x7F, 0x8F, 0x97, 0x7F, 0xFF, 0xB7, 0x7F, 0xFF, 0xC9, 0x7F, 0xFF, 0xD2, 0x7F, 0xFF,
+    0xDD, 0x7F, 0xFF, 0xE8, 0x7F, 0xFF, 0xF5, 0xC1, 0x00, 0x91, 0xD1, 0x9E, 0x1A, 0x63, 0xB5, 0xB8,
     0xBE, 0x7F, 0x8B, 0x86, 0x7F, 0xFF, 0xFA, 0x7F, 0xA5, 0x4F, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
     0xF3, 0x7F, 0xAA, 0x86, 0x7F, 0x8B, 0x34, 0x63, 0xBA, 0xBC, 0xBE, 0x7F, 0x8B, 0x78, 0x7F, 0x8B,
     0x6F, 0x7F, 0x8B, 0x86, 0x62, 0xD0, 0xD1, 0x7F, 0xAD, 0xE8, 0x7F, 0x8C, 0xD7, 0x21, 0x82, 0xF7,
     0xE3, 0x01, 0x31, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE7, 0x7F, 0xFF, 0xFD, 0x7F, 0x8B, 0x0E, 0x41,
     0xBB, 0xE4, 0xD6, 0x21, 0xD0, 0xFC, 0x62, 0xB5, 0xB8, 0x7F, 0x8B, 0x57, 0x7F, 0xFF, 0xFD, 0x63,
     0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0x93, 0xA6, 0x7F, 0x8A, 0xEF, 0xE2, 0x01, 0xB1, 0xD0,
-    0x2D, 0x7F, 0xA9, 0x47, 0x7F, 0x8A, 0xE2, 0x71, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x8F, 0x91,
-    0x83, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xC9, 0x7F,
-    0xFF, 0xE8, 0x7F, 0xBC, 0xB5, 0x7F, 0xFF, 0xF5, 0x7F, 0xBC, 0xB5, 0x7F, 0x92, 0x1D, 0x7F, 0x8E,
+    0x2D, 0x7F, 0xA9, 0x47, 0x7F, 0x8A, 0xE2, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0xFF, 0xA3, 0x7F, 0xFF, 0xC9, 0x7F,
+    0xFF, 0xE8, 0x7F, 0x8E, 0xE6, 0x7F, 0xBC, 0xB5, 0x7F, 0xFF, 0xF5, 0x7F, 0xBC, 0xB5, 0x7F, 0x8E,
     0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6,
-    0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0xC2, 0x02, 0xB1, 0xD0,
+    0x7F, 0x8E, 0xE6, 0x7F, 0x8E, 0xE6, 0x7F, 0x92, 0x1D, 0x7F, 0x8E, 0xE6, 0xC2, 0x02, 0xB1, 0xD0,
     0xD1, 0xFF, 0x0A, 0xFF, 0xBB, 0x61, 0xB5, 0x7F, 0x8B, 0xA2, 0x21, 0xD0, 0xFB, 0x21, 0x80, 0xFD,
     0xE3, 0x00, 0x91, 0xD0, 0xD1, 0x2D, 0x7F, 0xC3, 0xD3, 0x7F, 0xFF, 0xFD, 0x7F, 0x8A, 0x7E, 0x62,
     0xD1, 0x2D, 0x7F, 0xED, 0x04, 0x7F, 0x8A, 0x6F, 0x63, 0xB3, 0xB8, 0xBE, 0x7F, 0x8A, 0x5B, 0x7F,
@@ -1991,11 +1991,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x8A, 0x42, 0x61, 0xB2, 0x7F, 0x8B, 0x50, 0xE2, 0x00, 0x91, 0xD0,
     0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x8A, 0x32, 0x63, 0xB0, 0xB5, 0xB8, 0x7F, 0x8A, 0x6C, 0x7F, 0x8A,
     0x6C, 0x7F, 0x8A, 0x86, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xA1, 0xB2, 0x7F, 0x8A,
-    0x1A, 0xE1, 0x07, 0xB2, 0x2D, 0x7F, 0x8A, 0x0D, 0x70, 0xB0, 0xB1, 0xB2, 0xB4, 0xB5, 0xB7, 0xB8,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xB3, 0xB6, 0xB9, 0xBF, 0x7F, 0x90, 0xAC, 0x7F, 0xFF, 0x88, 0x7F,
-    0x90, 0xAC, 0x7F, 0xFF, 0x97, 0x7F, 0x90, 0xAC, 0x7F, 0xFF, 0xAD, 0x7F, 0xFF, 0xC4, 0x7F, 0xFF,
-    0xD4, 0x7F, 0xFF, 0xEC, 0x7F, 0xD9, 0xCE, 0x7F, 0xB7, 0x3C, 0x7F, 0xFF, 0xF9, 0x7F, 0x8E, 0x15,
-    0x7F, 0x8E, 0x15, 0x7F, 0x8E, 0x15, 0x7F, 0x8E, 0x15, 0x61, 0xBC, 0x7F, 0x8C, 0x87, 0xA1, 0x00,
+    0x1A, 0xE1, 0x07, 0xB2, 0x2D, 0x7F, 0x8A, 0x0D, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
+    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0x90, 0xAC, 0x7F, 0xFF, 0x88, 0x7F,
+    0x90, 0xAC, 0x7F, 0x8E, 0x15, 0x7F, 0xFF, 0x97, 0x7F, 0x90, 0xAC, 0x7F, 0x8E, 0x15, 0x7F, 0xFF,
+    0xAD, 0x7F, 0xFF, 0xC4, 0x7F, 0x8E, 0x15, 0x7F, 0xFF, 0xD4, 0x7F, 0xFF, 0xEC, 0x7F, 0xD9, 0xCE,
+    0x7F, 0xB7, 0x3C, 0x7F, 0xFF, 0xF9, 0x7F, 0x8E, 0x15, 0x61, 0xBC, 0x7F, 0x8C, 0x87, 0xA1, 0x00,
     0x91, 0xD0, 0xFB, 0xC1, 0x00, 0x91, 0xD1, 0xB5, 0x48, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x89,
     0xFA, 0x7F, 0xFF, 0xF5, 0x7F, 0xFF, 0xFA, 0x7F, 0x89, 0xFA, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF,
     0xEF, 0x7F, 0xA8, 0xF6, 0x7F, 0x89, 0xA4, 0x63, 0xB0, 0xB5, 0xBE, 0x7F, 0x89, 0xDC, 0x7F, 0x89,
@@ -2003,11 +2003,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xFB, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xC6, 0xFE, 0x7F, 0xFF, 0xFD, 0x7F, 0x89, 0x7D, 0x62, 0xB8,
     0xBE, 0x7F, 0x89, 0xB5, 0x7F, 0x89, 0xB5, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xF7, 0x7F, 0xA8,
     0xB9, 0x7F, 0x89, 0x67, 0x41, 0xB0, 0xA5, 0xBF, 0xE2, 0x00, 0x91, 0xD0, 0x2D, 0x7F, 0xFF, 0xFC,
-    0x7F, 0x89, 0x56, 0x71, 0x80, 0x81, 0x82, 0x85, 0x87, 0x89, 0x8F, 0x91, 0x83, 0x84, 0x86, 0x88,
-    0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x7F, 0xFF, 0xA7, 0x7F, 0xFF, 0xCE, 0x7F, 0xFF, 0xE4, 0x7F, 0xFF,
-    0xF5, 0x7F, 0x8F, 0xF1, 0x7F, 0xB6, 0x81, 0x7F, 0x8F, 0xF1, 0x7F, 0x8F, 0xF1, 0x7F, 0x8D, 0x5A,
-    0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F,
-    0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x00, 0xFF,
+    0x7F, 0x89, 0x56, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B,
+    0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0xFF, 0xA7, 0x7F, 0xFF, 0xCE, 0x7F, 0xFF, 0xE4, 0x7F, 0x8D,
+    0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0xFF, 0xF5, 0x7F, 0x8D, 0x5A, 0x7F, 0x8F, 0xF1, 0x7F, 0x8D, 0x5A,
+    0x7F, 0xB6, 0x81, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F, 0x8D, 0x5A, 0x7F,
+    0x8D, 0x5A, 0x7F, 0x8F, 0xF1, 0x7F, 0x8F, 0xF1, 0xC2, 0x02, 0xB1, 0xD0, 0xD1, 0xFF, 0x00, 0xFF,
     0xBB, 0x63, 0xB0, 0xB5, 0xB8, 0x7F, 0x89, 0x2B, 0x7F, 0x89, 0x45, 0x7F, 0x89, 0x2B, 0x62, 0x8E,
     0x91, 0x7F, 0x89, 0x38, 0x7F, 0x89, 0x38, 0xA2, 0x00, 0xA1, 0xD0, 0xD1, 0xEA, 0xF7, 0x21, 0x80,
     0xF9, 0x62, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x88, 0xDD, 0x61, 0xD0, 0x7F, 0x92, 0xEF, 0x62,
@@ -2020,10 +2020,10 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xF7, 0x7F, 0x91, 0x43, 0x7F, 0x88, 0x76, 0xE2, 0x00, 0x91, 0xD1, 0x2D, 0x7F, 0x8A, 0x2C, 0x7F,
     0x88, 0x67, 0x41, 0xB1, 0xCC, 0x25, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xFC, 0x7F, 0x8A, 0x1D,
     0x7F, 0x88, 0x58, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0x88, 0x69, 0x7F, 0xA1, 0x99, 0x7F, 0x88, 0x4B,
-    0x70, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xB0, 0xB6, 0xB9, 0xBE,
-    0xBF, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x81, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xA0, 0x7F, 0x8E, 0xE4,
-    0x7F, 0xFF, 0xB6, 0x7F, 0x8E, 0xE4, 0x7F, 0xFF, 0xC8, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xE6, 0x7F,
-    0xFF, 0xF3, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C,
+    0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
+    0xBF, 0x7F, 0x8C, 0x4D, 0x7F, 0xFF, 0x61, 0x7F, 0xFF, 0x81, 0x7F, 0xFF, 0x97, 0x7F, 0xFF, 0xA0,
+    0x7F, 0x8E, 0xE4, 0x7F, 0x8C, 0x4D, 0x7F, 0xFF, 0xB6, 0x7F, 0x8E, 0xE4, 0x7F, 0x8C, 0x4D, 0x7F,
+    0xFF, 0xC8, 0x7F, 0xFF, 0xD7, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xF3, 0x7F, 0x8C, 0x4D, 0x7F, 0x8C,
     0x4D, 0x63, 0xB0, 0xB8, 0xBE, 0x7F, 0x88, 0x42, 0x7F, 0x88, 0x42, 0x7F, 0x88, 0x42, 0x63, 0xD0,
     0xD1, 0x2D, 0x7F, 0xFF, 0xF3, 0x7F, 0xEA, 0x85, 0x7F, 0x87, 0xF0, 0x62, 0xBA, 0xBB, 0x7F, 0x88,
     0x11, 0x7F, 0x88, 0x11, 0x62, 0xB2, 0xBE, 0x7F, 0x87, 0xE6, 0x7F, 0x88, 0x1F, 0xE2, 0x01, 0xB1,
@@ -2033,11 +2033,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x64, 0x83, 0x8B, 0x8C, 0x8F, 0x7F, 0x87, 0xE3, 0x7F, 0x87, 0xE3, 0x7F, 0xB3, 0xBD, 0x7F, 0x87,
     0xE3, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDE, 0x7F, 0xFF, 0xEF, 0x7F, 0x87, 0x8D, 0x63, 0xD0,
     0xD1, 0x2D, 0x7F, 0x8B, 0x71, 0x7F, 0xB6, 0x2D, 0x7F, 0x87, 0x80, 0x61, 0xB5, 0x7F, 0x87, 0xCF,
-    0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x87, 0x6E, 0x71, 0x80, 0x81, 0x82, 0x83, 0x85, 0x86,
-    0x88, 0x8E, 0x8F, 0x91, 0x84, 0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x7F, 0xFF, 0x75, 0x7F, 0xFF,
-    0xA2, 0x7F, 0xFF, 0xD8, 0x7F, 0x8E, 0x0B, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xF7, 0x7F, 0x8D, 0xD4,
-    0x7F, 0xEE, 0x5A, 0x7F, 0x8E, 0x98, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F,
-    0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x42, 0xD0,
+    0x62, 0xD0, 0x2D, 0x7F, 0xFF, 0xFB, 0x7F, 0x87, 0x6E, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0xFF, 0x75, 0x7F, 0xFF,
+    0xA2, 0x7F, 0xFF, 0xD8, 0x7F, 0x8E, 0x0B, 0x7F, 0x8B, 0x74, 0x7F, 0xFF, 0xE5, 0x7F, 0xFF, 0xF7,
+    0x7F, 0x8B, 0x74, 0x7F, 0x8D, 0xD4, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F,
+    0x8B, 0x74, 0x7F, 0x8B, 0x74, 0x7F, 0xEE, 0x5A, 0x7F, 0x8E, 0x98, 0x7F, 0x8B, 0x74, 0x42, 0xD0,
     0xD1, 0xFE, 0xE2, 0xFF, 0xBB, 0x42, 0xD0, 0xD1, 0xAA, 0xB2, 0xB2, 0x96, 0x21, 0x80, 0xF9, 0xE2,
     0x02, 0x21, 0xD1, 0x2D, 0x7F, 0xFF, 0xFD, 0x7F, 0x87, 0x0F, 0x62, 0xB5, 0xBE, 0x7F, 0x87, 0x49,
     0x7F, 0x87, 0x49, 0x61, 0xB5, 0x7F, 0x90, 0x80, 0x21, 0xD0, 0xFB, 0x62, 0x80, 0x83, 0x7F, 0xFF,
@@ -2054,11 +2054,11 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x83, 0x8B, 0x7F, 0x86, 0x7D, 0x7F, 0x86, 0x6A, 0xE2, 0x00, 0xA1, 0xD0, 0xD1, 0x7F, 0x86, 0x64,
     0x7F, 0xFF, 0xF7, 0x65, 0xB0, 0xB5, 0xBB, 0xBD, 0xBE, 0x7F, 0xF8, 0x80, 0x7F, 0x87, 0x10, 0x7F,
     0xFF, 0xF5, 0x7F, 0x98, 0xFF, 0x7F, 0x87, 0x10, 0x61, 0x82, 0x7F, 0x98, 0xEA, 0x63, 0xD0, 0xD1,
-    0x2D, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xFB, 0x7F, 0x86, 0x21, 0x70, 0xB1, 0xB2, 0xB4, 0xB6, 0xB7,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB0, 0xB3, 0xB5, 0xB8, 0xB9, 0xBE, 0x7F, 0xFF, 0x05, 0x7F, 0xFF,
-    0x2A, 0x7F, 0xFF, 0x46, 0x7F, 0xFF, 0x4F, 0x7F, 0xFF, 0x6D, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0x99,
-    0x7F, 0xFF, 0xAF, 0x7F, 0xFF, 0xB8, 0x7F, 0xFF, 0xF3, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F,
-    0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0xE1, 0x00, 0x91, 0x2E, 0x7F,
+    0x2D, 0x7F, 0xFF, 0xE6, 0x7F, 0xFF, 0xFB, 0x7F, 0x86, 0x21, 0x70, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0x7F, 0x8A, 0x23, 0x7F, 0xFF,
+    0x05, 0x7F, 0xFF, 0x2A, 0x7F, 0x8A, 0x23, 0x7F, 0xFF, 0x46, 0x7F, 0x8A, 0x23, 0x7F, 0xFF, 0x4F,
+    0x7F, 0xFF, 0x6D, 0x7F, 0x8A, 0x23, 0x7F, 0x8A, 0x23, 0x7F, 0xFF, 0x8C, 0x7F, 0xFF, 0x99, 0x7F,
+    0xFF, 0xAF, 0x7F, 0xFF, 0xB8, 0x7F, 0x8A, 0x23, 0x7F, 0xFF, 0xF3, 0xE1, 0x00, 0x91, 0x2E, 0x7F,
     0x85, 0xEE, 0x64, 0xB0, 0xB5, 0xB8, 0xBE, 0x7F, 0x86, 0x11, 0x7F, 0xFF, 0xF9, 0x7F, 0x86, 0x11,
     0x7F, 0x86, 0x11, 0x63, 0x81, 0x83, 0x8B, 0x7F, 0xA4, 0x9E, 0x7F, 0x86, 0x00, 0x7F, 0x86, 0x00,
     0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xE2, 0x7F, 0xFF, 0xF3, 0x7F, 0x85, 0xAE, 0x61, 0x2E, 0x7F,
@@ -2071,9 +2071,9 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0x7F, 0x85, 0x92, 0x7F, 0x85, 0x92, 0x63, 0xD0, 0xD1, 0x2D, 0x7F, 0xFF, 0xDA, 0x7F, 0xFF, 0xEB,
     0x7F, 0x85, 0x38, 0x61, 0xBF, 0x7F, 0x8A, 0x33, 0x21, 0xD0, 0xFB, 0x44, 0xB0, 0xB2, 0xBB, 0xBE,
     0xA5, 0x68, 0xA5, 0x6F, 0xA5, 0x7C, 0xFF, 0xFD, 0x61, 0x80, 0x7F, 0x8E, 0x24, 0x63, 0xD0, 0xD1,
-    0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xFB, 0x7F, 0x85, 0x11, 0x71, 0x80, 0x81, 0x82, 0x85, 0x91,
-    0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x7F, 0xFF, 0x56, 0x7F,
-    0xFF, 0x99, 0x7F, 0xFF, 0xCC, 0x7F, 0xFF, 0xF3, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89,
+    0x2D, 0x7F, 0xFF, 0xEE, 0x7F, 0xFF, 0xFB, 0x7F, 0x85, 0x11, 0x71, 0x80, 0x81, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0x7F, 0xFF, 0x56, 0x7F,
+    0xFF, 0x99, 0x7F, 0xFF, 0xCC, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0xFF, 0xF3, 0x7F, 0x89,
     0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13,
     0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x7F, 0x89, 0x13, 0x42,
     0xD0, 0xD1, 0xFE, 0xAB, 0xFF, 0xBB, 0x51, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
@@ -2082,19 +2082,94 @@ alignas(4) constexpr uint8_t ru_trie_data[] = {
     0xF8, 0xC9, 0xFA, 0x26, 0xFB, 0xB2, 0xFD, 0x98, 0xFF, 0xF9, 0xA0, 0x0D, 0x01, 0xA0, 0x0D, 0x22,
     0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE,
     0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0x31, 0x91, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C,
-    0x8D, 0x8E, 0x8F, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
+    0xFD, 0x31, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+    0x8E, 0x8F, 0x91, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
     0xDC, 0xDC, 0xDC, 0xDC, 0x42, 0xD0, 0xD1, 0xFF, 0xBC, 0xFF, 0xDD, 0x30, 0xB0, 0xB1, 0xB2, 0xB3,
     0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF9, 0xF9, 0xF9, 0xF9,
-    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0x31, 0x91, 0x80, 0x81,
-    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0xD8, 0xD8,
+    0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0x31, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x91, 0xD8, 0xD8,
     0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xD8, 0xC3,
     0x0C, 0xE2, 0x2D, 0xD0, 0xD1, 0xFF, 0x6B, 0xFF, 0xBC, 0xFF, 0xDD, 0x64, 0x2E, 0xD0, 0xD1, 0x2D,
     0x7F, 0x83, 0xD1, 0x7F, 0xCF, 0xC7, 0x7F, 0xFF, 0x2B, 0x7F, 0xFF, 0xF4,
 };
 
+// Dense lookup tables for the root and depth-1 transitions; nodes with at least
+// 12 transitions have their labels sorted.
+constexpr uint8_t ru_root_slots[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint8_t ru_byte_classes[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0xFF, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x22, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint32_t ru_depth1_targets[] = {
+    0x0000821Fu, 0x000005FCu, 0x000051F2u, 0x00008156u,
+};
+
+constexpr uint32_t ru_depth2_targets[] = {
+    0x0000818Au, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x000081DBu, 0x000081FCu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000044Cu, 0x000005C8u,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000CEEu, 0x0000111Fu, 0x0000161Du, 0x00001937u, 0x00001F22u, 0x000026F8u,
+    0x000028ABu, 0x00002D75u, 0x00003314u, 0x00003400u, 0x00003826u, 0x00003C89u, 0x00004001u, 0x000044F2u,
+    0x00004D5Fu, 0x000051E9u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00005A01u, 0x0000617Eu, 0x00006711u,
+    0x00006B6Au, 0x00006D51u, 0x00006FC4u, 0x00007115u, 0x000072C6u, 0x000074EDu, 0x000075B4u, 0x00007684u,
+    0x0000784Au, 0x00007A1Fu, 0x00007B7Cu, 0x00007D08u, 0x00007EEEu, 0x0000814Fu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+};
+
+constexpr SerializedTrieAcceleration ru_acceleration = {
+    ru_root_slots,
+    ru_byte_classes,
+    ru_depth1_targets,
+    ru_depth2_targets,
+    36u,
+    12u,
+};
+
 constexpr SerializedHyphenationPatterns ru_patterns = {
     0x822Bu,
     ru_trie_data,
     sizeof(ru_trie_data),
+    &ru_acceleration,
 };
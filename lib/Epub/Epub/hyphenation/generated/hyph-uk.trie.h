@@ -64,9 +64,9 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xE9, 0xFF,
     0xFD, 0xFD, 0x93, 0x41, 0xBA, 0xFE, 0x5F, 0x21, 0xD0, 0xFC, 0x21, 0x8F, 0xFD, 0x21, 0xD1, 0xFD,
     0x21, 0xB8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFD, 0x79, 0x41, 0x2D, 0xFD, 0x72, 0x50, 0xB0,
-    0xB5, 0xBE, 0xB9, 0xB2, 0xB3, 0xB4, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB1, 0xB6, 0xB8, 0xFD,
-    0x71, 0xFD, 0x9B, 0xFD, 0xE8, 0xFE, 0x12, 0xFE, 0x56, 0xFE, 0x78, 0xFE, 0xAD, 0xFE, 0xBE, 0xFF,
-    0x01, 0xFF, 0x3C, 0xFF, 0x5C, 0xFF, 0x90, 0xFF, 0xDB, 0xFF, 0xF5, 0xFF, 0xFC, 0xFF, 0xFC, 0xA0,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD,
+    0x71, 0xFF, 0xF5, 0xFE, 0x56, 0xFE, 0x78, 0xFE, 0xAD, 0xFD, 0x9B, 0xFF, 0xFC, 0xFE, 0xBE, 0xFF,
+    0xFC, 0xFE, 0x12, 0xFF, 0x01, 0xFF, 0x3C, 0xFF, 0x5C, 0xFF, 0x90, 0xFD, 0xE8, 0xFF, 0xDB, 0xA0,
     0x06, 0x72, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82,
     0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0xC2, 0x00, 0x61, 0xD1, 0x2D, 0xFF, 0xFD, 0xFD, 0x25,
     0x41, 0xBE, 0xFD, 0xF2, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xB0, 0xDB, 0x22, 0xD1, 0xD0,
@@ -102,9 +102,9 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xF0, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xFB, 0x3A, 0x41, 0xB5, 0xFB, 0xE6, 0x21, 0xD0, 0xFC,
     0x21, 0xBB, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFB, 0x29, 0x41, 0xBB, 0xFC, 0xC0, 0x21, 0xD0,
     0xFC, 0x42, 0xB0, 0xBE, 0xFF, 0xFD, 0xFB, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xFB, 0x14, 0x50,
-    0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x85, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8C,
-    0xFD, 0xE8, 0xFE, 0x2B, 0xFE, 0x37, 0xFE, 0x37, 0xFE, 0x37, 0xFE, 0x37, 0xFF, 0xB0, 0xFF, 0xD3,
-    0xFF, 0xE4, 0xFF, 0xF9, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97,
+    0xFF, 0xB0, 0xFF, 0xD3, 0xFF, 0xE4, 0xFE, 0x2B, 0xFD, 0x9B, 0xFF, 0xF9, 0xFD, 0x9B, 0xFD, 0x9B,
+    0xFD, 0x9B, 0xFD, 0x9B, 0xFD, 0x9B, 0xFE, 0x37, 0xFE, 0x37, 0xFE, 0x37, 0xFD, 0xE8, 0xFE, 0x37,
     0x41, 0x91, 0xFD, 0x6A, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFD, 0x6A, 0xFF, 0xCB, 0xFF,
     0xFC, 0xFD, 0x66, 0x41, 0x96, 0xFA, 0xB1, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
     0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x43, 0xBA, 0xB2, 0xB4, 0xFA, 0xCF, 0xFF, 0xFD, 0xFA, 0xB0,
@@ -140,10 +140,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8C, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD7,
     0xFF, 0xFD, 0xF8, 0xD2, 0x41, 0xB7, 0xFB, 0x8B, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0,
     0xFD, 0x22, 0xB8, 0xBA, 0xBD, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xF8, 0xB6, 0x21, 0xBE, 0xB1,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF8, 0xAC, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD,
-    0xB2, 0xB4, 0xB1, 0xB3, 0xB6, 0xB7, 0xB8, 0xBF, 0xFD, 0xF9, 0xFE, 0x25, 0xFE, 0xC5, 0xFE, 0xD1,
-    0xFF, 0x06, 0xFF, 0x2F, 0xFF, 0x53, 0xFF, 0xD3, 0xFF, 0xEF, 0xFF, 0xF9, 0xFB, 0x33, 0xFB, 0x33,
-    0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0x42, 0x80, 0x82, 0xFB, 0x37, 0xF8, 0x5C, 0x21,
+    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF8, 0xAC, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0xF9, 0xFB, 0x33, 0xFF, 0xEF, 0xFB, 0x33,
+    0xFF, 0xF9, 0xFE, 0x25, 0xFB, 0x33, 0xFB, 0x33, 0xFB, 0x33, 0xFE, 0xD1, 0xFF, 0x06, 0xFF, 0x2F,
+    0xFF, 0x53, 0xFF, 0xD3, 0xFE, 0xC5, 0xFB, 0x33, 0x42, 0x80, 0x82, 0xFB, 0x37, 0xF8, 0x5C, 0x21,
     0xD1, 0xF9, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81,
     0xFD, 0xC2, 0x00, 0x61, 0xD1, 0x2D, 0xFF, 0xFD, 0xF8, 0x5B, 0x41, 0x82, 0xFE, 0x28, 0x21, 0xD1,
     0xFC, 0x21, 0x81, 0xFD, 0x41, 0xB3, 0xF8, 0x30, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0,
@@ -152,22 +152,22 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB0, 0xB5, 0xFF, 0xFD, 0xF8, 0xC8, 0x21, 0xD0,
     0xF9, 0x21, 0x82, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xF8, 0x08, 0x41, 0xBF, 0xF8, 0xAE, 0x21,
     0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x41, 0xBE, 0xF8, 0xBF, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x43,
-    0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xFF, 0xFD, 0xF7, 0xED, 0x50, 0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97,
-    0x81, 0x82, 0x80, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xFF, 0x88, 0xFF, 0xAF, 0xFB, 0x0D,
-    0xFB, 0x0D, 0xFB, 0x0D, 0xFB, 0x0D, 0xFF, 0xDB, 0xFF, 0xF6, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71,
-    0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2,
+    0xD0, 0xD1, 0x2D, 0xFF, 0xF3, 0xFF, 0xFD, 0xF7, 0xED, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFA, 0x71, 0xFF, 0xDB, 0xFF, 0xF6,
+    0xFF, 0xAF, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71, 0xFA, 0x71,
+    0xFB, 0x0D, 0xFB, 0x0D, 0xFB, 0x0D, 0xFF, 0x88, 0xFB, 0x0D, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2,
     0x27, 0xFF, 0x0D, 0xFF, 0xCF, 0xFC, 0xD6, 0xFA, 0x40, 0x41, 0xB2, 0xFC, 0xEA, 0xC2, 0x00, 0x61,
     0xD0, 0x2D, 0xFF, 0xFC, 0xF7, 0x9F, 0x41, 0x81, 0xFC, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D,
     0xFD, 0x0F, 0xFF, 0xFC, 0xF7, 0x92, 0x41, 0xBA, 0xFD, 0x98, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF,
     0xFC, 0xF7, 0x82, 0x41, 0xB8, 0xF7, 0x61, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x41, 0x8F, 0xF7,
     0x57, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0xC3, 0x00, 0xD1, 0xD1, 0xD0, 0x2D, 0xFF, 0xF3, 0xFF,
-    0xFD, 0xF7, 0x65, 0x42, 0xD0, 0x2D, 0xF8, 0x3E, 0xF7, 0x59, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xB3,
-    0xB1, 0xB2, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xFF, 0xB3, 0xFF, 0xC0, 0xFF,
-    0xD0, 0xFF, 0xED, 0xFF, 0xF9, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9,
-    0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0x50, 0x96, 0x83, 0x8E, 0x8F,
-    0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xF9, 0xFC, 0xFA, 0x4B,
-    0xFA, 0x4B, 0xFA, 0x4B, 0xFA, 0x4B, 0xFA, 0x4B, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF,
-    0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xC4, 0x00, 0x42, 0xD0,
+    0xFD, 0xF7, 0x65, 0x42, 0xD0, 0x2D, 0xF8, 0x3E, 0xF7, 0x59, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0xB3, 0xF9, 0xE0, 0xF9,
+    0xE0, 0xFF, 0xF9, 0xF9, 0xE0, 0xFF, 0xC0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xFF, 0xED, 0xF9,
+    0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xF9, 0xE0, 0xFF, 0xD0, 0xF9, 0xE0, 0x50, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xF9, 0xAF, 0xF9, 0xAF,
+    0xF9, 0xAF, 0xFA, 0x4B, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF, 0xF9, 0xAF,
+    0xF9, 0xAF, 0xFA, 0x4B, 0xFA, 0x4B, 0xFA, 0x4B, 0xF9, 0xFC, 0xFA, 0x4B, 0xC4, 0x00, 0x42, 0xD0,
     0xD1, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF, 0xFC, 0x14, 0xF9, 0x7E, 0x41, 0xBC, 0xF6, 0xC9, 0x21,
     0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x41, 0x86, 0xFC, 0x0C, 0x21,
     0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x42, 0xD1, 0xD0, 0xF6, 0xDD, 0xFF, 0xFD, 0x41, 0x96, 0xFD, 0xFC,
@@ -211,9 +211,9 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x1C, 0x21, 0xD0, 0xFC, 0x43, 0x81, 0x88, 0x89, 0xF5, 0x1B, 0xFF, 0xFD, 0xFF, 0xFD, 0x21, 0xD1,
     0xF6, 0x22, 0x82, 0x83, 0xE9, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD9, 0xFF, 0xFB, 0xF4, 0x56,
     0x42, 0xBE, 0xB0, 0xF5, 0x2E, 0xF5, 0x2E, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xF4, 0x45, 0x50, 0xB0,
-    0xB5, 0xBE, 0xB9, 0xB2, 0xB1, 0xB4, 0xB7, 0xBA, 0xBF, 0xBD, 0xB3, 0xB6, 0xB8, 0xBB, 0xBC, 0xFD,
-    0xA0, 0xFD, 0xBA, 0xFE, 0x45, 0xFA, 0x6A, 0xFE, 0x5D, 0xFF, 0x64, 0xFF, 0x88, 0xFF, 0xA9, 0xFF,
-    0xBA, 0xFF, 0xE8, 0xFF, 0xF9, 0xF6, 0xCC, 0xF6, 0xCC, 0xF6, 0xCC, 0xF6, 0xCC, 0xF6, 0xCC, 0x41,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD,
+    0xA0, 0xFF, 0x64, 0xFE, 0x5D, 0xF6, 0xCC, 0xFF, 0x88, 0xFD, 0xBA, 0xF6, 0xCC, 0xFF, 0xA9, 0xF6,
+    0xCC, 0xFA, 0x6A, 0xFF, 0xBA, 0xF6, 0xCC, 0xF6, 0xCC, 0xFF, 0xF9, 0xFE, 0x45, 0xFF, 0xE8, 0x41,
     0xBE, 0xF4, 0x1A, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0xC3, 0x00, 0x61, 0xD0, 0xD1, 0x2D, 0xFF,
     0xFD, 0xFB, 0xA5, 0xF4, 0x03, 0x42, 0x82, 0x83, 0xF9, 0xCD, 0xF9, 0x8D, 0xA1, 0x02, 0x91, 0xD1,
     0xF9, 0x21, 0x81, 0xFB, 0x41, 0xD0, 0xF6, 0xD6, 0x43, 0xBA, 0xB4, 0xB3, 0xFD, 0x0D, 0xFF, 0xFC,
@@ -225,10 +225,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xF3, 0x94, 0x41, 0xBB, 0xFE, 0xE5, 0x42, 0x80, 0x87, 0xFE, 0x54, 0xF4, 0x33, 0x22, 0xD0, 0xD1,
     0xF5, 0xF9, 0x21, 0xBE, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0x77, 0x42, 0x81, 0x89, 0xF6,
     0xA4, 0xF4, 0x1D, 0x21, 0xD1, 0xF9, 0x21, 0xB8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0x63,
-    0x50, 0x96, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x85, 0x87, 0x82, 0x84, 0x86, 0x88, 0x89,
-    0x8C, 0xFF, 0x59, 0xFF, 0x82, 0xF6, 0x86, 0xF6, 0x86, 0xF6, 0x86, 0xF6, 0x86, 0xFF, 0xAD, 0xFF,
-    0xC8, 0xFF, 0xE5, 0xFF, 0xF9, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5,
-    0xEA, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xED, 0xFF, 0xCF, 0xF8, 0x4F, 0xF5, 0xB9,
+    0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96,
+    0x97, 0xFF, 0xAD, 0xFF, 0xC8, 0xF5, 0xEA, 0xFF, 0x82, 0xF5, 0xEA, 0xFF, 0xE5, 0xF5, 0xEA, 0xFF,
+    0xF9, 0xF5, 0xEA, 0xF5, 0xEA, 0xF5, 0xEA, 0xF6, 0x86, 0xF6, 0x86, 0xF6, 0x86, 0xFF, 0x59, 0xF6,
+    0x86, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xED, 0xFF, 0xCF, 0xF8, 0x4F, 0xF5, 0xB9,
     0xC1, 0x00, 0x42, 0x2D, 0xF3, 0x1C, 0xA0, 0x01, 0x01, 0x42, 0x2E, 0x2D, 0xFF, 0xFD, 0xF3, 0x13,
     0x41, 0x81, 0xF3, 0xE2, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD,
     0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xFF, 0xE0, 0xFF, 0xFD, 0xF2, 0xF6,
@@ -279,10 +279,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x21, 0xB4, 0xC9, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB6, 0xCC, 0x21,
     0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x80, 0x96, 0xF1, 0xFD, 0x22, 0xD0, 0xD1,
     0xDC, 0xFB, 0x21, 0x82, 0xFB, 0x42, 0xD0, 0xD1, 0xFF, 0xA1, 0xFF, 0xFD, 0x42, 0x94, 0x80, 0xFF,
-    0x88, 0xFF, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x2E, 0xFF, 0xF9, 0xEF, 0xF9, 0x50, 0xBA, 0xBF,
-    0xB1, 0xB2, 0xB7, 0xB9, 0xBB, 0xBD, 0xB5, 0xB0, 0xBE, 0xB3, 0xB4, 0xB6, 0xB8, 0xBC, 0xFC, 0xD3,
-    0xFC, 0xD3, 0xFC, 0xD3, 0xFC, 0xDC, 0xFC, 0xDC, 0xFC, 0xF9, 0xFD, 0x5B, 0xFC, 0xDC, 0xFE, 0x39,
-    0xFF, 0x0D, 0xFF, 0xF6, 0xF2, 0x7D, 0xF2, 0x7D, 0xF2, 0x7D, 0xF2, 0x7D, 0xF2, 0x7D, 0xA0, 0x01,
+    0x88, 0xFF, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0x2E, 0xFF, 0xF9, 0xEF, 0xF9, 0x50, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0x0D,
+    0xFC, 0xD3, 0xFC, 0xDC, 0xF2, 0x7D, 0xF2, 0x7D, 0xFE, 0x39, 0xF2, 0x7D, 0xFC, 0xDC, 0xF2, 0x7D,
+    0xFC, 0xF9, 0xFC, 0xD3, 0xFD, 0x5B, 0xF2, 0x7D, 0xFC, 0xDC, 0xFF, 0xF6, 0xFC, 0xD3, 0xA0, 0x01,
     0x93, 0x21, 0x2E, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0x80, 0xFA, 0x43, 0x2E, 0xD0, 0xD1, 0xFC, 0xC6,
     0xFF, 0xFA, 0xFF, 0xFD, 0x21, 0xBA, 0xED, 0x21, 0xD0, 0xFD, 0x22, 0x82, 0x8C, 0xF0, 0xFD, 0xC3,
     0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xFC, 0x87, 0xFF, 0xFB, 0xEF, 0x9D, 0xC2, 0x00, 0x42, 0xD1, 0x2D,
@@ -297,10 +297,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x83, 0x96, 0xD6, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xFB, 0xF2, 0xFF, 0xC6, 0xFF, 0xFB, 0xEF,
     0x08, 0xA0, 0x02, 0xE1, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD,
     0x21, 0xBB, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBE, 0xB1, 0xEF, 0x6C, 0xFF, 0xFD, 0x42, 0xD0, 0x2D,
-    0xFF, 0xF9, 0xEE, 0xDF, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x80, 0x96, 0x94,
-    0x97, 0x83, 0x8C, 0x8E, 0x8F, 0xFF, 0x3B, 0xFB, 0xBC, 0xFB, 0xBC, 0xFB, 0xBC, 0xFF, 0x47, 0xFB,
-    0xBC, 0xFB, 0xBC, 0xFB, 0xBC, 0xFF, 0xD0, 0xFF, 0xF9, 0xF1, 0x66, 0xF1, 0x66, 0xF1, 0x66, 0xF1,
-    0x66, 0xF1, 0x66, 0xF1, 0x66, 0xA0, 0x05, 0xB1, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82,
+    0xFF, 0xF9, 0xEE, 0xDF, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C,
+    0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0xD0, 0xFF, 0x3B, 0xFB, 0xBC, 0xF1, 0x66, 0xFB, 0xBC, 0xFB,
+    0xBC, 0xFF, 0x47, 0xFB, 0xBC, 0xFB, 0xBC, 0xFB, 0xBC, 0xF1, 0x66, 0xF1, 0x66, 0xF1, 0x66, 0xF1,
+    0x66, 0xFF, 0xF9, 0xF1, 0x66, 0xA0, 0x05, 0xB1, 0x21, 0x8C, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x82,
     0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x94, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xEE, 0x95, 0x44, 0xD0,
     0xD1, 0x27, 0xD2, 0xFE, 0x9F, 0xFF, 0xB6, 0xFF, 0xF9, 0xF3, 0xB2, 0xA0, 0x06, 0x93, 0x21, 0xB3,
     0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBB, 0xB8, 0xFF, 0xFD, 0xEF,
@@ -349,10 +349,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xF1, 0x21, 0xD0, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD,
     0x22, 0xBC, 0xB0, 0xEB, 0xFD, 0x21, 0xD0, 0xFB, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x8C,
     0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xB4, 0xBB, 0xC4, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0x85, 0xFF,
-    0xFB, 0xEB, 0xA3, 0x50, 0xB1, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xB2,
-    0xB8, 0xB0, 0xB5, 0xBE, 0xFD, 0x2E, 0xF8, 0x7D, 0xFD, 0x58, 0xFD, 0x77, 0xFD, 0x83, 0xFD, 0x9F,
-    0xFD, 0xC0, 0xFD, 0xD8, 0xFD, 0xE4, 0xFE, 0x2B, 0xFD, 0xE4, 0xFE, 0x44, 0xFE, 0xB0, 0xFF, 0x07,
-    0xFF, 0x2D, 0xFF, 0xF6, 0x41, 0xBB, 0xFD, 0xC6, 0x21, 0xD0, 0xFC, 0x41, 0xB9, 0xEC, 0x0E, 0x21,
+    0xFB, 0xEB, 0xA3, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB,
+    0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0x07, 0xFD, 0x2E, 0xFE, 0x44, 0xF8, 0x7D, 0xFD, 0x58, 0xFF, 0x2D,
+    0xFD, 0x77, 0xFD, 0x83, 0xFE, 0xB0, 0xFD, 0xE4, 0xFD, 0x9F, 0xFD, 0xC0, 0xFD, 0xD8, 0xFD, 0xE4,
+    0xFF, 0xF6, 0xFE, 0x2B, 0x41, 0xBB, 0xFD, 0xC6, 0x21, 0xD0, 0xFC, 0x41, 0xB9, 0xEC, 0x0E, 0x21,
     0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xB6, 0xF0, 0xFD, 0x21, 0xD0, 0xFB,
     0x41, 0xBB, 0xEC, 0x7D, 0x21, 0xD0, 0xFC, 0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xBE, 0xB0,
     0xF0, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xF8, 0x24, 0xFF, 0xFB, 0xEB, 0x3A, 0x41, 0x8C,
@@ -368,9 +368,9 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xBC, 0xB1, 0xF5, 0x21, 0xFF, 0xFD, 0x21, 0xD0, 0xF9, 0x24, 0xB2, 0xB7, 0xB5, 0xBE, 0xC1, 0xD0,
     0xDD, 0xFD, 0x22, 0xD1, 0xD0, 0xAE, 0xF7, 0x21, 0xB4, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xEA,
     0x82, 0x41, 0xB4, 0xF6, 0x93, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xEA, 0x77, 0x50, 0x80, 0x81, 0x82,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x96, 0x83, 0x94, 0x97, 0x8C, 0x8E, 0x8F, 0xFF, 0x36, 0xFF,
-    0x5E, 0xFF, 0x81, 0xF7, 0x54, 0xFC, 0xBB, 0xFA, 0xDF, 0xFC, 0xBB, 0xFC, 0xBB, 0xFC, 0xBB, 0xFF,
-    0xEE, 0xFF, 0xF9, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xA0, 0x07, 0xF2,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0x36, 0xFF,
+    0x5E, 0xFF, 0x81, 0xFF, 0xF9, 0xF7, 0x54, 0xFC, 0xBB, 0xFA, 0xDF, 0xFC, 0xBB, 0xFC, 0xBB, 0xFC,
+    0xBB, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xEC, 0xFE, 0xFF, 0xEE, 0xEC, 0xFE, 0xA0, 0x07, 0xF2,
     0x21, 0xB7, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8F, 0xFD, 0xC2, 0x00, 0x72, 0xD1, 0x2D, 0xFF, 0xFD,
     0xEA, 0x33, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0x91, 0xFF, 0xBA, 0xFF, 0xF7, 0xEF, 0x4E, 0x41,
     0xB7, 0xF7, 0x3A, 0x41, 0x88, 0xF7, 0x36, 0x22, 0xD0, 0xD1, 0xF8, 0xFC, 0x42, 0xB4, 0xBD, 0xF7,
@@ -389,10 +389,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0x22, 0x80, 0x83, 0xE8, 0xFD, 0x21, 0xD1, 0xFB, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x41,
     0xB9, 0xF8, 0xA8, 0x21, 0xD0, 0xFC, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21,
     0xD0, 0xFD, 0x22, 0x81, 0x84, 0xEA, 0xFD, 0x41, 0xB5, 0xEC, 0x0D, 0x21, 0xD0, 0xFC, 0x21, 0xBC,
-    0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xF1, 0xFF, 0xFD, 0xE9, 0x1B, 0x50, 0xBA, 0xBF, 0xB3, 0xB2,
-    0xB4, 0xBB, 0xBC, 0xBD, 0xB5, 0xBE, 0xB0, 0xB1, 0xB6, 0xB7, 0xB8, 0xB9, 0xF5, 0xF5, 0xF5, 0xF5,
-    0xFB, 0x5C, 0xF5, 0xFE, 0xF5, 0xFE, 0xFF, 0x30, 0xF5, 0xFE, 0xFF, 0x5B, 0xFF, 0x98, 0xFF, 0xF6,
-    0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0x41, 0xD0, 0xF9, 0x28,
+    0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xF1, 0xFF, 0xFD, 0xE9, 0x1B, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xEB, 0x9F, 0xEB, 0x9F,
+    0xF5, 0xFE, 0xFB, 0x5C, 0xF5, 0xFE, 0xFF, 0x98, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F, 0xEB, 0x9F,
+    0xF5, 0xF5, 0xFF, 0x30, 0xF5, 0xFE, 0xFF, 0x5B, 0xFF, 0xF6, 0xF5, 0xF5, 0x41, 0xD0, 0xF9, 0x28,
     0x42, 0x82, 0x8C, 0xFF, 0xFC, 0xF5, 0xF3, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xF5, 0xBF, 0xFF,
     0xF9, 0xE8, 0xD5, 0x45, 0xB2, 0xB4, 0xB9, 0xBC, 0xBD, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5, 0xE6, 0xF5,
     0xE6, 0xF5, 0xE6, 0x41, 0xB7, 0xFB, 0xB1, 0x21, 0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
@@ -412,10 +412,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0x21, 0x96, 0xF1, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x96, 0xFD,
     0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB0, 0xB5, 0xE5, 0xFD, 0x21, 0xD0,
     0xFB, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0xB4, 0xBF,
-    0xC2, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xE7, 0xAA, 0x50, 0x81, 0x82, 0x84, 0x86, 0x87, 0x88,
-    0x80, 0x96, 0x94, 0x97, 0x83, 0x85, 0x89, 0x8C, 0x8E, 0x8F, 0xFE, 0xCE, 0xF9, 0xEE, 0xF4, 0x87,
-    0xF4, 0x87, 0xF4, 0x87, 0xF4, 0x87, 0xFF, 0x89, 0xFF, 0xF9, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31,
-    0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE,
+    0xC2, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xE7, 0xAA, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0x89, 0xFE, 0xCE, 0xF9, 0xEE,
+    0xEA, 0x31, 0xF4, 0x87, 0xEA, 0x31, 0xF4, 0x87, 0xF4, 0x87, 0xF4, 0x87, 0xEA, 0x31, 0xEA, 0x31,
+    0xEA, 0x31, 0xEA, 0x31, 0xEA, 0x31, 0xFF, 0xF9, 0xEA, 0x31, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE,
     0x61, 0xFF, 0xCF, 0xEC, 0x96, 0xEA, 0x00, 0x41, 0x8F, 0xF4, 0x82, 0xC2, 0x00, 0x42, 0xD1, 0x2D,
     0xFF, 0xFC, 0xE7, 0x61, 0x41, 0x8C, 0xE8, 0x2E, 0x21, 0xD1, 0xFC, 0x21, 0xBB, 0xFD, 0x21, 0xD0,
     0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD,
@@ -480,10 +480,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xBE, 0xFF, 0xFD, 0xFF, 0x38, 0x21, 0xD0, 0xF9, 0x21, 0x80, 0xFD, 0x22, 0xD0, 0xD1, 0xE8, 0xFD,
     0x41, 0x86, 0xE4, 0x12, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD,
     0x21, 0xD0, 0xFD, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0x82, 0x84, 0xE2, 0xFD, 0x22, 0xD0,
-    0xD1, 0xB5, 0xFB, 0x21, 0x81, 0xFB, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xE3, 0x66, 0x50, 0xBA, 0xBF,
-    0xB4, 0xB6, 0xB7, 0xBB, 0xBC, 0xBD, 0xBE, 0xB0, 0xB1, 0xB2, 0xB5, 0xB8, 0xB3, 0xB9, 0xF0, 0x43,
-    0xF0, 0x43, 0xFB, 0xFE, 0xFC, 0x23, 0xFC, 0x3B, 0xF0, 0x4C, 0xF0, 0x4C, 0xFC, 0x5C, 0xFD, 0x06,
-    0xFD, 0x10, 0xFD, 0x30, 0xFD, 0x7C, 0xFE, 0xB6, 0xFF, 0xF9, 0xE5, 0xED, 0xE5, 0xED, 0x42, 0x82,
+    0xD1, 0xB5, 0xFB, 0x21, 0x81, 0xFB, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xE3, 0x66, 0x50, 0xB0, 0xB1,
+    0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0x10,
+    0xFD, 0x30, 0xFD, 0x7C, 0xE5, 0xED, 0xFB, 0xFE, 0xFE, 0xB6, 0xFC, 0x23, 0xFC, 0x3B, 0xFF, 0xF9,
+    0xE5, 0xED, 0xF0, 0x43, 0xF0, 0x4C, 0xF0, 0x4C, 0xFC, 0x5C, 0xFD, 0x06, 0xF0, 0x43, 0x42, 0x82,
     0x8C, 0xFA, 0x4E, 0xF3, 0x89, 0xC2, 0x00, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xE3, 0x27, 0xA0, 0x00,
     0x92, 0x21, 0xBA, 0xFD, 0xC1, 0x00, 0x92, 0xD1, 0xF7, 0xEA, 0x23, 0x81, 0x82, 0x86, 0xFA, 0xF4,
     0xF4, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xF0, 0xFF, 0xF9, 0xEF, 0xF5, 0xE3, 0x0B, 0x41, 0xBC,
@@ -497,22 +497,22 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xB3, 0xFD, 0xA1, 0x02, 0x91, 0xD0, 0xFD, 0x41, 0xBB, 0xEA, 0x47, 0x21, 0xD0, 0xFC, 0x23, 0xB9,
     0xBE, 0xB0, 0xE3, 0xF4, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xD2, 0xFF, 0xF9, 0xE2, 0x77, 0x41,
     0xBC, 0xE5, 0x30, 0x21, 0xD0, 0xFC, 0x21, 0x96, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x42,
-    0xD1, 0x2D, 0xFF, 0xFD, 0xE2, 0x5D, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C,
-    0x80, 0x96, 0x83, 0x94, 0x97, 0x8E, 0x8F, 0xFF, 0x2F, 0xF4, 0xA1, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF,
-    0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xFF, 0x4B, 0xFF, 0x8F, 0xFF, 0xDF, 0xFF, 0xF9, 0xE4,
-    0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0xE4, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xC6, 0xFF, 0xCF,
+    0xD1, 0x2D, 0xFF, 0xFD, 0xE2, 0x5D, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0x8F, 0xFF, 0x2F, 0xF4, 0xA1, 0xFF, 0xF9, 0xEF,
+    0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xEF, 0x3A, 0xFF, 0x4B, 0xE4, 0xE4, 0xE4,
+    0xE4, 0xE4, 0xE4, 0xFF, 0xDF, 0xE4, 0xE4, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xC6, 0xFF, 0xCF,
     0xE7, 0x49, 0xE4, 0xB3, 0x41, 0xD1, 0xFC, 0x4E, 0x21, 0xB0, 0xFC, 0x21, 0xD0, 0xFD, 0x21, 0xBC,
     0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0xC2, 0x00, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xE2, 0x05,
     0x41, 0xD0, 0xF9, 0xCD, 0x21, 0xB0, 0xFC, 0x43, 0x2E, 0xD0, 0x2D, 0xEE, 0xDF, 0xFF, 0xFD, 0xE1,
     0xF5, 0x42, 0xD1, 0x2D, 0xEF, 0x05, 0xE1, 0xEB, 0x41, 0x82, 0xF9, 0x65, 0x21, 0xD1, 0xFC, 0x21,
     0x96, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xE1, 0xDA, 0x41, 0x87, 0xF4, 0xCB, 0x21, 0xD1, 0xFC,
     0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x42,
-    0xD0, 0x2D, 0xFF, 0xFD, 0xE1, 0xBD, 0x50, 0xBA, 0xBF, 0xB6, 0xB1, 0xB2, 0xB4, 0xBC, 0xBE, 0xB0,
-    0xB3, 0xB5, 0xB7, 0xB8, 0xB9, 0xBB, 0xBD, 0xFF, 0xB1, 0xEE, 0x9A, 0xEE, 0x9A, 0xEE, 0xA3, 0xFF,
-    0xC1, 0xFF, 0xCB, 0xFF, 0xDC, 0xFF, 0xF9, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4,
-    0x44, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x80,
-    0x94, 0x96, 0x97, 0x83, 0x89, 0x8C, 0x8E, 0x8F, 0xF1, 0xF4, 0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69,
-    0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69, 0xFF, 0xAB, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13,
+    0xD0, 0x2D, 0xFF, 0xFD, 0xE1, 0xBD, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
+    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xE4, 0x44, 0xEE, 0xA3, 0xFF, 0xC1, 0xE4, 0x44, 0xFF,
+    0xCB, 0xE4, 0x44, 0xEE, 0x9A, 0xE4, 0x44, 0xE4, 0x44, 0xE4, 0x44, 0xFF, 0xB1, 0xE4, 0x44, 0xFF,
+    0xDC, 0xE4, 0x44, 0xFF, 0xF9, 0xEE, 0x9A, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0xAB, 0xF1, 0xF4, 0xEE, 0x69, 0xE4, 0x13,
+    0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69, 0xEE, 0x69, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13,
     0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0xE4, 0x13, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x9E, 0xFF,
     0xCF, 0xE6, 0x78, 0xE3, 0xE2, 0x41, 0xB7, 0xF2, 0xC6, 0xA1, 0x05, 0xE2, 0xD0, 0xFC, 0x21, 0x8F,
     0xFB, 0x21, 0xD1, 0xFD, 0x42, 0xB6, 0xBD, 0xEE, 0x55, 0xEE, 0x55, 0x21, 0xD0, 0xF9, 0x42, 0xB4,
@@ -553,10 +553,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD,
     0xDF, 0x01, 0x43, 0xB0, 0xB5, 0xB8, 0xDE, 0xE2, 0xDE, 0xE2, 0xDE, 0xE2, 0x42, 0x83, 0x96, 0xDE,
     0xD8, 0xDE, 0xD8, 0x22, 0xD0, 0xD1, 0xEF, 0xF9, 0xA0, 0x05, 0x41, 0x22, 0xBA, 0xBE, 0xF8, 0xFD,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xDE, 0xDC, 0x50, 0xBA, 0xBF, 0xB7, 0xB2, 0xB3, 0xB4, 0xBB, 0xBC,
-    0xBD, 0xB0, 0xB1, 0xB9, 0xB5, 0xBE, 0xB6, 0xB8, 0xF1, 0x20, 0xEB, 0xB9, 0xEB, 0xB9, 0xFD, 0xED,
-    0xFE, 0x01, 0xFE, 0x45, 0xEB, 0xC2, 0xFE, 0x5C, 0xFE, 0xB0, 0xFF, 0x54, 0xFF, 0x9A, 0xFF, 0xA8,
-    0xFF, 0xD4, 0xFF, 0xF9, 0xE1, 0x63, 0xE1, 0x63, 0x41, 0xB5, 0xE6, 0xA7, 0xC2, 0x00, 0x42, 0xD0,
+    0x42, 0xD0, 0x2D, 0xFF, 0xFB, 0xDE, 0xDC, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0x54, 0xFF, 0x9A, 0xFD, 0xED, 0xFE, 0x01,
+    0xFE, 0x45, 0xFF, 0xD4, 0xE1, 0x63, 0xEB, 0xB9, 0xE1, 0x63, 0xFF, 0xA8, 0xF1, 0x20, 0xEB, 0xC2,
+    0xFE, 0x5C, 0xFE, 0xB0, 0xFF, 0xF9, 0xEB, 0xB9, 0x41, 0xB5, 0xE6, 0xA7, 0xC2, 0x00, 0x42, 0xD0,
     0x2D, 0xFF, 0xFC, 0xDE, 0xA0, 0xC1, 0x00, 0x92, 0x2E, 0xEB, 0xAB, 0x42, 0xBA, 0xB1, 0xFF, 0xFA,
     0xEB, 0xA8, 0x42, 0x81, 0x82, 0xFB, 0x6C, 0xFB, 0x6C, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xF2,
     0xFF, 0xF9, 0xEB, 0x6D, 0xDE, 0x83, 0x41, 0x83, 0xFB, 0x7C, 0x21, 0xD1, 0xFC, 0x21, 0xB7, 0xFD,
@@ -564,10 +564,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x21, 0xD0, 0xF6, 0x42, 0x8E, 0x96, 0xFC, 0x5D, 0xFF, 0xFD, 0x44, 0x2E, 0xD0, 0xD1, 0x2D, 0xEB,
     0x3C, 0xFF, 0xE9, 0xFF, 0xF9, 0xDE, 0x52, 0x41, 0x27, 0xFE, 0x37, 0x42, 0xB2, 0xBC, 0xFF, 0xFC,
     0xE8, 0xE8, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xDE, 0x3A, 0x41, 0xBE, 0xF2, 0x02, 0x21, 0xD0, 0xFC,
-    0x21, 0x80, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0xAE, 0xDE, 0x29, 0x50, 0x81, 0x82,
-    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x80, 0x96, 0x83, 0x94, 0x97, 0x8E, 0x8F, 0xEE, 0x8E,
-    0xEB, 0x03, 0xEB, 0x03, 0xEB, 0x03, 0xEB, 0x03, 0xFF, 0x7F, 0xEB, 0x03, 0xEB, 0x03, 0xFF, 0x9C,
-    0xFF, 0xCD, 0xFF, 0xE5, 0xFF, 0xF6, 0xE0, 0xAD, 0xE0, 0xAD, 0xE0, 0xAD, 0xE0, 0xAD, 0x41, 0xBE,
+    0x21, 0x80, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xFD, 0xF3, 0xAE, 0xDE, 0x29, 0x50, 0x80, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0xCD,
+    0xEE, 0x8E, 0xEB, 0x03, 0xFF, 0xF6, 0xEB, 0x03, 0xEB, 0x03, 0xEB, 0x03, 0xFF, 0x7F, 0xEB, 0x03,
+    0xEB, 0x03, 0xFF, 0x9C, 0xE0, 0xAD, 0xE0, 0xAD, 0xE0, 0xAD, 0xFF, 0xE5, 0xE0, 0xAD, 0x41, 0xBE,
     0xF3, 0xAF, 0x21, 0xD0, 0xFC, 0x21, 0x81, 0xFD, 0xA0, 0x01, 0xC1, 0x21, 0xB2, 0xFD, 0x22, 0xD1,
     0xD0, 0xF7, 0xFD, 0x41, 0xBD, 0xEF, 0x32, 0x21, 0xD0, 0xFC, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD,
     0x22, 0x8F, 0x94, 0xEE, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFB, 0xDD, 0xC7, 0x44, 0xD0, 0xD1, 0x27,
@@ -601,24 +601,24 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xCA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xDC, 0x0A, 0x41, 0x80, 0xDC, 0xCB, 0x21, 0xD1, 0xFC,
     0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21,
     0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x97, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD,
-    0xDB, 0xE1, 0x50, 0xB1, 0xB3, 0xB4, 0xB7, 0xBA, 0xB2, 0xBB, 0xBE, 0xB0, 0xB8, 0xB5, 0xB6, 0xB9,
-    0xBC, 0xBD, 0xBF, 0xE8, 0xBE, 0xE8, 0xBE, 0xE8, 0xBE, 0xE8, 0xBE, 0xEE, 0x25, 0xFE, 0x76, 0xFE,
-    0x80, 0xFF, 0x5A, 0xFF, 0xD0, 0xFF, 0xF9, 0xDE, 0x68, 0xDE, 0x68, 0xDE, 0x68, 0xDE, 0x68, 0xDE,
-    0x68, 0xDE, 0x68, 0xA0, 0x00, 0x42, 0x21, 0xBF, 0xFD, 0xC1, 0x00, 0x42, 0x2E, 0xE8, 0xB7, 0x21,
+    0xDB, 0xE1, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xFF, 0xD0, 0xE8, 0xBE, 0xFE, 0x76, 0xE8, 0xBE, 0xE8, 0xBE, 0xDE, 0x68, 0xDE,
+    0x68, 0xE8, 0xBE, 0xFF, 0xF9, 0xDE, 0x68, 0xEE, 0x25, 0xFE, 0x80, 0xDE, 0x68, 0xDE, 0x68, 0xFF,
+    0x5A, 0xDE, 0x68, 0xA0, 0x00, 0x42, 0x21, 0xBF, 0xFD, 0xC1, 0x00, 0x42, 0x2E, 0xE8, 0xB7, 0x21,
     0xBA, 0xF4, 0x42, 0xD0, 0x2E, 0xFF, 0xFD, 0xE8, 0xAE, 0x22, 0x82, 0x8C, 0xF0, 0xF9, 0x44, 0xD0,
     0xD1, 0x2E, 0x2D, 0xFF, 0xE8, 0xFF, 0xFB, 0xE8, 0x78, 0xDB, 0x8E, 0x41, 0xBD, 0xF3, 0x33, 0x21,
     0xD0, 0xFC, 0x21, 0xB0, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xE8, 0x61, 0xFF, 0xFD, 0xDB, 0x77, 0x41,
-    0x80, 0xE8, 0x84, 0x43, 0x2E, 0xD1, 0x2D, 0xE8, 0x53, 0xFF, 0xFC, 0xDB, 0x69, 0x50, 0x81, 0x80,
-    0x82, 0x85, 0x88, 0x94, 0x96, 0x97, 0x83, 0x84, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xD1,
-    0xFF, 0xE8, 0xFF, 0xF6, 0xE8, 0x4C, 0xE8, 0x4C, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED,
+    0x80, 0xE8, 0x84, 0x43, 0x2E, 0xD1, 0x2D, 0xE8, 0x53, 0xFF, 0xFC, 0xDB, 0x69, 0x50, 0x80, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0xE8,
+    0xFF, 0xD1, 0xFF, 0xF6, 0xDD, 0xED, 0xDD, 0xED, 0xE8, 0x4C, 0xDD, 0xED, 0xDD, 0xED, 0xE8, 0x4C,
     0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0xDD, 0xED, 0x44, 0xD0,
     0xD1, 0xD2, 0x27, 0xFF, 0x54, 0xFF, 0xCF, 0xE0, 0x52, 0xDD, 0xBC, 0x41, 0x81, 0xE8, 0x38, 0xC3,
     0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE8, 0x07, 0xFF, 0xFC, 0xDB, 0x1D, 0x44, 0x8F, 0x94, 0x8E, 0x8C,
     0xE8, 0x2E, 0xE8, 0x2E, 0xE8, 0x2E, 0xE8, 0x28, 0xC3, 0x00, 0x42, 0xD1, 0x2E, 0x2D, 0xFF, 0xF3,
-    0xE7, 0xEE, 0xDB, 0x04, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xBB,
-    0xB0, 0xB5, 0xB8, 0xB9, 0xBE, 0xED, 0x43, 0xE7, 0xDC, 0xED, 0x43, 0xED, 0x43, 0xE7, 0xDC, 0xE7,
-    0xDC, 0xED, 0x43, 0xFF, 0xDB, 0xED, 0x43, 0xED, 0x43, 0xFF, 0xF4, 0xDD, 0x86, 0xDD, 0x86, 0xDD,
-    0x86, 0xDD, 0x86, 0xDD, 0x86, 0x41, 0x91, 0xE7, 0xAB, 0x41, 0xB2, 0xE7, 0xDA, 0xC2, 0x00, 0x42,
+    0xE7, 0xEE, 0xDB, 0x04, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA,
+    0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xDD, 0x86, 0xED, 0x43, 0xE7, 0xDC, 0xED, 0x43, 0xED, 0x43, 0xDD,
+    0x86, 0xE7, 0xDC, 0xE7, 0xDC, 0xDD, 0x86, 0xDD, 0x86, 0xED, 0x43, 0xFF, 0xF4, 0xFF, 0xDB, 0xED,
+    0x43, 0xDD, 0x86, 0xED, 0x43, 0x41, 0x91, 0xE7, 0xAB, 0x41, 0xB2, 0xE7, 0xDA, 0xC2, 0x00, 0x42,
     0xD0, 0x2D, 0xFF, 0xFC, 0xDA, 0xBF, 0x41, 0x81, 0xEA, 0xFB, 0xC2, 0x00, 0x92, 0x2E, 0xD1, 0xE7,
     0xC6, 0xFF, 0xFC, 0x4B, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBC, 0xBD, 0xBF, 0xB9, 0xFC,
     0x12, 0xFC, 0x12, 0xFC, 0x12, 0xFF, 0xF7, 0xF7, 0x8B, 0xFC, 0x12, 0xFC, 0x12, 0xFC, 0x12, 0xFC,
@@ -627,9 +627,9 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xD1, 0xE7, 0x84, 0xEA, 0xBB, 0x49, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0xF7,
     0x49, 0xFF, 0xEE, 0xFF, 0xF7, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB, 0xD0, 0xFB,
     0xD0, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xA2, 0xFF, 0xE4, 0xE7, 0x35, 0xDA, 0x4B, 0x50, 0x80,
-    0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x8C, 0x94, 0x96, 0x97, 0x83, 0x88, 0x89, 0x8E, 0x8F, 0xE7,
-    0x22, 0xEC, 0x89, 0xEC, 0x89, 0xE7, 0x22, 0xFF, 0x7F, 0xE7, 0x22, 0xE7, 0x22, 0xFF, 0xF3, 0xDC,
-    0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0x44,
+    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xE7,
+    0x22, 0xEC, 0x89, 0xEC, 0x89, 0xDC, 0xCC, 0xE7, 0x22, 0xFF, 0x7F, 0xE7, 0x22, 0xE7, 0x22, 0xDC,
+    0xCC, 0xDC, 0xCC, 0xFF, 0xF3, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0xDC, 0xCC, 0x44,
     0xD0, 0xD2, 0xD1, 0x27, 0xFF, 0x15, 0xFF, 0x46, 0xFF, 0xCF, 0xDC, 0x9B, 0x41, 0xD1, 0xEE, 0xD2,
     0x21, 0xBB, 0xFC, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xE6, 0xE3, 0xFF, 0xFD, 0xFE, 0x8C,
     0xD9, 0xF9, 0x41, 0xB5, 0xEB, 0x69, 0x42, 0x83, 0x96, 0xEB, 0x65, 0xEB, 0x65, 0x22, 0xD0, 0xD1,
@@ -638,10 +638,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xC7, 0x41, 0xB9, 0xED, 0x59, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
     0xFD, 0x21, 0xD1, 0xFD, 0x42, 0xBA, 0xBD, 0xFF, 0xFD, 0xF7, 0xE5, 0x42, 0xD0, 0x2D, 0xFF, 0xF9,
     0xD9, 0xA1, 0x41, 0x82, 0xF0, 0x79, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xD9, 0x96, 0x41, 0xBD, 0xF9,
-    0xB7, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xD9, 0x8B, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA,
-    0xBB, 0xBD, 0xBF, 0xBC, 0xBE, 0xB5, 0xB0, 0xB8, 0xB9, 0xFF, 0x8B, 0xE6, 0x68, 0xEB, 0xCF, 0xE6,
-    0x68, 0xEB, 0xCF, 0xE6, 0x68, 0xFF, 0xAD, 0xEB, 0x6E, 0xFF, 0xBD, 0xEB, 0xCF, 0xEB, 0xCF, 0xFF,
-    0xE3, 0xFF, 0xEE, 0xFF, 0xF9, 0xDC, 0x12, 0xDC, 0x12, 0x41, 0x82, 0xE4, 0x8D, 0x21, 0xD1, 0xFC,
+    0xB7, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xD9, 0x8B, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
+    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0xF9, 0xFF, 0x8B, 0xE6, 0x68, 0xEB,
+    0xCF, 0xE6, 0x68, 0xFF, 0xEE, 0xEB, 0xCF, 0xE6, 0x68, 0xDC, 0x12, 0xDC, 0x12, 0xFF, 0xAD, 0xEB,
+    0x6E, 0xEB, 0xCF, 0xFF, 0xBD, 0xFF, 0xE3, 0xEB, 0xCF, 0x41, 0x82, 0xE4, 0x8D, 0x21, 0xD1, 0xFC,
     0x21, 0x96, 0xFD, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE6, 0x33, 0xFF, 0xFD, 0xD9, 0x49, 0x42,
     0x82, 0x8C, 0xF0, 0x5D, 0xEE, 0x1A, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xE6, 0x20, 0xFF, 0xF9,
     0xD9, 0x36, 0xC2, 0x00, 0x42, 0xD0, 0x2D, 0xDC, 0x61, 0xD9, 0x2A, 0x41, 0xBE, 0xE6, 0xF0, 0x21,
@@ -651,10 +651,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x21, 0x83, 0xFD, 0x41, 0x96, 0xDA, 0xE5, 0x21, 0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD,
     0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xB2, 0xBD, 0xFF, 0xFD, 0xE7, 0x5B, 0x21, 0xD0, 0xF9,
     0x21, 0xB0, 0xFD, 0x22, 0xD1, 0xD0, 0xDD, 0xFD, 0x43, 0xBD, 0xBE, 0xB6, 0xFF, 0xC2, 0xD8, 0xAC,
-    0xFF, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xD8, 0xBA, 0x50, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86,
-    0x87, 0x88, 0x89, 0x96, 0x94, 0x97, 0x83, 0x8C, 0x8E, 0x8F, 0xFF, 0x6A, 0xFF, 0x7D, 0xEA, 0xFE,
-    0xEA, 0xFE, 0xEA, 0xFE, 0xE5, 0x97, 0xE5, 0x97, 0xEA, 0xFE, 0xFF, 0x89, 0xFF, 0xF9, 0xDB, 0x41,
-    0xDB, 0x41, 0xDB, 0x41, 0xDB, 0x41, 0xDB, 0x41, 0xDB, 0x41, 0x41, 0x88, 0xEE, 0x43, 0x21, 0xD1,
+    0xFF, 0xFB, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xD8, 0xBA, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0x6A, 0xFF, 0x7D, 0xEA, 0xFE,
+    0xDB, 0x41, 0xEA, 0xFE, 0xEA, 0xFE, 0xE5, 0x97, 0xE5, 0x97, 0xEA, 0xFE, 0xFF, 0x89, 0xDB, 0x41,
+    0xDB, 0x41, 0xDB, 0x41, 0xDB, 0x41, 0xFF, 0xF9, 0xDB, 0x41, 0x41, 0x88, 0xEE, 0x43, 0x21, 0xD1,
     0xFC, 0x21, 0xBA, 0xFD, 0x41, 0x82, 0xEE, 0x39, 0x22, 0xD0, 0xD1, 0xF9, 0xFC, 0x21, 0x8F, 0xFB,
     0xC2, 0x00, 0x72, 0xD1, 0x2D, 0xFF, 0xFD, 0xD8, 0x6C, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0xDF,
     0xFF, 0xB0, 0xFF, 0xF7, 0xDD, 0x87, 0x42, 0x2E, 0xD1, 0xE5, 0x6A, 0xED, 0x28, 0x21, 0xBB, 0xF9,
@@ -724,10 +724,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x22, 0xD0, 0xD1, 0xE9, 0xF9, 0x41, 0xD0, 0xE7, 0x23, 0x43, 0x97, 0x83, 0x8F, 0xFF, 0xF7, 0xF4,
     0xC5, 0xFF, 0xFC, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xB3, 0xFF, 0xF6, 0xD4, 0x49, 0x41, 0x82, 0xD8,
     0x33, 0x21, 0xD1, 0xFC, 0x21, 0x83, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD,
-    0x42, 0xBC, 0xBA, 0xDE, 0xD3, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xD4, 0x25, 0x50, 0xB1,
-    0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBF, 0xBD, 0xB5, 0xB0, 0xBE, 0xB8, 0xB9, 0xE1,
-    0x02, 0xE6, 0x69, 0xFB, 0xD9, 0xFB, 0xF2, 0xE6, 0x69, 0xE6, 0x69, 0xFC, 0x08, 0xE1, 0x02, 0xE6,
-    0x69, 0xE1, 0x02, 0xFC, 0x14, 0xFD, 0x6A, 0xFF, 0xD5, 0xFF, 0xF9, 0xD6, 0xAC, 0xD6, 0xAC, 0x41,
+    0x42, 0xBC, 0xBA, 0xDE, 0xD3, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xD4, 0x25, 0x50, 0xB0,
+    0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF,
+    0xD5, 0xE1, 0x02, 0xE6, 0x69, 0xFB, 0xD9, 0xFB, 0xF2, 0xFD, 0x6A, 0xE6, 0x69, 0xE6, 0x69, 0xD6,
+    0xAC, 0xD6, 0xAC, 0xFC, 0x08, 0xE1, 0x02, 0xE6, 0x69, 0xFC, 0x14, 0xFF, 0xF9, 0xE1, 0x02, 0x41,
     0xBA, 0xE1, 0x04, 0x41, 0xB9, 0xE4, 0x2E, 0x42, 0x2E, 0xD0, 0xE4, 0x27, 0xFF, 0xFC, 0x21, 0xBA,
     0xF9, 0x21, 0xD0, 0xFD, 0x42, 0x82, 0x8C, 0xE4, 0x26, 0xFF, 0xFD, 0xC4, 0x00, 0x42, 0x2E, 0xD0,
     0xD1, 0x2D, 0xE0, 0xBB, 0xFF, 0xE4, 0xFF, 0xF9, 0xD3, 0xD1, 0x41, 0x96, 0xFE, 0xD6, 0x21, 0xD1,
@@ -740,9 +740,9 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x4E, 0xF0, 0x4E, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xD7, 0xFF, 0xED, 0xE0, 0x43, 0xD3, 0x59,
     0x41, 0x82, 0xE6, 0xEA, 0x21, 0xD1, 0xFC, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD,
     0x21, 0xD1, 0xFD, 0x42, 0x82, 0x8F, 0xFF, 0xFD, 0xEE, 0x54, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xD3,
-    0x32, 0x50, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x96, 0x94, 0x97, 0x83,
-    0x8E, 0x8F, 0xE5, 0x76, 0xFF, 0x5A, 0xFF, 0x9A, 0xE5, 0x76, 0xE5, 0x76, 0xE5, 0x15, 0xE5, 0x76,
-    0xE5, 0x76, 0xE0, 0x0F, 0xFF, 0xD2, 0xFF, 0xF9, 0xD5, 0xB9, 0xD5, 0xB9, 0xD5, 0xB9, 0xD5, 0xB9,
+    0x32, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94,
+    0x96, 0x97, 0xE5, 0x76, 0xFF, 0x5A, 0xFF, 0x9A, 0xD5, 0xB9, 0xE5, 0x76, 0xE5, 0x76, 0xE5, 0x15,
+    0xE5, 0x76, 0xE5, 0x76, 0xE0, 0x0F, 0xFF, 0xD2, 0xD5, 0xB9, 0xD5, 0xB9, 0xD5, 0xB9, 0xFF, 0xF9,
     0xD5, 0xB9, 0xC1, 0x00, 0x72, 0x2D, 0xD2, 0xFA, 0x44, 0xD0, 0xD1, 0x27, 0xD2, 0xFE, 0xD6, 0xFF,
     0xC9, 0xFF, 0xFA, 0xD8, 0x18, 0x41, 0x80, 0xE5, 0x9E, 0x21, 0xD1, 0xFC, 0x21, 0xBE, 0xFD, 0x21,
     0xD0, 0xFD, 0x42, 0xB5, 0xB0, 0xFB, 0x1B, 0xE5, 0x91, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xFC, 0xA6,
@@ -815,10 +815,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xB5, 0xF8, 0xF1, 0x21, 0xD0, 0xFC, 0x21, 0x82,
     0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x22, 0xBE, 0xB5, 0xEA, 0xFD, 0x21,
     0xD0, 0xFB, 0x42, 0xBB, 0xBD, 0xE5, 0x69, 0xFF, 0xFD, 0x21, 0xB5, 0xEE, 0x21, 0xD0, 0xFD, 0x21,
-    0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xCE, 0x7A, 0x50, 0xB1, 0xB4, 0xB7,
-    0xBF, 0xBB, 0xBE, 0xB5, 0xB0, 0xB2, 0xB3, 0xB6, 0xB8, 0xB9, 0xBA, 0xBC, 0xBD, 0xDB, 0x54, 0xE0,
-    0xBB, 0xDB, 0x54, 0xDB, 0x54, 0xDB, 0x5D, 0xFE, 0x76, 0xFF, 0xA8, 0xFF, 0xF6, 0xD0, 0xFE, 0xD0,
-    0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0xD0, 0xFE, 0x41, 0xBE, 0xE0,
+    0x80, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF0, 0xFF, 0xFD, 0xCE, 0x7A, 0x50, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0xF6, 0xDB,
+    0x54, 0xD0, 0xFE, 0xD0, 0xFE, 0xE0, 0xBB, 0xFF, 0xA8, 0xD0, 0xFE, 0xDB, 0x54, 0xD0, 0xFE, 0xD0,
+    0xFE, 0xD0, 0xFE, 0xDB, 0x5D, 0xD0, 0xFE, 0xD0, 0xFE, 0xFE, 0x76, 0xDB, 0x54, 0x41, 0xBE, 0xE0,
     0x97, 0x21, 0xD0, 0xFC, 0x42, 0xB2, 0xBD, 0xCE, 0xE5, 0xCE, 0xE5, 0x21, 0xD0, 0xF9, 0x43, 0xBF,
     0xBA, 0xBE, 0xF2, 0x85, 0xFF, 0xF3, 0xFF, 0xFD, 0xC1, 0x00, 0x42, 0xD0, 0xDE, 0x6C, 0x43, 0x82,
     0x8C, 0x83, 0xFF, 0xFA, 0xF2, 0x84, 0xCF, 0x49, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF, 0xE6, 0xFF,
@@ -851,10 +851,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x41, 0xBE, 0xFE,
     0x71, 0x21, 0xD0, 0xFC, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x96, 0x83, 0xF0, 0xFD, 0x22,
     0xD0, 0xD1, 0xCE, 0xFB, 0x41, 0xBC, 0xCD, 0x10, 0x21, 0xD0, 0xFC, 0x43, 0xB4, 0xB2, 0xB9, 0xFF,
-    0x80, 0xFF, 0xF4, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xCC, 0x37, 0x50, 0x81, 0x80, 0x82,
-    0x84, 0x86, 0x96, 0x94, 0x97, 0x83, 0x85, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xFE, 0x1C, 0xFF,
-    0x2E, 0xF0, 0xC7, 0xD9, 0x1D, 0xD9, 0x1D, 0xFF, 0xF9, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE,
-    0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0x44, 0xD0, 0xD1,
+    0x80, 0xFF, 0xF4, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF6, 0xCC, 0x37, 0x50, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0x2E, 0xFE,
+    0x1C, 0xF0, 0xC7, 0xCE, 0xBE, 0xD9, 0x1D, 0xCE, 0xBE, 0xD9, 0x1D, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE,
+    0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xCE, 0xBE, 0xFF, 0xF9, 0xCE, 0xBE, 0x44, 0xD0, 0xD1,
     0xD2, 0x27, 0xFD, 0x8F, 0xFF, 0xCF, 0xD1, 0x23, 0xCE, 0x8D, 0x41, 0xBB, 0xD9, 0x09, 0xC3, 0x00,
     0x42, 0x2E, 0xD0, 0x2D, 0xD8, 0xD8, 0xFF, 0xFC, 0xCB, 0xEE, 0x42, 0x2E, 0xD1, 0xCC, 0x8F, 0xF2,
     0x8F, 0x43, 0x81, 0x83, 0x96, 0xD8, 0xF2, 0xFF, 0xF9, 0xF2, 0x8C, 0x41, 0xBD, 0xCF, 0x05, 0x21,
@@ -863,21 +863,21 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xBE, 0xCC, 0x5D, 0xFF, 0xE3, 0xFF, 0xEA, 0xFF, 0xFD, 0xC4, 0x00, 0x42, 0x2E, 0xD1, 0xD0, 0x2D,
     0xD8, 0x8D, 0xFF, 0xC8, 0xFF, 0xF3, 0xCB, 0xA3, 0x41, 0x81, 0xD1, 0x23, 0xC2, 0x00, 0xE2, 0xD1,
     0x2D, 0xFF, 0xFC, 0xCB, 0x90, 0x41, 0xB5, 0xEB, 0x94, 0x21, 0xD0, 0xFC, 0x21, 0x82, 0xFD, 0x21,
-    0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xCB, 0x77, 0x50, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xBE, 0xB5, 0xB0, 0xB8, 0xDD, 0xBB, 0xDD,
-    0xBB, 0xDD, 0xBB, 0xDD, 0xBB, 0xD8, 0x54, 0xDD, 0xBB, 0xFF, 0x82, 0xDD, 0x5A, 0xFF, 0xCD, 0xF0,
-    0x53, 0xDD, 0xBB, 0xD8, 0x54, 0xFF, 0xE0, 0xFF, 0xF9, 0xCD, 0xFE, 0xCD, 0xFE, 0x42, 0x82, 0x8C,
+    0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xCB, 0x77, 0x50, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xCD, 0xFE, 0xDD,
+    0xBB, 0xDD, 0xBB, 0xDD, 0xBB, 0xDD, 0xBB, 0xFF, 0xF9, 0xD8, 0x54, 0xDD, 0xBB, 0xCD, 0xFE, 0xD8,
+    0x54, 0xFF, 0x82, 0xDD, 0x5A, 0xFF, 0xCD, 0xF0, 0x53, 0xFF, 0xE0, 0xDD, 0xBB, 0x42, 0x82, 0x8C,
     0xDB, 0x8D, 0xE0, 0x1C, 0xC3, 0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xD8, 0x22, 0xFF, 0xF9, 0xCB, 0x38,
     0x42, 0xBB, 0xBE, 0xDC, 0xAB, 0xCC, 0x57, 0xC3, 0x00, 0x42, 0x2E, 0xD0, 0x2D, 0xD8, 0x0F, 0xFF,
     0xF9, 0xCB, 0x25, 0x41, 0xB3, 0xCD, 0xDC, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD,
-    0x21, 0xB1, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xCB, 0x09, 0x50, 0x80, 0x81, 0x82, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x89, 0x83, 0x94, 0x96, 0x97, 0x8C, 0x8E, 0x8F, 0xDD, 0x4D, 0xFF, 0xCA, 0xEF,
-    0xE5, 0xDD, 0x4D, 0xDD, 0x4D, 0xDD, 0x4D, 0xDD, 0x4D, 0xFF, 0xDD, 0xD7, 0xE6, 0xFF, 0xF9, 0xCD,
+    0x21, 0xB1, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xCB, 0x09, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xDD, 0x4D, 0xFF, 0xCA, 0xEF,
+    0xE5, 0xFF, 0xF9, 0xDD, 0x4D, 0xDD, 0x4D, 0xDD, 0x4D, 0xDD, 0x4D, 0xFF, 0xDD, 0xD7, 0xE6, 0xCD,
     0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0xCD, 0x90, 0x44, 0xD0, 0xD1, 0xD2, 0x27,
-    0xFF, 0x61, 0xFF, 0xCF, 0xCF, 0xF5, 0xCD, 0x5F, 0x50, 0xB0, 0xB5, 0xB8, 0xBE, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB6, 0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xCF, 0xEC, 0xD3, 0x12, 0xD3, 0xD4, 0xD7,
-    0x99, 0xDC, 0x36, 0xE0, 0x9A, 0xE3, 0x52, 0xE8, 0x9F, 0xE9, 0x70, 0xED, 0x04, 0xEF, 0x96, 0xF0,
-    0xB7, 0xF2, 0x61, 0xF7, 0xD0, 0xFE, 0xC5, 0xFF, 0xF3, 0x41, 0x82, 0xCA, 0xA6, 0xC2, 0x00, 0x61,
+    0xFF, 0x61, 0xFF, 0xCF, 0xCF, 0xF5, 0xCD, 0x5F, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
+    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xCF, 0xEC, 0xDC, 0x36, 0xE0, 0x9A, 0xE3,
+    0x52, 0xE8, 0x9F, 0xD3, 0x12, 0xE9, 0x70, 0xED, 0x04, 0xD3, 0xD4, 0xFF, 0xF3, 0xEF, 0x96, 0xF0,
+    0xB7, 0xF2, 0x61, 0xF7, 0xD0, 0xD7, 0x99, 0xFE, 0xC5, 0x41, 0x82, 0xCA, 0xA6, 0xC2, 0x00, 0x61,
     0xD1, 0x2D, 0xFF, 0xFC, 0xCA, 0x8F, 0xC1, 0x00, 0xC1, 0xD0, 0xE8, 0xC0, 0x41, 0xD1, 0xD4, 0x32,
     0x22, 0xBD, 0xBA, 0xF6, 0xFC, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xFF, 0xFB, 0xCA, 0x77, 0xC2, 0x00,
     0xD1, 0xD1, 0x2D, 0xD2, 0xFC, 0xCA, 0x6E, 0xA0, 0x06, 0x42, 0x21, 0x8E, 0xFD, 0x21, 0xD1, 0xFD,
@@ -892,15 +892,15 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x8E, 0xFD, 0x41, 0xBB, 0xE3, 0x0D, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
     0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE7, 0xFF, 0xFD,
     0xC9, 0xC4, 0x41, 0x96, 0xCB, 0x96, 0x21, 0xD1, 0xFC, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC9, 0xAA, 0x50, 0xB0, 0xB5, 0xB8, 0xBE, 0xB9, 0xBD,
-    0xB7, 0xBB, 0xBC, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xBA, 0xBF, 0xC9, 0xA6, 0xFF, 0x14, 0xCC, 0xCD,
-    0xFF, 0x2C, 0xFF, 0x35, 0xFF, 0xA1, 0xFF, 0xB8, 0xFF, 0xDF, 0xFF, 0xF9, 0xCC, 0x31, 0xCC, 0x31,
-    0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0xCC, 0x31, 0x41, 0x83, 0xCA, 0x9D, 0x21, 0xD1,
+    0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC9, 0xAA, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC9, 0xA6, 0xCC, 0x31, 0xCC, 0x31,
+    0xCC, 0x31, 0xCC, 0x31, 0xFF, 0x14, 0xCC, 0x31, 0xFF, 0xB8, 0xCC, 0xCD, 0xFF, 0x35, 0xCC, 0x31,
+    0xFF, 0xDF, 0xFF, 0xF9, 0xFF, 0xA1, 0xFF, 0x2C, 0xCC, 0x31, 0x41, 0x83, 0xCA, 0x9D, 0x21, 0xD1,
     0xFC, 0x21, 0xBD, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC9, 0x68, 0x42, 0xD1, 0x2D, 0xCC, 0x39,
-    0xC9, 0x61, 0x50, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x81, 0x96, 0x80, 0x82, 0x84, 0x85, 0x86, 0x87,
-    0x88, 0x89, 0x8C, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xFF, 0xF2, 0xFF,
-    0xF9, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB,
-    0xE8, 0xCB, 0xE8, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x86, 0xFF, 0xCF, 0xCE, 0x4D,
+    0xC9, 0x61, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F,
+    0x94, 0x96, 0x97, 0xCB, 0xE8, 0xFF, 0xF2, 0xCB, 0xE8, 0xCC, 0x84, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB,
+    0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCB, 0xE8, 0xCC, 0x84, 0xCC, 0x84, 0xCC, 0x84, 0xFF,
+    0xF9, 0xCC, 0x84, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x86, 0xFF, 0xCF, 0xCE, 0x4D,
     0xCB, 0xB7, 0x42, 0xB3, 0xB6, 0xC9, 0xC7, 0xC9, 0xC7, 0x21, 0xD0, 0xF9, 0x21, 0xB0, 0xFD, 0x43,
     0x27, 0xD0, 0x2D, 0xDB, 0x49, 0xFF, 0xFD, 0xC9, 0x0D, 0x41, 0x96, 0xCA, 0x5E, 0x44, 0x27, 0xD0,
     0xD1, 0x2D, 0xDB, 0x3B, 0xC9, 0xB5, 0xFF, 0xFC, 0xC8, 0xFF, 0x41, 0xB0, 0xDB, 0x4A, 0x21, 0xD0,
@@ -915,10 +915,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xD0, 0xF9, 0x41, 0xBA, 0xD6, 0x09, 0x21, 0xD0, 0xFC, 0x22, 0xB0, 0xB5, 0xF6, 0xFD, 0xA2, 0x06,
     0xA2, 0xD1, 0xD0, 0xE5, 0xFB, 0x21, 0x80, 0xF9, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xAC, 0xFF, 0xFD,
     0xC8, 0x54, 0x41, 0xBB, 0xCB, 0x84, 0x21, 0xD0, 0xFC, 0x21, 0xB1, 0xFD, 0x21, 0xD0, 0xFD, 0x21,
-    0x8E, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xC8, 0x3A, 0x50, 0xB0, 0xB5, 0xBE, 0xB9, 0xB2, 0xBC,
-    0xBF, 0xB3, 0xB7, 0xBA, 0xBB, 0xB1, 0xB4, 0xB6, 0xB8, 0xBD, 0xCB, 0x5D, 0xCB, 0x5D, 0xCB, 0x5D,
-    0xCE, 0x5F, 0xFF, 0x26, 0xFF, 0x34, 0xFF, 0x5B, 0xFF, 0x69, 0xFF, 0x77, 0xFF, 0xDF, 0xFF, 0xF9,
-    0xD0, 0xDA, 0xCA, 0xC1, 0xCA, 0xC1, 0xCA, 0xC1, 0xCA, 0xC1, 0x41, 0xB2, 0xE1, 0x1A, 0xC2, 0x00,
+    0x8E, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xC8, 0x3A, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+    0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xCB, 0x5D, 0xD0, 0xDA, 0xFF, 0x26,
+    0xFF, 0x69, 0xCA, 0xC1, 0xCB, 0x5D, 0xCA, 0xC1, 0xFF, 0x77, 0xCA, 0xC1, 0xCE, 0x5F, 0xFF, 0xDF,
+    0xFF, 0xF9, 0xFF, 0x34, 0xCA, 0xC1, 0xCB, 0x5D, 0xFF, 0x5B, 0x41, 0xB2, 0xE1, 0x1A, 0xC2, 0x00,
     0x61, 0xD0, 0x2D, 0xFF, 0xFC, 0xC7, 0xFE, 0xC2, 0x00, 0x61, 0xD0, 0x2D, 0xCD, 0xA1, 0xC7, 0xF5,
     0x41, 0x81, 0xC8, 0x9F, 0x21, 0xD1, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x87, 0xFD,
     0x21, 0xD1, 0xFD, 0x43, 0xB0, 0xB1, 0xBE, 0xDC, 0x97, 0xD9, 0xAB, 0xFF, 0xFD, 0xC1, 0x00, 0xB2,
@@ -929,34 +929,34 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0, 0xFD, 0x22, 0x82,
     0x83, 0xE4, 0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xD0, 0xFF, 0xFB, 0xC7, 0x79, 0x41, 0xB2, 0xC9,
     0x51, 0x41, 0xB1, 0xCA, 0x9F, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
-    0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xC7, 0x5B, 0x50, 0x96, 0x83, 0x8E, 0x8F,
-    0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xFF, 0x53, 0xCA, 0x7B,
-    0xCA, 0x7B, 0xFF, 0x5C, 0xCA, 0x7B, 0xCA, 0x7B, 0xFF, 0x91, 0xFF, 0xD8, 0xFF, 0xF6, 0xC9, 0xDF,
-    0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC4, 0x00, 0x42, 0xD0,
-    0xD1, 0xD2, 0x27, 0xFE, 0xED, 0xFF, 0xCF, 0xCC, 0x44, 0xC9, 0xAE, 0x50, 0xB0, 0xB5, 0xBE, 0xB9,
-    0xB1, 0xB2, 0xB3, 0xB4, 0xB6, 0xB7, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xCA, 0x3B, 0xCA, 0x3B,
-    0xCA, 0x3B, 0xCD, 0x3D, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F,
-    0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0x50, 0x96, 0x83, 0x8E,
-    0x8F, 0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xCA, 0x0A, 0xCA,
-    0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9,
-    0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC4, 0x00, 0x42,
+    0xFD, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xC7, 0x5B, 0x50, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0x91, 0xFF, 0xD8,
+    0xFF, 0xF6, 0xCA, 0x7B, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF, 0xC9, 0xDF,
+    0xC9, 0xDF, 0xCA, 0x7B, 0xFF, 0x5C, 0xCA, 0x7B, 0xFF, 0x53, 0xCA, 0x7B, 0xC4, 0x00, 0x42, 0xD0,
+    0xD1, 0xD2, 0x27, 0xFE, 0xED, 0xFF, 0xCF, 0xCC, 0x44, 0xC9, 0xAE, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xCA, 0x3B, 0xC9, 0x9F,
+    0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xCA, 0x3B, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xCD, 0x3D,
+    0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xC9, 0x9F, 0xCA, 0x3B, 0xC9, 0x9F, 0x50, 0x80, 0x81, 0x82,
+    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xC9, 0x6E, 0xC9,
+    0x6E, 0xC9, 0x6E, 0xCA, 0x0A, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9, 0x6E, 0xC9,
+    0x6E, 0xC9, 0x6E, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xCA, 0x0A, 0xC4, 0x00, 0x42,
     0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF, 0xCB, 0xD3, 0xC9, 0x3D, 0xC2, 0x00, 0x61, 0xD0,
     0x2D, 0xCC, 0x1D, 0xC6, 0xA0, 0x41, 0xB5, 0xFA, 0xD8, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC6, 0x93,
     0x41, 0xBA, 0xC7, 0x39, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC6,
-    0x82, 0x41, 0x96, 0xC7, 0x79, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xC6, 0x77, 0x50, 0xB0, 0xB5, 0xBE,
-    0xB9, 0xB4, 0xB7, 0xBA, 0xB1, 0xB2, 0xB3, 0xB6, 0xB8, 0xBB, 0xBC, 0xBD, 0xBF, 0xCE, 0xD1, 0xFF,
-    0xD0, 0xC9, 0x9A, 0xCC, 0x9C, 0xFF, 0xDD, 0xFF, 0xEE, 0xFF, 0xF9, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8,
-    0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0x41, 0x83, 0xC7,
+    0x82, 0x41, 0x96, 0xC7, 0x79, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xC6, 0x77, 0x50, 0xB0, 0xB1, 0xB2,
+    0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xCE, 0xD1, 0xC8,
+    0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xFF, 0xDD, 0xFF, 0xD0, 0xC8, 0xFE, 0xFF, 0xEE, 0xC8, 0xFE, 0xCC,
+    0x9C, 0xFF, 0xF9, 0xC8, 0xFE, 0xC8, 0xFE, 0xC8, 0xFE, 0xC9, 0x9A, 0xC8, 0xFE, 0x41, 0x83, 0xC7,
     0x3D, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xC6, 0x3B, 0x41, 0xD0, 0xFD, 0x66, 0x21, 0x80, 0xFC, 0x21,
     0xD1, 0xFD, 0x42, 0xBA, 0xBE, 0xFF, 0xFD, 0xC7, 0x0C, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xC6, 0x23,
-    0x50, 0x83, 0x8E, 0x8F, 0x94, 0x97, 0x80, 0x81, 0x96, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
-    0x8C, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xFF, 0xE1, 0xFF, 0xF9, 0xFC,
-    0xBB, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8,
-    0xAA, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x7B, 0xFF, 0xCF, 0xCB, 0x0F, 0xC8, 0x79,
-    0x41, 0xB5, 0xDA, 0x7F, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC5, 0xD8, 0x50, 0x83, 0x8E, 0x94, 0x97,
-    0x80, 0x96, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8F, 0xC8, 0xFB, 0xC8, 0xFB,
-    0xC8, 0xFB, 0xC8, 0xFB, 0xFF, 0xF9, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F,
-    0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xA0, 0x06, 0xC3, 0x42,
+    0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96,
+    0x97, 0xFF, 0xE1, 0xFF, 0xF9, 0xC8, 0xAA, 0xC9, 0x46, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8,
+    0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC8, 0xAA, 0xC9, 0x46, 0xC9, 0x46, 0xC9, 0x46, 0xFC, 0xBB, 0xC9,
+    0x46, 0xC4, 0x00, 0x42, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x7B, 0xFF, 0xCF, 0xCB, 0x0F, 0xC8, 0x79,
+    0x41, 0xB5, 0xDA, 0x7F, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC5, 0xD8, 0x50, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0xF9, 0xC8, 0x5F,
+    0xC8, 0x5F, 0xC8, 0xFB, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F, 0xC8, 0x5F,
+    0xC8, 0x5F, 0xC8, 0xFB, 0xC8, 0x5F, 0xC8, 0xFB, 0xC8, 0x5F, 0xC8, 0xFB, 0xA0, 0x06, 0xC3, 0x42,
     0xBD, 0xB8, 0xFF, 0xFD, 0xC8, 0xD1, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xC5, 0x96, 0x41, 0xBF, 0xDF,
     0xD0, 0x21, 0xD0, 0xFC, 0x21, 0xBE, 0xFD, 0xA1, 0x00, 0xB2, 0xD0, 0xFD, 0x21, 0xBA, 0xFB, 0x21,
     0xD0, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xE9, 0x21, 0xBA,
@@ -964,19 +964,19 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x2D, 0xFF, 0xEB, 0xFF, 0xFD, 0xC5, 0x5F, 0x41, 0xBE, 0xC9, 0xC1, 0x21, 0xD0, 0xFC, 0x21, 0x82,
     0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D,
     0xFF, 0xFD, 0xC5, 0x3F, 0x41, 0x80, 0xDC, 0xEA, 0x21, 0xD1, 0xFC, 0x21, 0xB5, 0xFD, 0x42, 0xD0,
-    0x2D, 0xFF, 0xFD, 0xC5, 0x2E, 0x50, 0xB9, 0xB4, 0xBF, 0xB2, 0xB3, 0xB0, 0xB1, 0xB5, 0xB6, 0xB7,
-    0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xCB, 0x53, 0xFF, 0x91, 0xFF, 0xC8, 0xFF, 0xE8, 0xFF, 0xF9,
-    0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5,
-    0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC4, 0x00, 0x42, 0xD1, 0xD0, 0xD2, 0x27, 0xFF, 0x25, 0xFF,
+    0x2D, 0xFF, 0xFD, 0xC5, 0x2E, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
+    0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC7, 0xB5, 0xC7, 0xB5, 0xFF, 0xE8, 0xFF, 0xF9, 0xFF, 0x91,
+    0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5, 0xCB, 0x53, 0xC7, 0xB5, 0xC7, 0xB5, 0xC7, 0xB5,
+    0xC7, 0xB5, 0xC7, 0xB5, 0xFF, 0xC8, 0xC4, 0x00, 0x42, 0xD1, 0xD0, 0xD2, 0x27, 0xFF, 0x25, 0xFF,
     0xCF, 0xCA, 0x1A, 0xC7, 0x84, 0x41, 0xB4, 0xCF, 0x95, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC4, 0xE3,
-    0x42, 0xD0, 0x2D, 0xCC, 0xB4, 0xC4, 0xDC, 0x50, 0xB5, 0xBE, 0xB9, 0xB6, 0xB7, 0xB0, 0xB1, 0xB2,
-    0xB3, 0xB4, 0xB8, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xC7, 0xFF, 0xC7, 0xFF, 0xCB, 0x01, 0xFF, 0xF2,
-    0xFF, 0xF9, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63,
-    0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0x42, 0xD1, 0x2D, 0xC5, 0x54, 0xC4, 0xA4, 0x41,
-    0xB0, 0xE5, 0x3C, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC4, 0x99, 0x50, 0x8E, 0x81, 0x85, 0x94, 0x96,
-    0x97, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8F, 0xC7, 0xBC, 0xFF, 0xEE, 0xFF,
-    0xF9, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7,
-    0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC4, 0x00, 0x42, 0xD0, 0xD1,
+    0x42, 0xD0, 0x2D, 0xCC, 0xB4, 0xC4, 0xDC, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7,
+    0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63, 0xC7, 0x63,
+    0xC7, 0x63, 0xC7, 0xFF, 0xFF, 0xF2, 0xFF, 0xF9, 0xC7, 0x63, 0xCB, 0x01, 0xC7, 0x63, 0xC7, 0x63,
+    0xC7, 0x63, 0xC7, 0x63, 0xC7, 0xFF, 0xC7, 0x63, 0x42, 0xD1, 0x2D, 0xC5, 0x54, 0xC4, 0xA4, 0x41,
+    0xB0, 0xE5, 0x3C, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC4, 0x99, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84,
+    0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xC7, 0x20, 0xFF, 0xEE, 0xC7,
+    0x20, 0xC7, 0x20, 0xC7, 0x20, 0xFF, 0xF9, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7,
+    0x20, 0xC7, 0xBC, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC7, 0x20, 0xC4, 0x00, 0x42, 0xD0, 0xD1,
     0xD2, 0x27, 0xFF, 0x8C, 0xFF, 0xCF, 0xC9, 0x85, 0xC6, 0xEF, 0x42, 0xD0, 0xD1, 0xC5, 0x79, 0xFC,
     0xC2, 0x21, 0xB0, 0xF9, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1, 0x2D, 0xD1, 0x32, 0xFF, 0xFD, 0xEA,
     0xFC, 0xC4, 0x48, 0x42, 0xB2, 0xB6, 0xD1, 0x50, 0xD1, 0x50, 0xC4, 0x00, 0x42, 0x2E, 0xD0, 0xD1,
@@ -1008,10 +1008,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFF, 0xD1, 0xFF, 0xFD, 0x21, 0xB7, 0xF6, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xC2, 0x95, 0x41, 0xBE,
     0xC4, 0x8A, 0x21, 0xD0, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB2, 0xFD, 0x21, 0xD0,
     0xFD, 0x42, 0xB4, 0xB9, 0xD8, 0xF0, 0xFF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xC2, 0x74, 0x41,
-    0xB0, 0xEE, 0xC1, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC2, 0x69, 0x50, 0xB1, 0xB2, 0xB3, 0xB4, 0xB6,
-    0xB7, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xB9, 0xBE, 0xB0, 0xB5, 0xB8, 0xD4, 0xAD, 0xFE, 0x1A, 0xD4,
-    0xAD, 0xFE, 0x30, 0xD4, 0xAD, 0xFE, 0x43, 0xEA, 0x4C, 0xFE, 0x60, 0xFE, 0x6C, 0xFE, 0x8A, 0xD4,
-    0xAD, 0xCF, 0x46, 0xFF, 0xCD, 0xFF, 0xEE, 0xFF, 0xF9, 0xC4, 0xF0, 0x43, 0x2E, 0xD0, 0xD1, 0xCF,
+    0xB0, 0xEE, 0xC1, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xC2, 0x69, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0xEE, 0xD4, 0xAD, 0xFE,
+    0x1A, 0xD4, 0xAD, 0xFE, 0x30, 0xFF, 0xF9, 0xD4, 0xAD, 0xFE, 0x43, 0xC4, 0xF0, 0xCF, 0x46, 0xEA,
+    0x4C, 0xFE, 0x60, 0xFE, 0x6C, 0xFE, 0x8A, 0xFF, 0xCD, 0xD4, 0xAD, 0x43, 0x2E, 0xD0, 0xD1, 0xCF,
     0x45, 0xD2, 0x79, 0xD7, 0x03, 0x43, 0x80, 0x82, 0x8C, 0xCF, 0x3E, 0xFF, 0xF6, 0xD7, 0x04, 0xC3,
     0x00, 0x42, 0x2E, 0xD1, 0x2D, 0xCF, 0x07, 0xFF, 0xF6, 0xC2, 0x1D, 0xC4, 0x00, 0x42, 0x2E, 0xD0,
     0xD1, 0x2D, 0xCE, 0xFB, 0xE7, 0x4E, 0xD3, 0xB2, 0xC2, 0x11, 0x41, 0x81, 0xE8, 0x02, 0xC3, 0x00,
@@ -1019,9 +1019,9 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xD1, 0x2E, 0x2D, 0xDE, 0xD3, 0xFF, 0xFC, 0xCE, 0xD8, 0xC1, 0xEE, 0x41, 0x81, 0xD5, 0xCE, 0x21,
     0xD1, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81,
     0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D,
-    0xFF, 0xFD, 0xC1, 0xBF, 0x50, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x80, 0x83,
-    0x94, 0x96, 0x97, 0x8E, 0x8F, 0xFF, 0x9B, 0xFF, 0xA7, 0xD4, 0x03, 0xD4, 0x03, 0xD3, 0xA2, 0xD4,
-    0x03, 0xD4, 0x03, 0xFF, 0xBA, 0xFF, 0xCA, 0xD4, 0x03, 0xFF, 0xF9, 0xC4, 0x46, 0xC4, 0x46, 0xC4,
+    0xFF, 0xFD, 0xC1, 0xBF, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C,
+    0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD4, 0x03, 0xFF, 0x9B, 0xFF, 0xA7, 0xFF, 0xF9, 0xD4, 0x03, 0xD4,
+    0x03, 0xD3, 0xA2, 0xD4, 0x03, 0xD4, 0x03, 0xFF, 0xBA, 0xFF, 0xCA, 0xC4, 0x46, 0xC4, 0x46, 0xC4,
     0x46, 0xC4, 0x46, 0xC4, 0x46, 0x44, 0xD0, 0xD2, 0xD1, 0x27, 0xFF, 0x25, 0xE6, 0xC0, 0xFF, 0xCF,
     0xEE, 0x8D, 0x41, 0xBF, 0xCE, 0x91, 0x41, 0xBF, 0xD1, 0xBB, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD,
     0xC3, 0x00, 0x42, 0xD0, 0xD1, 0x2D, 0xFF, 0xF2, 0xFF, 0xFD, 0xC1, 0x6C, 0x41, 0x80, 0xCB, 0x73,
@@ -1062,10 +1062,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xB0, 0xFD, 0x21, 0xD0, 0xFD, 0x41, 0x96, 0xED, 0x8D, 0x21, 0xD1, 0xFC, 0x22, 0x87, 0x80, 0xF6,
     0xFD, 0x21, 0xB8, 0xEB, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBE, 0xFD,
     0x21, 0xD0, 0xFD, 0x21, 0xBA, 0xFD, 0x22, 0xD1, 0xD0, 0xE6, 0xFD, 0x21, 0x94, 0xFB, 0x21, 0xD1,
-    0xFD, 0x21, 0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xBF, 0x08, 0x50, 0xB1, 0xB3, 0xB4, 0xBF,
-    0xBA, 0xBB, 0xBC, 0xBD, 0xB0, 0xB5, 0xBE, 0xB2, 0xB6, 0xB7, 0xB8, 0xB9, 0xCB, 0xE5, 0xCB, 0xE5,
-    0xFD, 0x95, 0xFE, 0xED, 0xFF, 0x4C, 0xE1, 0xA7, 0xCB, 0xEE, 0xCB, 0xEE, 0xFF, 0x7A, 0xFF, 0xA1,
-    0xFF, 0xB6, 0xFF, 0xF9, 0xC1, 0x8F, 0xC1, 0x8F, 0xC1, 0x8F, 0xC1, 0x8F, 0x41, 0x83, 0xC6, 0x8C,
+    0xFD, 0x21, 0xBE, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xBF, 0x08, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0x7A, 0xCB, 0xE5,
+    0xFF, 0xF9, 0xCB, 0xE5, 0xFD, 0x95, 0xFF, 0xA1, 0xC1, 0x8F, 0xC1, 0x8F, 0xC1, 0x8F, 0xC1, 0x8F,
+    0xFF, 0x4C, 0xE1, 0xA7, 0xCB, 0xEE, 0xCB, 0xEE, 0xFF, 0xB6, 0xFE, 0xED, 0x41, 0x83, 0xC6, 0x8C,
     0x21, 0xD1, 0xFC, 0x42, 0xBA, 0xB2, 0xDB, 0xAB, 0xFF, 0xFD, 0x43, 0xD0, 0xD1, 0x2E, 0xFF, 0xF9,
     0xE0, 0x38, 0xCB, 0xD6, 0x44, 0xB1, 0xB4, 0xBA, 0xBC, 0xE0, 0x21, 0xDB, 0x9A, 0xFF, 0xF6, 0xCB,
     0xCF, 0x43, 0xD0, 0x2E, 0x2D, 0xFF, 0xF3, 0xCB, 0x95, 0xBE, 0xAB, 0x41, 0xD0, 0xE3, 0x04, 0x21,
@@ -1101,9 +1101,9 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x42, 0xBC, 0xBF, 0xC7, 0x69, 0xFF,
     0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xBC, 0xBB, 0x42, 0xD0, 0x2D, 0xFB, 0xA5, 0xBC, 0xB4, 0x42,
     0xB8, 0xBE, 0xBE, 0x08, 0xBD, 0xD8, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF9, 0xFB, 0x89, 0xBC, 0xA6,
-    0x50, 0x8C, 0x81, 0x82, 0x88, 0x86, 0x83, 0x84, 0x85, 0x94, 0x96, 0x97, 0x80, 0x87, 0x89, 0x8E,
-    0x8F, 0xFD, 0xF1, 0xFE, 0x02, 0xFF, 0x83, 0xFF, 0x94, 0xDA, 0xB1, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF,
-    0xF6, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF,
+    0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96,
+    0x97, 0xBF, 0x2A, 0xFE, 0x02, 0xFF, 0x83, 0xFF, 0xE1, 0xFF, 0xE8, 0xFF, 0xF6, 0xDA, 0xB1, 0xBF,
+    0x2A, 0xFF, 0x94, 0xBF, 0x2A, 0xFD, 0xF1, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF, 0x2A, 0xBF,
     0x2A, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFD, 0x6A, 0xFF, 0xCF, 0xC1, 0x8F, 0xBE, 0xF9, 0x41, 0x82,
     0xC9, 0x75, 0xC2, 0x00, 0x42, 0xD1, 0x2D, 0xFF, 0xFC, 0xBC, 0x5A, 0x43, 0x2E, 0xD1, 0x2D, 0xC9,
     0x3B, 0xFF, 0xF3, 0xBC, 0x51, 0xA0, 0x03, 0xF4, 0x21, 0xB4, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x96,
@@ -1114,10 +1114,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0xBC, 0x03, 0x41, 0xB5, 0xCE, 0x79, 0x21, 0xD0, 0xFC, 0x42, 0xBD, 0xB0, 0xFF, 0xFD, 0xBF,
     0x26, 0x42, 0xD0, 0x2D, 0xFF, 0xF9, 0xBB, 0xEB, 0x41, 0xB5, 0xC5, 0xFD, 0x21, 0xD0, 0xFC, 0x21,
     0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBF, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0,
-    0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xBB, 0xC8, 0x50, 0xB1, 0xB3, 0xB4, 0xB6,
-    0xB7, 0xB2, 0xBB, 0xBC, 0xB5, 0xBA, 0xBE, 0xB0, 0xB8, 0xB9, 0xBD, 0xBF, 0xC8, 0xA5, 0xC8, 0xA5,
-    0xC8, 0xA5, 0xC8, 0xA5, 0xFF, 0x67, 0xFF, 0x70, 0xDE, 0x67, 0xE0, 0x58, 0xFF, 0xBE, 0xFF, 0xD6,
-    0xFF, 0xF9, 0xBE, 0x4F, 0xBE, 0x4F, 0xBE, 0x4F, 0xBE, 0x4F, 0xBE, 0x4F, 0x41, 0xB0, 0xFD, 0x06,
+    0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xBB, 0xC8, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBE, 0x4F, 0xC8, 0xA5,
+    0xFF, 0x70, 0xC8, 0xA5, 0xC8, 0xA5, 0xFF, 0xBE, 0xC8, 0xA5, 0xFF, 0x67, 0xBE, 0x4F, 0xBE, 0x4F,
+    0xFF, 0xD6, 0xDE, 0x67, 0xE0, 0x58, 0xBE, 0x4F, 0xFF, 0xF9, 0xBE, 0x4F, 0x41, 0xB0, 0xFD, 0x06,
     0x41, 0x96, 0xCD, 0x0B, 0x21, 0xD1, 0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x8F, 0xFD,
     0x22, 0xD0, 0xD1, 0xEC, 0xFD, 0x42, 0xB1, 0xBC, 0xD8, 0x59, 0xFF, 0xFB, 0x44, 0xD0, 0x2E, 0xD1,
     0x2D, 0xFF, 0xF9, 0xC8, 0x5A, 0xF9, 0x6E, 0xBB, 0x70, 0x42, 0xBA, 0xBF, 0xDF, 0xBA, 0xDF, 0xBA,
@@ -1128,99 +1128,99 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFC, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB0, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xC7, 0xFC,
     0xFF, 0xFD, 0xBB, 0x12, 0x41, 0xB5, 0xCE, 0x81, 0x21, 0xD0, 0xFC, 0x21, 0xBC, 0xFD, 0x21, 0xD0,
     0xFD, 0x21, 0xBA, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xBA,
-    0xF2, 0x50, 0x8C, 0x81, 0x88, 0x82, 0x80, 0x86, 0x87, 0x83, 0x94, 0x96, 0x97, 0x84, 0x85, 0x89,
-    0x8E, 0x8F, 0xFF, 0x7B, 0xFF, 0xA2, 0xFF, 0xAF, 0xFF, 0xBD, 0xFF, 0xD9, 0xC7, 0xD8, 0xC7, 0xD8,
-    0xFF, 0xF9, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79,
+    0xF2, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94,
+    0x96, 0x97, 0xFF, 0xD9, 0xFF, 0xA2, 0xFF, 0xBD, 0xFF, 0xF9, 0xBD, 0x79, 0xBD, 0x79, 0xC7, 0xD8,
+    0xC7, 0xD8, 0xFF, 0xAF, 0xBD, 0x79, 0xFF, 0x7B, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79, 0xBD, 0x79,
     0xBD, 0x79, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0xF9, 0xFF, 0xCF, 0xBF, 0xDE, 0xBD, 0x48, 0xA0,
     0x0C, 0x74, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB9,
     0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBC, 0xFD, 0x21, 0xD0, 0xFD,
     0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x81, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0x80, 0xFD, 0x42,
-    0xD1, 0x2D, 0xFF, 0xFD, 0xBA, 0x7D, 0x50, 0xB1, 0xB3, 0xB7, 0xBC, 0xBE, 0xB0, 0xB2, 0xB4, 0xB5,
-    0xB6, 0xB8, 0xB9, 0xBA, 0xBB, 0xBD, 0xBF, 0xC7, 0x5A, 0xC7, 0x5A, 0xC7, 0x5A, 0xC7, 0x63, 0xFF,
-    0xF9, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD,
-    0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0x42, 0x82, 0x8C, 0xEC, 0x21, 0xFB, 0xA4, 0x43, 0xD0,
+    0xD1, 0x2D, 0xFF, 0xFD, 0xBA, 0x7D, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
+    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBD, 0x04, 0xC7, 0x5A, 0xBD, 0x04, 0xC7, 0x5A, 0xBD,
+    0x04, 0xBD, 0x04, 0xBD, 0x04, 0xC7, 0x5A, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xBD, 0x04, 0xC7,
+    0x63, 0xBD, 0x04, 0xFF, 0xF9, 0xBD, 0x04, 0x42, 0x82, 0x8C, 0xEC, 0x21, 0xFB, 0xA4, 0x43, 0xD0,
     0xD1, 0x2D, 0xDE, 0x98, 0xFF, 0xF9, 0xBA, 0x3E, 0x41, 0xB7, 0xD0, 0xA9, 0x42, 0xD0, 0x2D, 0xFF,
-    0xFC, 0xBA, 0x30, 0x50, 0x81, 0x88, 0x84, 0x80, 0x82, 0x8C, 0x96, 0x94, 0x97, 0x83, 0x85, 0x86,
-    0x87, 0x89, 0x8E, 0x8F, 0xFF, 0xEB, 0xFD, 0x21, 0xCC, 0x74, 0xC7, 0x16, 0xDC, 0xCF, 0xC7, 0x16,
-    0xFF, 0xF9, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7,
-    0xBC, 0xB7, 0xBC, 0xB7, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x82, 0xFF, 0xCF, 0xBF, 0x1C, 0xBC,
+    0xFC, 0xBA, 0x30, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E,
+    0x8F, 0x94, 0x96, 0x97, 0xC7, 0x16, 0xFF, 0xEB, 0xDC, 0xCF, 0xBC, 0xB7, 0xCC, 0x74, 0xBC, 0xB7,
+    0xBC, 0xB7, 0xBC, 0xB7, 0xFD, 0x21, 0xBC, 0xB7, 0xC7, 0x16, 0xBC, 0xB7, 0xBC, 0xB7, 0xBC, 0xB7,
+    0xFF, 0xF9, 0xBC, 0xB7, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x82, 0xFF, 0xCF, 0xBF, 0x1C, 0xBC,
     0x86, 0x41, 0xB7, 0xD0, 0x8B, 0x21, 0xD0, 0xFC, 0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
     0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB3, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x94, 0xFD, 0x21, 0xD1, 0xFD,
     0x21, 0xBE, 0xFD, 0x43, 0x2E, 0xD0, 0x2D, 0xC6, 0xB3, 0xFF, 0xFD, 0xB9, 0xC9, 0x41, 0x80, 0xD0,
-    0x92, 0x43, 0xD0, 0xD1, 0x2D, 0xC2, 0x35, 0xFF, 0xFC, 0xB9, 0xBB, 0x50, 0xB3, 0xB4, 0xB2, 0xBC,
-    0xBD, 0xBE, 0xB0, 0xB1, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBF, 0xC6, 0x95, 0xC6, 0x95,
-    0xFF, 0xE8, 0xC6, 0x9E, 0xC6, 0x9E, 0xFF, 0xF6, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F,
-    0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0x42, 0x82, 0x8C, 0xDD,
+    0x92, 0x43, 0xD0, 0xD1, 0x2D, 0xC2, 0x35, 0xFF, 0xFC, 0xB9, 0xBB, 0x50, 0xB0, 0xB1, 0xB2, 0xB3,
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBC, 0x3F, 0xBC, 0x3F,
+    0xFF, 0xE8, 0xC6, 0x95, 0xC6, 0x95, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F, 0xBC, 0x3F,
+    0xBC, 0x3F, 0xBC, 0x3F, 0xC6, 0x9E, 0xC6, 0x9E, 0xFF, 0xF6, 0xBC, 0x3F, 0x42, 0x82, 0x8C, 0xDD,
     0xD7, 0xFA, 0xDF, 0x42, 0xD1, 0x2D, 0xFF, 0xF9, 0xB9, 0x79, 0x43, 0x2E, 0xD0, 0x2D, 0xC6, 0x5C,
     0xC4, 0xC9, 0xB9, 0x72, 0x41, 0xBC, 0xCF, 0xDD, 0x42, 0xD0, 0x2D, 0xFF, 0xFC, 0xB9, 0x64, 0x50,
-    0x81, 0x85, 0x80, 0x82, 0x88, 0x96, 0x94, 0x97, 0x83, 0x84, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F,
-    0xFF, 0xE4, 0xC6, 0x41, 0xC6, 0x4A, 0xFF, 0xEB, 0xC6, 0x4A, 0xFF, 0xF9, 0xBB, 0xEB, 0xBB, 0xEB,
-    0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97,
+    0xC6, 0x4A, 0xFF, 0xE4, 0xFF, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xC6, 0x41, 0xBB, 0xEB, 0xBB, 0xEB,
+    0xC6, 0x4A, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xBB, 0xEB, 0xFF, 0xF9, 0xBB, 0xEB,
     0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x7B, 0xFF, 0xCF, 0xBE, 0x50, 0xBB, 0xBA, 0x41, 0xB3, 0xF9,
     0x77, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD,
     0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xB5, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21,
     0xD1, 0xFD, 0x21, 0x82, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBD, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD,
-    0xB8, 0xF1, 0x50, 0xB1, 0xB3, 0xB4, 0xB7, 0xB5, 0xB0, 0xB2, 0xB6, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
-    0xBD, 0xBE, 0xBF, 0xC5, 0xCE, 0xC5, 0xCE, 0xC5, 0xCE, 0xC5, 0xCE, 0xFF, 0xF9, 0xDF, 0x5F, 0xBB,
-    0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB,
+    0xB8, 0xF1, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
+    0xBD, 0xBE, 0xBF, 0xDF, 0x5F, 0xC5, 0xCE, 0xBB, 0x78, 0xC5, 0xCE, 0xC5, 0xCE, 0xFF, 0xF9, 0xBB,
+    0x78, 0xC5, 0xCE, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB, 0x78, 0xBB,
     0x78, 0xBB, 0x78, 0x42, 0xD0, 0x2D, 0xDD, 0xF6, 0xB8, 0xB9, 0x43, 0x2E, 0xD0, 0x2D, 0xC5, 0x9C,
     0xE4, 0xC5, 0xB8, 0xB2, 0x41, 0xBE, 0xC2, 0x33, 0x21, 0xD0, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1,
-    0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB8, 0x98, 0x50, 0x81, 0x88, 0x86, 0x82,
-    0x8C, 0x83, 0x94, 0x96, 0x97, 0x80, 0x84, 0x85, 0x87, 0x89, 0x8E, 0x8F, 0xFB, 0x89, 0xFD, 0x55,
-    0xC5, 0x75, 0xFF, 0xD8, 0xFF, 0xDF, 0xFF, 0xF9, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F,
-    0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0x44, 0xD0, 0xD1, 0xD2,
+    0xFD, 0x21, 0xBA, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB8, 0x98, 0x50, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xBB, 0x1F, 0xFB, 0x89,
+    0xFF, 0xD8, 0xFF, 0xF9, 0xBB, 0x1F, 0xBB, 0x1F, 0xC5, 0x75, 0xBB, 0x1F, 0xFD, 0x55, 0xBB, 0x1F,
+    0xFF, 0xDF, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0xBB, 0x1F, 0x44, 0xD0, 0xD1, 0xD2,
     0x27, 0xFF, 0x76, 0xFF, 0xCF, 0xBD, 0x84, 0xBA, 0xEE, 0x41, 0xB2, 0xD0, 0x69, 0x21, 0xD0, 0xFC,
     0x21, 0xB8, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB1, 0xFD, 0x21,
     0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0xBD, 0xFD, 0x21, 0xD0, 0xFD, 0x21, 0x80,
-    0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xB8, 0x2B, 0x50, 0xB1, 0xB4, 0xB6, 0xBC, 0xBD, 0xBE, 0xB0,
-    0xB2, 0xB3, 0xB5, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBF, 0xCA, 0x6F, 0xC5, 0x08, 0xC5, 0x08, 0xC5,
-    0x11, 0xC5, 0x11, 0xFF, 0xF9, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA,
-    0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0x50, 0x87, 0x82, 0x94, 0x96, 0x97, 0x80,
-    0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xC4, 0xD7, 0xC4, 0xE0, 0xBA, 0x81,
-    0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81,
+    0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xB8, 0x2B, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6,
+    0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xBA, 0xB2, 0xCA, 0x6F, 0xBA, 0xB2, 0xBA,
+    0xB2, 0xC5, 0x08, 0xBA, 0xB2, 0xC5, 0x08, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA, 0xB2, 0xBA,
+    0xB2, 0xC5, 0x11, 0xC5, 0x11, 0xFF, 0xF9, 0xBA, 0xB2, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xBA, 0x81, 0xBA, 0x81, 0xC4, 0xE0,
+    0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xC4, 0xD7, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81,
     0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0xBA, 0x81, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF,
     0x9E, 0xFF, 0xCF, 0xBC, 0xE6, 0xBA, 0x50, 0x43, 0x2E, 0xD0, 0x2D, 0xC4, 0x9F, 0xEB, 0xC3, 0xB7,
     0xB5, 0x42, 0xB4, 0xBB, 0xB8, 0x58, 0xB8, 0x58, 0x21, 0xD0, 0xF9, 0x21, 0xBE, 0xFD, 0x42, 0xB4,
     0xBB, 0xB8, 0xF9, 0xB8, 0x4B, 0x42, 0xD0, 0xD1, 0xFF, 0xF9, 0xB9, 0x6F, 0x21, 0x96, 0xF9, 0x43,
     0xD0, 0xD1, 0x2D, 0xFF, 0xEC, 0xFF, 0xFD, 0xB7, 0x8D, 0x41, 0x96, 0xC6, 0x55, 0x21, 0xD1, 0xFC,
-    0x21, 0xBF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB7, 0x79, 0x50, 0xB1, 0xB3, 0xB2, 0xBB, 0xBC,
-    0xBD, 0xBA, 0xB0, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBE, 0xBF, 0xC4, 0x56, 0xC4, 0x56, 0xC4,
-    0x5F, 0xD5, 0x87, 0xC4, 0x5F, 0xFF, 0xBD, 0xFF, 0xE5, 0xFF, 0xF9, 0xBA, 0x00, 0xBA, 0x00, 0xBA,
-    0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0x42, 0xB1, 0xBB, 0xB7, 0xEE,
+    0x21, 0xBF, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xB7, 0x79, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0xF9, 0xC4, 0x56, 0xC4,
+    0x5F, 0xC4, 0x56, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0xFF,
+    0xE5, 0xD5, 0x87, 0xC4, 0x5F, 0xFF, 0xBD, 0xBA, 0x00, 0xBA, 0x00, 0x42, 0xB1, 0xBB, 0xB7, 0xEE,
     0xCE, 0xF3, 0x21, 0xD0, 0xF9, 0x43, 0xBA, 0xB2, 0xB0, 0xDB, 0x8E, 0xC4, 0x4E, 0xFF, 0xFD, 0x41,
     0xD1, 0xF9, 0x6A, 0x42, 0x81, 0x83, 0xFF, 0xFC, 0xB9, 0x8A, 0x44, 0xD0, 0xD1, 0x2E, 0x2D, 0xFF,
-    0xEB, 0xFF, 0xF9, 0xC4, 0x0C, 0xB7, 0x22, 0x50, 0x82, 0x88, 0x81, 0x94, 0x96, 0x97, 0x80, 0x83,
-    0x84, 0x85, 0x86, 0x87, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xF3, 0xC3, 0xF9, 0xD5, 0x2A, 0xB9, 0xA3,
-    0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3,
+    0xEB, 0xFF, 0xF9, 0xC4, 0x0C, 0xB7, 0x22, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xB9, 0xA3, 0xD5, 0x2A, 0xFF, 0xF3, 0xB9, 0xA3,
+    0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xC3, 0xF9, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3,
     0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0xB9, 0xA3, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFF, 0x72, 0xFF,
-    0xCF, 0xBC, 0x08, 0xB9, 0x72, 0x50, 0x89, 0x81, 0x94, 0x96, 0x97, 0x80, 0x82, 0x83, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x8C, 0x8E, 0x8F, 0xC3, 0xBB, 0xD4, 0xEC, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65,
-    0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65,
+    0xCF, 0xBC, 0x08, 0xB9, 0x72, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xB9, 0x65, 0xD4, 0xEC, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65,
+    0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0xC3, 0xBB, 0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65,
     0xB9, 0x65, 0xB9, 0x65, 0xB9, 0x65, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
     0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9,
     0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9,
     0x34, 0xB9, 0x34, 0xB9, 0x34, 0xB9, 0x34, 0x44, 0xD1, 0xD0, 0xD2, 0x27, 0xFF, 0x9E, 0xFF, 0xCF,
-    0xBB, 0x99, 0xB9, 0x03, 0xC1, 0x00, 0xF1, 0x2D, 0xB6, 0x68, 0x50, 0xBE, 0xB0, 0xB1, 0xB2, 0xB3,
-    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF, 0xFF, 0xFA, 0xB8, 0xF0, 0xB8,
+    0xBB, 0x99, 0xB9, 0x03, 0xC1, 0x00, 0xF1, 0x2D, 0xB6, 0x68, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
+    0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
     0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8,
-    0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0x50, 0x94, 0x96, 0x97, 0x80,
-    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xB8, 0xBF, 0xB8, 0xBF,
+    0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xB8, 0xF0, 0xFF, 0xFA, 0xB8, 0xF0, 0x50, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xB8, 0xBF, 0xB8, 0xBF,
     0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF,
     0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xB8, 0xBF, 0xC4, 0x01, 0x01, 0xD0,
-    0xD2, 0xD1, 0x27, 0xFF, 0x9E, 0xBB, 0x24, 0xFF, 0xCF, 0xB8, 0x8E, 0x50, 0x96, 0x83, 0x8E, 0x8F,
-    0x94, 0x97, 0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0xEC, 0xC8, 0xEE, 0xD1,
-    0xEF, 0x42, 0xF0, 0x06, 0xF0, 0xFB, 0xF1, 0x90, 0xF4, 0x6A, 0xF9, 0x86, 0xFB, 0x37, 0xFB, 0xF9,
-    0xFC, 0xC5, 0xFD, 0x91, 0xFE, 0x2F, 0xFF, 0x0D, 0xFF, 0x7C, 0xFF, 0xF1, 0x41, 0xBD, 0xC6, 0x5C,
-    0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xB5, 0xB6, 0x50, 0x80, 0x94,
-    0x96, 0x97, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0xF9,
+    0xD2, 0xD1, 0x27, 0xFF, 0x9E, 0xBB, 0x24, 0xFF, 0xCF, 0xB8, 0x8E, 0x50, 0x80, 0x81, 0x82, 0x83,
+    0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xF4, 0x6A, 0xF9, 0x86,
+    0xFB, 0x37, 0xEE, 0xD1, 0xFB, 0xF9, 0xFC, 0xC5, 0xFD, 0x91, 0xFE, 0x2F, 0xFF, 0x0D, 0xFF, 0x7C,
+    0xFF, 0xF1, 0xEF, 0x42, 0xF0, 0x06, 0xF0, 0xFB, 0xEC, 0xC8, 0xF1, 0x90, 0x41, 0xBD, 0xC6, 0x5C,
+    0x21, 0xD0, 0xFC, 0x21, 0x83, 0xFD, 0x42, 0xD1, 0x2D, 0xFF, 0xFD, 0xB5, 0xB6, 0x50, 0x80, 0x81,
+    0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0xF9,
     0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D,
     0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0xB8, 0x3D, 0x44, 0xD2,
     0xD1, 0xD0, 0x27, 0xDA, 0xB7, 0xFF, 0xCF, 0xFE, 0xD8, 0xB8, 0x0C, 0x21, 0x91, 0xF3, 0x46, 0xB2,
     0xB7, 0xB4, 0xB6, 0xBB, 0xBC, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6, 0xC7, 0xC6,
     0xC7, 0x42, 0x81, 0x85, 0xC6, 0xB4, 0xC6, 0xB4, 0xA0, 0x0E, 0x42, 0x23, 0xD0, 0xD1, 0x2D, 0xE3,
-    0xF6, 0xFD, 0x21, 0x2D, 0xF6, 0x30, 0x97, 0x94, 0x96, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86,
-    0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xF6, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
+    0xF6, 0xFD, 0x21, 0x2D, 0xF6, 0x30, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF6, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
     0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC,
     0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0xDC, 0x41, 0x91, 0xFF, 0xBB, 0xC4, 0x01, 0x01, 0xD1, 0xD0,
     0xD2, 0x27, 0xFF, 0xBA, 0xFF, 0xDB, 0xFF, 0xFC, 0xFF, 0xB7, 0xA0, 0x01, 0x11, 0xA0, 0x01, 0x21,
@@ -1296,10 +1296,10 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0x41, 0x81, 0xFC, 0xB9, 0x21, 0xD1, 0xFC, 0x21, 0xBA, 0xFD, 0x42, 0x81, 0x8C, 0xFB, 0xA3, 0xFB,
     0xA3, 0x43, 0xD0, 0xD1, 0x2D, 0xFF, 0xF6, 0xFF, 0xF9, 0xFB, 0x99, 0x41, 0x96, 0xD2, 0x9D, 0x21,
     0xD1, 0xFC, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD, 0x42, 0xD0, 0x2D, 0xFF, 0xFD,
-    0xFB, 0x7F, 0x41, 0x2D, 0xFB, 0x78, 0x50, 0xB1, 0xB2, 0xB4, 0xB7, 0xBC, 0xBD, 0xBF, 0xB9, 0xBA,
-    0xBB, 0xBE, 0xB0, 0xB3, 0xB5, 0xB6, 0xB8, 0xFC, 0x6B, 0xFD, 0x38, 0xFD, 0x78, 0xFD, 0xFA, 0xFE,
-    0x1D, 0xFE, 0x56, 0xFF, 0x97, 0xFF, 0xA8, 0xFF, 0xC0, 0xFF, 0xDB, 0xFF, 0xF5, 0xFF, 0xFC, 0xFF,
-    0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0x41, 0x82, 0xFB, 0x46, 0x41, 0x96, 0xFC, 0xAA, 0x43,
+    0xFB, 0x7F, 0x41, 0x2D, 0xFB, 0x78, 0x50, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8,
+    0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFF, 0xFC, 0xFC, 0x6B, 0xFD, 0x38, 0xFF, 0xFC, 0xFD,
+    0x78, 0xFF, 0xFC, 0xFF, 0xFC, 0xFD, 0xFA, 0xFF, 0xFC, 0xFF, 0xA8, 0xFF, 0xC0, 0xFF, 0xDB, 0xFE,
+    0x1D, 0xFE, 0x56, 0xFF, 0xF5, 0xFF, 0x97, 0x41, 0x82, 0xFB, 0x46, 0x41, 0x96, 0xFC, 0xAA, 0x43,
     0xB5, 0xB0, 0xBC, 0xFC, 0xA6, 0xFC, 0xA6, 0xFD, 0x6B, 0xC3, 0x01, 0xE2, 0xD1, 0xD0, 0x27, 0xFF,
     0xF2, 0xFF, 0xF6, 0xFB, 0x37, 0x21, 0xB7, 0xF4, 0x21, 0xD0, 0xFD, 0x21, 0xBE, 0xFD, 0x44, 0x27,
     0xD1, 0xD0, 0x2D, 0xFB, 0x1C, 0xFF, 0xD9, 0xFF, 0xFD, 0xFB, 0x1C, 0x41, 0xBA, 0xFB, 0x12, 0x43,
@@ -1316,33 +1316,119 @@ alignas(4) constexpr uint8_t uk_trie_data[] = {
     0xFD, 0x21, 0x80, 0xFD, 0x21, 0xD1, 0xFD, 0x21, 0xB5, 0xFD, 0x43, 0xD1, 0xD0, 0x2D, 0xFF, 0xE1,
     0xFF, 0xFD, 0xFA, 0x60, 0x42, 0xB8, 0xB5, 0xD1, 0x64, 0xD1, 0x64, 0x42, 0x96, 0x83, 0xD1, 0x5D,
     0xD1, 0x5D, 0x22, 0xD0, 0xD1, 0xF2, 0xF9, 0x21, 0x80, 0xFB, 0x21, 0xD1, 0xFD, 0x21, 0xBC, 0xFD,
-    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFA, 0x3A, 0x50, 0x80, 0x82, 0x84, 0x88, 0x81, 0x85, 0x86, 0x87,
-    0x83, 0x94, 0x96, 0x97, 0x89, 0x8C, 0x8E, 0x8F, 0xFF, 0x17, 0xFF, 0x32, 0xFF, 0x43, 0xFF, 0x57,
-    0xFF, 0x98, 0xFF, 0xA2, 0xFF, 0xAD, 0xFF, 0xD3, 0xFF, 0xF9, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB,
+    0x42, 0xD0, 0x2D, 0xFF, 0xFD, 0xFA, 0x3A, 0x50, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xFF, 0x17, 0xFF, 0x98, 0xFF, 0x32, 0xFF, 0xF9,
+    0xFF, 0x43, 0xFF, 0xA2, 0xFF, 0xAD, 0xFF, 0xD3, 0xFF, 0x57, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB,
     0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB, 0xFE, 0xBB, 0x41, 0x91, 0xFE, 0x8A, 0xA0, 0x0D, 0xB1, 0x21,
     0x2D, 0xFD, 0x44, 0xD0, 0xD1, 0xD2, 0x27, 0xFE, 0x84, 0xFF, 0xC5, 0xFF, 0xF6, 0xFF, 0xFD, 0xA0,
     0x0D, 0xA1, 0xA0, 0x0D, 0xC2, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9,
     0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x21, 0x91, 0xDC, 0x30, 0x94, 0x96, 0x97, 0x80, 0x81, 0x82,
-    0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x21, 0x91, 0xDC, 0x30, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
+    0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
     0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xA0, 0x0E, 0x02, 0x44, 0xD0, 0xD2,
     0xD1, 0x27, 0xFF, 0xB8, 0xFF, 0xD9, 0xFF, 0xDC, 0xFF, 0xFD, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
     0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
-    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x21, 0x91, 0xD2, 0x30, 0x94,
-    0x96, 0x97, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xCF,
+    0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0x21, 0x91, 0xD2, 0x30, 0x80,
+    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xCF,
     0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xCF, 0xA0,
     0x0E, 0x22, 0x30, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC,
     0xBD, 0xBE, 0xBF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD,
-    0xFD, 0xFD, 0xFD, 0x21, 0x91, 0xDC, 0x30, 0x94, 0x96, 0x97, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85,
-    0x86, 0x87, 0x88, 0x89, 0x8C, 0x8E, 0x8F, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
+    0xFD, 0xFD, 0xFD, 0x21, 0x91, 0xDC, 0x30, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x8C, 0x8E, 0x8F, 0x94, 0x96, 0x97, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9,
     0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0xA0, 0x0E, 0x62, 0x44, 0xD0, 0xD2, 0xD1, 0x27, 0xFF,
     0xB8, 0xFF, 0xD9, 0xFF, 0xDC, 0xFF, 0xFD, 0xC5, 0x0D, 0x82, 0x2D, 0xD0, 0xD2, 0xD1, 0x27, 0xFF,
     0x08, 0xFF, 0x63, 0xFF, 0x84, 0xFF, 0x87, 0xFF, 0xF3, 0x46, 0xD0, 0xD1, 0xD2, 0x27, 0x2E, 0x2D,
     0xE3, 0x0F, 0xF7, 0xE2, 0xF8, 0x62, 0xF8, 0xD2, 0xFE, 0xE9, 0xFF, 0xEE,
 };
 
+// Dense lookup tables for the root and depth-1 transitions; nodes with at least
+// 12 transitions have their labels sorted.
+constexpr uint8_t uk_root_slots[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x02, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x03, 0x04, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint8_t uk_byte_classes[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0xFF, 0xFF, 0x0C, 0xFF, 0x0D, 0x0E,
+    0xFF, 0x0F, 0xFF, 0xFF, 0x10, 0xFF, 0x11, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x23, 0x24, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+constexpr uint32_t uk_depth1_targets[] = {
+    0x00004BFBu, 0x00005317u, 0x00005212u, 0x00003638u, 0x00004B0Bu, 0x00004B8Bu,
+};
+
+constexpr uint32_t uk_depth2_targets[] = {
+    0x00004BB2u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00004BD6u, 0x00004BB5u, 0x00004BF7u, 0x0000530Au, 0x0000521Fu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0x0000527Au, 0x0000529Eu, 0x0000529Bu, 0x0000520Fu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00005096u,
+    0x000051D7u, 0x00005208u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000624u, 0x0000126Eu, 0x000016D2u,
+    0x0000198Au, 0x00001ED7u, 0x0000094Au, 0x00001FA8u, 0x0000233Cu, 0x00000A0Cu, 0x0000362Bu, 0x000025CEu,
+    0x000026EFu, 0x00002899u, 0x00002E08u, 0x00000DD1u, 0x000034FDu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0x00003F75u, 0x00004491u, 0x00004642u, 0x000039DCu, 0x00004704u, 0x000047D0u,
+    0x0000489Cu, 0x0000493Au, 0x00004A18u, 0x00004A87u, 0x00004AFCu, 0x00003A4Du, 0x00003B11u, 0xFFFFFFFFu,
+    0x00003C06u, 0x000037D3u, 0x00003C9Bu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x00004B7Eu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+    0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+};
+
+constexpr SerializedTrieAcceleration uk_acceleration = {
+    uk_root_slots,
+    uk_byte_classes,
+    uk_depth1_targets,
+    uk_depth2_targets,
+    38u,
+    12u,
+};
+
 constexpr SerializedHyphenationPatterns uk_patterns = {
     0x5329u,
     uk_trie_data,
     sizeof(uk_trie_data),
+    &uk_acceleration,
 };
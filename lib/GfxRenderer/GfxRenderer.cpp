@@ -15,6 +15,23 @@ const uint8_t* GfxRenderer::getGlyphBitmap(const EpdFontData* fontData, const Ep
   return &fontData->bitmap[glyph->dataOffset];
 }
 
+const uint8_t* GfxRenderer::getGlyphBitmapTransposed(const EpdFontData* fontData, const EpdGlyph* glyph) const {
+  if (fontData->groups == nullptr || !fontDecompressor) {
+    return nullptr;
+  }
+  uint16_t glyphIndex = static_cast<uint16_t>(glyph - fontData->glyph);
+  return fontDecompressor->getBitmapTransposed(fontData, glyph, glyphIndex);
+}
+
+const uint8_t* GfxRenderer::getGlyphBitmapBw(const EpdFontData* fontData, const EpdGlyph* glyph,
+                                             const bool transposed) const {
+  if (fontData->bwGroups == nullptr || !fontDecompressor) {
+    return nullptr;
+  }
+  uint16_t glyphIndex = static_cast<uint16_t>(glyph - fontData->glyph);
+  return fontDecompressor->getBwBitmap(fontData, glyph, glyphIndex, transposed);
+}
+
 void GfxRenderer::begin() {
   frameBuffer = display.getFrameBuffer();
   if (!frameBuffer) {
@@ -23,7 +40,42 @@ void GfxRenderer::begin() {
   }
 }
 
-void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) { fontMap.insert({fontId, font}); }
+void GfxRenderer::insertFont(const int fontId, EpdFontFamily font) {
+  for (int i = 0; i < fontCount; i++) {
+    if (fontSlots[i].fontId == fontId) {
+      return;
+    }
+  }
+  if (fontCount >= MAX_FONTS) {
+    LOG_ERR("GFX", "Font table full, dropping font %d", fontId);
+    return;
+  }
+  fontSlots[fontCount].fontId = fontId;
+  fontSlots[fontCount].family = font;
+  fontCount++;
+}
+
+void GfxRenderer::replaceFont(const int fontId, EpdFontFamily font) {
+  for (int i = 0; i < fontCount; i++) {
+    if (fontSlots[i].fontId == fontId) {
+      fontSlots[i].family = font;
+      // Cached groups are keyed by font data, which the old family may free and a new one may reuse
+      clearFontCache();
+      return;
+    }
+  }
+  LOG_ERR("GFX", "Font %d not found", fontId);
+}
+
+FontHandle GfxRenderer::getFont(const int fontId) const {
+  for (int i = 0; i < fontCount; i++) {
+    if (fontSlots[i].fontId == fontId) {
+      return FontHandle(&fontSlots[i].family);
+    }
+  }
+  LOG_ERR("GFX", "Font %d not found", fontId);
+  return FontHandle();
+}
 
 // Translate logical (x,y) coordinates to physical panel coordinates based on current orientation
 // This should always be inlined for better performance
@@ -59,14 +111,246 @@ static inline void rotateCoordinates(const GfxRenderer::Orientation orientation,
   }
 }
 
+// Inverse of rotateCoordinates: physical panel (x,y) back to logical coordinates
+static inline void unrotateCoordinates(const GfxRenderer::Orientation orientation, const int phyX, const int phyY,
+                                       int* x, int* y) {
+  switch (orientation) {
+    case GfxRenderer::Portrait:
+      *x = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+      *y = phyX;
+      break;
+    case GfxRenderer::LandscapeClockwise:
+      *x = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+      *y = HalDisplay::DISPLAY_HEIGHT - 1 - phyY;
+      break;
+    case GfxRenderer::PortraitInverted:
+      *x = phyY;
+      *y = HalDisplay::DISPLAY_WIDTH - 1 - phyX;
+      break;
+    case GfxRenderer::LandscapeCounterClockwise:
+      *x = phyX;
+      *y = phyY;
+      break;
+  }
+}
+
+// One logical row mask covers the widest orientation, plus a spill byte for nibble writes at the right edge
+static constexpr int ROW_MASK_BYTES = HalDisplay::DISPLAY_WIDTH / 8 + 1;
+
+// Packed 2-bit source bytes (4 pixels, MSB first, 0 = black .. 3 = white) -> 4-bit mask (MSB first) of the pixels
+// written in each render mode. Same rules as the per-pixel paths: BW draws val < 3, GRAYSCALE_MSB flags val 1 and 2,
+// GRAYSCALE_LSB flags val 1.
+struct PlaneLuts {
+  uint8_t modes[3][256];
+};
+
+static constexpr PlaneLuts makePlaneLuts() {
+  PlaneLuts luts{};
+  for (int b = 0; b < 256; b++) {
+    for (int i = 0; i < 4; i++) {
+      const int val = (b >> (6 - i * 2)) & 0x3;
+      const uint8_t bit = 0x08 >> i;
+      if (val < 3) luts.modes[GfxRenderer::BW][b] |= bit;
+      if (val == 1) luts.modes[GfxRenderer::GRAYSCALE_LSB][b] |= bit;
+      if (val == 1 || val == 2) luts.modes[GfxRenderer::GRAYSCALE_MSB][b] |= bit;
+    }
+  }
+  return luts;
+}
+
+static constexpr PlaneLuts PLANE_LUTS = makePlaneLuts();
+
+static inline uint8_t reverseBits(uint8_t b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+// OR a 4-bit mask (MSB first) into a row mask at logical x. Bits left of the screen must already be cleared.
+static inline void orRowMaskNibble(uint8_t* mask, int x, uint8_t nibble) {
+  if (x < 0) {
+    nibble = (nibble << -x) & 0x0F;
+    x = 0;
+  }
+  const uint16_t bits = static_cast<uint16_t>(nibble) << (12 - (x & 7));
+  mask[x >> 3] |= bits >> 8;
+  mask[(x >> 3) + 1] |= bits & 0xFF;
+}
+
 enum class TextRotation { None, Rotated90CW };
 
+// Direction the panel address moves for one logical pixel step
+enum class PanelStep { XPlus, XMinus, YPlus, YMinus };
+
+// Logical +x step (glyph rows of normal text) expressed in panel coordinates
+template <GfxRenderer::Orientation orientation>
+static constexpr PanelStep stepAlongX() {
+  if constexpr (orientation == GfxRenderer::Portrait) return PanelStep::YMinus;
+  if constexpr (orientation == GfxRenderer::LandscapeClockwise) return PanelStep::XMinus;
+  if constexpr (orientation == GfxRenderer::PortraitInverted) return PanelStep::YPlus;
+  return PanelStep::XPlus;
+}
+
+// Logical +y step (glyph columns of normal text) expressed in panel coordinates
+template <GfxRenderer::Orientation orientation>
+static constexpr PanelStep stepAlongY() {
+  if constexpr (orientation == GfxRenderer::Portrait) return PanelStep::XPlus;
+  if constexpr (orientation == GfxRenderer::LandscapeClockwise) return PanelStep::YMinus;
+  if constexpr (orientation == GfxRenderer::PortraitInverted) return PanelStep::XMinus;
+  return PanelStep::YPlus;
+}
+
+// Logical -y step (glyph rows of text rotated 90° clockwise) expressed in panel coordinates
+template <GfxRenderer::Orientation orientation>
+static constexpr PanelStep stepAlongNegY() {
+  if constexpr (orientation == GfxRenderer::Portrait) return PanelStep::XMinus;
+  if constexpr (orientation == GfxRenderer::LandscapeClockwise) return PanelStep::YPlus;
+  if constexpr (orientation == GfxRenderer::PortraitInverted) return PanelStep::XPlus;
+  return PanelStep::YMinus;
+}
+
+// Logical screen size for a compile-time orientation
+template <GfxRenderer::Orientation orientation>
+static constexpr int logicalWidth() {
+  return (orientation == GfxRenderer::Portrait || orientation == GfxRenderer::PortraitInverted)
+             ? HalDisplay::DISPLAY_HEIGHT
+             : HalDisplay::DISPLAY_WIDTH;
+}
+
+template <GfxRenderer::Orientation orientation>
+static constexpr int logicalHeight() {
+  return (orientation == GfxRenderer::Portrait || orientation == GfxRenderer::PortraitInverted)
+             ? HalDisplay::DISPLAY_WIDTH
+             : HalDisplay::DISPLAY_HEIGHT;
+}
+
+// Framebuffer address of one panel pixel that walks along a fixed panel direction. The orientation transform is folded
+// into a constant byte stride (panel rows) or a bit shift (panel columns), so inner loops never rotate coordinates.
+template <PanelStep step>
+struct PanelCursor {
+  uint8_t* byte;
+  uint8_t bit;
+
+  PanelCursor(uint8_t* frameBuffer, const int phyX, const int phyY)
+      : byte(frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES + phyX / 8), bit(0x80 >> (phyX % 8)) {}
+
+  void write(const bool state) const {
+    if (state) {
+      *byte &= ~bit;  // Black
+    } else {
+      *byte |= bit;  // White / gray plane flag
+    }
+  }
+
+  void advance() {
+    if constexpr (step == PanelStep::XPlus) {
+      bit >>= 1;
+      if (!bit) {
+        bit = 0x80;
+        byte++;
+      }
+    } else if constexpr (step == PanelStep::XMinus) {
+      bit <<= 1;
+      if (!bit) {
+        bit = 0x01;
+        byte--;
+      }
+    } else if constexpr (step == PanelStep::YPlus) {
+      byte += HalDisplay::DISPLAY_WIDTH_BYTES;
+    } else {
+      byte -= HalDisplay::DISPLAY_WIDTH_BYTES;
+    }
+  }
+};
+
+// Which 2-bit glyph values (0 = black .. 3 = white) a render mode writes, and with which pixel state
+template <GfxRenderer::RenderMode renderMode>
+static inline bool glyphPixelWritten(const uint8_t bmpVal) {
+  if constexpr (renderMode == GfxRenderer::BW) {
+    return bmpVal < 3;  // Black (also paints over the grays in BW mode)
+  } else if constexpr (renderMode == GfxRenderer::GRAYSCALE_MSB) {
+    return bmpVal == 1 || bmpVal == 2;  // Light gray (also mark the MSB if it's going to be a dark gray too)
+  } else {
+    return bmpVal == 1;  // Dark gray
+  }
+}
+
+// Column-major glyph blit for orientations where a glyph column lies along one panel row. Each visible column is
+// collected into a bit mask in panel order and then written as shifted framebuffer bytes, instead of one scattered
+// read-modify-write per pixel. Returns whether a BW pass wrote any gray (1 or 2) pixel of a 2-bit glyph.
+template <TextRotation rotation, GfxRenderer::Orientation orientation, GfxRenderer::RenderMode renderMode>
+static bool renderGlyphColumns(uint8_t* frameBuffer, const uint8_t* columnBitmap, const bool is2Bit, const int height,
+                               const int outerBase, const int innerBase, const int outerStart, const int outerEnd,
+                               const int innerStart, const int innerEnd, const bool pixelState) {
+  constexpr bool reversed =
+      (rotation == TextRotation::Rotated90CW ? stepAlongX<orientation>() : stepAlongY<orientation>()) ==
+      PanelStep::XMinus;
+  const int count = outerEnd - outerStart;
+  if (count <= 0) {
+    return false;
+  }
+  const int maskBytes = (count + 7) / 8;
+  const bool state = (renderMode == GfxRenderer::BW || !is2Bit) ? pixelState : false;
+  bool gray = false;
+
+  for (int glyphX = innerStart; glyphX < innerEnd; glyphX++) {
+    // Panel position of the first visible pixel of this column
+    int screenX, screenY;
+    if constexpr (rotation == TextRotation::Rotated90CW) {
+      screenX = outerBase + outerStart;
+      screenY = innerBase - glyphX;
+    } else {
+      screenX = innerBase + glyphX;
+      screenY = outerBase + outerStart;
+    }
+    int phyX = 0, phyY = 0;
+    rotateCoordinates(orientation, screenX, screenY, &phyX, &phyY);
+
+    uint8_t columnMask[256 / 8 + 1] = {};
+    int pixelPosition = glyphX * height + outerStart;
+    bool any = false;
+    for (int i = 0; i < count; i++, pixelPosition++) {
+      bool written;
+      if (is2Bit) {
+        const uint8_t bmpVal = 3 - ((columnBitmap[pixelPosition >> 2] >> ((3 - (pixelPosition & 3)) * 2)) & 0x3);
+        written = glyphPixelWritten<renderMode>(bmpVal);
+        if constexpr (renderMode == GfxRenderer::BW) {
+          gray |= bmpVal == 1 || bmpVal == 2;
+        }
+      } else {
+        written = (columnBitmap[pixelPosition >> 3] >> (7 - (pixelPosition & 7))) & 1;
+      }
+      if (written) {
+        const int bit = reversed ? count - 1 - i : i;
+        columnMask[bit >> 3] |= 0x80 >> (bit & 7);
+        any = true;
+      }
+    }
+    if (!any) {
+      continue;
+    }
+
+    const int startX = reversed ? phyX - (count - 1) : phyX;
+    const int shift = startX & 7;
+    uint8_t* dst = frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES + (startX >> 3);
+    for (int k = 0; k < maskBytes; k++) {
+      const uint8_t high = columnMask[k] >> shift;
+      const uint8_t low = shift ? static_cast<uint8_t>(columnMask[k] << (8 - shift)) : 0;
+      // Only bytes with visible bits are touched, so the spill past the clipped range never leaves the row
+      if (high) dst[k] = state ? (dst[k] & ~high) : (dst[k] | high);
+      if (low) dst[k + 1] = state ? (dst[k + 1] & ~low) : (dst[k + 1] | low);
+    }
+  }
+  return gray;
+}
+
 // Shared glyph rendering logic for normal and rotated text.
-// Coordinate mapping and cursor advance direction are selected at compile time via the template parameter.
-template <TextRotation rotation>
-static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode renderMode,
-                           const EpdFontFamily& fontFamily, const uint32_t cp, int* cursorX, int* cursorY,
-                           const bool pixelState, const EpdFontFamily::Style style) {
+// Coordinate mapping, cursor advance direction, orientation and render mode are all selected at compile time, so the
+// per-pixel work is a bitmap read and a masked write through a PanelCursor. Clipping is resolved once per glyph.
+template <TextRotation rotation, GfxRenderer::Orientation orientation, GfxRenderer::RenderMode renderMode>
+static void renderCharImpl(const GfxRenderer& renderer, const EpdFontFamily& fontFamily, const uint32_t cp,
+                           int* cursorX, int* cursorY, const bool pixelState, const EpdFontFamily::Style style) {
   const EpdGlyph* glyph = fontFamily.getGlyph(cp, style);
   if (!glyph) {
     glyph = fontFamily.getGlyph(REPLACEMENT_GLYPH, style);
@@ -78,83 +362,114 @@ static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode
   }
 
   const EpdFontData* fontData = fontFamily.getData(style);
-  const bool is2Bit = fontData->is2Bit;
-  const uint8_t width = glyph->width;
-  const uint8_t height = glyph->height;
+  // The BW pass only needs to know where a glyph has ink, which fonts with 1-bit groups store pre-thresholded
+  const bool thresholded = renderMode == GfxRenderer::BW && fontData->bwGroups != nullptr;
+  const bool is2Bit = fontData->is2Bit && !thresholded;
+  const int width = glyph->width;
+  const int height = glyph->height;
   const int left = glyph->left;
   const int top = glyph->top;
 
-  const uint8_t* bitmap = renderer.getGlyphBitmap(fontData, glyph);
+  // When glyph columns run along a panel row (portrait text, rotated text in landscape), prefer the column-major copy
+  // of the glyph so a whole glyph column can be written as framebuffer bytes
+  constexpr PanelStep outerStep =
+      rotation == TextRotation::Rotated90CW ? stepAlongX<orientation>() : stepAlongY<orientation>();
+  constexpr bool columnsAlongPanelRows = outerStep == PanelStep::XPlus || outerStep == PanelStep::XMinus;
+  const uint8_t* columnBitmap = nullptr;
+  const uint8_t* bitmap;
+  if (thresholded) {
+    columnBitmap = columnsAlongPanelRows ? renderer.getGlyphBitmapBw(fontData, glyph, true) : nullptr;
+    bitmap = columnBitmap ? columnBitmap : renderer.getGlyphBitmapBw(fontData, glyph, false);
+  } else {
+    columnBitmap = columnsAlongPanelRows ? renderer.getGlyphBitmapTransposed(fontData, glyph) : nullptr;
+    bitmap = columnBitmap ? columnBitmap : renderer.getGlyphBitmap(fontData, glyph);
+  }
 
   if (bitmap != nullptr) {
+    constexpr int screenWidth = logicalWidth<orientation>();
+    constexpr int screenHeight = logicalHeight<orientation>();
+    constexpr PanelStep innerStep =
+        rotation == TextRotation::Rotated90CW ? stepAlongNegY<orientation>() : stepAlongX<orientation>();
+
     // For Normal:  outer loop advances screenY, inner loop advances screenX
     // For Rotated: outer loop advances screenX, inner loop advances screenY (in reverse)
     int outerBase, innerBase;
+    int outerStart, outerEnd, innerStart, innerEnd;  // Visible glyph rows / columns, end exclusive
     if constexpr (rotation == TextRotation::Rotated90CW) {
       outerBase = *cursorX + fontData->ascender - top;  // screenX = outerBase + glyphY
       innerBase = *cursorY - left;                      // screenY = innerBase - glyphX
+      outerStart = std::max(0, -outerBase);
+      outerEnd = std::min(height, screenWidth - outerBase);
+      innerStart = std::max(0, innerBase - screenHeight + 1);
+      innerEnd = std::min(width, innerBase + 1);
     } else {
       outerBase = *cursorY - top;   // screenY = outerBase + glyphY
       innerBase = *cursorX + left;  // screenX = innerBase + glyphX
+      outerStart = std::max(0, -outerBase);
+      outerEnd = std::min(height, screenHeight - outerBase);
+      innerStart = std::max(0, -innerBase);
+      innerEnd = std::min(width, screenWidth - innerBase);
     }
 
-    if (is2Bit) {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
-          } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
-          }
-
-          const uint8_t byte = bitmap[pixelPosition >> 2];
-          const uint8_t bit_index = (3 - (pixelPosition & 3)) * 2;
-          // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
-          // we swap this to better match the way images and screen think about colors:
-          // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
-          const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
-
-          if (renderMode == GfxRenderer::BW && bmpVal < 3) {
-            // Black (also paints over the grays in BW mode)
-            renderer.drawPixel(screenX, screenY, pixelState);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_MSB && (bmpVal == 1 || bmpVal == 2)) {
-            // Light gray (also mark the MSB if it's going to be a dark gray too)
-            // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
-            renderer.drawPixel(screenX, screenY, false);
-          } else if (renderMode == GfxRenderer::GRAYSCALE_LSB && bmpVal == 1) {
-            // Dark gray
-            renderer.drawPixel(screenX, screenY, false);
-          }
-        }
-      }
+    uint8_t* frameBuffer = renderer.getFrameBuffer();
+    bool gray = false;
+    if (columnBitmap) {
+      gray = renderGlyphColumns<rotation, orientation, renderMode>(frameBuffer, columnBitmap, is2Bit, height,
+                                                                   outerBase, innerBase, outerStart, outerEnd,
+                                                                   innerStart, innerEnd, pixelState);
     } else {
-      int pixelPosition = 0;
-      for (int glyphY = 0; glyphY < height; glyphY++) {
-        const int outerCoord = outerBase + glyphY;
-        for (int glyphX = 0; glyphX < width; glyphX++, pixelPosition++) {
-          int screenX, screenY;
-          if constexpr (rotation == TextRotation::Rotated90CW) {
-            screenX = outerCoord;
-            screenY = innerBase - glyphX;
-          } else {
-            screenX = innerBase + glyphX;
-            screenY = outerCoord;
+      for (int glyphY = outerStart; glyphY < outerEnd; glyphY++) {
+        int screenX, screenY;
+        if constexpr (rotation == TextRotation::Rotated90CW) {
+          screenX = outerBase + glyphY;
+          screenY = innerBase - innerStart;
+        } else {
+          screenX = innerBase + innerStart;
+          screenY = outerBase + glyphY;
+        }
+        int phyX = 0, phyY = 0;
+        rotateCoordinates(orientation, screenX, screenY, &phyX, &phyY);
+        PanelCursor<innerStep> panel(frameBuffer, phyX, phyY);
+
+        int pixelPosition = glyphY * width + innerStart;
+        if (is2Bit) {
+          for (int glyphX = innerStart; glyphX < innerEnd; glyphX++, pixelPosition++, panel.advance()) {
+            const uint8_t byte = bitmap[pixelPosition >> 2];
+            const uint8_t bit_index = (3 - (pixelPosition & 3)) * 2;
+            // the direct bit from the font is 0 -> white, 1 -> light gray, 2 -> dark gray, 3 -> black
+            // we swap this to better match the way images and screen think about colors:
+            // 0 -> black, 1 -> dark grey, 2 -> light grey, 3 -> white
+            const uint8_t bmpVal = 3 - ((byte >> bit_index) & 0x3);
+
+            if (glyphPixelWritten<renderMode>(bmpVal)) {
+              // We have to flag pixels in reverse for the gray buffers, as 0 leave alone, 1 update
+              panel.write(renderMode == GfxRenderer::BW ? pixelState : false);
+              if constexpr (renderMode == GfxRenderer::BW) {
+                gray |= bmpVal != 0;
+              }
+            }
           }
-
-          const uint8_t byte = bitmap[pixelPosition >> 3];
-          const uint8_t bit_index = 7 - (pixelPosition & 7);
-
-          if ((byte >> bit_index) & 1) {
-            renderer.drawPixel(screenX, screenY, pixelState);
+        } else {
+          for (int glyphX = innerStart; glyphX < innerEnd; glyphX++, pixelPosition++, panel.advance()) {
+            const uint8_t byte = bitmap[pixelPosition >> 3];
+            const uint8_t bit_index = 7 - (pixelPosition & 7);
+
+            if ((byte >> bit_index) & 1) {
+              panel.write(pixelState);
+            }
           }
         }
       }
     }
+
+    // A thresholded glyph no longer knows its gray levels, so the font's gray bit of the glyph stands in for them
+    if (thresholded && outerStart < outerEnd && innerStart < innerEnd) {
+      const uint32_t glyphIndex = glyph - fontData->glyph;
+      gray = fontData->grayGlyphs == nullptr || (fontData->grayGlyphs[glyphIndex >> 3] & (0x80 >> (glyphIndex & 7)));
+    }
+    if (gray) {
+      renderer.markGrayContent();
+    }
   }
 
   if (!utf8IsCombiningMark(cp)) {
@@ -166,6 +481,39 @@ static void renderCharImpl(const GfxRenderer& renderer, GfxRenderer::RenderMode
   }
 }
 
+using RenderCharFn = void (*)(const GfxRenderer&, const EpdFontFamily&, uint32_t, int*, int*, bool,
+                              EpdFontFamily::Style);
+
+template <TextRotation rotation, GfxRenderer::Orientation orientation>
+static constexpr RenderCharFn selectRenderChar(const GfxRenderer::RenderMode renderMode) {
+  switch (renderMode) {
+    case GfxRenderer::GRAYSCALE_LSB:
+      return renderCharImpl<rotation, orientation, GfxRenderer::GRAYSCALE_LSB>;
+    case GfxRenderer::GRAYSCALE_MSB:
+      return renderCharImpl<rotation, orientation, GfxRenderer::GRAYSCALE_MSB>;
+    case GfxRenderer::BW:
+    default:
+      return renderCharImpl<rotation, orientation, GfxRenderer::BW>;
+  }
+}
+
+// Resolve the glyph renderer once per draw call instead of branching on orientation and render mode per pixel
+template <TextRotation rotation>
+static RenderCharFn selectRenderChar(const GfxRenderer::Orientation orientation,
+                                     const GfxRenderer::RenderMode renderMode) {
+  switch (orientation) {
+    case GfxRenderer::LandscapeClockwise:
+      return selectRenderChar<rotation, GfxRenderer::LandscapeClockwise>(renderMode);
+    case GfxRenderer::PortraitInverted:
+      return selectRenderChar<rotation, GfxRenderer::PortraitInverted>(renderMode);
+    case GfxRenderer::LandscapeCounterClockwise:
+      return selectRenderChar<rotation, GfxRenderer::LandscapeCounterClockwise>(renderMode);
+    case GfxRenderer::Portrait:
+    default:
+      return selectRenderChar<rotation, GfxRenderer::Portrait>(renderMode);
+  }
+}
+
 // IMPORTANT: This function is in critical rendering path and is called for every pixel. Please keep it as simple and
 // efficient as possible.
 void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
@@ -193,26 +541,38 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
 }
 
 int GfxRenderer::getTextWidth(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  return getTextWidth(getFont(fontId), text, style);
+}
+
+int GfxRenderer::getTextWidth(const FontHandle font, const char* text, const EpdFontFamily::Style style) const {
+  if (!font.isValid()) {
     return 0;
   }
 
   int w = 0, h = 0;
-  fontIt->second.getTextDimensions(text, &w, &h, style);
+  font.family->getTextDimensions(text, &w, &h, style);
   return w;
 }
 
 void GfxRenderer::drawCenteredText(const int fontId, const int y, const char* text, const bool black,
                                    const EpdFontFamily::Style style) const {
-  const int x = (getScreenWidth() - getTextWidth(fontId, text, style)) / 2;
-  drawText(fontId, x, y, text, black, style);
+  drawCenteredText(getFont(fontId), y, text, black, style);
+}
+
+void GfxRenderer::drawCenteredText(const FontHandle font, const int y, const char* text, const bool black,
+                                   const EpdFontFamily::Style style) const {
+  const int x = (getScreenWidth() - getTextWidth(font, text, style)) / 2;
+  drawText(font, x, y, text, black, style);
 }
 
 void GfxRenderer::drawText(const int fontId, const int x, const int y, const char* text, const bool black,
                            const EpdFontFamily::Style style) const {
-  int yPos = y + getFontAscenderSize(fontId);
+  drawText(getFont(fontId), x, y, text, black, style);
+}
+
+void GfxRenderer::drawText(const FontHandle fontHandle, const int x, const int y, const char* text,
+                           const bool black, const EpdFontFamily::Style style) const {
+  int yPos = y + getFontAscenderSize(fontHandle);
   int xpos = x;
   int lastBaseX = x;
   int lastBaseY = yPos;
@@ -221,16 +581,12 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
   bool hasBaseGlyph = false;
 
   // cannot draw a NULL / empty string
-  if (text == nullptr || *text == '\0') {
+  if (text == nullptr || *text == '\0' || !fontHandle.isValid()) {
     return;
   }
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
-    return;
-  }
-  const auto& font = fontIt->second;
+  const EpdFontFamily& font = *fontHandle.family;
+  const RenderCharFn renderChar = selectRenderChar<TextRotation::None>(orientation, renderMode);
   constexpr int MIN_COMBINING_GAP_PX = 1;
 
   uint32_t cp;
@@ -251,7 +607,7 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
 
       int combiningX = lastBaseX + lastBaseAdvance / 2;
       int combiningY = lastBaseY - raiseBy;
-      renderChar(font, cp, &combiningX, &combiningY, black, style);
+      renderChar(*this, font, cp, &combiningX, &combiningY, black, style);
       continue;
     }
 
@@ -268,7 +624,7 @@ void GfxRenderer::drawText(const int fontId, const int x, const int y, const cha
       hasBaseGlyph = true;
     }
 
-    renderChar(font, cp, &xpos, &yPos, black, style);
+    renderChar(*this, font, cp, &xpos, &yPos, black, style);
   }
 }
 
@@ -277,16 +633,12 @@ void GfxRenderer::drawLine(int x1, int y1, int x2, int y2, const bool state) con
     if (y2 < y1) {
       std::swap(y1, y2);
     }
-    for (int y = y1; y <= y2; y++) {
-      drawPixel(x1, y, state);
-    }
+    fillRect(x1, y1, 1, y2 - y1 + 1, state);
   } else if (y1 == y2) {
     if (x2 < x1) {
       std::swap(x1, x2);
     }
-    for (int x = x1; x <= x2; x++) {
-      drawPixel(x, y1, state);
-    }
+    fillRect(x1, y1, x2 - x1 + 1, 1, state);
   } else {
     // Bresenham's line algorithm — integer arithmetic only
     int dx = x2 - x1;
@@ -343,18 +695,24 @@ void GfxRenderer::drawArc(const int maxRadius, const int cx, const int cy, const
   const int innerRadius = std::max(maxRadius - stroke, 0);
   const int outerRadiusSq = maxRadius * maxRadius;
   const int innerRadiusSq = innerRadius * innerRadius;
+  // The ring covers one contiguous dx range per row, so each row is drawn as a single span
+  int dxMax = maxRadius;
+  int dxMin = innerRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      if (distSq > outerRadiusSq || distSq < innerRadiusSq) {
-        continue;
-      }
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      drawPixel(px, py, state);
+    while (dxMax >= 0 && dxMax * dxMax + dy * dy > outerRadiusSq) {
+      dxMax--;
+    }
+    while (dxMin > 0 && (dxMin - 1) * (dxMin - 1) + dy * dy >= innerRadiusSq) {
+      dxMin--;
+    }
+    if (dxMin > dxMax) {
+      continue;
     }
+    const int py = cy + yDir * dy;
+    const int spanStart = xDir > 0 ? cx + dxMin : cx - dxMax;
+    fillRect(spanStart, py, dxMax - dxMin + 1, 1, state);
   }
-};
+}
 
 // Border is inside the rectangle, rounded corners
 void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, const int height, const int lineWidth,
@@ -415,71 +773,108 @@ void GfxRenderer::drawRoundedRect(const int x, const int y, const int width, con
 }
 
 void GfxRenderer::fillRect(const int x, const int y, const int width, const int height, const bool state) const {
-  for (int fillY = y; fillY < y + height; fillY++) {
-    drawLine(x, fillY, x + width - 1, fillY, state);
-  }
+  const uint8_t rowPatterns[2] = {static_cast<uint8_t>(state ? 0x00 : 0xFF), static_cast<uint8_t>(state ? 0x00 : 0xFF)};
+  fillRectPattern(x, y, width, height, rowPatterns);
 }
 
-// NOTE: Those are in critical path, and need to be templated to avoid runtime checks for every pixel.
-// Any branching must be done outside the loops to avoid performance degradation.
-template <>
-void GfxRenderer::drawPixelDither<Color::Clear>(const int x, const int y) const {
-  // Do nothing
+// Dither colors are 2x2 periodic in logical space, so every physical row repeats one byte and rows alternate
+// between two bytes. Resolve them once per fill by mapping the first 8 pixels of an even and an odd panel row back to
+// logical coordinates.
+void GfxRenderer::getFillPattern(const Color color, uint8_t rowPatterns[2]) const {
+  for (int phyY = 0; phyY < 2; phyY++) {
+    uint8_t pattern = 0;
+    for (int phyX = 0; phyX < 8; phyX++) {
+      int x = 0;
+      int y = 0;
+      unrotateCoordinates(orientation, phyX, phyY, &x, &y);
+      bool black;
+      switch (color) {
+        case Color::Black:
+          black = true;
+          break;
+        case Color::LightGray:
+          black = x % 2 == 0 && y % 2 == 0;
+          break;
+        case Color::DarkGray:
+          black = (x + y) % 2 == 0;  // TODO: maybe find a better pattern?
+          break;
+        default:
+          black = false;
+          break;
+      }
+      if (!black) {
+        pattern |= 0x80 >> phyX;
+      }
+    }
+    rowPatterns[phyY] = pattern;
+  }
 }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::Black>(const int x, const int y) const {
-  drawPixel(x, y, true);
-}
+// IMPORTANT: This is the common path for fills, lines and theme widgets. It maps the logical rectangle to a panel
+// rectangle once, clips it, and then writes each panel row as masked edge bytes plus a memset for the middle.
+void GfxRenderer::fillRectPattern(const int x, const int y, const int width, const int height,
+                                  const uint8_t rowPatterns[2]) const {
+  if (width <= 0 || height <= 0) {
+    return;
+  }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::White>(const int x, const int y) const {
-  drawPixel(x, y, false);
-}
+  int phyX1 = 0, phyY1 = 0, phyX2 = 0, phyY2 = 0;
+  rotateCoordinates(orientation, x, y, &phyX1, &phyY1);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &phyX2, &phyY2);
+  if (phyX1 > phyX2) std::swap(phyX1, phyX2);
+  if (phyY1 > phyY2) std::swap(phyY1, phyY2);
 
-template <>
-void GfxRenderer::drawPixelDither<Color::LightGray>(const int x, const int y) const {
-  drawPixel(x, y, x % 2 == 0 && y % 2 == 0);
-}
+  phyX1 = std::max(phyX1, 0);
+  phyY1 = std::max(phyY1, 0);
+  phyX2 = std::min(phyX2, HalDisplay::DISPLAY_WIDTH - 1);
+  phyY2 = std::min(phyY2, HalDisplay::DISPLAY_HEIGHT - 1);
+  if (phyX1 > phyX2 || phyY1 > phyY2) {
+    return;
+  }
 
-template <>
-void GfxRenderer::drawPixelDither<Color::DarkGray>(const int x, const int y) const {
-  drawPixel(x, y, (x + y) % 2 == 0);  // TODO: maybe find a better pattern?
+  const int firstByte = phyX1 / 8;
+  const int lastByte = phyX2 / 8;
+  const uint8_t firstMask = 0xFF >> (phyX1 % 8);
+  const uint8_t lastMask = 0xFF << (7 - (phyX2 % 8));
+
+  for (int phyY = phyY1; phyY <= phyY2; phyY++) {
+    const uint8_t pattern = rowPatterns[phyY & 1];
+    uint8_t* row = frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES;
+
+    if (firstByte == lastByte) {
+      const uint8_t mask = firstMask & lastMask;
+      row[firstByte] = (row[firstByte] & ~mask) | (pattern & mask);
+      continue;
+    }
+
+    row[firstByte] = (row[firstByte] & ~firstMask) | (pattern & firstMask);
+    if (lastByte - firstByte > 1) {
+      memset(row + firstByte + 1, pattern, lastByte - firstByte - 1);
+    }
+    row[lastByte] = (row[lastByte] & ~lastMask) | (pattern & lastMask);
+  }
 }
 
 void GfxRenderer::fillRectDither(const int x, const int y, const int width, const int height, Color color) const {
   if (color == Color::Clear) {
-  } else if (color == Color::Black) {
-    fillRect(x, y, width, height, true);
-  } else if (color == Color::White) {
-    fillRect(x, y, width, height, false);
-  } else if (color == Color::LightGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::LightGray>(fillX, fillY);
-      }
-    }
-  } else if (color == Color::DarkGray) {
-    for (int fillY = y; fillY < y + height; fillY++) {
-      for (int fillX = x; fillX < x + width; fillX++) {
-        drawPixelDither<Color::DarkGray>(fillX, fillY);
-      }
-    }
+    return;
   }
+  uint8_t rowPatterns[2];
+  getFillPattern(color, rowPatterns);
+  fillRectPattern(x, y, width, height, rowPatterns);
 }
 
-template <Color color>
-void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir) const {
+void GfxRenderer::fillArc(const int maxRadius, const int cx, const int cy, const int xDir, const int yDir,
+                          const uint8_t rowPatterns[2]) const {
   const int radiusSq = maxRadius * maxRadius;
+  int dxMax = maxRadius;
   for (int dy = 0; dy <= maxRadius; ++dy) {
-    for (int dx = 0; dx <= maxRadius; ++dx) {
-      const int distSq = dx * dx + dy * dy;
-      const int px = cx + xDir * dx;
-      const int py = cy + yDir * dy;
-      if (distSq <= radiusSq) {
-        drawPixelDither<color>(px, py);
-      }
+    while (dxMax * dxMax + dy * dy > radiusSq) {
+      dxMax--;
     }
+    const int py = cy + yDir * dy;
+    const int spanStart = xDir > 0 ? cx : cx - dxMax;
+    fillRectPattern(spanStart, py, dxMax + 1, 1, rowPatterns);
   }
 }
 
@@ -491,7 +886,7 @@ void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, con
 void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, const int height, const int cornerRadius,
                                   bool roundTopLeft, bool roundTopRight, bool roundBottomLeft, bool roundBottomRight,
                                   const Color color) const {
-  if (width <= 0 || height <= 0) {
+  if (width <= 0 || height <= 0 || color == Color::Clear) {
     return;
   }
 
@@ -520,39 +915,23 @@ void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, con
     fillRectDither(x + width - maxRadius - 1, rightFillTop, maxRadius + 1, rightFillBottom - rightFillTop + 1, color);
   }
 
-  auto fillArcTemplated = [this](int maxRadius, int cx, int cy, int xDir, int yDir, Color color) {
-    switch (color) {
-      case Color::Clear:
-        break;
-      case Color::Black:
-        fillArc<Color::Black>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::White:
-        fillArc<Color::White>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::LightGray:
-        fillArc<Color::LightGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-      case Color::DarkGray:
-        fillArc<Color::DarkGray>(maxRadius, cx, cy, xDir, yDir);
-        break;
-    }
-  };
+  uint8_t rowPatterns[2];
+  getFillPattern(color, rowPatterns);
 
   if (roundTopLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + maxRadius, -1, -1, color);
+    fillArc(maxRadius, x + maxRadius, y + maxRadius, -1, -1, rowPatterns);
   }
 
   if (roundTopRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + maxRadius, 1, -1, rowPatterns);
   }
 
   if (roundBottomRight) {
-    fillArcTemplated(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, color);
+    fillArc(maxRadius, x + width - maxRadius - 1, y + height - maxRadius - 1, 1, 1, rowPatterns);
   }
 
   if (roundBottomLeft) {
-    fillArcTemplated(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, color);
+    fillArc(maxRadius, x + maxRadius, y + height - maxRadius - 1, -1, 1, rowPatterns);
   }
 }
 
@@ -613,6 +992,9 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
   const int outputRowSize = (bitmap.getWidth() + 3) / 4;
   auto* outputRow = static_cast<uint8_t*>(malloc(outputRowSize));
   auto* rowBytes = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
+  const uint8_t* lut = PLANE_LUTS.modes[renderMode];
+  const uint8_t* grayLut = PLANE_LUTS.modes[GRAYSCALE_MSB];
+  const int screenWidth = getScreenWidth();
 
   if (!outputRow || !rowBytes) {
     LOG_ERR("GFX", "!! Failed to allocate BMP row buffers");
@@ -649,29 +1031,36 @@ void GfxRenderer::drawBitmap(const Bitmap& bitmap, const int x, const int y, con
       continue;
     }
 
+    if (!isScaled) {
+      drawPixelRow(outputRow, x, screenY, bitmap.getWidth() - 2 * cropPixX, cropPixX);
+      continue;
+    }
+
+    // Scaled rows: several source pixels can land on one screen pixel, so collect them into a row mask first
+    uint8_t rowMask[ROW_MASK_BYTES] = {};
     for (int bmpX = cropPixX; bmpX < bitmap.getWidth() - cropPixX; bmpX++) {
-      int screenX = bmpX - cropPixX;
-      if (isScaled) {
-        screenX = std::floor(screenX * scale);
+      const uint8_t hits = lut[outputRow[bmpX / 4]];
+      if (!hits) {
+        bmpX |= 3;  // No pixel of this source byte is drawn, skip to the next one
+        continue;
+      }
+      if (!(hits & (0x08 >> (bmpX % 4)))) {
+        continue;
       }
-      screenX += x;  // the offset should not be scaled
-      if (screenX >= getScreenWidth()) {
+
+      const int screenX = static_cast<int>(std::floor((bmpX - cropPixX) * scale)) + x;
+      if (screenX >= screenWidth) {
         break;
       }
       if (screenX < 0) {
         continue;
       }
-
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
-
-      if (renderMode == BW && val < 3) {
-        drawPixel(screenX, screenY);
-      } else if (renderMode == GRAYSCALE_MSB && (val == 1 || val == 2)) {
-        drawPixel(screenX, screenY, false);
-      } else if (renderMode == GRAYSCALE_LSB && val == 1) {
-        drawPixel(screenX, screenY, false);
+      rowMask[screenX / 8] |= 0x80 >> (screenX % 8);
+      if (renderMode == BW && (grayLut[outputRow[bmpX / 4]] & (0x08 >> (bmpX % 4)))) {
+        grayContent = true;
       }
     }
+    blitRowMask(rowMask, screenY, renderMode == BW);
   }
 
   free(outputRow);
@@ -703,6 +1092,9 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
     return;
   }
 
+  const uint8_t* lut = PLANE_LUTS.modes[BW];
+  const int screenWidth = getScreenWidth();
+
   for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
     // Read rows sequentially using readNextRow
     if (bitmap.readNextRow(outputRow, rowBytes) != BmpReaderError::Ok) {
@@ -722,29 +1114,142 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
       continue;
     }
 
-    for (int bmpX = 0; bmpX < bitmap.getWidth(); bmpX++) {
-      int screenX = x + (isScaled ? static_cast<int>(std::floor(bmpX * scale)) : bmpX);
-      if (screenX >= getScreenWidth()) {
-        break;
+    // For 1-bit source: 0 or 1 -> map to black (0,1,2) or white (3)
+    // Black pixels (val < 3) are drawn in every render mode, white pixels leave the background
+    uint8_t rowMask[ROW_MASK_BYTES] = {};
+    if (isScaled) {
+      for (int bmpX = 0; bmpX < bitmap.getWidth(); bmpX++) {
+        const uint8_t hits = lut[outputRow[bmpX / 4]];
+        if (!hits) {
+          bmpX |= 3;  // No pixel of this source byte is drawn, skip to the next one
+          continue;
+        }
+        if (!(hits & (0x08 >> (bmpX % 4)))) {
+          continue;
+        }
+
+        const int screenX = x + static_cast<int>(std::floor(bmpX * scale));
+        if (screenX >= screenWidth) {
+          break;
+        }
+        if (screenX < 0) {
+          continue;
+        }
+        rowMask[screenX / 8] |= 0x80 >> (screenX % 8);
       }
-      if (screenX < 0) {
-        continue;
+    } else {
+      const int firstX = std::max(0, -x);
+      const int lastX = std::min(bitmap.getWidth(), screenWidth - x);  // exclusive
+      for (int bmpX = firstX & ~3; bmpX < lastX; bmpX += 4) {
+        uint8_t hits = lut[outputRow[bmpX / 4]];
+        if (bmpX < firstX) hits &= 0x0F >> (firstX - bmpX);
+        if (bmpX + 4 > lastX) hits &= (0x0F << (bmpX + 4 - lastX)) & 0x0F;
+        if (hits) {
+          orRowMaskNibble(rowMask, x + bmpX, hits);
+        }
       }
+    }
+    blitRowMask(rowMask, screenY, true);
+  }
 
-      // Get 2-bit value (result of readNextRow quantization)
-      const uint8_t val = outputRow[bmpX / 4] >> (6 - ((bmpX * 2) % 8)) & 0x3;
+  free(outputRow);
+  free(rowBytes);
+}
 
-      // For 1-bit source: 0 or 1 -> map to black (0,1,2) or white (3)
-      // val < 3 means black pixel (draw it)
-      if (val < 3) {
-        drawPixel(screenX, screenY, true);
+void GfxRenderer::drawPixelRow(const uint8_t* pixels, const int x, const int y, const int width,
+                               const int srcX) const {
+  if (width <= 0 || y < 0 || y >= getScreenHeight()) {
+    return;
+  }
+
+  // Visible source range [first, last) after clipping against the logical screen
+  const int first = std::max(srcX, srcX - x);
+  const int last = std::min(srcX + width, srcX + getScreenWidth() - x);
+  if (first >= last) {
+    return;
+  }
+
+  const uint8_t* lut = PLANE_LUTS.modes[renderMode];
+  // In BW mode, the pixels the MSB pass would flag are the row's gray pixels
+  const uint8_t* grayLut = renderMode == BW && !grayContent ? PLANE_LUTS.modes[GRAYSCALE_MSB] : nullptr;
+  uint8_t rowMask[ROW_MASK_BYTES] = {};
+  for (int byteStart = first & ~3; byteStart < last; byteStart += 4) {
+    uint8_t visible = 0x0F;
+    if (byteStart < first) visible &= 0x0F >> (first - byteStart);
+    if (byteStart + 4 > last) visible &= (0x0F << (byteStart + 4 - last)) & 0x0F;
+    const uint8_t hits = lut[pixels[byteStart / 4]] & visible;
+    if (hits) {
+      orRowMaskNibble(rowMask, x + byteStart - srcX, hits);
+    }
+    if (grayLut && (grayLut[pixels[byteStart / 4]] & visible)) {
+      grayContent = true;
+      grayLut = nullptr;
+    }
+  }
+  blitRowMask(rowMask, y, renderMode == BW);
+}
+
+// Writes one logical row mask (see blitRowMask) for a compile-time orientation. Landscape rows are written byte by
+// byte, portrait rows walk a single panel column through a PanelCursor.
+template <GfxRenderer::Orientation orientation>
+static void blitRowMaskImpl(uint8_t* frameBuffer, const uint8_t* mask, const int y, const bool state) {
+  constexpr int maskBytes = logicalWidth<orientation>() / 8;
+  if constexpr (orientation == GfxRenderer::LandscapeCounterClockwise) {
+    // phyX = x: mask byte i is panel byte i of row y
+    uint8_t* row = frameBuffer + y * HalDisplay::DISPLAY_WIDTH_BYTES;
+    for (int i = 0; i < maskBytes; i++) {
+      const uint8_t m = mask[i];
+      if (m) row[i] = state ? (row[i] & ~m) : (row[i] | m);
+    }
+  } else if constexpr (orientation == GfxRenderer::LandscapeClockwise) {
+    // phyX = W - 1 - x: mask byte i is panel byte (W/8 - 1 - i) with its bits reversed
+    uint8_t* row = frameBuffer + (HalDisplay::DISPLAY_HEIGHT - 1 - y) * HalDisplay::DISPLAY_WIDTH_BYTES;
+    for (int i = 0; i < maskBytes; i++) {
+      if (!mask[i]) continue;
+      const uint8_t m = reverseBits(mask[i]);
+      uint8_t& dst = row[HalDisplay::DISPLAY_WIDTH_BYTES - 1 - i];
+      dst = state ? (dst & ~m) : (dst | m);
+    }
+  } else {
+    // Portrait: phyX = y, phyY = H - 1 - x (walk up the panel column)
+    // PortraitInverted: phyX = W - 1 - y, phyY = x (walk down the panel column)
+    constexpr int stride =
+        orientation == GfxRenderer::Portrait ? -HalDisplay::DISPLAY_WIDTH_BYTES : HalDisplay::DISPLAY_WIDTH_BYTES;
+    int phyX = 0, phyY = 0;
+    rotateCoordinates(orientation, 0, y, &phyX, &phyY);
+    uint8_t* column = frameBuffer + phyY * HalDisplay::DISPLAY_WIDTH_BYTES + phyX / 8;
+    const uint8_t bit = 0x80 >> (phyX % 8);
+    for (int i = 0; i < maskBytes; i++) {
+      const uint8_t m = mask[i];
+      if (!m) continue;
+      uint8_t* p = column + i * 8 * stride;
+      for (int b = 0; b < 8; b++, p += stride) {
+        if (m & (0x80 >> b)) *p = state ? (*p & ~bit) : (*p | bit);
       }
-      // White pixels (val == 3) are not drawn (leave background)
     }
   }
+}
 
-  free(outputRow);
-  free(rowBytes);
+// IMPORTANT: Shared by all bitmap and image row paths. Orientation is resolved once per row.
+void GfxRenderer::blitRowMask(const uint8_t* mask, const int y, const bool state) const {
+  if (y < 0 || y >= getScreenHeight()) {
+    return;
+  }
+
+  switch (orientation) {
+    case Portrait:
+      blitRowMaskImpl<Portrait>(frameBuffer, mask, y, state);
+      break;
+    case LandscapeClockwise:
+      blitRowMaskImpl<LandscapeClockwise>(frameBuffer, mask, y, state);
+      break;
+    case PortraitInverted:
+      blitRowMaskImpl<PortraitInverted>(frameBuffer, mask, y, state);
+      break;
+    case LandscapeCounterClockwise:
+      blitRowMaskImpl<LandscapeCounterClockwise>(frameBuffer, mask, y, state);
+      break;
+  }
 }
 
 void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state) const {
@@ -806,9 +1311,7 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
       if (endX >= getScreenWidth()) endX = getScreenWidth() - 1;
 
       // Draw horizontal line
-      for (int x = startX; x <= endX; x++) {
-        drawPixel(x, scanY, state);
-      }
+      fillRect(startX, scanY, endX - startX + 1, 1, state);
     }
   }
 
@@ -835,19 +1338,48 @@ void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const
   display.displayBuffer(refreshMode, fadingFix);
 }
 
+#ifdef ENABLE_WINDOWED_IMAGE_REFRESH
+void GfxRenderer::displayWindow(const int x, const int y, const int width, const int height) const {
+  if (width <= 0 || height <= 0) {
+    return;
+  }
+
+  int phyX1 = 0, phyY1 = 0, phyX2 = 0, phyY2 = 0;
+  rotateCoordinates(orientation, x, y, &phyX1, &phyY1);
+  rotateCoordinates(orientation, x + width - 1, y + height - 1, &phyX2, &phyY2);
+  if (phyX1 > phyX2) std::swap(phyX1, phyX2);
+  if (phyY1 > phyY2) std::swap(phyY1, phyY2);
+
+  // The controller addresses panel columns in bytes
+  phyX1 = std::max(phyX1, 0) & ~7;
+  phyY1 = std::max(phyY1, 0);
+  phyX2 = std::min(phyX2 | 7, HalDisplay::DISPLAY_WIDTH - 1);
+  phyY2 = std::min(phyY2, HalDisplay::DISPLAY_HEIGHT - 1);
+  if (phyX1 > phyX2 || phyY1 > phyY2) {
+    return;
+  }
+  display.displayWindow(phyX1, phyY1, phyX2 - phyX1 + 1, phyY2 - phyY1 + 1);
+}
+#endif
+
 std::string GfxRenderer::truncatedText(const int fontId, const char* text, const int maxWidth,
                                        const EpdFontFamily::Style style) const {
+  return truncatedText(getFont(fontId), text, maxWidth, style);
+}
+
+std::string GfxRenderer::truncatedText(const FontHandle font, const char* text, const int maxWidth,
+                                       const EpdFontFamily::Style style) const {
   if (!text || maxWidth <= 0) return "";
 
   std::string item = text;
   const char* ellipsis = "...";
-  int textWidth = getTextWidth(fontId, item.c_str(), style);
+  int textWidth = getTextWidth(font, item.c_str(), style);
   if (textWidth <= maxWidth) {
     // Text fits, return as is
     return item;
   }
 
-  while (!item.empty() && getTextWidth(fontId, (item + ellipsis).c_str(), style) >= maxWidth) {
+  while (!item.empty() && getTextWidth(font, (item + ellipsis).c_str(), style) >= maxWidth) {
     utf8RemoveLastChar(item);
   }
 
@@ -884,26 +1416,31 @@ int GfxRenderer::getScreenHeight() const {
 }
 
 int GfxRenderer::getSpaceWidth(const int fontId, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  return getSpaceWidth(getFont(fontId), style);
+}
+
+int GfxRenderer::getSpaceWidth(const FontHandle font, const EpdFontFamily::Style style) const {
+  if (!font.isValid()) {
     return 0;
   }
 
-  const EpdGlyph* spaceGlyph = fontIt->second.getGlyph(' ', style);
+  const EpdGlyph* spaceGlyph = font.family->getGlyph(' ', style);
   return spaceGlyph ? spaceGlyph->advanceX : 0;
 }
 
 int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, const EpdFontFamily::Style style) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+  return getTextAdvanceX(getFont(fontId), text, style);
+}
+
+int GfxRenderer::getTextAdvanceX(const FontHandle fontHandle, const char* text,
+                                 const EpdFontFamily::Style style) const {
+  if (!fontHandle.isValid()) {
     return 0;
   }
 
   uint32_t cp;
   int width = 0;
-  const auto& font = fontIt->second;
+  const EpdFontFamily& font = *fontHandle.family;
   while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&text)))) {
     if (utf8IsCombiningMark(cp)) {
       continue;
@@ -915,49 +1452,38 @@ int GfxRenderer::getTextAdvanceX(const int fontId, const char* text, const EpdFo
   return width;
 }
 
-int GfxRenderer::getFontAscenderSize(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
-    return 0;
-  }
+int GfxRenderer::getFontAscenderSize(const int fontId) const { return getFontAscenderSize(getFont(fontId)); }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+int GfxRenderer::getFontAscenderSize(const FontHandle font) const {
+  return font.isValid() ? font.family->getData(EpdFontFamily::REGULAR)->ascender : 0;
 }
 
-int GfxRenderer::getLineHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
-    return 0;
-  }
+int GfxRenderer::getLineHeight(const int fontId) const { return getLineHeight(getFont(fontId)); }
 
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->advanceY;
+int GfxRenderer::getLineHeight(const FontHandle font) const {
+  return font.isValid() ? font.family->getData(EpdFontFamily::REGULAR)->advanceY : 0;
 }
 
-int GfxRenderer::getTextHeight(const int fontId) const {
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
-    return 0;
-  }
-  return fontIt->second.getData(EpdFontFamily::REGULAR)->ascender;
+int GfxRenderer::getTextHeight(const int fontId) const { return getTextHeight(getFont(fontId)); }
+
+int GfxRenderer::getTextHeight(const FontHandle font) const {
+  return font.isValid() ? font.family->getData(EpdFontFamily::REGULAR)->ascender : 0;
 }
 
 void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y, const char* text, const bool black,
                                       const EpdFontFamily::Style style) const {
-  // Cannot draw a NULL / empty string
-  if (text == nullptr || *text == '\0') {
-    return;
-  }
+  drawTextRotated90CW(getFont(fontId), x, y, text, black, style);
+}
 
-  const auto fontIt = fontMap.find(fontId);
-  if (fontIt == fontMap.end()) {
-    LOG_ERR("GFX", "Font %d not found", fontId);
+void GfxRenderer::drawTextRotated90CW(const FontHandle fontHandle, const int x, const int y, const char* text,
+                                      const bool black, const EpdFontFamily::Style style) const {
+  // Cannot draw a NULL / empty string
+  if (text == nullptr || *text == '\0' || !fontHandle.isValid()) {
     return;
   }
 
-  const auto& font = fontIt->second;
+  const EpdFontFamily& font = *fontHandle.family;
+  const RenderCharFn renderChar = selectRenderChar<TextRotation::Rotated90CW>(orientation, renderMode);
 
   int xPos = x;
   int yPos = y;
@@ -986,7 +1512,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
 
       int combiningX = lastBaseX - raiseBy;
       int combiningY = lastBaseY - lastBaseAdvance / 2;
-      renderCharImpl<TextRotation::Rotated90CW>(*this, renderMode, font, cp, &combiningX, &combiningY, black, style);
+      renderChar(*this, font, cp, &combiningX, &combiningY, black, style);
       continue;
     }
 
@@ -1003,7 +1529,7 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
       hasBaseGlyph = true;
     }
 
-    renderCharImpl<TextRotation::Rotated90CW>(*this, renderMode, font, cp, &xPos, &yPos, black, style);
+    renderChar(*this, font, cp, &xPos, &yPos, black, style);
   }
 }
 
@@ -1103,11 +1629,6 @@ void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
   }
 }
 
-void GfxRenderer::renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
-                             EpdFontFamily::Style style) const {
-  renderCharImpl<TextRotation::None>(*this, renderMode, fontFamily, cp, x, y, pixelState, style);
-}
-
 void GfxRenderer::getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const {
   switch (orientation) {
     case Portrait:
@@ -4,7 +4,7 @@
 #include <FontDecompressor.h>
 #include <HalDisplay.h>
 
-#include <map>
+#include <string>
 
 #include "Bitmap.h"
 
@@ -12,6 +12,19 @@
 // 0 = transparent, 1-16 = gray levels (white to black)
 enum Color : uint8_t { Clear = 0x00, White = 0x01, LightGray = 0x05, DarkGray = 0x0A, Black = 0x10 };
 
+// A registered font family resolved by GfxRenderer::getFont. Layout and render loops hold one for the whole pass so
+// text calls skip the font ID lookup. Default-constructed handles (and unknown font IDs) measure and draw nothing.
+class FontHandle {
+ public:
+  FontHandle() = default;
+  bool isValid() const { return family != nullptr; }
+
+ private:
+  friend class GfxRenderer;
+  explicit FontHandle(const EpdFontFamily* family) : family(family) {}
+  const EpdFontFamily* family = nullptr;
+};
+
 class GfxRenderer {
  public:
   enum RenderMode { BW, GRAYSCALE_LSB, GRAYSCALE_MSB };
@@ -29,22 +42,34 @@ class GfxRenderer {
   static constexpr size_t BW_BUFFER_NUM_CHUNKS = HalDisplay::BUFFER_SIZE / BW_BUFFER_CHUNK_SIZE;
   static_assert(BW_BUFFER_CHUNK_SIZE * BW_BUFFER_NUM_CHUNKS == HalDisplay::BUFFER_SIZE,
                 "BW buffer chunking does not line up with display buffer size");
+  // Fonts are few and registered once at boot, so a flat table scanned on lookup beats a tree. Slots never move (fonts
+  // loaded on demand swap the family in place), which keeps FontHandles valid for the renderer's lifetime.
+  static constexpr int MAX_FONTS = 24;
+  struct FontSlot {
+    int fontId = 0;
+    EpdFontFamily family = EpdFontFamily(nullptr);
+  };
 
   HalDisplay& display;
   RenderMode renderMode;
   Orientation orientation;
   bool fadingFix;
+  // Set by the BW pass when it draws a pixel that the grayscale passes would refine, see hasGrayContent()
+  mutable bool grayContent = false;
   uint8_t* frameBuffer = nullptr;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
-  std::map<int, EpdFontFamily> fontMap;
+  FontSlot fontSlots[MAX_FONTS];
+  int fontCount = 0;
   FontDecompressor* fontDecompressor = nullptr;
-  void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, int* y, bool pixelState,
-                  EpdFontFamily::Style style) const;
   void freeBwBufferChunks();
-  template <Color color>
-  void drawPixelDither(int x, int y) const;
-  template <Color color>
-  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir) const;
+  // Span fills write whole framebuffer bytes. rowPatterns holds the panel byte for even and odd physical rows
+  // (bit set = white), so solid colors and the 2x2 dither colors share one code path.
+  void getFillPattern(Color color, uint8_t rowPatterns[2]) const;
+  void fillRectPattern(int x, int y, int width, int height, const uint8_t rowPatterns[2]) const;
+  void fillArc(int maxRadius, int cx, int cy, int xDir, int yDir, const uint8_t rowPatterns[2]) const;
+  // Row blits work on a 1-bit mask covering one logical screen row (bit set = pixel is written with `state`).
+  // Rows are byte aligned with the panel in landscape and map to a single panel column in portrait.
+  void blitRowMask(const uint8_t* mask, int y, bool state) const;
 
  public:
   explicit GfxRenderer(HalDisplay& halDisplay)
@@ -59,6 +84,11 @@ class GfxRenderer {
   // Setup
   void begin();  // must be called right after display.begin()
   void insertFont(int fontId, EpdFontFamily font);
+  // Swaps the family of an inserted font, for fonts loaded on demand. FontHandles stay valid, but nothing may draw with
+  // the font while it is swapped.
+  void replaceFont(int fontId, EpdFontFamily font);
+  // Resolves a font ID once; logs and returns an invalid handle if the font was never inserted
+  FontHandle getFont(int fontId) const;
   void setFontDecompressor(FontDecompressor* d) { fontDecompressor = d; }
   void clearFontCache() {
     if (fontDecompressor) fontDecompressor->clearCache();
@@ -75,8 +105,10 @@ class GfxRenderer {
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
-  // EXPERIMENTAL: Windowed update - display only a rectangular region
-  // void displayWindow(int x, int y, int width, int height) const;
+#ifdef ENABLE_WINDOWED_IMAGE_REFRESH
+  // EXPERIMENTAL: Windowed update - fast refresh of only a logical rectangle, widened to whole panel bytes
+  void displayWindow(int x, int y, int width, int height) const;
+#endif
   void invertScreen() const;
   void clearScreen(uint8_t color = 0xFF) const;
   void getOrientedViewableTRBL(int* outTop, int* outRight, int* outBottom, int* outLeft) const;
@@ -101,29 +133,52 @@ class GfxRenderer {
   void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight, float cropX = 0,
                   float cropY = 0) const;
   void drawBitmap1Bit(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight) const;
+  // Draw `width` packed 2-bit pixels (4 per byte, MSB first, 0 = black .. 3 = white) starting at source pixel `srcX`
+  // to logical (x, y), honoring the current render mode. Clipping is resolved once for the whole row.
+  void drawPixelRow(const uint8_t* pixels, int x, int y, int width, int srcX = 0) const;
   void fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state = true) const;
 
-  // Text
+  // Text. Every call taking a font ID has a FontHandle overload for callers that issue many calls with one font.
   int getTextWidth(int fontId, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  int getTextWidth(FontHandle font, const char* text, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawCenteredText(int fontId, int y, const char* text, bool black = true,
                         EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  void drawCenteredText(FontHandle font, int y, const char* text, bool black = true,
+                        EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   void drawText(int fontId, int x, int y, const char* text, bool black = true,
                 EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  void drawText(FontHandle font, int x, int y, const char* text, bool black = true,
+                EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getSpaceWidth(int fontId, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  int getSpaceWidth(FontHandle font, EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getTextAdvanceX(int fontId, const char* text, EpdFontFamily::Style style) const;
+  int getTextAdvanceX(FontHandle font, const char* text, EpdFontFamily::Style style) const;
   int getFontAscenderSize(int fontId) const;
+  int getFontAscenderSize(FontHandle font) const;
   int getLineHeight(int fontId) const;
+  int getLineHeight(FontHandle font) const;
   std::string truncatedText(int fontId, const char* text, int maxWidth,
                             EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  std::string truncatedText(FontHandle font, const char* text, int maxWidth,
+                            EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
 
   // Helper for drawing rotated text (90 degrees clockwise, for side buttons)
   void drawTextRotated90CW(int fontId, int x, int y, const char* text, bool black = true,
                            EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
+  void drawTextRotated90CW(FontHandle font, int x, int y, const char* text, bool black = true,
+                           EpdFontFamily::Style style = EpdFontFamily::REGULAR) const;
   int getTextHeight(int fontId) const;
+  int getTextHeight(FontHandle font) const;
 
   // Grayscale functions
   void setRenderMode(const RenderMode mode) { this->renderMode = mode; }
   RenderMode getRenderMode() const { return renderMode; }
+  // Whether anything drawn in BW mode since resetGrayContent() has gray levels: a visible anti-aliased glyph (glyphs
+  // drawn from pre-thresholded 1-bit groups always count) or a gray pixel of a 2-bit image. When false, the grayscale
+  // passes would leave both planes empty and can be skipped.
+  void resetGrayContent() { grayContent = false; }
+  bool hasGrayContent() const { return grayContent; }
+  void markGrayContent() const { grayContent = true; }
   void copyGrayscaleLsbBuffers() const;
   void copyGrayscaleMsbBuffers() const;
   void displayGrayBuffer() const;
@@ -133,6 +188,10 @@ class GfxRenderer {
 
   // Font helpers
   const uint8_t* getGlyphBitmap(const EpdFontData* fontData, const EpdGlyph* glyph) const;
+  // Column-major glyph bitmap (see FontDecompressor::getBitmapTransposed), nullptr if the font has no compressed groups
+  const uint8_t* getGlyphBitmapTransposed(const EpdFontData* fontData, const EpdGlyph* glyph) const;
+  // Thresholded 1-bit glyph bitmap (see FontDecompressor::getBwBitmap), nullptr if the font has no 1-bit groups
+  const uint8_t* getGlyphBitmapBw(const EpdFontData* fontData, const EpdGlyph* glyph, bool transposed) const;
 
   // Low level functions
   uint8_t* getFrameBuffer() const;
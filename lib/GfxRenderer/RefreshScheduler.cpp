@@ -0,0 +1,81 @@
+#include "RefreshScheduler.h"
+
+namespace {
+constexpr uint32_t PANEL_PIXELS = static_cast<uint32_t>(HalDisplay::DISPLAY_WIDTH) * HalDisplay::DISPLAY_HEIGHT;
+// A region whose own ghosting reaches this share of its pixels is cleaned with the page that causes it
+constexpr uint32_t HEAVY_REGION_PERCENT = 35;
+// Clearing this much black leaves a negative even a HALF_REFRESH shows faintly, e.g. after a full-page image
+constexpr uint32_t FULL_REFRESH_CLEAR_PERCENT = 25;
+
+// Black→white transitions leave the most visible residue, white→black ones about half as much
+uint32_t ghostingScore(const uint32_t blackToWhite, const uint32_t whiteToBlack) {
+  return blackToWhite + whiteToBlack / 2;
+}
+}  // namespace
+
+RefreshScheduler::Transitions RefreshScheduler::update(const uint8_t* frameBuffer) {
+  Transitions transitions;
+  for (int regionRow = 0; regionRow < REGION_ROWS; regionRow++) {
+    for (int regionCol = 0; regionCol < REGION_COLS; regionCol++) {
+      uint32_t ink = 0;
+      uint32_t hash = 2166136261u;
+      const uint8_t* row = frameBuffer + regionRow * REGION_HEIGHT * HalDisplay::DISPLAY_WIDTH_BYTES +
+                           regionCol * REGION_WIDTH_BYTES;
+      for (int y = 0; y < REGION_HEIGHT; y++, row += HalDisplay::DISPLAY_WIDTH_BYTES) {
+        for (int x = 0; x < REGION_WIDTH_BYTES; x++) {
+          ink += __builtin_popcount(static_cast<uint8_t>(~row[x]));  // Cleared bits are black
+          hash = (hash ^ row[x]) * 16777619u;
+        }
+      }
+
+      Region& region = regions[regionRow * REGION_COLS + regionCol];
+      if (valid && region.hash != hash) {
+        // Old and new ink are treated as independent coverage of the region
+        const uint32_t blackToWhite = region.ink * (REGION_PIXELS - ink) / REGION_PIXELS;
+        const uint32_t whiteToBlack = ink * (REGION_PIXELS - region.ink) / REGION_PIXELS;
+        transitions.blackToWhite += blackToWhite;
+        transitions.whiteToBlack += whiteToBlack;
+        const uint32_t score = ghostingScore(blackToWhite, whiteToBlack);
+        if (score > transitions.worstRegion) {
+          transitions.worstRegion = score;
+        }
+      }
+      region.ink = static_cast<uint16_t>(ink);
+      region.hash = hash;
+    }
+  }
+  return transitions;
+}
+
+HalDisplay::RefreshMode RefreshScheduler::next(const uint8_t* frameBuffer, const int refreshFrequency) {
+  const bool wasValid = valid;
+  const Transitions transitions = update(frameBuffer);
+  valid = true;
+
+  if (!wasValid) {
+    ghosting = 0;
+    return HalDisplay::HALF_REFRESH;
+  }
+  if (transitions.blackToWhite * 100 > PANEL_PIXELS * FULL_REFRESH_CLEAR_PERCENT) {
+    ghosting = 0;
+    return HalDisplay::FULL_REFRESH;
+  }
+
+  ghosting += ghostingScore(transitions.blackToWhite, transitions.whiteToBlack);
+  const uint32_t budget = static_cast<uint32_t>(refreshFrequency > 1 ? refreshFrequency - 1 : 0) * TEXT_PAGE_GHOSTING;
+  if (transitions.worstRegion * 100 >= REGION_PIXELS * HEAVY_REGION_PERCENT || ghosting > budget) {
+    ghosting = 0;
+    return HalDisplay::HALF_REFRESH;
+  }
+  return HalDisplay::FAST_REFRESH;
+}
+
+void RefreshScheduler::record(const uint8_t* frameBuffer, const HalDisplay::RefreshMode mode) {
+  const Transitions transitions = update(frameBuffer);
+  if (mode != HalDisplay::FAST_REFRESH) {
+    ghosting = 0;
+  } else if (valid) {
+    ghosting += ghostingScore(transitions.blackToWhite, transitions.whiteToBlack);
+  }
+  valid = true;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <HalDisplay.h>
+
+#include <cstdint>
+
+// Picks the refresh for each reader page from how much it changes on the panel, instead of a fixed page count.
+// Fast refreshes leave ghosting that grows with the pixels they flip, black to white most of all, so the scheduler
+// accumulates a ghosting score across fast refreshes and cleans the panel once it is worth about as many typical text
+// pages as the refresh frequency setting. Pages that barely change get more fast refreshes; a transition that clears a
+// dense region (an image leaving) is cleaned right away.
+//
+// The firmware runs the display in single buffer mode, so the outgoing frame is not kept in RAM. The panel is instead
+// summarized as a grid of regions with their ink count and hash: unchanged regions are recognized exactly, and the
+// transitions within a changed region are estimated from the ink of both frames as independent coverage.
+class RefreshScheduler {
+ public:
+  // Chooses the refresh for the frame about to be displayed and records it as the panel content
+  HalDisplay::RefreshMode next(const uint8_t* frameBuffer, int refreshFrequency);
+  // Records a frame that was displayed with a refresh chosen elsewhere
+  void record(const uint8_t* frameBuffer, HalDisplay::RefreshMode mode);
+  // Forgets the panel content, so the next frame gets a HALF_REFRESH
+  void reset() { valid = false; }
+
+  uint32_t getGhosting() const { return ghosting; }
+
+  // Ghosting score of a turn between two full pages of text in the reader's default font, in pixels
+  static constexpr uint32_t TEXT_PAGE_GHOSTING = 70000;
+
+ private:
+  static constexpr int REGION_COLS = 10;
+  static constexpr int REGION_ROWS = 10;
+  static constexpr int REGION_WIDTH_BYTES = HalDisplay::DISPLAY_WIDTH_BYTES / REGION_COLS;
+  static constexpr int REGION_HEIGHT = HalDisplay::DISPLAY_HEIGHT / REGION_ROWS;
+  static constexpr uint32_t REGION_PIXELS = REGION_WIDTH_BYTES * 8 * REGION_HEIGHT;
+  static_assert(REGION_WIDTH_BYTES * REGION_COLS == HalDisplay::DISPLAY_WIDTH_BYTES &&
+                    REGION_HEIGHT * REGION_ROWS == HalDisplay::DISPLAY_HEIGHT,
+                "Regions must tile the panel");
+
+  struct Region {
+    uint16_t ink;   // Black pixels
+    uint32_t hash;  // FNV-1a of the region's bytes
+  };
+
+  struct Transitions {
+    uint32_t blackToWhite = 0;
+    uint32_t whiteToBlack = 0;
+    uint32_t worstRegion = 0;  // Highest ghosting score of a single region
+  };
+
+  Region regions[REGION_COLS * REGION_ROWS] = {};
+  bool valid = false;
+  uint32_t ghosting = 0;  // Accumulated since the last HALF_REFRESH or FULL_REFRESH
+
+  // Measures the transitions from the recorded frame to frameBuffer and records frameBuffer
+  Transitions update(const uint8_t* frameBuffer);
+};
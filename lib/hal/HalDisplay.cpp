@@ -41,6 +41,12 @@ void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen
   einkDisplay.refreshDisplay(convertRefreshMode(mode), turnOffScreen);
 }
 
+#ifdef ENABLE_WINDOWED_IMAGE_REFRESH
+void HalDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  einkDisplay.displayWindow(x, y, w, h);
+}
+#endif
+
 void HalDisplay::deepSleep() { einkDisplay.deepSleep(); }
 
 uint8_t* HalDisplay::getFrameBuffer() const { return einkDisplay.getFrameBuffer(); }
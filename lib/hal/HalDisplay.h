@@ -35,6 +35,10 @@ class HalDisplay {
 
   void displayBuffer(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
   void refreshDisplay(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false);
+#ifdef ENABLE_WINDOWED_IMAGE_REFRESH
+  // EXPERIMENTAL: Fast refresh of a panel rectangle from the frame buffer; x and w must be multiples of 8
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+#endif
 
   // Power management
   void deepSleep();
@@ -6,6 +6,12 @@ from __future__ import annotations
 import argparse
 import pathlib
 
+# Nodes with at least this many transitions get their labels sorted so the runtime can binary search them.
+SORTED_MIN_CHILDREN = 12
+# Marks a byte without a root transition or depth-1 class, and a missing depth-2 target.
+NO_SLOT = 0xFF
+NO_TARGET = 0xFFFFFFFF
+
 
 def _format_bytes(blob: bytes, per_line: int = 16) -> str:
     # Render the blob as a comma separated list of hex literals with consistent wrapping.
@@ -18,6 +24,138 @@ def _format_bytes(blob: bytes, per_line: int = 16) -> str:
     return '\n'.join(lines)
 
 
+def _format_words(values: list[int], per_line: int = 8) -> str:
+    # Same as _format_bytes for uint32_t tables.
+    lines = []
+    for i in range(0, len(values), per_line):
+        chunk = ', '.join(f"0x{v:08X}u" for v in values[i : i + per_line])
+        lines.append(f"    {chunk},")
+    return '\n'.join(lines)
+
+
+def _decode_node(nodes: bytes | bytearray, addr: int) -> tuple[int, int, int, list[int]]:
+    # Parse the node at addr (see docs/hyphenation-trie-format.md) into the position of its labels, its transition
+    # count, its target stride and the absolute addresses of its children.
+    header = nodes[addr]
+    pos = addr + 1
+    stride = (header >> 5) & 0x03 or 1
+    count = header & 0x1F
+    if count == 31:
+        count = nodes[pos]
+        pos += 1
+    if header & 0x80:
+        pos += 2
+    labels_pos = pos
+    targets_pos = pos + count
+    children = []
+    for i in range(count):
+        raw = nodes[targets_pos + i * stride : targets_pos + (i + 1) * stride]
+        if stride == 3:
+            delta = int.from_bytes(raw, 'big') - (1 << 23)
+        else:
+            delta = int.from_bytes(raw, 'big', signed=True)
+        children.append(addr + delta)
+    return labels_pos, count, stride, children
+
+
+def _walk_nodes(nodes: bytes | bytearray, root: int) -> list[int]:
+    # Addresses of every node reachable from the root.
+    seen = set()
+    stack = [root]
+    while stack:
+        addr = stack.pop()
+        if addr in seen:
+            continue
+        if not 0 <= addr < len(nodes):
+            raise ValueError(f"Node address {addr} outside the trie")
+        seen.add(addr)
+        stack.extend(_decode_node(nodes, addr)[3])
+    return sorted(seen)
+
+
+def _sort_wide_nodes(nodes: bytearray, root: int) -> None:
+    # Reorder the transitions of wide nodes by label. Targets are relative to their own node, so each (label, target)
+    # pair moves as a unit and the node keeps its size.
+    for addr in _walk_nodes(nodes, root):
+        labels_pos, count, stride, _ = _decode_node(nodes, addr)
+        if count < SORTED_MIN_CHILDREN:
+            continue
+        targets_pos = labels_pos + count
+        pairs = sorted((nodes[labels_pos + i], bytes(nodes[targets_pos + i * stride : targets_pos + (i + 1) * stride]))
+                       for i in range(count))
+        for i, (label, target) in enumerate(pairs):
+            nodes[labels_pos + i] = label
+            nodes[targets_pos + i * stride : targets_pos + (i + 1) * stride] = target
+
+
+def _transitions(nodes: bytes | bytearray, addr: int) -> dict[int, int]:
+    labels_pos, count, _, children = _decode_node(nodes, addr)
+    return {nodes[labels_pos + i]: children[i] for i in range(count)}
+
+
+def _build_acceleration(nodes: bytes | bytearray, root: int) -> tuple[list[int], list[int], list[int], list[int], int]:
+    # Dense tables for the two levels every starting position walks through:
+    #   root_slots[byte]    -> slot of the root's child for the first byte
+    #   depth1_targets      -> node address per slot
+    #   byte_classes[byte]  -> column of a second byte, numbering every label used by a depth-1 node
+    #   depth2_targets      -> node address per slot and column, NO_TARGET when the pair has no transition
+    root_children = sorted(_transitions(nodes, root).items())
+    if len(root_children) >= NO_SLOT:
+        raise ValueError(f"Root has {len(root_children)} transitions, too many for byte slots")
+    root_slots = [NO_SLOT] * 256
+    depth1_targets = []
+    depth1_transitions = []
+    for slot, (label, child) in enumerate(root_children):
+        root_slots[label] = slot
+        depth1_targets.append(child)
+        depth1_transitions.append(_transitions(nodes, child))
+
+    second_bytes = sorted({label for transitions in depth1_transitions for label in transitions})
+    if len(second_bytes) >= NO_SLOT:
+        raise ValueError(f"Depth-1 nodes use {len(second_bytes)} labels, too many for byte classes")
+    byte_classes = [NO_SLOT] * 256
+    for column, label in enumerate(second_bytes):
+        byte_classes[label] = column
+
+    depth2_targets = []
+    for transitions in depth1_transitions:
+        depth2_targets.extend(transitions.get(label, NO_TARGET) for label in second_bytes)
+    return root_slots, byte_classes, depth1_targets, depth2_targets, len(second_bytes)
+
+
+def _acceleration_block(symbol: str, nodes: bytes | bytearray, root: int) -> str:
+    # Emit the acceleration tables and their SerializedTrieAcceleration descriptor.
+    root_slots, byte_classes, depth1_targets, depth2_targets, class_count = _build_acceleration(nodes, root)
+    return f"""
+// Dense lookup tables for the root and depth-1 transitions; nodes with at least
+// {SORTED_MIN_CHILDREN} transitions have their labels sorted.
+constexpr uint8_t {symbol}_root_slots[256] = {{
+{_format_bytes(bytes(root_slots))}
+}};
+
+constexpr uint8_t {symbol}_byte_classes[256] = {{
+{_format_bytes(bytes(byte_classes))}
+}};
+
+constexpr uint32_t {symbol}_depth1_targets[] = {{
+{_format_words(depth1_targets)}
+}};
+
+constexpr uint32_t {symbol}_depth2_targets[] = {{
+{_format_words(depth2_targets)}
+}};
+
+constexpr SerializedTrieAcceleration {symbol}_acceleration = {{
+    {symbol}_root_slots,
+    {symbol}_byte_classes,
+    {symbol}_depth1_targets,
+    {symbol}_depth2_targets,
+    {class_count}u,
+    {SORTED_MIN_CHILDREN}u,
+}};
+"""
+
+
 def _symbol_from_output(path: pathlib.Path) -> str:
     # Derive a stable C identifier from the destination header name (e.g., hyph-en.trie.h -> en).
     name = path.name
@@ -31,7 +169,7 @@ def _symbol_from_output(path: pathlib.Path) -> str:
     return name
 
 
-def write_header(path: pathlib.Path, blob: bytes, symbol: str) -> None:
+def write_header(path: pathlib.Path, blob: bytes, symbol: str, accelerate: bool) -> None:
     # Emit a constexpr header containing the raw bytes plus a SerializedHyphenationPatterns descriptor.
     # The binary format has:
     #   - 4 bytes: big-endian root address
@@ -48,8 +186,13 @@ def write_header(path: pathlib.Path, blob: bytes, symbol: str) -> None:
         raise ValueError(f"Root address {root_addr} exceeds blob size {len(blob)}")
     
     # Remove the 4-byte root address and adjust the offset
-    bytes_literal = _format_bytes(blob[4:])
+    nodes = bytearray(blob[4:])
     root_addr_new = root_addr - 4
+    acceleration = ''
+    if accelerate:
+        _sort_wide_nodes(nodes, root_addr_new)
+        acceleration = _acceleration_block(symbol, nodes, root_addr_new)
+    bytes_literal = _format_bytes(nodes)
 
     path.parent.mkdir(parents=True, exist_ok=True)
     data_symbol = f"{symbol}_trie_data"
@@ -66,11 +209,11 @@ def write_header(path: pathlib.Path, blob: bytes, symbol: str) -> None:
 alignas(4) constexpr uint8_t {data_symbol}[] = {{
 {bytes_literal}
 }};
-
+{acceleration}
 constexpr SerializedHyphenationPatterns {patterns_symbol} = {{
     {f"0x{root_addr_new:02X}"}u,
     {data_symbol},
-    sizeof({data_symbol}),
+    sizeof({data_symbol}),{f"{chr(10)}    &{symbol}_acceleration," if accelerate else ""}
 }};
 """
     path.write_text(content)
@@ -82,6 +225,8 @@ def main() -> None:
                         help='Path to a hypher-generated .bin trie')
     parser.add_argument('--output', dest='outputs', action='append', required=True,
                         help='Destination header path (hyph-*.trie.h)')
+    parser.add_argument('--no-acceleration', dest='accelerate', action='store_false',
+                        help='Embed the trie as hypher wrote it, without sorted wide nodes or lookup tables')
     args = parser.parse_args()
 
     if len(args.inputs) != len(args.outputs):
@@ -93,7 +238,7 @@ def main() -> None:
         blob = src_path.read_bytes()
         out_path = pathlib.Path(dst)
         symbol = _symbol_from_output(out_path)
-        write_header(out_path, blob, symbol)
+        write_header(out_path, blob, symbol, args.accelerate)
         print(f'wrote {dst} ({len(blob)} bytes payload)')
 
 
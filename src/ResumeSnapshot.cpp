@@ -0,0 +1,118 @@
+#include "ResumeSnapshot.h"
+
+#include <GfxRenderer.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include "CrossPointSettings.h"
+
+namespace {
+constexpr uint8_t SNAPSHOT_FILE_VERSION = 1;
+constexpr char SNAPSHOT_FILE[] = "/.crosspoint/resume.fb";
+constexpr uint32_t MAX_PATH_LENGTH = 1024;
+
+// FNV-1a
+uint32_t hashBytes(const uint8_t* data, const size_t size, uint32_t hash = 2166136261u) {
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// Reader settings that change how a page is laid out or drawn. A snapshot saved under other settings would show a
+// page the reader is about to replace.
+uint32_t getLayoutHash() {
+  const int layout[] = {SETTINGS.getReaderFontId(), SETTINGS.lineSpacing, SETTINGS.extraParagraphSpacing,
+                        SETTINGS.paragraphAlignment, SETTINGS.screenMargin, SETTINGS.orientation,
+                        SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle, SETTINGS.statusBar,
+                        SETTINGS.textAntiAliasing};
+  return hashBytes(reinterpret_cast<const uint8_t*>(layout), sizeof(layout));
+}
+}  // namespace
+
+ResumeSnapshot ResumeSnapshot::instance;
+
+bool ResumeSnapshot::save(const GfxRenderer& renderer, const std::string& path, const uint16_t spine,
+                          const uint16_t pageNumber) const {
+  FsFile file;
+  if (!Storage.openFileForWrite("RSS", SNAPSHOT_FILE, file)) {
+    return false;
+  }
+
+  const uint8_t* frameBuffer = renderer.getFrameBuffer();
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  serialization::writePod(file, SNAPSHOT_FILE_VERSION);
+  serialization::writeString(file, path);
+  serialization::writePod(file, spine);
+  serialization::writePod(file, pageNumber);
+  serialization::writePod(file, getLayoutHash());
+  serialization::writePod(file, hashBytes(frameBuffer, bufferSize));
+  const bool written = file.write(frameBuffer, bufferSize) == bufferSize;
+  file.close();
+
+  if (!written) {
+    LOG_ERR("RSS", "Failed to save resume snapshot");
+    Storage.remove(SNAPSHOT_FILE);
+    return false;
+  }
+  LOG_DBG("RSS", "Saved resume snapshot: spine %u, page %u", spine, pageNumber);
+  return true;
+}
+
+bool ResumeSnapshot::display(GfxRenderer& renderer, const std::string& path) {
+  pending = false;
+  FsFile file;
+  if (!Storage.exists(SNAPSHOT_FILE) || !Storage.openFileForRead("RSS", SNAPSHOT_FILE, file)) {
+    return false;
+  }
+
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  uint8_t version = 0;
+  uint32_t pathLength = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, pathLength);
+  bool valid = version == SNAPSHOT_FILE_VERSION && pathLength <= MAX_PATH_LENGTH &&
+               file.size() == sizeof(version) + sizeof(pathLength) + pathLength + sizeof(spineIndex) + sizeof(page) +
+                                  2 * sizeof(uint32_t) + bufferSize;
+  if (valid) {
+    uint32_t layoutHash = 0;
+    bookPath.resize(pathLength);
+    file.read(reinterpret_cast<uint8_t*>(&bookPath[0]), pathLength);
+    serialization::readPod(file, spineIndex);
+    serialization::readPod(file, page);
+    serialization::readPod(file, layoutHash);
+    serialization::readPod(file, frameHash);
+    valid = bookPath == path && layoutHash == getLayoutHash() &&
+            file.read(renderer.getFrameBuffer(), bufferSize) == static_cast<int>(bufferSize);
+  }
+  file.close();
+
+  // A snapshot is only good for the wake right after the sleep that saved it
+  Storage.remove(SNAPSHOT_FILE);
+  if (!valid) {
+    LOG_DBG("RSS", "Resume snapshot does not match %s", path.c_str());
+    return false;
+  }
+
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+  pending = true;
+  LOG_DBG("RSS", "Displayed resume snapshot: spine %u, page %u", spineIndex, page);
+  return true;
+}
+
+bool ResumeSnapshot::consume(const GfxRenderer& renderer, const std::string& path, const uint16_t spine,
+                             const uint16_t pageNumber) {
+  if (!pending) {
+    return false;
+  }
+  pending = false;
+  return path == bookPath && spine == spineIndex && pageNumber == page &&
+         hashBytes(renderer.getFrameBuffer(), GfxRenderer::getBufferSize()) == frameHash;
+}
+
+void ResumeSnapshot::remove() const {
+  if (Storage.exists(SNAPSHOT_FILE)) {
+    Storage.remove(SNAPSHOT_FILE);
+  }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+class GfxRenderer;
+
+// The reader page on screen when the device went to sleep, kept on the SD card with a token describing it. On wake the
+// page goes to the panel before the book is loaded; the reader then checks its first render against the token and
+// skips the refresh when the panel already shows that exact frame.
+class ResumeSnapshot {
+  // Static instance
+  static ResumeSnapshot instance;
+
+  // Token of the snapshot shown on wake, until the reader's first page render consumes it
+  bool pending = false;
+  std::string bookPath;
+  uint16_t spineIndex = 0;
+  uint16_t page = 0;
+  uint32_t frameHash = 0;
+
+ public:
+  ~ResumeSnapshot() = default;
+
+  // Get singleton instance
+  static ResumeSnapshot& getInstance() { return instance; }
+
+  // Saves the frame buffer, which must hold the displayed BW page
+  bool save(const GfxRenderer& renderer, const std::string& path, uint16_t spine, uint16_t pageNumber) const;
+  // Shows the snapshot of path if one was saved under the current reader settings. The file is consumed either way.
+  bool display(GfxRenderer& renderer, const std::string& path);
+  // Whether the panel already shows this page as rendered into the frame buffer. Consumes the pending token.
+  bool consume(const GfxRenderer& renderer, const std::string& path, uint16_t spine, uint16_t pageNumber);
+  bool isPending() const { return pending; }
+  void remove() const;
+};
+
+// Helper macro to access the resume snapshot
+#define RESUME_SNAPSHOT ResumeSnapshot::getInstance()
@@ -39,6 +39,8 @@ class Activity {
   virtual void onEnter();
   virtual void onExit();
   virtual void loop() {}
+  // Called before the activity is exited for deep sleep, while its content is still on the panel
+  virtual void onSleep() {}
 
   virtual void render(RenderLock&&) {}
   virtual void requestUpdate();
@@ -51,3 +51,9 @@ void ActivityWithSubactivity::onExit() {
   exitActivity();
   Activity::onExit();
 }
+
+void ActivityWithSubactivity::onSleep() {
+  if (subActivity) {
+    subActivity->onSleep();
+  }
+}
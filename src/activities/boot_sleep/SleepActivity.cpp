@@ -8,12 +8,37 @@
 #include <Txt.h>
 #include <Xtc.h>
 
+#include <cstring>
+
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 #include "util/StringUtils.h"
 
+namespace {
+// A cover sleep screen is cached as the finished panel planes: the BW frame buffer, followed by the grayscale LSB and
+// MSB planes when the cover has gray levels. Showing it again is then one sequential read into the frame buffer.
+struct SleepFramebufferHeader {
+  char magic[4];   // "SLFB"
+  uint8_t version;
+  uint8_t planes;  // 1 (BW) or 3 (BW, LSB, MSB)
+  uint16_t reserved;
+  // SleepSourceStamp of the book or cover image the planes were drawn from
+  uint32_t sourceSize;
+  uint16_t sourceModifyDate;
+  uint16_t sourceModifyTime;
+};
+constexpr uint8_t SLEEP_FRAMEBUFFER_VERSION = 2;
+
+// One file per cover mode, filter and orientation, kept in the book's cache directory next to the cover BMP it was
+// made from, so clearing the book cache drops it too
+std::string getSleepFramebufferPath(const std::string& bookCachePath, const GfxRenderer& renderer) {
+  return bookCachePath + "/sleep_" + std::to_string(SETTINGS.sleepScreenCoverMode) + "_" +
+         std::to_string(SETTINGS.sleepScreenCoverFilter) + "_" + std::to_string(renderer.getOrientation()) + ".fb";
+}
+}  // namespace
+
 void SleepActivity::onEnter() {
   Activity::onEnter();
   GUI.drawPopup(renderer, "Goodbye, my king [T]7");
@@ -142,7 +167,19 @@ void SleepActivity::renderDefaultSleepScreen() const {
   renderer.displayBuffer(HalDisplay::HALF_REFRESH);
 }
 
-void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap) const {
+SleepSourceStamp SleepActivity::getSourceStamp(const std::string& path) {
+  SleepSourceStamp stamp;
+  FsFile file;
+  if (!path.empty() && Storage.openFileForRead("SLP", path, file)) {
+    stamp.size = file.size();
+    file.getModifyDateTime(&stamp.modifyDate, &stamp.modifyTime);
+    file.close();
+  }
+  return stamp;
+}
+
+void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap, const std::string& framebufferPath,
+                                            const SleepSourceStamp& source) const {
   int x, y;
   const auto pageWidth = renderer.getScreenWidth();
   const auto pageHeight = renderer.getScreenHeight();
@@ -194,6 +231,25 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap) const {
     renderer.invertScreen();
   }
 
+  // Each plane is saved as soon as it is complete
+  FsFile framebufferFile;
+  bool caching = !framebufferPath.empty() && Storage.openFileForWrite("SLP", framebufferPath, framebufferFile);
+  const auto savePlane = [&] {
+    const size_t planeSize = GfxRenderer::getBufferSize();
+    caching = caching && framebufferFile.write(renderer.getFrameBuffer(), planeSize) == planeSize;
+  };
+  if (caching) {
+    const SleepFramebufferHeader header = {{'S', 'L', 'F', 'B'},
+                                           SLEEP_FRAMEBUFFER_VERSION,
+                                           static_cast<uint8_t>(hasGreyscale ? 3 : 1),
+                                           0,
+                                           source.size,
+                                           source.modifyDate,
+                                           source.modifyTime};
+    caching = framebufferFile.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+    savePlane();
+  }
+
   renderer.displayBuffer(HalDisplay::HALF_REFRESH);
 
   if (hasGreyscale) {
@@ -201,17 +257,80 @@ void SleepActivity::renderBitmapSleepScreen(const Bitmap& bitmap) const {
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
     renderer.drawBitmap(bitmap, x, y, pageWidth, pageHeight, cropX, cropY);
+    savePlane();
     renderer.copyGrayscaleLsbBuffers();
 
     bitmap.rewindToData();
     renderer.clearScreen(0x00);
     renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
     renderer.drawBitmap(bitmap, x, y, pageWidth, pageHeight, cropX, cropY);
+    savePlane();
     renderer.copyGrayscaleMsbBuffers();
 
     renderer.displayGrayBuffer();
     renderer.setRenderMode(GfxRenderer::BW);
   }
+
+  if (framebufferFile) {
+    framebufferFile.close();
+    if (caching) {
+      LOG_DBG("SLP", "Saved sleep screen planes: %s", framebufferPath.c_str());
+    } else {
+      LOG_ERR("SLP", "Failed to save sleep screen planes: %s", framebufferPath.c_str());
+      Storage.remove(framebufferPath.c_str());
+    }
+  }
+}
+
+bool SleepActivity::renderSleepFramebuffer(const std::string& path, const SleepSourceStamp& source,
+                                           bool& sourceChanged) const {
+  sourceChanged = false;
+  FsFile file;
+  if (!Storage.exists(path.c_str()) || !Storage.openFileForRead("SLP", path, file)) {
+    return false;
+  }
+
+  const size_t planeSize = GfxRenderer::getBufferSize();
+  SleepFramebufferHeader header;
+  if (file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != static_cast<int>(sizeof(header)) ||
+      memcmp(header.magic, "SLFB", 4) != 0 || header.version != SLEEP_FRAMEBUFFER_VERSION ||
+      (header.planes != 1 && header.planes != 3) || file.size() != sizeof(header) + header.planes * planeSize ||
+      file.read(renderer.getFrameBuffer(), planeSize) != static_cast<int>(planeSize)) {
+    LOG_ERR("SLP", "Discarding invalid sleep screen planes: %s", path.c_str());
+    file.close();
+    Storage.remove(path.c_str());
+    return false;
+  }
+  if (header.sourceSize != source.size || header.sourceModifyDate != source.modifyDate ||
+      header.sourceModifyTime != source.modifyTime) {
+    LOG_DBG("SLP", "Cover source changed, discarding sleep screen planes: %s", path.c_str());
+    file.close();
+    Storage.remove(path.c_str());
+    sourceChanged = true;
+    return false;
+  }
+
+  LOG_DBG("SLP", "Rendering cached sleep screen: %s", path.c_str());
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+
+  if (header.planes == 3) {
+    // The grayscale planes go through the frame buffer, like the passes that produced them
+    if (file.read(renderer.getFrameBuffer(), planeSize) != static_cast<int>(planeSize)) {
+      LOG_ERR("SLP", "Failed to read cached LSB plane");
+      file.close();
+      return true;
+    }
+    renderer.copyGrayscaleLsbBuffers();
+    if (file.read(renderer.getFrameBuffer(), planeSize) != static_cast<int>(planeSize)) {
+      LOG_ERR("SLP", "Failed to read cached MSB plane");
+      file.close();
+      return true;
+    }
+    renderer.copyGrayscaleMsbBuffers();
+    renderer.displayGrayBuffer();
+  }
+  file.close();
+  return true;
 }
 
 void SleepActivity::renderCoverSleepScreen() const {
@@ -230,6 +349,9 @@ void SleepActivity::renderCoverSleepScreen() const {
   }
 
   std::string coverBmpPath;
+  std::string framebufferPath;
+  SleepSourceStamp source;
+  bool sourceChanged = false;
   bool cropped = SETTINGS.sleepScreenCoverMode == CrossPointSettings::SLEEP_SCREEN_COVER_MODE::CROP;
 
   // Check if the current book is XTC, TXT, or EPUB
@@ -237,6 +359,14 @@ void SleepActivity::renderCoverSleepScreen() const {
       StringUtils::checkFileExtension(APP_STATE.openEpubPath, ".xtch")) {
     // Handle XTC file
     Xtc lastXtc(APP_STATE.openEpubPath, "/.crosspoint");
+    framebufferPath = getSleepFramebufferPath(lastXtc.getCachePath(), renderer);
+    source = getSourceStamp(APP_STATE.openEpubPath);
+    if (renderSleepFramebuffer(framebufferPath, source, sourceChanged)) {
+      return;
+    }
+    if (sourceChanged) {
+      Storage.remove(lastXtc.getCoverBmpPath().c_str());
+    }
     if (!lastXtc.load()) {
       LOG_ERR("SLP", "Failed to load last XTC");
       return (this->*renderNoCoverSleepScreen)();
@@ -251,6 +381,14 @@ void SleepActivity::renderCoverSleepScreen() const {
   } else if (StringUtils::checkFileExtension(APP_STATE.openEpubPath, ".txt")) {
     // Handle TXT file - looks for cover image in the same folder
     Txt lastTxt(APP_STATE.openEpubPath, "/.crosspoint");
+    framebufferPath = getSleepFramebufferPath(lastTxt.getCachePath(), renderer);
+    source = getSourceStamp(lastTxt.findCoverImage());
+    if (renderSleepFramebuffer(framebufferPath, source, sourceChanged)) {
+      return;
+    }
+    if (sourceChanged) {
+      Storage.remove(lastTxt.getCoverBmpPath().c_str());
+    }
     if (!lastTxt.load()) {
       LOG_ERR("SLP", "Failed to load last TXT");
       return (this->*renderNoCoverSleepScreen)();
@@ -265,6 +403,15 @@ void SleepActivity::renderCoverSleepScreen() const {
   } else if (StringUtils::checkFileExtension(APP_STATE.openEpubPath, ".epub")) {
     // Handle EPUB file
     Epub lastEpub(APP_STATE.openEpubPath, "/.crosspoint");
+    framebufferPath = getSleepFramebufferPath(lastEpub.getCachePath(), renderer);
+    source = getSourceStamp(APP_STATE.openEpubPath);
+    if (renderSleepFramebuffer(framebufferPath, source, sourceChanged)) {
+      return;
+    }
+    if (sourceChanged) {
+      // The cover BMP was converted from the old version of the book
+      Storage.remove(lastEpub.getCoverBmpPath(cropped).c_str());
+    }
     // Skip loading css since we only need metadata here
     if (!lastEpub.load(true, true)) {
       LOG_ERR("SLP", "Failed to load last epub");
@@ -286,7 +433,7 @@ void SleepActivity::renderCoverSleepScreen() const {
     Bitmap bitmap(file);
     if (bitmap.parseHeaders() == BmpReaderError::Ok) {
       LOG_DBG("SLP", "Rendering sleep cover: %s", coverBmpPath.c_str());
-      renderBitmapSleepScreen(bitmap);
+      renderBitmapSleepScreen(bitmap, framebufferPath, source);
       return;
     }
   }
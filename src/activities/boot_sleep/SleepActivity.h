@@ -1,8 +1,18 @@
 #pragma once
+#include <cstdint>
+#include <string>
+
 #include "../Activity.h"
 
 class Bitmap;
 
+// Identifies the file a cover sleep screen is drawn from: the book for EPUB and XTC, the cover image for TXT
+struct SleepSourceStamp {
+  uint32_t size = 0;
+  uint16_t modifyDate = 0;
+  uint16_t modifyTime = 0;
+};
+
 class SleepActivity final : public Activity {
  public:
   explicit SleepActivity(GfxRenderer& renderer, MappedInputManager& mappedInput)
@@ -13,6 +23,12 @@ class SleepActivity final : public Activity {
   void renderDefaultSleepScreen() const;
   void renderCustomSleepScreen() const;
   void renderCoverSleepScreen() const;
-  void renderBitmapSleepScreen(const Bitmap& bitmap) const;
+  static SleepSourceStamp getSourceStamp(const std::string& path);
+
+  // framebufferPath: where to save the finished panel planes for renderSleepFramebuffer, or empty to not save them
+  void renderBitmapSleepScreen(const Bitmap& bitmap, const std::string& framebufferPath = "",
+                               const SleepSourceStamp& source = {}) const;
+  // sourceChanged: set when cached planes exist but were made from a different version of the source
+  bool renderSleepFramebuffer(const std::string& path, const SleepSourceStamp& source, bool& sourceChanged) const;
   void renderBlankSleepScreen() const;
 };
@@ -5,6 +5,8 @@
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <I18n.h>
+#include <Logging.h>
+#include <Serialization.h>
 #include <Utf8.h>
 #include <Xtc.h>
 
@@ -21,6 +23,49 @@
 #include "fontIds.h"
 #include "util/StringUtils.h"
 
+namespace {
+constexpr int MENU_BAR_H = 26;
+constexpr int TITLE_BAR_H = 24;
+constexpr int INFO_BAR_H = 24;
+constexpr int GRID_COLS = 3;
+constexpr int CELL_H = 120;
+constexpr int CELL_CONTENT_H = 84;  // Icon, cover frame and label highlight of a cell
+constexpr int COVER_THUMB_H = 44;
+
+constexpr int ICON_FOLDER = 0;
+constexpr int ICON_COVER = 1;
+constexpr int ICON_HARDDRIVE = 2;
+constexpr int ICON_SETTINGS = 3;
+constexpr int ICON_TRANSFER = 4;
+
+// The composed finder window is kept on the SD card so boot and return-to-home paint it without drawing any cover or
+// glyph. Bump the version whenever the home screen layout changes.
+constexpr char SNAPSHOT_FILE[] = "/.crosspoint/home.fb";
+constexpr uint8_t SNAPSHOT_VERSION = 1;
+
+struct FinderLayout {
+  int winX, winY, winW, winH;
+  int tbY, tbInnerX2;
+  int infoY;
+  int contentX, cellW, gridStartY;
+};
+
+FinderLayout getFinderLayout(const GfxRenderer& renderer) {
+  FinderLayout layout;
+  layout.winX = 14;
+  layout.winY = 38;
+  layout.winW = renderer.getScreenWidth() - 28;
+  layout.winH = renderer.getScreenHeight() - 98;
+  layout.tbY = layout.winY + 2;
+  layout.tbInnerX2 = layout.winX + layout.winW - 3;
+  layout.infoY = layout.tbY + TITLE_BAR_H;
+  layout.contentX = layout.winX + 2;
+  layout.cellW = (layout.winW - 4) / GRID_COLS;
+  layout.gridStartY = layout.infoY + INFO_BAR_H + 1 + 20;
+  return layout;
+}
+}  // namespace
+
 int HomeActivity::getMenuItemCount() const {
   int count = 4;  // My Library, Recents, File transfer, Settings
   if (!recentBooks.empty()) {
@@ -80,6 +125,7 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
             book.coverBmpPath = "";
           }
           coverRendered = false;
+          coversRegenerated = true;
           requestUpdate();
         } else if (StringUtils::checkFileExtension(book.path, ".xtch") ||
                    StringUtils::checkFileExtension(book.path, ".xtc")) {
@@ -98,6 +144,7 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
               book.coverBmpPath = "";
             }
             coverRendered = false;
+            coversRegenerated = true;
             requestUpdate();
           }
         }
@@ -122,10 +169,14 @@ void HomeActivity::onEnter() {
   loadRecentBooks(1);
 
   // Generate cover thumbnails for home screen grid
+  coversRegenerated = false;
   if (!recentBooks.empty()) {
-    loadRecentCovers(44);
+    loadRecentCovers(COVER_THUMB_H);
   }
 
+  // Paint the finder window from the SD card when nothing it shows has changed
+  loadSnapshot();
+
   // Cache SD card storage info (freeClusterCount is slow — only call once)
   cachedTotalBytes = Storage.cardSizeBytes();
   cachedFreeBytes = Storage.freeSpaceBytes();
@@ -207,6 +258,73 @@ void HomeActivity::freeCoverBuffer() {
   coverBufferStored = false;
 }
 
+std::string HomeActivity::getSnapshotKey() const {
+  std::string key = std::to_string(SETTINGS.uiTheme) + "|" + std::to_string(static_cast<int>(I18N.getLanguage())) +
+                    "|" + std::to_string(renderer.getOrientation()) + "|" + (hasOpdsUrl ? "opds" : "");
+  for (const RecentBook& book : recentBooks) {
+    key += "|" + book.path + "|" + book.title + "|" + book.coverBmpPath;
+  }
+  return key;
+}
+
+bool HomeActivity::loadSnapshot() {
+  if (coversRegenerated) {
+    return false;  // The snapshot shows the fallback icon where a cover now exists
+  }
+
+  FsFile file;
+  if (!Storage.exists(SNAPSHOT_FILE) || !Storage.openFileForRead("HOME", SNAPSHOT_FILE, file)) {
+    return false;
+  }
+
+  const std::string key = getSnapshotKey();
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  uint8_t version = 0;
+  uint32_t keyLength = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, keyLength);
+  if (version != SNAPSHOT_VERSION || keyLength != key.size() ||
+      file.size() != sizeof(version) + sizeof(keyLength) + keyLength + bufferSize) {
+    file.close();
+    return false;
+  }
+  std::string storedKey;
+  storedKey.resize(keyLength);
+  if (file.read(reinterpret_cast<uint8_t*>(&storedKey[0]), keyLength) != static_cast<int>(keyLength) ||
+      storedKey != key) {
+    file.close();
+    return false;
+  }
+
+  freeCoverBuffer();
+  coverBuffer = static_cast<uint8_t*>(malloc(bufferSize));
+  if (!coverBuffer || file.read(coverBuffer, bufferSize) != static_cast<int>(bufferSize)) {
+    file.close();
+    freeCoverBuffer();
+    return false;
+  }
+  file.close();
+  coverBufferStored = true;
+  LOG_DBG("HOME", "Restored home screen snapshot");
+  return true;
+}
+
+void HomeActivity::saveSnapshot() const {
+  FsFile file;
+  if (!Storage.openFileForWrite("HOME", SNAPSHOT_FILE, file)) {
+    return;
+  }
+  const size_t bufferSize = GfxRenderer::getBufferSize();
+  serialization::writePod(file, SNAPSHOT_VERSION);
+  serialization::writeString(file, getSnapshotKey());
+  const bool written = file.write(coverBuffer, bufferSize) == bufferSize;
+  file.close();
+  if (!written) {
+    LOG_ERR("HOME", "Failed to save home screen snapshot");
+    Storage.remove(SNAPSHOT_FILE);
+  }
+}
+
 void HomeActivity::loop() {
   const int menuCount = getMenuItemCount();
 
@@ -346,42 +464,37 @@ void HomeActivity::drawMacHardDriveIcon(int cx, int cy, bool selected) const {
   renderer.fillRect(x + 34, y + 19, 4, 3, !inv);
 }
 
-void HomeActivity::render(Activity::RenderLock&&) {
-  const int W = renderer.getScreenWidth();
-  const int H = renderer.getScreenHeight();
-
-  renderer.clearScreen();
-
-  // ==================== MENU BAR ====================
-  constexpr int menuBarH = 26;
-  renderer.drawLine(0, menuBarH, W - 1, menuBarH);
-
-  // Reading progress on the left
-  if (bookProgressPercent >= 0) {
-    char progressText[24];
-    snprintf(progressText, sizeof(progressText), "Reading: %d%%", bookProgressPercent);
-    renderer.drawText(UI_10_FONT_ID, 12, 6, progressText, true);
+void HomeActivity::getGridItems(std::vector<std::string>& labels, std::vector<int>& icons) const {
+  // Same order as loop(): recent books first, then menu items
+  for (const auto& book : recentBooks) {
+    labels.push_back(book.title.empty() ? "Currently Reading" : book.title);
+    icons.push_back(ICON_COVER);
   }
 
-  // Battery in menu bar (right side)
-  const uint16_t battPct = battery.readPercentage();
-  char battText[8];
-  snprintf(battText, sizeof(battText), "%d%%", battPct);
-  int battTextW = renderer.getTextWidth(UI_10_FONT_ID, battText);
-  const int biX = W - battTextW - 34;
-  const int biY = 12;
-  renderer.drawRect(biX, biY, 18, 10);
-  renderer.fillRect(biX + 18, biY + 3, 2, 4);
-  int fillW = (14 * static_cast<int>(battPct)) / 100;
-  if (fillW > 0) {
-    renderer.fillRect(biX + 2, biY + 2, fillW, 6);
+  labels.push_back(tr(STR_BROWSE_FILES));
+  icons.push_back(ICON_HARDDRIVE);
+  labels.push_back(tr(STR_MENU_RECENT_BOOKS));
+  icons.push_back(ICON_FOLDER);
+  if (hasOpdsUrl) {
+    labels.push_back(tr(STR_OPDS_BROWSER));
+    icons.push_back(ICON_FOLDER);
   }
-  renderer.drawText(UI_10_FONT_ID, W - battTextW - 10, 6, battText, true);
+  labels.push_back(tr(STR_FILE_TRANSFER));
+  icons.push_back(ICON_TRANSFER);
+  labels.push_back(tr(STR_SETTINGS_TITLE));
+  icons.push_back(ICON_SETTINGS);
+}
+
+// Everything but the status text and the selection highlight, which is what the snapshot holds
+void HomeActivity::renderFinderWindow() const {
+  const int W = renderer.getScreenWidth();
+  const FinderLayout layout = getFinderLayout(renderer);
+
+  // ==================== MENU BAR ====================
+  renderer.drawLine(0, MENU_BAR_H, W - 1, MENU_BAR_H);
 
   // ==================== FINDER WINDOW ====================
-  constexpr int winX = 14, winY = 38;
-  const int winW = W - 28;
-  const int winH = H - 98;
+  const int winX = layout.winX, winY = layout.winY, winW = layout.winW, winH = layout.winH;
 
   // Window double border
   renderer.drawRect(winX, winY, winW, winH);
@@ -392,13 +505,12 @@ void HomeActivity::render(Activity::RenderLock&&) {
   renderer.fillRect(winX + winW, winY + 3, 2, winH - 1);
 
   // ---- Title bar ----
-  constexpr int tbH = 24;
-  const int tbY = winY + 2;
+  const int tbY = layout.tbY;
   const int tbInnerX1 = winX + 2;
-  const int tbInnerX2 = winX + winW - 3;
+  const int tbInnerX2 = layout.tbInnerX2;
 
   // Title bar horizontal stripes
-  for (int y = tbY + 2; y < tbY + tbH - 1; y += 2) {
+  for (int y = tbY + 2; y < tbY + TITLE_BAR_H - 1; y += 2) {
     renderer.drawLine(tbInnerX1 + 20, y, tbInnerX2 - 18, y);
   }
 
@@ -410,12 +522,11 @@ void HomeActivity::render(Activity::RenderLock&&) {
   const char* winTitle = "Xteink HD";
   const int titleW = renderer.getTextWidth(UI_10_FONT_ID, winTitle, EpdFontFamily::BOLD);
   const int titleX = winX + (winW - titleW) / 2;
-  renderer.fillRect(titleX - 8, tbY + 1, titleW + 16, tbH - 2, false);
+  renderer.fillRect(titleX - 8, tbY + 1, titleW + 16, TITLE_BAR_H - 2, false);
   renderer.drawText(UI_10_FONT_ID, titleX, tbY + 4, winTitle, true, EpdFontFamily::BOLD);
 
   // ---- Info bar ----
-  const int infoY = tbY + tbH;
-  constexpr int infoH = 24;
+  const int infoY = layout.infoY;
   renderer.drawLine(winX + 2, infoY, tbInnerX2, infoY);
 
   const int itemCount = getMenuItemCount();
@@ -423,6 +534,117 @@ void HomeActivity::render(Activity::RenderLock&&) {
   snprintf(infoText, sizeof(infoText), "%d items", itemCount);
   renderer.drawText(SMALL_FONT_ID, winX + 12, infoY + 5, infoText);
 
+  renderer.drawLine(winX + 2, infoY + INFO_BAR_H, tbInnerX2, infoY + INFO_BAR_H);
+
+  // ==================== ICON GRID ====================
+  std::vector<std::string> gridLabels;
+  std::vector<int> gridIcons;
+  getGridItems(gridLabels, gridIcons);
+
+  const int numItems = static_cast<int>(gridLabels.size());
+  for (int i = 0; i < numItems; i++) {
+    renderGridItem(i, gridLabels[i], gridIcons[i], false);
+  }
+}
+
+void HomeActivity::renderGridItem(const int index, const std::string& label, const int icon, const bool sel) const {
+  const FinderLayout layout = getFinderLayout(renderer);
+  const int col = index % GRID_COLS;
+  const int row = index / GRID_COLS;
+  const int cellX = layout.contentX + col * layout.cellW;
+  const int cellY = layout.gridStartY + row * CELL_H;
+  const int cellCenterX = cellX + layout.cellW / 2;
+
+  // Draw icon based on type
+  if (icon == ICON_COVER && index < static_cast<int>(recentBooks.size()) &&
+      !recentBooks[index].coverBmpPath.empty()) {
+    // Try to draw book cover thumbnail
+    std::string coverPath = UITheme::getCoverThumbPath(recentBooks[index].coverBmpPath, COVER_THUMB_H);
+    FsFile coverFile;
+    bool coverDrawn = false;
+    if (Storage.openFileForRead("HOME", coverPath, coverFile)) {
+      Bitmap coverBmp(coverFile);
+      if (coverBmp.parseHeaders() == BmpReaderError::Ok) {
+        int bw = coverBmp.getWidth();
+        int bh = coverBmp.getHeight();
+        int bx = cellCenterX - bw / 2;
+        int by = cellY + 2 + (48 - bh) / 2;
+        if (sel) {
+          renderer.drawRect(bx - 3, by - 3, bw + 6, bh + 6);
+          renderer.drawRect(bx - 2, by - 2, bw + 4, bh + 4);
+        }
+        renderer.drawBitmap(coverBmp, bx, by, bw, bh, 0, 0);
+        coverDrawn = true;
+      }
+    }
+    if (!coverDrawn) {
+      if (sel) {
+        renderer.fillRect(cellCenterX - 28, cellY + 2, 56, 48);
+      }
+      drawMacDocumentIcon(cellCenterX, cellY + 24, sel);
+    }
+  } else {
+    // Standard icon with selection highlight
+    if (sel) {
+      renderer.fillRect(cellCenterX - 28, cellY + 2, 56, 48);
+    }
+    switch (icon) {
+      case ICON_HARDDRIVE:
+        drawMacHardDriveIcon(cellCenterX, cellY + 24, sel);
+        break;
+      case ICON_SETTINGS:
+        drawMacSettingsIcon(cellCenterX, cellY + 24, sel);
+        break;
+      case ICON_TRANSFER:
+        drawMacTransferIcon(cellCenterX, cellY + 24, sel);
+        break;
+      default:
+        drawMacFolderIcon(cellCenterX, cellY + 24, sel);
+        break;
+    }
+  }
+
+  // Label
+  const std::string truncLabel = renderer.truncatedText(UI_10_FONT_ID, label.c_str(), layout.cellW - 10);
+  const int labelW = renderer.getTextWidth(UI_10_FONT_ID, truncLabel.c_str());
+  const int labelX = cellCenterX - labelW / 2;
+  const int labelY = cellY + 56;
+
+  if (sel) {
+    renderer.fillRect(labelX - 4, labelY - 3, labelW + 8, 28);
+    renderer.drawText(UI_10_FONT_ID, labelX, labelY, truncLabel.c_str(), false);
+  } else {
+    renderer.drawText(UI_10_FONT_ID, labelX, labelY, truncLabel.c_str(), true);
+  }
+}
+
+// Reading progress, battery and storage change between visits, so they are drawn over the snapshot every time
+void HomeActivity::renderStatus() const {
+  const int W = renderer.getScreenWidth();
+  const FinderLayout layout = getFinderLayout(renderer);
+
+  // Reading progress on the left
+  if (bookProgressPercent >= 0) {
+    char progressText[24];
+    snprintf(progressText, sizeof(progressText), "Reading: %d%%", bookProgressPercent);
+    renderer.drawText(UI_10_FONT_ID, 12, 6, progressText, true);
+  }
+
+  // Battery in menu bar (right side)
+  const uint16_t battPct = battery.readPercentage();
+  char battText[8];
+  snprintf(battText, sizeof(battText), "%d%%", battPct);
+  int battTextW = renderer.getTextWidth(UI_10_FONT_ID, battText);
+  const int biX = W - battTextW - 34;
+  const int biY = 12;
+  renderer.drawRect(biX, biY, 18, 10);
+  renderer.fillRect(biX + 18, biY + 3, 2, 4);
+  int fillW = (14 * static_cast<int>(battPct)) / 100;
+  if (fillW > 0) {
+    renderer.fillRect(biX + 2, biY + 2, fillW, 6);
+  }
+  renderer.drawText(UI_10_FONT_ID, W - battTextW - 10, 6, battText, true);
+
   // Storage: three-column layout like classic Mac Finder
   // "X items" (left)    "X.X GB in disk" (center)    "XX.X GB available" (right)
   uint64_t usedBytes = cachedTotalBytes - cachedFreeBytes;
@@ -431,128 +653,39 @@ void HomeActivity::render(Activity::RenderLock&&) {
   snprintf(usedText, sizeof(usedText), "%.1f GB in disk",
            static_cast<double>(usedBytes) / (1024.0 * 1024.0 * 1024.0));
   int usedTextW = renderer.getTextWidth(SMALL_FONT_ID, usedText);
-  int infoBarCenter = winX + winW / 2;
-  renderer.drawText(SMALL_FONT_ID, infoBarCenter - usedTextW / 2, infoY + 5, usedText);
+  int infoBarCenter = layout.winX + layout.winW / 2;
+  renderer.drawText(SMALL_FONT_ID, infoBarCenter - usedTextW / 2, layout.infoY + 5, usedText);
 
   char freeText[32];
   snprintf(freeText, sizeof(freeText), "%.1f GB available",
            static_cast<double>(cachedFreeBytes) / (1024.0 * 1024.0 * 1024.0));
   int freeTextW = renderer.getTextWidth(SMALL_FONT_ID, freeText);
-  renderer.drawText(SMALL_FONT_ID, tbInnerX2 - freeTextW - 8, infoY + 5, freeText);
+  renderer.drawText(SMALL_FONT_ID, layout.tbInnerX2 - freeTextW - 8, layout.infoY + 5, freeText);
+}
 
-  renderer.drawLine(winX + 2, infoY + infoH, tbInnerX2, infoY + infoH);
+void HomeActivity::render(Activity::RenderLock&&) {
+  // The finder window only changes with the snapshot key, so it is composed once and restored from then on
+  if (!restoreCoverBuffer()) {
+    renderer.clearScreen();
+    renderFinderWindow();
+    coverBufferStored = storeCoverBuffer();
+    if (coverBufferStored) {
+      saveSnapshot();
+    }
+  }
 
-  // ==================== ICON GRID ====================
-  const int contentY = infoY + infoH + 1;
-  const int contentW = winW - 4;
-  const int contentX = winX + 2;
-
-  // Build items list matching loop() order: recent books first, then menu items
-  constexpr int ICON_FOLDER = 0;
-  constexpr int ICON_COVER = 1;
-  constexpr int ICON_HARDDRIVE = 2;
-  constexpr int ICON_SETTINGS = 3;
-  constexpr int ICON_TRANSFER = 4;
-  constexpr int coverThumbH = 44;
+  renderStatus();
 
+  // Redraw the selected item highlighted over its unselected look from the snapshot
   std::vector<std::string> gridLabels;
   std::vector<int> gridIcons;
-
-  // Recent books (cover or document fallback)
-  for (const auto& book : recentBooks) {
-    gridLabels.push_back(book.title.empty() ? "Currently Reading" : book.title);
-    gridIcons.push_back(ICON_COVER);
-  }
-
-  // Static menu items
-  gridLabels.push_back(tr(STR_BROWSE_FILES));
-  gridIcons.push_back(ICON_HARDDRIVE);
-  gridLabels.push_back(tr(STR_MENU_RECENT_BOOKS));
-  gridIcons.push_back(ICON_FOLDER);
-  if (hasOpdsUrl) {
-    gridLabels.push_back(tr(STR_OPDS_BROWSER));
-    gridIcons.push_back(ICON_FOLDER);
-  }
-  gridLabels.push_back(tr(STR_FILE_TRANSFER));
-  gridIcons.push_back(ICON_TRANSFER);
-  gridLabels.push_back(tr(STR_SETTINGS_TITLE));
-  gridIcons.push_back(ICON_SETTINGS);
-
-  constexpr int cols = 3;
-  const int cellW = contentW / cols;
-  constexpr int cellH = 120;
-  const int numItems = static_cast<int>(gridLabels.size());
-  const int gridStartY = contentY + 20;
-
-  for (int i = 0; i < numItems; i++) {
-    const int col = i % cols;
-    const int row = i / cols;
-    const int cellX = contentX + col * cellW;
-    const int cellY = gridStartY + row * cellH;
-    const int cellCenterX = cellX + cellW / 2;
-    const bool sel = (i == selectorIndex);
-
-    // Draw icon based on type
-    if (gridIcons[i] == ICON_COVER && i < static_cast<int>(recentBooks.size()) &&
-        !recentBooks[i].coverBmpPath.empty()) {
-      // Try to draw book cover thumbnail
-      std::string coverPath = UITheme::getCoverThumbPath(recentBooks[i].coverBmpPath, coverThumbH);
-      FsFile coverFile;
-      bool coverDrawn = false;
-      if (Storage.openFileForRead("HOME", coverPath, coverFile)) {
-        Bitmap coverBmp(coverFile);
-        if (coverBmp.parseHeaders() == BmpReaderError::Ok) {
-          int bw = coverBmp.getWidth();
-          int bh = coverBmp.getHeight();
-          int bx = cellCenterX - bw / 2;
-          int by = cellY + 2 + (48 - bh) / 2;
-          if (sel) {
-            renderer.drawRect(bx - 3, by - 3, bw + 6, bh + 6);
-            renderer.drawRect(bx - 2, by - 2, bw + 4, bh + 4);
-          }
-          renderer.drawBitmap(coverBmp, bx, by, bw, bh, 0, 0);
-          coverDrawn = true;
-        }
-      }
-      if (!coverDrawn) {
-        if (sel) {
-          renderer.fillRect(cellCenterX - 28, cellY + 2, 56, 48);
-        }
-        drawMacDocumentIcon(cellCenterX, cellY + 24, sel);
-      }
-    } else {
-      // Standard icon with selection highlight
-      if (sel) {
-        renderer.fillRect(cellCenterX - 28, cellY + 2, 56, 48);
-      }
-      switch (gridIcons[i]) {
-        case ICON_HARDDRIVE:
-          drawMacHardDriveIcon(cellCenterX, cellY + 24, sel);
-          break;
-        case ICON_SETTINGS:
-          drawMacSettingsIcon(cellCenterX, cellY + 24, sel);
-          break;
-        case ICON_TRANSFER:
-          drawMacTransferIcon(cellCenterX, cellY + 24, sel);
-          break;
-        default:
-          drawMacFolderIcon(cellCenterX, cellY + 24, sel);
-          break;
-      }
-    }
-
-    // Label
-    const std::string truncLabel = renderer.truncatedText(UI_10_FONT_ID, gridLabels[i].c_str(), cellW - 10);
-    const int labelW = renderer.getTextWidth(UI_10_FONT_ID, truncLabel.c_str());
-    const int labelX = cellCenterX - labelW / 2;
-    const int labelY = cellY + 56;
-
-    if (sel) {
-      renderer.fillRect(labelX - 4, labelY - 3, labelW + 8, 28);
-      renderer.drawText(UI_10_FONT_ID, labelX, labelY, truncLabel.c_str(), false);
-    } else {
-      renderer.drawText(UI_10_FONT_ID, labelX, labelY, truncLabel.c_str(), true);
-    }
+  getGridItems(gridLabels, gridIcons);
+  if (selectorIndex >= 0 && selectorIndex < static_cast<int>(gridLabels.size())) {
+    const FinderLayout layout = getFinderLayout(renderer);
+    const int cellX = layout.contentX + (selectorIndex % GRID_COLS) * layout.cellW;
+    const int cellY = layout.gridStartY + (selectorIndex / GRID_COLS) * CELL_H;
+    renderer.fillRect(cellX, cellY, layout.cellW, CELL_CONTENT_H, false);
+    renderGridItem(selectorIndex, gridLabels[selectorIndex], gridIcons[selectorIndex], true);
   }
 
   renderer.displayBuffer();
@@ -1,5 +1,6 @@
 #pragma once
 #include <functional>
+#include <string>
 #include <vector>
 
 #include "../Activity.h"
@@ -18,6 +19,7 @@ class HomeActivity final : public Activity {
   bool hasOpdsUrl = false;
   bool coverRendered = false;      // Track if cover has been rendered once
   bool coverBufferStored = false;  // Track if cover buffer is stored
+  bool coversRegenerated = false;  // A cover thumbnail was generated since the snapshot was saved
   uint8_t* coverBuffer = nullptr;  // HomeActivity's own buffer for cover image
   int bookProgressPercent = -1;    // Current book reading progress (-1 = no book open)
   uint64_t cachedTotalBytes = 0;   // SD card total size (cached on enter)
@@ -34,6 +36,9 @@ class HomeActivity final : public Activity {
   bool storeCoverBuffer();    // Store frame buffer for cover image
   bool restoreCoverBuffer();  // Restore frame buffer from stored cover
   void freeCoverBuffer();     // Free the stored cover buffer
+  std::string getSnapshotKey() const;
+  bool loadSnapshot();        // Load the stored cover buffer from the SD card if its key still matches
+  void saveSnapshot() const;  // Persist the stored cover buffer with its key
   void loadRecentBooks(int maxBooks);
   void loadRecentCovers(int coverHeight);
   void drawMacFolderIcon(int cx, int cy, bool selected) const;
@@ -41,6 +46,10 @@ class HomeActivity final : public Activity {
   void drawMacSettingsIcon(int cx, int cy, bool selected) const;
   void drawMacTransferIcon(int cx, int cy, bool selected) const;
   void drawMacHardDriveIcon(int cx, int cy, bool selected) const;
+  void getGridItems(std::vector<std::string>& labels, std::vector<int>& icons) const;
+  void renderFinderWindow() const;
+  void renderGridItem(int index, const std::string& label, int icon, bool selected) const;
+  void renderStatus() const;
 
  public:
   explicit HomeActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
@@ -15,6 +15,7 @@
 #include "KOReaderSyncActivity.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
+#include "ResumeSnapshot.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 
@@ -117,6 +118,17 @@ void EpubReaderActivity::onExit() {
   epub.reset();
 }
 
+void EpubReaderActivity::onSleep() {
+  RenderLock lock(*this);
+  // Keep the page on the panel so the next wake can show it before the book has loaded. Anything else (a menu, the
+  // end of book screen) is rendered normally on wake, and an older snapshot must not stand in for it.
+  if (!subActivity && displayedPage >= 0 &&
+      RESUME_SNAPSHOT.save(renderer, epub->getPath(), displayedSpineIndex, displayedPage)) {
+    return;
+  }
+  RESUME_SNAPSHOT.remove();
+}
+
 void EpubReaderActivity::loop() {
   // Pass input responsibility to sub activity if exists
   if (subActivity) {
@@ -178,6 +190,8 @@ void EpubReaderActivity::loop() {
         this->renderer, this->mappedInput, epub->getTitle(), currentPage, totalPages, bookProgressPercent,
         SETTINGS.orientation, [this](const uint8_t orientation) { onReaderMenuBack(orientation); },
         [this](EpubReaderMenuActivity::MenuAction action) { onReaderMenuConfirm(action); }));
+    // The menu and the screens opened from it draw over the page, so the panel no longer shows the recorded frame
+    refreshScheduler.reset();
   }
 
   // Long press BACK (1s+) goes to file selection
@@ -489,6 +503,7 @@ void EpubReaderActivity::render(Activity::RenderLock&& lock) {
   if (!epub) {
     return;
   }
+  displayedPage = -1;
 
   // edge case handling for sub-zero spine index
   if (currentSpineIndex < 0) {
@@ -504,6 +519,7 @@ void EpubReaderActivity::render(Activity::RenderLock&& lock) {
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_END_OF_BOOK), true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
+    refreshScheduler.reset();
     return;
   }
 
@@ -541,7 +557,10 @@ void EpubReaderActivity::render(Activity::RenderLock&& lock) {
                                   viewportHeight, SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle)) {
       LOG_DBG("ERS", "Cache not found, building...");
 
-      const auto popupFn = [this]() { GUI.drawPopup(renderer, tr(STR_INDEXING)); };
+      const auto popupFn = [this]() {
+        GUI.drawPopup(renderer, tr(STR_INDEXING));
+        refreshScheduler.reset();
+      };
 
       if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                       SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
@@ -589,6 +608,7 @@ void EpubReaderActivity::render(Activity::RenderLock&& lock) {
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_EMPTY_CHAPTER), true, EpdFontFamily::BOLD);
     renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     renderer.displayBuffer();
+    refreshScheduler.reset();
     return;
   }
 
@@ -597,6 +617,7 @@ void EpubReaderActivity::render(Activity::RenderLock&& lock) {
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_OUT_OF_BOUNDS), true, EpdFontFamily::BOLD);
     renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
     renderer.displayBuffer();
+    refreshScheduler.reset();
     return;
   }
 
@@ -612,6 +633,8 @@ void EpubReaderActivity::render(Activity::RenderLock&& lock) {
     }
     const auto start = millis();
     renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+    displayedSpineIndex = currentSpineIndex;
+    displayedPage = section->currentPage;
     LOG_DBG("ERS", "Rendered page in %dms", millis() - start);
     renderer.clearFontCache();
   }
@@ -638,59 +661,71 @@ void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageC
 void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
                                         const int orientedMarginRight, const int orientedMarginBottom,
                                         const int orientedMarginLeft) {
-  // Force special handling for pages with images when anti-aliasing is on
-  bool imagePageWithAA = page->hasImages() && SETTINGS.textAntiAliasing;
-
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  // Deferred image rendering (EXPERIMENTAL, built with ENABLE_WINDOWED_IMAGE_REFRESH): the text goes out first with a
+  // frame where each image will be, so an illustrated page turns as quickly as a text page. The images are then
+  // decoded (or read from their .pxc) and pushed with a windowed refresh of their bounding box.
+  // The first page after a wake is drawn in one go instead, so it can be compared with the resume snapshot.
+#ifdef ENABLE_WINDOWED_IMAGE_REFRESH
+  int16_t imgX = 0, imgY = 0, imgW = 0, imgH = 0;
+  const bool deferImages = page->getImageBoundingBox(imgX, imgY, imgW, imgH) && !RESUME_SNAPSHOT.isPending();
+  imgX += orientedMarginLeft;
+  imgY += orientedMarginTop;
+#else
+  constexpr bool deferImages = false;
+#endif
+
+  renderer.resetGrayContent();
+  if (deferImages) {
+    page->renderText(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  } else {
+    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  }
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
-  if (imagePageWithAA) {
-    // Double FAST_REFRESH with selective image blanking (pablohc's technique):
-    // HALF_REFRESH sets particles too firmly for the grayscale LUT to adjust.
-    // Instead, blank only the image area and do two fast refreshes.
-    // Step 1: Display page with image area blanked (text appears, image area white)
-    // Step 2: Re-render with images and display again (images appear clean)
-    int16_t imgX, imgY, imgW, imgH;
-    if (page->getImageBoundingBox(imgX, imgY, imgW, imgH)) {
-      renderer.fillRect(imgX + orientedMarginLeft, imgY + orientedMarginTop, imgW, imgH, false);
-      renderer.displayBuffer(HalDisplay::FAST_REFRESH);
-
-      // Re-render page content to restore images into the blanked area
-      page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-      renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
-      renderer.displayBuffer(HalDisplay::FAST_REFRESH);
-    } else {
-      renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    }
-    // Double FAST_REFRESH handles ghosting for image pages; don't count toward full refresh cadence
-  } else if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
+  if (RESUME_SNAPSHOT.consume(renderer, epub->getPath(), currentSpineIndex, section->currentPage)) {
+    // The panel already shows this exact frame, put there with a HALF_REFRESH on wake
+    refreshScheduler.record(renderer.getFrameBuffer(), HalDisplay::HALF_REFRESH);
+  } else if (deferImages && SETTINGS.textAntiAliasing) {
+    // HALF_REFRESH sets particles too firmly for the grayscale LUT to adjust (pablohc's technique), so with
+    // anti-aliasing the text of an image page always goes out with a fast refresh while the image area is still
+    // blank. Its ghosting still counts, so the page after it is cleaned if the image leaves too much behind.
+    renderer.displayBuffer(HalDisplay::FAST_REFRESH);
+    refreshScheduler.record(renderer.getFrameBuffer(), HalDisplay::FAST_REFRESH);
   } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+    renderer.displayBuffer(refreshScheduler.next(renderer.getFrameBuffer(), SETTINGS.getRefreshFrequency()));
+  }
+
+#ifdef ENABLE_WINDOWED_IMAGE_REFRESH
+  if (deferImages) {
+    page->renderImages(renderer, orientedMarginLeft, orientedMarginTop);
+    renderer.displayWindow(imgX, imgY, imgW, imgH);
+    refreshScheduler.record(renderer.getFrameBuffer(), HalDisplay::FAST_REFRESH);
+  }
+#endif
+
+  // Pages without anti-aliased glyphs or gray image pixels would get empty grayscale planes, so skip the grayscale
+  // passes, the BW buffer copy and the second display update for them
+  if (!SETTINGS.textAntiAliasing || !renderer.hasGrayContent()) {
+    return;
   }
 
   // Save bw buffer to reset buffer state after grayscale data sync
   renderer.storeBwBuffer();
 
   // grayscale rendering
-  // TODO: Only do this if font supports it
-  if (SETTINGS.textAntiAliasing) {
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleLsbBuffers();
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.copyGrayscaleLsbBuffers();
 
-    // Render and copy to MSB buffer
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleMsbBuffers();
+  // Render and copy to MSB buffer
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.copyGrayscaleMsbBuffers();
 
-    // display grayscale part
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
-  }
+  // display grayscale part
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
 
   // restore the bw data
   renderer.restoreBwBuffer();
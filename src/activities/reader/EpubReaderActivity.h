@@ -1,6 +1,7 @@
 #pragma once
 #include <Epub.h>
 #include <Epub/Section.h>
+#include <RefreshScheduler.h>
 
 #include "EpubReaderMenuActivity.h"
 #include "activities/ActivityWithSubactivity.h"
@@ -10,7 +11,7 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   std::unique_ptr<Section> section = nullptr;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
-  int pagesUntilFullRefresh = 0;
+  RefreshScheduler refreshScheduler;
   int cachedSpineIndex = 0;
   int cachedChapterTotalPageCount = 0;
   // Signals that the next render should reposition within the newly loaded section
@@ -21,6 +22,8 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   bool pendingSubactivityExit = false;  // Defer subactivity exit to avoid use-after-free
   bool pendingGoHome = false;           // Defer go home to avoid race condition with display task
   bool skipNextButtonCheck = false;     // Skip button processing for one frame after subactivity exit
+  int displayedSpineIndex = -1;         // Page the frame buffer holds, for the resume snapshot (-1 = none)
+  int displayedPage = -1;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
 
@@ -43,6 +46,7 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
         onGoHome(onGoHome) {}
   void onEnter() override;
   void onExit() override;
+  void onSleep() override;
   void loop() override;
   void render(Activity::RenderLock&& lock) override;
 };
@@ -184,6 +184,7 @@ void TxtReaderActivity::buildPageIndex() {
   LOG_DBG("TRS", "Building page index for %zu bytes...", fileSize);
 
   GUI.drawPopup(renderer, tr(STR_INDEXING));
+  refreshScheduler.reset();
 
   while (offset < fileSize) {
     std::vector<std::string> tempLines;
@@ -353,6 +354,7 @@ void TxtReaderActivity::render(Activity::RenderLock&&) {
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_EMPTY_FILE), true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
+    refreshScheduler.reset();
     return;
   }
 
@@ -422,19 +424,14 @@ void TxtReaderActivity::renderPage() {
   };
 
   // First pass: BW rendering
+  renderer.resetGrayContent();
   renderLines();
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
 
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+  renderer.displayBuffer(refreshScheduler.next(renderer.getFrameBuffer(), SETTINGS.getRefreshFrequency()));
 
-  // Grayscale rendering pass (for anti-aliased fonts)
-  if (SETTINGS.textAntiAliasing) {
+  // Grayscale rendering pass (for anti-aliased fonts), skipped when the page has no gray pixels to show
+  if (SETTINGS.textAntiAliasing && renderer.hasGrayContent()) {
     // Save BW buffer for restoration after grayscale pass
     renderer.storeBwBuffer();
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <RefreshScheduler.h>
 #include <Txt.h>
 
 #include <vector>
@@ -12,7 +13,7 @@ class TxtReaderActivity final : public ActivityWithSubactivity {
 
   int currentPage = 0;
   int totalPages = 1;
-  int pagesUntilFullRefresh = 0;
+  RefreshScheduler refreshScheduler;
 
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
@@ -76,6 +76,8 @@ void XtcReaderActivity::loop() {
             exitActivity();
             requestUpdate();
           }));
+      // The chapter list draws over the page, so the panel no longer shows the recorded frame
+      refreshScheduler.reset();
     }
   }
 
@@ -146,6 +148,7 @@ void XtcReaderActivity::render(Activity::RenderLock&&) {
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_END_OF_BOOK), true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
+    refreshScheduler.reset();
     return;
   }
 
@@ -175,6 +178,7 @@ void XtcReaderActivity::renderPage() {
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_MEMORY_ERROR), true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
+    refreshScheduler.reset();
     return;
   }
 
@@ -186,6 +190,7 @@ void XtcReaderActivity::renderPage() {
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, tr(STR_PAGE_LOAD_ERROR), true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
+    refreshScheduler.reset();
     return;
   }
 
@@ -242,14 +247,8 @@ void XtcReaderActivity::renderPage() {
       }
     }
 
-    // Display BW with conditional refresh based on pagesUntilFullRefresh
-    if (pagesUntilFullRefresh <= 1) {
-      renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-      pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-    } else {
-      renderer.displayBuffer();
-      pagesUntilFullRefresh--;
-    }
+    // Display BW with the refresh its changes call for
+    renderer.displayBuffer(refreshScheduler.next(renderer.getFrameBuffer(), SETTINGS.getRefreshFrequency()));
 
     // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
@@ -321,14 +320,8 @@ void XtcReaderActivity::renderPage() {
 
   // XTC pages already have status bar pre-rendered, no need to add our own
 
-  // Display with appropriate refresh
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+  // Display with the refresh its changes call for
+  renderer.displayBuffer(refreshScheduler.next(renderer.getFrameBuffer(), SETTINGS.getRefreshFrequency()));
 
   LOG_DBG("XTR", "Rendered page %lu/%lu (%u-bit)", currentPage + 1, xtc->getPageCount(), bitDepth);
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <RefreshScheduler.h>
 #include <Xtc.h>
 
 #include "activities/ActivityWithSubactivity.h"
@@ -15,7 +16,7 @@ class XtcReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Xtc> xtc;
 
   uint32_t currentPage = 0;
-  int pagesUntilFullRefresh = 0;
+  RefreshScheduler refreshScheduler;
 
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
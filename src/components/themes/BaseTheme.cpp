@@ -188,6 +188,8 @@ void BaseTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
                          const std::function<std::string(int index)>& rowSubtitle,
                          const std::function<UIIcon(int index)>& rowIcon,
                          const std::function<std::string(int index)>& rowValue, bool highlightValue) const {
+  const FontHandle ui10Font = renderer.getFont(UI_10_FONT_ID);
+  const FontHandle ui12Font = renderer.getFont(UI_12_FONT_ID);
   int rowHeight =
       (rowSubtitle != nullptr) ? BaseMetrics::values.listWithSubtitleRowHeight : BaseMetrics::values.listRowHeight;
   int pageItems = rect.height / rowHeight;
@@ -231,23 +233,23 @@ void BaseTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
 
     // Draw name
     auto itemName = rowTitle(i);
-    auto font = (rowSubtitle != nullptr) ? UI_12_FONT_ID : UI_10_FONT_ID;
+    auto font = (rowSubtitle != nullptr) ? ui12Font : ui10Font;
     auto item = renderer.truncatedText(font, itemName.c_str(), textWidth);
     renderer.drawText(font, rect.x + BaseMetrics::values.contentSidePadding, itemY, item.c_str(), i != selectedIndex);
 
     if (rowSubtitle != nullptr) {
       // Draw subtitle
       std::string subtitleText = rowSubtitle(i);
-      auto subtitle = renderer.truncatedText(UI_10_FONT_ID, subtitleText.c_str(), textWidth);
-      renderer.drawText(UI_10_FONT_ID, rect.x + BaseMetrics::values.contentSidePadding, itemY + 30, subtitle.c_str(),
+      auto subtitle = renderer.truncatedText(ui10Font, subtitleText.c_str(), textWidth);
+      renderer.drawText(ui10Font, rect.x + BaseMetrics::values.contentSidePadding, itemY + 30, subtitle.c_str(),
                         i != selectedIndex);
     }
 
     if (rowValue != nullptr) {
       // Draw value
       std::string valueText = rowValue(i);
-      const auto valueTextWidth = renderer.getTextWidth(UI_10_FONT_ID, valueText.c_str());
-      renderer.drawText(UI_10_FONT_ID, rect.x + contentWidth - BaseMetrics::values.contentSidePadding - valueTextWidth,
+      const auto valueTextWidth = renderer.getTextWidth(ui10Font, valueText.c_str());
+      renderer.drawText(ui10Font, rect.x + contentWidth - BaseMetrics::values.contentSidePadding - valueTextWidth,
                         itemY, valueText.c_str(), i != selectedIndex);
     }
   }
@@ -341,6 +343,8 @@ void BaseTheme::drawTabBar(const GfxRenderer& renderer, const Rect rect, const s
 void BaseTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std::vector<RecentBook>& recentBooks,
                                     const int selectorIndex, bool& coverRendered, bool& coverBufferStored,
                                     bool& bufferRestored, std::function<bool()> storeCoverBuffer) const {
+  const FontHandle ui10Font = renderer.getFont(UI_10_FONT_ID);
+  const FontHandle ui12Font = renderer.getFont(UI_12_FONT_ID);
   const bool hasContinueReading = !recentBooks.empty();
   const bool bookSelected = hasContinueReading && selectorIndex == 0;
 
@@ -510,7 +514,7 @@ void BaseTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
     std::string currentLine;
     // Extra padding inside the card so text doesn't hug the border
     const int maxLineWidth = bookWidth - 40;
-    const int spaceWidth = renderer.getSpaceWidth(UI_12_FONT_ID);
+    const int spaceWidth = renderer.getSpaceWidth(ui12Font);
 
     for (auto& i : words) {
       // If we just hit the line limit (3), stop processing words
@@ -520,7 +524,7 @@ void BaseTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
         lines.back().append("...");
 
         while (!lines.back().empty() && lines.back().size() > 3 &&
-               renderer.getTextWidth(UI_12_FONT_ID, lines.back().c_str()) > maxLineWidth) {
+               renderer.getTextWidth(ui12Font, lines.back().c_str()) > maxLineWidth) {
           // Remove "..." first, then remove one UTF-8 char, then add "..." back
           lines.back().resize(lines.back().size() - 3);  // Remove "..."
           utf8RemoveLastChar(lines.back());
@@ -529,13 +533,13 @@ void BaseTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
         break;
       }
 
-      int wordWidth = renderer.getTextWidth(UI_12_FONT_ID, i.c_str());
+      int wordWidth = renderer.getTextWidth(ui12Font, i.c_str());
       while (wordWidth > maxLineWidth && !i.empty()) {
         // Word itself is too long, trim it (UTF-8 safe)
         utf8RemoveLastChar(i);
         // Check if we have room for ellipsis
         std::string withEllipsis = i + "...";
-        wordWidth = renderer.getTextWidth(UI_12_FONT_ID, withEllipsis.c_str());
+        wordWidth = renderer.getTextWidth(ui12Font, withEllipsis.c_str());
         if (wordWidth <= maxLineWidth) {
           i = withEllipsis;
           break;
@@ -543,11 +547,11 @@ void BaseTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
       }
       if (i.empty()) continue;  // Skip words that couldn't fit even truncated
 
-      int newLineWidth = renderer.getTextAdvanceX(UI_12_FONT_ID, currentLine.c_str(), EpdFontFamily::REGULAR);
+      int newLineWidth = renderer.getTextAdvanceX(ui12Font, currentLine.c_str(), EpdFontFamily::REGULAR);
       if (newLineWidth > 0) {
         newLineWidth += spaceWidth;
       }
-      newLineWidth += renderer.getTextAdvanceX(UI_12_FONT_ID, i.c_str(), EpdFontFamily::REGULAR);
+      newLineWidth += renderer.getTextAdvanceX(ui12Font, i.c_str(), EpdFontFamily::REGULAR);
 
       if (newLineWidth > maxLineWidth && !currentLine.empty()) {
         // New line too long, push old line
@@ -566,9 +570,9 @@ void BaseTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
     }
 
     // Book title text
-    int totalTextHeight = renderer.getLineHeight(UI_12_FONT_ID) * static_cast<int>(lines.size());
+    int totalTextHeight = renderer.getLineHeight(ui12Font) * static_cast<int>(lines.size());
     if (!lastBookAuthor.empty()) {
-      totalTextHeight += renderer.getLineHeight(UI_10_FONT_ID) * 3 / 2;
+      totalTextHeight += renderer.getLineHeight(ui10Font) * 3 / 2;
     }
 
     // Vertically center the title block within the card
@@ -580,21 +584,21 @@ void BaseTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
       // Calculate the max text width for the box
       int maxTextWidth = 0;
       for (const auto& line : lines) {
-        const int lineWidth = renderer.getTextWidth(UI_12_FONT_ID, line.c_str());
+        const int lineWidth = renderer.getTextWidth(ui12Font, line.c_str());
         if (lineWidth > maxTextWidth) {
           maxTextWidth = lineWidth;
         }
       }
       if (!lastBookAuthor.empty()) {
         std::string trimmedAuthor = lastBookAuthor;
-        while (renderer.getTextWidth(UI_10_FONT_ID, trimmedAuthor.c_str()) > maxLineWidth && !trimmedAuthor.empty()) {
+        while (renderer.getTextWidth(ui10Font, trimmedAuthor.c_str()) > maxLineWidth && !trimmedAuthor.empty()) {
           utf8RemoveLastChar(trimmedAuthor);
         }
-        if (renderer.getTextWidth(UI_10_FONT_ID, trimmedAuthor.c_str()) <
-            renderer.getTextWidth(UI_10_FONT_ID, lastBookAuthor.c_str())) {
+        if (renderer.getTextWidth(ui10Font, trimmedAuthor.c_str()) <
+            renderer.getTextWidth(ui10Font, lastBookAuthor.c_str())) {
           trimmedAuthor.append("...");
         }
-        const int authorWidth = renderer.getTextWidth(UI_10_FONT_ID, trimmedAuthor.c_str());
+        const int authorWidth = renderer.getTextWidth(ui10Font, trimmedAuthor.c_str());
         if (authorWidth > maxTextWidth) {
           maxTextWidth = authorWidth;
         }
@@ -612,53 +616,53 @@ void BaseTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
     }
 
     for (const auto& line : lines) {
-      renderer.drawCenteredText(UI_12_FONT_ID, titleYStart, line.c_str(), !bookSelected);
-      titleYStart += renderer.getLineHeight(UI_12_FONT_ID);
+      renderer.drawCenteredText(ui12Font, titleYStart, line.c_str(), !bookSelected);
+      titleYStart += renderer.getLineHeight(ui12Font);
     }
 
     if (!lastBookAuthor.empty()) {
-      titleYStart += renderer.getLineHeight(UI_10_FONT_ID) / 2;
+      titleYStart += renderer.getLineHeight(ui10Font) / 2;
       std::string trimmedAuthor = lastBookAuthor;
       // Trim author if too long (UTF-8 safe)
       bool wasTrimmed = false;
-      while (renderer.getTextWidth(UI_10_FONT_ID, trimmedAuthor.c_str()) > maxLineWidth && !trimmedAuthor.empty()) {
+      while (renderer.getTextWidth(ui10Font, trimmedAuthor.c_str()) > maxLineWidth && !trimmedAuthor.empty()) {
         utf8RemoveLastChar(trimmedAuthor);
         wasTrimmed = true;
       }
       if (wasTrimmed && !trimmedAuthor.empty()) {
         // Make room for ellipsis
-        while (renderer.getTextWidth(UI_10_FONT_ID, (trimmedAuthor + "...").c_str()) > maxLineWidth &&
+        while (renderer.getTextWidth(ui10Font, (trimmedAuthor + "...").c_str()) > maxLineWidth &&
                !trimmedAuthor.empty()) {
           utf8RemoveLastChar(trimmedAuthor);
         }
         trimmedAuthor.append("...");
       }
-      renderer.drawCenteredText(UI_10_FONT_ID, titleYStart, trimmedAuthor.c_str(), !bookSelected);
+      renderer.drawCenteredText(ui10Font, titleYStart, trimmedAuthor.c_str(), !bookSelected);
     }
 
     // "Continue Reading" label at the bottom
-    const int continueY = bookY + bookHeight - renderer.getLineHeight(UI_10_FONT_ID) * 3 / 2;
+    const int continueY = bookY + bookHeight - renderer.getLineHeight(ui10Font) * 3 / 2;
     if (coverRendered) {
       // Draw box behind "Continue Reading" text (inverted when selected: black box instead of white)
       const char* continueText = tr(STR_CONTINUE_READING);
-      const int continueTextWidth = renderer.getTextWidth(UI_10_FONT_ID, continueText);
+      const int continueTextWidth = renderer.getTextWidth(ui10Font, continueText);
       constexpr int continuePadding = 6;
       const int continueBoxWidth = continueTextWidth + continuePadding * 2;
-      const int continueBoxHeight = renderer.getLineHeight(UI_10_FONT_ID) + continuePadding;
+      const int continueBoxHeight = renderer.getLineHeight(ui10Font) + continuePadding;
       const int continueBoxX = rect.x + (rect.width - continueBoxWidth) / 2;
       const int continueBoxY = continueY - continuePadding / 2;
       renderer.fillRect(continueBoxX, continueBoxY, continueBoxWidth, continueBoxHeight, bookSelected);
       renderer.drawRect(continueBoxX, continueBoxY, continueBoxWidth, continueBoxHeight, !bookSelected);
-      renderer.drawCenteredText(UI_10_FONT_ID, continueY, continueText, !bookSelected);
+      renderer.drawCenteredText(ui10Font, continueY, continueText, !bookSelected);
     } else {
-      renderer.drawCenteredText(UI_10_FONT_ID, continueY, tr(STR_CONTINUE_READING), !bookSelected);
+      renderer.drawCenteredText(ui10Font, continueY, tr(STR_CONTINUE_READING), !bookSelected);
     }
   } else {
     // No book to continue reading
     const int y =
-        bookY + (bookHeight - renderer.getLineHeight(UI_12_FONT_ID) - renderer.getLineHeight(UI_10_FONT_ID)) / 2;
-    renderer.drawCenteredText(UI_12_FONT_ID, y, "No open book");
-    renderer.drawCenteredText(UI_10_FONT_ID, y + renderer.getLineHeight(UI_12_FONT_ID), "Start reading below");
+        bookY + (bookHeight - renderer.getLineHeight(ui12Font) - renderer.getLineHeight(ui10Font)) / 2;
+    renderer.drawCenteredText(ui12Font, y, "No open book");
+    renderer.drawCenteredText(ui10Font, y + renderer.getLineHeight(ui12Font), "Start reading below");
   }
 }
 
@@ -251,6 +251,8 @@ void LyraTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
                          const std::function<std::string(int index)>& rowSubtitle,
                          const std::function<UIIcon(int index)>& rowIcon,
                          const std::function<std::string(int index)>& rowValue, bool highlightValue) const {
+  const FontHandle smallFont = renderer.getFont(SMALL_FONT_ID);
+  const FontHandle ui10Font = renderer.getFont(UI_10_FONT_ID);
   int rowHeight =
       (rowSubtitle != nullptr) ? LyraMetrics::values.listWithSubtitleRowHeight : LyraMetrics::values.listRowHeight;
   int pageItems = rect.height / rowHeight;
@@ -300,14 +302,14 @@ void LyraTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
     std::string valueText = "";
     if (rowValue != nullptr) {
       valueText = rowValue(i);
-      valueText = renderer.truncatedText(UI_10_FONT_ID, valueText.c_str(), maxListValueWidth);
-      valueWidth = renderer.getTextWidth(UI_10_FONT_ID, valueText.c_str()) + hPaddingInSelection;
+      valueText = renderer.truncatedText(ui10Font, valueText.c_str(), maxListValueWidth);
+      valueWidth = renderer.getTextWidth(ui10Font, valueText.c_str()) + hPaddingInSelection;
       rowTextWidth -= valueWidth;
     }
 
     auto itemName = rowTitle(i);
-    auto item = renderer.truncatedText(UI_10_FONT_ID, itemName.c_str(), rowTextWidth);
-    renderer.drawText(UI_10_FONT_ID, textX, itemY + 7, item.c_str(), true);
+    auto item = renderer.truncatedText(ui10Font, itemName.c_str(), rowTextWidth);
+    renderer.drawText(ui10Font, textX, itemY + 7, item.c_str(), true);
 
     if (rowIcon != nullptr) {
       UIIcon icon = rowIcon(i);
@@ -321,8 +323,8 @@ void LyraTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
     if (rowSubtitle != nullptr) {
       // Draw subtitle
       std::string subtitleText = rowSubtitle(i);
-      auto subtitle = renderer.truncatedText(SMALL_FONT_ID, subtitleText.c_str(), rowTextWidth);
-      renderer.drawText(SMALL_FONT_ID, textX, itemY + 30, subtitle.c_str(), true);
+      auto subtitle = renderer.truncatedText(smallFont, subtitleText.c_str(), rowTextWidth);
+      renderer.drawText(smallFont, textX, itemY + 30, subtitle.c_str(), true);
     }
 
     // Draw value
@@ -333,7 +335,7 @@ void LyraTheme::drawList(const GfxRenderer& renderer, Rect rect, int itemCount,
             valueWidth + hPaddingInSelection, rowHeight, cornerRadius, Color::Black);
       }
 
-      renderer.drawText(UI_10_FONT_ID, rect.x + contentWidth - LyraMetrics::values.contentSidePadding - valueWidth,
+      renderer.drawText(ui10Font, rect.x + contentWidth - LyraMetrics::values.contentSidePadding - valueWidth,
                         itemY + 6, valueText.c_str(), !(i == selectedIndex && highlightValue));
     }
   }
@@ -413,6 +415,8 @@ void LyraTheme::drawSideButtonHints(const GfxRenderer& renderer, const char* top
 void LyraTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std::vector<RecentBook>& recentBooks,
                                     const int selectorIndex, bool& coverRendered, bool& coverBufferStored,
                                     bool& bufferRestored, std::function<bool()> storeCoverBuffer) const {
+  const FontHandle ui10Font = renderer.getFont(UI_10_FONT_ID);
+  const FontHandle ui12Font = renderer.getFont(UI_12_FONT_ID);
   const int tileWidth = rect.width - 2 * LyraMetrics::values.contentSidePadding;
   const int tileHeight = rect.height;
   const int tileY = rect.y;
@@ -497,34 +501,34 @@ void LyraTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
       words.emplace_back(lastBookTitle.substr(wordStart, wordEnd - wordStart));
     }
     const int maxLineWidth = textWidth;
-    const int spaceWidth = renderer.getSpaceWidth(UI_12_FONT_ID, EpdFontFamily::BOLD);
+    const int spaceWidth = renderer.getSpaceWidth(ui12Font, EpdFontFamily::BOLD);
     std::vector<std::string> titleLines;
     std::string currentLine;
     for (auto& w : words) {
       if (titleLines.size() >= 3) {
         titleLines.back().append("...");
         while (!titleLines.back().empty() && titleLines.back().size() > 3 &&
-               renderer.getTextWidth(UI_12_FONT_ID, titleLines.back().c_str(), EpdFontFamily::BOLD) > maxLineWidth) {
+               renderer.getTextWidth(ui12Font, titleLines.back().c_str(), EpdFontFamily::BOLD) > maxLineWidth) {
           titleLines.back().resize(titleLines.back().size() - 3);
           utf8RemoveLastChar(titleLines.back());
           titleLines.back().append("...");
         }
         break;
       }
-      int wordW = renderer.getTextWidth(UI_12_FONT_ID, w.c_str(), EpdFontFamily::BOLD);
+      int wordW = renderer.getTextWidth(ui12Font, w.c_str(), EpdFontFamily::BOLD);
       while (wordW > maxLineWidth && !w.empty()) {
         utf8RemoveLastChar(w);
         std::string withE = w + "...";
-        wordW = renderer.getTextWidth(UI_12_FONT_ID, withE.c_str(), EpdFontFamily::BOLD);
+        wordW = renderer.getTextWidth(ui12Font, withE.c_str(), EpdFontFamily::BOLD);
         if (wordW <= maxLineWidth) {
           w = withE;
           break;
         }
       }
       if (w.empty()) continue;  // Skip words that couldn't fit even truncated
-      int newW = renderer.getTextAdvanceX(UI_12_FONT_ID, currentLine.c_str(), EpdFontFamily::BOLD);
+      int newW = renderer.getTextAdvanceX(ui12Font, currentLine.c_str(), EpdFontFamily::BOLD);
       if (newW > 0) newW += spaceWidth;
-      newW += renderer.getTextAdvanceX(UI_12_FONT_ID, w.c_str(), EpdFontFamily::BOLD);
+      newW += renderer.getTextAdvanceX(ui12Font, w.c_str(), EpdFontFamily::BOLD);
       if (newW > maxLineWidth && !currentLine.empty()) {
         titleLines.push_back(currentLine);
         currentLine = w;
@@ -536,20 +540,20 @@ void LyraTheme::drawRecentBookCover(GfxRenderer& renderer, Rect rect, const std:
     }
     if (!currentLine.empty() && titleLines.size() < 3) titleLines.push_back(currentLine);
 
-    auto author = renderer.truncatedText(UI_10_FONT_ID, book.author.c_str(), textWidth);
-    const int titleLineHeight = renderer.getLineHeight(UI_12_FONT_ID);
+    auto author = renderer.truncatedText(ui10Font, book.author.c_str(), textWidth);
+    const int titleLineHeight = renderer.getLineHeight(ui12Font);
     const int titleBlockHeight = titleLineHeight * static_cast<int>(titleLines.size());
-    const int authorHeight = book.author.empty() ? 0 : (renderer.getLineHeight(UI_10_FONT_ID) * 3 / 2);
+    const int authorHeight = book.author.empty() ? 0 : (renderer.getLineHeight(ui10Font) * 3 / 2);
     const int totalBlockHeight = titleBlockHeight + authorHeight;
     int titleY = tileY + tileHeight / 2 - totalBlockHeight / 2;
     const int textX = tileX + hPaddingInSelection + coverWidth + LyraMetrics::values.verticalSpacing;
     for (const auto& line : titleLines) {
-      renderer.drawText(UI_12_FONT_ID, textX, titleY, line.c_str(), true, EpdFontFamily::BOLD);
+      renderer.drawText(ui12Font, textX, titleY, line.c_str(), true, EpdFontFamily::BOLD);
       titleY += titleLineHeight;
     }
     if (!book.author.empty()) {
-      titleY += renderer.getLineHeight(UI_10_FONT_ID) / 2;
-      renderer.drawText(UI_10_FONT_ID, textX, titleY, author.c_str(), true);
+      titleY += renderer.getLineHeight(ui10Font) / 2;
+      renderer.drawText(ui10Font, textX, titleY, author.c_str(), true);
     }
   } else {
     drawEmptyRecents(renderer, rect);
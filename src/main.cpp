@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include <Epub.h>
+#include <EpdFontPack.h>
 #include <FontDecompressor.h>
 #include <GfxRenderer.h>
 #include <HalDisplay.h>
@@ -12,6 +13,7 @@
 #include <builtinFonts/all.h>
 
 #include <cstring>
+#include <memory>
 
 #include "Battery.h"
 #include "CrossPointSettings.h"
@@ -19,6 +21,7 @@
 #include "KOReaderCredentialStore.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
+#include "ResumeSnapshot.h"
 #include "activities/boot_sleep/BootActivity.h"
 #include "activities/boot_sleep/SleepActivity.h"
 #include "activities/browser/OpdsBookBrowserActivity.h"
@@ -116,7 +119,94 @@ EpdFont opendyslexic14ItalicFont(&opendyslexic_14_italic);
 EpdFont opendyslexic14BoldItalicFont(&opendyslexic_14_bolditalic);
 EpdFontFamily opendyslexic14FontFamily(&opendyslexic14RegularFont, &opendyslexic14BoldFont, &opendyslexic14ItalicFont,
                                        &opendyslexic14BoldItalicFont);
+#else
+// Reader fonts left out of the firmware are loaded from /fonts/<name>_<style>.epdfont on the SD card. Each pack keeps
+// its glyph tables in RAM and its file open (bitmaps are paged in group by group by the font decompressor), so only
+// the family of the selected reader font is loaded. Every other SD font ID renders in the built-in Bookerly 14.
+struct SdFontFamily {
+  const char* name;
+  int fontId;
+};
+
+constexpr SdFontFamily sdFontFamilies[] = {
+    {"bookerly_12", BOOKERLY_12_FONT_ID},
+    {"bookerly_16", BOOKERLY_16_FONT_ID},
+    {"bookerly_18", BOOKERLY_18_FONT_ID},
+    {"notosans_12", NOTOSANS_12_FONT_ID},
+    {"notosans_14", NOTOSANS_14_FONT_ID},
+    {"notosans_16", NOTOSANS_16_FONT_ID},
+    {"notosans_18", NOTOSANS_18_FONT_ID},
+    {"opendyslexic_8", OPENDYSLEXIC_8_FONT_ID},
+    {"opendyslexic_10", OPENDYSLEXIC_10_FONT_ID},
+    {"opendyslexic_12", OPENDYSLEXIC_12_FONT_ID},
+    {"opendyslexic_14", OPENDYSLEXIC_14_FONT_ID},
+};
+
+// The SD family registered under its font ID, and its packs
+const SdFontFamily* loadedSdFamily = nullptr;
+EpdFontPack sdFontPacks[4];
+std::unique_ptr<EpdFont> sdFonts[4];
+
+void releaseSdFontFamily() {
+  if (loadedSdFamily) {
+    renderer.replaceFont(loadedSdFamily->fontId, bookerly14FontFamily);
+    LOG_DBG("MAIN", "Released SD font %s", loadedSdFamily->name);
+    loadedSdFamily = nullptr;
+  }
+  for (int i = 0; i < 4; i++) {
+    sdFonts[i].reset();
+    sdFontPacks[i].unload();
+  }
+}
+
+void loadSdFontFamily(const SdFontFamily& family) {
+  static const char* const styleNames[] = {"regular", "bold", "italic", "bolditalic"};
+  char path[64];
+  for (int i = 0; i < 4; i++) {
+    snprintf(path, sizeof(path), "/fonts/%s_%s.epdfont", family.name, styleNames[i]);
+    if (Storage.exists(path) && sdFontPacks[i].load(path)) {
+      sdFonts[i].reset(new EpdFont(sdFontPacks[i].getData()));
+    }
+  }
+
+  if (!sdFonts[0]) {
+    // The font ID keeps rendering in the built-in face, so a saved font setting still works
+    LOG_INF("MAIN", "No SD font pack for %s, using Bookerly 14", family.name);
+    releaseSdFontFamily();
+    return;
+  }
+  renderer.replaceFont(family.fontId,
+                       EpdFontFamily(sdFonts[0].get(), sdFonts[1].get(), sdFonts[2].get(), sdFonts[3].get()));
+  loadedSdFamily = &family;
+  LOG_DBG("MAIN", "Loaded SD font %s", family.name);
+}
+#endif  // OMIT_FONTS
+
+// SD reader fonts are held only while a book is open. Both functions must be called between activities, while nothing
+// draws with the reader font.
+
+// Loads the SD font packs of the selected reader font and releases those of a previous selection
+void syncReaderFont() {
+#ifdef OMIT_FONTS
+  const int fontId = SETTINGS.getReaderFontId();
+  if (loadedSdFamily && loadedSdFamily->fontId == fontId) {
+    return;
+  }
+  releaseSdFontFamily();
+  for (const auto& family : sdFontFamilies) {
+    if (family.fontId == fontId) {
+      loadSdFontFamily(family);
+      return;
+    }
+  }
+#endif  // OMIT_FONTS
+}
+
+void releaseReaderFont() {
+#ifdef OMIT_FONTS
+  releaseSdFontFamily();
 #endif  // OMIT_FONTS
+}
 
 EpdFont smallFont(&notosans_8_regular);
 EpdFontFamily smallFontFamily(&smallFont);
@@ -225,6 +315,9 @@ void waitForPowerRelease() {
 void enterDeepSleep() {
   APP_STATE.lastSleepFromReader = currentActivity && currentActivity->isReaderActivity();
   APP_STATE.saveToFile();
+  if (currentActivity) {
+    currentActivity->onSleep();
+  }
   exitActivity();
   enterNewActivity(new SleepActivity(renderer, mappedInputManager));
 
@@ -241,6 +334,7 @@ void onGoToRecentBooks();
 void onGoToReader(const std::string& initialEpubPath) {
   const std::string bookPath = initialEpubPath;  // Copy before exitActivity() invalidates the reference
   exitActivity();
+  syncReaderFont();
   enterNewActivity(new ReaderActivity(renderer, mappedInputManager, bookPath, onGoHome, onGoToMyLibraryWithPath));
 }
 
@@ -276,6 +370,8 @@ void onGoToBrowser() {
 
 void onGoHome() {
   exitActivity();
+  // Reader font settings are changed from home, so the next book loads whichever font is selected by then
+  releaseReaderFont();
   enterNewActivity(new HomeActivity(renderer, mappedInputManager, onGoToReader, onGoToMyLibrary, onGoToRecentBooks,
                                     onGoToSettings, onGoToFileTransfer, onGoToBrowser));
 }
@@ -304,6 +400,11 @@ void setupDisplayAndFonts() {
   renderer.insertFont(OPENDYSLEXIC_10_FONT_ID, opendyslexic10FontFamily);
   renderer.insertFont(OPENDYSLEXIC_12_FONT_ID, opendyslexic12FontFamily);
   renderer.insertFont(OPENDYSLEXIC_14_FONT_ID, opendyslexic14FontFamily);
+#else
+  // Every SD family renders in the built-in face until syncReaderFont() swaps in the packs of the selected one
+  for (const auto& family : sdFontFamilies) {
+    renderer.insertFont(family.fontId, bookerly14FontFamily);
+  }
 #endif  // OMIT_FONTS
   renderer.insertFont(UI_10_FONT_ID, ui10FontFamily);
   renderer.insertFont(UI_12_FONT_ID, ui12FontFamily);
@@ -366,16 +467,23 @@ void setup() {
 
   setupDisplayAndFonts();
 
-  exitActivity();
-  enterNewActivity(new BootActivity(renderer, mappedInputManager));
-
   APP_STATE.loadFromFile();
   RECENT_BOOKS.loadFromFile();
 
   // Boot to home screen if no book is open, last sleep was not from reader, back button is held, or reader activity
   // crashed (indicated by readerActivityLoadCount > 0)
-  if (APP_STATE.openEpubPath.empty() || !APP_STATE.lastSleepFromReader ||
-      mappedInputManager.isPressed(MappedInputManager::Button::Back) || APP_STATE.readerActivityLoadCount > 0) {
+  const bool bootToHome = APP_STATE.openEpubPath.empty() || !APP_STATE.lastSleepFromReader ||
+                          mappedInputManager.isPressed(MappedInputManager::Button::Back) ||
+                          APP_STATE.readerActivityLoadCount > 0;
+
+  // When resuming a book, the page that was on screen at sleep replaces the boot screen and stays up while the reader
+  // loads the book
+  if (bootToHome || !RESUME_SNAPSHOT.display(renderer, APP_STATE.openEpubPath)) {
+    exitActivity();
+    enterNewActivity(new BootActivity(renderer, mappedInputManager));
+  }
+
+  if (bootToHome) {
     onGoHome();
   } else {
     // Clear app state to avoid getting into a boot loop if the epub doesn't load
@@ -0,0 +1,164 @@
+#include <EpdFontFamily.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Host microbenchmark for the GfxRenderer hot paths. Every primitive is timed in each orientation and the result is
+// reported as logical pixels visited per second, next to a plain drawPixel loop over the same pixels as the per-pixel
+// reference.
+
+constexpr int BENCH_FONT_ID = 1;
+const char* const kSampleText = "The quick brown fox jumps over the lazy dog, again and again.";
+
+struct Orientation {
+  const char* name;
+  GfxRenderer::Orientation value;
+};
+
+const std::vector<Orientation> kOrientations = {
+    {"Portrait", GfxRenderer::Portrait},
+    {"LandscapeClockwise", GfxRenderer::LandscapeClockwise},
+    {"PortraitInverted", GfxRenderer::PortraitInverted},
+    {"LandscapeCounterClockwise", GfxRenderer::LandscapeCounterClockwise},
+};
+
+struct Benchmark {
+  const char* name;
+  // Draws one iteration and returns the number of logical pixels it visited
+  std::function<long(GfxRenderer&)> run;
+};
+
+double measurePixelsPerSecond(GfxRenderer& renderer, const Benchmark& benchmark, const double minSeconds) {
+  long pixels = 0;
+  const auto start = std::chrono::steady_clock::now();
+  double elapsed = 0.0;
+  do {
+    for (int i = 0; i < 16; i++) {
+      pixels += benchmark.run(renderer);
+    }
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  } while (elapsed < minSeconds);
+  return pixels / elapsed;
+}
+
+long glyphPixels(const EpdFontFamily& font, const char* text) {
+  long pixels = 0;
+  for (const char* c = text; *c; c++) {
+    const EpdGlyph* glyph = font.getGlyph(static_cast<uint8_t>(*c));
+    if (glyph) pixels += glyph->width * glyph->height;
+  }
+  return pixels;
+}
+
+int main(int argc, char* argv[]) {
+  const double minSeconds = argc > 1 ? std::stod(argv[1]) : 0.2;
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+
+  FontDecompressor fontDecompressor;
+  fontDecompressor.init();
+  const EpdFont bookerlyRegular(&bookerly_14_regular);
+  const EpdFontFamily bookerly(&bookerlyRegular);
+  renderer.setFontDecompressor(&fontDecompressor);
+  renderer.insertFont(BENCH_FONT_ID, bookerly);
+
+  const long textPixels = glyphPixels(bookerly, kSampleText);
+
+  // Packed 2-bit image row with all four gray levels
+  std::vector<uint8_t> imageRow(HalDisplay::DISPLAY_WIDTH / 4);
+  for (size_t i = 0; i < imageRow.size(); i++) {
+    imageRow[i] = static_cast<uint8_t>(i * 0x1B + 0x27);
+  }
+
+  const std::vector<Benchmark> benchmarks = {
+      {"drawPixel loop (reference)",
+       [](GfxRenderer& r) {
+         const int w = r.getScreenWidth();
+         const int h = r.getScreenHeight();
+         for (int y = 0; y < h; y++) {
+           for (int x = 0; x < w; x++) {
+             r.drawPixel(x, y, (x ^ y) & 1);
+           }
+         }
+         return static_cast<long>(w) * h;
+       }},
+      {"drawText BW",
+       [textPixels](GfxRenderer& r) {
+         r.setRenderMode(GfxRenderer::BW);
+         for (int line = 0; line < 16; line++) {
+           r.drawText(BENCH_FONT_ID, 4, line * 28, kSampleText);
+         }
+         return textPixels * 16;
+       }},
+      {"drawText GRAYSCALE_MSB",
+       [textPixels](GfxRenderer& r) {
+         r.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+         for (int line = 0; line < 16; line++) {
+           r.drawText(BENCH_FONT_ID, 4, line * 28, kSampleText);
+         }
+         r.setRenderMode(GfxRenderer::BW);
+         return textPixels * 16;
+       }},
+      {"drawTextRotated90CW BW",
+       [textPixels](GfxRenderer& r) {
+         for (int column = 0; column < 16; column++) {
+           r.drawTextRotated90CW(BENCH_FONT_ID, column * 28, r.getScreenHeight() - 4, kSampleText);
+         }
+         return textPixels * 16;
+       }},
+      {"fillRect",
+       [](GfxRenderer& r) {
+         r.fillRect(0, 0, r.getScreenWidth(), r.getScreenHeight(), true);
+         return static_cast<long>(r.getScreenWidth()) * r.getScreenHeight();
+       }},
+      {"fillRectDither LightGray",
+       [](GfxRenderer& r) {
+         r.fillRectDither(0, 0, r.getScreenWidth(), r.getScreenHeight(), LightGray);
+         return static_cast<long>(r.getScreenWidth()) * r.getScreenHeight();
+       }},
+      {"fillRoundedRect DarkGray",
+       [](GfxRenderer& r) {
+         r.fillRoundedRect(10, 10, r.getScreenWidth() - 20, r.getScreenHeight() - 20, 24, DarkGray);
+         return static_cast<long>(r.getScreenWidth() - 20) * (r.getScreenHeight() - 20);
+       }},
+      {"drawPixelRow BW",
+       [&imageRow](GfxRenderer& r) {
+         const int w = r.getScreenWidth();
+         for (int y = 0; y < r.getScreenHeight(); y++) {
+           r.drawPixelRow(imageRow.data(), 0, y, w);
+         }
+         return static_cast<long>(w) * r.getScreenHeight();
+       }},
+  };
+
+  std::cout << std::left << std::setw(30) << "benchmark";
+  for (const auto& orientation : kOrientations) {
+    std::cout << std::right << std::setw(27) << orientation.name;
+  }
+  std::cout << std::endl;
+
+  for (const auto& benchmark : benchmarks) {
+    std::cout << std::left << std::setw(30) << benchmark.name;
+    for (const auto& orientation : kOrientations) {
+      renderer.setOrientation(orientation.value);
+      renderer.clearScreen();
+      const double pixelsPerSecond = measurePixelsPerSecond(renderer, benchmark, minSeconds);
+      std::cout << std::right << std::setw(22) << std::fixed << std::setprecision(1) << pixelsPerSecond / 1e6
+                << " Mpx/s";
+    }
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,46 @@
+// Host stand-in for the Arduino core: just enough for the renderer, fonts and EPUB code to build on Linux.
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+unsigned long millis();
+unsigned long micros();
+inline void delay(unsigned long) {}
+inline void yield() {}
+
+// Heap checks in the EPUB code only guard against exhausting the device heap
+class EspClass {
+ public:
+  uint32_t getFreeHeap() const { return 256 * 1024; }
+  uint32_t getMaxAllocHeap() const { return 128 * 1024; }
+};
+inline EspClass ESP;
+
+class Print {
+ public:
+  virtual ~Print() = default;
+  virtual size_t write(uint8_t b) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) write(buffer[i]);
+    return size;
+  }
+  virtual void flush() {}
+  size_t print(const char* s) { return write(reinterpret_cast<const uint8_t*>(s), strlen(s)); }
+};
+
+class String : public std::string {
+ public:
+  using std::string::string;
+  String(const std::string& s) : std::string(s) {}
+  String(const char* s = "") : std::string(s ? s : "") {}
+  int length() const { return static_cast<int>(size()); }
+};
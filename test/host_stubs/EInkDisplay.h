@@ -0,0 +1,61 @@
+// Host stand-in for the SDK display driver. Keeps the BW frame buffer in RAM and records the grayscale planes and
+// refreshes that the firmware pushes, so host tools can inspect exactly what would reach the panel.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+class EInkDisplay {
+ public:
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH / 8 * DISPLAY_HEIGHT;
+
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  EInkDisplay(int, int, int, int, int, int) { lastCreated = this; }
+
+  void begin() {}
+  void clearScreen(const uint8_t color) const { memset(frameBuffer, color, BUFFER_SIZE); }
+  void drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool fromProgmem) const;
+  void drawImageTransparent(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                            bool fromProgmem) const;
+
+  void displayBuffer(RefreshMode mode, bool turnOffScreen);
+  void refreshDisplay(RefreshMode mode, bool turnOffScreen);
+  void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void deepSleep() {}
+
+  uint8_t* getFrameBuffer() const { return frameBuffer; }
+
+  void copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer);
+  void copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) { memcpy(grayLsb, lsbBuffer, BUFFER_SIZE); }
+  void copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { memcpy(grayMsb, msbBuffer, BUFFER_SIZE); }
+  void cleanupGrayscaleBuffers(const uint8_t*) {}
+  void displayGrayBuffer(bool turnOffScreen);
+
+  // Host inspection. The "displayed" buffer is the frame buffer as of the last displayBuffer/refreshDisplay call.
+  static EInkDisplay* host() { return lastCreated; }
+  const uint8_t* getDisplayedBuffer() const { return displayed; }
+  const uint8_t* getGrayscaleLsbBuffer() const { return grayLsb; }
+  const uint8_t* getGrayscaleMsbBuffer() const { return grayMsb; }
+  int getRefreshCount(RefreshMode mode) const { return refreshCounts[mode]; }
+  int getGrayRefreshCount() const { return grayRefreshCount; }
+  int getWindowRefreshCount() const { return windowRefreshCount; }
+
+  // Panel-native image dumps: the displayed BW buffer as PBM, and the displayed buffer combined with the grayscale
+  // planes (black, dark gray, light gray, white) as PGM, i.e. what the panel shows after the gray pass
+  bool writePbm(const char* path) const;
+  bool writePgm(const char* path) const;
+
+ private:
+  static inline EInkDisplay* lastCreated = nullptr;
+
+  mutable uint8_t frameBuffer[BUFFER_SIZE] = {};
+  uint8_t displayed[BUFFER_SIZE] = {};
+  uint8_t grayLsb[BUFFER_SIZE] = {};
+  uint8_t grayMsb[BUFFER_SIZE] = {};
+  int refreshCounts[3] = {};
+  int grayRefreshCount = 0;
+  int windowRefreshCount = 0;
+};
@@ -0,0 +1,9 @@
+// Host stand-in: pin assignments only, there is no GPIO on the host.
+#pragma once
+
+#define EPD_SCLK 0
+#define EPD_MOSI 0
+#define EPD_CS 0
+#define EPD_DC 0
+#define EPD_RST 0
+#define EPD_BUSY 0
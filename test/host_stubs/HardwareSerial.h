@@ -0,0 +1,13 @@
+// Host stand-in: serial logging goes to stderr.
+#pragma once
+
+#include <Arduino.h>
+
+class HWCDC : public Print {
+ public:
+  void begin(unsigned long) {}
+  operator bool() const { return true; }
+  size_t write(uint8_t b) override { return fputc(b, stderr) == EOF ? 0 : 1; }
+};
+
+extern HWCDC Serial;
@@ -0,0 +1,220 @@
+// Out-of-line parts of the host stand-ins (see Arduino.h, HardwareSerial.h and EInkDisplay.h in this directory).
+#include <Arduino.h>
+#include <EInkDisplay.h>
+#include <HardwareSerial.h>
+#include <SDCardManager.h>
+#include <uzlib.h>
+
+#include <chrono>
+#include <filesystem>
+
+HWCDC Serial;
+
+static const auto hostStart = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - hostStart).count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - hostStart).count();
+}
+
+// Glyph groups are raw DEFLATE streams, so uzlib never verifies a checksum
+extern "C" uint32_t uzlib_adler32(const void*, unsigned int, uint32_t prev_sum) { return prev_sum; }
+extern "C" uint32_t uzlib_crc32(const void*, unsigned int, uint32_t crc) { return crc; }
+
+// Image rows are 1 bit per pixel, MSB first, 1 = white; (x, y, w, h) are panel coordinates
+void EInkDisplay::drawImage(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+                            const uint16_t h, bool) const {
+  const int rowBytes = (w + 7) / 8;
+  for (int row = 0; row < h && y + row < DISPLAY_HEIGHT; row++) {
+    for (int col = 0; col < w && x + col < DISPLAY_WIDTH; col++) {
+      const bool white = imageData[row * rowBytes + col / 8] & (0x80 >> (col % 8));
+      uint8_t& dst = frameBuffer[(y + row) * (DISPLAY_WIDTH / 8) + (x + col) / 8];
+      const uint8_t bit = 0x80 >> ((x + col) % 8);
+      dst = white ? (dst | bit) : (dst & ~bit);
+    }
+  }
+}
+
+void EInkDisplay::drawImageTransparent(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w,
+                                       const uint16_t h, bool) const {
+  const int rowBytes = (w + 7) / 8;
+  for (int row = 0; row < h && y + row < DISPLAY_HEIGHT; row++) {
+    for (int col = 0; col < w && x + col < DISPLAY_WIDTH; col++) {
+      if (!(imageData[row * rowBytes + col / 8] & (0x80 >> (col % 8)))) {
+        frameBuffer[(y + row) * (DISPLAY_WIDTH / 8) + (x + col) / 8] &= ~(0x80 >> ((x + col) % 8));
+      }
+    }
+  }
+}
+
+void EInkDisplay::displayBuffer(const RefreshMode mode, bool) {
+  memcpy(displayed, frameBuffer, BUFFER_SIZE);
+  refreshCounts[mode]++;
+}
+
+void EInkDisplay::refreshDisplay(const RefreshMode mode, bool) {
+  memcpy(displayed, frameBuffer, BUFFER_SIZE);
+  refreshCounts[mode]++;
+}
+
+void EInkDisplay::displayWindow(const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h) {
+  for (uint32_t row = y; row < static_cast<uint32_t>(y + h) && row < DISPLAY_HEIGHT; row++) {
+    const uint32_t offset = row * (DISPLAY_WIDTH / 8) + x / 8;
+    memcpy(displayed + offset, frameBuffer + offset, w / 8);
+  }
+  windowRefreshCount++;
+}
+
+void EInkDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+  copyGrayscaleLsbBuffers(lsbBuffer);
+  copyGrayscaleMsbBuffers(msbBuffer);
+}
+
+void EInkDisplay::displayGrayBuffer(bool) { grayRefreshCount++; }
+
+// The SD card maps 1:1 onto the host filesystem
+std::vector<String> SDCardManager::listFiles(const char* path, const int maxFiles) {
+  std::vector<String> files;
+  std::error_code ec;
+  for (const auto& entry : std::filesystem::directory_iterator(path, ec)) {
+    if (static_cast<int>(files.size()) >= maxFiles) break;
+    files.emplace_back(entry.path().filename().string());
+  }
+  return files;
+}
+
+String SDCardManager::readFile(const char* path) {
+  FsFile file = open(path, O_RDONLY);
+  String content;
+  if (!file) return content;
+  char buffer[256];
+  int n;
+  while ((n = file.read(buffer, sizeof(buffer))) > 0) {
+    content.append(buffer, n);
+  }
+  return content;
+}
+
+bool SDCardManager::readFileToStream(const char* path, Print& out, const size_t chunkSize) {
+  FsFile file = open(path, O_RDONLY);
+  if (!file) return false;
+  std::vector<uint8_t> buffer(chunkSize);
+  int n;
+  while ((n = file.read(buffer.data(), buffer.size())) > 0) {
+    out.write(buffer.data(), n);
+  }
+  return true;
+}
+
+size_t SDCardManager::readFileToBuffer(const char* path, char* buffer, const size_t bufferSize, const size_t maxBytes) {
+  if (bufferSize == 0) return 0;
+  FsFile file = open(path, O_RDONLY);
+  if (!file) {
+    buffer[0] = '\0';
+    return 0;
+  }
+  size_t limit = bufferSize - 1;
+  if (maxBytes > 0 && maxBytes < limit) limit = maxBytes;
+  const int n = file.read(buffer, limit);
+  const size_t bytesRead = n > 0 ? n : 0;
+  buffer[bytesRead] = '\0';
+  return bytesRead;
+}
+
+bool SDCardManager::writeFile(const char* path, const String& content) {
+  FsFile file = open(path, O_WRONLY | O_CREAT | O_TRUNC);
+  return file && file.write(reinterpret_cast<const uint8_t*>(content.data()), content.size()) == content.size();
+}
+
+FsFile SDCardManager::open(const char* path, const oflag_t oflag) {
+  const char* mode = "rb";
+  if (oflag & (O_WRONLY | O_RDWR)) {
+    if (oflag & O_APPEND) {
+      mode = "ab";
+    } else if (oflag & O_TRUNC) {
+      mode = (oflag & O_RDWR) ? "w+b" : "wb";
+    } else {
+      // Create if missing, but keep the contents like SdFat does
+      if (!exists(path)) fclose(fopen(path, "wb"));
+      mode = "r+b";
+    }
+  }
+  return FsFile(fopen(path, mode));
+}
+
+bool SDCardManager::mkdir(const char* path, const bool pFlag) {
+  std::error_code ec;
+  if (pFlag) {
+    std::filesystem::create_directories(path, ec);
+  } else {
+    std::filesystem::create_directory(path, ec);
+  }
+  return std::filesystem::is_directory(path, ec);
+}
+
+bool SDCardManager::exists(const char* path) {
+  std::error_code ec;
+  return std::filesystem::exists(path, ec);
+}
+
+bool SDCardManager::remove(const char* path) {
+  std::error_code ec;
+  return std::filesystem::remove(path, ec);
+}
+
+bool SDCardManager::rmdir(const char* path) { return remove(path); }
+
+bool SDCardManager::removeDir(const char* path) {
+  std::error_code ec;
+  return std::filesystem::remove_all(path, ec) > 0;
+}
+
+bool SDCardManager::openFileForRead(const char*, const char* path, FsFile& file) {
+  file = open(path, O_RDONLY);
+  return static_cast<bool>(file);
+}
+
+bool SDCardManager::openFileForWrite(const char*, const char* path, FsFile& file) {
+  file = open(path, O_RDWR | O_CREAT | O_TRUNC);
+  return static_cast<bool>(file);
+}
+
+bool EInkDisplay::writePbm(const char* path) const {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P4\n%d %d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  // PBM uses 1 = black, the panel uses 0 = black
+  uint8_t row[DISPLAY_WIDTH / 8];
+  for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+    for (int i = 0; i < DISPLAY_WIDTH / 8; i++) {
+      row[i] = ~displayed[y * (DISPLAY_WIDTH / 8) + i];
+    }
+    fwrite(row, 1, sizeof(row), f);
+  }
+  return fclose(f) == 0;
+}
+
+bool EInkDisplay::writePgm(const char* path) const {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P5\n%d %d\n255\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+  uint8_t row[DISPLAY_WIDTH];
+  for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+    for (int x = 0; x < DISPLAY_WIDTH; x++) {
+      const int index = y * (DISPLAY_WIDTH / 8) + x / 8;
+      const uint8_t bit = 0x80 >> (x % 8);
+      const bool msb = grayMsb[index] & bit;
+      const bool lsb = grayLsb[index] & bit;
+      if (msb) {
+        row[x] = lsb ? 85 : 170;
+      } else {
+        row[x] = (displayed[index] & bit) ? 255 : 0;
+      }
+    }
+    fwrite(row, 1, sizeof(row), f);
+  }
+  return fclose(f) == 0;
+}
@@ -0,0 +1,166 @@
+#include <PNGdec.h>
+#include <miniz.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+uint32_t readBigEndian32(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+int channelsForType(const int pixelType) {
+  switch (pixelType) {
+    case PNG_PIXEL_TRUECOLOR:
+      return 3;
+    case PNG_PIXEL_GRAY_ALPHA:
+      return 2;
+    case PNG_PIXEL_TRUECOLOR_ALPHA:
+      return 4;
+    default:
+      return 1;
+  }
+}
+
+uint8_t paeth(const int a, const int b, const int c) {
+  const int p = a + b - c;
+  const int pa = abs(p - a);
+  const int pb = abs(p - b);
+  const int pc = abs(p - c);
+  if (pa <= pb && pa <= pc) return a;
+  return pb <= pc ? b : c;
+}
+}  // namespace
+
+int PNG::open(const char* szFilename, PNG_OPEN_CALLBACK* pfnOpen, PNG_CLOSE_CALLBACK* pfnClose,
+              PNG_READ_CALLBACK* pfnRead, PNG_SEEK_CALLBACK*, PNG_DRAW_CALLBACK* pfnDraw) {
+  file = {};
+  file.fHandle = pfnOpen(szFilename, &file.iSize);
+  if (!file.fHandle) {
+    return PNG_INVALID_FILE;
+  }
+  closeCallback = pfnClose;
+  drawCallback = pfnDraw;
+
+  std::vector<uint8_t> data(file.iSize);
+  if (pfnRead(&file, data.data(), file.iSize) != file.iSize || file.iSize < 8 ||
+      memcmp(data.data(), "\x89PNG\r\n\x1a\n", 8) != 0) {
+    close();
+    return PNG_INVALID_FILE;
+  }
+
+  compressed.clear();
+  memset(palette, 0xFF, sizeof(palette));
+  alpha = 0;
+  size_t pos = 8;
+  while (pos + 12 <= data.size()) {
+    const uint32_t length = readBigEndian32(&data[pos]);
+    const uint8_t* type = &data[pos + 4];
+    const uint8_t* chunk = &data[pos + 8];
+    if (pos + 12 + length > data.size()) break;
+
+    if (memcmp(type, "IHDR", 4) == 0) {
+      width = static_cast<int>(readBigEndian32(chunk));
+      height = static_cast<int>(readBigEndian32(chunk + 4));
+      bitDepth = chunk[8];
+      pixelType = chunk[9];
+      if (chunk[12] != 0) {
+        close();
+        return PNG_UNSUPPORTED_FEATURE;  // Interlaced
+      }
+      alpha = pixelType == PNG_PIXEL_GRAY_ALPHA || pixelType == PNG_PIXEL_TRUECOLOR_ALPHA;
+    } else if (memcmp(type, "PLTE", 4) == 0) {
+      memcpy(palette, chunk, length < 768 ? length : 768);
+    } else if (memcmp(type, "tRNS", 4) == 0 && pixelType == PNG_PIXEL_INDEXED) {
+      memcpy(&palette[768], chunk, length < 256 ? length : 256);
+      alpha = 1;
+    } else if (memcmp(type, "IDAT", 4) == 0) {
+      compressed.insert(compressed.end(), chunk, chunk + length);
+    } else if (memcmp(type, "IEND", 4) == 0) {
+      break;
+    }
+    pos += 12 + length;
+  }
+
+  if (width <= 0 || height <= 0 || compressed.empty()) {
+    close();
+    return PNG_INVALID_FILE;
+  }
+  return PNG_SUCCESS;
+}
+
+int PNG::decode(void* pUser, int) {
+  size_t rawSize = 0;
+  auto* raw = static_cast<uint8_t*>(tinfl_decompress_mem_to_heap(compressed.data(), compressed.size(), &rawSize,
+                                                                 TINFL_FLAG_PARSE_ZLIB_HEADER));
+  if (!raw) {
+    return PNG_DECODE_ERROR;
+  }
+
+  const int bitsPerPixel = channelsForType(pixelType) * bitDepth;
+  const int pitch = (width * bitsPerPixel + 7) / 8;
+  const int filterStride = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+  if (rawSize < static_cast<size_t>(pitch + 1) * height) {
+    free(raw);
+    return PNG_DECODE_ERROR;
+  }
+
+  std::vector<uint8_t> previous(pitch, 0);
+  std::vector<uint8_t> current(pitch);
+  PNGDRAW draw = {};
+  draw.iWidth = width;
+  draw.iPitch = pitch;
+  draw.iPixelType = pixelType;
+  draw.iBpp = bitDepth;
+  draw.iHasAlpha = alpha;
+  draw.pPalette = palette;
+  draw.pUser = pUser;
+
+  int rc = PNG_SUCCESS;
+  for (int y = 0; y < height; y++) {
+    const uint8_t* line = raw + static_cast<size_t>(y) * (pitch + 1);
+    const uint8_t filter = line[0];
+    for (int i = 0; i < pitch; i++) {
+      const uint8_t left = i >= filterStride ? current[i - filterStride] : 0;
+      const uint8_t up = previous[i];
+      const uint8_t upLeft = i >= filterStride ? previous[i - filterStride] : 0;
+      uint8_t predictor = 0;
+      switch (filter) {
+        case 1:
+          predictor = left;
+          break;
+        case 2:
+          predictor = up;
+          break;
+        case 3:
+          predictor = (left + up) / 2;
+          break;
+        case 4:
+          predictor = paeth(left, up, upLeft);
+          break;
+        default:
+          break;
+      }
+      current[i] = line[i + 1] + predictor;
+    }
+
+    draw.y = y;
+    draw.pPixels = current.data();
+    if (!drawCallback(&draw)) {
+      rc = PNG_QUIT_EARLY;
+      break;
+    }
+    previous.swap(current);
+  }
+
+  free(raw);
+  return rc;
+}
+
+void PNG::close() {
+  if (file.fHandle && closeCallback) {
+    closeCallback(file.fHandle);
+  }
+  file.fHandle = nullptr;
+}
@@ -0,0 +1,82 @@
+// Host stand-in for the PNGdec library: same callback API, decoded with miniz. Supports non-interlaced images and
+// hands rows to the draw callback in the PNG's native pixel layout, like PNGdec does.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#ifndef PNG_MAX_BUFFERED_PIXELS
+#define PNG_MAX_BUFFERED_PIXELS ((320 * 4 + 1) * 2)
+#endif
+
+enum {
+  PNG_SUCCESS = 0,
+  PNG_INVALID_PARAMETER,
+  PNG_DECODE_ERROR,
+  PNG_MEM_ERROR,
+  PNG_NO_BUFFER,
+  PNG_UNSUPPORTED_FEATURE,
+  PNG_INVALID_FILE,
+  PNG_TOO_BIG,
+  PNG_QUIT_EARLY
+};
+
+enum {
+  PNG_PIXEL_GRAYSCALE = 0,
+  PNG_PIXEL_TRUECOLOR = 2,
+  PNG_PIXEL_INDEXED = 3,
+  PNG_PIXEL_GRAY_ALPHA = 4,
+  PNG_PIXEL_TRUECOLOR_ALPHA = 6
+};
+
+struct PNGFILE {
+  int32_t iPos;
+  int32_t iSize;
+  uint8_t* pData;
+  void* fHandle;
+};
+
+struct PNGDRAW {
+  int y;
+  int iWidth;
+  int iPitch;
+  int iPixelType;
+  int iBpp;
+  int iHasAlpha;
+  uint8_t* pPixels;
+  uint16_t* pFastPalette;
+  uint8_t* pPalette;
+  void* pUser;
+};
+
+typedef void* PNG_OPEN_CALLBACK(const char* szFilename, int32_t* pFileSize);
+typedef void PNG_CLOSE_CALLBACK(void* pHandle);
+typedef int32_t PNG_READ_CALLBACK(PNGFILE* pFile, uint8_t* pBuf, int32_t iLen);
+typedef int32_t PNG_SEEK_CALLBACK(PNGFILE* pFile, int32_t iPosition);
+typedef int PNG_DRAW_CALLBACK(PNGDRAW* pDraw);
+
+class PNG {
+ public:
+  int open(const char* szFilename, PNG_OPEN_CALLBACK* pfnOpen, PNG_CLOSE_CALLBACK* pfnClose,
+           PNG_READ_CALLBACK* pfnRead, PNG_SEEK_CALLBACK* pfnSeek, PNG_DRAW_CALLBACK* pfnDraw);
+  int decode(void* pUser, int iOptions);
+  void close();
+
+  int getWidth() const { return width; }
+  int getHeight() const { return height; }
+  int getBpp() const { return bitDepth; }
+  int getPixelType() const { return pixelType; }
+  int hasAlpha() const { return alpha; }
+
+ private:
+  PNGFILE file = {};
+  PNG_CLOSE_CALLBACK* closeCallback = nullptr;
+  PNG_DRAW_CALLBACK* drawCallback = nullptr;
+  std::vector<uint8_t> compressed;  // Concatenated IDAT payload
+  uint8_t palette[768 + 256] = {};  // RGB triplets followed by per-index alpha (tRNS)
+  int width = 0;
+  int height = 0;
+  int bitDepth = 0;
+  int pixelType = 0;
+  int alpha = 0;
+};
@@ -0,0 +1,4 @@
+// Host stand-in: Print lives in Arduino.h.
+#pragma once
+
+#include <Arduino.h>
@@ -0,0 +1,102 @@
+// Host stand-in for the SD card layer: FsFile is a thin wrapper over stdio and paths map to the host filesystem.
+#pragma once
+
+#include <Arduino.h>
+
+#include <cstdio>
+#include <vector>
+
+typedef int oflag_t;
+#ifndef O_RDONLY
+#define O_RDONLY 0x00
+#define O_WRONLY 0x01
+#define O_RDWR 0x02
+#define O_CREAT 0x40
+#define O_TRUNC 0x200
+#define O_APPEND 0x400
+#endif
+#define O_READ O_RDONLY
+#define O_WRITE O_WRONLY
+
+class FsFile : public Print {
+ public:
+  FsFile() = default;
+  explicit FsFile(FILE* f) : f(f) {}
+  FsFile(FsFile&& other) noexcept : f(other.f) { other.f = nullptr; }
+  FsFile& operator=(FsFile&& other) noexcept {
+    if (this != &other) {
+      close();
+      f = other.f;
+      other.f = nullptr;
+    }
+    return *this;
+  }
+  FsFile(const FsFile&) = delete;
+  FsFile& operator=(const FsFile&) = delete;
+  ~FsFile() override { close(); }
+
+  explicit operator bool() const { return f != nullptr; }
+  bool isOpen() const { return f != nullptr; }
+
+  int read() { return f ? fgetc(f) : -1; }
+  int read(void* buf, const size_t n) { return f ? static_cast<int>(fread(buf, 1, n, f)) : -1; }
+  size_t write(const uint8_t b) override { return f && fputc(b, f) != EOF ? 1 : 0; }
+  size_t write(const uint8_t* buf, const size_t n) override { return f ? fwrite(buf, 1, n, f) : 0; }
+  size_t write(const void* buf, const size_t n) { return write(static_cast<const uint8_t*>(buf), n); }
+  void flush() override {
+    if (f) fflush(f);
+  }
+
+  bool seek(const uint32_t pos) { return f && fseek(f, pos, SEEK_SET) == 0; }
+  bool seekSet(const uint32_t pos) { return seek(pos); }
+  bool seekCur(const int32_t offset) { return f && fseek(f, offset, SEEK_CUR) == 0; }
+  uint32_t position() const { return f ? static_cast<uint32_t>(ftell(f)) : 0; }
+  uint32_t size() const {
+    if (!f) return 0;
+    const long pos = ftell(f);
+    fseek(f, 0, SEEK_END);
+    const long end = ftell(f);
+    fseek(f, pos, SEEK_SET);
+    return static_cast<uint32_t>(end);
+  }
+  uint32_t fileSize() const { return size(); }
+  int available() const { return static_cast<int>(size() - position()); }
+
+  void close() {
+    if (f) fclose(f);
+    f = nullptr;
+  }
+
+ private:
+  FILE* f = nullptr;
+};
+
+class SDCardManager {
+ public:
+  static SDCardManager& getInstance() {
+    static SDCardManager instance;
+    return instance;
+  }
+
+  bool begin() { return true; }
+  bool ready() const { return true; }
+  std::vector<String> listFiles(const char* path, int maxFiles);
+  String readFile(const char* path);
+  bool readFileToStream(const char* path, Print& out, size_t chunkSize);
+  size_t readFileToBuffer(const char* path, char* buffer, size_t bufferSize, size_t maxBytes);
+  bool writeFile(const char* path, const String& content);
+  bool ensureDirectoryExists(const char* path) { return mkdir(path, true); }
+
+  FsFile open(const char* path, oflag_t oflag);
+  bool mkdir(const char* path, bool pFlag);
+  bool exists(const char* path);
+  bool remove(const char* path);
+  bool rmdir(const char* path);
+  bool removeDir(const char* path);
+
+  bool openFileForRead(const char* moduleName, const char* path, FsFile& file);
+  bool openFileForWrite(const char* moduleName, const char* path, FsFile& file);
+
+  uint64_t cardSizeBytes() { return 0; }
+  uint64_t freeSpaceBytes() { return 0; }
+};
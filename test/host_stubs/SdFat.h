@@ -0,0 +1,4 @@
+// Host stand-in: FsFile lives in SDCardManager.h.
+#pragma once
+
+#include <SDCardManager.h>
@@ -2,10 +2,14 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <functional>
+#include <iomanip>
 #include <iostream>
+#include <new>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -14,6 +18,20 @@
 #include "lib/Epub/Epub/hyphenation/LanguageHyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageRegistry.h"
 
+// Counts heap allocations, so the throughput pass can check that evaluating a word does not allocate
+size_t gAllocationCount = 0;
+
+void* operator new(const size_t size) {
+  ++gAllocationCount;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
 struct TestCase {
   std::string word;
   std::string hyphenated;
@@ -129,10 +147,50 @@ std::string positionsToHyphenated(const std::string& word, const std::vector<siz
 }
 
 std::vector<size_t> hyphenateWordWithHyphenator(const std::string& word, const LanguageHyphenator& hyphenator) {
-  auto cps = collectCodepoints(word);
+  WordCodepoints cps;
+  collectCodepoints(word.data(), word.size(), cps);
   trimSurroundingPunctuationAndFootnote(cps);
 
-  return hyphenator.breakIndexes(cps);
+  uint8_t indexes[kMaxHyphenationWordBytes];
+  const size_t count = hyphenator.breakIndexes(cps.data(), cps.size(), indexes);
+  return std::vector<size_t>(indexes, indexes + count);
+}
+
+struct Throughput {
+  double wordsPerSecond = 0.0;
+  double allocationsPerWord = 0.0;
+};
+
+// Times the path the reader takes for every word: codepoints, trimming and Liang breaks into stack buffers
+Throughput measureThroughput(const std::vector<TestCase>& testCases, const LanguageHyphenator& hyphenator) {
+  constexpr double kMinSeconds = 0.2;
+  size_t words = 0;
+  size_t breaks = 0;
+  const size_t allocationsBefore = gAllocationCount;
+  const auto start = std::chrono::steady_clock::now();
+  double elapsed = 0.0;
+  do {
+    for (const auto& testCase : testCases) {
+      WordCodepoints cps;
+      collectCodepoints(testCase.word.data(), testCase.word.size(), cps);
+      trimSurroundingPunctuationAndFootnote(cps);
+      uint8_t indexes[kMaxHyphenationWordBytes];
+      breaks += hyphenator.breakIndexes(cps.data(), cps.size(), indexes);
+    }
+    words += testCases.size();
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  } while (elapsed < kMinSeconds);
+  const size_t allocations = gAllocationCount - allocationsBefore;
+
+  // Keeps the break counts observable so the loop is not optimized away
+  if (breaks == 0) {
+    std::cerr << "No breaks found" << std::endl;
+  }
+
+  Throughput result;
+  result.wordsPerSecond = words / elapsed;
+  result.allocationsPerWord = static_cast<double>(allocations) / words;
+  return result;
 }
 
 std::vector<LanguageConfig> resolveLanguages(const std::string& selection) {
@@ -214,7 +272,7 @@ EvaluationResult evaluateWord(const TestCase& testCase,
 void printResults(const std::string& language, const std::vector<TestCase>& testCases,
                   const std::vector<std::pair<TestCase, EvaluationResult>>& worstCases, int perfectMatches,
                   int partialMatches, int completeMisses, double totalPrecision, double totalRecall, double totalF1,
-                  double totalWeighted, int totalTP, int totalFP, int totalFN,
+                  double totalWeighted, int totalTP, int totalFP, int totalFN, const Throughput& throughput,
                   std::function<std::vector<size_t>(const std::string&)> hyphenateFunc) {
   std::string lang_upper = language;
   if (!lang_upper.empty()) {
@@ -257,6 +315,11 @@ void printResults(const std::string& language, const std::vector<TestCase>& test
   std::cout << "Overall F1 Score:        " << (overallF1 * 100.0) << "%" << std::endl;
   std::cout << std::endl;
 
+  std::cout << "--- Throughput ---" << std::endl;
+  std::cout << "Words per second:        " << static_cast<uint64_t>(throughput.wordsPerSecond) << std::endl;
+  std::cout << "Allocations per word:    " << throughput.allocationsPerWord << std::endl;
+  std::cout << std::endl;
+
   // Filter out perfect matches from the “worst cases” section so that only actionable failures appear.
   auto hasImperfection = [](const EvaluationResult& r) { return r.weightedScore < 0.999999; };
   std::vector<std::pair<TestCase, EvaluationResult>> imperfectCases;
@@ -373,9 +436,13 @@ int main(int argc, char* argv[]) {
       worstCases.push_back({testCase, result});
     }
 
+    const Throughput throughput = measureThroughput(testCases, *hyphenator);
+
     if (summaryMode) {
       const double averageF1Percent = testCases.empty() ? 0.0 : (totalF1 / testCases.size() * 100.0);
-      std::cout << lang.cliName << ": " << averageF1Percent << "%" << std::endl;
+      std::cout << lang.cliName << ": " << averageF1Percent << "%  ("
+                << static_cast<uint64_t>(throughput.wordsPerSecond) << " words/s, " << throughput.allocationsPerWord
+                << " allocations/word)" << std::endl;
       continue;
     }
 
@@ -383,7 +450,7 @@ int main(int argc, char* argv[]) {
               [](const auto& a, const auto& b) { return a.second.weightedScore < b.second.weightedScore; });
 
     printResults(lang.cliName, testCases, worstCases, perfectMatches, partialMatches, completeMisses, totalPrecision,
-                 totalRecall, totalF1, totalWeighted, totalTP, totalFP, totalFN, hyphenateFunc);
+                 totalRecall, totalF1, totalWeighted, totalTP, totalFP, totalFN, throughput, hyphenateFunc);
   }
 
   return 0;
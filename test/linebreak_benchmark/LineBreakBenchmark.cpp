@@ -0,0 +1,205 @@
+#include <EpdFontFamily.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/ParsedText.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+
+// Host benchmark for ParsedText line breaking. Paragraphs are sampled from the hyphenation evaluation word lists by
+// frequency and broken by each breaker at the portrait and landscape reader widths. Besides lines per second it
+// reports badness as the mean squared slack of the lines that are not the last of their paragraph, with the text
+// left-aligned so that slack is the space left at the end of the line.
+
+constexpr int BENCH_FONT_ID = 1;
+constexpr int PARAGRAPHS_PER_LANGUAGE = 150;
+constexpr uint32_t SAMPLE_SEED = 20240601;
+
+struct Language {
+  const char* name;
+  const char* tag;
+  const char* wordList;
+};
+
+const std::vector<Language> kLanguages = {
+    {"english", "en", "test/hyphenation_eval/resources/english_hyphenation_tests.txt"},
+    {"german", "de", "test/hyphenation_eval/resources/german_hyphenation_tests.txt"},
+    {"russian", "ru", "test/hyphenation_eval/resources/russian_hyphenation_tests.txt"},
+};
+
+struct Breaker {
+  const char* name;
+  bool hyphenation;
+  ParsedText::HyphenatedBreaking breaking;
+};
+
+const std::vector<Breaker> kBreakers = {
+    {"dp, no hyphenation", false, ParsedText::HyphenatedBreaking::TotalFit},
+    {"greedy hyphenation", true, ParsedText::HyphenatedBreaking::Greedy},
+    {"total-fit hyphenation", true, ParsedText::HyphenatedBreaking::TotalFit},
+};
+
+struct WeightedWord {
+  std::string word;
+  uint64_t cumulativeFrequency;
+};
+
+std::vector<WeightedWord> loadWordList(const std::string& path) {
+  std::ifstream file(path);
+  std::vector<WeightedWord> words;
+  uint64_t total = 0;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    std::istringstream iss(line);
+    std::string word;
+    std::string hyphenated;
+    std::string frequency;
+    if (std::getline(iss, word, '|') && std::getline(iss, hyphenated, '|') && std::getline(iss, frequency, '|')) {
+      total += std::max(1, std::stoi(frequency));
+      words.push_back({word, total});
+    }
+  }
+  return words;
+}
+
+// Deterministic prose-like paragraphs: frequency-weighted words with some trailing punctuation
+std::vector<std::vector<std::string>> sampleParagraphs(const std::vector<WeightedWord>& words) {
+  std::mt19937 rng(SAMPLE_SEED);
+  const uint64_t total = words.back().cumulativeFrequency;
+  std::vector<std::vector<std::string>> paragraphs(PARAGRAPHS_PER_LANGUAGE);
+  for (auto& paragraph : paragraphs) {
+    const size_t length = 20 + rng() % 180;
+    for (size_t i = 0; i < length; i++) {
+      const uint64_t pick = (static_cast<uint64_t>(rng()) << 32 | rng()) % total;
+      const auto below = [](const uint64_t value, const WeightedWord& w) { return value < w.cumulativeFrequency; };
+      auto it = std::upper_bound(words.begin(), words.end(), pick, below);
+      std::string word = it->word;
+      const uint32_t punctuation = rng() % 100;
+      if (punctuation < 8) {
+        word += ',';
+      } else if (punctuation < 13) {
+        word += '.';
+      }
+      paragraph.push_back(std::move(word));
+    }
+  }
+  return paragraphs;
+}
+
+struct Result {
+  double linesPerSecond = 0.0;
+  uint64_t lines = 0;
+  double meanSquaredSlack = 0.0;
+  int worstSlack = 0;
+  double hyphenatedPercent = 0.0;
+};
+
+Result measure(const GfxRenderer& renderer, const std::vector<std::vector<std::string>>& paragraphs,
+               const Breaker& breaker, const uint16_t width, const double minSeconds) {
+  const FontHandle font = renderer.getFont(BENCH_FONT_ID);
+  BlockStyle blockStyle;
+  blockStyle.alignment = CssTextAlign::Left;
+
+  Result result;
+  uint64_t lines = 0;
+  bool scored = false;
+  const auto start = std::chrono::steady_clock::now();
+  double elapsed = 0.0;
+  do {
+    for (const auto& paragraph : paragraphs) {
+      ParsedText text(false, breaker.hyphenation, blockStyle);
+      text.setHyphenatedBreaking(breaker.breaking);
+      for (const auto& word : paragraph) {
+        text.addWord(word.c_str(), EpdFontFamily::REGULAR);
+      }
+      std::vector<std::shared_ptr<TextBlock>> blocks;
+      text.layoutAndExtractLines(renderer, font, width,
+                                 [&blocks](const std::shared_ptr<TextBlock>& block) { blocks.push_back(block); });
+      lines += blocks.size();
+
+      if (scored) continue;
+      // Score the first pass only; the layout is the same every time
+      result.lines += blocks.size();
+      for (size_t i = 0; i + 1 < blocks.size(); i++) {
+        const TextBlock& block = *blocks[i];
+        const uint16_t last = block.getWordCount() - 1;
+        const char* lastWord = block.getWord(last);
+        const int end = block.getWordXpos(last) + renderer.getTextAdvanceX(font, lastWord, block.getWordStyle(last));
+        const int slack = width - end;
+        result.meanSquaredSlack += static_cast<double>(slack) * slack;
+        result.worstSlack = std::max(result.worstSlack, slack);
+        const size_t length = strlen(lastWord);
+        if (length > 1 && lastWord[length - 1] == '-') {
+          result.hyphenatedPercent += 1.0;
+        }
+      }
+    }
+    if (!scored) {
+      const uint64_t scoredLines = result.lines - paragraphs.size();
+      result.meanSquaredSlack /= static_cast<double>(scoredLines);
+      result.hyphenatedPercent = 100.0 * result.hyphenatedPercent / static_cast<double>(scoredLines);
+      scored = true;
+    }
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  } while (elapsed < minSeconds);
+  result.linesPerSecond = lines / elapsed;
+  return result;
+}
+
+int main(int argc, char* argv[]) {
+  const double minSeconds = argc > 1 ? std::stod(argv[1]) : 0.5;
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  renderer.begin();
+
+  FontDecompressor fontDecompressor;
+  fontDecompressor.init();
+  const EpdFont bookerlyRegular(&bookerly_14_regular);
+  const EpdFontFamily bookerly(&bookerlyRegular);
+  renderer.setFontDecompressor(&fontDecompressor);
+  renderer.insertFont(BENCH_FONT_ID, bookerly);
+
+  // Reader text widths with the default margins
+  const std::vector<std::pair<const char*, uint16_t>> widths = {{"portrait", 440}, {"landscape", 760}};
+
+  std::cout << std::left << std::setw(10) << "language" << std::setw(11) << "width" << std::setw(24) << "breaker"
+            << std::right << std::setw(12) << "lines/s" << std::setw(8) << "lines" << std::setw(13) << "mean slack^2"
+            << std::setw(12) << "worst slack" << std::setw(12) << "hyphen %" << "\n";
+  for (const auto& language : kLanguages) {
+    const auto words = loadWordList(language.wordList);
+    if (words.empty()) {
+      std::cerr << "Cannot read " << language.wordList << "\n";
+      return 1;
+    }
+    const auto paragraphs = sampleParagraphs(words);
+    Hyphenator::setPreferredLanguage(language.tag);
+
+    for (const auto& [widthName, width] : widths) {
+      for (const auto& breaker : kBreakers) {
+        const Result result = measure(renderer, paragraphs, breaker, width, minSeconds);
+        std::cout << std::left << std::setw(10) << language.name << std::setw(11) << widthName << std::setw(24)
+                  << breaker.name << std::right << std::fixed << std::setprecision(0) << std::setw(12)
+                  << result.linesPerSecond << std::setw(8) << result.lines << std::setw(13) << result.meanSquaredSlack
+                  << std::setw(12) << result.worstSlack << std::setprecision(1) << std::setw(12)
+                  << result.hyphenatedPercent << "\n";
+      }
+    }
+  }
+  return 0;
+}
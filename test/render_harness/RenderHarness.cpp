@@ -0,0 +1,436 @@
+#include <EInkDisplay.h>
+#include <EpdFontFamily.h>
+#include <EpdFontPack.h>
+#include <Epub.h>
+#include <Epub/Page.h>
+#include <Epub/Section.h>
+#include <FontDecompressor.h>
+#include <GfxRenderer.h>
+#include <HalDisplay.h>
+#include <RefreshScheduler.h>
+#include <builtinFonts/bookerly_14_bold.h>
+#include <builtinFonts/bookerly_14_bolditalic.h>
+#include <builtinFonts/bookerly_14_italic.h>
+#include <builtinFonts/bookerly_14_regular.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Host render harness: lays out every chapter of the given EPUBs with the reader's default settings, renders each page
+// through the same BW + grayscale passes as EpubReaderActivity::renderContents, and compares a hash of what reached
+// the panel (BW frame buffer and both grayscale planes) against a golden manifest. Timing is reported per book as
+// milliseconds per page for each render mode, along with the refreshes RefreshScheduler picked for the pages in
+// reading order.
+
+namespace fs = std::filesystem;
+
+namespace {
+constexpr int READER_FONT_ID = 1;
+
+// Reader defaults (see CrossPointSettings): Bookerly 14, normal spacing, justified, extra paragraph spacing
+constexpr int MARGIN_TOP = 9;
+constexpr int MARGIN_SIDE = 5;
+constexpr int MARGIN_BOTTOM = 24;  // Room for the status bar, which the harness does not draw
+constexpr float LINE_COMPRESSION = 1.0f;
+constexpr bool EXTRA_PARAGRAPH_SPACING = true;
+constexpr uint8_t PARAGRAPH_ALIGNMENT = 0;  // Justified
+constexpr bool EMBEDDED_STYLE = true;
+constexpr int REFRESH_FREQUENCY = 15;
+constexpr int REPAGINATE_EXTRA_HEIGHT = 120;
+
+struct Options {
+  std::vector<std::string> epubs;
+  std::string goldenPath;
+  std::string outDir;
+  std::string fontPackDir;
+  GfxRenderer::Orientation orientation = GfxRenderer::Portrait;
+  bool hyphenation = false;
+  bool update = false;
+  bool dumpAll = false;
+  bool repaginate = false;
+  int repeat = 1;
+};
+
+struct PassTimes {
+  double bw = 0;
+  double grayLsb = 0;
+  double grayMsb = 0;
+};
+
+struct BookResult {
+  int pages = 0;
+  int grayPages = 0;  // Pages the BW pass reported gray content for
+  int mismatches = 0;
+  double layoutMs = 0;
+  PassTimes renderMs;
+  int refreshes[3] = {};  // Pages per HalDisplay::RefreshMode
+};
+
+double elapsedMs(const std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 64-bit FNV-1a, chained over the buffers of one page
+uint64_t fnv1a(const uint8_t* data, const size_t size, uint64_t hash = 0xcbf29ce484222325ULL) {
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+std::string hex(const uint64_t value) {
+  std::ostringstream out;
+  out << std::hex << std::setw(16) << std::setfill('0') << value;
+  return out.str();
+}
+
+std::map<std::string, std::string> readGolden(const std::string& path) {
+  std::map<std::string, std::string> golden;
+  std::ifstream in(path);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#') continue;
+    const size_t split = line.rfind(' ');
+    if (split != std::string::npos) {
+      golden[line.substr(0, split)] = line.substr(split + 1);
+    }
+  }
+  return golden;
+}
+
+bool writeGolden(const std::string& path, const std::map<std::string, std::string>& golden) {
+  std::ofstream out(path);
+  out << "# <book> <spine index> <page> <FNV-1a of BW buffer + LSB plane + MSB plane>\n";
+  out << "# Regenerate with: test/run_render_harness.sh --update\n";
+  for (const auto& [key, hash] : golden) {
+    out << key << " " << hash << "\n";
+  }
+  return static_cast<bool>(out);
+}
+
+bool frameBufferEmpty(const GfxRenderer& renderer) {
+  const uint8_t* buffer = renderer.getFrameBuffer();
+  return std::all_of(buffer, buffer + HalDisplay::BUFFER_SIZE, [](const uint8_t b) { return b == 0; });
+}
+
+// Mirrors EpubReaderActivity::renderContents: BW pass shown first with the refresh the scheduler picks (with
+// ENABLE_WINDOWED_IMAGE_REFRESH, image pages show the text with a fast refresh, then the images through a windowed
+// refresh), then the LSB and MSB grayscale passes, then the BW buffer is restored. The grayscale passes always run so
+// every page is hashed the same way; instead the harness checks that the BW pass reports gray content exactly for the
+// pages that leave a grayscale plane non-empty, so the reader skips the passes for every page without gray. Returns
+// false otherwise.
+bool renderPage(GfxRenderer& renderer, const Page& page, const int marginLeft, const int marginTop,
+                RefreshScheduler& scheduler, PassTimes& times, bool& grayContent, HalDisplay::RefreshMode& refresh) {
+  auto start = std::chrono::steady_clock::now();
+  renderer.clearScreen();
+  renderer.resetGrayContent();
+#ifdef ENABLE_WINDOWED_IMAGE_REFRESH
+  int16_t imgX, imgY, imgW, imgH;
+  if (page.getImageBoundingBox(imgX, imgY, imgW, imgH)) {
+    page.renderText(renderer, READER_FONT_ID, marginLeft, marginTop);
+    refresh = HalDisplay::FAST_REFRESH;
+    renderer.displayBuffer(refresh);
+    scheduler.record(renderer.getFrameBuffer(), refresh);
+    page.renderImages(renderer, marginLeft, marginTop);
+    renderer.displayWindow(imgX + marginLeft, imgY + marginTop, imgW, imgH);
+    scheduler.record(renderer.getFrameBuffer(), HalDisplay::FAST_REFRESH);
+  } else
+#endif
+  {
+    page.render(renderer, READER_FONT_ID, marginLeft, marginTop);
+    refresh = scheduler.next(renderer.getFrameBuffer(), REFRESH_FREQUENCY);
+    renderer.displayBuffer(refresh);
+  }
+  times.bw += elapsedMs(start);
+  grayContent = renderer.hasGrayContent();
+  bool planesEmpty = true;
+  renderer.storeBwBuffer();
+
+  start = std::chrono::steady_clock::now();
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  page.render(renderer, READER_FONT_ID, marginLeft, marginTop);
+  times.grayLsb += elapsedMs(start);
+  planesEmpty = planesEmpty && frameBufferEmpty(renderer);
+  renderer.copyGrayscaleLsbBuffers();
+
+  start = std::chrono::steady_clock::now();
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  page.render(renderer, READER_FONT_ID, marginLeft, marginTop);
+  times.grayMsb += elapsedMs(start);
+  planesEmpty = planesEmpty && frameBufferEmpty(renderer);
+  renderer.copyGrayscaleMsbBuffers();
+
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
+  renderer.restoreBwBuffer();
+  return grayContent != planesEmpty;
+}
+
+// Draws one line of text through the BW and both grayscale passes and sets grayContent to what the BW pass reported.
+// Returns false if that does not match what the grayscale passes drew.
+bool renderTextLine(GfxRenderer& renderer, const char* text, bool& grayContent) {
+  renderer.clearScreen();
+  renderer.resetGrayContent();
+  renderer.drawText(READER_FONT_ID, MARGIN_SIDE, MARGIN_TOP + 40, text);
+  grayContent = renderer.hasGrayContent();
+
+  bool planesEmpty = true;
+  for (const auto mode : {GfxRenderer::GRAYSCALE_LSB, GfxRenderer::GRAYSCALE_MSB}) {
+    renderer.clearScreen(0x00);
+    renderer.setRenderMode(mode);
+    renderer.drawText(READER_FONT_ID, MARGIN_SIDE, MARGIN_TOP + 40, text);
+    planesEmpty = planesEmpty && frameBufferEmpty(renderer);
+  }
+  renderer.setRenderMode(GfxRenderer::BW);
+  renderer.clearFontCache();
+  return grayContent != planesEmpty;
+}
+
+// The minus and not signs are the only regular Bookerly 14 glyphs without anti-aliased edges, so a line of them is
+// plain BW text: the BW pass must report no gray for it, or the reader would run the grayscale passes for nothing. A
+// line of ordinary text must report gray.
+bool checkGrayDetection(GfxRenderer& renderer) {
+  bool grayContent = false;
+  if (!renderTextLine(renderer, "\u2212 \u00AC \u2212\u2212 \u00AC", grayContent) || grayContent) {
+    std::cerr << "A line of BW-only glyphs is reported as gray content" << std::endl;
+    return false;
+  }
+  if (!renderTextLine(renderer, "Anti-aliased text", grayContent) || !grayContent) {
+    std::cerr << "A line of anti-aliased text is not reported as gray content" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+BookResult runBook(GfxRenderer& renderer, const Options& options, const std::string& epubPath,
+                   const std::string& cacheDir, std::map<std::string, std::string>& golden) {
+  BookResult result;
+  const std::string bookName = fs::path(epubPath).filename().string();
+
+  auto epub = std::make_shared<Epub>(fs::absolute(epubPath).string(), cacheDir);
+  epub->clearCache();
+  if (!epub->load(true)) {
+    std::cerr << bookName << ": failed to load" << std::endl;
+    result.mismatches++;
+    return result;
+  }
+
+  const int viewportWidth = renderer.getScreenWidth() - 2 * MARGIN_SIDE;
+  const int viewportHeight = renderer.getScreenHeight() - MARGIN_TOP - MARGIN_BOTTOM;
+  EInkDisplay* display = EInkDisplay::host();
+  RefreshScheduler scheduler;
+
+  for (int spineIndex = 0; spineIndex < epub->getSpineItemsCount(); spineIndex++) {
+    Section section(epub, spineIndex, renderer);
+    if (options.repaginate) {
+      // Lay the section out for a taller viewport first, so its pages come from paginating the line stream again
+      Section taller(epub, spineIndex, renderer);
+      taller.createSectionFile(READER_FONT_ID, LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, PARAGRAPH_ALIGNMENT,
+                               viewportWidth, viewportHeight + REPAGINATE_EXTRA_HEIGHT, options.hyphenation,
+                               EMBEDDED_STYLE);
+    }
+    const auto layoutStart = std::chrono::steady_clock::now();
+    if (!section.createSectionFile(READER_FONT_ID, LINE_COMPRESSION, EXTRA_PARAGRAPH_SPACING, PARAGRAPH_ALIGNMENT,
+                                   viewportWidth, viewportHeight, options.hyphenation, EMBEDDED_STYLE)) {
+      std::cerr << bookName << ": failed to lay out spine item " << spineIndex << std::endl;
+      result.mismatches++;
+      continue;
+    }
+    result.layoutMs += elapsedMs(layoutStart);
+
+    for (int pageIndex = 0; pageIndex < section.pageCount; pageIndex++) {
+      section.currentPage = pageIndex;
+      const auto page = section.loadPageFromSectionFile();
+      if (!page) {
+        std::cerr << bookName << ": failed to load page " << spineIndex << "/" << pageIndex << std::endl;
+        result.mismatches++;
+        continue;
+      }
+
+      // The first render is the one compared: later ones draw images from their pixel cache, like a revisited page
+      bool grayContent = false;
+      HalDisplay::RefreshMode refresh;
+      if (!renderPage(renderer, *page, MARGIN_SIDE, MARGIN_TOP, scheduler, result.renderMs, grayContent, refresh)) {
+        std::cerr << bookName << ": page " << spineIndex << "/" << pageIndex
+                  << (grayContent ? " is reported as gray but draws no gray pixels"
+                                  : " has gray pixels the BW pass did not report")
+                  << std::endl;
+        result.mismatches++;
+      }
+      renderer.clearFontCache();
+      result.pages++;
+      result.grayPages += grayContent ? 1 : 0;
+      result.refreshes[refresh]++;
+
+      uint64_t hash = fnv1a(display->getDisplayedBuffer(), EInkDisplay::BUFFER_SIZE);
+      hash = fnv1a(display->getGrayscaleLsbBuffer(), EInkDisplay::BUFFER_SIZE, hash);
+      hash = fnv1a(display->getGrayscaleMsbBuffer(), EInkDisplay::BUFFER_SIZE, hash);
+
+      const std::string key = bookName + " " + std::to_string(spineIndex) + " " + std::to_string(pageIndex);
+      bool dump = options.dumpAll;
+      if (options.update) {
+        golden[key] = hex(hash);
+      } else if (golden.count(key) == 0 || golden[key] != hex(hash)) {
+        std::cerr << bookName << ": page " << spineIndex << "/" << pageIndex
+                  << (golden.count(key) ? " differs from golden" : " has no golden") << std::endl;
+        result.mismatches++;
+        dump = true;
+      }
+
+      if (dump) {
+        const std::string base =
+            options.outDir + "/" + fs::path(bookName).stem().string() + "_" + std::to_string(spineIndex) + "_" +
+            std::to_string(pageIndex);
+        display->writePbm((base + ".pbm").c_str());
+        display->writePgm((base + ".pgm").c_str());
+      }
+
+      for (int i = 1; i < options.repeat; i++) {
+        RefreshScheduler repeatScheduler;
+        renderPage(renderer, *page, MARGIN_SIDE, MARGIN_TOP, repeatScheduler, result.renderMs, grayContent, refresh);
+        renderer.clearFontCache();
+      }
+    }
+  }
+  return result;
+}
+
+void printUsage(const char* argv0) {
+  std::cerr << "Usage: " << argv0 << " [options] <book.epub>...\n"
+            << "  --golden FILE       golden manifest (required)\n"
+            << "  --out DIR           where page images and the book cache are written (default: .)\n"
+            << "  --update            rewrite the golden manifest instead of comparing\n"
+            << "  --dump              write PBM/PGM images for every page, not only for mismatches\n"
+            << "  --landscape         render in LandscapeCounterClockwise instead of Portrait\n"
+            << "  --hyphenation       enable hyphenation during layout\n"
+            << "  --font-packs DIR    load bookerly_14_<style>.epdfont from DIR instead of the built-in font\n"
+            << "  --repeat N          render every page N times for steadier timings\n"
+            << "  --repaginate        build each section from a line stream laid out for a taller viewport\n";
+}
+
+bool parseOptions(const int argc, char* argv[], Options& options) {
+  options.outDir = ".";
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--golden" && i + 1 < argc) {
+      options.goldenPath = argv[++i];
+    } else if (arg == "--out" && i + 1 < argc) {
+      options.outDir = argv[++i];
+    } else if (arg == "--update") {
+      options.update = true;
+    } else if (arg == "--dump") {
+      options.dumpAll = true;
+    } else if (arg == "--landscape") {
+      options.orientation = GfxRenderer::LandscapeCounterClockwise;
+    } else if (arg == "--font-packs" && i + 1 < argc) {
+      options.fontPackDir = argv[++i];
+    } else if (arg == "--hyphenation") {
+      options.hyphenation = true;
+    } else if (arg == "--repaginate") {
+      options.repaginate = true;
+    } else if (arg == "--repeat" && i + 1 < argc) {
+      options.repeat = std::max(1, std::stoi(argv[++i]));
+    } else if (!arg.empty() && arg[0] == '-') {
+      return false;
+    } else {
+      options.epubs.push_back(arg);
+    }
+  }
+  return !options.epubs.empty() && !options.goldenPath.empty();
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return 2;
+  }
+  fs::create_directories(options.outDir);
+  const std::string cacheDir = fs::absolute(options.outDir).string() + "/cache";
+  fs::create_directories(cacheDir);
+
+  HalDisplay display;
+  GfxRenderer renderer(display);
+  display.begin();
+  renderer.begin();
+  renderer.setOrientation(options.orientation);
+
+  FontDecompressor fontDecompressor;
+  fontDecompressor.init();
+  renderer.setFontDecompressor(&fontDecompressor);
+  // Font packs carry the same glyph data as the built-in headers, so pages must match the same goldens
+  const EpdFontData* styles[] = {&bookerly_14_regular, &bookerly_14_bold, &bookerly_14_italic,
+                                 &bookerly_14_bolditalic};
+  EpdFontPack packs[4];
+  if (!options.fontPackDir.empty()) {
+    const char* const styleNames[] = {"regular", "bold", "italic", "bolditalic"};
+    for (int i = 0; i < 4; i++) {
+      const std::string path = options.fontPackDir + "/bookerly_14_" + styleNames[i] + ".epdfont";
+      if (!packs[i].load(path.c_str())) {
+        std::cerr << "Failed to load font pack " << path << std::endl;
+        return 1;
+      }
+      styles[i] = packs[i].getData();
+    }
+  }
+  const EpdFont regular(styles[0]);
+  const EpdFont bold(styles[1]);
+  const EpdFont italic(styles[2]);
+  const EpdFont boldItalic(styles[3]);
+  const EpdFontFamily bookerly(&regular, &bold, &italic, &boldItalic);
+  renderer.insertFont(READER_FONT_ID, bookerly);
+
+  std::map<std::string, std::string> golden = options.update ? std::map<std::string, std::string>{}
+                                                             : readGolden(options.goldenPath);
+
+  std::cout << std::left << std::setw(28) << "book" << std::right << std::setw(7) << "pages" << std::setw(12)
+            << "layout ms" << std::setw(12) << "BW ms/pg" << std::setw(12) << "LSB ms/pg" << std::setw(12)
+            << "MSB ms/pg" << std::setw(12) << "total ms/pg" << std::setw(12) << "gray pages" << std::setw(16)
+            << "half/full refr" << std::setw(12) << "fixed half" << std::endl;
+
+  int mismatches = checkGrayDetection(renderer) ? 0 : 1;
+  for (const auto& epubPath : options.epubs) {
+    const BookResult result = runBook(renderer, options, epubPath, cacheDir, golden);
+    mismatches += result.mismatches;
+
+    const double renders = std::max(1, result.pages * options.repeat);
+    const PassTimes& t = result.renderMs;
+    std::cout << std::left << std::setw(28) << fs::path(epubPath).filename().string() << std::right << std::fixed
+              << std::setprecision(2) << std::setw(7) << result.pages << std::setw(12) << result.layoutMs
+              << std::setw(12) << t.bw / renders << std::setw(12) << t.grayLsb / renders << std::setw(12)
+              << t.grayMsb / renders << std::setw(12) << (t.bw + t.grayLsb + t.grayMsb) / renders << std::setw(12)
+              << result.grayPages << std::setw(16)
+              << (std::to_string(result.refreshes[HalDisplay::HALF_REFRESH]) + "/" +
+                  std::to_string(result.refreshes[HalDisplay::FULL_REFRESH]))
+              << std::setw(12) << (result.pages + REFRESH_FREQUENCY - 1) / REFRESH_FREQUENCY << std::endl;
+  }
+
+  if (options.update) {
+    if (!writeGolden(options.goldenPath, golden)) {
+      std::cerr << "Failed to write " << options.goldenPath << std::endl;
+      return 1;
+    }
+    std::cout << "Golden manifest updated: " << golden.size() << " pages" << std::endl;
+    return 0;
+  }
+
+  if (mismatches > 0) {
+    std::cerr << mismatches << " page(s) differ, images written to " << options.outDir << std::endl;
+    return 1;
+  }
+  std::cout << "All pages match the golden manifest" << std::endl;
+  return 0;
+}
@@ -0,0 +1,58 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/gfx_benchmark"
+BINARY="$BUILD_DIR/GfxRendererBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+)
+
+SOURCES=(
+  "$ROOT_DIR/test/gfx_benchmark/GfxRendererBenchmark.cpp"
+  "$ROOT_DIR/test/host_stubs/HostStubs.cpp"
+  "$ROOT_DIR/lib/hal/HalDisplay.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+)
+
+# Host stand-ins come first so they shadow the SDK headers
+INCLUDES=(
+  -I"$ROOT_DIR/test/host_stubs"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/uzlib/src"
+  -I"$ROOT_DIR/lib"
+)
+
+CXXFLAGS=(
+  -std=gnu++2a
+  -O2
+  -Wall
+  -Wextra
+  -Wno-bidi-chars
+  -include cstdint
+  "${INCLUDES[@]}"
+)
+
+OBJECTS=()
+for source in "${C_SOURCES[@]}"; do
+  object="$BUILD_DIR/$(basename "${source%.c}").o"
+  cc -O2 -I"$ROOT_DIR/lib/uzlib/src" -c "$source" -o "$object"
+  OBJECTS+=("$object")
+done
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${OBJECTS[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
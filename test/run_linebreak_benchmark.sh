@@ -0,0 +1,70 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/linebreak_benchmark"
+BINARY="$BUILD_DIR/LineBreakBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+)
+
+SOURCES=(
+  "$ROOT_DIR/test/linebreak_benchmark/LineBreakBenchmark.cpp"
+  "$ROOT_DIR/test/host_stubs/HostStubs.cpp"
+  "$ROOT_DIR/lib/hal/HalDisplay.cpp"
+  "$ROOT_DIR/lib/hal/HalStorage.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/ParsedText.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/blocks/TextBlock.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/Hyphenator.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+)
+
+# Host stand-ins come first so they shadow the SDK headers
+INCLUDES=(
+  -I"$ROOT_DIR/test/host_stubs"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/uzlib/src"
+  -I"$ROOT_DIR/lib"
+  -I"$ROOT_DIR"
+)
+
+CXXFLAGS=(
+  -std=gnu++2a
+  -O2
+  -Wall
+  -Wextra
+  -Wno-bidi-chars
+  -include cstdint
+  "${INCLUDES[@]}"
+)
+
+OBJECTS=()
+for source in "${C_SOURCES[@]}"; do
+  object="$BUILD_DIR/$(basename "${source%.c}").o"
+  cc -O2 -I"$ROOT_DIR/lib/uzlib/src" -c "$source" -o "$object"
+  OBJECTS+=("$object")
+done
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${OBJECTS[@]}" -o "$BINARY"
+
+# The word lists are read relative to the repository root
+cd "$ROOT_DIR"
+"$BINARY" "$@"
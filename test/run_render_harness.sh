@@ -0,0 +1,92 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/render_harness"
+BINARY="$BUILD_DIR/RenderHarness"
+
+mkdir -p "$BUILD_DIR"
+
+C_SOURCES=(
+  "$ROOT_DIR/lib/uzlib/src/tinflate.c"
+  "$ROOT_DIR/lib/miniz/miniz.c"
+  "$ROOT_DIR/lib/picojpeg/picojpeg.c"
+  "$ROOT_DIR/lib/expat/xmlparse.c"
+  "$ROOT_DIR/lib/expat/xmlrole.c"
+  "$ROOT_DIR/lib/expat/xmltok.c"
+)
+
+SOURCES=(
+  "$ROOT_DIR/test/render_harness/RenderHarness.cpp"
+  "$ROOT_DIR/test/host_stubs/HostStubs.cpp"
+  "$ROOT_DIR/test/host_stubs/PNGdec.cpp"
+  "$ROOT_DIR/lib/hal/HalDisplay.cpp"
+  "$ROOT_DIR/lib/hal/HalStorage.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/GfxRenderer.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/RefreshScheduler.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/Bitmap.cpp"
+  "$ROOT_DIR/lib/GfxRenderer/BitmapHelpers.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFont.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontFamily.cpp"
+  "$ROOT_DIR/lib/EpdFont/EpdFontPack.cpp"
+  "$ROOT_DIR/lib/EpdFont/FontDecompressor.cpp"
+  "$ROOT_DIR/lib/Utf8/Utf8.cpp"
+  "$ROOT_DIR/lib/ZipFile/ZipFile.cpp"
+  "$ROOT_DIR/lib/FsHelpers/FsHelpers.cpp"
+  "$ROOT_DIR/lib/JpegToBmpConverter/JpegToBmpConverter.cpp"
+  "$ROOT_DIR/lib/PngToBmpConverter/PngToBmpConverter.cpp"
+)
+while IFS= read -r source; do
+  SOURCES+=("$source")
+done < <(find "$ROOT_DIR/lib/Epub" -name '*.cpp' | sort)
+
+DEFINES=(
+  -DMINIZ_NO_ZLIB_COMPATIBLE_NAMES=1
+  -DMINIZ_NO_STDIO=1
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  -DPNG_MAX_BUFFERED_PIXELS=16416
+  # Covers the experimental deferred image refresh, which reaches the panel with the same pixels
+  -DENABLE_WINDOWED_IMAGE_REFRESH=1
+)
+
+# Host stand-ins come first so they shadow the SDK headers
+INCLUDES=(
+  -I"$ROOT_DIR/test/host_stubs"
+  -I"$ROOT_DIR/lib/hal"
+  -I"$ROOT_DIR/lib/GfxRenderer"
+  -I"$ROOT_DIR/lib/EpdFont"
+  -I"$ROOT_DIR/lib/Epub"
+  -I"$ROOT_DIR/lib/Logging"
+  -I"$ROOT_DIR/lib/Serialization"
+  -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/lib/ZipFile"
+  -I"$ROOT_DIR/lib/FsHelpers"
+  -I"$ROOT_DIR/lib/JpegToBmpConverter"
+  -I"$ROOT_DIR/lib/PngToBmpConverter"
+  -I"$ROOT_DIR/lib/miniz"
+  -I"$ROOT_DIR/lib/picojpeg"
+  -I"$ROOT_DIR/lib/expat"
+  -I"$ROOT_DIR/lib/uzlib/src"
+  -I"$ROOT_DIR/lib"
+)
+
+CXXFLAGS=(
+  -std=gnu++2a
+  -O2
+  -Wno-bidi-chars
+  -include cstdint
+  "${DEFINES[@]}"
+  "${INCLUDES[@]}"
+)
+
+OBJECTS=()
+for source in "${C_SOURCES[@]}"; do
+  object="$BUILD_DIR/$(basename "${source%.c}").o"
+  cc -O2 "${DEFINES[@]}" "${INCLUDES[@]}" -c "$source" -o "$object"
+  OBJECTS+=("$object")
+done
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${OBJECTS[@]}" -o "$BINARY"
+
+"$BINARY" --golden "$ROOT_DIR/test/render_harness/golden.txt" --out "$BUILD_DIR/out" "$@" "$ROOT_DIR"/test/epubs/*.epub